@@ -0,0 +1,34 @@
+#!/bin/bash
+# Throughput of build/packingtape in MB/s on a few corpora
+# Usage: ./benchmark.bash [packingtape binary] [corpus...]
+
+BIN=${1:-build/packingtape}
+shift
+FILES=${@:-corpora/vim.small.c corpora/english.txt}
+
+# english.txt is only checked in compressed
+if [ ! -f corpora/english.txt ] && [ ! -f output/english.txt ]; then
+  zstd -d -q corpora/english.txt.zst -o output/english.txt
+fi
+
+now () {
+  date +%s.%N
+}
+
+for f in $FILES; do
+  [ -f $f ] || f=output/$(basename $f)
+  name=$(basename $f)
+  size=$(wc -c < $f)
+
+  start=$(now)
+  $BIN c $f output/$name.pt > /dev/null
+  mid=$(now)
+  $BIN d output/$name.pt output/$name.out > /dev/null
+  end=$(now)
+
+  cmp -s $f output/$name.out || echo "$name: round trip FAILED"
+  awk -v n=$name -v s=$size -v c=$(wc -c < output/$name.pt) -v a=$start -v b=$mid -v e=$end 'BEGIN {
+    printf "%-24s %10d -> %10d  compress %8.2f MB/s  decompress %8.2f MB/s\n", n, s, c, s/(b-a)/1e6, s/(e-b)/1e6
+  }'
+  rm -f output/$name.out
+done
@@ -0,0 +1,296 @@
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+#ifdef HAVE_IO_URING
+#include <sys/syscall.h>
+#include <linux/io_uring.h>
+#endif
+
+#include "asyncfile.h"
+
+static double AF_Now (void) {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+// One read or write on fd, retried when a signal cuts it short. Fails with -errno, as io_uring does
+static ssize_t AF_Transfer (int fd, int writing, uint8_t * data, size_t len, off_t offset) {
+  ssize_t n;
+  do {
+    if (writing) {
+      n = offset < 0 ? write(fd, data, len) : pwrite(fd, data, len, offset);
+    } else {
+      n = offset < 0 ? read(fd, data, len) : pread(fd, data, len, offset);
+    }
+  } while (n < 0 && errno == EINTR);
+  return n < 0 ? -errno : n;
+}
+
+static void * AF_Work (void * arg) {
+  AsyncFile * af = arg;
+  pthread_mutex_lock(&af->lock);
+  while (1) {
+    while (!af->hasRequest && !af->stopping) {
+      pthread_cond_wait(&af->requestReady, &af->lock);
+    }
+    if (!af->hasRequest) {
+      break;
+    }
+    uint8_t * data = af->blocks[1 - af->current] + af->done;
+    size_t len = af->requested - af->done;
+    off_t offset = af->offset;
+    pthread_mutex_unlock(&af->lock);
+    ssize_t n = AF_Transfer(af->fd, af->writing, data, len, offset);
+    pthread_mutex_lock(&af->lock);
+    af->result = n;
+    af->hasRequest = 0;
+    af->hasResult = 1;
+    pthread_cond_signal(&af->resultReady);
+  }
+  pthread_mutex_unlock(&af->lock);
+  return NULL;
+}
+
+#ifdef HAVE_IO_URING
+static int AF_SetupRing (AsyncFile * af) {
+  struct io_uring_params params = {0};
+  af->ring = syscall(__NR_io_uring_setup, 4, &params);
+  if (af->ring < 0) {
+    return 0;
+  }
+  af->sqRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+  af->cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+  af->sqesSize = params.sq_entries * sizeof(struct io_uring_sqe);
+  af->sqRing = mmap(NULL, af->sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, af->ring, IORING_OFF_SQ_RING);
+  af->cqRing = mmap(NULL, af->cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, af->ring, IORING_OFF_CQ_RING);
+  af->sqes = mmap(NULL, af->sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, af->ring, IORING_OFF_SQES);
+  if (af->sqRing == MAP_FAILED || af->cqRing == MAP_FAILED || af->sqes == MAP_FAILED) {
+    return 0;
+  }
+  af->sqTail = (unsigned *)((char *)af->sqRing + params.sq_off.tail);
+  af->sqMask = (unsigned *)((char *)af->sqRing + params.sq_off.ring_mask);
+  af->sqArray = (unsigned *)((char *)af->sqRing + params.sq_off.array);
+  af->cqHead = (unsigned *)((char *)af->cqRing + params.cq_off.head);
+  af->cqTail = (unsigned *)((char *)af->cqRing + params.cq_off.tail);
+  af->cqMask = (unsigned *)((char *)af->cqRing + params.cq_off.ring_mask);
+  af->cqes = (char *)af->cqRing + params.cq_off.cqes;
+
+  // Kernels before 5.6 set the ring up but turn down every read and write on it, and cannot be probed either
+  size_t probeSize = sizeof(struct io_uring_probe) + 256 * sizeof(struct io_uring_probe_op);
+  struct io_uring_probe * probe = calloc(1, probeSize);
+  int supported = probe != NULL && syscall(__NR_io_uring_register, af->ring, IORING_REGISTER_PROBE, probe, 256) == 0 &&
+    probe->ops_len > IORING_OP_WRITE && (probe->ops[IORING_OP_READ].flags & IO_URING_OP_SUPPORTED) &&
+    (probe->ops[IORING_OP_WRITE].flags & IO_URING_OP_SUPPORTED);
+  free(probe);
+  return supported;
+}
+
+static void AF_FreeRing (AsyncFile * af) {
+  if (af->sqRing != NULL && af->sqRing != MAP_FAILED) munmap(af->sqRing, af->sqRingSize);
+  if (af->cqRing != NULL && af->cqRing != MAP_FAILED) munmap(af->cqRing, af->cqRingSize);
+  if (af->sqes != NULL && af->sqes != MAP_FAILED) munmap(af->sqes, af->sqesSize);
+  if (af->ring >= 0) close(af->ring);
+  af->ring = -1;
+}
+
+// Queues the read or write of the other block and hands it to the kernel
+static int AF_SubmitRing (AsyncFile * af) {
+  unsigned tail = *af->sqTail;
+  unsigned index = tail & *af->sqMask;
+  struct io_uring_sqe * sqe = &((struct io_uring_sqe *)af->sqes)[index];
+  memset(sqe, 0, sizeof(*sqe));
+  sqe->opcode = af->writing ? IORING_OP_WRITE : IORING_OP_READ;
+  sqe->fd = af->fd;
+  sqe->addr = (uint64_t)(uintptr_t)(af->blocks[1 - af->current] + af->done);
+  sqe->len = af->requested - af->done;
+  sqe->off = af->offset;
+  af->sqArray[index] = index;
+  __atomic_store_n(af->sqTail, tail + 1, __ATOMIC_RELEASE);
+  int n;
+  do {
+    n = syscall(__NR_io_uring_enter, af->ring, 1, 0, 0, NULL, 0);
+  } while (n < 0 && errno == EINTR);
+  return n == 1;
+}
+
+static ssize_t AF_WaitRing (AsyncFile * af) {
+  unsigned head = *af->cqHead;
+  while (head == __atomic_load_n(af->cqTail, __ATOMIC_ACQUIRE)) {
+    if (syscall(__NR_io_uring_enter, af->ring, 0, 1, IORING_ENTER_GETEVENTS, NULL, 0) < 0 && errno != EINTR) {
+      return -errno;
+    }
+  }
+  struct io_uring_cqe * cqe = &((struct io_uring_cqe *)af->cqes)[head & *af->cqMask];
+  ssize_t result = cqe->res;
+  __atomic_store_n(af->cqHead, head + 1, __ATOMIC_RELEASE);
+  return result;
+}
+#endif
+
+// Starts moving the other block, requested bytes of it from done on
+static void AF_Start (AsyncFile * af) {
+  af->inFlight = 1;
+#ifdef HAVE_IO_URING
+  if (af->ring >= 0) {
+    if (!AF_SubmitRing(af)) {
+      af->inFlight = 0;
+      af->failed = 1;
+      af->error = errno;
+    }
+    return;
+  }
+#endif
+  pthread_mutex_lock(&af->lock);
+  af->hasRequest = 1;
+  pthread_cond_signal(&af->requestReady);
+  pthread_mutex_unlock(&af->lock);
+}
+
+// Waits for the read or write of the other block. Writes are finished off when the file took less than all of it.
+// Returns -1 with errno set if it failed
+static ssize_t AF_Wait (AsyncFile * af) {
+  if (!af->inFlight) {
+    if (af->failed) {
+      errno = af->error;
+      return -1;
+    }
+    return 0;
+  }
+  double start = AF_Now();
+  ssize_t n;
+  while (1) {
+#ifdef HAVE_IO_URING
+    if (af->ring >= 0) {
+      n = AF_WaitRing(af);
+    } else
+#endif
+    {
+      pthread_mutex_lock(&af->lock);
+      while (!af->hasResult) {
+        pthread_cond_wait(&af->resultReady, &af->lock);
+      }
+      af->hasResult = 0;
+      n = af->result;
+      pthread_mutex_unlock(&af->lock);
+    }
+    if (n == -EINTR || n == -EAGAIN) {
+      AF_Start(af);
+      continue;
+    }
+    if (n > 0 && af->offset >= 0) {
+      af->offset += n;
+    }
+    if (!af->writing || n <= 0 || af->done + n == af->requested) {
+      break;
+    }
+    af->done += n;
+    AF_Start(af);
+  }
+  af->inFlight = 0;
+  af->idle += AF_Now() - start;
+  if (n < 0 || (af->writing && n == 0 && af->requested > af->done)) {
+    // A file that takes nothing more is full
+    af->failed = 1;
+    af->error = n < 0 ? -n : ENOSPC;
+    errno = af->error;
+    return -1;
+  }
+  return n;
+}
+
+int AF_Open (AsyncFile * af, int fd, off_t offset, int writing, size_t blockSize, int useUring) {
+  *af = (AsyncFile) {
+    .fd = fd,
+    .writing = writing,
+    .offset = offset,
+    .blockSize = blockSize,
+    .ring = -1,
+  };
+  af->blocks[0] = malloc(blockSize);
+  af->blocks[1] = malloc(blockSize);
+  if (af->blocks[0] == NULL || af->blocks[1] == NULL) {
+    AF_Close(af);
+    return 0;
+  }
+#ifdef HAVE_IO_URING
+  // Reads and writes without offsets are left to the thread, io_uring only keeps them in order on newer kernels
+  if (useUring && offset >= 0 && AF_SetupRing(af)) {
+    return 1;
+  }
+  AF_FreeRing(af);
+#endif
+  pthread_mutex_init(&af->lock, NULL);
+  pthread_cond_init(&af->requestReady, NULL);
+  pthread_cond_init(&af->resultReady, NULL);
+  af->threaded = pthread_create(&af->thread, NULL, AF_Work, af) == 0;
+  if (!af->threaded) {
+    AF_Close(af);
+    return 0;
+  }
+  return 1;
+}
+
+uint8_t * AF_Read (AsyncFile * af, size_t * len) {
+  if (!af->inFlight && !af->eof) {
+    // The very first read has nothing to overlap with
+    af->requested = af->blockSize;
+    af->done = 0;
+    AF_Start(af);
+  }
+  ssize_t n = AF_Wait(af);
+  *len = n > 0 ? n : 0;
+  // Nothing more is read after an error either, failed tells the two apart
+  if (n <= 0) {
+    af->eof = 1;
+    return af->blocks[af->current];
+  }
+  af->current = 1 - af->current;
+
+  // Read ahead into the block the coder just finished with
+  af->requested = af->blockSize;
+  af->done = 0;
+  AF_Start(af);
+  return af->blocks[af->current];
+}
+
+uint8_t * AF_Write (AsyncFile * af, size_t len) {
+  // The other block has to be written before the coder can fill it
+  AF_Wait(af);
+  af->current = 1 - af->current;
+  if (len > 0 && !af->failed) {
+    af->requested = len;
+    af->done = 0;
+    AF_Start(af);
+  }
+  return af->blocks[af->current];
+}
+
+int AF_Flush (AsyncFile * af) {
+  return AF_Wait(af) >= 0;
+}
+
+void AF_Close (AsyncFile * af) {
+  AF_Wait(af);
+#ifdef HAVE_IO_URING
+  AF_FreeRing(af);
+#endif
+  if (af->threaded) {
+    pthread_mutex_lock(&af->lock);
+    af->stopping = 1;
+    pthread_cond_signal(&af->requestReady);
+    pthread_mutex_unlock(&af->lock);
+    pthread_join(af->thread, NULL);
+    pthread_mutex_destroy(&af->lock);
+    pthread_cond_destroy(&af->requestReady);
+    pthread_cond_destroy(&af->resultReady);
+    af->threaded = 0;
+  }
+  free(af->blocks[0]);
+  free(af->blocks[1]);
+  af->blocks[0] = af->blocks[1] = NULL;
+}
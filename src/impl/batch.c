@@ -0,0 +1,374 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdatomic.h>
+#include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#include "batch.h"
+#include "bytebuffer.h"
+#include "compressor.h"
+#include "decompressor.h"
+#include "segmentindex.h"
+#include "threadpool.h"
+
+typedef struct Batch {
+  ThreadPool pool;
+  CompressorPredictor* cp;
+  DecompressorPredictor* dp;
+  int files;
+  atomic_int failures;
+} Batch;
+
+typedef void (*Visit_t) (Batch* batch, char* path);
+
+static int isArchive (const char* path) {
+  size_t len = strlen(path);
+  size_t suffixLen = strlen(ARCHIVE_SUFFIX);
+  return len > suffixLen && strcmp(path + len - suffixLen, ARCHIVE_SUFFIX) == 0;
+}
+
+static void fail (Batch* batch, const char* path, const char* message) {
+  if (message == NULL) {
+    perror(path);
+  } else {
+    fprintf(stderr, "%s: %s\n", path, message);
+  }
+  atomic_fetch_add(&batch->failures, 1);
+}
+
+// Hands every regular file under dir to visit, which takes the path over. Symbolic links are not followed
+static void walk (Batch* batch, const char* dir, Visit_t visit) {
+  DIR* d = opendir(dir);
+  if (d == NULL) {
+    fail(batch, dir, NULL);
+    return;
+  }
+  struct dirent* entry;
+  while ((entry = readdir(d)) != NULL) {
+    if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0) {
+      continue;
+    }
+    char* path = malloc(strlen(dir) + strlen(entry->d_name) + 2);
+    sprintf(path, "%s/%s", dir, entry->d_name);
+    struct stat st;
+    if (lstat(path, &st) != 0) {
+      fail(batch, path, NULL);
+    } else if (S_ISDIR(st.st_mode)) {
+      walk(batch, path, visit);
+    } else if (S_ISREG(st.st_mode)) {
+      visit(batch, path);
+      continue;
+    }
+    free(path);
+  }
+  closedir(d);
+}
+
+// Compression
+
+typedef struct CompressedFile CompressedFile;
+
+typedef struct FileSegment {
+  CompressedFile* file;
+  CompressorPredictor p;
+  off_t offset; // Of the segment in the file
+  ByteBuffer in;
+  ByteBuffer archive;
+  SegmentIndex index;
+  int done;
+} FileSegment;
+
+struct CompressedFile {
+  Batch* batch;
+  char* path;
+  char* archivePath;
+  ByteBuffer in;
+  FILE* output;
+  ByteBuffer archive;
+  SegmentIndex index;
+
+  pthread_mutex_t lock;
+  FileSegment* segments;
+  int segmentCount;
+  int written; // Segments in the archive so far, they go in in order
+};
+
+static void finishCompressedFile (CompressedFile* file) {
+  SI_Write(&file->index, &file->archive, BB_Tell(&file->archive), file->in.len);
+  if (!BB_Flush(&file->archive) || fclose(file->output) != 0) {
+    fail(file->batch, file->archivePath, NULL);
+  }
+  BB_Free(&file->archive);
+  BB_Free(&file->in);
+  SI_Free(&file->index);
+  pthread_mutex_destroy(&file->lock);
+  free(file->segments);
+  free(file->path);
+  free(file->archivePath);
+  free(file);
+}
+
+static void compressFileSegment (void* arg) {
+  FileSegment* segment = arg;
+  CompressedFile* file = segment->file;
+  compressFrame(&segment->p, &segment->in, &segment->archive, segment->in.len, &segment->index);
+
+  // Whoever finishes the next segment in line writes it and any finished ones after it
+  pthread_mutex_lock(&file->lock);
+  segment->done = 1;
+  while (file->written < file->segmentCount && file->segments[file->written].done) {
+    FileSegment* next = &file->segments[file->written++];
+    SI_Merge(&file->index, &next->index, BB_Tell(&file->archive), next->offset);
+    BB_Write(&file->archive, next->archive.data, next->archive.pos);
+    BB_Free(&next->archive);
+    SI_Free(&next->index);
+  }
+  int finished = file->written == file->segmentCount;
+  pthread_mutex_unlock(&file->lock);
+  if (finished) {
+    finishCompressedFile(file);
+  }
+}
+
+static void compressFileJob (void* arg) {
+  CompressedFile* file = arg;
+  Batch* batch = file->batch;
+  FILE* input = fopen(file->path, "rb");
+  int mapped = input != NULL && BB_NewMappedReader(&file->in, fileno(input));
+  if (input != NULL) {
+    fclose(input);
+  }
+  file->archivePath = malloc(strlen(file->path) + strlen(ARCHIVE_SUFFIX) + 1);
+  sprintf(file->archivePath, "%s%s", file->path, ARCHIVE_SUFFIX);
+  file->output = mapped ? fopen(file->archivePath, "wb") : NULL;
+  if (file->output == NULL) {
+    fail(batch, mapped ? file->archivePath : file->path, NULL);
+    if (mapped) {
+      BB_Free(&file->in);
+    }
+    free(file->path);
+    free(file->archivePath);
+    free(file);
+    return;
+  }
+  BB_NewWriter(&file->archive, file->output);
+  SI_New(&file->index);
+  pthread_mutex_init(&file->lock, NULL);
+
+  // An empty file still needs its one empty frame
+  file->segmentCount = file->in.len == 0 ? 1 : (file->in.len + SEGMENT_SIZE - 1) / SEGMENT_SIZE;
+  file->segments = calloc(file->segmentCount, sizeof(FileSegment));
+  int startingCode = batch->cp->currentModel->code;
+  for (int i = 0; i < file->segmentCount; i++) {
+    FileSegment* segment = &file->segments[i];
+    segment->file = file;
+    segment->offset = (off_t)i * SEGMENT_SIZE;
+    size_t len = file->in.len - segment->offset < SEGMENT_SIZE ? file->in.len - segment->offset : SEGMENT_SIZE;
+    CP_New(&segment->p, batch->cp->models, batch->cp->modelCount, 0);
+    CP_SelectModel(&segment->p, startingCode);
+    BB_NewBorrowedReader(&segment->in, file->in.data + segment->offset, len);
+    BB_NewGrowingWriter(&segment->archive, len / 2 + 64);
+    SI_New(&segment->index);
+  }
+  // From inside the pool the segments go to this thread's deque, where idle threads steal them. The last one to
+  // finish frees the file, so it must not be looked at once they are all submitted
+  FileSegment* segments = file->segments;
+  int segmentCount = file->segmentCount;
+  for (int i = 0; i < segmentCount; i++) {
+    TP_Submit(&batch->pool, compressFileSegment, &segments[i]);
+  }
+}
+
+static void visitToCompress (Batch* batch, char* path) {
+  if (isArchive(path)) {
+    free(path);
+    return;
+  }
+  CompressedFile* file = calloc(1, sizeof(CompressedFile));
+  file->batch = batch;
+  file->path = path;
+  batch->files++;
+  TP_Submit(&batch->pool, compressFileJob, file);
+}
+
+// Decompression
+
+typedef struct DecompressedFile {
+  Batch* batch;
+  char* path;
+  char* outputPath;
+  ByteBuffer archive;
+  SegmentIndex index;
+  int fd;
+  atomic_int remaining; // Frames still decoding
+  atomic_int failed;
+} DecompressedFile;
+
+typedef struct FrameJob {
+  DecompressedFile* file;
+  DecompressorPredictor p;
+  RestartPoint* start;
+  RestartPoint* end;
+} FrameJob;
+
+static void finishDecompressedFile (DecompressedFile* file) {
+  if (atomic_load(&file->failed)) {
+    fail(file->batch, file->path, "not a packingtape archive, or a damaged one");
+  }
+  if (file->fd >= 0 && close(file->fd) != 0) {
+    fail(file->batch, file->outputPath, NULL);
+  }
+  BB_Free(&file->archive);
+  SI_Free(&file->index);
+  free(file->path);
+  free(file->outputPath);
+  free(file);
+}
+
+static void decompressFrameJob (void* arg) {
+  FrameJob* job = arg;
+  DecompressedFile* file = job->file;
+  size_t size = job->end->offset - job->start->offset;
+  uint8_t* data = malloc(size);
+  size_t decoded;
+  int ok = data != NULL && decompressBuffer(file->archive.data + job->start->compressedOffset,
+      job->end->compressedOffset - job->start->compressedOffset, data, size, &decoded, &job->p) && decoded == size;
+  for (size_t written = 0; ok && written < size; ) {
+    ssize_t n = pwrite(file->fd, data + written, size - written, job->start->offset + written);
+    ok = n > 0;
+    written += n;
+  }
+  free(data);
+  if (!ok) {
+    atomic_store(&file->failed, 1);
+  }
+  free(job);
+  if (atomic_fetch_sub(&file->remaining, 1) == 1) {
+    finishDecompressedFile(file);
+  }
+}
+
+static void decompressFileJob (void* arg) {
+  DecompressedFile* file = arg;
+  Batch* batch = file->batch;
+  file->fd = -1;
+  SI_New(&file->index);
+  FILE* input = fopen(file->path, "rb");
+  int mapped = input != NULL && BB_NewMappedReader(&file->archive, fileno(input));
+  if (input != NULL) {
+    fclose(input);
+  }
+  if (!mapped) {
+    fail(batch, file->path, NULL);
+    finishDecompressedFile(file);
+    return;
+  }
+
+  // Frames of a segmented archive are small enough to decode in memory, anything else is streamed in one job
+  int frames = 0;
+  SI_Free(&file->index);
+  if (SI_Read(&file->index, file->archive.data, file->archive.len)) {
+    RestartPoint* previous = NULL;
+    for (uint64_t i = 0; i <= file->index.count; i++) {
+      RestartPoint* point = &file->index.points[i];
+      if (!point->frameStart) {
+        continue;
+      }
+      if (previous != NULL && point->offset - previous->offset > 2 * SEGMENT_SIZE) {
+        frames = 0;
+        break;
+      }
+      frames += i < file->index.count;
+      previous = point;
+    }
+  }
+
+  if (frames < 2) {
+    FILE* output = fopen(file->outputPath, "wb");
+    if (output == NULL) {
+      fail(batch, file->outputPath, NULL);
+      finishDecompressedFile(file);
+      return;
+    }
+    DecompressorPredictor p = *batch->dp;
+    ByteBuffer out;
+    BB_NewWriter(&out, output);
+    atomic_store(&file->failed, !decompressFrames(&p, &file->archive, &out, UINT64_MAX));
+    if (!BB_Flush(&out) || fclose(output) != 0) {
+      fail(batch, file->outputPath, NULL);
+    }
+    BB_Free(&out);
+    finishDecompressedFile(file);
+    return;
+  }
+
+  file->fd = open(file->outputPath, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+  if (file->fd < 0 || ftruncate(file->fd, file->index.points[file->index.count].offset) != 0) {
+    fail(batch, file->outputPath, NULL);
+    finishDecompressedFile(file);
+    return;
+  }
+  // The last frame to finish frees the file, so stop looking at it once every frame is submitted
+  atomic_store(&file->remaining, frames);
+  RestartPoint* start = NULL;
+  for (uint64_t i = 0; frames > 0; i++) {
+    RestartPoint* point = &file->index.points[i];
+    if (!point->frameStart) {
+      continue;
+    }
+    if (start != NULL) {
+      FrameJob* job = malloc(sizeof(FrameJob));
+      *job = (FrameJob) {
+        .file = file,
+        .p = *batch->dp,
+        .start = start,
+        .end = point,
+      };
+      frames--;
+      TP_Submit(&batch->pool, decompressFrameJob, job);
+    }
+    start = point;
+  }
+}
+
+static void visitToDecompress (Batch* batch, char* path) {
+  if (!isArchive(path)) {
+    free(path);
+    return;
+  }
+  DecompressedFile* file = calloc(1, sizeof(DecompressedFile));
+  file->batch = batch;
+  file->path = path;
+  file->outputPath = strndup(path, strlen(path) - strlen(ARCHIVE_SUFFIX));
+  batch->files++;
+  TP_Submit(&batch->pool, decompressFileJob, file);
+}
+
+static int runBatch (Batch* batch, const char* dir, int threads, Visit_t visit) {
+  if (!TP_New(&batch->pool, threads)) {
+    fprintf(stderr, "%s: could not start any threads\n", dir);
+    return 1;
+  }
+  atomic_init(&batch->failures, 0);
+  walk(batch, dir, visit);
+  TP_Wait(&batch->pool);
+  TP_Free(&batch->pool);
+  return atomic_load(&batch->failures);
+}
+
+int compressTree (const char* dir, CompressorPredictor* p, int threads) {
+  Batch batch = {
+    .cp = p,
+  };
+  return runBatch(&batch, dir, threads, visitToCompress);
+}
+
+int decompressTree (const char* dir, DecompressorPredictor* p, int threads) {
+  Batch batch = {
+    .dp = p,
+  };
+  return runBatch(&batch, dir, threads, visitToDecompress);
+}
@@ -0,0 +1,384 @@
+#define _GNU_SOURCE
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "bytebuffer.h"
+
+static int BB_DrainFile (ByteBuffer * bb) {
+  size_t written = fwrite(bb->data, 1, bb->pos, bb->file);
+  int ok = written == bb->pos;
+  bb->offset += bb->pos;
+  bb->pos = 0;
+  return ok;
+}
+
+static int BB_FillFile (ByteBuffer * bb) {
+  bb->offset += bb->len;
+  bb->len = fread(bb->data, 1, BB_BLOCK_SIZE, bb->file);
+  bb->pos = 0;
+  return bb->len > 0;
+}
+
+static int BB_DrainAsync (ByteBuffer * bb) {
+  bb->offset += bb->pos;
+  bb->data = AF_Write(bb->async, bb->pos);
+  bb->pos = 0;
+  return !bb->async->failed;
+}
+
+static int BB_FillAsync (ByteBuffer * bb) {
+  bb->offset += bb->len;
+  bb->data = AF_Read(bb->async, &bb->len);
+  bb->pos = 0;
+  return bb->len > 0;
+}
+
+// Memory and mapped readers hold everything up front, so there is never anything left to fill
+static int BB_FillNone (ByteBuffer * bb) {
+  return 0;
+}
+
+static int BB_Grow (ByteBuffer * bb) {
+  bb->len = bb->len * 2 + 16;
+  bb->data = realloc(bb->data, bb->len);
+  return 1;
+}
+
+// A full fixed writer moves on to a scratch block of its own and keeps counting
+static int BB_Spill (ByteBuffer * bb) {
+  if (bb->borrowed) {
+    bb->data = malloc(BB_BLOCK_SIZE);
+    bb->borrowed = 0;
+  }
+  bb->offset += bb->pos;
+  bb->pos = 0;
+  bb->len = BB_BLOCK_SIZE;
+  return 0;
+}
+
+static int BB_Reserve (ByteBuffer * bb, off_t size) {
+  if (size <= bb->reserved) {
+    return 1;
+  }
+  if (ftruncate(bb->fd, size) != 0) {
+    return 0;
+  }
+#ifdef __linux__
+  // Best effort, the file is already large enough to map
+  fallocate(bb->fd, 0, bb->reserved, size - bb->reserved);
+#endif
+  bb->reserved = size;
+  return 1;
+}
+
+static uint8_t * BB_MapWindow (ByteBuffer * bb, off_t base, size_t length) {
+  if (!BB_Reserve(bb, base + length)) {
+    return NULL;
+  }
+  void * window = mmap(NULL, length, PROT_READ | PROT_WRITE, MAP_SHARED, bb->fd, base);
+  return window == MAP_FAILED ? NULL : window;
+}
+
+// Slides the window forward. If the next one cannot be mapped, the writer spills as a full fixed writer does, so it
+// keeps counting and BB_Flush fails
+static int BB_DrainMapped (ByteBuffer * bb) {
+  uint8_t * window = BB_MapWindow(bb, bb->offset + bb->len, BB_MAP_WINDOW);
+  munmap(bb->data, bb->len);
+  if (window == NULL) {
+    bb->mapped = 0;
+    bb->borrowed = 1;
+    bb->refill = BB_Spill;
+    return BB_Spill(bb);
+  }
+  bb->data = window;
+  bb->offset += bb->len;
+  bb->len = BB_MAP_WINDOW;
+  bb->pos = 0;
+  return 1;
+}
+
+// Pipes have no position, count from zero for them
+static off_t BB_FileOffset (FILE * file) {
+  off_t offset = ftello(file);
+  return offset < 0 ? 0 : offset;
+}
+
+void BB_NewWriter (ByteBuffer * bb, FILE * file) {
+  *bb = (ByteBuffer) {
+    .data = malloc(BB_BLOCK_SIZE),
+    .len = BB_BLOCK_SIZE,
+    .refill = BB_DrainFile,
+    .file = file,
+    .fd = -1,
+    .offset = BB_FileOffset(file),
+  };
+}
+
+void BB_NewReader (ByteBuffer * bb, FILE * file) {
+  *bb = (ByteBuffer) {
+    .data = malloc(BB_BLOCK_SIZE),
+    .refill = BB_FillFile,
+    .file = file,
+    .fd = -1,
+    .offset = BB_FileOffset(file),
+  };
+}
+
+// Regular files are read and written at offsets, which leaves the file position alone. Anything else goes through the
+// position
+static off_t BB_AsyncOffset (FILE * file) {
+  struct stat st;
+  if (fstat(fileno(file), &st) != 0 || !S_ISREG(st.st_mode)) {
+    return -1;
+  }
+  return BB_FileOffset(file);
+}
+
+void BB_NewAsyncWriter (ByteBuffer * bb, FILE * file) {
+  AsyncFile * async = malloc(sizeof(AsyncFile));
+  fflush(file);
+  off_t offset = BB_AsyncOffset(file);
+  if (async == NULL || !AF_Open(async, fileno(file), offset, 1, BB_BLOCK_SIZE, 1)) {
+    free(async);
+    BB_NewWriter(bb, file);
+    return;
+  }
+  *bb = (ByteBuffer) {
+    .data = async->blocks[async->current],
+    .len = BB_BLOCK_SIZE,
+    .refill = BB_DrainAsync,
+    .file = file,
+    .async = async,
+    .fd = -1,
+    .offset = offset < 0 ? 0 : offset,
+  };
+}
+
+void BB_NewAsyncReader (ByteBuffer * bb, FILE * file) {
+  AsyncFile * async = malloc(sizeof(AsyncFile));
+  off_t offset = BB_AsyncOffset(file);
+  if (async == NULL || !AF_Open(async, fileno(file), offset, 0, BB_BLOCK_SIZE, 1)) {
+    free(async);
+    BB_NewReader(bb, file);
+    return;
+  }
+  *bb = (ByteBuffer) {
+    .refill = BB_FillAsync,
+    .file = file,
+    .async = async,
+    .fd = -1,
+    .offset = offset < 0 ? 0 : offset,
+  };
+}
+
+double BB_IdleSeconds (ByteBuffer * bb) {
+  return bb->async != NULL ? bb->async->idle : 0;
+}
+
+int BB_NewMappedReader (ByteBuffer * bb, int fd) {
+  *bb = (ByteBuffer) {
+    .refill = BB_FillNone,
+    .mapped = 1,
+    .fd = fd,
+  };
+  struct stat st;
+  if (fstat(fd, &st) != 0) {
+    return 0;
+  }
+  // Pipes and devices have no size to map, they are for the stdio path too
+  if (!S_ISREG(st.st_mode)) {
+    errno = ENODEV;
+    return 0;
+  }
+  // Leave inputs that do not fit the address space to the stdio path
+  if ((uint64_t)st.st_size > SIZE_MAX) {
+    return 0;
+  }
+  bb->len = st.st_size;
+  if (bb->len > 0) {
+    void * map = mmap(NULL, bb->len, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (map == MAP_FAILED) {
+      return 0;
+    }
+    madvise(map, bb->len, MADV_SEQUENTIAL);
+    bb->data = map;
+  }
+  return 1;
+}
+
+int BB_NewMappedWriter (ByteBuffer * bb, int fd, off_t offset, off_t sizeHint) {
+  // Mappings have to start on a page, so the first window may begin before offset. It only spans the hint, rounded up
+  // to a page, and the windows after it are BB_MAP_WINDOW
+  long page = sysconf(_SC_PAGESIZE);
+  off_t base = offset - offset % page;
+  off_t length = (offset - base + sizeHint + page) / page * page;
+  *bb = (ByteBuffer) {
+    .pos = offset - base,
+    .len = length < BB_MAP_WINDOW ? length : BB_MAP_WINDOW,
+    .refill = BB_DrainMapped,
+    .mapped = 1,
+    .fd = fd,
+    .offset = base,
+  };
+  if (!BB_Reserve(bb, offset + sizeHint)) {
+    return 0;
+  }
+  bb->data = BB_MapWindow(bb, base, bb->len);
+  return bb->data != NULL;
+}
+
+void BB_NewGrowingWriter (ByteBuffer * bb, size_t capacity) {
+  *bb = (ByteBuffer) {
+    .data = malloc(capacity),
+    .len = capacity,
+    .refill = BB_Grow,
+    .fd = -1,
+  };
+}
+
+void BB_NewMemoryReader (ByteBuffer * bb, uint8_t * data, size_t len) {
+  *bb = (ByteBuffer) {
+    .data = data,
+    .len = len,
+    .refill = BB_FillNone,
+    .fd = -1,
+  };
+}
+
+void BB_NewBorrowedReader (ByteBuffer * bb, const uint8_t * data, size_t len) {
+  *bb = (ByteBuffer) {
+    .data = (uint8_t *)data,
+    .len = len,
+    .refill = BB_FillNone,
+    .borrowed = 1,
+    .fd = -1,
+  };
+}
+
+void BB_NewFixedWriter (ByteBuffer * bb, uint8_t * data, size_t capacity) {
+  *bb = (ByteBuffer) {
+    .data = data,
+    .len = capacity,
+    .refill = BB_Spill,
+    .borrowed = 1,
+    .fd = -1,
+  };
+}
+
+void BB_Write (ByteBuffer * bb, const uint8_t * data, size_t len) {
+  while (len > 0) {
+    if (bb->pos == bb->len) {
+      bb->refill(bb);
+    }
+    size_t n = bb->len - bb->pos < len ? bb->len - bb->pos : len;
+    memcpy(bb->data + bb->pos, data, n);
+    bb->pos += n;
+    data += n;
+    len -= n;
+  }
+}
+
+size_t BB_Read (ByteBuffer * bb, uint8_t * data, size_t len) {
+  size_t read = 0;
+  while (read < len) {
+    if (bb->pos == bb->len && !bb->refill(bb)) {
+      break;
+    }
+    size_t n = bb->len - bb->pos < len - read ? bb->len - bb->pos : len - read;
+    memcpy(data + read, bb->data + bb->pos, n);
+    bb->pos += n;
+    read += n;
+  }
+  return read;
+}
+
+// Little endian, the way the header length has always been written on x86
+void BB_PutUint64 (ByteBuffer * bb, uint64_t n) {
+  for (int i = 0; i < 8; i++) {
+    BB_PutByte(bb, (n >> (8 * i)) & 0xff);
+  }
+}
+
+int BB_GetUint64 (ByteBuffer * bb, uint64_t * n) {
+  *n = 0;
+  for (int i = 0; i < 8; i++) {
+    int c = BB_GetByte(bb);
+    if (c == EOF) {
+      return 0;
+    }
+    *n |= (uint64_t)c << (8 * i);
+  }
+  return 1;
+}
+
+void BB_PutUint32 (ByteBuffer * bb, uint32_t n) {
+  for (int i = 0; i < 4; i++) {
+    BB_PutByte(bb, (n >> (8 * i)) & 0xff);
+  }
+}
+
+int BB_GetUint32 (ByteBuffer * bb, uint32_t * n) {
+  *n = 0;
+  for (int i = 0; i < 4; i++) {
+    int c = BB_GetByte(bb);
+    if (c == EOF) {
+      return 0;
+    }
+    *n |= (uint32_t)c << (8 * i);
+  }
+  return 1;
+}
+
+off_t BB_Tell (ByteBuffer * bb) {
+  return bb->offset + bb->pos;
+}
+
+int BB_Failed (ByteBuffer * bb) {
+  if (bb->async != NULL && bb->async->failed) {
+    errno = bb->async->error;
+    return 1;
+  }
+  return bb->refill == BB_FillFile && ferror(bb->file);
+}
+
+int BB_Flush (ByteBuffer * bb) {
+  if (bb->refill == BB_DrainFile) {
+    int ok = BB_DrainFile(bb);
+    return fflush(bb->file) == 0 && ok;
+  }
+  if (bb->refill == BB_DrainMapped) {
+    // Cut the preallocated tail back off
+    return ftruncate(bb->fd, BB_Tell(bb)) == 0;
+  }
+  if (bb->refill == BB_Spill) {
+    return bb->borrowed;
+  }
+  if (bb->refill == BB_DrainAsync) {
+    int ok = BB_DrainAsync(bb);
+    return AF_Flush(bb->async) && ok;
+  }
+  return 1;
+}
+
+void BB_Free (ByteBuffer * bb) {
+  if (bb->async != NULL) {
+    // The blocks belong to the async file
+    AF_Close(bb->async);
+    free(bb->async);
+    bb->async = NULL;
+  } else if (bb->mapped) {
+    if (bb->data != NULL) {
+      munmap(bb->data, bb->len);
+    }
+  } else if (!bb->borrowed) {
+    free(bb->data);
+  }
+  bb->data = NULL;
+}
@@ -3,81 +3,1545 @@
 #include <string.h>
 #include <assert.h>
 #include <stdbool.h>
+#include <math.h>
+#include <pthread.h>
+#include <sys/stat.h>
 
 #include "compressor.h"
 #include "compressorpredictor.h"
 #include "util.h"
+#include "bytebuffer.h"
 #include "modelenum.h"
+#include "threadpool.h"
+#include "segmentindex.h"
+#include "spscring.h"
+#include "rans.h"
 
-void encode (CompressorPredictor * p, uint32_t* x1, uint32_t* x2, int y, FILE* archive, FILE* input, int prediction, short changeInterval) {
+// Codes a bit the predictor does not see, like the model switches
+void encodeRaw (uint32_t* x1, uint32_t* x2, int y, ByteBuffer* archive, int prediction) {
   // Update the range
-  const uint32_t xmid = *x1 + ((*x2-*x1) >> 12) * prediction;
+  const uint32_t xmid = *x1 + (uint32_t)(((uint64_t)(*x2-*x1) * prediction) >> PREDICTION_BITS);
   assert(xmid >= *x1 && xmid < *x2);
   if (y)
     *x2=xmid;
   else
     *x1=xmid+1;
-  CP_Update(p, y);
-  /*printf("%d\n", prediction);*/
 
   // Shift equal MSB's out
   while (((*x1^*x2)&0xff000000)==0) {
-    putc(*x2>>24, archive);
+    BB_PutByte(archive, *x2>>24);
     *x1<<=8;
     *x2=(*x2<<8)+255;
   }
 }
 
-void writeHeader (FILE* archive, int startingCode, uint32_t headerLength) {
-  rewind(archive);
-  fwrite(&headerLength, sizeof(uint32_t), 1, archive);
-  putc(startingCode, archive);
+// Codes whether the model changes at this block and, if it does, which of the other models comes next
+void encodeModelCode (CompressorPredictor* p, uint32_t* x1, uint32_t* x2, ByteBuffer* archive, int* switchPrediction, int previousCode, int modelCode) {
+  int switched = modelCode != previousCode;
+  encodeRaw(x1, x2, switched, archive, *switchPrediction);
+  *switchPrediction = updateSwitchPrediction(*switchPrediction, switched);
+  if (switched) {
+    int index = modelCode < previousCode ? modelCode : modelCode - 1;
+    for (int i=modelCodeBits(p->modelCount)-1; i>=0; --i) {
+      encodeRaw(x1, x2, (index>>i)&1, archive, EVEN_PREDICTION);
+    }
+  }
+}
+
+// Codes whether a block of a stream of unknown size is short and, if it is, how long it is and whether it is the last
+// block or a sync flush
+void encodeBlockLength (uint32_t* x1, uint32_t* x2, ByteBuffer* archive, int end, int length) {
+  encodeRaw(x1, x2, end != BLOCK_MORE, archive, SHORT_PREDICTION);
+  if (end != BLOCK_MORE) {
+    for (int i=BLOCK_LENGTH_BITS-1; i>=0; --i) {
+      encodeRaw(x1, x2, (length>>i)&1, archive, EVEN_PREDICTION);
+    }
+    encodeRaw(x1, x2, end == BLOCK_LAST, archive, EVEN_PREDICTION);
+  }
+}
+
+void writeHeader (ByteBuffer* archive, int startingCode, uint64_t contentSize, int layout) {
+  BB_Write(archive, (const uint8_t*)FRAME_MAGIC, 4);
+  BB_PutByte(archive, FRAME_VERSION);
+  BB_PutByte(archive, (contentSize == UNKNOWN_SIZE ? 0 : FRAME_SIZED) | layout);
+  BB_PutByte(archive, startingCode);
+  if (contentSize != UNKNOWN_SIZE) {
+    BB_PutUint64(archive, contentSize);
+  }
+}
+
+void writeFrameEnd (ByteBuffer* archive, uint64_t contentSize) {
+  BB_Write(archive, (const uint8_t*)FRAME_END_MAGIC, 4);
+  BB_PutUint64(archive, contentSize);
+}
+
+// Bits it takes to code a 0 or a 1 at each prediction, to price blocks with
+static float bitCosts[2][MODEL_LIMIT + 1];
+static pthread_once_t bitCostsOnce = PTHREAD_ONCE_INIT;
+
+static void initBitCosts (void) {
+  for (int prediction = 0; prediction <= MODEL_LIMIT; prediction++) {
+    // A 1 gets prediction/65536 of the coder's range. Tables should never predict 0, but a 1 would still fit
+    double one = (prediction > 0 ? prediction : 1) / (double)(1 << PREDICTION_BITS);
+    bitCosts[1][prediction] = -log2(one);
+    bitCosts[0][prediction] = -log2(1 - one);
+  }
+}
+
+// A block with everything the predictor has to say about it. The probabilities only depend on the data, so they can
+// be worked out ahead of the coder
+typedef struct PredictedBlock {
+  uint8_t data[CHANGE_INTERVAL];
+  uint16_t predictions[CHANGE_INTERVAL * 8];
+  int length;
+  int end;
+  context ctx; // Before the block
+  int previousCode;
+  int modelCode;
+  float cost; // Of coding the data with the predictions, in bits
+} PredictedBlock;
+
+// Predicts a block with the model modelCode, switching to it if it is not the current one
+static void predictBlockWith (CompressorPredictor* p, int modelCode, const uint8_t* block, int length, int end, PredictedBlock* predicted) {
+  predicted->length = length;
+  predicted->end = end;
+  predicted->ctx = p->ctx;
+  predicted->previousCode = p->currentModel->code;
+  predicted->modelCode = modelCode;
+  CP_SelectModel(p, modelCode);
+
+  pthread_once(&bitCostsOnce, initBitCosts);
+  memcpy(predicted->data, block, length);
+  uint16_t* prediction = predicted->predictions;
+  float cost = 0;
+  for (int j=0; j<length; ++j) {
+    int c = block[j];
+    for (int i=7; i>=0; --i) {
+      int bit = (c>>i)&1;
+      *prediction = CP_Predict(p);
+      cost += bitCosts[bit][*prediction++];
+      CP_Update(p, bit);
+    }
+  }
+  predicted->cost = cost;
+}
+
+// The predictor's half of encodeBlock. Every block after the first picks the model it is coded with
+static void predictBlock (CompressorPredictor* p, int first, const uint8_t* block, int length, int end, PredictedBlock* predicted) {
+  int modelCode = first ? p->currentModel->code : CP_GetBestModel(p)->code;
+  predictBlockWith(p, modelCode, block, length, end, predicted);
+}
+
+// Whether storing the block as it is takes fewer bits than coding it, when storing costs flushBits on top of the data
+static int storesBlock (const PredictedBlock* predicted, int flushBits) {
+  return predicted->cost > 8 * predicted->length + flushBits;
+}
+
+// Bits the byte model codes block in, starting from ctx. A symbol with width of the slots costs what a 1 at a prediction
+// of width does
+static float priceBytes (const uint8_t* block, int length, context ctx) {
+  float cost = 0;
+  for (int j=0; j<length; ++j) {
+    const uint16_t* starts = &BYTE1_Data[(ctx & 0xff) << 8];
+    int c = block[j];
+    int width = (c < 255 ? starts[c + 1] : 1 << PREDICTION_BITS) - starts[c];
+    cost += bitCosts[1][width];
+    ctx = (ctx << 8) | c;
+  }
+  return cost;
+}
+
+// What the coder of a block of a run needs to code it again, stored, or to store it without its predictions
+typedef struct RunBlock {
+  int length;
+  int end;
+  int previousCode;
+  int modelCode;
+} RunBlock;
+
+// The blocks of the run an interleaved or rANS frame is coding, in case it comes out larger than MAX_RUN allows, or of a
+// run of stored blocks. Only the last block of a frame is short, so block i starts at i * CHANGE_INTERVAL
+typedef struct Run {
+  uint8_t data[CODER_RUN];
+  RunBlock blocks[CODER_RUN / CHANGE_INTERVAL];
+  int count;
+  int switchPrediction; // Of the coder before the run
+  uint64_t blockCount;
+} Run;
+
+static void startRunBlocks (Run* run, const Coder* coder) {
+  run->count = 0;
+  run->switchPrediction = coder->switchPrediction;
+  run->blockCount = coder->blockCount;
+}
+
+static void keepRunBlock (Run* run, const PredictedBlock* predicted) {
+  memcpy(run->data + (size_t)run->count * CHANGE_INTERVAL, predicted->data, predicted->length);
+  run->blocks[run->count++] = (RunBlock) {
+    .length = predicted->length,
+    .end = predicted->end,
+    .previousCode = predicted->previousCode,
+    .modelCode = predicted->modelCode,
+  };
+}
+
+// Sets predicted up as block i of the run, priced so the coder stores it. The first block also puts the coder back to
+// where it was before the run
+static void storedRunBlock (const Run* run, int i, Coder* coder, PredictedBlock* predicted) {
+  const RunBlock* block = &run->blocks[i];
+  memcpy(predicted->data, run->data + (size_t)i * CHANGE_INTERVAL, block->length);
+  predicted->length = block->length;
+  predicted->end = block->end;
+  predicted->previousCode = block->previousCode;
+  predicted->modelCode = block->modelCode;
+  predicted->cost = INFINITY;
+  if (i == 0) {
+    coder->switchPrediction = run->switchPrediction;
+    coder->blockCount = run->blockCount;
+  }
+}
+
+// Carries the context of p on over length stored bytes. It only keeps the last 2 of them
+static void skipStored (CompressorPredictor* p, const uint8_t* data, size_t length) {
+  for (size_t j = length >= 2 ? length - 2 : 0; j < length; ++j) {
+    p->ctx = (p->ctx << 8) | data[j];
+  }
+}
+
+// Sets predicted up as a block to be stored with the current model of p, without predicting it
+static void storeBlock (CompressorPredictor* p, const uint8_t* block, int length, int end, PredictedBlock* predicted) {
+  predicted->length = length;
+  predicted->end = end;
+  predicted->ctx = p->ctx;
+  predicted->previousCode = p->currentModel->code;
+  predicted->modelCode = p->currentModel->code;
+  predicted->cost = INFINITY;
+  memcpy(predicted->data, block, length);
+  skipStored(p, block, length);
+}
+
+// Bytes of data in the blocks of the run
+static size_t runLength (const Run* run) {
+  return (size_t)(run->count - 1) * CHANGE_INTERVAL + run->blocks[run->count - 1].length;
+}
+
+// Adds the block that follows the last of the run to it, to be stored with the current model of p
+static void keepStoredBlock (CompressorPredictor* p, Run* run, int length, int end) {
+  int modelCode = p->currentModel->code;
+  run->blocks[run->count++] = (RunBlock) {
+    .length = length,
+    .end = end,
+    .previousCode = modelCode,
+    .modelCode = modelCode,
+  };
+}
+
+// Data that is already compressed tends to go on for a while. After this many blocks of a CODER_RUN in a row are
+// stored, the coders price the blocks after them with the byte model before the models get to predict them
+#define STORED_STREAK 4
+
+// Counts the blocks stored in a row since the start of the CODER_RUN, after a block that ends at coded
+static int countStreak (int streak, int stored, uint64_t coded) {
+  return stored && coded % CODER_RUN != 0 ? streak + 1 : 0;
+}
+
+// Codes whether a stored block is the first of a run and, if it is, how many blocks follow it and how the last of
+// them ends when the blocks code their length. run is NULL for a block stored on its own
+static void encodeStoredRun (uint32_t* x1, uint32_t* x2, ByteBuffer* archive, const Run* run, int sized) {
+  int follow = run != NULL ? run->count - 1 : 0;
+  encodeRaw(x1, x2, follow > 0, archive, EVEN_PREDICTION);
+  if (follow > 0) {
+    for (int i=STORED_RUN_BITS-1; i>=0; --i) {
+      encodeRaw(x1, x2, (follow>>i)&1, archive, EVEN_PREDICTION);
+    }
+    if (!sized) {
+      const RunBlock* lastBlock = &run->blocks[run->count - 1];
+      encodeBlockLength(x1, x2, archive, lastBlock->end, lastBlock->length);
+    }
+  }
+}
+
+// The coder's half of encodeBlock. Only reads modelCount from the predictor
+static void codeBlock (CompressorPredictor* p, Coder* coder, const PredictedBlock* predicted, int sized, ByteBuffer* archive) {
+  if (coder->blockCount++ > 0) {
+    encodeModelCode(p, &coder->x1, &coder->x2, archive, &coder->switchPrediction, predicted->previousCode, predicted->modelCode);
+  }
+  if (!sized) {
+    encodeBlockLength(&coder->x1, &coder->x2, archive, predicted->end, predicted->length);
+  }
+
+  int stored = storesBlock(predicted, 32);
+  encodeRaw(&coder->x1, &coder->x2, stored, archive, STORED_PREDICTION);
+  if (stored) {
+    encodeStoredRun(&coder->x1, &coder->x2, archive, NULL, sized);
+    flush(&coder->x1, &coder->x2, archive);
+    BB_Write(archive, predicted->data, predicted->length);
+    coder->x1 = 0;
+    coder->x2 = 0xffffffff;
+    return;
+  }
+
+  const uint16_t* prediction = predicted->predictions;
+  for (int j=0; j<predicted->length; ++j) {
+    int c = predicted->data[j];
+    for (int i=7; i>=0; --i) {
+      encodeRaw(&coder->x1, &coder->x2, (c>>i)&1, archive, *prediction++);
+    }
+  }
+
+  if (predicted->end != BLOCK_MORE) {
+    flush(&coder->x1, &coder->x2, archive);
+    coder->x1 = 0;
+    coder->x2 = 0xffffffff;
+  }
+}
+
+// Codes a run of stored blocks as codeBlock codes its first block, with the others after it in the same flush. data
+// has the bytes of them all
+static void codeStoredRun (CompressorPredictor* p, Coder* coder, const Run* run, const uint8_t* data, int sized, ByteBuffer* archive) {
+  const RunBlock* first = &run->blocks[0];
+  if (coder->blockCount++ > 0) {
+    encodeModelCode(p, &coder->x1, &coder->x2, archive, &coder->switchPrediction, first->previousCode, first->modelCode);
+  }
+  if (!sized) {
+    encodeBlockLength(&coder->x1, &coder->x2, archive, first->end, first->length);
+  }
+  encodeRaw(&coder->x1, &coder->x2, 1, archive, STORED_PREDICTION);
+  encodeStoredRun(&coder->x1, &coder->x2, archive, run, sized);
+  flush(&coder->x1, &coder->x2, archive);
+  BB_Write(archive, data, runLength(run));
+  coder->x1 = 0;
+  coder->x2 = 0xffffffff;
+}
+
+// Codes one block. Every block after the first starts with the model picked for it. When the header has no content
+// size, sized is 0 and each block also says how it ends
+void encodeBlock (CompressorPredictor* p, Coder* coder, const uint8_t* block, int length, int end, int sized, ByteBuffer* archive) {
+  PredictedBlock predicted;
+  predictBlock(p, coder->blockCount == 0, block, length, end, &predicted);
+  codeBlock(p, coder, &predicted, sized, archive);
+}
+
+// Reads the next block of a frame into block and returns its length. remaining counts down from the content size, or
+// stays UNKNOWN_SIZE if the block is last when in runs out
+static int readBlock (ByteBuffer* in, uint8_t* block, uint64_t* remaining, int* last) {
+  int changeInterval = CHANGE_INTERVAL;
+  int length;
+  if (*remaining == UNKNOWN_SIZE) {
+    length = BB_Read(in, block, changeInterval);
+    *last = length < changeInterval;
+  } else {
+    length = *remaining < changeInterval ? *remaining : changeInterval;
+    // A file that shrinks while it is read is padded out to the size in the header
+    size_t read = BB_Read(in, block, length);
+    memset(block + read, 0, length - read);
+    *remaining -= length;
+    *last = *remaining == 0;
+  }
+  return length;
+}
+
+// Reads the blocks from coded up to the next CODER_RUN, or to the end of the frame, into run, to be stored without
+// being predicted. Returns their length
+static size_t readStoredRun (CompressorPredictor* p, ByteBuffer* in, Run* run, uint64_t* remaining, int* last, uint64_t coded) {
+  run->count = 0;
+  size_t length = 0;
+  do {
+    int blockLength = readBlock(in, run->data + length, remaining, last);
+    keepStoredBlock(p, run, blockLength, *last ? BLOCK_LAST : BLOCK_MORE);
+    length += blockLength;
+  } while (!*last && (coded + length) % CODER_RUN != 0);
+  skipStored(p, run->data, length);
+  return length;
+}
+
+// With an index, every RESTART_INTERVAL bytes the state a decoder needs to start there goes into it
+static void addRestartPoint (SegmentIndex* index, uint64_t coded, ByteBuffer* archive, Coder* coder, context ctx, int modelCode) {
+  if (index != NULL && coded > 0 && coded % RESTART_INTERVAL == 0) {
+    SI_AddRestart(index, BB_Tell(archive), coded, coder, ctx, modelCode);
+  }
+}
+
+// Prices a block for a coder that stores it if that saves more than flushBits. After a streak of stored blocks the byte
+// model, which takes a fraction of the time, says whether it is worth predicting
+static void priceBlock (CompressorPredictor* p, int first, int streak, int flushBits, const uint8_t* block, int length,
+    int end, PredictedBlock* predicted) {
+  if (streak >= STORED_STREAK && priceBytes(block, length, p->ctx) > 8 * length + flushBits) {
+    storeBlock(p, block, length, end, predicted);
+  } else {
+    predictBlock(p, first, block, length, end, predicted);
+  }
+}
+
+// Reads and prices the blocks of a frame for the coders that store runs of blocks, and gathers the stored ones into
+// runs: blocks in a row that keep the model, up to the next CODER_RUN. A run is only over once the block after it is
+// priced, that block then waits for the next call. The byte frame prices every block with the byte model
+typedef struct BlockReader {
+  CompressorPredictor* p;
+  ByteBuffer* in;
+  uint64_t remaining;
+  uint64_t read;
+  int last;
+  int bytes;
+  int streak;
+  int pending; // Whether next is a block read and priced, but not handed out yet
+  PredictedBlock next;
+} BlockReader;
+
+// What a BlockReader hands out: a block that is not stored, or a run of stored blocks. predicted then only has the
+// context and model before the run, and the length and ending of all of it
+typedef struct ReadBlocks {
+  PredictedBlock predicted;
+  Run* run; // NULL for a block that is not stored. The coder frees it
+} ReadBlocks;
+
+static void startReader (BlockReader* reader, CompressorPredictor* p, ByteBuffer* in, uint64_t contentSize, int bytes) {
+  pthread_once(&bitCostsOnce, initBitCosts);
+  reader->p = p;
+  reader->in = in;
+  reader->remaining = contentSize;
+  reader->read = 0;
+  reader->last = 0;
+  reader->bytes = bytes;
+  reader->streak = 0;
+  reader->pending = 0;
+}
+
+static int readerDone (const BlockReader* reader) {
+  return reader->last && !reader->pending;
+}
+
+static void readPriced (BlockReader* reader, PredictedBlock* predicted) {
+  CompressorPredictor* p = reader->p;
+  uint8_t block[CHANGE_INTERVAL];
+  int length = readBlock(reader->in, block, &reader->remaining, &reader->last);
+  int end = reader->last ? BLOCK_LAST : BLOCK_MORE;
+  if (reader->bytes) {
+    float cost = priceBytes(block, length, p->ctx);
+    storeBlock(p, block, length, end, predicted);
+    predicted->cost = cost;
+  } else {
+    priceBlock(p, reader->read == 0, reader->streak, 32, block, length, end, predicted);
+  }
+  reader->read += length;
+  reader->streak = countStreak(reader->streak, storesBlock(predicted, 32), reader->read);
+}
+
+static void readNext (BlockReader* reader, ReadBlocks* next) {
+  PredictedBlock* first = &next->predicted;
+  next->run = NULL;
+  if (reader->pending) {
+    *first = reader->next;
+    reader->pending = 0;
+  } else {
+    readPriced(reader, first);
+  }
+  if (!storesBlock(first, 32)) {
+    return;
+  }
+
+  Run* run = malloc(sizeof(Run));
+  run->count = 0;
+  const PredictedBlock* block = first;
+  size_t length = 0;
+  while (1) {
+    keepRunBlock(run, block);
+    length += block->length;
+    if (reader->last || reader->read % CODER_RUN == 0) {
+      break;
+    }
+    readPriced(reader, &reader->next);
+    block = &reader->next;
+    if (!storesBlock(block, 32) || block->modelCode != first->modelCode) {
+      reader->pending = 1;
+      break;
+    }
+  }
+  first->length = length;
+  first->end = run->blocks[run->count - 1].end;
+  next->run = run;
+}
+
+// Codes contentSize bytes of in into archive, or all of in if the size is UNKNOWN_SIZE. Returns how many it coded
+uint64_t compressBlocks (CompressorPredictor* p, ByteBuffer* in, ByteBuffer* archive, uint64_t contentSize,
+    SegmentIndex* index) {
+  Coder coder;
+  initCoder(&coder);
+  BlockReader reader;
+  startReader(&reader, p, in, contentSize, 0);
+  int sized = contentSize != UNKNOWN_SIZE;
+
+  uint64_t coded = 0;
+  while (!readerDone(&reader)) {
+    ReadBlocks next;
+    readNext(&reader, &next);
+    addRestartPoint(index, coded, archive, &coder, next.predicted.ctx, next.predicted.previousCode);
+    if (next.run != NULL) {
+      codeStoredRun(p, &coder, next.run, next.run->data, sized, archive);
+      free(next.run);
+    } else {
+      codeBlock(p, &coder, &next.predicted, sized, archive);
+    }
+    coded += next.predicted.length;
+  }
+  return coded;
+}
+
+// Same as compressBlocks, with every block stored, a run up to every CODER_RUN. Frames of it never take more than
+// compressBound allows
+static uint64_t compressBlocksStored (CompressorPredictor* p, ByteBuffer* in, ByteBuffer* archive, uint64_t contentSize,
+    SegmentIndex* index) {
+  Coder coder;
+  initCoder(&coder);
+  Run* run = malloc(sizeof(Run));
+  int sized = contentSize != UNKNOWN_SIZE;
+  uint64_t remaining = contentSize;
+  uint64_t coded = 0;
+  int last = 0;
+  while (!last) {
+    addRestartPoint(index, coded, archive, &coder, p->ctx, p->currentModel->code);
+    coded += readStoredRun(p, in, run, &remaining, &last, coded);
+    codeStoredRun(p, &coder, run, run->data, sized, archive);
+  }
+  free(run);
+  return coded;
+}
+
+// The predictor's side of compressBlocksPipelined
+typedef struct Pipeline {
+  BlockReader reader;
+  SpscRing ring;
+} Pipeline;
+
+static void * predictBlocks (void * arg) {
+  Pipeline* pipeline = arg;
+  while (!readerDone(&pipeline->reader)) {
+    readNext(&pipeline->reader, SR_Claim(&pipeline->ring));
+    SR_Publish(&pipeline->ring);
+  }
+  return NULL;
+}
+
+// Same as compressBlocks, and codes the same bytes, with the predictor running ahead on a thread of its own and
+// handing its probabilities to the coder block by block. Falls back to compressBlocks if the thread does not start
+static uint64_t compressBlocksPipelined (CompressorPredictor* p, ByteBuffer* in, ByteBuffer* archive, uint64_t contentSize,
+    SegmentIndex* index) {
+  Pipeline pipeline;
+  startReader(&pipeline.reader, p, in, contentSize, 0);
+  pthread_t predictor;
+  if (!SR_New(&pipeline.ring, sizeof(ReadBlocks), PIPELINE_BLOCKS)) {
+    SR_Free(&pipeline.ring);
+    return compressBlocks(p, in, archive, contentSize, index);
+  }
+  if (pthread_create(&predictor, NULL, predictBlocks, &pipeline) != 0) {
+    SR_Free(&pipeline.ring);
+    return compressBlocks(p, in, archive, contentSize, index);
+  }
+
+  Coder coder;
+  initCoder(&coder);
+  int sized = contentSize != UNKNOWN_SIZE;
+  uint64_t coded = 0;
+  int last = 0;
+  while (!last) {
+    ReadBlocks* next = SR_Peek(&pipeline.ring);
+    PredictedBlock* predicted = &next->predicted;
+    addRestartPoint(index, coded, archive, &coder, predicted->ctx, predicted->previousCode);
+    if (next->run != NULL) {
+      codeStoredRun(p, &coder, next->run, next->run->data, sized, archive);
+      free(next->run);
+    } else {
+      codeBlock(p, &coder, predicted, sized, archive);
+    }
+    coded += predicted->length;
+    last = predicted->end == BLOCK_LAST;
+    SR_Release(&pipeline.ring);
+  }
+
+  pthread_join(predictor, NULL);
+  SR_Free(&pipeline.ring);
+  return coded;
+}
+
+// The coders of an interleaved frame, each writing to a lane of its own until the run is written out. coder only
+// keeps the model switch prediction and the block count, its range stays fresh for the restart points
+typedef struct Interleaved {
+  Coder coder;
+  uint32_t x1[INTERLEAVE_WAYS];
+  uint32_t x2[INTERLEAVE_WAYS];
+  ByteBuffer lanes[INTERLEAVE_WAYS];
+  ByteBuffer stored; // The stored blocks of the run, which go after it
+  Run* run;
+} Interleaved;
+
+// Mirrors codeBlock, with bit i of every byte on lane i % INTERLEAVE_WAYS and the rest on the first lane. Stored blocks
+// wait for the end of the run, so the lanes go on without a flush
+static void codeInterleavedBlock (CompressorPredictor* p, Interleaved* interleaved, const PredictedBlock* predicted, int sized) {
+  uint32_t* x1 = interleaved->x1;
+  uint32_t* x2 = interleaved->x2;
+  ByteBuffer* lanes = interleaved->lanes;
+  if (interleaved->coder.blockCount++ > 0) {
+    encodeModelCode(p, &x1[0], &x2[0], &lanes[0], &interleaved->coder.switchPrediction, predicted->previousCode, predicted->modelCode);
+  }
+  if (!sized) {
+    encodeBlockLength(&x1[0], &x2[0], &lanes[0], predicted->end, predicted->length);
+  }
+
+  int stored = storesBlock(predicted, 0);
+  encodeRaw(&x1[0], &x2[0], stored, &lanes[0], STORED_PREDICTION);
+  if (stored) {
+    BB_Write(&interleaved->stored, predicted->data, predicted->length);
+    return;
+  }
+
+  const uint16_t* prediction = predicted->predictions;
+  for (int j=0; j<predicted->length; ++j) {
+    int c = predicted->data[j];
+    for (int i=0; i<8; ++i) {
+      int lane = i % INTERLEAVE_WAYS;
+      encodeRaw(&x1[lane], &x2[lane], (c>>(7-i))&1, &lanes[lane], *prediction++);
+    }
+  }
+}
+
+// Starts the lanes over
+static void clearLanes (Interleaved* interleaved) {
+  for (int lane = 0; lane < INTERLEAVE_WAYS; lane++) {
+    interleaved->lanes[lane].pos = 0;
+    interleaved->x1[lane] = 0;
+    interleaved->x2[lane] = 0xffffffff;
+  }
+  interleaved->stored.pos = 0;
+}
+
+// Flushes every lane and writes the run and its stored blocks, then starts the lanes over. A run larger than MAX_RUN
+// is coded again first, with every block stored
+static void writeRun (CompressorPredictor* p, Interleaved* interleaved, int sized, ByteBuffer* archive) {
+  size_t total = 0;
+  for (int lane = 0; lane < INTERLEAVE_WAYS; lane++) {
+    // With the 4 bytes of its flush
+    total += interleaved->lanes[lane].pos + 4;
+  }
+  if (total > MAX_RUN) {
+    Run* run = interleaved->run;
+    clearLanes(interleaved);
+    for (int i = 0; i < run->count; i++) {
+      PredictedBlock stored;
+      storedRunBlock(run, i, &interleaved->coder, &stored);
+      codeInterleavedBlock(p, interleaved, &stored, sized);
+    }
+  }
+
+  for (int lane = 0; lane < INTERLEAVE_WAYS; lane++) {
+    flush(&interleaved->x1[lane], &interleaved->x2[lane], &interleaved->lanes[lane]);
+    BB_PutUint32(archive, interleaved->lanes[lane].pos);
+  }
+  for (int lane = 0; lane < INTERLEAVE_WAYS; lane++) {
+    BB_Write(archive, interleaved->lanes[lane].data, interleaved->lanes[lane].pos);
+  }
+  BB_Write(archive, interleaved->stored.data, interleaved->stored.pos);
+  clearLanes(interleaved);
+  startRunBlocks(interleaved->run, &interleaved->coder);
+}
+
+// Same as compressBlocks, as an interleaved frame
+static uint64_t compressBlocksInterleaved (CompressorPredictor* p, ByteBuffer* in, ByteBuffer* archive,
+    uint64_t contentSize, SegmentIndex* index) {
+  Interleaved interleaved;
+  initCoder(&interleaved.coder);
+  for (int lane = 0; lane < INTERLEAVE_WAYS; lane++) {
+    interleaved.x1[lane] = 0;
+    interleaved.x2[lane] = 0xffffffff;
+    BB_NewGrowingWriter(&interleaved.lanes[lane], CODER_RUN / INTERLEAVE_WAYS);
+  }
+  BB_NewGrowingWriter(&interleaved.stored, CHANGE_INTERVAL);
+  interleaved.run = malloc(sizeof(Run));
+  startRunBlocks(interleaved.run, &interleaved.coder);
+
+  uint8_t block[CHANGE_INTERVAL];
+  uint64_t remaining = contentSize;
+  int sized = contentSize != UNKNOWN_SIZE;
+
+  uint64_t coded = 0;
+  int streak = 0;
+  int last = 0;
+  while (!last) {
+    // Restart points fall on the starts of runs, where the range of every lane is fresh
+    addRestartPoint(index, coded, archive, &interleaved.coder, p->ctx, p->currentModel->code);
+    int length = readBlock(in, block, &remaining, &last);
+    PredictedBlock predicted;
+    // Stored blocks take no flush of their own here, so there are no runs of them to gather
+    priceBlock(p, interleaved.coder.blockCount == 0, streak, 0, block, length, last ? BLOCK_LAST : BLOCK_MORE, &predicted);
+    keepRunBlock(interleaved.run, &predicted);
+    codeInterleavedBlock(p, &interleaved, &predicted, sized);
+    coded += length;
+    streak = countStreak(streak, storesBlock(&predicted, 0), coded);
+    if (last || coded % CODER_RUN == 0) {
+      writeRun(p, &interleaved, sized, archive);
+    }
+  }
+
+  for (int lane = 0; lane < INTERLEAVE_WAYS; lane++) {
+    BB_Free(&interleaved.lanes[lane]);
+  }
+  BB_Free(&interleaved.stored);
+  free(interleaved.run);
+  return coded;
+}
+
+// The coder of a ranged frame. coder only keeps the model switch prediction and the block count, its range stays fresh
+// for the restart points
+typedef struct Ranged {
+  Coder coder;
+  RangeEncoder range;
+} Ranged;
+
+// Mirrors encodeModelCode on the range coder
+static void encodeRangedModelCode (CompressorPredictor* p, Ranged* ranged, ByteBuffer* archive, int previousCode, int modelCode) {
+  int switched = modelCode != previousCode;
+  RC_Encode(&ranged->range, switched, ranged->coder.switchPrediction, archive);
+  ranged->coder.switchPrediction = updateSwitchPrediction(ranged->coder.switchPrediction, switched);
+  if (switched) {
+    int index = modelCode < previousCode ? modelCode : modelCode - 1;
+    for (int i=modelCodeBits(p->modelCount)-1; i>=0; --i) {
+      RC_Encode(&ranged->range, (index>>i)&1, EVEN_PREDICTION, archive);
+    }
+  }
+}
+
+// Mirrors encodeBlockLength on the range coder
+static void encodeRangedBlockLength (RangeEncoder* rc, ByteBuffer* archive, int end, int length) {
+  RC_Encode(rc, end != BLOCK_MORE, SHORT_PREDICTION, archive);
+  if (end != BLOCK_MORE) {
+    for (int i=BLOCK_LENGTH_BITS-1; i>=0; --i) {
+      RC_Encode(rc, (length>>i)&1, EVEN_PREDICTION, archive);
+    }
+    RC_Encode(rc, end == BLOCK_LAST, EVEN_PREDICTION, archive);
+  }
+}
+
+// Mirrors encodeStoredRun on the range coder
+static void encodeRangedStoredRun (RangeEncoder* rc, ByteBuffer* archive, const Run* run, int sized) {
+  int follow = run->count - 1;
+  RC_Encode(rc, follow > 0, EVEN_PREDICTION, archive);
+  if (follow > 0) {
+    for (int i=STORED_RUN_BITS-1; i>=0; --i) {
+      RC_Encode(rc, (follow>>i)&1, EVEN_PREDICTION, archive);
+    }
+    if (!sized) {
+      const RunBlock* lastBlock = &run->blocks[run->count - 1];
+      encodeRangedBlockLength(rc, archive, lastBlock->end, lastBlock->length);
+    }
+  }
+}
+
+// Mirrors codeBlock on the range coder, for a block that is not stored. Stored ones go in runs
+static void codeRangedBlock (CompressorPredictor* p, Ranged* ranged, const PredictedBlock* predicted, int sized, ByteBuffer* archive) {
+  if (ranged->coder.blockCount++ > 0) {
+    encodeRangedModelCode(p, ranged, archive, predicted->previousCode, predicted->modelCode);
+  }
+  if (!sized) {
+    encodeRangedBlockLength(&ranged->range, archive, predicted->end, predicted->length);
+  }
+  RC_Encode(&ranged->range, 0, STORED_PREDICTION, archive);
+
+  const uint16_t* prediction = predicted->predictions;
+  for (int j=0; j<predicted->length; ++j) {
+    int c = predicted->data[j];
+    for (int i=7; i>=0; --i) {
+      RC_Encode(&ranged->range, (c>>i)&1, *prediction++, archive);
+    }
+  }
+}
+
+// Mirrors codeStoredRun on the range coder
+static void codeRangedStoredRun (CompressorPredictor* p, Ranged* ranged, const Run* run, int sized, ByteBuffer* archive) {
+  const RunBlock* first = &run->blocks[0];
+  if (ranged->coder.blockCount++ > 0) {
+    encodeRangedModelCode(p, ranged, archive, first->previousCode, first->modelCode);
+  }
+  if (!sized) {
+    encodeRangedBlockLength(&ranged->range, archive, first->end, first->length);
+  }
+  RC_Encode(&ranged->range, 1, STORED_PREDICTION, archive);
+  encodeRangedStoredRun(&ranged->range, archive, run, sized);
+  RC_Flush(&ranged->range, archive);
+  BB_Write(archive, run->data, runLength(run));
+}
+
+// Same as compressBlocks, as a ranged frame
+static uint64_t compressBlocksRanged (CompressorPredictor* p, ByteBuffer* in, ByteBuffer* archive, uint64_t contentSize,
+    SegmentIndex* index) {
+  Ranged ranged;
+  initCoder(&ranged.coder);
+  RC_NewEncoder(&ranged.range);
+  BlockReader reader;
+  startReader(&reader, p, in, contentSize, 0);
+  int sized = contentSize != UNKNOWN_SIZE;
+
+  uint64_t coded = 0;
+  while (!readerDone(&reader)) {
+    ReadBlocks next;
+    readNext(&reader, &next);
+    // Restart points fall where the coder was just flushed
+    addRestartPoint(index, coded, archive, &ranged.coder, next.predicted.ctx, next.predicted.previousCode);
+    coded += next.predicted.length;
+    // A run of stored blocks leaves the coder flushed already
+    if (next.run != NULL) {
+      codeRangedStoredRun(p, &ranged, next.run, sized, archive);
+      free(next.run);
+      continue;
+    }
+    codeRangedBlock(p, &ranged, &next.predicted, sized, archive);
+    if (next.predicted.end == BLOCK_LAST || coded % CODER_RUN == 0) {
+      RC_Flush(&ranged.range, archive);
+    }
+  }
+  return coded;
+}
+
+// The coder of a rANS frame, with the bits of the run so far. coder only keeps the model switch prediction and the
+// block count, as for a ranged frame
+typedef struct Rans {
+  Coder coder;
+  RansEncoder encoder;
+  ByteBuffer stored; // The stored blocks of the run, which go after it
+  Run* run;
+} Rans;
+
+// Mirrors encodeModelCode for the rANS coder, which only codes the bits once the run is over
+static void recordRansModelCode (CompressorPredictor* p, Rans* rans, int previousCode, int modelCode) {
+  int switched = modelCode != previousCode;
+  RANS_Record(&rans->encoder, switched, rans->coder.switchPrediction);
+  rans->coder.switchPrediction = updateSwitchPrediction(rans->coder.switchPrediction, switched);
+  if (switched) {
+    int index = modelCode < previousCode ? modelCode : modelCode - 1;
+    for (int i=modelCodeBits(p->modelCount)-1; i>=0; --i) {
+      RANS_Record(&rans->encoder, (index>>i)&1, EVEN_PREDICTION);
+    }
+  }
+}
+
+// Mirrors encodeBlockLength, the same way
+static void recordRansBlockLength (RansEncoder* encoder, int end, int length) {
+  RANS_Record(encoder, end != BLOCK_MORE, SHORT_PREDICTION);
+  if (end != BLOCK_MORE) {
+    for (int i=BLOCK_LENGTH_BITS-1; i>=0; --i) {
+      RANS_Record(encoder, (length>>i)&1, EVEN_PREDICTION);
+    }
+    RANS_Record(encoder, end == BLOCK_LAST, EVEN_PREDICTION);
+  }
+}
+
+// Mirrors codeBlock for the rANS coder. Stored blocks wait for the end of the run, as for an interleaved frame
+static void codeRansBlock (CompressorPredictor* p, Rans* rans, const PredictedBlock* predicted, int sized) {
+  if (rans->coder.blockCount++ > 0) {
+    recordRansModelCode(p, rans, predicted->previousCode, predicted->modelCode);
+  }
+  if (!sized) {
+    recordRansBlockLength(&rans->encoder, predicted->end, predicted->length);
+  }
+
+  int stored = storesBlock(predicted, 0);
+  RANS_Record(&rans->encoder, stored, STORED_PREDICTION);
+  if (stored) {
+    BB_Write(&rans->stored, predicted->data, predicted->length);
+    return;
+  }
+
+  const uint16_t* prediction = predicted->predictions;
+  for (int j=0; j<predicted->length; ++j) {
+    int c = predicted->data[j];
+    for (int i=7; i>=0; --i) {
+      RANS_Record(&rans->encoder, (c>>i)&1, *prediction++);
+    }
+  }
+}
+
+// Writes the run and its stored blocks, coded again first with every block stored if it is larger than MAX_RUN
+static void writeRansRun (CompressorPredictor* p, Rans* rans, int sized, ByteBuffer* archive) {
+  if (RANS_CodeRun(&rans->encoder) > MAX_RUN) {
+    Run* run = rans->run;
+    rans->encoder.count = 0;
+    rans->stored.pos = 0;
+    for (int i = 0; i < run->count; i++) {
+      PredictedBlock stored;
+      storedRunBlock(run, i, &rans->coder, &stored);
+      codeRansBlock(p, rans, &stored, sized);
+    }
+    RANS_CodeRun(&rans->encoder);
+  }
+  RANS_WriteRun(&rans->encoder, archive);
+  BB_Write(archive, rans->stored.data, rans->stored.pos);
+  rans->stored.pos = 0;
+  startRunBlocks(rans->run, &rans->coder);
+}
+
+// Same as compressBlocks, as a rANS frame
+static uint64_t compressBlocksRans (CompressorPredictor* p, ByteBuffer* in, ByteBuffer* archive, uint64_t contentSize,
+    SegmentIndex* index) {
+  Rans rans = {0};
+  initCoder(&rans.coder);
+  BB_NewGrowingWriter(&rans.stored, CHANGE_INTERVAL);
+  rans.run = malloc(sizeof(Run));
+  startRunBlocks(rans.run, &rans.coder);
+
+  uint8_t block[CHANGE_INTERVAL];
+  uint64_t remaining = contentSize;
+  int sized = contentSize != UNKNOWN_SIZE;
+
+  uint64_t coded = 0;
+  int streak = 0;
+  int last = 0;
+  while (!last) {
+    // Restart points fall on the starts of runs
+    addRestartPoint(index, coded, archive, &rans.coder, p->ctx, p->currentModel->code);
+    int length = readBlock(in, block, &remaining, &last);
+    PredictedBlock predicted;
+    priceBlock(p, rans.coder.blockCount == 0, streak, 0, block, length, last ? BLOCK_LAST : BLOCK_MORE, &predicted);
+    keepRunBlock(rans.run, &predicted);
+    codeRansBlock(p, &rans, &predicted, sized);
+    coded += length;
+    streak = countStreak(streak, storesBlock(&predicted, 0), coded);
+    if (last || coded % CODER_RUN == 0) {
+      writeRansRun(p, &rans, sized, archive);
+    }
+  }
+  RANS_FreeEncoder(&rans.encoder);
+  BB_Free(&rans.stored);
+  free(rans.run);
+  return coded;
+}
+
+// Same as compressBlocks, as a byte frame. The predictor only keeps the context, of which the byte model looks at the
+// last byte
+static uint64_t compressBlocksBytes (CompressorPredictor* p, ByteBuffer* in, ByteBuffer* archive, uint64_t contentSize,
+    SegmentIndex* index) {
+  Coder coder;
+  initCoder(&coder);
+  RangeEncoder range;
+  RC_NewEncoder(&range);
+  BlockReader reader;
+  startReader(&reader, p, in, contentSize, 1);
+  int sized = contentSize != UNKNOWN_SIZE;
+
+  uint64_t coded = 0;
+  while (!readerDone(&reader)) {
+    ReadBlocks next;
+    readNext(&reader, &next);
+    const PredictedBlock* predicted = &next.predicted;
+    addRestartPoint(index, coded, archive, &coder, predicted->ctx, predicted->previousCode);
+    coded += predicted->length;
+    // As in a ranged frame, with no model code
+    if (next.run != NULL) {
+      const RunBlock* first = &next.run->blocks[0];
+      if (!sized) {
+        encodeRangedBlockLength(&range, archive, first->end, first->length);
+      }
+      RC_Encode(&range, 1, STORED_PREDICTION, archive);
+      encodeRangedStoredRun(&range, archive, next.run, sized);
+      RC_Flush(&range, archive);
+      BB_Write(archive, next.run->data, runLength(next.run));
+      free(next.run);
+      continue;
+    }
+
+    if (!sized) {
+      encodeRangedBlockLength(&range, archive, predicted->end, predicted->length);
+    }
+    RC_Encode(&range, 0, STORED_PREDICTION, archive);
+    context ctx = predicted->ctx;
+    for (int j=0; j<predicted->length; ++j) {
+      RC_EncodeSymbol(&range, &BYTE1_Data[(ctx & 0xff) << 8], predicted->data[j], archive);
+      ctx = (ctx << 8) | predicted->data[j];
+    }
+    if (predicted->end == BLOCK_LAST || coded % CODER_RUN == 0) {
+      RC_Flush(&range, archive);
+    }
+  }
+  return coded;
+}
+
+// Blocks compressBlocksTrial reads and prices at once, and how many of them one job prices with one model
+#define TRIAL_BLOCKS 512
+#define TRIAL_SLICE 64
+
+// A run of blocks to price with one model. The costs go every stride floats, a block's models side by side
+typedef struct TrialSlice {
+  Model* model;
+  const uint8_t* data;
+  size_t length;
+  int blocks;
+  context ctx; // Before the first block
+  float* costs;
+  int stride;
+} TrialSlice;
+
+// Models only look at the bits before, never at which model coded them, so every model can price every block at once
+static void priceSlice (void * arg) {
+  TrialSlice* slice = arg;
+  context ctx = slice->ctx;
+  for (int b = 0; b < slice->blocks; b++) {
+    size_t start = (size_t)b * CHANGE_INTERVAL;
+    size_t end = slice->length - start < CHANGE_INTERVAL ? slice->length : start + CHANGE_INTERVAL;
+    float cost = 0;
+    for (size_t j = start; j < end; j++) {
+      int c = slice->data[j];
+      for (int i=7; i>=0; --i) {
+        int bit = (c>>i)&1;
+        cost += bitCosts[bit][MO_GetPrediction(slice->model, ctx)];
+        ctx = (ctx << 1) | bit;
+      }
+    }
+    slice->costs[b * slice->stride] = cost;
+  }
+}
+
+// What encodeModelCode spends on staying with the model or switching away from it
+static float switchCost (CompressorPredictor* p, int switchPrediction, int switched) {
+  float cost = bitCosts[switched][switchPrediction];
+  return switched ? cost + modelCodeBits(p->modelCount) : cost;
+}
+
+// The model compressBlocksTrial codes block b with: the one that codes it in the fewest bits, switch included. The
+// first block goes with the model in the header
+static int trialModel (CompressorPredictor* p, const float* costs, int b, const Coder* coder) {
+  int previousCode = p->currentModel->code;
+  int modelCode = previousCode;
+  if (coder->blockCount > 0) {
+    float best = INFINITY;
+    for (int m = 0; m < p->modelCount; m++) {
+      float cost = costs[b * p->modelCount + m] + switchCost(p, coder->switchPrediction, m != previousCode);
+      if (cost < best) {
+        best = cost;
+        modelCode = m;
+      }
+    }
+  }
+  return modelCode;
 }
 
-void compress (FILE* input, FILE* output, CompressorPredictor* p) {
+// Whether compressBlocksTrial stores block b rather than code it with modelCode, as codeBlock would decide. Models
+// are not asked for the blocks it stores
+static int trialStores (const float* costs, int modelCount, int b, int length, int modelCode) {
+  return costs[b * modelCount + modelCode] > 8 * length + 32;
+}
+
+// Same as compressBlocks, but instead of going by the scores of the past, codes each block with the model that codes
+// it in the fewest bits, switch included. Each round of TRIAL_BLOCKS is priced with every model on pool, or on this
+// thread if it is NULL, then coded in order. The decoder cannot tell the difference
+static uint64_t compressBlocksTrial (CompressorPredictor* p, ByteBuffer* in, ByteBuffer* archive, uint64_t contentSize,
+    SegmentIndex* index, ThreadPool* pool) {
+  pthread_once(&bitCostsOnce, initBitCosts);
+  Coder coder;
+  initCoder(&coder);
+  int sized = contentSize != UNKNOWN_SIZE;
+  int modelCount = p->modelCount;
+  uint8_t* data = malloc(TRIAL_BLOCKS * CHANGE_INTERVAL);
+  int* lengths = malloc(TRIAL_BLOCKS * sizeof(int));
+  float* costs = malloc(TRIAL_BLOCKS * modelCount * sizeof(float));
+  TrialSlice* slices = malloc(TRIAL_BLOCKS / TRIAL_SLICE * modelCount * sizeof(TrialSlice));
+  Run* run = malloc(sizeof(Run));
+
+  uint64_t remaining = contentSize;
+  uint64_t coded = 0;
+  int last = 0;
+  while (!last) {
+    // Only the last block can be short, so block b starts at b * CHANGE_INTERVAL
+    int blocks = 0;
+    size_t length = 0;
+    while (!last && blocks < TRIAL_BLOCKS) {
+      lengths[blocks] = readBlock(in, data + length, &remaining, &last);
+      length += lengths[blocks++];
+    }
+
+    int slice = 0;
+    for (int first = 0; first < blocks; first += TRIAL_SLICE) {
+      // The context is the last 16 bits, so the two bytes before the slice are all it takes to rebuild it
+      size_t start = (size_t)first * CHANGE_INTERVAL;
+      context ctx = p->ctx;
+      for (size_t j = start >= 2 ? start - 2 : 0; j < start; j++) {
+        ctx = (ctx << 8) | data[j];
+      }
+      int sliceBlocks = blocks - first < TRIAL_SLICE ? blocks - first : TRIAL_SLICE;
+      size_t sliceLength = length - start < TRIAL_SLICE * CHANGE_INTERVAL ? length - start : TRIAL_SLICE * CHANGE_INTERVAL;
+      for (int m = 0; m < modelCount; m++) {
+        slices[slice] = (TrialSlice) {
+          .model = (*p->models)[m],
+          .data = data + start,
+          .length = sliceLength,
+          .blocks = sliceBlocks,
+          .ctx = ctx,
+          .costs = costs + first * modelCount + m,
+          .stride = modelCount,
+        };
+        if (pool != NULL) {
+          TP_Submit(pool, priceSlice, &slices[slice]);
+        } else {
+          priceSlice(&slices[slice]);
+        }
+        slice++;
+      }
+    }
+    if (pool != NULL) {
+      TP_Wait(pool);
+    }
+
+    int b = 0;
+    while (b < blocks) {
+      addRestartPoint(index, coded, archive, &coder, p->ctx, p->currentModel->code);
+      const uint8_t* block = data + (size_t)b * CHANGE_INTERVAL;
+      int modelCode = trialModel(p, costs, b, &coder);
+      if (trialStores(costs, modelCount, b, lengths[b], modelCode)) {
+        // The stored blocks in a row go in one run, with the model before them. The round has their data already, and
+        // TRIAL_BLOCKS make up a CODER_RUN, so the run ends with the round at the latest
+        size_t runBytes = 0;
+        run->count = 0;
+        do {
+          keepStoredBlock(p, run, lengths[b], last && b == blocks - 1 ? BLOCK_LAST : BLOCK_MORE);
+          runBytes += lengths[b++];
+        } while (b < blocks && (coded + runBytes) % CODER_RUN != 0 &&
+            trialStores(costs, modelCount, b, lengths[b], trialModel(p, costs, b, &coder)));
+        codeStoredRun(p, &coder, run, block, sized, archive);
+        skipStored(p, block, runBytes);
+        coded += runBytes;
+        continue;
+      }
+      PredictedBlock predicted;
+      int end = last && b == blocks - 1 ? BLOCK_LAST : BLOCK_MORE;
+      predictBlockWith(p, modelCode, block, lengths[b], end, &predicted);
+      codeBlock(p, &coder, &predicted, sized, archive);
+      coded += lengths[b++];
+    }
+  }
+
+  free(data);
+  free(lengths);
+  free(costs);
+  free(slices);
+  free(run);
+  return coded;
+}
+
+typedef uint64_t (*BlockCoder_t) (CompressorPredictor* p, ByteBuffer* in, ByteBuffer* archive, uint64_t contentSize,
+    SegmentIndex* index);
+
+// The layout flags of the frames a block coder writes. The others all write plain frames
+static int frameLayout (BlockCoder_t codeBlocks) {
+  if (codeBlocks == compressBlocksInterleaved) {
+    return FRAME_INTERLEAVED;
+  }
+  if (codeBlocks == compressBlocksRanged) {
+    return FRAME_RANGED;
+  }
+  if (codeBlocks == compressBlocksRans) {
+    return FRAME_RANS;
+  }
+  if (codeBlocks == compressBlocksBytes) {
+    return FRAME_BYTES;
+  }
+  return 0;
+}
+
+// Starts p over and writes the header of a frame with layout
+static void startFrame (CompressorPredictor* p, ByteBuffer* archive, uint64_t contentSize, int layout,
+    SegmentIndex* index) {
   int startingCode = p->currentModel->code;
   CP_SelectModel(p, startingCode);
-  uint32_t x1 = 0;
-  uint32_t x2 = 0xffffffff;
-
-  int changeInterval = 128;
-
-  uint32_t headerPos = 5;
-  fseek(input, 0, SEEK_END);
-  uint32_t headerLength = ftell(input)/changeInterval + headerPos; // This is only for testing purposes
-  fseek(input, 0, SEEK_SET);
-  printf("%d %d\n", startingCode, headerLength);
-
-  uint32_t bitCount = 8;
-
-  fseek(output, headerLength, SEEK_SET);
-  int c;
-  while ((c=getc(input))!=EOF) {
-    if (bitCount % (changeInterval * 8) == 0) {
-      int modelCode = CP_GetBestModel(p)->code;
-      /*int modelCode = 1;*/
-      CP_SelectModel(p, modelCode);
-      fseek(output, headerPos, SEEK_SET);
-      putc(modelCode, output);
-      headerPos += 1;
-      fseek(output, 0, SEEK_END);
-      if (headerLength > ftell(output)) {
-        fseek(output, headerLength, SEEK_SET);
+  CP_Reset(p);
+  if (index != NULL) {
+    SI_AddFrame(index, BB_Tell(archive), 0);
+  }
+  writeHeader(archive, startingCode, contentSize, layout);
+}
+
+static uint64_t codeFrame (BlockCoder_t codeBlocks, CompressorPredictor* p, ByteBuffer* in,
+    ByteBuffer* archive, uint64_t contentSize, SegmentIndex* index) {
+  startFrame(p, archive, contentSize, frameLayout(codeBlocks), index);
+  uint64_t coded = codeBlocks(p, in, archive, contentSize, index);
+  writeFrameEnd(archive, coded);
+  return coded;
+}
+
+// Frames start from a fresh context, so they can be coded apart and concatenated
+uint64_t compressFrame (CompressorPredictor* p, ByteBuffer* in, ByteBuffer* archive, uint64_t contentSize,
+    SegmentIndex* index) {
+  return codeFrame(compressBlocks, p, in, archive, contentSize, index);
+}
+
+// Writes the index of the one frame of an archive that starts at start, so parts of it can be decoded on their own. A
+// frame that has no restart point past its start gains nothing from one, it only gets it if always is set, as a shard
+// needs it to merge
+static void writeFrameIndex (ByteBuffer* archive, off_t start, SegmentIndex* frameIndex, uint64_t coded, int always) {
+  if (always || frameIndex->count > 1) {
+    // Offsets in the index count from the start of the archive, which may not be the start of the output file
+    SegmentIndex index;
+    SI_New(&index);
+    SI_Merge(&index, frameIndex, -(uint64_t)start, 0);
+    SI_Write(&index, archive, BB_Tell(archive) - start, coded);
+    SI_Free(&index);
+  }
+}
+
+// One frame and the index that goes with it
+static void writeIndexedFrame (BlockCoder_t codeBlocks, CompressorPredictor* p, ByteBuffer* in,
+    ByteBuffer* archive, uint64_t contentSize, int always) {
+  off_t start = BB_Tell(archive);
+  SegmentIndex frameIndex;
+  SI_New(&frameIndex);
+  uint64_t coded = codeFrame(codeBlocks, p, in, archive, contentSize, &frameIndex);
+  writeFrameIndex(archive, start, &frameIndex, coded, always);
+  SI_Free(&frameIndex);
+}
+
+// Size of what is left to read in a regular file, UNKNOWN_SIZE for pipes and the like
+uint64_t remainingSize (FILE* input) {
+  struct stat st;
+  off_t pos = ftello(input);
+  if (fstat(fileno(input), &st) != 0 || !S_ISREG(st.st_mode) || pos < 0) {
+    return UNKNOWN_SIZE;
+  }
+  // Past the end of the file, as a seek can put it
+  return st.st_size > pos ? st.st_size - pos : 0;
+}
+
+int compress (FILE* input, FILE* output, CompressorPredictor* p) {
+  uint64_t contentSize = remainingSize(input);
+
+  ByteBuffer in;
+  BB_NewAsyncReader(&in, input);
+  ByteBuffer archive;
+  BB_NewAsyncWriter(&archive, output);
+  writeIndexedFrame(compressBlocks, p, &in, &archive, contentSize, 0);
+  int ok = !BB_Failed(&in) && BB_Flush(&archive);
+  if (!ok) {
+    perror("compress");
+  }
+
+  BB_Free(&in);
+  BB_Free(&archive);
+  fclose(output);
+  fclose(input);
+  return ok;
+}
+
+int compressMapped (FILE* input, FILE* output, CompressorPredictor* p) {
+  ByteBuffer in;
+  if (!BB_NewMappedReader(&in, fileno(input))) {
+    return compress(input, output, p);
+  }
+
+  // Only noise that just misses being stored codes worse than this. Then the writer keeps growing the file a window
+  // at a time
+  ByteBuffer archive;
+  if (!BB_NewMappedWriter(&archive, fileno(output), 0, compressBound(in.len))) {
+    BB_Free(&archive);
+    BB_Free(&in);
+    return compress(input, output, p);
+  }
+
+  writeIndexedFrame(compressBlocks, p, &in, &archive, in.len, 0);
+  int ok = BB_Flush(&archive);
+  if (!ok) {
+    perror("compress");
+  }
+
+  BB_Free(&in);
+  BB_Free(&archive);
+  fclose(output);
+  fclose(input);
+  return ok;
+}
+
+int compressPipelined (FILE* input, FILE* output, CompressorPredictor* p) {
+  uint64_t contentSize = remainingSize(input);
+
+  ByteBuffer in;
+  BB_NewReader(&in, input);
+  ByteBuffer archive;
+  BB_NewWriter(&archive, output);
+  writeIndexedFrame(compressBlocksPipelined, p, &in, &archive, contentSize, 0);
+  int ok = !BB_Failed(&in) && BB_Flush(&archive);
+  if (!ok) {
+    perror("compress");
+  }
+
+  BB_Free(&in);
+  BB_Free(&archive);
+  fclose(output);
+  fclose(input);
+  return ok;
+}
+
+// Same as compress, with the frame coded by codeBlocks
+static int compressLayout (BlockCoder_t codeBlocks, FILE* input, FILE* output, CompressorPredictor* p) {
+  uint64_t contentSize = remainingSize(input);
+
+  ByteBuffer in;
+  BB_NewAsyncReader(&in, input);
+  ByteBuffer archive;
+  BB_NewAsyncWriter(&archive, output);
+  writeIndexedFrame(codeBlocks, p, &in, &archive, contentSize, 0);
+  int ok = !BB_Failed(&in) && BB_Flush(&archive);
+  if (!ok) {
+    perror("compress");
+  }
+
+  BB_Free(&in);
+  BB_Free(&archive);
+  fclose(output);
+  fclose(input);
+  return ok;
+}
+
+int compressInterleaved (FILE* input, FILE* output, CompressorPredictor* p) {
+  return compressLayout(compressBlocksInterleaved, input, output, p);
+}
+
+int compressRanged (FILE* input, FILE* output, CompressorPredictor* p) {
+  return compressLayout(compressBlocksRanged, input, output, p);
+}
+
+int compressRans (FILE* input, FILE* output, CompressorPredictor* p) {
+  return compressLayout(compressBlocksRans, input, output, p);
+}
+
+int compressBytes (FILE* input, FILE* output, CompressorPredictor* p) {
+  return compressLayout(compressBlocksBytes, input, output, p);
+}
+
+int compressTrial (FILE* input, FILE* output, CompressorPredictor* p, int threads) {
+  uint64_t contentSize = remainingSize(input);
+  ThreadPool pool;
+  int pooled = threads > 1 && TP_New(&pool, threads);
+
+  ByteBuffer in;
+  BB_NewAsyncReader(&in, input);
+  ByteBuffer archive;
+  BB_NewAsyncWriter(&archive, output);
+  // Same as writeIndexedFrame, with the pool for the trial coder
+  off_t start = BB_Tell(&archive);
+  SegmentIndex frameIndex;
+  SI_New(&frameIndex);
+  startFrame(p, &archive, contentSize, 0, &frameIndex);
+  uint64_t coded = compressBlocksTrial(p, &in, &archive, contentSize, &frameIndex, pooled ? &pool : NULL);
+  writeFrameEnd(&archive, coded);
+  writeFrameIndex(&archive, start, &frameIndex, coded, 0);
+  SI_Free(&frameIndex);
+  int ok = !BB_Failed(&in) && BB_Flush(&archive);
+  if (!ok) {
+    perror("compress");
+  }
+
+  if (pooled) {
+    TP_Free(&pool);
+  }
+  BB_Free(&in);
+  BB_Free(&archive);
+  fclose(output);
+  fclose(input);
+  return ok;
+}
+
+// A segment of the input and the predictor and archive buffer of the thread that codes it
+typedef struct Segment {
+  CompressorPredictor p;
+  uint8_t * data;
+  off_t offset; // Of data in the input
+  ByteBuffer in;
+  ByteBuffer archive;
+  SegmentIndex index; // Of the segment's own frame
+} Segment;
+
+static void compressSegment (void * arg) {
+  Segment * segment = arg;
+  segment->index.count = 0;
+  compressFrame(&segment->p, &segment->in, &segment->archive, segment->in.len, &segment->index);
+}
+
+int compressParallel (FILE* input, FILE* output, CompressorPredictor* p, int threads) {
+  ThreadPool pool;
+  if (threads <= 1 || !TP_New(&pool, threads)) {
+    return compress(input, output, p);
+  }
+  int startingCode = p->currentModel->code;
+
+  // Twice as many segments as threads keep every thread busy while the finished ones are written
+  int batch = pool.threadCount * 2;
+  Segment * segments = calloc(batch, sizeof(Segment));
+  for (int i = 0; i < batch; i++) {
+    CP_New(&segments[i].p, p->models, p->modelCount, 0);
+    segments[i].data = malloc(SEGMENT_SIZE);
+    BB_NewGrowingWriter(&segments[i].archive, SEGMENT_SIZE / 2);
+    SI_New(&segments[i].index);
+  }
+
+  ByteBuffer in;
+  BB_NewReader(&in, input);
+  ByteBuffer archive;
+  BB_NewWriter(&archive, output);
+
+  // Offsets in the index count from the start of the archive, which may not be the start of the output file
+  off_t start = BB_Tell(&archive);
+  off_t inStart = BB_Tell(&in);
+  SegmentIndex index;
+  SI_New(&index);
+
+  uint64_t segmentCount = 0;
+  int more = 1;
+  while (more) {
+    int count = 0;
+    while (more && count < batch) {
+      Segment * segment = &segments[count];
+      segment->offset = BB_Tell(&in);
+      size_t len = BB_Read(&in, segment->data, SEGMENT_SIZE);
+      more = len == SEGMENT_SIZE;
+      // An empty input still needs its one empty frame
+      if (len == 0 && segmentCount > 0) {
+        break;
       }
-      bitCount = 0;
+      BB_NewBorrowedReader(&segment->in, segment->data, len);
+      segment->archive.pos = 0;
+      CP_SelectModel(&segment->p, startingCode);
+      TP_Submit(&pool, compressSegment, segment);
+      segmentCount++;
+      count++;
     }
-    for (int i=7; i>=0; --i) {
-      encode(p, &x1, &x2, (c>>i)&1, output, input, CP_Predict(p), changeInterval);
-      bitCount += 1;
+    TP_Wait(&pool);
+    for (int i = 0; i < count; i++) {
+      SI_Merge(&index, &segments[i].index, BB_Tell(&archive) - start, segments[i].offset - inStart);
+      BB_Write(&archive, segments[i].archive.data, segments[i].archive.pos);
     }
   }
-  encode(p, &x1, &x2, 1, output, input, CP_Predict(p), changeInterval);  // EOF code
-  flush(&x1, &x2, output);
+  SI_Write(&index, &archive, BB_Tell(&archive) - start, BB_Tell(&in) - inStart);
+  SI_Free(&index);
+  int ok = !BB_Failed(&in) && BB_Flush(&archive);
+  if (!ok) {
+    perror("compress");
+  }
+
+  TP_Free(&pool);
+  for (int i = 0; i < batch; i++) {
+    free(segments[i].data);
+    BB_Free(&segments[i].archive);
+    SI_Free(&segments[i].index);
+  }
+  free(segments);
+  BB_Free(&in);
+  BB_Free(&archive);
+  fclose(output);
+  fclose(input);
+  return ok;
+}
 
-  printf("Compression level: %f%%\n", (((float) ftell(input))-((float) ftell(output)))/ftell(input)*100);
+int compressShard (FILE* input, FILE* output, uint64_t offset, uint64_t length, CompressorPredictor* p) {
+  if (fseeko(input, offset, SEEK_SET) != 0) {
+    perror("shard");
+    return 0;
+  }
+  // Shards past the end of the input are empty, the last one usually comes up short
+  uint64_t remaining = remainingSize(input);
+  uint64_t contentSize = remaining != UNKNOWN_SIZE && remaining < length ? remaining : length;
 
-  writeHeader(output, startingCode, headerLength); // Can be picked intelligently
+  ByteBuffer in;
+  BB_NewAsyncReader(&in, input);
+  ByteBuffer archive;
+  BB_NewAsyncWriter(&archive, output);
+  writeIndexedFrame(compressBlocks, p, &in, &archive, contentSize, 1);
+  int ok = !BB_Failed(&in) && BB_Flush(&archive);
+  if (!ok) {
+    perror("shard");
+  }
 
+  BB_Free(&in);
+  BB_Free(&archive);
   fclose(output);
   fclose(input);
+  return ok;
+}
+
+int mergeShards (const char** paths, int count, FILE* output) {
+  ByteBuffer archive;
+  BB_NewWriter(&archive, output);
+  off_t start = BB_Tell(&archive);
+  uint64_t offset = 0;
+  SegmentIndex index;
+  SI_New(&index);
+
+  int ok = 1;
+  for (int i = 0; ok && i < count; i++) {
+    FILE* input = fopen(paths[i], "rb");
+    ByteBuffer shard;
+    int mapped = input != NULL && BB_NewMappedReader(&shard, fileno(input));
+    if (input != NULL) {
+      fclose(input);
+    }
+    if (!mapped) {
+      perror(paths[i]);
+      ok = 0;
+      break;
+    }
+
+    // The frames go over as they are, up to where the shard's index starts, and their points follow them
+    SegmentIndex shardIndex;
+    if (SI_Read(&shardIndex, shard.data, shard.len)) {
+      RestartPoint* end = &shardIndex.points[shardIndex.count];
+      SI_Merge(&index, &shardIndex, BB_Tell(&archive) - start, offset);
+      BB_Write(&archive, shard.data, end->compressedOffset);
+      offset += end->offset;
+    } else {
+      fprintf(stderr, "%s: not a packingtape archive with an index\n", paths[i]);
+      ok = 0;
+    }
+    SI_Free(&shardIndex);
+    BB_Free(&shard);
+  }
+
+  if (ok) {
+    SI_Write(&index, &archive, BB_Tell(&archive) - start, offset);
+    ok = BB_Flush(&archive);
+    if (!ok) {
+      perror("merge");
+    }
+  }
+  SI_Free(&index);
+  BB_Free(&archive);
+  return ok;
+}
+
+// The size of a frame of stored blocks, with its index: the data, STORED_OVERHEAD for each block, the header and the
+// end marker, and an index point for the frame, one every RESTART_INTERVAL bytes and the closing one. compressBuffer
+// falls back on such a frame when the coded one does not fit
+size_t compressBound (size_t inputSize) {
+  size_t blocks = inputSize / CHANGE_INTERVAL + 1;
+  size_t points = inputSize / RESTART_INTERVAL + 2;
+  return HEADER_LENGTH + inputSize + blocks * STORED_OVERHEAD + FRAME_END_LENGTH +
+    4 + 8 + 8 + points * INDEX_POINT_LENGTH + INDEX_FOOTER_LENGTH;
+}
+
+int compressBuffer (const uint8_t* input, size_t inputSize, uint8_t* output, size_t outputCapacity, size_t* outputSize,
+    CompressorPredictor* p) {
+  int startingCode = p->currentModel->code;
+  ByteBuffer in;
+  BB_NewBorrowedReader(&in, input, inputSize);
+  ByteBuffer archive;
+  BB_NewFixedWriter(&archive, output, outputCapacity);
+  compressFrame(p, &in, &archive, inputSize, NULL);
+  int ok = BB_Flush(&archive);
+  *outputSize = BB_Tell(&archive);
+  if (!ok && outputCapacity >= compressBound(inputSize)) {
+    // Noise that just misses being stored can come out a little larger than stored blocks
+    BB_Free(&in);
+    BB_Free(&archive);
+    BB_NewBorrowedReader(&in, input, inputSize);
+    BB_NewFixedWriter(&archive, output, outputCapacity);
+    CP_SelectModel(p, startingCode);
+    codeFrame(compressBlocksStored, p, &in, &archive, inputSize, NULL);
+    ok = BB_Flush(&archive);
+    *outputSize = BB_Tell(&archive);
+  }
+
+  BB_Free(&in);
+  BB_Free(&archive);
+  return ok;
 }
@@ -10,13 +10,24 @@ void CP_New (CompressorPredictor * cp, ModelArray_t mos, int modelCount, context
   cp->ctx = ctx;
   cp->models = mos;
   cp->modelCount = modelCount;
+  for (int i = 0; i < MAX_MODELS; i++) {
+    cp->scores[i] = 0;
+    cp->lastPredictions[i] = 0;
+  }
+}
+
+// Forgets the context and model scores, so whatever comes next is coded as if nothing came before it
+void CP_Reset (CompressorPredictor * cp) {
+  cp->ctx = 0;
+  for (int i = 0; i < cp->modelCount; i++) {
+    cp->scores[i] = 0;
+  }
 }
 
 int CP_Predict (CompressorPredictor * cp) {
   if (cp->models != NULL) {
     for (int i = 0; i < cp->modelCount; i++) {
-      Model * currentModel = (*cp->models)[i];
-      currentModel->lastPrediction = MO_GetPrediction(currentModel, cp->ctx);
+      cp->lastPredictions[i] = MO_GetPrediction((*cp->models)[i], cp->ctx);
     }
   }
   int prediction = MO_GetPrediction(cp->currentModel, cp->ctx);
@@ -25,9 +36,8 @@ int CP_Predict (CompressorPredictor * cp) {
 
 void CP_Update (CompressorPredictor * cp, int bit) {
   for (int i = 0; i < cp->modelCount; i++) {
-    Model * currentModel = (*cp->models)[i];
-    float pointScore = 1.0 - fabs(bit - ((float)currentModel->lastPrediction/((float)MODEL_LIMIT)));
-    currentModel->score = ((pointScore * 0.005) + (.995 * currentModel->score));
+    float pointScore = 1.0 - fabs(bit - ((float)cp->lastPredictions[i]/((float)MODEL_LIMIT)));
+    cp->scores[i] = ((pointScore * 0.005) + (.995 * cp->scores[i]));
   }
   cp->ctx = (cp->ctx << 1) | bit;
 }
@@ -42,11 +52,11 @@ void CP_SelectModel (CompressorPredictor * cp, int code) {
 }
 
 Model * CP_GetBestModel (CompressorPredictor * cp) {
-  Model * bestScore = (*cp->models)[0];
+  int best = 0;
   for (int i = 0; i < cp->modelCount; i++) {
-    if ((*cp->models)[i]->score > bestScore->score) {
-      bestScore = (*cp->models)[i];
+    if (cp->scores[i] > cp->scores[best]) {
+      best = i;
     }
   }
-  return bestScore;
+  return (*cp->models)[best];
 }
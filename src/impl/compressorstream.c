@@ -0,0 +1,72 @@
+#include <string.h>
+
+#include "compressorstream.h"
+#include "compressor.h"
+#include "util.h"
+
+void CS_New (CompressorStream * cs, CompressorPredictor * p) {
+  *cs = (CompressorStream) {
+    .p = p,
+  };
+  initCoder(&cs->coder);
+  BB_NewGrowingWriter(&cs->archive, BB_BLOCK_SIZE);
+
+  int startingCode = p->currentModel->code;
+  CP_SelectModel(p, startingCode);
+  CP_Reset(p);
+  writeHeader(&cs->archive, startingCode, UNKNOWN_SIZE, 0);
+}
+
+void CS_Push (CompressorStream * cs, const uint8_t * data, size_t len) {
+  while (len > 0) {
+    size_t n = CHANGE_INTERVAL - cs->blockLength < len ? CHANGE_INTERVAL - cs->blockLength : len;
+    memcpy(cs->block + cs->blockLength, data, n);
+    cs->blockLength += n;
+    cs->pushed += n;
+    data += n;
+    len -= n;
+
+    // Only a short block can be the last one, so a full block never has to wait for more input
+    if (cs->blockLength == CHANGE_INTERVAL) {
+      encodeBlock(cs->p, &cs->coder, cs->block, cs->blockLength, BLOCK_MORE, 0, &cs->archive);
+      cs->blockLength = 0;
+    }
+  }
+}
+
+void CS_Finish (CompressorStream * cs) {
+  if (cs->finished) {
+    return;
+  }
+  encodeBlock(cs->p, &cs->coder, cs->block, cs->blockLength, BLOCK_LAST, 0, &cs->archive);
+  writeFrameEnd(&cs->archive, cs->pushed);
+  cs->blockLength = 0;
+  cs->finished = 1;
+}
+
+void CS_Flush (CompressorStream * cs) {
+  // Nothing was pushed since the last flush
+  if (cs->finished || (cs->blockLength == 0 && cs->coder.blockCount == cs->flushedBlockCount)) {
+    return;
+  }
+  encodeBlock(cs->p, &cs->coder, cs->block, cs->blockLength, BLOCK_SYNC, 0, &cs->archive);
+  cs->blockLength = 0;
+  cs->flushedBlockCount = cs->coder.blockCount;
+}
+
+size_t CS_Pull (CompressorStream * cs, uint8_t * output, size_t capacity) {
+  size_t n = cs->archive.pos - cs->pulled < capacity ? cs->archive.pos - cs->pulled : capacity;
+  memcpy(output, cs->archive.data + cs->pulled, n);
+  cs->pulled += n;
+
+  // Start over at the front once everything is out, so the buffer stays as small as the largest backlog
+  if (cs->pulled == cs->archive.pos) {
+    cs->archive.pos = 0;
+    cs->pulled = 0;
+  }
+  return n;
+}
+
+void CS_Free (CompressorStream * cs) {
+  BB_Free(&cs->archive);
+}
@@ -6,13 +6,18 @@
 #include <unistd.h>
 
 #include "util.h"
+#include "bytebuffer.h"
 #include "modelenum.h"
 #include "decompressor.h"
 #include "decompressorpredictor.h"
+#include "segmentindex.h"
+#include "threadpool.h"
+#include "rans.h"
 
-int decode (DecompressorPredictor * p, uint32_t* x1, uint32_t* x2, uint32_t* x, int prediction, FILE* archive, FILE* output, short changeInterval, uint32_t * bitCount) {
+// Decodes a bit the predictor does not see, like the model switches
+int decodeRaw (uint32_t* x1, uint32_t* x2, uint32_t* x, int prediction, ByteBuffer* archive) {
   // Update the range
-  const uint32_t xmid = (*x1) + (((*x2)-(*x1)) >> 12) * prediction;
+  const uint32_t xmid = (*x1) + (uint32_t)(((uint64_t)((*x2)-(*x1)) * prediction) >> PREDICTION_BITS);
   assert(xmid >= (*x1) && xmid < (*x2));
   int y=0;
   if ((*x)<=xmid) {
@@ -21,80 +26,944 @@ int decode (DecompressorPredictor * p, uint32_t* x1, uint32_t* x2, uint32_t* x,
   }
   else
     (*x1)=xmid+1;
-  DP_Update(p, y);
-  /*printf("%d\n", prediction);*/
 
   // Shift equal MSB's out
   while ((((*x1)^(*x2))&0xff000000)==0) {
     (*x1)<<=8;
     (*x2)=((*x2)<<8)+255;
-    int c=getc(archive);
+    int c=BB_GetByte(archive);
     if (c==EOF) c=0;
     (*x)=((*x)<<8)+c;
   }
   return y;
 }
 
-void readHeaderInit (FILE* input, int * startingCode, uint32_t * headerLength) {
-  fread(headerLength, sizeof(uint32_t), 1, input);
-  *startingCode = (int)getc(input);
+int decode (DecompressorPredictor * p, uint32_t* x1, uint32_t* x2, uint32_t* x, int prediction, ByteBuffer* archive) {
+  int y = decodeRaw(x1, x2, x, prediction, archive);
+  DP_Update(p, y);
+  return y;
 }
 
-void decompress (FILE* input, FILE* output, DecompressorPredictor* p) {
-  uint32_t x1 = 0;
-  uint32_t x2 = 0xffffffff;
-  uint32_t x = 0;
+// Mirrors encodeModelCode
+int decodeModelCode (DecompressorPredictor* p, uint32_t* x1, uint32_t* x2, uint32_t* x, ByteBuffer* archive, int* switchPrediction, int previousCode) {
+  int switched = decodeRaw(x1, x2, x, *switchPrediction, archive);
+  *switchPrediction = updateSwitchPrediction(*switchPrediction, switched);
+  if (!switched) {
+    return previousCode;
+  }
+  int index = 0;
+  for (int i=modelCodeBits(p->modelCount)-1; i>=0; --i) {
+    index = (index << 1) | decodeRaw(x1, x2, x, EVEN_PREDICTION, archive);
+  }
+  return index < previousCode ? index : index + 1;
+}
 
-  int startingCode;
-  uint32_t headerLength;
-  readHeaderInit(input, &startingCode, &headerLength);
-  printf("%d %d\n", startingCode, headerLength);
+// Mirrors encodeBlockLength. Returns the length of the block and sets end
+int decodeBlockLength (uint32_t* x1, uint32_t* x2, uint32_t* x, ByteBuffer* archive, int* end) {
+  if (!decodeRaw(x1, x2, x, SHORT_PREDICTION, archive)) {
+    *end = BLOCK_MORE;
+    return CHANGE_INTERVAL;
+  }
+  int length = 0;
+  for (int i=BLOCK_LENGTH_BITS-1; i>=0; --i) {
+    length = (length << 1) | decodeRaw(x1, x2, x, EVEN_PREDICTION, archive);
+  }
+  *end = decodeRaw(x1, x2, x, EVEN_PREDICTION, archive) ? BLOCK_LAST : BLOCK_SYNC;
+  return length;
+}
 
-  DP_SelectModel(p, startingCode);
+// Returns 1 for a frame this version can decode, 0 if input ends before the frame starts and -1 for anything else.
+// Newer versions, unknown flags and layouts that do not mix are refused rather than guessed at
+int readHeader (ByteBuffer* input, FrameHeader* header) {
+  uint8_t magic[4];
+  size_t read = BB_Read(input, magic, 4);
+  // Index frames are only for decoding segments apart
+  while (read == 4 && memcmp(magic, INDEX_MAGIC, 4) == 0) {
+    uint64_t length;
+    if (!BB_GetUint64(input, &length) || length < 12) {
+      return -1;
+    }
+    for (uint64_t i = 12; i < length; i++) {
+      if (BB_GetByte(input) == EOF) {
+        return -1;
+      }
+    }
+    read = BB_Read(input, magic, 4);
+  }
+  if (read == 0) {
+    return 0;
+  }
+  if (read < 4 || memcmp(magic, FRAME_MAGIC, 4) != 0) {
+    return -1;
+  }
+  header->version = BB_GetByte(input);
+  header->flags = BB_GetByte(input);
+  header->startingCode = BB_GetByte(input);
+  header->contentSize = UNKNOWN_SIZE;
+  if (header->version != FRAME_VERSION || header->flags == EOF || (header->flags & ~FRAME_KNOWN_FLAGS) != 0 ||
+      header->startingCode == EOF) {
+    return -1;
+  }
+  // One layout at most
+  int layout = header->flags & FRAME_LAYOUTS;
+  if ((layout & (layout - 1)) != 0) {
+    return -1;
+  }
+  if ((header->flags & FRAME_SIZED) && (!BB_GetUint64(input, &header->contentSize) || header->contentSize == UNKNOWN_SIZE)) {
+    return -1;
+  }
+  return 1;
+}
 
-  uint32_t bitCount = 8;
+// Checks the end marker against what was decoded
+int readFrameEnd (ByteBuffer* input, uint64_t decoded) {
+  uint8_t magic[4];
+  uint64_t contentSize;
+  return BB_Read(input, magic, 4) == 4 && memcmp(magic, FRAME_END_MAGIC, 4) == 0 &&
+    BB_GetUint64(input, &contentSize) && contentSize == decoded;
+}
 
-  // Reads in first 4 bytes into x
-  fseek(input, headerLength, SEEK_SET);
+// Reads the 4 bytes the decoder looks ahead. Happens before the first block and after every sync block, and not at
+// the end of those, because the bytes after a sync flush may not have been written yet
+void startDecoder (Coder* coder, ByteBuffer* archive) {
+  coder->x1 = 0;
+  coder->x2 = 0xffffffff;
+  coder->x = 0;
+  coder->restart = 0;
   for (int i=0; i<4; ++i) {
-    int c=getc(input);
+    int c=BB_GetByte(archive);
     if (c==EOF) c=0;
-    x=(x<<8)+(c&0xff);
+    coder->x=(coder->x<<8)+(c&0xff);
+  }
+}
+
+// Reads a stored block into block. The context only keeps the last 2 bytes, so they are all it takes to rebuild it
+static void readStoredBlock (DecompressorPredictor* p, uint8_t* block, int length, ByteBuffer* archive) {
+  // A damaged archive may end early, the end marker then fails to match
+  size_t read = BB_Read(archive, block, length);
+  memset(block + read, 0, length - read);
+  context ctx = p->ctx;
+  for (int j = length >= 2 ? length - 2 : 0; j < length; ++j) {
+    ctx = (ctx << 8) | block[j];
+  }
+  p->ctx = ctx;
+}
+
+// Mirrors encodeStoredRun. Sets coder up for the blocks that follow, if any
+static void decodeStoredRun (Coder* coder, uint64_t remaining, ByteBuffer* archive) {
+  coder->storedLeft = 0;
+  if (!decodeRaw(&coder->x1, &coder->x2, &coder->x, EVEN_PREDICTION, archive)) {
+    return;
+  }
+  for (int i=STORED_RUN_BITS-1; i>=0; --i) {
+    coder->storedLeft = (coder->storedLeft << 1) | decodeRaw(&coder->x1, &coder->x2, &coder->x, EVEN_PREDICTION, archive);
+  }
+  if (remaining == UNKNOWN_SIZE) {
+    coder->storedLength = decodeBlockLength(&coder->x1, &coder->x2, &coder->x, archive, &coder->storedEnd);
+  }
+}
+
+// Reads the next block of a run of stored blocks, which has nothing coded of its own. All but the last are whole, and
+// the run said how the last one ends if the blocks code their length
+static int readStoredRunBlock (DecompressorPredictor* p, Coder* coder, uint8_t* block, uint64_t remaining,
+    ByteBuffer* archive, int* end) {
+  int length;
+  if (remaining != UNKNOWN_SIZE) {
+    length = remaining < CHANGE_INTERVAL ? remaining : CHANGE_INTERVAL;
+    *end = remaining == (uint64_t)length ? BLOCK_LAST : BLOCK_MORE;
+  } else if (coder->storedLeft > 1) {
+    length = CHANGE_INTERVAL;
+    *end = BLOCK_MORE;
+  } else {
+    length = coder->storedLength;
+    *end = coder->storedEnd;
+  }
+  coder->storedLeft--;
+  readStoredBlock(p, block, length, archive);
+  return length;
+}
+
+// Mirrors encodeBlock. remaining is what the header says is left to decode, or UNKNOWN_SIZE if the blocks say where
+// the data ends. Returns the length of the block and sets end to how it ends
+int decodeBlock (DecompressorPredictor* p, Coder* coder, uint8_t* block, uint64_t remaining, ByteBuffer* archive, int* end) {
+  if (coder->storedLeft > 0) {
+    return readStoredRunBlock(p, coder, block, remaining, archive, end);
+  }
+  if (coder->restart) {
+    startDecoder(coder, archive);
   }
 
-  int headerPos = 5;
-  int changeInterval = 128; // Has to be synced with compressor's change interval
+  if (coder->blockCount++ > 0) {
+    int modelCode = decodeModelCode(p, &coder->x1, &coder->x2, &coder->x, archive, &coder->switchPrediction, p->currentModel->code);
+    /*int modelCode = 1;*/
+    DP_SelectModel(p, modelCode);
+  }
 
-  int run = 1;
-  while (run) {
-    if (bitCount % (changeInterval * 8) == 0) {
-      long oldPos = ftell(input);
-      fseek(input, headerPos, SEEK_SET);
-      int modelCode = getc(input);
-      /*int modelCode = 1;*/
-      headerPos += 1;
-      fseek(input, oldPos, SEEK_SET);
+  int length;
+  if (remaining == UNKNOWN_SIZE) {
+    length = decodeBlockLength(&coder->x1, &coder->x2, &coder->x, archive, end);
+  } else {
+    length = remaining < CHANGE_INTERVAL ? remaining : CHANGE_INTERVAL;
+    *end = remaining == (uint64_t)length ? BLOCK_LAST : BLOCK_MORE;
+  }
 
-      DP_SelectModel(p, modelCode);
+  if (decodeRaw(&coder->x1, &coder->x2, &coder->x, STORED_PREDICTION, archive)) {
+    decodeStoredRun(coder, remaining, archive);
+    readStoredBlock(p, block, length, archive);
+    coder->restart = 1;
+    return length;
+  }
 
-      bitCount = 0;
+  for (int j=0; j<length; ++j) {
+    int c = 0;
+    for (int i=0; i<8; ++i) {
+      c = (c << 1) | decode(p, &coder->x1, &coder->x2, &coder->x, DP_Predict(p), archive);
     }
-    run = !decode(p, &x1, &x2, &x, DP_Predict(p), input, output, changeInterval, &bitCount);
-    if (!run) {
-      break;
+    block[j] = c;
+  }
+  coder->restart = *end == BLOCK_SYNC;
+  return length;
+}
+
+void initFrameDecoder (FrameDecoder* decoder, int flags) {
+  initCoder(&decoder->coder);
+  decoder->layout = flags & FRAME_LAYOUTS;
+  decoder->runLeft = 0;
+}
+
+void freeFrameDecoder (FrameDecoder* decoder) {
+  free(decoder->run);
+}
+
+// In ranged and byte frames a stored block ends the run it is in early, and the run after it only goes up to where
+// that one would have ended. Runs then still start on restart points
+static void startRunLeft (FrameDecoder* decoder) {
+  if (decoder->runLeft == 0) {
+    decoder->runLeft = CODER_RUN;
+  }
+  decoder->coder.restart = 0;
+}
+
+// Whether the next block starts a run
+static int runStarts (FrameDecoder* decoder) {
+  return decoder->runLeft == 0 || decoder->coder.restart;
+}
+
+// Takes what is left of the run off after a block of length
+static void endBlockOfRun (FrameDecoder* decoder, int length) {
+  // A short block ends the run too, so the count cannot go below 0
+  decoder->runLeft -= length < decoder->runLeft ? length : decoder->runLeft;
+}
+
+// Reads the next run and starts every lane's coder on its bytes. Only touches the lanes once the whole run is read,
+// so a stream that has not had all of it pushed can roll back
+static int startRun (FrameDecoder* decoder, ByteBuffer* archive) {
+  uint32_t lengths[INTERLEAVE_WAYS];
+  size_t total = 0;
+  for (int lane = 0; lane < INTERLEAVE_WAYS; lane++) {
+    if (!BB_GetUint32(archive, &lengths[lane])) {
+      return 0;
     }
-    int c=1;
-    // Decode until you reach a byte
-    while (c<128) {
-      c+=c+decode(p, &x1, &x2, &x, DP_Predict(p), input, output, changeInterval, &bitCount);
-      bitCount += 1;
+    total += lengths[lane];
+  }
+  if (total > MAX_RUN) {
+    return 0;
+  }
+  if (total > decoder->runCapacity) {
+    decoder->run = realloc(decoder->run, total);
+    decoder->runCapacity = total;
+  }
+  if (BB_Read(archive, decoder->run, total) != total) {
+    return 0;
+  }
+  size_t start = 0;
+  for (int lane = 0; lane < INTERLEAVE_WAYS; lane++) {
+    BB_NewBorrowedReader(&decoder->lanes[lane], decoder->run + start, lengths[lane]);
+    start += lengths[lane];
+    Coder coder;
+    startDecoder(&coder, &decoder->lanes[lane]);
+    decoder->x1[lane] = coder.x1;
+    decoder->x2[lane] = coder.x2;
+    decoder->x[lane] = coder.x;
+  }
+  decoder->runLeft = CODER_RUN;
+  return 1;
+}
+
+// Mirrors codeInterleavedBlock. A run that cannot be read ends the frame, and the end marker check fails it
+static int decodeInterleavedBlock (DecompressorPredictor* p, FrameDecoder* decoder, uint8_t* block, uint64_t remaining,
+    ByteBuffer* archive, int* end) {
+  if (decoder->runLeft == 0 && !startRun(decoder, archive)) {
+    *end = BLOCK_LAST;
+    return 0;
+  }
+  uint32_t* x1 = decoder->x1;
+  uint32_t* x2 = decoder->x2;
+  uint32_t* x = decoder->x;
+  ByteBuffer* lanes = decoder->lanes;
+
+  if (decoder->coder.blockCount++ > 0) {
+    int modelCode = decodeModelCode(p, &x1[0], &x2[0], &x[0], &lanes[0], &decoder->coder.switchPrediction, p->currentModel->code);
+    DP_SelectModel(p, modelCode);
+  }
+
+  int length;
+  if (remaining == UNKNOWN_SIZE) {
+    length = decodeBlockLength(&x1[0], &x2[0], &x[0], &lanes[0], end);
+  } else {
+    length = remaining < CHANGE_INTERVAL ? remaining : CHANGE_INTERVAL;
+    *end = remaining == (uint64_t)length ? BLOCK_LAST : BLOCK_MORE;
+  }
+
+  // The stored blocks of a run follow it, so they come next in the archive
+  if (decodeRaw(&x1[0], &x2[0], &x[0], STORED_PREDICTION, &lanes[0])) {
+    readStoredBlock(p, block, length, archive);
+    endBlockOfRun(decoder, length);
+    return length;
+  }
+
+  // The model stays the same for the whole block, so its table is looked up directly rather than through DP_Predict
+  const ModelData_t* table = p->currentModel->data;
+  context ctx = p->ctx;
+  for (int j=0; j<length; ++j) {
+    int c = 0;
+    for (int i=0; i<8; ++i) {
+      int lane = i % INTERLEAVE_WAYS;
+      int y = decodeRaw(&x1[lane], &x2[lane], &x[lane], (*table)[ctx], &lanes[lane]);
+      ctx = (ctx << 1) | y;
+      c = (c << 1) | y;
     }
-    bitCount += 1;
-    // c started at 1. You have to remove it from the output because it was not 0, and the 1 sticks to the front of the decoded byte. Hence the subtraction.
-    putc(c-128, output);
+    block[j] = c;
   }
+  p->ctx = ctx;
+  endBlockOfRun(decoder, length);
+  return length;
+}
 
+// Mirrors encodeRangedModelCode
+static int decodeRangedModelCode (DecompressorPredictor* p, FrameDecoder* decoder, ByteBuffer* archive, int previousCode) {
+  int switched = RC_Decode(&decoder->range, decoder->coder.switchPrediction, archive);
+  decoder->coder.switchPrediction = updateSwitchPrediction(decoder->coder.switchPrediction, switched);
+  if (!switched) {
+    return previousCode;
+  }
+  int index = 0;
+  for (int i=modelCodeBits(p->modelCount)-1; i>=0; --i) {
+    index = (index << 1) | RC_Decode(&decoder->range, EVEN_PREDICTION, archive);
+  }
+  return index < previousCode ? index : index + 1;
+}
+
+// Mirrors encodeRangedBlockLength
+static int decodeRangedBlockLength (RangeDecoder* rc, ByteBuffer* archive, int* end) {
+  if (!RC_Decode(rc, SHORT_PREDICTION, archive)) {
+    *end = BLOCK_MORE;
+    return CHANGE_INTERVAL;
+  }
+  int length = 0;
+  for (int i=BLOCK_LENGTH_BITS-1; i>=0; --i) {
+    length = (length << 1) | RC_Decode(rc, EVEN_PREDICTION, archive);
+  }
+  *end = RC_Decode(rc, EVEN_PREDICTION, archive) ? BLOCK_LAST : BLOCK_SYNC;
+  return length;
+}
+
+// Mirrors encodeRangedStoredRun
+static void decodeRangedStoredRun (FrameDecoder* decoder, uint64_t remaining, ByteBuffer* archive) {
+  Coder* coder = &decoder->coder;
+  coder->storedLeft = 0;
+  if (!RC_Decode(&decoder->range, EVEN_PREDICTION, archive)) {
+    return;
+  }
+  for (int i=STORED_RUN_BITS-1; i>=0; --i) {
+    coder->storedLeft = (coder->storedLeft << 1) | RC_Decode(&decoder->range, EVEN_PREDICTION, archive);
+  }
+  if (remaining == UNKNOWN_SIZE) {
+    coder->storedLength = decodeRangedBlockLength(&decoder->range, archive, &coder->storedEnd);
+  }
+}
+
+// The blocks that follow the first of a run of stored blocks in a ranged or byte frame. The run counts them as blocks
+// of its own
+static int readRangedStoredRunBlock (DecompressorPredictor* p, FrameDecoder* decoder, uint8_t* block, uint64_t remaining,
+    ByteBuffer* archive, int* end) {
+  int length = readStoredRunBlock(p, &decoder->coder, block, remaining, archive, end);
+  endBlockOfRun(decoder, length);
+  return length;
+}
+
+// Mirrors codeRangedBlock. The coder starts over on the first block of every CODER_RUN bytes and after stored blocks
+static int decodeRangedBlock (DecompressorPredictor* p, FrameDecoder* decoder, uint8_t* block, uint64_t remaining,
+    ByteBuffer* archive, int* end) {
+  if (decoder->coder.storedLeft > 0) {
+    return readRangedStoredRunBlock(p, decoder, block, remaining, archive, end);
+  }
+  if (runStarts(decoder)) {
+    RC_StartDecoder(&decoder->range, archive);
+    startRunLeft(decoder);
+  }
+
+  if (decoder->coder.blockCount++ > 0) {
+    DP_SelectModel(p, decodeRangedModelCode(p, decoder, archive, p->currentModel->code));
+  }
+
+  int length;
+  if (remaining == UNKNOWN_SIZE) {
+    length = decodeRangedBlockLength(&decoder->range, archive, end);
+  } else {
+    length = remaining < CHANGE_INTERVAL ? remaining : CHANGE_INTERVAL;
+    *end = remaining == (uint64_t)length ? BLOCK_LAST : BLOCK_MORE;
+  }
+
+  // The flush before a stored block ends where the decoder has read up to
+  if (RC_Decode(&decoder->range, STORED_PREDICTION, archive)) {
+    decodeRangedStoredRun(decoder, remaining, archive);
+    readStoredBlock(p, block, length, archive);
+    endBlockOfRun(decoder, length);
+    decoder->coder.restart = 1;
+    return length;
+  }
+
+  // Looked up directly, as decodeInterleavedBlock does
+  const ModelData_t* table = p->currentModel->data;
+  RangeDecoder range = decoder->range;
+  context ctx = p->ctx;
+  for (int j=0; j<length; ++j) {
+    int c = 0;
+    for (int i=0; i<8; ++i) {
+      int y = RC_Decode(&range, (*table)[ctx], archive);
+      ctx = (ctx << 1) | y;
+      c = (c << 1) | y;
+    }
+    block[j] = c;
+  }
+  decoder->range = range;
+  p->ctx = ctx;
+  endBlockOfRun(decoder, length);
+  return length;
+}
+
+// Past the end of a rANS run RANS_Decode reads ahead into this many zeros. It is what a block can read at most: a word
+// for each of its bits, and a switch and a length take fewer than 32 bits
+#define RANS_SLACK (2 * (8 * CHANGE_INTERVAL + 32))
+
+// Reads the next rANS run whole, the same way startRun does
+static int startRansRun (FrameDecoder* decoder, ByteBuffer* archive) {
+  uint32_t length;
+  if (!BB_GetUint32(archive, &length) || length < 4 || length > MAX_RUN) {
+    return 0;
+  }
+  if (length + RANS_SLACK > decoder->runCapacity) {
+    decoder->run = realloc(decoder->run, length + RANS_SLACK);
+    decoder->runCapacity = length + RANS_SLACK;
+  }
+  if (BB_Read(archive, decoder->run, length) != length) {
+    return 0;
+  }
+  memset(decoder->run + length, 0, RANS_SLACK);
+  const uint8_t* run = decoder->run;
+  decoder->ransState = (uint32_t)run[0] << 24 | (uint32_t)run[1] << 16 | (uint32_t)run[2] << 8 | run[3];
+  decoder->ransNext = 4;
+  decoder->ransEnd = length;
+  decoder->runLeft = CODER_RUN;
+  return 1;
+}
+
+// Mirrors recordRansModelCode
+static int decodeRansModelCode (DecompressorPredictor* p, Coder* coder, uint32_t* state, const uint8_t** next, int previousCode) {
+  int switched = RANS_Decode(state, next, coder->switchPrediction);
+  coder->switchPrediction = updateSwitchPrediction(coder->switchPrediction, switched);
+  if (!switched) {
+    return previousCode;
+  }
+  int index = 0;
+  for (int i=modelCodeBits(p->modelCount)-1; i>=0; --i) {
+    index = (index << 1) | RANS_Decode(state, next, EVEN_PREDICTION);
+  }
+  return index < previousCode ? index : index + 1;
+}
+
+// Mirrors recordRansBlockLength
+static int decodeRansBlockLength (uint32_t* state, const uint8_t** next, int* end) {
+  if (!RANS_Decode(state, next, SHORT_PREDICTION)) {
+    *end = BLOCK_MORE;
+    return CHANGE_INTERVAL;
+  }
+  int length = 0;
+  for (int i=BLOCK_LENGTH_BITS-1; i>=0; --i) {
+    length = (length << 1) | RANS_Decode(state, next, EVEN_PREDICTION);
+  }
+  *end = RANS_Decode(state, next, EVEN_PREDICTION) ? BLOCK_LAST : BLOCK_SYNC;
+  return length;
+}
+
+// Mirrors codeRansBlock. A run that cannot be read, or a damaged one that has run out of words, ends the frame
+static int decodeRansBlock (DecompressorPredictor* p, FrameDecoder* decoder, uint8_t* block, uint64_t remaining,
+    ByteBuffer* archive, int* end) {
+  if ((decoder->runLeft == 0 && !startRansRun(decoder, archive)) || decoder->ransNext > decoder->ransEnd) {
+    *end = BLOCK_LAST;
+    return 0;
+  }
+  uint32_t state = decoder->ransState;
+  const uint8_t* next = decoder->run + decoder->ransNext;
+
+  if (decoder->coder.blockCount++ > 0) {
+    DP_SelectModel(p, decodeRansModelCode(p, &decoder->coder, &state, &next, p->currentModel->code));
+  }
+
+  int length;
+  if (remaining == UNKNOWN_SIZE) {
+    length = decodeRansBlockLength(&state, &next, end);
+  } else {
+    length = remaining < CHANGE_INTERVAL ? remaining : CHANGE_INTERVAL;
+    *end = remaining == (uint64_t)length ? BLOCK_LAST : BLOCK_MORE;
+  }
+
+  // The stored blocks of a run follow it, as in an interleaved frame
+  if (RANS_Decode(&state, &next, STORED_PREDICTION)) {
+    decoder->ransState = state;
+    decoder->ransNext = next - decoder->run;
+    readStoredBlock(p, block, length, archive);
+    endBlockOfRun(decoder, length);
+    return length;
+  }
+
+  const ModelData_t* table = p->currentModel->data;
+  context ctx = p->ctx;
+  for (int j=0; j<length; ++j) {
+    int c = 0;
+    for (int i=0; i<8; ++i) {
+      int y = RANS_Decode(&state, &next, (*table)[ctx]);
+      ctx = (ctx << 1) | y;
+      c = (c << 1) | y;
+    }
+    block[j] = c;
+  }
+  p->ctx = ctx;
+  decoder->ransState = state;
+  decoder->ransNext = next - decoder->run;
+  endBlockOfRun(decoder, length);
+  return length;
+}
+
+// Mirrors the blocks of compressBlocksBytes
+static int decodeBytesBlock (DecompressorPredictor* p, FrameDecoder* decoder, uint8_t* block, uint64_t remaining,
+    ByteBuffer* archive, int* end) {
+  if (decoder->coder.storedLeft > 0) {
+    return readRangedStoredRunBlock(p, decoder, block, remaining, archive, end);
+  }
+  if (runStarts(decoder)) {
+    RC_StartDecoder(&decoder->range, archive);
+    startRunLeft(decoder);
+  }
+
+  int length;
+  if (remaining == UNKNOWN_SIZE) {
+    length = decodeRangedBlockLength(&decoder->range, archive, end);
+  } else {
+    length = remaining < CHANGE_INTERVAL ? remaining : CHANGE_INTERVAL;
+    *end = remaining == (uint64_t)length ? BLOCK_LAST : BLOCK_MORE;
+  }
+
+  if (RC_Decode(&decoder->range, STORED_PREDICTION, archive)) {
+    decodeRangedStoredRun(decoder, remaining, archive);
+    readStoredBlock(p, block, length, archive);
+    endBlockOfRun(decoder, length);
+    decoder->coder.restart = 1;
+    return length;
+  }
+
+  RangeDecoder range = decoder->range;
+  context ctx = p->ctx;
+  for (int j=0; j<length; ++j) {
+    int c = RC_DecodeSymbol(&range, &BYTE1_Data[(ctx & 0xff) << 8], archive);
+    ctx = (ctx << 8) | c;
+    block[j] = c;
+  }
+  decoder->range = range;
+  p->ctx = ctx;
+  endBlockOfRun(decoder, length);
+  return length;
+}
+
+int decodeFrameBlock (DecompressorPredictor* p, FrameDecoder* decoder, uint8_t* block, uint64_t remaining,
+    ByteBuffer* archive, int* end) {
+  switch (decoder->layout) {
+    case FRAME_INTERLEAVED:
+      return decodeInterleavedBlock(p, decoder, block, remaining, archive, end);
+    case FRAME_RANGED:
+      return decodeRangedBlock(p, decoder, block, remaining, archive, end);
+    case FRAME_RANS:
+      return decodeRansBlock(p, decoder, block, remaining, archive, end);
+    case FRAME_BYTES:
+      return decodeBytesBlock(p, decoder, block, remaining, archive, end);
+  }
+  return decodeBlock(p, &decoder->coder, block, remaining, archive, end);
+}
+
+// Decodes contentSize bytes from archive into out, or up to the last block if the size is UNKNOWN_SIZE. flags are the
+// frame's. Returns how many it decoded
+uint64_t decompressBlocks (DecompressorPredictor* p, ByteBuffer* archive, ByteBuffer* out, uint64_t contentSize, int flags) {
+  FrameDecoder decoder = {0};
+  initFrameDecoder(&decoder, flags);
+
+  uint8_t block[CHANGE_INTERVAL];
+  uint64_t remaining = contentSize;
+
+  uint64_t decoded = 0;
+  int end = BLOCK_MORE;
+  while (end != BLOCK_LAST) {
+    int length = decodeFrameBlock(p, &decoder, block, remaining, archive, &end);
+    BB_Write(out, block, length);
+    if (remaining != UNKNOWN_SIZE) {
+      remaining -= length;
+    }
+    decoded += length;
+  }
+  freeFrameDecoder(&decoder);
+  return decoded;
+}
+
+// Decodes every frame in archive into out, writing at most limit bytes. Returns 0 for anything but whole frames
+// that decode to what their end markers say
+int decompressFrames (DecompressorPredictor* p, ByteBuffer* archive, ByteBuffer* out, uint64_t limit) {
+  FrameHeader header;
+  int frames = 0;
+  int status;
+  while ((status = readHeader(archive, &header)) == 1) {
+    // Do not decode what is known not to fit, or a frame that starts with a model this build does not have
+    if ((header.contentSize != UNKNOWN_SIZE && header.contentSize > limit) || header.startingCode >= p->modelCount) {
+      return 0;
+    }
+    DP_SelectModel(p, header.startingCode);
+    p->ctx = 0;
+    uint64_t decoded = decompressBlocks(p, archive, out, header.contentSize, header.flags);
+    if (!readFrameEnd(archive, decoded)) {
+      return 0;
+    }
+    limit -= decoded < limit ? decoded : limit;
+    frames++;
+  }
+  return status == 0 && frames > 0;
+}
+
+int decompress (FILE* input, FILE* output, DecompressorPredictor* p) {
+  ByteBuffer archive;
+  BB_NewAsyncReader(&archive, input);
+  ByteBuffer out;
+  BB_NewAsyncWriter(&out, output);
+  int ok = decompressFrames(p, &archive, &out, UINT64_MAX);
+  // A read error looks like the end of the archive to the decoder, which may have been between two frames
+  if (BB_Failed(&archive)) {
+    perror("decompress");
+    ok = 0;
+  } else if (!ok) {
+    fprintf(stderr, "decompress: not a packingtape archive, or a damaged one\n");
+  }
+  if (!BB_Flush(&out)) {
+    perror("decompress");
+    ok = 0;
+  }
+
+  BB_Free(&archive);
+  BB_Free(&out);
+  fclose(input);
+  fclose(output);
+  return ok;
+}
+
+int decompressMapped (FILE* input, FILE* output, DecompressorPredictor* p) {
+  ByteBuffer archive;
+  if (!BB_NewMappedReader(&archive, fileno(input))) {
+    return decompress(input, output, p);
+  }
+
+  // A single frame knows its exact size unless it came from a pipe. Otherwise guess the typical text ratio and let
+  // the writer grow the file past it if needed
+  FrameHeader header;
+  int sized = readHeader(&archive, &header) == 1 && header.contentSize != UNKNOWN_SIZE;
+  off_t sizeHint = sized ? (off_t)header.contentSize : (off_t)archive.len * 3;
+  archive.pos = 0;
+
+  ByteBuffer out;
+  if (!BB_NewMappedWriter(&out, fileno(output), 0, sizeHint)) {
+    BB_Free(&out);
+    BB_Free(&archive);
+    return decompress(input, output, p);
+  }
+  int ok = decompressFrames(p, &archive, &out, UINT64_MAX);
+  if (!ok) {
+    fprintf(stderr, "decompress: not a packingtape archive, or a damaged one\n");
+  }
+  if (!BB_Flush(&out)) {
+    perror("decompress");
+    ok = 0;
+  }
+
+  BB_Free(&archive);
+  BB_Free(&out);
+  fclose(input);
+  fclose(output);
+  return ok;
+}
+
+// One segment of decompressParallel
+typedef struct SegmentJob {
+  DecompressorPredictor p;
+  const uint8_t * archive;
+  size_t archiveSize;
+  uint64_t size;
+  off_t offset; // Of the decoded data in the output file
+  int fd;
+  int ok;
+} SegmentJob;
+
+static void decompressSegment (void * arg) {
+  SegmentJob * job = arg;
+  uint8_t * data = malloc(job->size);
+  size_t size;
+  job->ok = data != NULL && decompressBuffer(job->archive, job->archiveSize, data, job->size, &size, &job->p) &&
+    size == job->size;
+  for (size_t written = 0; job->ok && written < size; ) {
+    ssize_t n = pwrite(job->fd, data + written, size - written, job->offset + written);
+    job->ok = n > 0;
+    written += n;
+  }
+  free(data);
+}
+
+int decompressParallel (FILE* input, FILE* output, DecompressorPredictor* p, int threads) {
+  ByteBuffer archive;
+  SegmentIndex index;
+  ThreadPool pool;
+  if (threads <= 1 || !BB_NewMappedReader(&archive, fileno(input))) {
+    return decompressMapped(input, output, p);
+  }
+  // Segments are the frames, the restart points inside them are only for decompressRange
+  uint64_t segmentCount = 0;
+  if (SI_Read(&index, archive.data, archive.len)) {
+    for (uint64_t i = 0; i < index.count; i++) {
+      segmentCount += index.points[i].frameStart;
+    }
+  }
+  if (segmentCount < 2 || !TP_New(&pool, threads)) {
+    SI_Free(&index);
+    BB_Free(&archive);
+    return decompressMapped(input, output, p);
+  }
+
+  int fd = fileno(output);
+  int ok = ftruncate(fd, index.points[index.count].offset) == 0;
+  SegmentJob * jobs = calloc(segmentCount, sizeof(SegmentJob));
+  uint64_t segment = 0;
+  for (uint64_t i = 0; ok && i < index.count; i++) {
+    if (!index.points[i].frameStart) {
+      continue;
+    }
+    uint64_t next = i + 1;
+    while (!index.points[next].frameStart) {
+      next++;
+    }
+    jobs[segment] = (SegmentJob) {
+      .p = *p,
+      .archive = archive.data + index.points[i].compressedOffset,
+      .archiveSize = index.points[next].compressedOffset - index.points[i].compressedOffset,
+      .size = index.points[next].offset - index.points[i].offset,
+      .offset = index.points[i].offset,
+      .fd = fd,
+    };
+    TP_Submit(&pool, decompressSegment, &jobs[segment++]);
+  }
+  TP_Wait(&pool);
+  for (uint64_t i = 0; ok && i < segmentCount; i++) {
+    ok = jobs[i].ok;
+  }
+  if (!ok) {
+    fprintf(stderr, "decompress: not a packingtape archive, or a damaged one\n");
+  }
+
+  TP_Free(&pool);
+  free(jobs);
+  SI_Free(&index);
+  BB_Free(&archive);
   fclose(input);
   fclose(output);
+  return ok;
+}
+
+// Picks up decoding at a restart point inside a frame. The point carries everything decodeBlock keeps between blocks,
+// the decoder's 4 bytes of look ahead are the ones at the point. In the other layouts the point is the start of a
+// run, which sets up its own coders
+static int startAtRestartPoint (DecompressorPredictor* p, FrameDecoder* decoder, RestartPoint* point, ByteBuffer* archive) {
+  Coder* coder = &decoder->coder;
+  if (point->modelCode >= p->modelCount || point->x1 >= point->x2 || ((point->x1 ^ point->x2) & 0xff000000) == 0 ||
+      point->switchPrediction <= 0 || point->switchPrediction >= 1 << PREDICTION_BITS || point->compressedOffset > archive->len) {
+    return 0;
+  }
+  archive->pos = point->compressedOffset;
+  if (decoder->layout == 0) {
+    startDecoder(coder, archive);
+    coder->x1 = point->x1;
+    coder->x2 = point->x2;
+  }
+  decoder->runLeft = 0;
+  coder->switchPrediction = point->switchPrediction;
+  coder->blockCount = 1;
+  DP_SelectModel(p, point->modelCode);
+  p->ctx = point->ctx;
+  return 1;
+}
+
+// Decodes the length bytes from offset on into out, starting from the last restart point before offset. Without an
+// index everything up to the range is decoded and dropped. Returns 0 if the archive is damaged
+static int decompressRangeData (DecompressorPredictor* p, ByteBuffer* archive, uint64_t offset, uint64_t length,
+    ByteBuffer* out) {
+  FrameDecoder decoder = {0};
+  initFrameDecoder(&decoder, 0);
+  FrameHeader header;
+  uint64_t remaining = 0;
+  uint64_t frameOffset = 0; // Of the data of the frame being decoded
+  uint64_t position = 0; // Of the next byte decodeBlock decodes
+  int inFrame = 0;
+
+  SegmentIndex index;
+  if (SI_Read(&index, archive->data, archive->len)) {
+    uint64_t point = SI_Find(&index, offset);
+    uint64_t frame = point;
+    while (!index.points[frame].frameStart) {
+      frame--;
+    }
+    archive->pos = index.points[frame].compressedOffset;
+    if (readHeader(archive, &header) != 1 || header.startingCode >= p->modelCount) {
+      SI_Free(&index);
+      return 0;
+    }
+    initFrameDecoder(&decoder, header.flags);
+    DP_SelectModel(p, header.startingCode);
+    p->ctx = 0;
+    remaining = header.contentSize;
+    frameOffset = index.points[frame].offset;
+    position = index.points[point].offset;
+    if (point != frame) {
+      if (!startAtRestartPoint(p, &decoder, &index.points[point], archive) ||
+          (remaining != UNKNOWN_SIZE && position - frameOffset >= remaining)) {
+        SI_Free(&index);
+        return 0;
+      }
+      if (remaining != UNKNOWN_SIZE) {
+        remaining -= position - frameOffset;
+      }
+    }
+    inFrame = 1;
+  }
+  SI_Free(&index);
+
+  uint8_t block[CHANGE_INTERVAL];
+  uint64_t rangeEnd = length < UINT64_MAX - offset ? offset + length : UINT64_MAX;
+  int ok = 1;
+  while (ok && position < rangeEnd) {
+    if (!inFrame) {
+      int status = readHeader(archive, &header);
+      if (status == 0) {
+        break;
+      }
+      if (status < 0 || header.startingCode >= p->modelCount) {
+        ok = 0;
+        break;
+      }
+      DP_SelectModel(p, header.startingCode);
+      p->ctx = 0;
+      initFrameDecoder(&decoder, header.flags);
+      remaining = header.contentSize;
+      frameOffset = position;
+      inFrame = 1;
+    }
+
+    int end;
+    int blockLength = decodeFrameBlock(p, &decoder, block, remaining, archive, &end);
+    if (remaining != UNKNOWN_SIZE) {
+      remaining -= blockLength;
+    }
+    // Write the part of the block that falls in the range
+    uint64_t from = position > offset ? position : offset;
+    uint64_t to = position + blockLength < rangeEnd ? position + blockLength : rangeEnd;
+    if (from < to) {
+      BB_Write(out, block + (from - position), to - from);
+    }
+    position += blockLength;
+
+    if (end == BLOCK_LAST) {
+      ok = readFrameEnd(archive, position - frameOffset);
+      inFrame = 0;
+    }
+  }
+  freeFrameDecoder(&decoder);
+  return ok;
+}
+
+int decompressRange (FILE* input, FILE* output, uint64_t offset, uint64_t length, DecompressorPredictor* p) {
+  ByteBuffer archive;
+  if (!BB_NewMappedReader(&archive, fileno(input))) {
+    fprintf(stderr, "decompress: a range can only be read from a regular file\n");
+    BB_Free(&archive);
+    fclose(input);
+    fclose(output);
+    return 0;
+  }
+  ByteBuffer out;
+  BB_NewWriter(&out, output);
+  int ok = decompressRangeData(p, &archive, offset, length, &out);
+  if (!ok) {
+    fprintf(stderr, "decompress: not a packingtape archive, or a damaged one\n");
+  }
+  if (!BB_Flush(&out)) {
+    perror("decompress");
+    ok = 0;
+  }
+
+  BB_Free(&archive);
+  BB_Free(&out);
+  fclose(input);
+  fclose(output);
+  return ok;
+}
+
+int decompressRangeBuffer (const uint8_t* input, size_t inputSize, uint64_t offset, uint64_t length, uint8_t* output,
+    size_t* outputSize, DecompressorPredictor* p) {
+  ByteBuffer archive;
+  BB_NewBorrowedReader(&archive, input, inputSize);
+  ByteBuffer out;
+  BB_NewFixedWriter(&out, output, length);
+  int ok = decompressRangeData(p, &archive, offset, length, &out);
+  ok = BB_Flush(&out) && ok;
+  *outputSize = ok ? BB_Tell(&out) : 0;
+
+  BB_Free(&archive);
+  BB_Free(&out);
+  return ok;
+}
+
+uint64_t decompressedSize (const uint8_t* input, size_t inputSize) {
+  ByteBuffer archive;
+  BB_NewBorrowedReader(&archive, input, inputSize);
+  FrameHeader header;
+  if (readHeader(&archive, &header) != 1) {
+    return UNKNOWN_SIZE;
+  }
+  return header.contentSize;
+}
+
+int decompressBuffer (const uint8_t* input, size_t inputSize, uint8_t* output, size_t outputCapacity, size_t* outputSize,
+    DecompressorPredictor* p) {
+  ByteBuffer archive;
+  BB_NewBorrowedReader(&archive, input, inputSize);
+  ByteBuffer out;
+  BB_NewFixedWriter(&out, output, outputCapacity);
+  int ok = decompressFrames(p, &archive, &out, outputCapacity);
+  ok = BB_Flush(&out) && ok;
+  *outputSize = ok ? BB_Tell(&out) : 0;
 
+  BB_Free(&archive);
+  BB_Free(&out);
+  return ok;
 }
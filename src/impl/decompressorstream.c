@@ -0,0 +1,159 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "decompressorstream.h"
+#include "decompressor.h"
+#include "util.h"
+
+static int DS_Starve (ByteBuffer * bb) {
+  ((DecompressorStream *)bb)->starved = 1;
+  return 0;
+}
+
+void DS_New (DecompressorStream * ds, DecompressorPredictor * p) {
+  *ds = (DecompressorStream) {
+    .capacity = BB_BLOCK_SIZE,
+    .p = p,
+  };
+  BB_NewMemoryReader(&ds->archive, malloc(ds->capacity), 0);
+  ds->archive.refill = DS_Starve;
+  initFrameDecoder(&ds->decoder, 0);
+}
+
+void DS_Push (DecompressorStream * ds, const uint8_t * data, size_t len) {
+  // Drop what is decoded already before growing
+  ByteBuffer * archive = &ds->archive;
+  memmove(archive->data, archive->data + archive->pos, archive->len - archive->pos);
+  archive->len -= archive->pos;
+  archive->pos = 0;
+  if (archive->len + len > ds->capacity) {
+    ds->capacity = (archive->len + len) * 2;
+    archive->data = realloc(archive->data, ds->capacity);
+  }
+  memcpy(archive->data + archive->len, data, len);
+  archive->len += len;
+}
+
+// Reads the next frame header. Returns 0 and leaves everything as it was if that needs more bytes than were pushed
+static int DS_StartFrame (DecompressorStream * ds) {
+  size_t pos = ds->archive.pos;
+  ds->starved = 0;
+  FrameHeader header;
+  int status = readHeader(&ds->archive, &header);
+  if (ds->starved) {
+    ds->archive.pos = pos;
+    return 0;
+  }
+  if (status != 1 || header.startingCode >= ds->p->modelCount) {
+    ds->failed = 1;
+    return 0;
+  }
+  DP_SelectModel(ds->p, header.startingCode);
+  ds->p->ctx = 0;
+  initFrameDecoder(&ds->decoder, header.flags);
+  ds->remaining = header.contentSize;
+  ds->decoded = 0;
+  ds->inFrame = 1;
+  ds->lastBlock = 0;
+  ds->finished = 0;
+  return 1;
+}
+
+// Checks the end marker of the current frame, the same way
+static int DS_EndFrame (DecompressorStream * ds) {
+  size_t pos = ds->archive.pos;
+  ds->starved = 0;
+  int ok = readFrameEnd(&ds->archive, ds->decoded);
+  if (ds->starved) {
+    ds->archive.pos = pos;
+    return 0;
+  }
+  if (!ok) {
+    ds->failed = 1;
+    return 0;
+  }
+  ds->inFrame = 0;
+  ds->finished = 1;
+  return 1;
+}
+
+// Decodes the next block. Returns 0 and leaves everything as it was if that needs more bytes than were pushed
+static int DS_DecodeBlock (DecompressorStream * ds) {
+  size_t pos = ds->archive.pos;
+  FrameDecoder decoder = ds->decoder;
+  DecompressorPredictor p = *ds->p;
+
+  ds->starved = 0;
+  int end;
+  int length = decodeFrameBlock(ds->p, &ds->decoder, ds->block, ds->remaining, &ds->archive, &end);
+  if (ds->starved) {
+    // The run buffer may have grown, and the lanes are only read once a run is all in
+    uint8_t* run = ds->decoder.run;
+    size_t runCapacity = ds->decoder.runCapacity;
+    ds->archive.pos = pos;
+    ds->decoder = decoder;
+    ds->decoder.run = run;
+    ds->decoder.runCapacity = runCapacity;
+    *ds->p = p;
+    return 0;
+  }
+
+  if (ds->remaining != UNKNOWN_SIZE) {
+    ds->remaining -= length;
+  }
+  ds->decoded += length;
+  ds->blockLength = length;
+  ds->blockPos = 0;
+  ds->lastBlock = end == BLOCK_LAST;
+  return 1;
+}
+
+// Gets the next decoded bytes ready. Returns 0 if there are none until more is pushed
+static int DS_Advance (DecompressorStream * ds) {
+  while (!ds->failed) {
+    if (!ds->inFrame) {
+      // Frames end on a byte, so a frame boundary is a good place to stop
+      if (ds->archive.pos == ds->archive.len || !DS_StartFrame(ds)) {
+        return 0;
+      }
+    } else if (ds->lastBlock) {
+      if (!DS_EndFrame(ds)) {
+        return 0;
+      }
+    } else {
+      return DS_DecodeBlock(ds);
+    }
+  }
+  return 0;
+}
+
+size_t DS_Pull (DecompressorStream * ds, uint8_t * output, size_t capacity) {
+  size_t written = 0;
+  while (written < capacity) {
+    if (ds->blockPos == ds->blockLength && !DS_Advance(ds)) {
+      break;
+    }
+    size_t n = ds->blockLength - ds->blockPos < capacity - written ? ds->blockLength - ds->blockPos : capacity - written;
+    memcpy(output + written, ds->block + ds->blockPos, n);
+    ds->blockPos += n;
+    written += n;
+  }
+  // Check the end marker as soon as it is in, so a finished stream reads as finished
+  if (ds->blockPos == ds->blockLength && ds->inFrame && ds->lastBlock) {
+    DS_EndFrame(ds);
+  }
+  return written;
+}
+
+int DS_Finished (DecompressorStream * ds) {
+  return ds->finished && !ds->failed && ds->blockPos == ds->blockLength && ds->archive.pos == ds->archive.len;
+}
+
+int DS_Failed (DecompressorStream * ds) {
+  return ds->failed;
+}
+
+void DS_Free (DecompressorStream * ds) {
+  BB_Free(&ds->archive);
+  freeFrameDecoder(&ds->decoder);
+}
@@ -14,9 +14,15 @@ void S_MO_EnumerateAllModels (ModelArray_t mos) {
   (*mos)[1] = text2;
 }
 
+void S_MO_FreeAllModels (ModelArray_t mos) {
+  for (int i = 0; i < NUM_MODELS; i++) {
+    free((*mos)[i]);
+  }
+  free(mos);
+}
+
 void MO_New (Model * m, int code) {
   m->code = code;
-  m->score = 0;
 
   // NOTE This is an enumeration of model by their code
   switch (code) {
@@ -0,0 +1,145 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "segmentindex.h"
+
+void SI_New (SegmentIndex * index) {
+  *index = (SegmentIndex) {
+    .capacity = 16,
+  };
+  index->points = malloc(index->capacity * sizeof(RestartPoint));
+}
+
+// Appends a point, leaving count alone
+static void SI_Append (SegmentIndex * index, uint64_t entry, RestartPoint point) {
+  if (entry == index->capacity) {
+    index->capacity *= 2;
+    index->points = realloc(index->points, index->capacity * sizeof(RestartPoint));
+  }
+  index->points[entry] = point;
+}
+
+void SI_AddFrame (SegmentIndex * index, uint64_t compressedOffset, uint64_t offset) {
+  SI_Append(index, index->count++, (RestartPoint) {
+    .compressedOffset = compressedOffset,
+    .offset = offset,
+    .frameStart = 1,
+  });
+}
+
+void SI_AddRestart (SegmentIndex * index, uint64_t compressedOffset, uint64_t offset, Coder * coder, context ctx, int modelCode) {
+  SI_Append(index, index->count++, (RestartPoint) {
+    .compressedOffset = compressedOffset,
+    .offset = offset,
+    .x1 = coder->x1,
+    .x2 = coder->x2,
+    .ctx = ctx,
+    .switchPrediction = coder->switchPrediction,
+    .modelCode = modelCode,
+  });
+}
+
+void SI_Merge (SegmentIndex * index, SegmentIndex * src, uint64_t compressedShift, uint64_t shift) {
+  for (uint64_t i = 0; i < src->count; i++) {
+    RestartPoint point = src->points[i];
+    point.compressedOffset += compressedShift;
+    point.offset += shift;
+    SI_Append(index, index->count++, point);
+  }
+}
+
+void SI_Write (SegmentIndex * index, ByteBuffer * archive, uint64_t compressedOffset, uint64_t offset) {
+  SI_Append(index, index->count, (RestartPoint) {
+    .compressedOffset = compressedOffset,
+    .offset = offset,
+    .frameStart = 1,
+  });
+
+  uint64_t length = 4 + 8 + 8 + INDEX_POINT_LENGTH * (index->count + 1) + INDEX_FOOTER_LENGTH;
+  BB_Write(archive, (const uint8_t *)INDEX_MAGIC, 4);
+  BB_PutUint64(archive, length);
+  BB_PutUint64(archive, index->count);
+  for (uint64_t i = 0; i <= index->count; i++) {
+    RestartPoint * point = &index->points[i];
+    BB_PutUint64(archive, point->compressedOffset);
+    BB_PutUint64(archive, point->offset);
+    BB_PutUint64(archive, (uint64_t)point->x2 << 32 | point->x1);
+    BB_PutByte(archive, point->ctx & 0xff);
+    BB_PutByte(archive, point->ctx >> 8);
+    BB_PutByte(archive, point->switchPrediction & 0xff);
+    BB_PutByte(archive, point->switchPrediction >> 8);
+    BB_PutByte(archive, point->modelCode);
+    BB_PutByte(archive, point->frameStart);
+  }
+  BB_PutUint64(archive, length);
+  BB_Write(archive, (const uint8_t *)INDEX_MAGIC, 4);
+}
+
+int SI_Read (SegmentIndex * index, const uint8_t * archive, size_t len) {
+  SI_New(index);
+  if (len < INDEX_FOOTER_LENGTH || memcmp(archive + len - 4, INDEX_MAGIC, 4) != 0) {
+    return 0;
+  }
+  ByteBuffer in;
+  BB_NewBorrowedReader(&in, archive + len - INDEX_FOOTER_LENGTH, 8);
+  uint64_t length;
+  if (!BB_GetUint64(&in, &length) || length < 4 + 8 + 8 + INDEX_POINT_LENGTH + INDEX_FOOTER_LENGTH || length > len ||
+      (length - 4 - 8 - 8 - INDEX_FOOTER_LENGTH) % INDEX_POINT_LENGTH != 0) {
+    return 0;
+  }
+
+  uint64_t start = len - length;
+  BB_NewBorrowedReader(&in, archive + start, length - INDEX_FOOTER_LENGTH);
+  uint8_t magic[4];
+  uint64_t headerLength;
+  uint64_t count;
+  if (BB_Read(&in, magic, 4) != 4 || memcmp(magic, INDEX_MAGIC, 4) != 0 || !BB_GetUint64(&in, &headerLength) ||
+      headerLength != length || !BB_GetUint64(&in, &count) ||
+      count != (length - 4 - 8 - 8 - INDEX_FOOTER_LENGTH) / INDEX_POINT_LENGTH - 1) {
+    return 0;
+  }
+  for (uint64_t i = 0; i <= count; i++) {
+    RestartPoint point;
+    uint64_t x;
+    BB_GetUint64(&in, &point.compressedOffset);
+    BB_GetUint64(&in, &point.offset);
+    BB_GetUint64(&in, &x);
+    point.x1 = x;
+    point.x2 = x >> 32;
+    point.ctx = BB_GetByte(&in);
+    point.ctx |= BB_GetByte(&in) << 8;
+    point.switchPrediction = BB_GetByte(&in);
+    point.switchPrediction |= BB_GetByte(&in) << 8;
+    point.modelCode = BB_GetByte(&in);
+    point.frameStart = BB_GetByte(&in);
+
+    // Points only go forward, and an index from the middle of concatenated archives does not cover the ones before
+    if ((i > 0 && (point.compressedOffset < index->points[i - 1].compressedOffset ||
+                   point.offset < index->points[i - 1].offset)) ||
+        (i == 0 && (point.compressedOffset != 0 || !point.frameStart)) ||
+        (i == count && (point.compressedOffset != start || !point.frameStart))) {
+      return 0;
+    }
+    SI_Append(index, i, point);
+  }
+  index->count = count;
+  return 1;
+}
+
+uint64_t SI_Find (SegmentIndex * index, uint64_t offset) {
+  uint64_t low = 0;
+  uint64_t high = index->count;
+  while (high - low > 1) {
+    uint64_t mid = low + (high - low) / 2;
+    if (index->points[mid].offset <= offset) {
+      low = mid;
+    } else {
+      high = mid;
+    }
+  }
+  return low;
+}
+
+void SI_Free (SegmentIndex * index) {
+  free(index->points);
+}
@@ -0,0 +1,45 @@
+#include <stdlib.h>
+#include <sched.h>
+
+#include "spscring.h"
+
+int SR_New (SpscRing * ring, size_t slotSize, size_t capacity) {
+  ring->slots = malloc(slotSize * capacity);
+  ring->slotSize = slotSize;
+  ring->capacity = capacity;
+  atomic_init(&ring->head, 0);
+  atomic_init(&ring->tail, 0);
+  return ring->slots != NULL;
+}
+
+// Head and tail only count up, the slot is the count modulo the capacity
+
+void * SR_Claim (SpscRing * ring) {
+  size_t tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+  while (tail - atomic_load_explicit(&ring->head, memory_order_acquire) == ring->capacity) {
+    sched_yield();
+  }
+  return ring->slots + (tail % ring->capacity) * ring->slotSize;
+}
+
+void SR_Publish (SpscRing * ring) {
+  size_t tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+  atomic_store_explicit(&ring->tail, tail + 1, memory_order_release);
+}
+
+void * SR_Peek (SpscRing * ring) {
+  size_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+  while (atomic_load_explicit(&ring->tail, memory_order_acquire) == head) {
+    sched_yield();
+  }
+  return ring->slots + (head % ring->capacity) * ring->slotSize;
+}
+
+void SR_Release (SpscRing * ring) {
+  size_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+  atomic_store_explicit(&ring->head, head + 1, memory_order_release);
+}
+
+void SR_Free (SpscRing * ring) {
+  free(ring->slots);
+}
@@ -0,0 +1,174 @@
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "threadpool.h"
+
+// The worker the calling thread is, if it is one
+static __thread TP_Worker * TP_Self;
+
+static void TP_Push (TP_Deque * deque, TP_Task task) {
+  pthread_mutex_lock(&deque->lock);
+  if (deque->count == deque->capacity) {
+    // Unwrap the ring into the front of a larger one
+    size_t capacity = deque->capacity * 2;
+    TP_Task * tasks = malloc(capacity * sizeof(TP_Task));
+    for (size_t i = 0; i < deque->count; i++) {
+      tasks[i] = deque->tasks[(deque->head + i) % deque->capacity];
+    }
+    free(deque->tasks);
+    deque->tasks = tasks;
+    deque->head = 0;
+    deque->capacity = capacity;
+  }
+  deque->tasks[(deque->head + deque->count) % deque->capacity] = task;
+  deque->count++;
+  pthread_mutex_unlock(&deque->lock);
+}
+
+// Takes the newest job from the back of the thread's own deque, or the oldest from the front of someone else's
+static int TP_Pop (TP_Deque * deque, int own, TP_Task * task) {
+  pthread_mutex_lock(&deque->lock);
+  int found = deque->count > 0;
+  if (found && own) {
+    *task = deque->tasks[(deque->head + deque->count - 1) % deque->capacity];
+  } else if (found) {
+    *task = deque->tasks[deque->head];
+    deque->head = (deque->head + 1) % deque->capacity;
+  }
+  deque->count -= found;
+  pthread_mutex_unlock(&deque->lock);
+  return found;
+}
+
+static int TP_Take (ThreadPool * pool, int self, TP_Task * task) {
+  for (int i = 0; i < pool->threadCount; i++) {
+    int victim = (self + i) % pool->threadCount;
+    if (TP_Pop(&pool->deques[victim], victim == self, task)) {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+static void * TP_Work (void * arg) {
+  TP_Worker * worker = arg;
+  ThreadPool * pool = worker->pool;
+  TP_Self = worker;
+  pthread_mutex_lock(&pool->lock);
+  while (1) {
+    while (pool->queued == 0 && !pool->stopping) {
+      pthread_cond_wait(&pool->ready, &pool->lock);
+    }
+    if (pool->queued == 0) {
+      break;
+    }
+    pthread_mutex_unlock(&pool->lock);
+
+    TP_Task task;
+    int found = TP_Take(pool, worker->index, &task);
+    pthread_mutex_lock(&pool->lock);
+    // Another thread may have got to the job first
+    if (!found) {
+      continue;
+    }
+    pool->queued--;
+    pthread_mutex_unlock(&pool->lock);
+
+    task.job(task.arg);
+
+    pthread_mutex_lock(&pool->lock);
+    if (--pool->pending == 0) {
+      pthread_cond_broadcast(&pool->idle);
+    }
+  }
+  pthread_mutex_unlock(&pool->lock);
+  return NULL;
+}
+
+int TP_DefaultThreads (void) {
+  long cores = sysconf(_SC_NPROCESSORS_ONLN);
+  return cores > 0 ? cores : 1;
+}
+
+int TP_New (ThreadPool * pool, int threadCount) {
+  *pool = (ThreadPool) {
+    .threads = malloc(threadCount * sizeof(pthread_t)),
+    .workers = malloc(threadCount * sizeof(TP_Worker)),
+    .deques = malloc(threadCount * sizeof(TP_Deque)),
+  };
+  for (int i = 0; i < threadCount; i++) {
+    pool->deques[i] = (TP_Deque) {
+      .capacity = 16,
+    };
+    pool->deques[i].tasks = malloc(pool->deques[i].capacity * sizeof(TP_Task));
+    pthread_mutex_init(&pool->deques[i].lock, NULL);
+    pool->workers[i] = (TP_Worker) {
+      .pool = pool,
+      .index = i,
+    };
+  }
+  pthread_mutex_init(&pool->lock, NULL);
+  pthread_cond_init(&pool->ready, NULL);
+  pthread_cond_init(&pool->idle, NULL);
+
+  // Make do with the threads that could be started. Workers only look at the deques of started threads
+  pthread_mutex_lock(&pool->lock);
+  int created = 0;
+  while (created < threadCount &&
+      pthread_create(&pool->threads[created], NULL, TP_Work, &pool->workers[created]) == 0) {
+    created++;
+  }
+  pool->threadCount = created;
+  pthread_mutex_unlock(&pool->lock);
+  for (int i = created; i < threadCount; i++) {
+    pthread_mutex_destroy(&pool->deques[i].lock);
+    free(pool->deques[i].tasks);
+  }
+  return pool->threadCount > 0;
+}
+
+void TP_Submit (ThreadPool * pool, TP_Job_t job, void * arg) {
+  // Pushed under the pool lock, so queued never counts a job that is not in a deque yet
+  pthread_mutex_lock(&pool->lock);
+  int deque;
+  if (TP_Self != NULL && TP_Self->pool == pool) {
+    deque = TP_Self->index;
+  } else {
+    deque = pool->nextDeque;
+    pool->nextDeque = (pool->nextDeque + 1) % pool->threadCount;
+  }
+  TP_Push(&pool->deques[deque], (TP_Task) { job, arg });
+  pool->queued++;
+  pool->pending++;
+  pthread_cond_signal(&pool->ready);
+  pthread_mutex_unlock(&pool->lock);
+}
+
+void TP_Wait (ThreadPool * pool) {
+  pthread_mutex_lock(&pool->lock);
+  while (pool->pending > 0) {
+    pthread_cond_wait(&pool->idle, &pool->lock);
+  }
+  pthread_mutex_unlock(&pool->lock);
+}
+
+void TP_Free (ThreadPool * pool) {
+  pthread_mutex_lock(&pool->lock);
+  pool->stopping = 1;
+  pthread_cond_broadcast(&pool->ready);
+  pthread_mutex_unlock(&pool->lock);
+  for (int i = 0; i < pool->threadCount; i++) {
+    pthread_join(pool->threads[i], NULL);
+  }
+
+  for (int i = 0; i < pool->threadCount; i++) {
+    pthread_mutex_destroy(&pool->deques[i].lock);
+    free(pool->deques[i].tasks);
+  }
+  pthread_mutex_destroy(&pool->lock);
+  pthread_cond_destroy(&pool->ready);
+  pthread_cond_destroy(&pool->idle);
+  free(pool->threads);
+  free(pool->workers);
+  free(pool->deques);
+}
@@ -4,11 +4,37 @@ int prediction (int cxt, int ct[512][2]) {
   return 4096*(ct[cxt][1]+1)/(ct[cxt][0]+ct[cxt][1]+2);
 }
 
-void flush (uint32_t* x1, uint32_t* x2, FILE* archive) {
-  while (((*x1^*x2)&0xff000000)==0) {
-    putc(*x2>>24, archive);
+void initCoder (Coder* coder) {
+  *coder = (Coder) {
+    .x2 = 0xffffffff,
+    .switchPrediction = SWITCH_PREDICTION,
+    .restart = 1,
+  };
+}
+
+// Writes all 4 bytes of x2. The decoder looks 4 bytes ahead, so it then reads exactly up to the end of the coded data
+// and never past it
+void flush (uint32_t* x1, uint32_t* x2, ByteBuffer* archive) {
+  for (int i=0; i<4; ++i) {
+    BB_PutByte(archive, *x2>>24);
     *x1<<=8;
     *x2=(*x2<<8)+255;
   }
-  putc(*x2>>24, archive);  // First unequal byte
+}
+
+int updateSwitchPrediction (int prediction, int switched) {
+  prediction += ((switched << PREDICTION_BITS) - prediction) >> SWITCH_RATE;
+  // Never let either side of the range collapse
+  if (prediction < 1024) prediction = 1024;
+  if (prediction > 64512) prediction = 64512;
+  return prediction;
+}
+
+// Bits needed to pick one of the models other than the current one
+int modelCodeBits (int modelCount) {
+  int bits = 0;
+  while ((1 << bits) < modelCount - 1) {
+    bits++;
+  }
+  return bits;
 }
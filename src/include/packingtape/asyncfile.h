@@ -0,0 +1,72 @@
+#ifndef ASYNCFILE_H_   /* Include guard */
+#define ASYNCFILE_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <pthread.h>
+#include <sys/types.h>
+
+// Reads ahead of or writes behind the coder with two blocks: the coder works on one while the other is read or
+// written. Regular files go through io_uring where the kernel has it, pipes and everything else through a thread of
+// their own. Either way at most one read or write is in flight, so pipes see their bytes in order
+typedef struct AsyncFile {
+  int fd;
+  int writing;
+  off_t offset; // Of the next read or write, -1 for pipes and other files without offsets
+  size_t blockSize;
+  uint8_t * blocks[2];
+  int current; // The block the coder has
+  int inFlight;
+  size_t requested; // Bytes of the other block being read or still to write
+  size_t done; // Bytes of it already written
+  int eof; // Set after the last read, whether it ended the file or failed
+  int failed;
+  int error; // errno of the read or write that failed
+  double idle; // Seconds the coder waited on the file
+
+  // io_uring
+  int ring; // -1 when the thread is used instead
+  void * sqRing;
+  size_t sqRingSize;
+  void * cqRing;
+  size_t cqRingSize;
+  void * sqes;
+  size_t sqesSize;
+  unsigned * sqTail;
+  unsigned * sqMask;
+  unsigned * sqArray;
+  unsigned * cqHead;
+  unsigned * cqTail;
+  unsigned * cqMask;
+  void * cqes;
+
+  // Thread fallback
+  int threaded;
+  pthread_t thread;
+  pthread_mutex_t lock;
+  pthread_cond_t requestReady;
+  pthread_cond_t resultReady;
+  int hasRequest;
+  int hasResult;
+  ssize_t result;
+  int stopping;
+} AsyncFile;
+
+// offset is where reading or writing starts, -1 for files without offsets. useUring 0 keeps to the thread. Returns 0
+// if neither could be set up
+int AF_Open (AsyncFile * af, int fd, off_t offset, int writing, size_t blockSize, int useUring);
+
+// The next block read from the file, and starts reading the one after it. len is 0 at the end of the file, and if the
+// read failed, which sets failed
+uint8_t * AF_Read (AsyncFile * af, size_t * len);
+
+// Starts writing len bytes of the block from the last call, or from AF_Open, and returns the block to fill next
+uint8_t * AF_Write (AsyncFile * af, size_t len);
+
+// Waits for the last write. Returns 0 with errno set if any write failed
+int AF_Flush (AsyncFile * af);
+
+// Stops the thread or ring and frees the blocks. Does not close fd
+void AF_Close (AsyncFile * af);
+
+#endif // ASYNCFILE_H_
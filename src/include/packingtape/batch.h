@@ -0,0 +1,19 @@
+#ifndef BATCH_H_   /* Include guard */
+#define BATCH_H_
+
+#include "compressorpredictor.h"
+#include "decompressorpredictor.h"
+
+// Archives in a tree are named after their file with this added
+#define ARCHIVE_SUFFIX ".pt"
+
+// Compresses every regular file under dir, other than archives, into an archive next to it, on a pool of threads.
+// Files larger than SEGMENT_SIZE are cut into segments that any thread can pick up, so the archives are the ones
+// compressParallel writes. The predictor's models are shared by all threads. Returns the number of files that failed
+int compressTree(const char* dir, CompressorPredictor* p, int threads);
+
+// Decompresses every archive under dir next to itself, without the suffix. Archives with an index are decoded a
+// frame per job. Returns the number of archives that failed
+int decompressTree(const char* dir, DecompressorPredictor* p, int threads);
+
+#endif // BATCH_H_
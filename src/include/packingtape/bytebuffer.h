@@ -0,0 +1,108 @@
+#ifndef BYTEBUFFER_H_   /* Include guard */
+#define BYTEBUFFER_H_
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <sys/types.h>
+
+#include "asyncfile.h"
+
+// Size of the blocks moved between a buffer and its file
+#define BB_BLOCK_SIZE (1 << 16)
+// Size of the window a mapped writer keeps mapped into the output file
+#define BB_MAP_WINDOW (1 << 26)
+
+typedef struct ByteBuffer ByteBuffer;
+
+// Drains a full writer or fills an empty reader. Returns 0 when no more bytes can be moved
+typedef int (*BB_Refill_t) (ByteBuffer * bb);
+
+struct ByteBuffer {
+  uint8_t * data;
+  size_t pos; // Next byte to read or write
+  size_t len; // Valid bytes in a reader, capacity of a writer
+  BB_Refill_t refill;
+  FILE * file;
+  int borrowed; // data belongs to the caller and is never freed
+  AsyncFile * async; // Reads ahead or writes behind the coder
+
+  // Mapped buffers only
+  int mapped;
+  int fd;
+  off_t offset; // File offset of data[0]
+  off_t reserved; // Bytes the output file has been grown to
+};
+
+void BB_NewWriter (ByteBuffer * bb, FILE * file);
+
+void BB_NewReader (ByteBuffer * bb, FILE * file);
+
+// Same as BB_NewWriter and BB_NewReader, but the file is written or read on the side while the coder works on the
+// next block. They turn into the plain ones if that cannot be set up
+void BB_NewAsyncWriter (ByteBuffer * bb, FILE * file);
+
+void BB_NewAsyncReader (ByteBuffer * bb, FILE * file);
+
+// Seconds an async buffer waited on its file, 0 for the others
+double BB_IdleSeconds (ByteBuffer * bb);
+
+// Maps all of a regular file. Returns 0 for anything else, or if it cannot be mapped
+int BB_NewMappedReader (ByteBuffer * bb, int fd);
+
+// Writes to fd from offset on through windows mapped into it. The file is grown to sizeHint bytes past offset up front
+// and the first window only spans that much, the ones after it take BB_MAP_WINDOW at a time. If one of them cannot be
+// mapped the bytes past it are dropped and BB_Flush fails. Returns 0 if the first cannot be mapped
+int BB_NewMappedWriter (ByteBuffer * bb, int fd, off_t offset, off_t sizeHint);
+
+// A writer over memory that grows as needed
+void BB_NewGrowingWriter (ByteBuffer * bb, size_t capacity);
+
+// A reader over len bytes of malloced data. The buffer takes ownership of data
+void BB_NewMemoryReader (ByteBuffer * bb, uint8_t * data, size_t len);
+
+// A reader over len bytes of the caller's memory
+void BB_NewBorrowedReader (ByteBuffer * bb, const uint8_t * data, size_t len);
+
+// A writer into capacity bytes of the caller's memory. Bytes past the end are counted but dropped, BB_Tell still
+// reports the full size and BB_Flush fails
+void BB_NewFixedWriter (ByteBuffer * bb, uint8_t * data, size_t capacity);
+
+void BB_Write (ByteBuffer * bb, const uint8_t * data, size_t len);
+
+size_t BB_Read (ByteBuffer * bb, uint8_t * data, size_t len);
+
+void BB_PutUint64 (ByteBuffer * bb, uint64_t n);
+
+int BB_GetUint64 (ByteBuffer * bb, uint64_t * n);
+
+void BB_PutUint32 (ByteBuffer * bb, uint32_t n);
+
+int BB_GetUint32 (ByteBuffer * bb, uint32_t * n);
+
+off_t BB_Tell (ByteBuffer * bb);
+
+// Whether a reader stopped on an error rather than at the end of its file. Sets errno to it where it is known
+int BB_Failed (ByteBuffer * bb);
+
+int BB_Flush (ByteBuffer * bb);
+
+void BB_Free (ByteBuffer * bb);
+
+// The coder calls these once per byte, so they are inlined into it
+
+static inline void BB_PutByte (ByteBuffer * bb, int c) {
+  if (bb->pos == bb->len) {
+    bb->refill(bb);
+  }
+  bb->data[bb->pos++] = (uint8_t)c;
+}
+
+static inline int BB_GetByte (ByteBuffer * bb) {
+  if (bb->pos == bb->len && !bb->refill(bb)) {
+    return EOF;
+  }
+  return bb->data[bb->pos++];
+}
+
+#endif // BYTEBUFFER_H_
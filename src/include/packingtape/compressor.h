@@ -2,9 +2,83 @@
 #define COMPRESSOR_H_
 
 #include <stdio.h>
+#include <stdint.h>
 
 #include "compressorpredictor.h"
+#include "segmentindex.h"
 
-void compress(FILE* input, FILE* output, CompressorPredictor* p);
+// contentSize is UNKNOWN_SIZE when the frame has its size in the end marker only. layout is one of FRAME_LAYOUTS or 0
+// for a plain frame
+void writeHeader(ByteBuffer* archive, int startingCode, uint64_t contentSize, int layout);
+
+void writeFrameEnd(ByteBuffer* archive, uint64_t contentSize);
+
+// Codes one block of length bytes and carries the coder over to the next one. end is one of the BLOCK_ endings, a
+// block that is not BLOCK_MORE flushes the coder, as a stored one does. sized says whether the header has the content
+// size, otherwise the block codes how it ends
+void encodeBlock(CompressorPredictor* p, Coder* coder, const uint8_t* block, int length, int end, int sized, ByteBuffer* archive);
+
+// Codes contentSize bytes of in, or all of it for UNKNOWN_SIZE, as one frame that starts from a fresh context. With an
+// index, it gets the frame's restart points at archive positions and offsets into the frame. Returns the bytes coded
+uint64_t compressFrame(CompressorPredictor* p, ByteBuffer* in, ByteBuffer* archive, uint64_t contentSize, SegmentIndex* index);
+
+// Makes a single forward pass over both files, so they can be pipes, and closes them. Returns 0 if output cannot be
+// written. So do the others that take files
+int compress(FILE* input, FILE* output, CompressorPredictor* p);
+
+// Same as compress, but reads and writes through memory maps. Both files have to be regular files
+int compressMapped(FILE* input, FILE* output, CompressorPredictor* p);
+
+// Blocks the predictor of compressPipelined can run ahead of the coder
+#define PIPELINE_BLOCKS 64
+
+// Same as compress and writes the same archive, but predicts on one thread and codes on another. Unlike
+// compressParallel the whole input stays one frame, so nothing is lost to starting over
+int compressPipelined(FILE* input, FILE* output, CompressorPredictor* p);
+
+// Same as compress, but writes an interleaved frame, which decodes faster on one thread. Older versions cannot decode it
+int compressInterleaved(FILE* input, FILE* output, CompressorPredictor* p);
+
+// Same as compress, but writes a ranged frame, which codes smaller and decodes faster. Older versions cannot
+// decode it
+int compressRanged(FILE* input, FILE* output, CompressorPredictor* p);
+
+// Same as compress, but writes a rANS frame, which decodes faster still. Older versions cannot decode it
+int compressRans(FILE* input, FILE* output, CompressorPredictor* p);
+
+// Same as compress, but writes a byte frame, which codes every byte in one step with the byte model rather than bit by
+// bit with the models of p. Several times faster both ways, though the byte model only knows the byte before. Older
+// versions cannot decode it
+int compressBytes(FILE* input, FILE* output, CompressorPredictor* p);
+
+// Same as compress, and decodes the same way, but codes every block with the model that turns out cheapest for it
+// rather than the one that did best on the blocks before. All the models are tried on every block, on threads threads
+int compressTrial(FILE* input, FILE* output, CompressorPredictor* p, int threads);
+
+// Input coded by one thread of compressParallel
+#define SEGMENT_SIZE (1 << 20)
+
+// Cuts the input into segments of SEGMENT_SIZE and compresses each into a frame of its own on a pool of threads. The
+// frames are written in order and followed by an index of where each starts, so the archive decodes like any other
+// and also in parallel. Works on pipes too
+int compressParallel(FILE* input, FILE* output, CompressorPredictor* p, int threads);
+
+// Compresses length bytes of a regular file from offset on into an archive of its own, with an index, as one shard of
+// a larger input. Any number of processes or machines can each compress a shard, and mergeShards puts them together.
+// Returns 0 if input cannot seek or output cannot be written
+int compressShard(FILE* input, FILE* output, uint64_t offset, uint64_t length, CompressorPredictor* p);
+
+// Writes the frames of the count archives at paths to output, in that order, followed by one index of them all. The
+// archives need an index of their own, as compressShard and compressParallel write. Returns 0 if one of them has none
+// or cannot be read, output is then incomplete
+int mergeShards(const char** paths, int count, FILE* output);
+
+// Largest archive compressBuffer can write for inputSize bytes, and the capacity it never fails with
+size_t compressBound(size_t inputSize);
+
+// Compresses inputSize bytes of input into output, which has room for outputCapacity bytes. Returns 0 if the archive
+// does not fit, outputSize is then the capacity it would have needed
+int compressBuffer(const uint8_t* input, size_t inputSize, uint8_t* output, size_t outputCapacity, size_t* outputSize,
+    CompressorPredictor* p);
 
 #endif // COMPRESSOR_H_
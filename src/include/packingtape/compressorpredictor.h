@@ -11,10 +11,15 @@ typedef struct CompressorPredictor {
   Model * currentModel;
 
   int predictionCount;
+  // How well each model, by its index in models, has been predicting lately, and what it predicted for the last bit
+  float scores[MAX_MODELS];
+  int lastPredictions[MAX_MODELS];
 } CompressorPredictor;
 
 void CP_New (CompressorPredictor * cp, ModelArray_t mos, int modelCount, context ctx);
 
+void CP_Reset (CompressorPredictor * cp);
+
 int CP_Predict (CompressorPredictor * cp);
 
 void CP_Update (CompressorPredictor * cp, int bit);
@@ -0,0 +1,42 @@
+#ifndef COMPRESSORSTREAM_H_   /* Include guard */
+#define COMPRESSORSTREAM_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "compressorpredictor.h"
+#include "bytebuffer.h"
+
+// Compresses a stream handed over in chunks of any size. Coded bytes can be pulled as soon as the coder lets go of
+// them, so nothing has to hold the whole input. The stream is one frame, the same one compress writes for a pipe
+typedef struct CompressorStream {
+  CompressorPredictor * p;
+  Coder coder;
+  ByteBuffer archive; // Coded bytes that have not been pulled yet
+  size_t pulled;
+
+  uint8_t block[CHANGE_INTERVAL]; // Pushed bytes waiting for their block to fill up
+  int blockLength;
+  uint64_t pushed;
+  uint64_t flushedBlockCount; // Blocks coded up to the last flush
+  int finished;
+} CompressorStream;
+
+void CS_New (CompressorStream * cs, CompressorPredictor * p);
+
+// Codes every full block of the pushed bytes and keeps the rest for the next push
+void CS_Push (CompressorStream * cs, const uint8_t * data, size_t len);
+
+// Codes what is left as a short block and ends the coder's interval, so everything pushed so far can be pulled and
+// decoded right away. The predictor keeps its context and model scores, only the coder starts over
+void CS_Flush (CompressorStream * cs);
+
+// Codes what is left as the last block. Nothing can be pushed after it
+void CS_Finish (CompressorStream * cs);
+
+// Moves up to capacity coded bytes into output and returns how many it moved
+size_t CS_Pull (CompressorStream * cs, uint8_t * output, size_t capacity);
+
+void CS_Free (CompressorStream * cs);
+
+#endif // COMPRESSORSTREAM_H_
@@ -2,9 +2,62 @@
 #define DECOMPRESSOR_H_
 
 #include <stdio.h>
+#include <stdint.h>
 
 #include "decompressorpredictor.h"
+#include "util.h"
 
-void decompress(FILE* input, FILE* output, DecompressorPredictor* p);
+// Returns 1 for a frame this version can decode, 0 if input ends before the frame starts and -1 for anything else
+int readHeader(ByteBuffer* input, FrameHeader* header);
+
+// Whether input continues with an end marker for decoded bytes
+int readFrameEnd(ByteBuffer* input, uint64_t decoded);
+
+void startDecoder(Coder* coder, ByteBuffer* archive);
+
+// Decodes one block into block, which has room for CHANGE_INTERVAL bytes, and returns its length. remaining is the
+// size still to decode or UNKNOWN_SIZE. end is set to one of the BLOCK_ endings
+int decodeBlock(DecompressorPredictor* p, Coder* coder, uint8_t* block, uint64_t remaining, ByteBuffer* archive, int* end);
+
+// Sets decoder up for a frame with the flags of its header. Keeps the run buffer of the frame before
+void initFrameDecoder(FrameDecoder* decoder, int flags);
+
+// Same as decodeBlock, for frames of either layout
+int decodeFrameBlock(DecompressorPredictor* p, FrameDecoder* decoder, uint8_t* block, uint64_t remaining,
+    ByteBuffer* archive, int* end);
+
+void freeFrameDecoder(FrameDecoder* decoder);
+
+// Decodes every frame in archive into out, writing at most limit bytes. Returns 0 for anything but whole frames that
+// decode to what their end markers say
+int decompressFrames(DecompressorPredictor* p, ByteBuffer* archive, ByteBuffer* out, uint64_t limit);
+
+// Decodes every frame of input into output in one forward pass, so they can be pipes, and closes them. Returns 0 if
+// input is not a whole archive or output cannot be written. So do the others that take files
+int decompress(FILE* input, FILE* output, DecompressorPredictor* p);
+
+// Same as decompress, but reads and writes through memory maps. Both files have to be regular files
+int decompressMapped(FILE* input, FILE* output, DecompressorPredictor* p);
+
+// Decodes the segments of an archive compressParallel wrote on a pool of threads, each straight to its place in the
+// output. Both files have to be regular files. Archives without an index go to decompressMapped
+int decompressParallel(FILE* input, FILE* output, DecompressorPredictor* p, int threads);
+
+// Decodes length bytes from offset on, starting from the closest restart point in the archive's index rather than
+// from the start. Ranges that run past the end of the data are cut short. The input has to be a regular file
+int decompressRange(FILE* input, FILE* output, uint64_t offset, uint64_t length, DecompressorPredictor* p);
+
+// Same as decompressRange, into output, which has room for length bytes. Returns 0 if the archive is damaged
+int decompressRangeBuffer(const uint8_t* input, size_t inputSize, uint64_t offset, uint64_t length, uint8_t* output,
+    size_t* outputSize, DecompressorPredictor* p);
+
+// Size of the data in the first frame of an archive, UNKNOWN_SIZE if it was compressed from a pipe or is not an
+// archive. Concatenated frames only tell their sizes as they are decoded
+uint64_t decompressedSize(const uint8_t* input, size_t inputSize);
+
+// Decompresses every frame in input into output, which has room for outputCapacity bytes. Returns 0 if the data does
+// not fit or the archive is damaged
+int decompressBuffer(const uint8_t* input, size_t inputSize, uint8_t* output, size_t outputCapacity, size_t* outputSize,
+    DecompressorPredictor* p);
 
 #endif // DECOMPRESSOR_H_
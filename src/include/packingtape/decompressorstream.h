@@ -0,0 +1,48 @@
+#ifndef DECOMPRESSORSTREAM_H_   /* Include guard */
+#define DECOMPRESSORSTREAM_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "decompressorpredictor.h"
+#include "bytebuffer.h"
+#include "util.h"
+
+// Decompresses an archive handed over in chunks of any size. A block is decoded as soon as all of its bytes are in,
+// one that runs past the pushed bytes is rolled back and tried again after the next push. Frames pushed one after
+// the other decode as one stream
+typedef struct DecompressorStream {
+  ByteBuffer archive; // Pushed bytes that have not been decoded yet. First, so its refill can find the stream
+  size_t capacity;
+  int starved; // The last block ran past the pushed bytes
+
+  DecompressorPredictor * p;
+  FrameDecoder decoder;
+  int inFrame; // Between the header and the end marker of a frame
+  int lastBlock; // The frame's last block is decoded, its end marker is next
+  int finished; // Every pushed frame is decoded
+  int failed; // Not an archive, or a damaged one
+  uint64_t remaining;
+  uint64_t decoded; // In the current frame
+
+  uint8_t block[CHANGE_INTERVAL]; // Decoded bytes that have not been pulled yet
+  int blockLength;
+  int blockPos;
+} DecompressorStream;
+
+void DS_New (DecompressorStream * ds, DecompressorPredictor * p);
+
+void DS_Push (DecompressorStream * ds, const uint8_t * data, size_t len);
+
+// Decodes as much of the pushed archive as it can into output and returns how many bytes it wrote
+size_t DS_Pull (DecompressorStream * ds, uint8_t * output, size_t capacity);
+
+// Whether every frame pushed so far has been decoded and pulled
+int DS_Finished (DecompressorStream * ds);
+
+// Whether the pushed bytes are not an archive this build can decode, or a damaged one
+int DS_Failed (DecompressorStream * ds);
+
+void DS_Free (DecompressorStream * ds);
+
+#endif // DECOMPRESSORSTREAM_H_
@@ -4,22 +4,29 @@
 #include <stdint.h>
 #include "util.h"
 
-#define MODEL_LIMIT 4095
-#define NUM_CONTEXTS UINT16_MAX
+#define MODEL_LIMIT ((1 << PREDICTION_BITS) - 1)
+#define NUM_CONTEXTS (UINT16_MAX + 1)
+// Model codes are a byte in the frame header
+#define MAX_MODELS 256
 
-typedef int ModelData_t[NUM_CONTEXTS];
+typedef uint16_t ModelData_t[NUM_CONTEXTS];
 
+// A byte model has where the slots of every byte start after each byte before it, at [before << 8 | byte]
+typedef uint16_t ByteModelData_t[NUM_CONTEXTS];
+
+// Models only hold their tables, so one set of them can be shared by any number of predictors and threads
 typedef struct Model {
   int code;
   const ModelData_t * data;
-  int lastPrediction;
-  float score;
 } Model;
 
 typedef Model * (*ModelArray_t)[2]; // A pointer to an array that contains pointers to Models
 
 void S_MO_EnumerateAllModels (ModelArray_t mos);
 
+// Frees the models and the array S_MO_EnumerateAllModels filled
+void S_MO_FreeAllModels (ModelArray_t mos);
+
 void MO_New (Model * m, int code);
 
 void MO_SetData (Model * m, const ModelData_t * data);
@@ -4,6 +4,7 @@
 #include "model.h"
 #include "models/TEXT1.h"
 #include "models/TEXT2.h"
+#include "models/BYTE1.h"
 
 // NOTE This is an enumeration of all available models
 // Constants correspond to that model's index in the enumerated array of models
@@ -24,4 +25,7 @@ static const ModelData_t TEXT2_Data = TEXT2_Data_d;
   //600, 95, 1000, 450, 111, 400, 400, 400, 400, 600, 200, 300, 300, 400, 400, 600, 200, 300, 300, 400, 400, 4000, 200, 300
 //};
 
+// Byte frames code every byte with this one, whatever the model in their header
+static const ByteModelData_t BYTE1_Data = BYTE1_Data_d;
+
 #endif // MODELENUM_H_
@@ -1,6 +1,6 @@
 #ifndef TEXT1_H_   /* Include guard */
 #define TEXT1_H_
 
-#define TEXT1_Data_d {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 1365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 372, 0, 1023, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 400, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1170, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 4095, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1724, 0, 4095, 0, 4095, 0, 0, 0, 1791, 0, 0, 0, 4095, 0, 0, 0, 3780, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 558, 1489, 2457, 0, 1638, 2047, 0, 1116, 0, 3071, 0, 0, 0, 0, 0, 1755, 0, 4095, 0, 0, 0, 0, 0, 1365, 0, 819, 0, 0, 0, 0, 0, 1365, 4021, 2109, 0, 4095, 0, 4095, 0, 2340, 0, 3663, 0, 0, 0, 0, 0, 2047, 0, 2730, 0, 0, 0, 0, 0, 1023, 4095, 1365, 0, 0, 0, 0, 0, 2730, 819, 0, 0, 0, 0, 4095, 0, 1023, 4095, 0, 0, 0, 0, 0, 0, 1638, 3412, 1170, 0, 0, 0, 0, 0, 1023, 0, 0, 0, 0, 0, 0, 0, 585, 0, 1023, 0, 0, 0, 0, 0, 2457, 0, 877, 0, 0, 0, 0, 0, 0, 4095, 1365, 0, 0, 0, 0, 0, 0, 0, 1023, 0, 0, 0, 0, 0, 0, 2317, 1365, 2047, 3583, 1001, 1638, 0, 0, 4095, 2047, 0, 0, 0, 0, 0, 0, 4055, 2077, 2047, 0, 0, 3695, 0, 0, 0, 3372, 0, 0, 0, 0, 4095, 2730, 1102, 3071, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 1023, 3372, 0, 0, 1755, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 195, 2730, 3217, 1654, 135, 0, 2047, 0, 511, 0, 0, 0, 0, 0, 4095, 895, 1535, 0, 4095, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1365, 682, 0, 0, 1535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 2730, 0, 0, 0, 0, 0, 0, 1924, 3424, 0, 4095, 0, 3753, 0, 1495, 4095, 2419, 0, 0, 0, 0, 0, 2275, 3560, 1745, 0, 0, 0, 0, 0, 1906, 4095, 1365, 0, 0, 0, 0, 0, 2505, 4095, 726, 0, 0, 0, 0, 0, 1820, 4095, 3924, 0, 0, 0, 0, 0, 2357, 4095, 2245, 0, 0, 0, 0, 0, 1675, 0, 910, 0, 0, 0, 0, 0, 1608, 4095, 2535, 0, 4095, 0, 4095, 0, 1881, 4095, 658, 0, 0, 0, 0, 0, 1116, 4095, 3685, 0, 0, 0, 0, 0, 1279, 0, 455, 0, 0, 0, 0, 0, 303, 4095, 323, 0, 0, 0, 0, 0, 585, 0, 431, 0, 0, 0, 0, 0, 2205, 0, 1824, 0, 0, 0, 0, 0, 1535, 4095, 1146, 0, 0, 0, 0, 0, 0, 4095, 1801, 0, 0, 0, 0, 0, 819, 0, 4095, 0, 0, 0, 0, 0, 1936, 4095, 1602, 0, 0, 0, 0, 0, 2426, 0, 2412, 0, 0, 0, 0, 0, 1876, 2900, 594, 0, 0, 292, 0, 0, 1260, 4095, 2047, 0, 0, 0, 0, 0, 2605, 4095, 163, 0, 0, 1706, 0, 0, 227, 0, 285, 0, 0, 0, 0, 0, 585, 0, 819, 0, 0, 4095, 0, 0, 910, 0, 682, 0, 0, 0, 0, 0, 1023, 945, 3818, 4095, 4095, 568, 744, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 2730, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 341, 0, 4095, 682, 3640, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1638, 1170, 1023, 2047, 2047, 0, 0, 2362, 2275, 2866, 4095, 0, 0, 3583, 4095, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 3926, 4095, 0, 0, 0, 2145, 1310, 3071, 0, 0, 0, 4095, 4095, 0, 0, 1116, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 248, 1797, 0, 1717, 1077, 2293, 2559, 3445, 2191, 2644, 2197, 2047, 0, 0, 4095, 4095, 0, 0, 0, 163, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 4095, 3412, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 4095, 4095, 1023, 3150, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 3071, 4095, 0, 0, 2866, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 4095, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 4095, 0, 4095, 4095, 4095, 0, 2730, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 4095, 4095, 0, 1489, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 2047, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 2559, 585, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 195, 494, 682, 1842, 2047, 4095, 4095, 1508, 2556, 3055, 2877, 0, 564, 0, 3276, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 2925, 2940, 105, 801, 819, 4095, 0, 3372, 1365, 0, 1638, 1054, 4095, 0, 4095, 0, 0, 0, 2730, 1755, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 390, 3510, 2457, 3640, 0, 4095, 0, 0, 2730, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 3867, 0, 0, 0, 0, 3185, 2047, 4095, 0, 0, 0, 4095, 0, 4095, 0, 3071, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 963, 4095, 585, 0, 2925, 2388, 0, 1861, 2128, 1960, 2286, 0, 0, 0, 4095, 4095, 4095, 0, 2925, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 4095, 910, 2047, 0, 0, 0, 4095, 1638, 3276, 3480, 0, 0, 4095, 0, 0, 0, 0, 255, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 1023, 819, 0, 0, 4095, 0, 0, 1174, 2917, 1338, 0, 4095, 4095, 3615, 4095, 0, 4095, 4095, 4095, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 2047, 409, 0, 4095, 0, 0, 0, 4095, 4095, 0, 3071, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 2852, 409, 3342, 0, 0, 0, 4095, 1365, 0, 0, 4095, 0, 0, 2800, 4095, 0, 4095, 1451, 404, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3259, 4095, 1638, 2896, 898, 3045, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 3327, 4095, 0, 4095, 3011, 3372, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3465, 4095, 0, 1365, 961, 2233, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 3245, 4095, 455, 3978, 3649, 1489, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2632, 4095, 0, 4095, 2925, 315, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 2340, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 3854, 4095, 0, 1638, 215, 1260, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 3378, 4095, 0, 4095, 3071, 1592, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 2559, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3931, 4095, 0, 4095, 1666, 3960, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 2925, 4095, 0, 0, 2388, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3549, 4095, 0, 0, 1096, 819, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 3276, 4095, 0, 4095, 3385, 71, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 4095, 2367, 1939, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3760, 4095, 0, 4095, 2893, 4095, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 3350, 4095, 0, 4095, 1116, 285, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2832, 4095, 0, 2293, 3735, 2155, 0, 0, 4095, 0, 3488, 1023, 3622, 0, 0, 0, 4095, 4095, 0, 4095, 2340, 25, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 1755, 0, 744, 2047, 0, 0, 0, 2047, 4095, 2434, 2167, 2646, 0, 0, 0, 3974, 4095, 0, 0, 3685, 1365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 409, 3510, 0, 4095, 1170, 2730, 0, 0, 0, 0, 2047, 682, 4095, 0, 0, 0, 2925, 4095, 0, 0, 1638, 585, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 1489, 431, 4042, 2047, 4095, 0, 0, 2871, 3071, 2808, 0, 4095, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 264, 3839, 4095, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 4095, 4095, 0, 0, 877, 2233, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 682, 1365, 126, 0, 4095, 0, 0, 3071, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 1061, 0, 409, 0, 156, 4095, 4095, 2047, 455, 1023, 4095, 2047, 2047, 0, 2047, 0, 1714, 1253, 682, 2437, 3372, 2047, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 3071, 0, 0, 0, 0, 0, 4095, 819, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1820, 0, 2730, 0, 0, 255, 0, 0, 0, 1365, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 2520, 1424, 2218, 3802, 3071, 646, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 3071, 2730, 0, 0, 0, 511, 4095, 1638, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1365, 0, 0, 0, 0, 0, 2209, 3071, 1638, 419, 890, 0, 3964, 287, 3017, 558, 327, 383, 4095, 0, 3071, 859, 2334, 2363, 499, 2325, 2569, 591, 1316, 292, 0, 4095, 0, 0, 4095, 2047, 0, 1023, 0, 0, 4095, 0, 4095, 4095, 2970, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 0, 2047, 0, 0, 0, 4095, 4095, 819, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 682, 0, 0, 0, 4095, 0, 0, 0, 1023, 2047, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 910, 0, 1365, 0, 3412, 0, 1061, 255, 1061, 1023, 4095, 4095, 682, 0, 511, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 442, 3753, 885, 0, 2730, 0, 3412, 4095, 973, 409, 3923, 819, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 438, 4095, 0, 4095, 0, 0, 0, 0, 0, 4095, 763, 0, 2730, 0, 0, 0, 0, 3276, 1608, 2730, 0, 0, 0, 0, 0, 2730, 1618, 0, 0, 0, 0, 0, 2047, 0, 0, 4095, 0, 0, 0, 0, 432, 4095, 4095, 0, 2730, 0, 0, 4095, 2918, 0, 4095, 4095, 455, 4095, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 0, 0, 1077, 0, 3071, 0, 3465, 0, 0, 1023, 1365, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3412, 3465, 1023, 0, 4095, 0, 4095, 4095, 4095, 2047, 0, 1585, 0, 4095, 0, 0, 0, 0, 0, 1424, 4095, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 3452, 2578, 1969, 3432, 4095, 0, 0, 0, 2457, 0, 1365, 4095, 0, 0, 0, 0, 1638, 0, 868, 0, 0, 0, 0, 0, 0, 0, 0, 0, 273, 0, 4095, 3962, 4095, 0, 3822, 511, 3071, 0, 4095, 1638, 1638, 2047, 481, 1365, 2605, 3854, 1092, 1627, 995, 356, 3393, 3026, 412, 3534, 0, 0, 372, 0, 0, 4095, 2340, 0, 4095, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3071, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 2218, 3787, 720, 659, 4095, 4095, 4095, 2644, 0, 1023, 0, 4095, 0, 0, 4095, 0, 2730, 1638, 372, 0, 4095, 2605, 4095, 0, 0, 0, 2047, 0, 0, 1365, 0, 4095, 4095, 0, 0, 1365, 4095, 0, 4095, 682, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1638, 0, 0, 1365, 0, 4095, 0, 3753, 2388, 4095, 4095, 4095, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 2730, 3412, 0, 0, 0, 0, 0, 0, 0, 1228, 4095, 0, 3071, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 0, 0, 2559, 0, 0, 4095, 0, 3038, 0, 614, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2730, 2457, 0, 982, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 819, 0, 4095, 0, 1011, 4095, 4095, 4095, 682, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 2730, 1023, 0, 3071, 819, 0, 4095, 0, 3510, 2047, 2303, 858, 2340, 2047, 2866, 4095, 2710, 1209, 488, 1577, 2997, 764, 1820, 0, 0, 963, 2730, 638, 0, 240, 0, 4095, 0, 292, 4095, 3071, 4095, 4095, 4095, 0, 0, 682, 0, 4095, 0, 0, 0, 0, 0, 630, 585, 108, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2632, 0, 4095, 157, 0, 4095, 201, 113, 1755, 0, 1023, 0, 0, 0, 0, 4095, 1755, 0, 0, 3412, 3510, 0, 2457, 4095, 639, 0, 0, 0, 1412, 1338, 1974, 0, 0, 240, 4095, 2047, 682, 0, 907, 1901, 4095, 3276, 0, 0, 208, 0, 472, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 1302, 585, 3676, 4095, 0, 0, 0, 3412, 0, 2047, 4095, 2866, 0, 3412, 0, 4095, 17, 1560, 1235, 3276, 0, 0, 2925, 2841, 1646, 596, 2397, 2455, 426, 0, 0, 0, 83, 1365, 865, 3780, 1973, 0, 2658, 0, 0, 4095, 1127, 0, 0, 0, 4095, 0, 0, 4095, 210, 0, 0, 0, 0, 0, 0, 0, 682, 0, 0, 0, 0, 0, 1023, 3572, 264, 0, 0, 0, 0, 2047, 727, 431, 2357, 1228, 0, 4095, 3276, 0, 0, 0, 0, 0, 0, 0, 1890, 1638, 4095, 630, 2047, 3276, 0, 0, 0, 0, 0, 0, 3340, 0, 0, 0, 0, 0, 178, 4095, 2677, 4095, 0, 2925, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 321, 4095, 93, 159, 682, 0, 3822, 1160, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1706, 1984, 0, 3871, 0, 0, 0, 0, 2499, 4095, 514, 3780, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2233, 2067, 0, 3890, 2457, 3276, 107, 1852, 2218, 2866, 2520, 1287, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3071, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1023, 1906, 0, 3890, 0, 0, 0, 0, 3295, 3185, 4095, 3071, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1170, 1553, 0, 3802, 1365, 0, 0, 546, 1074, 2593, 2047, 3583, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 2730, 0, 0, 0, 0, 0, 0, 0, 3412, 0, 0, 2590, 2314, 0, 3186, 4095, 4095, 0, 603, 1058, 3409, 400, 3372, 4095, 2047, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1623, 0, 4095, 1023, 0, 0, 1686, 1293, 3003, 4030, 3510, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1462, 0, 3890, 0, 4095, 0, 0, 1755, 4095, 4095, 4095, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 2431, 0, 4095, 0, 0, 0, 0, 1780, 2730, 2492, 682, 0, 2730, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 1365, 0, 0, 2457, 1786, 0, 3924, 0, 0, 0, 0, 3685, 4095, 27, 2957, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 341, 0, 3510, 0, 0, 0, 2275, 0, 3412, 1638, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 3276, 4095, 4095, 4095, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 2047, 3552, 0, 4095, 0, 0, 0, 1023, 1106, 532, 4095, 138, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 2730, 853, 0, 4095, 0, 0, 0, 0, 3185, 4095, 3276, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 2890, 2091, 0, 3815, 0, 4095, 0, 0, 3530, 4095, 4025, 4095, 4095, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 2047, 0, 3951, 0, 0, 0, 0, 2801, 2965, 562, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1023, 1096, 0, 4095, 0, 4095, 0, 682, 2275, 4063, 639, 1489, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 819, 0, 4095, 0, 0, 0, 0, 2047, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1260, 2356, 0, 3727, 4095, 0, 0, 1755, 4068, 3972, 4095, 2649, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1365, 2293, 0, 3142, 0, 0, 0, 455, 2632, 910, 4095, 3071, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1134, 2218, 0, 3205, 1350, 4095, 120, 1217, 3012, 182, 1820, 1706, 2047, 4095, 0, 2047, 0, 1365, 4095, 0, 2784, 3372, 722, 3603, 3640, 695, 3640, 0, 0, 0, 0, 0, 4095, 1478, 0, 3327, 0, 0, 0, 0, 1489, 4095, 1062, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 963, 0, 3276, 1365, 0, 1861, 0, 234, 4095, 4095, 4095, 0, 0, 0, 0, 0, 4095, 0, 4095, 3142, 2171, 227, 3302, 3931, 2537, 0, 0, 0, 0, 0, 0, 4095, 3437, 0, 2047, 0, 0, 0, 0, 1023, 95, 2047, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 744, 0, 1638, 0, 0, 0, 4095, 2730, 4095, 4095, 1638, 0, 0, 0, 0, 4095, 4095, 4095, 0, 2047, 2047, 682, 3583, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 910, 0, 3412, 0, 0, 0, 0, 4095, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 409, 0, 2730, 2165, 3412, 455, 3663, 315, 1365, 4095, 23, 1535, 819, 3185, 910, 910, 0, 3879, 2047, 2027, 2507, 712, 3131, 3372, 1279, 3523, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 2136, 1890, 2233, 3780, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 3412, 0, 4095, 0, 323, 4095, 2047, 3378, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2472, 0, 0, 0, 0, 0, 0, 3071, 2730, 1365, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3622, 0, 0, 2457, 1638, 0, 4095, 0, 4095, 0, 0, 0, 4095, 0, 2047, 0, 2730, 1365, 0, 3890, 2047, 819, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 722, 0, 4095, 0, 601, 0, 4095, 0, 0, 4095, 819, 0, 2252, 2205, 2419, 2233, 2978, 1023, 2682, 1575, 1023, 2730, 1170, 1638, 2730, 1365, 0, 4095, 4095, 2164, 3038, 913, 3271, 2149, 1738, 940, 895, 1659, 264, 2866, 2233, 511, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1023, 0, 4095, 0, 0, 4095, 0, 0, 3276, 0, 0, 4095, 0, 4095, 0, 4095, 2047, 0, 2047, 4095, 67, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 2730, 0, 0, 4095, 0, 3603, 0, 0, 0, 0, 4095, 0, 4095, 1605, 0, 0, 4095, 4095, 0, 3933, 0, 4095, 4095, 819, 0, 4095, 0, 0, 2047, 0, 2047, 0, 0, 4095, 0, 0, 4095, 4095, 2047, 2730, 1820, 2730, 0, 2047, 1365, 0, 2275, 660, 3412, 4095, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 1365, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 2113, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 3350, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1170, 4095, 0, 0, 0, 4095, 3655, 0, 2730, 0, 0, 4095, 0, 3283, 872, 1911, 1755, 3990, 3427, 83, 988, 178, 571, 0, 3412, 4095, 951, 3785, 3663, 2047, 2670, 1424, 4095, 3603, 0, 1270, 1170, 0, 2457, 2340, 4095, 2047, 4095, 2465, 614, 4095, 1179, 1388, 578, 2820, 1638, 2709, 2279, 0, 2840, 1545, 1365, 2670, 1228, 3226, 0, 0, 455, 4095, 204, 0, 0, 0, 0, 0, 1039, 2184, 3827, 0, 0, 4095, 0, 2730, 78, 4095, 0, 0, 0, 0, 0, 0, 442, 1045, 709, 4095, 4063, 0, 0, 0, 316, 3017, 1240, 0, 0, 0, 0, 0, 1023, 4095, 0, 0, 0, 0, 0, 0, 0, 2866, 1589, 4095, 4095, 0, 0, 0, 0, 0, 2730, 0, 0, 0, 0, 0, 1116, 0, 4095, 0, 4095, 0, 0, 0, 2047, 0, 2730, 0, 0, 4095, 0, 0, 0, 0, 0, 2340, 4095, 0, 0, 409, 585, 0, 4095, 4095, 0, 0, 4095, 0, 4095, 2730, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 585, 2047, 0, 0, 4095, 0, 4095, 376, 1638, 937, 0, 4095, 0, 0, 0, 0, 0, 1409, 4095, 0, 0, 0, 0, 0, 0, 1911, 0, 0, 0, 0, 0, 3780, 3327, 1061, 0, 0, 0, 0, 0, 1023, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1293, 0, 0, 0, 0, 4095, 0, 0, 0, 2047, 0, 3164, 1023, 0, 0, 2047, 2340, 0, 0, 4095, 0, 0, 0, 2925, 3640, 1638, 585, 1638, 2205, 2155, 0, 0, 2233, 0, 511, 4095, 4095, 0, 0, 2190, 4095, 0, 0, 0, 4095, 0, 0, 4095, 3276, 0, 0, 4095, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 3071, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 2047, 1170, 4095, 0, 0, 0, 0, 0, 0, 3209, 0, 0, 0, 0, 0, 0, 54, 0, 0, 0, 0, 0, 0, 0, 0, 1116, 0, 0, 0, 0, 0, 0, 0, 511, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 722, 2047, 3350, 1409, 853, 0, 0, 1365, 3802, 0, 0, 4095, 0, 0, 0, 3862, 3817, 4095, 4095, 2275, 3797, 0, 0, 0, 1365, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 1365, 0, 0, 0, 0, 1755, 0, 0, 4095, 0, 0, 0, 2620, 4095, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 146, 0, 2730, 2218, 640, 132, 0, 0, 0, 2559, 0, 0, 4095, 0, 0, 0, 3350, 0, 0, 4095, 1365, 2978, 0, 0, 3685, 315, 0, 0, 0, 0, 0, 2047, 4095, 606, 2925, 2925, 2177, 104, 0, 1264, 4095, 4095, 0, 0, 0, 0, 0, 511, 4095, 0, 0, 0, 0, 0, 0, 511, 4095, 2730, 0, 0, 0, 0, 0, 0, 3996, 3159, 0, 4095, 0, 4001, 0, 273, 0, 1584, 0, 0, 4095, 0, 4095, 58, 3336, 423, 0, 4095, 4095, 3978, 2677, 303, 0, 903, 2457, 0, 0, 0, 4095, 2457, 2457, 146, 1365, 0, 0, 1170, 2047, 511, 2047, 2713, 2047, 3071, 4095, 0, 4095, 1585, 2862, 2559, 2366, 2047, 1246, 1204, 0, 1785, 267, 1842, 2730, 4095, 0, 0, 0, 0, 2047, 534, 0, 0, 0, 0, 0, 0, 292, 91, 0, 0, 4095, 682, 0, 2047, 2233, 204, 0, 0, 0, 0, 0, 0, 0, 1675, 0, 0, 0, 0, 0, 0, 3071, 303, 0, 0, 0, 0, 0, 0, 0, 264, 0, 0, 0, 0, 0, 0, 4095, 1345, 0, 0, 0, 0, 0, 0, 0, 1582, 0, 0, 0, 0, 0, 0, 3276, 2781, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 2047, 315, 2457, 225, 2047, 4095, 0, 0, 0, 819, 3276, 3166, 0, 0, 4095, 0, 0, 1023, 819, 926, 4095, 0, 1501, 682, 0, 0, 0, 2438, 0, 0, 2730, 0, 0, 0, 0, 0, 0, 0, 2106, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 682, 0, 0, 2047, 0, 0, 0, 1547, 0, 0, 0, 4095, 0, 0, 0, 1023, 3719, 2978, 2957, 1441, 569, 4095, 3717, 4095, 2388, 264, 3412, 0, 0, 0, 511, 1365, 3948, 0, 4095, 0, 4095, 0, 230, 4095, 2687, 0, 0, 0, 0, 0, 2457, 2925, 0, 0, 0, 1056, 910, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1755, 0, 862, 2047, 0, 0, 0, 0, 4095, 10, 0, 3685, 3809, 0, 3412, 1820, 1764, 2047, 2047, 3549, 4095, 3722, 0, 4095, 4095, 4095, 2275, 2047, 1023, 0, 4095, 2457, 2275, 2047, 0, 1638, 4095, 3434, 614, 2275, 4095, 1915, 3696, 728, 3174, 1508, 1435, 1422, 409, 1128, 262, 1069, 3026, 4030, 0, 0, 476, 0, 3276, 0, 2730, 0, 0, 0, 0, 4095, 0, 2047, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 682, 2815, 0, 455, 99, 3950, 3290, 31, 277, 0, 0, 0, 4095, 0, 2706, 3560, 3287, 1023, 4095, 2730, 4095, 4095, 4095, 0, 4095, 2730, 0, 744, 0, 0, 4095, 2965, 0, 4095, 3071, 2275, 372, 4095, 2047, 511, 1365, 0, 1302, 341, 3185, 0, 4090, 3448, 0, 0, 0, 0, 0, 0, 2047, 0, 0, 0, 0, 2275, 2047, 4095, 0, 0, 585, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 3276, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1585, 0, 0, 3753, 0, 0, 0, 4095, 4095, 0, 204, 4095, 0, 0, 1365, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 4095, 2047, 4095, 1638, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 3510, 0, 0, 4095, 0, 0, 0, 2047, 0, 4095, 0, 0, 4095, 1023, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2730, 0, 4095, 4095, 0, 0, 0, 0, 682, 682, 0, 0, 0, 0, 0, 62, 1755, 0, 2545, 4057, 4095, 0, 585, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 2730, 0, 4095, 0, 4095, 0, 0, 0, 0, 4095, 0, 2047, 0, 0, 4095, 3646, 2694, 877, 1293, 2218, 1365, 1535, 0, 3217, 511, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 585, 1365, 0, 0, 0, 0, 4095, 0, 3782, 4095, 0, 4095, 0, 3150, 0, 3961, 0, 4095, 4095, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2730, 0, 0, 0, 4095, 0, 2649, 0, 2559, 2047, 682, 4095, 4095, 0, 2632, 1861, 1638, 2047, 2730, 0, 0, 0, 4095, 3583, 3350, 3412, 3071, 1927, 3910, 431, 819, 2047, 585, 3510, 2047, 3560, 0, 4095, 4095, 3189, 2823, 1228, 2953, 2106, 2585, 562, 668, 1018, 524, 2538, 2730, 3530, 0, 0, 0, 0, 1890, 4095, 4095, 4095, 252, 3981, 0, 0, 491, 682, 0, 0, 4095, 0, 0, 0, 3822, 2047, 0, 4095, 4095, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3350, 4095, 4095, 4095, 372, 1365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3276, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 0, 1706, 0, 0, 4095, 4095, 1170, 4095, 0, 585, 2730, 3510, 0, 4095, 4095, 0, 0, 4095, 0, 0, 0, 299, 0, 0, 1023, 0, 4095, 0, 0, 819, 0, 4095, 1228, 1638, 3780, 2925, 2047, 1575, 3867, 0, 3412, 0, 4095, 0, 0, 0, 0, 0, 0, 2263, 4095, 1287, 1083, 4076, 100, 4095, 0, 3071, 0, 1302, 0, 0, 4095, 2047, 0, 3276, 4095, 0, 0, 148, 630, 1514, 1213, 0, 2457, 3530, 303, 0, 0, 0, 0, 2559, 4095, 0, 0, 508, 99, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2866, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 3822, 4095, 2047, 0, 1170, 225, 4095, 3071, 744, 4095, 0, 0, 0, 4095, 0, 127, 0, 0, 2730, 1592, 4095, 255, 2388, 1146, 2866, 3510, 3854, 780, 0, 0, 0, 4095, 41, 4095, 1365, 255, 344, 122, 0, 4095, 2559, 0, 0, 0, 1365, 4095, 4095, 3497, 1786, 2702, 2394, 767, 1295, 1271, 246, 2641, 780, 3474, 1774, 0, 0, 0, 0, 0, 3543, 4095, 4095, 4095, 1376, 152, 2925, 3822, 623, 2024, 0, 0, 4095, 499, 0, 0, 1638, 0, 0, 4095, 1593, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 0, 0, 4095, 442, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 2457, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3336, 4095, 682, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 3303, 4095, 1228, 2047, 186, 2978, 1023, 2047, 0, 0, 0, 4095, 0, 744, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 2047, 4095, 3350, 3722, 0, 2047, 4095, 0, 3276, 255, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 511, 3978, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4019, 4095, 0, 4095, 255, 3541, 0, 0, 2340, 0, 3753, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3863, 0, 4095, 0, 4095, 0, 413, 409, 1965, 1365, 585, 0, 4095, 2677, 4016, 3640, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1228, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3071, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 553, 4095, 31, 1577, 0, 0, 4095, 267, 0, 4095, 4095, 0, 0, 0, 3523, 0, 4049, 2920, 315, 3915, 4038, 26, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 4095, 82, 1895, 0, 0, 4095, 227, 3510, 0, 3071, 409, 4095, 4095, 2357, 606, 1129, 1462, 1023, 2136, 2047, 614, 3787, 1146, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 1023, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 62, 1605, 0, 0, 4095, 161, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 3244, 4095, 0, 1365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 292, 4095, 0, 0, 0, 853, 3185, 520, 2062, 0, 0, 4095, 159, 3867, 372, 4095, 3315, 2866, 0, 3685, 0, 102, 107, 127, 3987, 3812, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 3412, 772, 0, 0, 0, 0, 1875, 2864, 49, 1990, 4095, 0, 4095, 649, 2730, 409, 2340, 2881, 1424, 39, 4001, 455, 2513, 2146, 0, 3048, 3992, 1290, 0, 0, 0, 585, 0, 357, 0, 0, 0, 0, 0, 0, 2730, 0, 4095, 0, 0, 0, 0, 2047, 4095, 1598, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 3663, 0, 0, 2047, 4095, 124, 967, 1365, 2047, 3185, 144, 2340, 0, 0, 0, 4095, 1023, 3867, 341, 0, 1092, 315, 3495, 2559, 0, 4095, 585, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 1453, 0, 0, 4095, 167, 4095, 1023, 0, 1023, 0, 4095, 0, 0, 0, 0, 0, 1433, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1724, 2605, 1291, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1023, 409, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 2474, 4095, 362, 2522, 0, 0, 4095, 1472, 3071, 0, 0, 2978, 1023, 0, 1820, 0, 117, 63, 5, 3802, 3844, 115, 4095, 315, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 682, 4095, 189, 1107, 0, 0, 4095, 216, 0, 0, 0, 0, 4095, 0, 4095, 0, 3189, 2089, 0, 3688, 4058, 2082, 3017, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 141, 910, 0, 0, 4095, 438, 0, 0, 0, 0, 3510, 0, 682, 4095, 0, 0, 4095, 0, 3753, 910, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2275, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 1890, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1412, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1092, 3753, 22, 1876, 0, 0, 4095, 289, 0, 1228, 0, 390, 3412, 695, 3787, 2730, 881, 0, 72, 2086, 0, 511, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 566, 910, 1971, 0, 0, 0, 0, 0, 0, 0, 1365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 394, 221, 183, 0, 0, 0, 0, 0, 4095, 170, 1742, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1023, 1668, 1746, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 182, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3327, 3738, 70, 1200, 0, 0, 4095, 292, 2047, 0, 0, 118, 0, 0, 3663, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 592, 2559, 60, 0, 0, 0, 0, 0, 0, 0, 1523, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1023, 0, 0, 0, 0, 0, 0, 1780, 4095, 238, 1191, 0, 0, 4095, 162, 3465, 0, 4095, 0, 4095, 0, 4095, 0, 3513, 2946, 240, 3526, 2929, 2077, 4095, 0, 0, 0, 0, 3722, 0, 0, 0, 0, 0, 682, 0, 2730, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 1553, 0, 0, 4095, 136, 2340, 0, 0, 0, 4095, 0, 3685, 4095, 0, 0, 0, 1866, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 4095, 98, 1493, 0, 0, 4095, 351, 2457, 2457, 0, 2730, 0, 0, 3350, 1228, 0, 0, 0, 3920, 4095, 78, 890, 0, 4095, 4095, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3247, 4095, 781, 1882, 0, 0, 4095, 447, 4095, 0, 0, 0, 0, 3780, 4095, 511, 3307, 0, 372, 2047, 2047, 113, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 2709, 4095, 68, 1624, 0, 0, 4095, 375, 2806, 0, 3583, 1365, 1064, 2457, 4095, 1861, 958, 538, 3, 3057, 3680, 528, 0, 0, 4095, 4095, 0, 0, 4095, 0, 4095, 4095, 0, 4095, 2047, 2047, 0, 4095, 0, 0, 4095, 2400, 2730, 79, 2400, 3071, 2047, 481, 4095, 1535, 396, 2340, 2047, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 240, 1365, 1965, 0, 4095, 219, 0, 4095, 0, 0, 0, 0, 4095, 0, 3780, 191, 0, 344, 4028, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 273, 1137, 1023, 0, 4095, 227, 1365, 0, 0, 0, 3722, 3780, 4095, 0, 0, 0, 0, 4095, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 2730, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 4095, 2900, 2571, 231, 3960, 1365, 1820, 1324, 0, 526, 0, 2709, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 780, 3948, 0, 0, 4095, 585, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4019, 0, 0, 1023, 2605, 4095, 3510, 0, 1365, 0, 0, 0, 0, 0, 0, 3705, 455, 1365, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 0, 0, 0, 4095, 0, 0, 4095, 4095, 2730, 3185, 2388, 0, 0, 1861, 0, 1911, 910, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2730, 4095, 73, 3125, 0, 0, 4095, 599, 0, 0, 0, 4095, 4095, 4095, 4095, 0, 0, 0, 0, 63, 67, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4046, 0, 0, 4095, 117, 4095, 4095, 3395, 571, 744, 0, 2047, 4095, 0, 4095, 0, 4095, 2340, 2801, 2233, 2047, 1170, 3854, 3185, 682, 3071, 3549, 4095, 2047, 3997, 3071, 4095, 4009, 1252, 3096, 439, 2912, 2047, 2388, 1005, 372, 1715, 316, 3003, 2047, 3780, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 2730, 0, 2730, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 2047, 1560, 585, 2559, 1575, 2113, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2668, 2047, 35, 1365, 151, 0, 0, 0, 1535, 546, 2559, 0, 2730, 2730, 4095, 2730, 1769, 945, 315, 2934, 3846, 1390, 3245, 26, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 2047, 4095, 4095, 4095, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 3640, 3640, 0, 1365, 3071, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 862, 4095, 4095, 4095, 2925, 819, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 0, 2457, 0, 0, 4095, 4095, 0, 0, 4095, 1575, 2047, 1755, 3276, 0, 0, 292, 0, 2730, 234, 3217, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 97, 240, 0, 0, 0, 0, 1365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 341, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 511, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 1638, 4095, 0, 0, 0, 0, 4095, 0, 0, 4095, 4095, 0, 0, 0, 3276, 4095, 2047, 4095, 0, 0, 0, 0, 292, 118, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 2730, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3883, 2047, 1715, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 673, 4095, 2340, 1023, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 1023, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 3780, 62, 0, 4095, 0, 4095, 0, 0, 4095, 0, 630, 3071, 0, 4095, 0, 4095, 0, 0, 0, 4095, 2186, 0, 1365, 0, 0, 0, 960, 0, 3560, 0, 0, 0, 2047, 0, 0, 1365, 0, 0, 0, 0, 0, 0, 113, 0, 4095, 0, 0, 0, 0, 0, 255, 910, 536, 0, 0, 0, 0, 0, 1246, 862, 4095, 0, 0, 0, 0, 0, 0, 1293, 1706, 0, 0, 0, 0, 0, 455, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 409, 0, 4095, 0, 0, 0, 0, 0, 2047, 0, 0, 1638, 4095, 0, 0, 0, 0, 0, 0, 0, 2047, 4095, 0, 0, 2730, 2047, 0, 0, 0, 2340, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 4095, 0, 4095, 0, 0, 0, 0, 4095, 0, 2730, 1535, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 1407, 2730, 845, 0, 0, 0, 0, 0, 1023, 0, 1365, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 1838, 2155, 1197, 0, 0, 0, 0, 0, 2730, 0, 0, 0, 0, 0, 0, 0, 409, 0, 963, 0, 0, 0, 0, 0, 0, 372, 2047, 2233, 1023, 1638, 123, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 910, 3780, 3959, 2047, 0, 0, 1365, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 2111, 3003, 0, 3583, 234, 2784, 0, 0, 0, 764, 0, 0, 0, 0, 2478, 0, 3228, 1755, 2632, 0, 1365, 4095, 0, 0, 67, 0, 0, 0, 0, 0, 0, 0, 455, 215, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 682, 210, 0, 0, 0, 409, 0, 585, 0, 819, 0, 0, 0, 0, 0, 0, 1651, 2682, 2047, 3217, 1284, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3627, 4067, 1535, 4095, 646, 3621, 0, 0, 0, 2047, 0, 2730, 4095, 0, 4095, 0, 1417, 1023, 0, 4095, 0, 0, 0, 819, 1365, 0, 0, 0, 4095, 0, 4095, 0, 2643, 1535, 3627, 341, 898, 195, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 2047, 84, 722, 2632, 3071, 1646, 568, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 1365, 2457, 4095, 4095, 1228, 0, 0, 2340, 0, 307, 0, 0, 0, 0, 0, 0, 273, 1302, 3412, 2275, 1562, 199, 0, 2233, 4095, 4095, 0, 0, 0, 0, 0, 0, 2205, 2730, 0, 0, 0, 2730, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2340, 178, 0, 4095, 0, 1023, 0, 1365, 0, 4068, 0, 0, 0, 0, 0, 0, 2730, 682, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 2047, 585, 240, 264, 0, 0, 0, 2730, 0, 1061, 2929, 1769, 0, 0, 0, 0, 3867, 0, 2925, 1023, 3802, 0, 0, 4095, 0, 0, 3276, 0, 0, 0, 0, 0, 0, 0, 2047, 910, 0, 4095, 0, 0, 0, 0, 0, 2528, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 2730, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 2047, 4095, 2104, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 0, 0, 0, 0, 1508, 2559, 2275, 0, 0, 3276, 0, 0, 1820, 372, 110, 2047, 1755, 834, 1023, 0, 0, 0, 1433, 0, 0, 0, 0, 0, 0, 2978, 0, 4095, 0, 2188, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2559, 0, 0, 0, 2184, 0, 0, 1657, 3640, 4095, 0, 0, 0, 0, 4095, 0, 585, 3757, 1706, 2730, 1023, 383, 0, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 1535, 3523, 0, 4095, 0, 0, 0, 372, 0, 1170, 0, 0, 0, 0, 0, 4095, 2218, 0, 4095, 4095, 390, 292, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 682, 0, 4095, 0, 0, 0, 2605, 546, 1706, 3412, 0, 0, 0, 0, 0, 4095, 3536, 0, 0, 0, 0, 0, 0, 0, 3640, 0, 0, 0, 1023, 0, 682, 3071, 1535, 3705, 744, 0, 0, 0, 3071, 2047, 1575, 0, 4095, 0, 3879, 0, 0, 0, 1336, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2866, 1023, 3967, 2890, 0, 0, 0, 4095, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 1365, 240, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2370, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 2113, 819, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 2047, 4095, 3199, 0, 4095, 0, 0, 0, 0, 2047, 4095, 0, 0, 4095, 0, 0, 2457, 0, 1023, 2047, 0, 4095, 0, 0, 4095, 0, 0, 0, 0, 4095, 682, 0, 0, 0, 2978, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 3412, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 2866, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 3131, 0, 0, 4095, 0, 4095, 0, 4095, 0, 4095, 0, 0, 0, 0, 4095, 1638, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 151, 102, 2426, 3185, 2047, 4095, 2047, 273, 1929, 2692, 2982, 0, 4095, 0, 0, 0, 1023, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 3640, 0, 0, 0, 0, 0, 3812, 2690, 1023, 926, 4095, 4095, 0, 963, 1737, 195, 966, 1865, 4095, 0, 2047, 0, 4095, 0, 3276, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3327, 1365, 1365, 4095, 0, 0, 2047, 1638, 4095, 0, 4095, 0, 0, 0, 1365, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 204, 136, 585, 4095, 0, 2047, 0, 0, 3071, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 3753, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 270, 195, 356, 0, 1901, 2136, 1829, 1137, 1774, 2535, 3003, 0, 4095, 0, 0, 0, 2457, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 3276, 0, 4095, 4095, 4095, 0, 0, 2632, 3510, 2925, 0, 4095, 0, 3167, 0, 0, 3685, 1129, 682, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3622, 2233, 511, 4095, 2457, 0, 4095, 1951, 2408, 1506, 0, 4095, 4095, 3403, 4095, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1170, 4095, 0, 3003, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 4095, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 682, 2473, 0, 1668, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 2457, 2047, 2047, 4095, 1618, 1731, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 655, 2717, 171, 1476, 0, 0, 0, 0, 0, 0, 0, 4095, 409, 0, 3879, 2730, 3832, 0, 1905, 3846, 0, 0, 1365, 0, 0, 0, 0, 0, 0, 0, 1023, 1023, 1365, 1365, 1660, 1365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3003, 3780, 0, 819, 2005, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 299, 2879, 770, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 240, 0, 0, 396, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 1740, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3802, 4095, 2410, 219, 0, 0, 0, 0, 0, 0, 4095, 4095, 4095, 0, 4095, 4095, 3276, 2047, 0, 511, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 4095, 0, 1260, 3685, 0, 4095, 3583, 0, 0, 0, 0, 0, 0, 0, 2801, 4095, 3753, 1170, 846, 431, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2457, 4095, 0, 0, 2751, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 150, 4095, 4095, 2801, 2205, 2132, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2940, 215, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 4095, 0, 4095, 1785, 2559, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 327, 2047, 0, 4095, 1314, 614, 0, 0, 0, 0, 1365, 0, 0, 0, 4095, 0, 3722, 4095, 4095, 4095, 1135, 1780, 0, 0, 2835, 0, 0, 0, 0, 0, 0, 0, 2605, 3970, 189, 201, 1322, 2031, 0, 3071, 1023, 0, 2544, 2593, 3468, 0, 0, 0, 0, 0, 0, 0, 2314, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 682, 0, 0, 682, 2047, 190, 0, 2730, 2047, 2167, 2047, 2669, 1075, 1779, 4095, 0, 0, 0, 0, 0, 0, 3640, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1023, 4095, 0, 0, 0, 0, 4095, 3071, 0, 0, 0, 0, 614, 4095, 2193, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 3412, 0, 0, 0, 4095, 0, 63, 1213, 1820, 4063, 1535, 819, 1535, 819, 2499, 2794, 3510, 170, 0, 0, 1365, 0, 0, 4095, 0, 255, 0, 1365, 0, 4095, 0, 0, 0, 0, 0, 0, 585, 2047, 0, 4095, 455, 4025, 0, 0, 0, 4095, 4095, 4095, 0, 2047, 0, 0, 3835, 4095, 0, 4095, 455, 2730, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 722, 787, 0, 0, 0, 1365, 0, 2047, 1968, 2303, 3026, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 2730, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 1023, 4095, 4095, 1489, 126, 12, 0, 0, 4095, 0, 390, 0, 1185, 0, 1170, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 341, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 34, 7, 0, 0, 0, 0, 0, 481, 0, 1605, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 1365, 2866, 4095, 3276, 4095, 4095, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 1023, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 4095, 4095, 0, 0, 4095, 0, 0, 0, 4095, 4095, 3802, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 4095, 2835, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1365, 0, 4095, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 4095, 3412, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2457, 890, 1630, 0, 0, 0, 0, 0, 3780, 0, 0, 0, 0, 0, 0, 0, 997, 2890, 2293, 1023, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 4095, 0, 0, 0, 2457, 0, 6, 0, 0, 31, 0, 0, 0, 4095, 0, 4095, 0, 4095, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 389, 3045, 1438, 0, 2047, 0, 0, 0, 1402, 2047, 3959, 4095, 99, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 321, 0, 245, 0, 0, 0, 0, 0, 264, 1198, 2530, 0, 0, 0, 0, 0, 170, 0, 455, 2388, 0, 0, 0, 0, 0, 562, 1706, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 4095, 0, 2047, 2047, 4095, 0, 0, 0, 1365, 4095, 0, 0, 2047, 4095, 0, 0, 0, 2457, 0, 0, 0, 4095, 4095, 4095, 0, 0, 4095, 4095, 4095, 0, 0, 4095, 0, 0, 0, 0, 4095, 4095, 1023, 0, 0, 4095, 4095, 0, 3854, 0, 0, 4095, 0, 0, 196, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 4095, 673, 4095, 1114, 0, 0, 0, 0, 0, 1365, 0, 1215, 0, 0, 0, 0, 0, 4095, 0, 1023, 0, 0, 0, 0, 0, 1950, 3217, 1324, 1170, 0, 0, 0, 2978, 2730, 0, 0, 0, 0, 0, 0, 0, 585, 2730, 2083, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3753, 4095, 0, 0, 0, 4095, 0, 4095, 2340, 585, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 528, 0, 0, 0, 1638, 0, 4095, 0, 0, 0, 585, 2553, 0, 0, 2047, 0, 4095, 0, 3685, 195, 2985, 0, 0, 4095, 0, 0, 0, 4095, 3900, 0, 0, 0, 0, 0, 2205, 0, 2047, 0, 0, 0, 0, 0, 0, 341, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1365, 0, 0, 0, 0, 2047, 0, 0, 3767, 0, 3412, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 215, 0, 0, 0, 0, 0, 0, 4095, 1883, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 2047, 0, 0, 0, 0, 0, 0, 963, 0, 0, 4095, 0, 0, 0, 4095, 3578, 4095, 4095, 0, 0, 0, 2047, 646, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 682, 0, 4095, 0, 0, 0, 0, 0, 1535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3717, 3276, 1638, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1494, 4095, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 292, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 722, 2047, 1201, 0, 0, 0, 0, 0, 0, 0, 2457, 819, 4095, 0, 0, 0, 0, 0, 3348, 0, 0, 4095, 0, 0, 1299, 288, 2134, 511, 2730, 0, 0, 0, 87, 0, 15, 0, 0, 0, 0, 4095, 1238, 3412, 1030, 4095, 0, 0, 0, 0, 0, 0, 221, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1023, 0, 106, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 825, 819, 934, 255, 0, 0, 0, 481, 574, 1675, 561, 1161, 2285, 1560, 0, 0, 1365, 1638, 2646, 0, 0, 0, 0, 0, 0, 0, 577, 0, 0, 0, 0, 0, 1535, 4095, 1435, 0, 1365, 0, 4095, 0, 1755, 0, 3997, 2047, 0, 0, 0, 0, 915, 769, 2759, 1755, 4095, 0, 0, 0, 1563, 4095, 3079, 0, 0, 4095, 0, 0, 770, 1817, 3715, 2730, 2598, 0, 2881, 0, 0, 0, 674, 0, 0, 4095, 4095, 0, 1686, 2900, 11, 3606, 0, 0, 4095, 0, 67, 1535, 744, 0, 0, 0, 0, 0, 1785, 74, 3363, 0, 0, 0, 0, 0, 1433, 0, 1842, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2218, 0, 0, 0, 0, 0, 1365, 4095, 3943, 0, 0, 0, 4095, 0, 426, 4095, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 1755, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 546, 1838, 4095, 3583, 383, 0, 0, 511, 0, 3714, 3003, 0, 0, 0, 744, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 341, 682, 0, 1170, 0, 682, 0, 1780, 2275, 2910, 2574, 630, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 43, 55, 0, 162, 0, 0, 0, 0, 2237, 226, 551, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 97, 1365, 0, 3185, 4095, 4095, 0, 3412, 4095, 2400, 4095, 979, 0, 0, 0, 0, 890, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 4095, 1827, 2730, 4095, 0, 0, 0, 0, 3640, 4095, 2649, 4095, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24, 4095, 4095, 0, 4095, 0, 2730, 0, 2698, 4037, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 945, 0, 3071, 0, 4095, 4095, 0, 3103, 532, 2457, 4095, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 3071, 0, 4095, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 682, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 2047, 2047, 0, 4095, 0, 0, 0, 0, 3676, 1162, 2340, 2047, 0, 0, 1365, 0, 1170, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 682, 2730, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1638, 0, 0, 3185, 0, 0, 2388, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 390, 1582, 0, 1553, 3327, 1861, 1146, 0, 4081, 3310, 3652, 2233, 0, 0, 0, 0, 3276, 3812, 0, 0, 1605, 1516, 1023, 0, 0, 0, 0, 1365, 4095, 4095, 4095, 0, 0, 1638, 0, 2047, 0, 4095, 0, 0, 3559, 3434, 2594, 195, 4095, 2821, 2811, 712, 3908, 0, 1365, 2175, 409, 1737, 199, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 146, 1649, 0, 2730, 1424, 4095, 4095, 2457, 3890, 1181, 2391, 2047, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1755, 1023, 0, 2730, 0, 0, 4095, 0, 4095, 4095, 3536, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 682, 0, 3276, 0, 1365, 0, 0, 4054, 3017, 1060, 819, 0, 0, 0, 4095, 1365, 0, 0, 1228, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2233, 0, 0, 0, 3510, 831, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1939, 2965, 4095, 0, 4095, 4095, 0, 0, 0, 0, 0, 11, 1129, 0, 1365, 0, 315, 1638, 0, 3963, 708, 1328, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 3007, 0, 448, 523, 530, 103, 436, 970, 75, 1426, 520, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1890, 1472, 0, 2881, 3003, 3510, 1365, 4095, 2365, 95, 3895, 796, 3071, 0, 0, 141, 3583, 2408, 35, 414, 0, 0, 0, 0, 0, 3139, 4095, 4095, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 4095, 3822, 2549, 4095, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 1008, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 4095, 3375, 2047, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3822, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 0, 2233, 2457, 4095, 1496, 0, 4095, 0, 0, 4095, 0, 409, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 722, 1851, 0, 2370, 0, 0, 0, 4095, 0, 2047, 0, 722, 0, 0, 0, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3992, 767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 455, 585, 0, 2047, 877, 585, 0, 2842, 961, 2266, 3711, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 744, 0, 0, 0, 0, 0, 4095, 1638, 0, 0, 4095, 0, 0, 0, 0, 3412, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 2590, 0, 0, 0, 3071, 0, 3722, 3120, 1890, 1557, 4095, 4095, 2403, 1498, 1365, 3560, 2047, 273, 3583, 511, 2963, 1137, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 895, 341, 0, 0, 3458, 4095, 223, 18, 3510, 0, 0, 0, 4095, 2155, 4049, 3839, 3071, 4095, 682, 0, 4095, 4095, 4095, 2047, 0, 4095, 0, 0, 2047, 4095, 4095, 0, 4095, 3026, 165, 3841, 4095, 0, 1483, 0, 0, 844, 851, 0, 2485, 0, 2784, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 3753, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2233, 1156, 0, 0, 0, 0, 0, 2047, 1861, 2698, 0, 0, 0, 0, 2559, 1638, 0, 1453, 3681, 4095, 31, 170, 0, 4095, 0, 0, 0, 3276, 4095, 3412, 0, 455, 0, 0, 0, 1365, 0, 0, 0, 0, 0, 0, 0, 3583, 178, 0, 2632, 260, 1701, 1619, 3510, 0, 0, 3733, 0, 0, 2466, 0, 2730, 0, 2848, 0, 0, 367, 1742, 1152, 0, 0, 0, 0, 0, 938, 4095, 3603, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1365, 0, 1365, 0, 0, 0, 0, 0, 0, 1638, 1157, 0, 0, 0, 0, 0, 1638, 2047, 4095, 0, 0, 0, 0, 0, 0, 4095, 1489, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2978, 0, 0, 0, 4095, 0, 0, 0, 3753, 4095, 0, 0, 0, 0, 0, 341, 1365, 0, 0, 3243, 4095, 332, 51, 0, 2730, 0, 0, 0, 2835, 4095, 3185, 0, 4095, 4095, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 4095, 0, 4095, 372, 4095, 0, 0, 0, 0, 4095, 4095, 2077, 49, 0, 0, 4095, 3350, 0, 0, 819, 0, 0, 0, 0, 0, 0, 0, 1755, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 1638, 0, 4095, 0, 0, 0, 0, 0, 511, 0, 0, 0, 0, 0, 0, 0, 1638, 0, 0, 0, 0, 0, 1365, 1023, 1501, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 1638, 0, 0, 0, 0, 0, 0, 4095, 4095, 819, 0, 2605, 1023, 0, 0, 0, 4095, 0, 0, 0, 0, 792, 0, 0, 1939, 1263, 3382, 319, 0, 0, 0, 0, 1365, 0, 1236, 4095, 1638, 0, 3476, 3907, 3363, 4095, 4095, 1365, 1820, 0, 945, 341, 0, 546, 3916, 682, 0, 2574, 0, 4048, 0, 3824, 0, 0, 4063, 0, 2696, 2559, 0, 0, 0, 2559, 0, 0, 2730, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2320, 0, 3185, 2559, 451, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 351, 0, 3649, 1357, 2532, 3981, 88, 776, 0, 2047, 0, 0, 0, 941, 3975, 3104, 4095, 3510, 3450, 1116, 1755, 1638, 975, 534, 0, 2520, 159, 3753, 0, 4095, 4095, 3780, 4095, 4022, 936, 677, 4095, 0, 2802, 615, 1460, 1251, 3, 1604, 0, 0, 1759, 0, 0, 0, 157, 0, 1170, 3071, 687, 141, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3780, 2047, 4095, 4095, 0, 0, 0, 2388, 4095, 2184, 0, 0, 0, 0, 4095, 0, 4095, 2486, 2047, 4095, 1955, 117, 0, 921, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 1638, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 282, 2925, 2167, 0, 0, 0, 0, 682, 356, 4095, 0, 2978, 4095, 195, 0, 2730, 372, 2730, 1023, 2047, 3071, 4095, 3071, 0, 0, 3276, 0, 0, 0, 0, 0, 0, 325, 2978, 3685, 0, 3276, 1092, 0, 3649, 1365, 3412, 3380, 3921, 0, 0, 2983, 0, 3341, 4055, 0, 0, 0, 3071, 0, 0, 646, 4095, 1365, 0, 0, 0, 0, 0, 240, 4095, 870, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 431, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 250, 4095, 3412, 0, 0, 0, 0, 0, 1170, 4095, 2863, 0, 0, 0, 0, 0, 372, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 341, 84, 4095, 124, 1141, 4095, 0, 178, 0, 292, 4095, 0, 0, 1246, 4095, 4095, 4095, 1391, 431, 1111, 0, 4095, 712, 2509, 0, 0, 4095, 0, 0, 4095, 4095, 0, 4095, 0, 4087, 0, 4095, 0, 1092, 0, 0, 3025, 1365, 0, 0, 0, 1170, 0, 0, 210, 0, 3071, 0, 0, 372, 0, 0, 315, 2233, 0, 0, 0, 0, 0, 4095, 0, 1744, 1785, 2047, 2925, 1347, 864, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 3185, 0, 4095, 0, 0, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 2978, 0, 4095, 4095, 1694, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2418, 3150, 1170, 63, 0, 0, 0, 0, 0, 3217, 3845, 1047, 0, 4095, 0, 0, 0, 0, 2340, 4095, 2730, 0, 0, 0, 0, 4095, 3217, 0, 3872, 0, 4095, 0, 4084, 0, 3943, 3916, 0, 0, 2935, 0, 0, 0, 1732, 0, 0, 0, 0, 0, 0, 0, 1565, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3412, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 372, 0, 0, 0, 3643, 4095, 292, 0, 0, 0, 0, 0, 0, 3890, 4049, 2835, 4095, 0, 0, 0, 3276, 4095, 0, 0, 0, 4095, 0, 0, 4095, 4095, 0, 0, 4095, 2604, 1767, 1440, 0, 0, 1215, 2662, 982, 3981, 0, 0, 186, 0, 2784, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3276, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 3904, 4095, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 2730, 2730, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 2259, 4095, 372, 0, 0, 4095, 0, 0, 0, 2559, 4095, 2730, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 3846, 341, 4058, 1535, 0, 910, 1608, 3722, 4095, 4095, 511, 0, 0, 0, 4095, 0, 0, 1023, 0, 0, 0, 0, 3120, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1992, 4095, 0, 585, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 3807, 0, 4095, 4095, 1516, 0, 0, 4095, 0, 0, 0, 4095, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 682, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 3845, 4095, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 4095, 0, 4095, 3071, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3071, 0, 2730, 1092, 857, 4095, 2328, 27, 0, 0, 0, 0, 0, 1785, 4095, 4095, 0, 0, 2925, 4095, 0, 4095, 0, 2730, 0, 372, 0, 4095, 1023, 4095, 4095, 2047, 3722, 117, 4095, 2047, 4095, 0, 431, 1288, 0, 0, 3071, 2047, 4095, 0, 3671, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 2502, 4001, 1575, 646, 3388, 240, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3883, 4095, 1170, 0, 1913, 1260, 0, 0, 0, 0, 0, 0, 0, 0, 1365, 0, 0, 0, 1417, 4095, 1745, 1688, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 3544, 4095, 3026, 372, 153, 3079, 0, 4095, 2520, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1854, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 585, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3836, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2151, 0, 0, 0, 0, 0, 0, 0, 0, 0, 337, 0, 0, 0, 3288, 4095, 434, 64, 0, 0, 0, 0, 0, 3802, 4048, 3780, 0, 4095, 0, 0, 0, 0, 3035, 1638, 0, 0, 0, 0, 0, 4095, 1890, 2047, 3956, 0, 3652, 4095, 3285, 0, 1126, 2914, 0, 2730, 3768, 0, 0, 4095, 3071, 0, 0, 0, 2720, 4095, 1652, 1023, 3326, 1592, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3386, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 481, 0, 0, 0, 3450, 4095, 853, 0, 0, 0, 0, 0, 0, 1592, 4095, 3071, 4095, 3583, 2047, 0, 0, 0, 151, 0, 0, 4095, 1780, 0, 0, 4095, 4095, 0, 4095, 3419, 318, 1396, 4095, 3640, 711, 918, 0, 698, 989, 3880, 1188, 4095, 2632, 0, 0, 0, 0, 0, 0, 0, 0, 3822, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3717, 4095, 0, 4095, 0, 2866, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 819, 4095, 215, 0, 0, 0, 0, 0, 0, 409, 4095, 0, 0, 2605, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3412, 0, 0, 4035, 0, 4051, 0, 3185, 0, 51, 4095, 0, 224, 3850, 0, 0, 0, 2925, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 819, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 4095, 0, 0, 0, 0, 0, 0, 4095, 3972, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 2340, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1204, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 1365, 1213, 4095, 1023, 2980, 4095, 34, 149, 0, 0, 0, 0, 0, 3185, 4031, 2730, 0, 1755, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 877, 0, 4070, 0, 4088, 0, 4095, 0, 0, 4070, 0, 1260, 3711, 2047, 4095, 315, 2388, 0, 0, 1501, 0, 1129, 0, 0, 0, 0, 0, 2670, 0, 3276, 0, 0, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 1365, 0, 0, 0, 0, 0, 0, 0, 0, 1755, 1151, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 1279, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3960, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2584, 1881, 315, 47, 0, 0, 0, 0, 0, 726, 4095, 3839, 0, 722, 4095, 0, 0, 4095, 0, 0, 0, 0, 4095, 4095, 0, 4095, 2925, 4095, 4095, 4095, 4095, 0, 2291, 4095, 130, 4095, 0, 0, 379, 4095, 4095, 3773, 1675, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 1023, 0, 1365, 0, 4095, 0, 0, 0, 0, 0, 819, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 1098, 3071, 849, 0, 0, 0, 0, 0, 3685, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 45, 0, 0, 2516, 3480, 338, 135, 0, 0, 0, 0, 0, 1111, 4017, 3640, 215, 534, 304, 0, 0, 4095, 59, 828, 0, 3120, 1092, 2398, 2047, 3223, 1535, 0, 3624, 190, 3964, 327, 723, 0, 3480, 4095, 0, 2556, 921, 4095, 4075, 0, 1476, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 2784, 4095, 511, 0, 1260, 0, 0, 0, 0, 3350, 3940, 2047, 0, 0, 0, 2730, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 4095, 2081, 4095, 2047, 4095, 0, 1427, 0, 0, 528, 92, 0, 0, 0, 2978, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 1365, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 585, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1365, 0, 3956, 0, 0, 0, 0, 0, 0, 0, 0, 2303, 4095, 255, 0, 2730, 4095, 0, 0, 0, 2047, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 778, 3827, 3414, 0, 1023, 0, 0, 4074, 0, 4017, 0, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 910, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 341, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1365, 0, 0, 0, 372, 4095, 2457, 15, 0, 255, 4095, 0, 0, 2047, 4095, 4095, 0, 1820, 0, 14, 0, 0, 0, 0, 0, 0, 0, 82, 0, 0, 0, 0, 4095, 0, 4095, 0, 3213, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 3276, 0, 0, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 2233, 2457, 1575, 356, 3071, 0, 0, 4095, 4095, 2047, 3802, 1365, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 227, 0, 3412, 0, 0, 0, 2340, 0, 0, 4095, 0, 0, 0, 0, 2730, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 1228, 0, 0, 0, 652, 2925, 1170, 95, 4095, 0, 0, 0, 0, 292, 3999, 1861, 4095, 4095, 1170, 0, 4095, 0, 0, 2605, 4095, 4095, 0, 3071, 4095, 4095, 0, 0, 0, 0, 4095, 0, 0, 0, 480, 4095, 0, 1638, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 1365, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 1023, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 409, 0, 3071, 0, 0, 4095, 4095, 819, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2457, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 163, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 4095, 0, 0, 4095, 3315, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 1365, 0, 4095, 2730, 2155, 2303, 1170, 2047, 3071, 3003, 1958, 2730, 819, 2145, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2661, 37, 0, 0, 167, 4095, 3510, 0, 1260, 4095, 2047, 0, 4095, 0, 2047, 0, 3276, 4095, 170, 2047, 2730, 819, 2730, 0, 2047, 1365, 0, 2047, 0, 2822, 0, 0, 1719, 837, 2992, 1137, 1976, 2047, 910, 890, 2047, 1919, 230, 3867, 955, 2293, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 3916, 0, 28, 0, 0, 0, 0, 0, 0, 3583, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2730, 4095, 2047, 3802, 3722, 0, 4095, 0, 0, 0, 0, 409, 0, 3412, 0, 0, 4004, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 819, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 819, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1023, 0, 0, 0, 392, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3185, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 299, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 2136, 0, 2586, 0, 2559, 0, 3622, 0, 2992, 0, 2605, 0, 2047, 0, 1023, 0, 2605, 0, 2815, 0, 1755, 0, 1489, 0, 3241, 0, 1535, 0, 2730, 0, 2605, 4095, 455, 0, 3908, 4095, 3164, 4095, 3276, 0, 2047, 0, 3663, 0, 2457, 0, 4095, 4095, 3276, 0, 3071, 0, 4095, 0, 4095, 4095, 0, 0, 0, 0, 3071, 0, 0, 0, 1131, 0, 843, 0, 1250, 0, 1623, 0, 1204, 0, 3013, 0, 988, 0, 1489, 0, 2873, 0, 1950, 0, 1474, 0, 2155, 0, 3443, 0, 1770, 0, 1613, 0, 3131, 0, 1535, 0, 1034, 0, 2989, 0, 1998, 0, 2193, 0, 2730, 0, 2228, 0, 1706, 0, 1638, 0, 1508, 4095, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1116, 0, 0, 0, 0, 0, 2996, 0, 955, 0, 0, 0, 0, 0, 667, 1904, 1420, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1023, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 945, 0, 0, 0, 787, 2486, 1135, 0, 4095, 0, 0, 0, 927, 3276, 4079, 0, 0, 0, 4095, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 1204, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1267, 0, 0, 0, 0, 0, 3924, 0, 2815, 0, 0, 0, 0, 0, 0, 43, 1180, 0, 0, 0, 0, 0, 1023, 4095, 2457, 0, 0, 0, 0, 0, 151, 0, 0, 0, 4095, 0, 0, 0, 1852, 0, 0, 0, 0, 0, 0, 0, 819, 0, 0, 4095, 4095, 0, 0, 0, 1365, 0, 0, 0, 0, 0, 0, 0, 1365, 0, 0, 0, 4095, 0, 0, 0, 1365, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 4095, 2047, 4095, 945, 0, 0, 0, 0, 0, 585, 4095, 1556, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 2948, 3185, 843, 0, 0, 0, 0, 0, 4095, 0, 2047, 0, 0, 0, 0, 0, 3596, 0, 1535, 0, 0, 0, 0, 0, 0, 2205, 36, 1365, 2730, 2210, 227, 0, 2047, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 2047, 0, 4095, 0, 0, 0, 0, 0, 0, 3247, 4017, 0, 4095, 4095, 4095, 0, 0, 0, 3170, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2730, 2730, 3276, 4095, 1365, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 3327, 1638, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 664, 0, 404, 511, 0, 0, 0, 0, 0, 240, 0, 0, 0, 0, 0, 0, 0, 0, 372, 2730, 0, 0, 0, 0, 0, 0, 978, 0, 0, 0, 0, 0, 0, 341, 2408, 0, 2457, 910, 1098, 679, 0, 1023, 4095, 4095, 0, 0, 4095, 0, 0, 3071, 3663, 4046, 0, 4095, 2275, 3763, 4095, 3276, 4095, 4095, 2047, 0, 4095, 0, 0, 2730, 1188, 0, 0, 4095, 2730, 1023, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3003, 3412, 0, 0, 1638, 2047, 0, 1023, 0, 2730, 0, 0, 0, 0, 0, 0, 277, 0, 1706, 0, 2488, 300, 0, 0, 1068, 0, 3017, 0, 372, 0, 0, 273, 2730, 0, 910, 0, 3071, 0, 4095, 2320, 3861, 1293, 0, 0, 372, 0, 3276, 0, 2815, 1279, 2047, 1445, 1634, 133, 2167, 1724, 682, 0, 2047, 0, 1489, 0, 0, 0, 3217, 4095, 4095, 0, 3131, 1365, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 2730, 819, 0, 4095, 0, 4095, 0, 298, 4095, 1695, 0, 0, 0, 0, 0, 411, 1939, 1365, 0, 0, 0, 4095, 0, 637, 4095, 546, 0, 0, 0, 0, 0, 1194, 3780, 409, 0, 0, 0, 0, 0, 164, 3965, 883, 0, 0, 0, 0, 0, 1268, 3722, 4010, 0, 0, 0, 4095, 0, 1126, 0, 0, 0, 0, 0, 0, 0, 236, 4095, 1535, 0, 0, 0, 0, 0, 1617, 4095, 3580, 0, 0, 0, 0, 0, 819, 4095, 0, 0, 0, 0, 0, 0, 2047, 4095, 2047, 0, 0, 0, 0, 0, 529, 4095, 0, 0, 0, 0, 0, 0, 327, 0, 341, 0, 0, 0, 0, 0, 1226, 2730, 2047, 0, 0, 0, 0, 0, 1333, 4095, 1686, 0, 0, 0, 0, 0, 1188, 3276, 1462, 0, 0, 0, 0, 0, 0, 0, 2457, 0, 0, 0, 0, 0, 1131, 2559, 268, 0, 0, 0, 0, 0, 1170, 4095, 3071, 0, 0, 0, 0, 0, 929, 1549, 373, 3071, 3071, 922, 1098, 0, 1155, 4095, 144, 0, 0, 0, 0, 0, 546, 2047, 37, 0, 0, 1050, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1820, 0, 1755, 0, 0, 2605, 0, 0, 722, 4095, 0, 0, 0, 0, 0, 0, 0, 1519, 2295, 1820, 1608, 760, 682, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 1365, 2866, 0, 0, 0, 0, 0, 341, 0, 4095, 0, 0, 0, 0, 0, 0, 2457, 0, 0, 4095, 1365, 327, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 623, 0, 4095, 1137, 2559, 1462, 0, 1861, 2472, 2461, 682, 0, 0, 0, 0, 682, 511, 3780, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 409, 4095, 0, 4095, 259, 4095, 0, 0, 0, 0, 3185, 0, 1638, 0, 0, 0, 0, 0, 2047, 0, 4017, 0, 0, 0, 0, 0, 0, 0, 0, 0, 604, 0, 0, 0, 508, 1385, 1253, 1755, 1365, 3276, 2047, 3924, 1039, 2084, 1240, 1820, 1560, 0, 766, 0, 396, 0, 3774, 0, 2634, 0, 1116, 0, 843, 0, 372, 0, 1092, 0, 511, 0, 0, 0, 1424, 0, 3276, 0, 0, 0, 2047, 4095, 0, 0, 0, 0, 0, 0, 1853, 0, 3622, 0, 2535, 0, 0, 0, 0, 0, 1560, 0, 819, 0, 4095, 0, 3071, 4095, 963, 4095, 3879, 0, 3150, 0, 0, 0, 4095, 0, 4095, 0, 4095, 0, 1861, 0, 4095, 0, 4095, 0, 4095, 0, 4095, 0, 4095, 0, 4095, 4095, 0, 0, 2730, 0, 4095, 0, 2730, 0, 4095, 4095, 4095, 0, 4095, 0, 1638, 2047, 4095, 0, 0, 0, 1587, 0, 3948, 4095, 276, 0, 240, 0, 2730, 0, 0, 0, 3738, 0, 3890, 0, 4062, 0, 4095, 0, 3241, 0, 4023, 0, 3372, 0, 4095, 0, 3780, 0, 4095, 0, 2457, 0, 3722, 0, 4095, 0, 3981, 0, 4095, 0, 4056, 0, 4095, 0, 3448, 1023, 3854, 1023, 3829, 0, 3937, 4095, 4095, 0, 4095, 4095, 409, 0, 0, 4095, 3948, 0, 2184, 0, 2275, 0, 1061, 0, 0, 0, 0, 0, 0, 0, 0, 0, 132, 635, 1320, 1023, 3071, 4095, 1365, 2218, 1767, 2636, 3490, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 2706, 2638, 0, 895, 0, 0, 3217, 1927, 796, 1023, 341, 1843, 0, 0, 0, 0, 0, 0, 1602, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 924, 2139, 3465, 4095, 0, 0, 2730, 0, 0, 0, 0, 0, 0, 0, 0, 409, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 409, 0, 620, 4095, 3071, 3698, 744, 0, 827, 1191, 2419, 2047, 0, 0, 0, 0, 0, 0, 537, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 63, 1023, 1170, 1365, 2047, 1638, 2978, 1638, 1457, 1349, 3248, 0, 0, 0, 4095, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 341, 3071, 1023, 1023, 0, 0, 0, 4095, 585, 0, 4095, 0, 0, 0, 682, 0, 0, 0, 1244, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 438, 2730, 2047, 0, 0, 819, 0, 3276, 2098, 2086, 626, 0, 4095, 0, 3764, 4095, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 455, 0, 0, 0, 3830, 0, 4095, 0, 0, 0, 4095, 4095, 0, 2047, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 682, 3071, 558, 1116, 0, 0, 0, 4095, 0, 0, 0, 3510, 4095, 0, 3071, 4095, 2835, 1474, 1370, 51, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1365, 3071, 1791, 2730, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 2957, 4095, 441, 1023, 1142, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 3071, 0, 2586, 4044, 1616, 104, 2362, 1406, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 1489, 2661, 0, 4095, 0, 0, 0, 0, 0, 0, 124, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 2976, 4095, 2502, 4095, 3987, 715, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3953, 68, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 61, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3640, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1417, 4095, 3202, 1335, 1109, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 1535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3412, 4095, 3150, 4095, 3315, 1768, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3420, 4095, 0, 3177, 2047, 2925, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 72, 0, 3550, 0, 2047, 0, 3071, 1023, 3153, 2314, 3302, 0, 0, 0, 0, 0, 0, 0, 3465, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 1365, 4095, 4095, 2687, 1151, 3071, 0, 0, 0, 0, 0, 0, 0, 1516, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1023, 4095, 2047, 0, 0, 0, 0, 4095, 1535, 1023, 2866, 0, 0, 0, 3336, 4095, 2184, 431, 4095, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 364, 3071, 0, 4095, 2559, 2457, 1023, 431, 2481, 2670, 3007, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1365, 4095, 682, 4095, 2457, 3795, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 722, 3722, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 390, 0, 0, 0, 4095, 0, 2047, 1939, 1023, 3150, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 3480, 4095, 1638, 1228, 1170, 2047, 0, 4095, 3071, 2340, 2730, 0, 1365, 0, 4095, 0, 1774, 2275, 218, 1365, 3497, 1238, 2047, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 1365, 0, 0, 0, 1365, 3879, 2233, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1535, 0, 0, 877, 0, 0, 4095, 0, 4095, 0, 38, 3185, 2047, 682, 0, 0, 0, 0, 0, 1023, 1279, 819, 4095, 4095, 455, 1585, 0, 0, 0, 372, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3830, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 2730, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 0, 0, 2677, 4095, 1067, 213, 546, 3711, 3967, 54, 0, 585, 2730, 0, 0, 0, 2925, 1023, 2824, 3412, 292, 3336, 2770, 327, 2047, 0, 0, 2457, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 1246, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 1861, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 2866, 2457, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 2047, 1365, 0, 2457, 0, 0, 0, 0, 4095, 0, 0, 0, 2340, 0, 767, 0, 0, 0, 0, 4095, 3900, 3583, 4095, 1023, 4095, 0, 0, 0, 341, 4095, 2047, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 585, 0, 0, 585, 2275, 0, 0, 1755, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 2129, 3276, 738, 0, 819, 0, 0, 4095, 1082, 2890, 3674, 0, 0, 0, 0, 0, 511, 0, 1890, 0, 0, 0, 0, 0, 405, 2047, 1755, 0, 0, 0, 0, 0, 682, 2345, 1648, 0, 0, 0, 0, 0, 1023, 1365, 2047, 4095, 0, 0, 0, 0, 0, 0, 1676, 0, 0, 0, 0, 0, 1092, 0, 372, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 1365, 0, 4095, 0, 0, 3071, 3480, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2730, 0, 0, 0, 0, 0, 0, 0, 3071, 1365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 3583, 0, 0, 0, 3150, 4095, 4095, 2730, 330, 3185, 1736, 0, 4095, 0, 0, 0, 303, 3241, 2039, 0, 0, 0, 0, 0, 4095, 0, 1755, 0, 0, 0, 4095, 0, 2855, 1842, 1775, 0, 4095, 0, 0, 0, 787, 1365, 1365, 0, 0, 0, 0, 0, 538, 3217, 1794, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 3594, 2047, 16, 3071, 0, 3448, 819, 4095, 3412, 0, 2730, 1023, 819, 1023, 3120, 0, 1915, 1054, 806, 3353, 3128, 309, 1861, 0, 0, 2559, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 2925, 0, 0, 708, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 1462, 3854, 566, 866, 3412, 0, 4095, 3045, 0, 0, 0, 148, 0, 0, 4095, 372, 2632, 2559, 87, 4095, 4053, 1116, 4073, 0, 0, 0, 1365, 0, 0, 2457, 0, 2047, 0, 3987, 2047, 0, 4095, 0, 2730, 2047, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 819, 0, 0, 4095, 0, 0, 4095, 2730, 945, 0, 3276, 4095, 4095, 0, 0, 0, 0, 0, 0, 1365, 0, 0, 1638, 0, 0, 0, 0, 0, 2632, 0, 0, 0, 2047, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 4095, 2925, 2752, 4095, 0, 4095, 0, 787, 0, 0, 0, 0, 0, 0, 2047, 0, 1755, 2702, 2730, 1215, 0, 455, 0, 0, 0, 682, 4095, 2730, 0, 0, 0, 0, 0, 1178, 4095, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 2969, 540, 936, 804, 585, 2730, 4095, 4095, 2377, 1204, 3204, 2386, 1170, 1575, 2149, 4095, 2702, 1551, 685, 2475, 3332, 731, 2047, 0, 0, 919, 2730, 3001, 0, 0, 0, 0, 0, 1310, 4095, 945, 0, 4095, 0, 0, 0, 8, 2047, 2580, 0, 0, 0, 0, 0, 1170, 3510, 85, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 2047, 0, 0, 1365, 1365, 525, 27, 186, 2047, 4095, 1023, 0, 4095, 2047, 2730, 0, 0, 4095, 0, 2457, 1204, 0, 3150, 3071, 1023, 4095, 0, 0, 1023, 4095, 972, 0, 0, 630, 1365, 0, 2457, 0, 1157, 2492, 2649, 2457, 0, 0, 250, 752, 808, 0, 0, 0, 0, 0, 1023, 4095, 23, 0, 0, 0, 0, 0, 2730, 4095, 3399, 0, 2047, 0, 0, 0, 0, 4095, 3896, 2687, 3771, 409, 1023, 0, 1170, 1638, 534, 4095, 0, 2047, 4095, 2622, 464, 1281, 2255, 2755, 763, 0, 0, 0, 958, 534, 530, 1575, 2340, 0, 3017, 0, 0, 4095, 3232, 0, 0, 0, 4095, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 744, 4095, 0, 945, 0, 0, 2047, 4095, 0, 315, 646, 2205, 0, 4095, 1170, 4095, 0, 0, 168, 0, 0, 4095, 3443, 4095, 1394, 1213, 2838, 0, 0, 4095, 0, 0, 0, 4095, 4067, 0, 0, 0, 4095, 0, 342, 3753, 2651, 1575, 0, 819, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 86, 75, 1861, 4095, 4095, 1755, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 585, 2658, 0, 2520, 0, 0, 0, 1023, 1161, 3530, 1823, 341, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3029, 0, 2762, 3071, 0, 0, 186, 4095, 113, 124, 1964, 3951, 3784, 722, 3779, 0, 0, 0, 0, 0, 1365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 262, 0, 2730, 4095, 0, 0, 0, 3344, 3127, 2047, 273, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 1638, 2275, 4095, 3071, 1365, 0, 0, 1489, 2205, 1023, 3071, 3071, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 2047, 4095, 4095, 0, 455, 1575, 0, 2970, 3640, 0, 2047, 819, 1374, 3783, 3182, 2978, 0, 0, 0, 0, 4095, 0, 2730, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 1083, 0, 215, 2340, 1023, 0, 1686, 4095, 478, 1365, 862, 3144, 3963, 455, 0, 0, 1417, 0, 4095, 0, 0, 0, 1279, 0, 2340, 0, 1592, 0, 1638, 0, 877, 0, 0, 0, 534, 1170, 511, 4095, 2221, 2457, 1365, 0, 4022, 660, 3430, 4095, 682, 0, 682, 0, 4095, 2925, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 682, 0, 1774, 0, 3412, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1489, 3412, 0, 2457, 0, 0, 0, 0, 1784, 4095, 658, 2275, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1638, 0, 0, 0, 3276, 0, 1170, 0, 0, 0, 2730, 2886, 0, 341, 2730, 1023, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 511, 0, 4095, 0, 0, 0, 0, 4095, 1535, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 682, 3251, 0, 1260, 0, 682, 682, 0, 3756, 3105, 4095, 4095, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4020, 0, 4095, 0, 0, 0, 0, 1365, 2848, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 18, 2549, 0, 1116, 0, 4095, 3510, 767, 2835, 4095, 4095, 1407, 4095, 4095, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2957, 0, 4095, 0, 0, 4095, 0, 2163, 3771, 2055, 383, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 2047, 0, 0, 2457, 356, 3613, 292, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 1508, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 787, 2835, 0, 4095, 2730, 0, 0, 0, 2349, 3953, 1228, 2047, 0, 0, 2047, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 585, 2175, 0, 2047, 0, 0, 0, 1638, 3035, 2936, 4060, 38, 0, 0, 0, 0, 819, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 327, 2221, 4095, 2766, 1969, 1365, 1275, 1023, 2546, 910, 173, 504, 2047, 0, 0, 0, 1365, 1023, 3510, 0, 1501, 2767, 895, 3289, 3448, 997, 3510, 0, 0, 0, 0, 0, 0, 3412, 0, 2047, 0, 0, 0, 0, 1228, 3600, 3531, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 3071, 0, 0, 2586, 0, 240, 4095, 857, 3549, 4095, 0, 2730, 3071, 4095, 2730, 0, 0, 0, 4095, 3298, 1970, 82, 2925, 4059, 2825, 4095, 0, 0, 0, 0, 0, 0, 3738, 0, 0, 0, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 546, 2925, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 2457, 1365, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 120, 2730, 0, 2730, 0, 819, 1831, 0, 0, 0, 0, 110, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 0, 0, 2985, 3276, 403, 3255, 273, 195, 93, 25, 910, 3350, 2535, 2520, 1820, 1023, 3827, 4095, 1634, 1441, 1643, 3565, 3393, 535, 2940, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 1575, 3685, 1081, 3613, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 315, 3071, 4095, 4095, 4095, 0, 0, 186, 819, 2047, 4095, 3040, 0, 0, 4095, 0, 0, 0, 0, 2047, 4095, 1365, 0, 4095, 4095, 0, 3510, 0, 0, 0, 0, 0, 0, 3003, 0, 0, 0, 0, 0, 4095, 3071, 0, 511, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 3622, 1365, 0, 2047, 0, 0, 0, 0, 4095, 0, 4095, 4095, 4095, 0, 3510, 0, 1320, 982, 455, 3307, 3583, 1772, 1365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2448, 0, 3223, 0, 0, 0, 0, 0, 0, 2925, 0, 0, 1170, 0, 3071, 0, 2294, 1023, 0, 0, 1638, 0, 4095, 0, 315, 0, 2875, 0, 3003, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3685, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 3071, 3071, 0, 682, 0, 585, 0, 3549, 0, 3071, 0, 4095, 0, 1023, 0, 585, 0, 4095, 0, 1170, 0, 0, 0, 3185, 0, 1489, 2730, 1023, 0, 2730, 0, 0, 4095, 1365, 0, 2047, 4095, 0, 0, 0, 0, 0, 0, 1023, 0, 1755, 0, 2047, 3276, 240, 0, 0, 0, 2972, 0, 3916, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 398, 0, 282, 0, 337, 0, 735, 4095, 267, 1023, 2808, 0, 455, 0, 485, 0, 619, 0, 534, 0, 2047, 4095, 777, 0, 341, 2492, 822, 0, 525, 0, 1394, 0, 3412, 0, 283, 0, 461, 0, 2260, 0, 697, 0, 3595, 0, 521, 0, 409, 0, 1417, 0, 3640, 1498, 4038, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 89, 1365, 1638, 0, 0, 0, 0, 2730, 1638, 0, 511, 0, 0, 4095, 0, 0, 895, 4095, 4095, 0, 0, 0, 0, 455, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 1842, 4095, 712, 0, 0, 0, 0, 4095, 1260, 3738, 2784, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 1023, 0, 390, 4095, 4095, 0, 0, 0, 2047, 4095, 341, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 1109, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 2730, 0, 0, 4095, 0, 0, 2457, 0, 0, 4095, 4095, 4095, 0, 0, 0, 0, 1686, 4095, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 3228, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 585, 0, 0, 0, 4095, 0, 4095, 0, 4095, 3276, 0, 0, 0, 0, 0, 0, 4095, 1365, 0, 2340, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 2047, 3276, 787, 0, 0, 0, 0, 0, 2047, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 2835, 227, 2275, 1638, 2372, 337, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 3679, 3992, 3276, 3753, 2835, 3510, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 2047, 0, 646, 0, 499, 0, 0, 4095, 0, 682, 0, 0, 0, 0, 4095, 0, 2047, 0, 1656, 0, 2457, 0, 666, 0, 3755, 0, 2275, 4095, 4056, 0, 1876, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 3101, 0, 3875, 0, 455, 4095, 120, 0, 606, 0, 2953, 0, 0, 0, 2860, 151, 1228, 3412, 999, 253, 4095, 0, 1023, 4095, 0, 0, 2730, 0, 0, 0, 3404, 4095, 3916, 4095, 3276, 3850, 0, 1092, 307, 4095, 0, 0, 2730, 0, 2047, 0, 0, 0, 2047, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 1004, 3583, 0, 0, 2526, 0, 2340, 0, 910, 0, 0, 0, 0, 0, 0, 0, 517, 0, 2320, 2632, 2104, 65, 1489, 0, 1365, 4095, 3967, 0, 2047, 0, 3071, 0, 3872, 1023, 2925, 0, 0, 0, 819, 1023, 2047, 0, 1791, 0, 1861, 0, 0, 0, 2457, 4095, 3892, 4095, 1734, 175, 3350, 0, 2730, 0, 3071, 0, 2167, 0, 4095, 0, 0, 511, 0, 0, 4010, 0, 3770, 0, 1769, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 585, 0, 3863, 0, 0, 4095, 0, 0, 455, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 546, 0, 0, 0, 0, 0, 273, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 1820, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 2730, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 2605, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 195, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3583, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 1456, 0, 0, 0, 0, 0, 585, 237, 491, 0, 1365, 1054, 885, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 2047, 0, 2047, 0, 1384, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 372, 0, 0, 2047, 0, 0, 1365, 1023, 0, 0, 0, 0, 0, 0, 0, 1419, 2898, 1535, 3336, 830, 1216, 4095, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 1462, 0, 0, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 1575, 0, 0, 3071, 1129, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 341, 0, 4095, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3839, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2275, 0, 0, 0, 840, 0, 3071, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 1023, 0, 1890, 0, 273, 2047, 4095, 141, 0, 0, 0, 0, 4095, 0, 341, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 819, 0, 0, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 682, 0, 2155, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 963, 0, 3350, 0, 4095, 0, 3071, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2408, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 1365, 0, 0, 0, 1279, 0, 2047, 4095, 0, 2047, 2047, 0, 3071, 0, 0, 0, 0, 4095, 4095, 0, 2605, 0, 1204, 0, 0, 4095, 2730, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1267, 0, 3685, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 2047, 2502, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 455, 0, 2233, 4095, 455, 0, 0, 0, 0, 409, 3780, 1023, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 4095, 4095, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 585, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 1260, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 819, 3858, 0, 315, 0, 3802, 4095, 0, 0, 0, 0, 0, 0, 0, 819, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 3510, 0, 0, 4095, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 4095, 4095, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 682, 56, 0, 3071, 1630, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 4095, 4095, 4095, 3863, 4095, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 630, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 910, 0, 0, 4095, 0, 4095, 0, 3217, 2457, 0, 4095, 984, 189, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 409, 1560, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 3712, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 941, 4095, 1551, 975, 3342, 2545, 585, 4095, 0, 4095, 0, 0, 1170, 4095, 2835, 0, 2800, 4095, 2340, 0, 1616, 481, 3827, 0, 4095, 0, 0, 0, 1820, 0, 0, 0, 1638, 2835, 0, 682, 2347, 109, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 4095, 455, 0, 2535, 0, 0, 0, 2367, 0, 0, 0, 682, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 1638, 0, 0, 0, 0, 0, 0, 0, 1365, 4095, 0, 0, 516, 1170, 0, 0, 282, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 2047, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 2291, 4095, 1023, 3150, 1396, 19, 3395, 4095, 1842, 0, 906, 1116, 2340, 0, 2184, 3071, 2925, 4095, 1137, 3150, 1013, 385, 2617, 1433, 117, 3480, 3150, 236, 2815, 0, 0, 0, 2774, 3247, 546, 1755, 68, 18, 2233, 0, 2047, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2457, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 1965, 4095, 1365, 2730, 2243, 0, 4095, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 4095, 4095, 0, 0, 4095, 93, 4095, 0, 0, 0, 4095, 0, 819, 0, 4095, 0, 3029, 4095, 819, 963, 3598, 565, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3114, 4095, 455, 1755, 2272, 217, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3190, 4095, 1338, 123, 693, 33, 1755, 4095, 880, 2331, 0, 0, 4095, 382, 0, 0, 0, 0, 0, 0, 725, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1228, 4095, 2340, 0, 114, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 204, 4095, 1365, 0, 4095, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 3164, 4095, 4019, 0, 61, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2205, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2978, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 4095, 0, 0, 2457, 3839, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 819, 2047, 4095, 819, 0, 2047, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3830, 0, 864, 0, 3180, 0, 0, 0, 1365, 3583, 542, 2980, 0, 0, 3276, 2285, 3671, 0, 0, 0, 0, 0, 4095, 0, 3969, 360, 3102, 1405, 2978, 129, 0, 0, 423, 0, 97, 0, 455, 0, 0, 0, 0, 0, 0, 0, 1365, 0, 0, 0, 0, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2502, 0, 819, 0, 1638, 0, 877, 4095, 520, 3468, 819, 0, 2502, 2340, 1365, 0, 409, 4095, 1320, 1638, 2835, 3962, 2866, 0, 3185, 838, 3822, 0, 1489, 0, 787, 4095, 455, 0, 2047, 4095, 3150, 0, 731, 0, 1228, 0, 744, 0, 1023, 0, 585, 4095, 1023, 0, 0, 0, 3873, 0, 4095, 2047, 0, 0, 0, 0, 3150, 0, 0, 0, 1268, 0, 559, 0, 993, 0, 1237, 4095, 1006, 3762, 2457, 0, 1485, 2233, 1012, 0, 821, 0, 744, 0, 1392, 0, 1212, 0, 1772, 3378, 831, 0, 1008, 0, 2564, 0, 1023, 0, 712, 0, 1440, 0, 2179, 0, 558, 0, 2145, 0, 521, 0, 1092, 0, 327, 0, 1638, 4095, 3995, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 1768, 4095, 625, 2689, 0, 0, 4095, 715, 4095, 694, 3071, 3812, 4095, 0, 4095, 0, 4095, 17, 0, 4095, 4095, 81, 0, 102, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 682, 4095, 1043, 0, 0, 0, 0, 2596, 2327, 225, 2941, 4095, 2047, 4095, 1068, 4095, 0, 0, 3802, 4095, 0, 4095, 2047, 315, 182, 4095, 3401, 4095, 592, 0, 0, 0, 1365, 1137, 1521, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 4095, 0, 0, 0, 2047, 0, 1320, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 3412, 2193, 39, 2218, 0, 4095, 4095, 1116, 0, 0, 0, 0, 4095, 2730, 4095, 0, 0, 1228, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1638, 0, 356, 1575, 0, 0, 4095, 819, 4095, 646, 4095, 2730, 0, 0, 4095, 0, 0, 826, 65, 1719, 4095, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 2161, 1365, 776, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1365, 0, 3931, 0, 0, 0, 2047, 0, 819, 0, 4095, 2047, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2118, 0, 4095, 0, 0, 0, 0, 0, 3071, 3613, 528, 3047, 0, 0, 4095, 2730, 2559, 0, 2320, 0, 0, 0, 4095, 0, 3685, 3518, 297, 2879, 3767, 0, 2730, 0, 0, 0, 856, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 0, 0, 0, 585, 0, 0, 0, 3071, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2730, 0, 1170, 4095, 0, 4095, 3185, 0, 0, 4095, 0, 0, 0, 0, 0, 215, 0, 4095, 4095, 4095, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 1170, 0, 0, 0, 4095, 0, 0, 0, 3583, 0, 2559, 0, 4095, 0, 3071, 4095, 1686, 2340, 4095, 0, 4095, 0, 4095, 0, 1365, 0, 0, 0, 2730, 0, 4095, 945, 4095, 1365, 2047, 0, 2457, 0, 4095, 0, 0, 4095, 2730, 0, 2730, 0, 3663, 491, 3071, 0, 0, 0, 1820, 0, 0, 0, 0, 0, 3071, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 3350, 885, 409, 3640, 4095, 0, 4095, 706, 2925, 664, 491, 2815, 3071, 585, 4095, 3722, 89, 48, 250, 148, 4062, 124, 0, 0, 0, 0, 182, 455, 0, 0, 0, 0, 0, 568, 2047, 3221, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3003, 0, 0, 0, 0, 0, 409, 4095, 2047, 0, 0, 0, 0, 1755, 0, 0, 2324, 0, 0, 4095, 0, 0, 630, 0, 455, 0, 0, 4095, 4095, 3360, 5, 0, 3862, 1216, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 112, 0, 0, 0, 0, 0, 0, 0, 2730, 455, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 877, 4095, 124, 3661, 2047, 0, 4095, 1768, 1820, 409, 0, 1694, 0, 1023, 2925, 4095, 4010, 1566, 783, 3488, 3050, 103, 2047, 0, 0, 787, 4095, 1365, 0, 0, 0, 0, 0, 1023, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 3071, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3276, 4095, 255, 3320, 0, 0, 4095, 1755, 0, 0, 0, 0, 0, 4095, 4095, 0, 4095, 2897, 0, 4095, 2925, 2121, 4095, 0, 0, 0, 4095, 3071, 0, 0, 0, 0, 0, 4095, 4095, 2184, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 2835, 4095, 361, 2492, 0, 0, 4095, 982, 0, 0, 0, 4095, 1365, 0, 4095, 0, 0, 0, 0, 551, 458, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 372, 0, 0, 0, 2388, 0, 0, 4095, 0, 0, 4095, 4095, 819, 0, 0, 0, 1755, 0, 409, 0, 0, 0, 4095, 0, 143, 0, 1023, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 227, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 374, 4095, 679, 3085, 0, 0, 4095, 849, 3836, 1253, 1417, 2957, 1474, 511, 4095, 4095, 1785, 1883, 303, 3966, 4070, 670, 0, 0, 4095, 4095, 0, 0, 4095, 4095, 4095, 0, 4095, 0, 4095, 0, 4095, 0, 0, 0, 4095, 4095, 4095, 0, 4095, 0, 0, 0, 2047, 4095, 0, 0, 0, 0, 4095, 0, 0, 0, 4058, 0, 4095, 0, 4056, 0, 3663, 4095, 3054, 3634, 4095, 0, 4095, 2221, 3762, 1072, 4037, 3722, 3434, 409, 3836, 0, 3590, 0, 2024, 3974, 3403, 33, 4008, 0, 4050, 0, 4095, 0, 4095, 0, 4074, 0, 4095, 0, 4095, 0, 3802, 0, 4095, 0, 630, 0, 0, 0, 4095, 0, 0, 0, 2388, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2730, 4095, 85, 3037, 0, 0, 4095, 1480, 1215, 639, 199, 2529, 3088, 2186, 3867, 0, 1827, 0, 0, 3802, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 2925, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 119, 0, 419, 843, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 4095, 0, 3412, 0, 0, 4095, 1365, 0, 0, 0, 4095, 1638, 3510, 4095, 4095, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4037, 0, 0, 4095, 4095, 4095, 0, 0, 0, 0, 2730, 0, 0, 0, 0, 0, 0, 0, 3071, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 1204, 0, 195, 910, 0, 0, 4095, 0, 4095, 1023, 0, 4019, 2408, 3448, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2457, 0, 0, 0, 292, 0, 0, 0, 2586, 4095, 0, 2829, 0, 0, 4095, 341, 3350, 0, 0, 0, 0, 0, 4095, 0, 3613, 195, 0, 0, 1412, 0, 2047, 0, 0, 0, 0, 0, 273, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3510, 0, 2730, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 1365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1365, 4095, 0, 630, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2457, 0, 2457, 0, 0, 0, 1671, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 3812, 0, 2047, 0, 2047, 0, 1553, 0, 4095, 0, 1023, 2730, 3071, 2730, 0, 4095, 2564, 2798, 117, 2661, 4034, 3347, 2047, 0, 4095, 0, 4095, 0, 2730, 0, 4095, 0, 4095, 0, 4095, 0, 4095, 0, 0, 0, 1755, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 3071, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 4095, 1638, 3412, 2047, 2047, 4095, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 9, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 3722, 3861, 3219, 0, 3185, 3903, 2881, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1365, 0, 0, 0, 273, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1010, 4095, 4095, 0, 0, 0, 3677, 0, 3150, 0, 0, 0, 1023, 0, 1204, 0, 0, 0, 910, 0, 0, 0, 1365, 0, 0, 0, 819, 0, 0, 0, 0, 0, 0, 0, 2457, 0, 3890, 0, 4095, 0, 0, 0, 2730, 0, 2730, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 4095, 3276, 0, 0, 4095, 0, 0, 0, 4095, 4095, 544, 0, 4095, 0, 0, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 3583, 0, 1240, 0, 0, 0, 0, 0, 0, 1365, 0, 1691, 0, 0, 0, 0, 0, 3860, 0, 1424, 0, 0, 0, 0, 0, 1153, 1842, 1590, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1204, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 112, 0, 0, 0, 151, 2866, 1302, 0, 1755, 0, 0, 4095, 930, 0, 2233, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 585, 0, 0, 0, 0, 0, 0, 0, 431, 162, 207, 0, 0, 0, 0, 0, 70, 0, 157, 0, 0, 0, 0, 0, 0, 3, 283, 0, 0, 0, 0, 0, 34, 0, 0, 0, 0, 0, 0, 0, 630, 4095, 4095, 0, 0, 0, 0, 0, 1198, 0, 0, 0, 0, 0, 0, 0, 1820, 4095, 0, 4095, 0, 0, 0, 0, 1535, 0, 0, 0, 0, 0, 0, 0, 2457, 0, 0, 0, 0, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 356, 2730, 1155, 0, 0, 0, 0, 0, 0, 0, 1508, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2730, 1365, 1825, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 1638, 0, 0, 0, 0, 0, 0, 4095, 0, 3276, 682, 900, 273, 0, 1861, 4095, 3583, 0, 0, 0, 0, 0, 1706, 1638, 963, 2730, 819, 2457, 423, 0, 2388, 682, 1365, 0, 0, 0, 0, 0, 2730, 2013, 1835, 2730, 0, 1556, 178, 0, 75, 4095, 2632, 0, 0, 0, 0, 0, 3071, 0, 585, 0, 0, 0, 0, 0, 2340, 0, 240, 0, 0, 0, 0, 4095, 1535, 511, 910, 273, 0, 0, 0, 0, 1365, 0, 255, 327, 0, 1365, 0, 0, 1228, 1750, 0, 4095, 0, 4095, 0, 3583, 2559, 1365, 70, 186, 0, 0, 0, 819, 157, 2759, 750, 1456, 319, 1548, 433, 0, 132, 0, 167, 0, 0, 2730, 0, 0, 3276, 0, 67, 2047, 0, 3992, 0, 0, 2275, 122, 3131, 455, 0, 2730, 0, 0, 2145, 667, 895, 2578, 1023, 1688, 170, 0, 2559, 0, 4095, 0, 0, 0, 0, 0, 2730, 3572, 2957, 0, 4095, 3071, 3802, 0, 3071, 0, 3958, 0, 0, 0, 0, 0, 3738, 2047, 409, 4095, 0, 0, 0, 0, 3510, 0, 2457, 0, 0, 0, 0, 0, 2730, 2730, 2047, 0, 0, 2047, 0, 0, 2730, 592, 341, 0, 0, 0, 0, 0, 1706, 0, 0, 2730, 2047, 2047, 0, 0, 1820, 819, 1023, 4095, 0, 0, 0, 0, 2047, 4095, 2047, 4095, 4095, 0, 0, 0, 2233, 2632, 1077, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 2047, 1927, 0, 0, 1462, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 1820, 1783, 1453, 0, 0, 0, 0, 0, 0, 2866, 2184, 0, 0, 0, 0, 0, 1226, 4095, 2935, 0, 0, 0, 0, 0, 563, 2605, 1092, 0, 4095, 0, 0, 0, 1215, 2730, 972, 0, 0, 0, 0, 0, 1201, 1729, 1419, 0, 0, 0, 0, 0, 622, 2266, 771, 0, 0, 0, 0, 0, 1964, 2925, 3174, 0, 0, 0, 0, 0, 1890, 0, 853, 0, 0, 0, 0, 0, 892, 4095, 666, 0, 0, 0, 0, 0, 1671, 4095, 1837, 0, 0, 0, 0, 0, 2616, 0, 2047, 0, 0, 0, 0, 0, 1137, 4095, 113, 0, 0, 0, 0, 0, 625, 2800, 725, 0, 0, 0, 0, 0, 988, 0, 80, 0, 0, 0, 0, 0, 705, 141, 1384, 0, 0, 0, 0, 0, 1873, 4095, 1521, 0, 0, 0, 0, 0, 2149, 1170, 2261, 0, 0, 0, 0, 0, 3185, 0, 1365, 0, 0, 0, 0, 0, 1185, 819, 1146, 0, 0, 0, 0, 0, 1703, 819, 690, 0, 0, 0, 0, 0, 446, 2413, 342, 0, 0, 2047, 1365, 0, 1896, 0, 662, 0, 0, 0, 0, 0, 1911, 0, 0, 0, 0, 0, 0, 0, 179, 0, 792, 0, 0, 0, 0, 0, 2605, 4095, 2047, 0, 0, 0, 0, 0, 1058, 0, 3412, 0, 0, 0, 0, 0, 2730, 1170, 1137, 2047, 3276, 1445, 620, 0, 0, 0, 2457, 0, 0, 0, 0, 0, 0, 1023, 3150, 0, 0, 4095, 0, 0, 356, 4095, 3276, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3465, 0, 4095, 2047, 4095, 0, 4095, 1939, 955, 2047, 4095, 0, 0, 1023, 0, 1023, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 0, 0, 0, 0, 3071, 0, 0, 0, 0, 304, 273, 26, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 3071, 0, 511, 0, 260, 1161, 0, 1293, 1365, 315, 4095, 2957, 1706, 2509, 979, 1445, 0, 0, 2457, 0, 0, 0, 4095, 0, 2520, 0, 4095, 0, 178, 0, 0, 0, 396, 0, 0, 0, 0, 16, 819, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 78, 0, 2047, 0, 0, 0, 1023, 0, 199, 0, 0, 0, 0, 0, 4095, 4095, 0, 3583, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 4095, 4095, 4095, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 3510, 0, 0, 0, 0, 0, 0, 0, 4095, 754, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 2047, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 89, 204, 0, 4095, 4095, 3071, 0, 372, 2946, 3363, 2605, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2559, 2622, 0, 576, 9, 5, 0, 468, 107, 1240, 50, 1789, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 38, 0, 0, 0, 0, 0, 0, 163, 39, 0, 2730, 0, 0, 0, 3412, 455, 0, 0, 0, 0, 0, 682, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 855, 0, 224, 0, 0, 0, 3937, 100, 38, 7, 64, 0, 0, 0, 0, 2, 0, 128, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 151, 4095, 0, 0, 2388, 2047, 4095, 2047, 2818, 2405, 3082, 0, 0, 0, 4095, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 2047, 4095, 4095, 2730, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 1023, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 341, 1204, 2047, 4095, 0, 4079, 1849, 2508, 1554, 0, 4095, 0, 3455, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1911, 1365, 2730, 0, 0, 0, 0, 4095, 2730, 0, 0, 0, 0, 0, 0, 0, 4095, 2457, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3276, 2457, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 3948, 4095, 0, 3412, 3753, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2123, 4095, 0, 1686, 0, 2047, 0, 0, 0, 3285, 75, 0, 0, 0, 0, 0, 3685, 0, 0, 2047, 2730, 0, 0, 0, 0, 0, 0, 0, 0, 0, 819, 0, 1260, 0, 0, 3510, 292, 4095, 0, 0, 0, 4095, 1170, 0, 0, 0, 0, 0, 3165, 4095, 560, 2303, 4022, 105, 3780, 0, 4095, 0, 157, 0, 0, 0, 0, 0, 3802, 2925, 0, 1124, 26, 0, 0, 0, 0, 4095, 124, 0, 0, 0, 0, 0, 1535, 0, 29, 0, 1023, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 4095, 0, 2340, 4095, 4095, 0, 0, 0, 4095, 4095, 0, 0, 4095, 0, 0, 3583, 4095, 0, 4095, 3351, 829, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 1501, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 3276, 3393, 3071, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 2730, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4005, 4095, 0, 4095, 0, 819, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 3276, 4095, 0, 4095, 2970, 31, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 3276, 4095, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 501, 4095, 0, 4095, 1565, 4095, 0, 0, 0, 819, 0, 0, 0, 0, 0, 0, 3780, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3719, 3708, 630, 664, 2730, 2730, 4095, 0, 0, 0, 3241, 2233, 1188, 0, 0, 0, 2047, 0, 0, 0, 4089, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 16, 2649, 0, 0, 0, 0, 4095, 949, 151, 998, 0, 0, 0, 1724, 0, 0, 0, 2730, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2656, 4095, 0, 0, 0, 1023, 0, 0, 0, 0, 3276, 2047, 4095, 0, 0, 0, 3583, 4095, 0, 682, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2113, 0, 4095, 1861, 1861, 455, 195, 2063, 2480, 3246, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1023, 2047, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 2925, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 682, 0, 0, 0, 0, 2730, 0, 1365, 1137, 3150, 3412, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 1023, 273, 0, 546, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 682, 0, 4095, 0, 0, 0, 0, 819, 2340, 4095, 0, 0, 0, 1755, 511, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 819, 0, 0, 0, 0, 0, 2047, 0, 682, 0, 585, 0, 0, 3372, 4095, 0, 0, 0, 0, 0, 33, 0, 4095, 0, 0, 0, 585, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 2047, 4095, 0, 0, 1246, 3465, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 4095, 0, 0, 0, 0, 2457, 0, 4095, 4095, 1023, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 4095, 2340, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1023, 0, 0, 0, 4095, 1638, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1023, 255, 0, 0, 0, 0, 0, 1755, 4095, 4095, 4095, 4095, 0, 0, 0, 862, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 744, 4095, 0, 0, 0, 0, 102, 30, 0, 0, 0, 2457, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 423, 4095, 1137, 0, 4095, 0, 0, 0, 1023, 2047, 2431, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 62, 0, 0, 0, 0, 0, 81, 252, 215, 0, 270, 0, 0, 0, 130, 0, 1958, 74, 0, 0, 0, 0, 409, 0, 25, 23, 0, 0, 0, 0, 0, 0, 1023, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 4095, 0, 1412, 4095, 4095, 0, 117, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 282, 0, 0, 0, 0, 0, 0, 0, 2340, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 4095, 4095, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 3322, 2047, 1820, 0, 4095, 3967, 0, 0, 3276, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 2047, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 682, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 2047, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 4095, 0, 4095, 0, 0, 409, 511, 0, 4095, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 511, 0, 0, 936, 0, 1170, 0, 30, 0, 2047, 0, 0, 585, 0, 2890, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3071, 0, 4095, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2730, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 1638, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 2047, 0, 4095, 0, 1445, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2205, 0, 3446, 0, 0, 0, 0, 0, 930, 3839, 347, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 2233, 0, 0, 4095, 0, 0, 0, 0, 884, 3372, 688, 0, 0, 0, 1023, 0, 0, 2047, 1023, 0, 0, 0, 0, 0, 0, 0, 146, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1618, 4095, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1602, 1489, 0, 0, 75, 0, 0, 0, 0, 0, 1508, 2126, 2641, 2851, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 0, 3311, 0, 0, 0, 0, 0, 4095, 0, 1936, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 4095, 2866, 1365, 0, 4095, 0, 2047, 0, 0, 0, 0, 0, 1328, 2047, 1706, 0, 0, 0, 0, 0, 292, 0, 481, 1365, 2298, 0, 1787, 0, 0, 0, 1240, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3071, 0, 0, 0, 0, 0, 0, 0, 0, 1023, 2047, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 3640, 2047, 2047, 2925, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3510, 2675, 0, 3656, 0, 0, 0, 3567, 469, 3991, 1105, 2730, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 0, 0, 0, 639, 1663, 0, 4095, 780, 0, 0, 3412, 372, 3071, 248, 0, 0, 0, 409, 0, 167, 0, 0, 0, 2730, 0, 0, 0, 0, 0, 0, 0, 292, 0, 0, 0, 0, 110, 0, 3412, 0, 0, 0, 3679, 151, 3924, 35, 60, 0, 0, 0, 0, 0, 0, 170, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 1706, 0, 4095, 4095, 3106, 0, 2854, 3937, 2948, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 819, 0, 0, 214, 959, 0, 2586, 2866, 630, 2890, 3388, 3843, 4047, 3109, 294, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 2047, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 392, 0, 4095, 4095, 0, 0, 4095, 2388, 3426, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 409, 0, 4095, 4095, 0, 0, 4095, 2649, 4095, 341, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 1927, 487, 0, 2184, 4095, 4095, 0, 1575, 2096, 863, 1023, 4095, 0, 4095, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 2457, 1116, 0, 4095, 170, 0, 0, 3693, 3396, 3791, 3174, 102, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 0, 0, 2047, 0, 0, 0, 4095, 0, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 151, 61, 0, 1755, 0, 93, 4095, 0, 2477, 0, 1279, 15, 54, 2541, 0, 0, 3886, 1102, 0, 0, 4095, 227, 0, 0, 0, 1228, 0, 0, 0, 0, 0, 0, 3839, 372, 0, 4095, 4095, 0, 0, 3802, 789, 688, 0, 0, 4095, 0, 0, 0, 4095, 57, 0, 0, 4095, 361, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 3780, 211, 0, 4095, 0, 0, 0, 4095, 341, 3071, 0, 0, 4095, 0, 0, 0, 0, 682, 0, 0, 4095, 348, 0, 0, 4095, 372, 0, 0, 4095, 0, 0, 0, 4095, 2047, 0, 4095, 4095, 67, 0, 3668, 1755, 936, 4095, 4095, 4095, 971, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 2730, 780, 0, 4095, 0, 0, 0, 3871, 3603, 4095, 1907, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 2815, 0, 4095, 0, 0, 0, 4095, 932, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 31, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1365, 0, 0, 0, 0, 996, 0, 4095, 0, 0, 0, 3583, 3890, 3239, 2605, 0, 0, 0, 4095, 0, 409, 0, 0, 0, 2275, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 5, 111, 0, 135, 2340, 1196, 2866, 1911, 1791, 455, 473, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 121, 1730, 0, 2537, 1083, 1424, 4095, 3603, 1860, 401, 15, 356, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1365, 0, 3412, 0, 0, 0, 2978, 0, 4095, 245, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 819, 0, 0, 4095, 0, 0, 0, 0, 14, 2047, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3685, 0, 0, 0, 0, 0, 2047, 0, 86, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 1023, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 0, 3164, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 1365, 0, 0, 0, 0, 0, 2730, 2047, 4095, 2047, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2921, 0, 0, 0, 0, 0, 2047, 3071, 0, 481, 3958, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3071, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 3412, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 1023, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 2457, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 3465, 4095, 0, 4095, 585, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 2520, 1572, 1389, 0, 0, 0, 0, 0, 3368, 0, 2866, 0, 0, 0, 0, 4095, 1228, 4095, 2223, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 3510, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 58, 4095, 533, 0, 0, 0, 0, 0, 1496, 4095, 3946, 4095, 0, 0, 0, 0, 1535, 4095, 2047, 0, 0, 0, 0, 0, 843, 4095, 3071, 4095, 0, 0, 0, 0, 273, 1462, 2967, 0, 0, 0, 0, 0, 2388, 4095, 2457, 4095, 1638, 0, 0, 4095, 1290, 0, 1883, 3350, 31, 0, 0, 0, 819, 0, 2047, 0, 0, 0, 0, 0, 682, 0, 0, 0, 0, 0, 0, 3685, 1755, 0, 0, 0, 0, 0, 0, 4095, 682, 0, 0, 0, 0, 0, 0, 2457, 186, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1861, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 481, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 240, 0, 0, 4095, 585, 0, 0, 4095, 780, 4095, 890, 4095, 2866, 0, 0, 0, 0, 0, 2167, 4095, 0, 0, 0, 4095, 2925, 0, 3150, 0, 0, 0, 0, 0, 1783, 1876, 1686, 4095, 1365, 0, 0, 0, 3276, 4095, 0, 0, 2047, 0, 0, 0, 0, 4095, 1638, 0, 0, 0, 0, 0, 4095, 0, 0, 323, 801, 2317, 630, 0, 0, 0, 3822, 0, 0, 0, 0, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 946, 2472, 3510, 4095, 113, 4095, 0, 0, 0, 1023, 0, 0, 0, 0, 0, 0, 0, 3276, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3071, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1638, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3071, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 62, 75, 16, 115, 136, 4095, 0, 0, 0, 186, 0, 0, 0, 0, 0, 0, 2730, 3115, 0, 0, 938, 107, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3613, 3890, 0, 0, 3071, 3685, 0, 0, 4095, 1831, 0, 0, 0, 0, 0, 0, 0, 2205, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 2730, 1365, 0, 0, 455, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1365, 0, 0, 3071, 4095, 1881, 1023, 0, 1365, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 3640, 2047, 1445, 0, 0, 0, 0, 4095, 0, 4095, 1116, 468, 3217, 785, 88, 0, 1481, 4095, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 1701, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 682, 585, 1409, 0, 0, 0, 0, 0, 0, 0, 1092, 0, 0, 0, 0, 0, 2047, 4095, 2998, 0, 0, 0, 0, 0, 659, 400, 156, 0, 0, 0, 0, 0, 230, 885, 2888, 0, 0, 0, 0, 0, 0, 0, 511, 0, 0, 0, 0, 0, 926, 217, 2233, 0, 0, 0, 0, 0, 315, 0, 239, 0, 0, 0, 0, 0, 0, 0, 2185, 0, 0, 0, 0, 0, 0, 1638, 1260, 0, 0, 0, 0, 0, 2047, 0, 20, 0, 0, 0, 0, 0, 0, 0, 37, 0, 0, 0, 0, 0, 0, 0, 113, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 2184, 1391, 0, 0, 0, 0, 0, 341, 0, 2804, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 101, 0, 0, 0, 0, 0, 939, 4095, 1638, 0, 0, 0, 0, 0, 792, 1143, 1324, 0, 0, 877, 819, 0, 0, 0, 396, 0, 0, 0, 0, 0, 3412, 0, 0, 0, 0, 292, 0, 0, 0, 0, 276, 0, 0, 0, 0, 0, 868, 0, 585, 0, 0, 4095, 0, 0, 921, 0, 0, 0, 0, 0, 0, 0, 0, 682, 1755, 1365, 2457, 900, 2047, 0, 0, 0, 2978, 0, 0, 0, 0, 0, 0, 3510, 3640, 0, 0, 0, 0, 0, 409, 4095, 2047, 0, 0, 0, 0, 0, 0, 2730, 0, 0, 0, 1023, 682, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1251, 0, 81, 0, 2545, 0, 341, 0, 113, 0, 0, 0, 0, 0, 47, 0, 2146, 0, 0, 0, 0, 0, 66, 1799, 0, 0, 341, 0, 0, 0, 1170, 0, 722, 0, 372, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 2730, 0, 3802, 0, 4095, 0, 3802, 2730, 0, 0, 4095, 0, 4095, 0, 4095, 0, 0, 0, 2047, 0, 4095, 0, 3953, 0, 2730, 0, 0, 0, 4095, 0, 3372, 4095, 0, 0, 4074, 3583, 4095, 0, 3120, 1023, 1365, 0, 3997, 3510, 0, 0, 4095, 3816, 0, 0, 1365, 4095, 1992, 0, 3536, 3879, 0, 0, 4095, 4095, 0, 0, 0, 0, 1178, 0, 1958, 0, 2766, 0, 2687, 0, 910, 0, 4023, 0, 1820, 0, 2167, 0, 2526, 0, 2925, 0, 2340, 0, 1755, 0, 2047, 0, 2490, 0, 1592, 0, 3071, 0, 0, 0, 1820, 0, 1023, 0, 2869, 3112, 1575, 0, 3241, 4095, 1438, 0, 0, 0, 0, 0, 4023, 3780, 3620, 0, 0, 0, 0, 0, 4095, 3350, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 100, 96, 0, 0, 0, 2730, 0, 0, 319, 1755, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3276, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 0, 0, 1023, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3372, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 4008, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 1638, 0, 4095, 576, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 3780, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2340, 0, 3712, 4095, 0, 2605, 2943, 30, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2730, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1158, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 0, 2900, 0, 0, 0, 4095, 0, 2047, 0, 0, 0, 0, 0, 4095, 0, 2047, 0, 2233, 0, 0, 0, 4095, 0, 0, 0, 1365, 0, 0, 0, 511, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 796, 0, 2413, 0, 2340, 0, 1954, 0, 2411, 0, 3434, 0, 1535, 0, 511, 0, 3666, 0, 0, 0, 0, 0, 2730, 0, 819, 0, 420, 0, 472, 0, 2047, 0, 877, 4095, 3726, 0, 477, 0, 2465, 0, 0, 0, 4023, 0, 3110, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1489, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3961, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3185, 3583, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3845, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 819, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 2730, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1023, 0, 0, 146, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3879, 0, 481, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1489, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 3071, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 1365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 2047, 4095, 0, 2047, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 963, 0, 0, 0, 819, 0, 1023, 0, 0, 0, 1365, 0, 0, 0, 2340, 0, 409, 0, 2047, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 819, 0, 0, 0, 0, 0, 0, 0, 2457, 0, 2890, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 511, 0, 0, 0, 0, 0, 3071, 0, 0, 0, 0, 0, 0, 0, 1585, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 819, 0, 0, 0, 0, 0, 0, 0, 141, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 75, 0, 0, 0, 1170, 2978, 1228, 0, 0, 0, 0, 0, 1063, 0, 3480, 0, 0, 0, 0, 0, 682, 0, 0, 0, 0, 0, 0, 0, 585, 4095, 409, 0, 0, 0, 0, 0, 1462, 1489, 661, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 66, 1724, 0, 1253, 0, 0, 0, 0, 0, 0, 1023, 250, 0, 0, 0, 0, 0, 3071, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 455, 0, 585, 0, 0, 0, 0, 0, 0, 0, 1279, 0, 0, 0, 0, 0, 2047, 0, 1023, 0, 0, 0, 0, 0, 2730, 2925, 1662, 0, 0, 0, 0, 1638, 1365, 0, 0, 0, 0, 0, 0, 0, 1755, 4095, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 400, 0, 2874, 0, 0, 0, 3412, 0, 0, 0, 4095, 0, 945, 0, 3989, 0, 3150, 0, 0, 0, 2632, 0, 0, 0, 819, 0, 0, 0, 3232, 0, 62, 0, 0, 0, 0, 0, 0, 0, 2047, 240, 511, 0, 0, 0, 0, 0, 0, 1050, 585, 4095, 0, 0, 0, 0, 0, 0, 2349, 0, 4095, 0, 0, 0, 0, 0, 2801, 0, 2730, 0, 1861, 0, 2559, 0, 1023, 0, 3150, 0, 1116, 0, 0, 0, 819, 0, 1516, 0, 1170, 0, 2047, 0, 3536, 3900, 3412, 0, 3327, 0, 4095, 0, 511, 2520, 0, 0, 2730, 0, 819, 0, 546, 4095, 2047, 0, 1023, 0, 1638, 0, 2457, 0, 0, 0, 3805, 0, 4095, 0, 4095, 0, 0, 0, 2866, 0, 2047, 0, 1242, 0, 782, 0, 997, 0, 1785, 0, 931, 0, 3625, 0, 1535, 0, 998, 0, 1139, 0, 330, 0, 1023, 0, 1809, 1489, 2687, 2178, 2184, 0, 1185, 0, 2175, 2047, 2047, 2275, 416, 0, 1324, 0, 2776, 1569, 2957, 4095, 3397, 0, 369, 0, 1365, 141, 2167, 1638, 819, 0, 4001, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2730, 0, 1958, 0, 0, 0, 0, 0, 0, 0, 86, 0, 0, 0, 0, 0, 1023, 0, 2874, 0, 0, 0, 0, 0, 1324, 0, 848, 0, 0, 0, 0, 0, 248, 4095, 2340, 0, 0, 0, 0, 0, 45, 0, 123, 0, 0, 0, 0, 0, 1116, 0, 682, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 722, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1820, 0, 0, 0, 0, 0, 819, 0, 3201, 0, 0, 0, 0, 0, 199, 186, 415, 0, 0, 0, 0, 0, 44, 630, 1801, 0, 0, 0, 0, 0, 212, 263, 3045, 0, 0, 0, 0, 0, 0, 0, 493, 0, 0, 0, 0, 0, 1589, 2091, 1726, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 603, 315, 1615, 0, 0, 0, 0, 0, 924, 4095, 1066, 0, 0, 0, 0, 0, 1170, 0, 1815, 0, 0, 0, 0, 0, 0, 0, 2553, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 668, 3003, 432, 0, 0, 0, 0, 0, 767, 4095, 1638, 0, 0, 0, 0, 0, 1023, 0, 0, 0, 0, 0, 0, 0, 0, 1638, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 890, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1365, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 682, 0, 847, 0, 215, 0, 0, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 60, 0, 0, 0, 1602, 0, 1675, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3916, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 4095, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 3276, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2184, 0, 0, 0, 0, 0, 0, 0, 3583, 281, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 4095, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 4095, 4031, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 4095, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 1365, 0, 2288, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 3323, 0, 1890, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 682, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2990, 0, 0, 0, 0, 0, 1023, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2730, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 819, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 3465, 0, 0, 0, 0, 0, 0, 0, 0, 0, 215, 0, 1508, 0, 630, 0, 2145, 0, 819, 0, 2925, 0, 1755, 0, 585, 0, 195, 0, 0, 0, 0, 0, 585, 0, 4095, 0, 975, 0, 819, 0, 1755, 0, 0, 0, 273, 0, 1638, 0, 2652, 0, 0, 0, 2925, 0, 699, 0, 0, 0, 2047, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3753, 2047, 0, 0, 0, 0, 0, 0, 4095, 455, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 2047, 0, 0, 4095, 0, 0, 0, 2596, 0, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 4095, 4095, 0, 4095, 0, 4095, 0, 4095, 0, 0, 0, 4095, 0, 4095, 0, 4095, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 3350, 0, 511, 4095, 4095, 0, 0, 4095, 4095, 0, 0, 4095, 4095, 0, 0, 4095, 1854, 4095, 4095, 4095, 4095, 0, 0, 4095, 3510, 0, 0, 4095, 3071, 0, 0, 4095, 4095, 0, 0, 4095, 3510, 0, 0, 4095, 2205, 0, 0, 4095, 4095, 0, 0, 4095, 327, 0, 0, 4095, 3017, 0, 0, 4095, 4095, 0, 0, 4095, 4095, 0, 0, 4095, 438, 1365, 1158, 2047, 2047, 0, 0, 4095, 1599, 0, 3997, 4095, 4095, 0, 4095, 4095, 4095, 0, 0, 4095, 4095, 0, 0, 4095, 2486, 0, 0, 4095, 4095, 0, 0, 0, 2324, 2205, 1292, 4095, 4095, 0, 0, 4095, 3640, 4095, 2457, 0, 0, 0, 0, 0, 3780, 0, 1668, 4095, 0, 0, 0, 0, 1755, 0, 0, 4095, 4095, 0, 0, 0, 1194, 4095, 1365, 4095, 3793, 0, 0, 4095, 3701, 0, 0, 4095, 3934, 0, 0, 4095, 4014, 0, 0, 4095, 3276, 0, 0, 4095, 4007, 0, 0, 4095, 4095, 0, 0, 4095, 3722, 4095, 4095, 4095, 3953, 0, 0, 4095, 2559, 0, 0, 4095, 4095, 0, 0, 4095, 3879, 0, 0, 4095, 4095, 0, 0, 4095, 4095, 0, 0, 4095, 3937, 0, 0, 4095, 3791, 0, 0, 4095, 4095, 0, 0, 4095, 3038, 0, 0, 4095, 4095, 0, 0, 4095, 3640, 0, 1077, 4095, 3822, 0, 0, 4095, 3336, 4095, 1638, 4095, 4095, 0, 0, 4095, 4095, 0, 4095, 4095, 4095, 0, 0, 4095, 3523, 2047, 1553, 2047, 2047, 0, 0, 4095, 3071, 4095, 0, 0, 0, 0, 0, 0, 877, 3510, 1462, 0, 0, 0, 0, 0, 0, 2730, 0, 4095, 0, 819, 409, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 481, 0, 0, 2225, 585, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 3334, 3760, 2967, 3557, 1872, 1249, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 1023, 0, 4095, 0, 0, 0, 4095, 0, 0, 819, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 2730, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 819, 0, 2730, 0, 0, 0, 0, 0, 3276, 819, 0, 0, 0, 0, 0, 0, 2439, 2400, 3722, 2890, 1047, 999, 186, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 3792, 3905, 0, 4095, 1365, 4049, 2730, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 2340, 0, 0, 682, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2340, 0, 2101, 735, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 4095, 491, 0, 1638, 2047, 0, 4095, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 4095, 4095, 0, 1638, 190, 3690, 1251, 4095, 3722, 4095, 0, 4095, 0, 0, 0, 2925, 1023, 0, 4095, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3791, 3071, 0, 0, 0, 0, 0, 1365, 0, 2129, 0, 0, 0, 0, 0, 2047, 3738, 2801, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 1252, 2677, 1526, 0, 0, 0, 0, 0, 0, 2730, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 3071, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 935, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3043, 0, 0, 0, 0, 0, 0, 0, 232, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 372, 1365, 9, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 511, 1724, 1170, 0, 0, 273, 455, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 3071, 1638, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 409, 4095, 1638, 0, 2047, 1365, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 2520, 1602, 1365, 1755, 1037, 431, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 1302, 0, 0, 2047, 0, 0, 752, 0, 1801, 0, 0, 0, 0, 0, 0, 2275, 4095, 0, 0, 1638, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 910, 0, 4095, 1116, 4095, 0, 0, 2109, 2020, 2281, 1365, 0, 0, 4095, 1365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 4095, 4095, 4095, 0, 0, 3276, 1890, 2730, 1638, 0, 0, 4095, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 693, 1967, 0, 2468, 3164, 2340, 2047, 3372, 2188, 2205, 1712, 2943, 4095, 0, 3071, 0, 0, 0, 4095, 0, 1755, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 4095, 0, 0, 0, 3722, 0, 0, 0, 0, 0, 0, 3943, 4095, 4095, 4095, 2730, 0, 3510, 4095, 4095, 4095, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 3667, 4095, 4095, 4095, 4018, 0, 0, 0, 0, 4095, 0, 4095, 2047, 0, 0, 3839, 3939, 0, 0, 4095, 4095, 0, 0, 0, 3869, 4095, 0, 4095, 0, 0, 0, 4095, 3999, 4095, 0, 4070, 4095, 3583, 0, 0, 0, 3071, 0, 0, 0, 2047, 0, 0, 0, 4095, 4095, 4095, 0, 744, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 3549, 0, 0, 4095, 1365, 4095, 4095, 4095, 0, 4095, 0, 0, 4095, 4095, 4095, 0, 4095, 3708, 468, 0, 4095, 4095, 0, 0, 4095, 4095, 0, 0, 0, 4095, 4095, 4095, 70, 196, 409, 1755, 2047, 2457, 1861, 2520, 2467, 2595, 3480, 0, 1146, 0, 4095, 4095, 0, 1365, 0, 3412, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 2047, 4095, 2275, 2831, 0, 924, 3071, 0, 0, 3276, 3685, 1820, 1194, 1191, 0, 1365, 4095, 2457, 0, 4095, 1508, 0, 4095, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 2730, 4095, 4095, 341, 0, 0, 2730, 0, 0, 4095, 4095, 1365, 4095, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 744, 0, 0, 3412, 0, 0, 0, 0, 3879, 4039, 4095, 4095, 0, 0, 4095, 4095, 4095, 2047, 3071, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 692, 2047, 0, 0, 2047, 3831, 2047, 0, 2550, 3800, 2676, 0, 4095, 4042, 4095, 0, 4095, 2730, 0, 0, 4095, 4095, 0, 0, 4095, 3448, 0, 0, 4095, 0, 4095, 4095, 3685, 4003, 255, 4095, 4095, 3995, 3583, 4095, 3671, 3671, 3613, 0, 4095, 3236, 1260, 481, 3510, 4095, 546, 0, 4095, 3978, 0, 0, 4095, 4095, 0, 0, 4004, 3895, 0, 0, 0, 1260, 315, 819, 4089, 3813, 2730, 3583, 1906, 3330, 985, 1801, 4095, 4077, 4095, 4095, 4095, 4053, 0, 4095, 4095, 3241, 0, 0, 4095, 4095, 0, 0, 4095, 1627, 0, 0, 4056, 3120, 0, 2978, 0, 4095, 0, 4095, 2233, 585, 3003, 0, 0, 4095, 0, 0, 4095, 3943, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1861, 1919, 1023, 3150, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 4012, 4001, 0, 4095, 4030, 91, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4070, 4095, 819, 1365, 240, 2730, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 3978, 4095, 0, 4095, 1047, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3914, 4095, 0, 3549, 2388, 2730, 0, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 3990, 4095, 4095, 4095, 1490, 390, 2730, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 4095, 0, 3217, 0, 84, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 4095, 4095, 0, 1365, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 4011, 4095, 0, 2047, 1170, 511, 4095, 0, 4095, 0, 4095, 0, 0, 0, 4095, 0, 3319, 4095, 0, 4095, 2765, 10, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 3276, 2730, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 4095, 1365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4063, 4095, 0, 2730, 1445, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 3382, 4095, 0, 0, 3536, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 3840, 4095, 4095, 4095, 1516, 606, 585, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 3859, 4095, 0, 4095, 3685, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3773, 4095, 0, 4095, 2025, 341, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3759, 4095, 0, 4095, 2801, 3185, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3731, 4095, 0, 4095, 2457, 682, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 3697, 4095, 105, 2047, 3321, 2620, 1365, 2730, 2047, 0, 3601, 2586, 3412, 240, 0, 0, 3948, 4095, 0, 4095, 3695, 2730, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 1365, 535, 4095, 0, 0, 0, 0, 2574, 1023, 1890, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 4095, 0, 0, 4095, 0, 1023, 3583, 1023, 0, 0, 0, 3802, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 258, 2578, 83, 4052, 2992, 2340, 2890, 630, 2886, 3055, 3164, 0, 0, 0, 0, 0, 2047, 0, 1521, 1521, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2730, 409, 3937, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 3802, 4095, 0, 0, 0, 2730, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1023, 0, 0, 0, 0, 0, 2047, 2687, 3150, 3185, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3669, 2047, 3367, 0, 614, 0, 0, 0, 2047, 1412, 2293, 1185, 2968, 2408, 819, 4095, 2358, 968, 722, 3298, 3389, 685, 1706, 0, 0, 0, 0, 0, 4095, 4095, 0, 4095, 4095, 4095, 3071, 2047, 4095, 4095, 3345, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 455, 4095, 0, 4095, 204, 0, 0, 4095, 150, 3071, 4095, 0, 2730, 0, 1365, 4095, 4095, 0, 0, 4095, 4095, 3150, 819, 3412, 3780, 1535, 1638, 0, 0, 0, 0, 0, 0, 2047, 0, 3583, 2730, 2233, 0, 4095, 1023, 2266, 1861, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 4095, 4095, 0, 3841, 3071, 0, 2866, 3071, 2978, 1061, 126, 3618, 2136, 4095, 500, 3685, 1365, 1365, 4095, 4095, 2047, 4095, 332, 3541, 3071, 525, 2613, 2961, 602, 3439, 282, 4095, 3164, 0, 0, 4095, 3889, 0, 4095, 3802, 0, 0, 4095, 3771, 3384, 4050, 0, 4095, 3792, 0, 0, 4095, 3071, 0, 0, 4095, 3919, 2047, 0, 4095, 4095, 0, 0, 4095, 4095, 4095, 0, 4095, 4095, 0, 4095, 4095, 0, 3671, 4095, 1365, 3276, 2205, 4095, 4095, 2047, 4095, 0, 0, 0, 0, 0, 4095, 4095, 0, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 1365, 0, 4095, 3973, 3859, 4095, 0, 4095, 4095, 4095, 0, 4095, 4095, 0, 0, 4095, 3341, 0, 0, 4095, 4095, 0, 0, 4095, 4095, 0, 0, 4095, 4095, 0, 2730, 0, 3071, 0, 4095, 4095, 4009, 4095, 4095, 2784, 4095, 4095, 0, 4095, 383, 0, 4095, 4095, 2047, 0, 0, 0, 3276, 0, 0, 4095, 0, 0, 0, 0, 819, 0, 0, 0, 3455, 0, 3071, 0, 1755, 0, 0, 4095, 4095, 4095, 0, 0, 1742, 0, 2047, 0, 4095, 0, 0, 0, 3276, 4095, 0, 0, 4095, 0, 0, 0, 2957, 0, 0, 0, 2978, 0, 4095, 4095, 1575, 1365, 3458, 0, 4095, 0, 0, 4095, 4095, 0, 0, 0, 3185, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 4095, 963, 3327, 1886, 0, 3510, 0, 4095, 4095, 0, 0, 0, 4095, 3434, 4095, 0, 4095, 2948, 0, 1927, 4095, 3822, 0, 0, 4095, 3583, 0, 0, 4095, 3232, 0, 0, 4095, 2047, 0, 1365, 4095, 4095, 0, 4095, 1974, 3878, 30, 1365, 2007, 2194, 372, 0, 2925, 3474, 2730, 4095, 3583, 3991, 2730, 0, 1953, 2236, 174, 2822, 2992, 1627, 744, 0, 0, 3920, 0, 0, 4095, 4095, 0, 4095, 4095, 3897, 0, 0, 186, 1575, 4095, 0, 4095, 3926, 0, 0, 0, 4095, 0, 0, 4095, 3981, 0, 0, 0, 4095, 0, 0, 4095, 3910, 0, 0, 0, 3583, 0, 4095, 3640, 3946, 3412, 0, 3488, 4020, 4095, 1365, 4095, 3906, 2047, 1445, 4095, 4095, 0, 0, 0, 3780, 0, 2047, 0, 4095, 0, 0, 4095, 4095, 0, 0, 4095, 2047, 0, 2559, 4095, 3707, 2047, 1638, 1820, 3839, 702, 0, 4095, 3937, 4095, 4095, 4095, 3970, 0, 0, 4095, 0, 0, 1170, 0, 0, 0, 0, 0, 0, 0, 0, 0, 682, 0, 4095, 3074, 3510, 0, 2957, 261, 3780, 1251, 3962, 2275, 0, 2340, 1755, 2233, 1755, 3232, 1462, 1346, 481, 447, 3004, 3536, 1329, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 819, 4095, 0, 2047, 3204, 3613, 434, 1217, 3974, 0, 4095, 3560, 2047, 0, 1023, 0, 0, 0, 4095, 0, 3549, 2866, 682, 4095, 3972, 819, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 3071, 706, 682, 3951, 0, 0, 0, 0, 0, 4095, 0, 2730, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 2047, 0, 4095, 3237, 0, 423, 2925, 1478, 2047, 2047, 585, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 4095, 4095, 4095, 1638, 0, 3232, 0, 4095, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 2730, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 1023, 0, 4095, 3992, 0, 3058, 0, 67, 409, 0, 481, 4095, 0, 0, 0, 3185, 2047, 4095, 0, 3498, 1298, 2457, 3372, 3185, 528, 0, 2730, 0, 0, 0, 0, 4095, 1638, 0, 4095, 0, 693, 4095, 4095, 4095, 0, 1365, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2340, 0, 3071, 3216, 1365, 1023, 2047, 1755, 2047, 1023, 4095, 2047, 585, 2520, 3071, 2047, 2047, 3854, 3412, 3053, 2205, 592, 2478, 3445, 600, 3307, 0, 0, 0, 0, 0, 0, 1462, 0, 2925, 0, 2047, 0, 0, 4095, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 3753, 0, 0, 0, 261, 0, 0, 2047, 0, 0, 4095, 2047, 0, 0, 0, 0, 3412, 2730, 1638, 0, 4095, 682, 0, 0, 0, 0, 0, 0, 227, 0, 141, 0, 3412, 0, 0, 4024, 1695, 2909, 1691, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 722, 2641, 0, 4095, 3948, 0, 4095, 3871, 2649, 2047, 1732, 0, 4095, 0, 0, 0, 4095, 0, 0, 3412, 2701, 1790, 538, 1875, 2570, 1293, 0, 0, 0, 1365, 0, 0, 1365, 2076, 0, 3177, 0, 0, 0, 139, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 4095, 0, 1638, 3102, 2047, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2457, 4095, 0, 4095, 1365, 0, 0, 0, 0, 0, 3276, 0, 0, 0, 4095, 0, 240, 0, 3033, 4095, 2047, 372, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 2649, 3412, 0, 895, 372, 1820, 4095, 2155, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2419, 2818, 0, 2978, 2047, 910, 4095, 0, 619, 1268, 1413, 1219, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 1023, 2318, 0, 3640, 1365, 2730, 0, 1820, 808, 2620, 3276, 1911, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 2340, 0, 0, 0, 0, 0, 0, 0, 4095, 1969, 0, 3939, 0, 0, 4095, 0, 0, 1201, 2408, 2457, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 2866, 0, 1102, 1881, 0, 2835, 3159, 3738, 910, 2900, 2963, 1945, 546, 3722, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 3708, 0, 0, 2064, 2072, 0, 2505, 2419, 2900, 3380, 303, 3049, 4081, 978, 670, 4095, 4095, 0, 0, 4095, 1023, 0, 0, 4095, 4039, 4095, 0, 4095, 0, 0, 0, 4095, 0, 4095, 0, 1535, 2080, 1638, 3399, 0, 2730, 1638, 2784, 1755, 1556, 3953, 2047, 0, 4095, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 1724, 0, 3412, 2340, 4095, 4095, 0, 3465, 4095, 2047, 4095, 0, 4095, 0, 0, 4095, 3706, 0, 0, 0, 4095, 0, 0, 4095, 2925, 0, 0, 0, 4095, 0, 0, 1494, 2953, 0, 1801, 2047, 4095, 0, 3549, 2909, 30, 2854, 4095, 4095, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3276, 2134, 0, 3611, 0, 0, 0, 0, 1419, 4095, 1126, 1365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 0, 3753, 0, 0, 1023, 1365, 1023, 0, 1861, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1365, 0, 4095, 0, 0, 0, 0, 3879, 4095, 4095, 0, 0, 0, 0, 0, 4095, 1755, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 643, 2992, 0, 3088, 3722, 2605, 3741, 210, 2765, 2481, 3412, 3640, 0, 0, 0, 0, 4095, 3613, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 3253, 0, 0, 0, 3659, 0, 4095, 0, 0, 0, 0, 3707, 3196, 4095, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 1185, 2123, 0, 3451, 0, 4095, 4095, 1876, 2900, 3990, 3940, 4095, 4095, 4076, 0, 0, 0, 4095, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 744, 2570, 0, 3420, 963, 3490, 1320, 2047, 757, 4011, 2052, 3640, 0, 4095, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3017, 0, 2866, 0, 0, 0, 0, 170, 2605, 614, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2730, 0, 4095, 0, 0, 0, 0, 2047, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1092, 1976, 0, 3174, 0, 1228, 0, 3372, 1607, 559, 3863, 752, 3753, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 1400, 2070, 0, 3087, 780, 0, 4095, 540, 3792, 1755, 3350, 4095, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2890, 2187, 0, 2524, 3334, 2535, 2161, 2145, 2063, 267, 184, 2205, 0, 4095, 4095, 0, 4095, 1365, 4095, 0, 2047, 2828, 255, 3276, 3640, 1638, 4095, 0, 4095, 0, 0, 0, 2457, 1846, 0, 3521, 4095, 0, 0, 0, 3952, 3731, 46, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3583, 0, 4095, 2730, 0, 2520, 0, 2943, 3488, 0, 0, 0, 0, 4095, 4095, 0, 4095, 0, 4095, 3613, 2457, 146, 3071, 3916, 2774, 0, 0, 0, 0, 0, 0, 1023, 3895, 0, 4095, 0, 0, 0, 4095, 2682, 1137, 1023, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 2047, 945, 3583, 1638, 0, 0, 4095, 0, 1365, 0, 2047, 0, 0, 0, 0, 4095, 0, 0, 0, 1023, 3276, 0, 4095, 3780, 0, 0, 0, 0, 0, 0, 0, 862, 1054, 0, 2106, 4095, 4095, 1686, 0, 4095, 4095, 13, 2457, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 2047, 0, 4095, 2438, 1820, 630, 2605, 327, 2047, 0, 0, 2047, 2866, 4095, 2559, 1170, 1023, 3388, 1023, 1785, 2399, 767, 3627, 3854, 1320, 3613, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 2303, 4095, 3536, 3822, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 57, 199, 282, 1023, 2408, 1116, 1638, 267, 2350, 2812, 3138, 2967, 0, 0, 0, 0, 0, 0, 0, 2047, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2898, 0, 0, 0, 0, 0, 4095, 2457, 1365, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 186, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 1575, 2047, 0, 4095, 4095, 1724, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 1023, 4095, 1365, 3131, 682, 0, 0, 0, 0, 0, 4095, 4095, 819, 1971, 1023, 3071, 1755, 3412, 4095, 2925, 546, 0, 4095, 2730, 0, 2047, 0, 4095, 3382, 2696, 248, 3856, 2730, 1901, 754, 409, 3382, 435, 2978, 2457, 2047, 372, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 2047, 0, 0, 0, 0, 0, 3071, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 195, 4095, 409, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 4095, 0, 3071, 0, 4095, 0, 0, 0, 4095, 3987, 0, 0, 4095, 0, 0, 0, 4095, 2233, 1638, 1023, 0, 0, 0, 0, 4095, 1023, 3276, 0, 0, 0, 4095, 315, 2512, 0, 0, 3510, 4095, 0, 4027, 0, 4095, 4015, 4095, 4095, 4095, 4095, 4095, 0, 4095, 0, 0, 0, 4095, 4095, 0, 0, 4095, 3943, 3722, 1023, 4095, 682, 0, 2047, 3071, 3808, 455, 4095, 4095, 4095, 0, 0, 0, 0, 4095, 0, 4095, 4095, 0, 0, 4095, 0, 3916, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2317, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3854, 3893, 0, 0, 4095, 4095, 0, 0, 4095, 3071, 0, 0, 4095, 3706, 0, 0, 4095, 0, 0, 0, 4095, 4095, 0, 0, 0, 2340, 1445, 972, 4095, 0, 0, 0, 4095, 4095, 0, 2047, 0, 4095, 0, 0, 2020, 802, 2047, 3047, 3850, 3290, 318, 1023, 1116, 1424, 0, 3953, 4095, 829, 3869, 3276, 0, 3276, 2275, 4095, 3276, 4095, 4095, 0, 0, 0, 1638, 4095, 1023, 3583, 2613, 4095, 3802, 1204, 1820, 409, 3204, 3412, 2314, 2268, 502, 3412, 3175, 4095, 3071, 4095, 3598, 0, 0, 845, 1638, 1937, 0, 0, 0, 0, 3412, 748, 2047, 3897, 0, 4095, 0, 0, 0, 3890, 0, 0, 4095, 0, 0, 0, 0, 327, 0, 1170, 4095, 4095, 0, 0, 4095, 481, 2047, 1195, 4095, 0, 0, 0, 0, 585, 0, 819, 4095, 4095, 0, 0, 0, 3603, 1638, 1496, 4095, 3510, 0, 0, 0, 4095, 0, 2047, 0, 0, 0, 0, 0, 3144, 4095, 0, 4095, 4095, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 3999, 1442, 0, 4095, 4095, 3260, 0, 0, 0, 3071, 0, 4095, 4095, 819, 0, 0, 0, 3276, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 3904, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3822, 0, 0, 4095, 1474, 0, 0, 4095, 3117, 3412, 1141, 0, 4095, 0, 0, 0, 1023, 0, 1260, 0, 4095, 0, 0, 0, 4095, 0, 1228, 4095, 890, 0, 0, 0, 2873, 1927, 1304, 4095, 4095, 0, 0, 3071, 3659, 4095, 0, 4095, 4095, 0, 0, 4095, 0, 2730, 2047, 0, 0, 0, 0, 0, 0, 2047, 0, 2047, 0, 2801, 1638, 0, 0, 0, 712, 0, 0, 0, 2047, 0, 0, 4095, 3879, 0, 273, 0, 3139, 585, 0, 0, 240, 0, 0, 0, 0, 0, 0, 4095, 1946, 0, 4095, 4095, 2730, 0, 0, 0, 455, 0, 4095, 4095, 0, 0, 0, 4095, 481, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 3822, 0, 0, 0, 0, 0, 0, 0, 585, 0, 0, 0, 0, 0, 4095, 0, 1023, 1638, 0, 0, 2047, 0, 4095, 2730, 0, 3685, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 4095, 0, 0, 3412, 4095, 0, 0, 0, 0, 0, 0, 2965, 2193, 1023, 4095, 1090, 127, 2047, 0, 4095, 4095, 0, 0, 0, 2047, 0, 0, 3535, 4095, 3276, 3780, 1251, 3147, 3510, 0, 2730, 455, 4095, 0, 4095, 0, 0, 0, 4095, 819, 1023, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 674, 1228, 4095, 4095, 1228, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 827, 0, 1791, 1596, 1937, 151, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 1365, 4095, 4095, 1365, 0, 0, 2047, 3753, 1820, 3861, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 2325, 102, 3560, 1582, 4095, 4095, 0, 0, 0, 0, 0, 0, 4095, 341, 0, 0, 2047, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3753, 4095, 1974, 0, 0, 4095, 0, 0, 0, 0, 23, 0, 0, 0, 0, 0, 455, 0, 1116, 0, 0, 0, 0, 0, 1365, 0, 195, 0, 0, 0, 0, 0, 1072, 1535, 2865, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 1237, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 508, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 1755, 372, 2275, 0, 0, 0, 0, 0, 1820, 0, 0, 0, 0, 0, 0, 0, 17, 3026, 3412, 0, 0, 0, 0, 0, 0, 4095, 2699, 0, 0, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 292, 2047, 307, 0, 0, 0, 0, 0, 1489, 3412, 1780, 0, 0, 0, 0, 4095, 1412, 2030, 3181, 2457, 2184, 1508, 360, 0, 0, 0, 0, 0, 0, 3071, 0, 4095, 0, 2293, 0, 1638, 431, 1551, 31, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 910, 0, 0, 3071, 0, 4095, 1061, 4095, 4095, 0, 0, 0, 0, 0, 0, 1585, 3382, 2890, 2866, 1472, 468, 4095, 4095, 0, 2730, 409, 0, 0, 0, 0, 4095, 3908, 3276, 4095, 4095, 2047, 0, 0, 0, 0, 1228, 0, 0, 0, 0, 0, 0, 2388, 0, 4095, 2978, 1854, 102, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1365, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 4095, 0, 1638, 4095, 3876, 4095, 4095, 3071, 1081, 0, 2730, 4095, 4095, 0, 4095, 4095, 4095, 0, 2457, 4095, 0, 0, 2559, 2457, 1911, 0, 3071, 3071, 3780, 3204, 0, 0, 4095, 1980, 3687, 579, 2948, 1950, 2005, 1609, 534, 1431, 170, 2730, 2835, 3753, 0, 0, 0, 0, 2730, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 3071, 0, 0, 0, 0, 511, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 4095, 0, 4095, 0, 3071, 0, 4095, 0, 0, 0, 4095, 3699, 0, 0, 4095, 0, 0, 0, 4095, 2496, 0, 0, 0, 0, 0, 0, 2184, 372, 0, 95, 3782, 3357, 24, 299, 4095, 0, 0, 0, 4095, 2765, 2866, 3412, 4095, 3797, 4095, 0, 4095, 4056, 3109, 4095, 2047, 1365, 0, 0, 4016, 4095, 2925, 4095, 4095, 3865, 2848, 0, 3902, 2730, 682, 1706, 3510, 3512, 234, 3412, 2047, 4095, 3521, 0, 0, 0, 4095, 0, 0, 2047, 0, 0, 1365, 4095, 0, 4095, 4095, 0, 4095, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 4095, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3992, 4005, 0, 0, 4095, 4095, 0, 0, 4095, 4095, 4095, 0, 4095, 3720, 0, 0, 4095, 0, 0, 0, 4095, 3705, 0, 0, 0, 0, 0, 0, 0, 3685, 2047, 0, 4095, 4095, 0, 0, 0, 4095, 0, 0, 2340, 3767, 2457, 0, 2419, 3926, 0, 2047, 1023, 3307, 0, 4095, 4095, 2730, 2457, 4095, 0, 2509, 0, 4095, 0, 2457, 4095, 0, 0, 0, 0, 0, 0, 4095, 409, 0, 4095, 3854, 2730, 0, 4095, 4095, 0, 0, 0, 4095, 1365, 0, 4095, 4095, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 2047, 0, 4095, 0, 0, 0, 4095, 2047, 0, 0, 2047, 0, 0, 0, 4095, 0, 4095, 0, 3017, 0, 0, 4095, 585, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 3980, 0, 0, 0, 0, 0, 0, 4095, 3448, 2275, 0, 4095, 0, 0, 0, 0, 3583, 0, 0, 0, 0, 0, 0, 4095, 4071, 0, 0, 0, 4095, 0, 0, 4095, 4095, 0, 0, 4095, 991, 0, 3412, 3714, 4069, 401, 3685, 3276, 4067, 0, 0, 0, 2134, 3948, 3276, 0, 0, 0, 0, 4095, 4095, 4095, 0, 4095, 4095, 0, 0, 4095, 0, 3780, 0, 4058, 3606, 1585, 0, 3797, 3975, 1883, 341, 4095, 4040, 819, 4095, 0, 4095, 2047, 0, 4095, 3932, 2457, 4095, 4095, 4095, 0, 1023, 4084, 2879, 2047, 0, 4095, 3775, 0, 0, 4095, 3114, 3436, 4095, 0, 4095, 0, 4095, 4095, 3683, 0, 0, 4095, 2815, 0, 0, 3992, 3520, 0, 0, 4095, 2824, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 3984, 0, 4095, 4095, 3867, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 682, 0, 0, 4095, 0, 3696, 0, 3327, 1861, 0, 3583, 3731, 341, 2285, 1170, 0, 0, 0, 0, 0, 0, 4095, 2419, 2774, 2835, 1228, 2670, 3941, 344, 1092, 3150, 1188, 1638, 1950, 2486, 0, 4095, 4095, 1701, 2127, 964, 2255, 1883, 1219, 1611, 234, 2192, 405, 3035, 2457, 3120, 0, 0, 4095, 0, 775, 4095, 0, 4095, 1289, 420, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 4095, 4095, 0, 4095, 2943, 227, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 4053, 4095, 4095, 4095, 4095, 1419, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3276, 4095, 4095, 0, 3281, 0, 0, 0, 1638, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 1365, 0, 0, 4095, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 3071, 2047, 3510, 4095, 2965, 2047, 4095, 0, 0, 2047, 0, 4095, 4095, 0, 0, 0, 0, 2730, 2047, 0, 4095, 2047, 0, 0, 0, 0, 0, 0, 3412, 4095, 4095, 744, 2890, 0, 0, 0, 2730, 2866, 0, 3185, 1638, 4095, 0, 0, 4095, 0, 0, 0, 3488, 4095, 0, 4095, 223, 431, 3967, 0, 3871, 0, 1565, 0, 4095, 4095, 2047, 0, 4095, 4095, 4095, 0, 819, 426, 2632, 796, 1279, 3372, 2340, 0, 2047, 0, 0, 0, 823, 4095, 2764, 2275, 518, 125, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2275, 4095, 0, 2730, 4030, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2730, 4095, 0, 0, 100, 250, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 2047, 4095, 0, 2047, 2481, 4095, 3978, 4095, 315, 372, 0, 4095, 4095, 2434, 4095, 4095, 4095, 254, 0, 0, 4095, 0, 0, 2047, 0, 0, 4095, 4095, 3528, 3850, 2393, 2018, 2316, 987, 1736, 347, 3107, 525, 2177, 2178, 0, 0, 0, 0, 0, 3767, 4095, 1023, 0, 2891, 3150, 2866, 4095, 952, 1378, 0, 0, 4095, 638, 0, 0, 4095, 0, 0, 4095, 4095, 215, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 273, 4095, 0, 0, 136, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 910, 4095, 0, 2559, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 1170, 4095, 0, 945, 0, 163, 1365, 1365, 292, 0, 0, 0, 4095, 1365, 0, 0, 2047, 2730, 0, 0, 0, 689, 1023, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 843, 3276, 3510, 0, 1812, 119, 2047, 0, 4095, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 4068, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4085, 4095, 4095, 3908, 399, 2919, 3767, 1417, 120, 712, 2559, 1686, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 56, 3071, 0, 0, 2925, 1023, 3412, 3615, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4005, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 4095, 423, 3289, 0, 0, 1638, 1489, 2730, 0, 2047, 4095, 4095, 0, 4095, 0, 4095, 925, 2362, 276, 3566, 529, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3071, 0, 4095, 0, 0, 0, 2586, 0, 0, 0, 0, 0, 0, 3890, 4095, 0, 4095, 3336, 0, 0, 3685, 3883, 2047, 2492, 4095, 0, 4095, 0, 3908, 0, 0, 0, 4095, 0, 198, 4095, 3957, 3730, 146, 2831, 3185, 1471, 4095, 1170, 4095, 3830, 0, 0, 4095, 3937, 0, 0, 0, 0, 4095, 0, 4095, 4095, 4095, 0, 4095, 3693, 4095, 0, 4095, 1755, 0, 0, 0, 3900, 0, 0, 0, 0, 4095, 0, 4095, 0, 4095, 0, 4095, 0, 0, 0, 4095, 4095, 3610, 2925, 4095, 0, 4095, 2047, 4095, 0, 4095, 0, 4095, 0, 4095, 0, 255, 0, 0, 2762, 4063, 2, 4095, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 1365, 4095, 4095, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 4095, 3583, 0, 0, 4095, 4095, 0, 0, 4095, 4095, 0, 0, 0, 315, 1535, 1072, 4095, 4095, 0, 0, 2649, 3780, 0, 3106, 0, 4095, 4095, 0, 3780, 1148, 2047, 1365, 4095, 0, 1137, 682, 45, 43, 38, 3218, 4095, 227, 4095, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 511, 2047, 4095, 0, 4095, 0, 0, 4095, 0, 0, 0, 0, 4095, 4095, 0, 4095, 0, 1116, 1214, 0, 4095, 0, 0, 2932, 1093, 489, 3208, 4095, 0, 4095, 858, 2106, 347, 2520, 2520, 787, 4095, 3622, 4095, 1586, 1740, 4095, 2529, 3343, 827, 0, 0, 4095, 1061, 1820, 1330, 4095, 0, 0, 0, 0, 910, 0, 1755, 4095, 3412, 0, 0, 0, 4095, 4063, 1758, 4095, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 3276, 0, 0, 4095, 3929, 0, 0, 3879, 0, 292, 4095, 3350, 2730, 4095, 1023, 1755, 3185, 0, 0, 4095, 3209, 819, 455, 2047, 3543, 38, 3321, 4061, 41, 0, 1365, 4095, 1228, 0, 0, 4095, 3994, 0, 0, 0, 819, 0, 0, 4095, 0, 4095, 0, 4095, 3098, 0, 4095, 4095, 4095, 0, 0, 4095, 2233, 0, 0, 4095, 4058, 0, 0, 4095, 585, 4095, 0, 0, 0, 0, 0, 3644, 3232, 73, 2890, 4095, 4016, 4095, 146, 3962, 2297, 3276, 1682, 4095, 4091, 4095, 0, 2457, 121, 93, 1047, 4095, 28, 0, 0, 4095, 4095, 0, 3071, 4095, 341, 0, 0, 0, 1706, 2457, 1680, 0, 4095, 0, 0, 4095, 3685, 4095, 0, 4095, 4095, 0, 0, 0, 0, 4095, 1881, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2457, 3652, 0, 0, 0, 744, 0, 0, 0, 3583, 2559, 0, 0, 0, 0, 51, 787, 1137, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 1724, 0, 0, 4095, 0, 0, 0, 2047, 1861, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3583, 4095, 0, 2730, 0, 0, 4095, 2457, 0, 0, 2520, 0, 0, 0, 910, 0, 3048, 2178, 0, 3526, 3181, 157, 930, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 877, 4095, 0, 4095, 0, 0, 0, 182, 3360, 0, 0, 4095, 0, 0, 0, 4095, 2340, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 4095, 910, 910, 0, 0, 4095, 2005, 277, 4095, 2002, 3434, 0, 4095, 0, 4095, 0, 0, 186, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 3822, 0, 0, 0, 0, 0, 0, 0, 2047, 4095, 0, 0, 4095, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 2298, 1365, 1908, 4095, 0, 4095, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 1041, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 3185, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 2730, 819, 1200, 0, 0, 4095, 1023, 0, 0, 4095, 2047, 4095, 0, 2388, 0, 132, 18, 372, 3942, 0, 227, 1535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 184, 1158, 3090, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 262, 4095, 112, 0, 0, 0, 0, 2730, 0, 0, 2551, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 91, 0, 3969, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1102, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 178, 4095, 0, 2909, 0, 0, 4095, 0, 0, 0, 0, 1445, 4095, 4095, 3488, 2047, 0, 616, 676, 3325, 4095, 0, 4095, 0, 0, 481, 215, 1835, 0, 0, 0, 0, 0, 0, 0, 977, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1755, 4095, 0, 1146, 0, 0, 4095, 2047, 4095, 0, 0, 0, 0, 0, 4095, 0, 3916, 1316, 197, 1607, 2516, 1327, 0, 0, 0, 0, 0, 3560, 0, 0, 0, 0, 0, 73, 4095, 3822, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 819, 3753, 0, 0, 4095, 0, 3583, 0, 0, 0, 0, 0, 1535, 4095, 0, 0, 0, 3701, 4080, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1365, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 3839, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 0, 4095, 0, 0, 0, 2605, 0, 0, 0, 0, 0, 0, 3867, 0, 0, 4095, 0, 0, 0, 4013, 2730, 0, 3448, 4095, 0, 0, 3071, 4095, 0, 0, 0, 0, 0, 1023, 0, 341, 0, 0, 4095, 2925, 292, 4095, 0, 4095, 4095, 0, 0, 4095, 4095, 0, 0, 4095, 0, 0, 0, 4095, 4095, 4095, 0, 4095, 3430, 4095, 0, 0, 4095, 0, 0, 0, 3846, 0, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 2047, 4095, 728, 3489, 0, 0, 4095, 303, 0, 0, 4095, 0, 0, 0, 4095, 4095, 3875, 18, 0, 2646, 385, 29, 3978, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3276, 4095, 4095, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 4095, 3791, 0, 0, 4095, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 2925, 0, 0, 3071, 4095, 212, 2921, 0, 4095, 4095, 485, 3722, 329, 1950, 2405, 1484, 2968, 1553, 2047, 351, 59, 0, 4070, 4082, 2320, 55, 0, 4095, 0, 0, 4095, 4095, 0, 2047, 0, 1023, 2047, 1023, 4095, 0, 3767, 0, 0, 4095, 2541, 3167, 141, 3510, 1638, 877, 988, 0, 3315, 286, 2843, 2730, 3895, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3510, 4095, 0, 4095, 0, 0, 4095, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 694, 0, 3479, 2925, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 4095, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 3775, 4095, 0, 0, 0, 1365, 1638, 0, 0, 4095, 0, 4095, 682, 0, 0, 3852, 3799, 0, 4095, 46, 0, 0, 4095, 0, 4016, 0, 0, 4095, 4000, 4095, 1365, 4095, 4048, 4095, 4095, 4095, 4095, 0, 0, 4095, 0, 0, 4095, 4095, 2875, 3033, 186, 3947, 3465, 1890, 1981, 2730, 359, 273, 1142, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 3900, 4095, 0, 4095, 0, 4095, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3150, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 1279, 2815, 0, 0, 4095, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 1170, 1365, 0, 819, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 1365, 2559, 819, 2457, 0, 0, 3412, 0, 2047, 2457, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3526, 4095, 620, 2205, 0, 0, 4095, 1575, 3241, 0, 0, 4095, 3900, 930, 2047, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 2925, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 3276, 49, 4095, 4095, 3738, 864, 1279, 3071, 0, 380, 0, 4095, 0, 4095, 4095, 2457, 1575, 2047, 614, 3510, 2835, 1535, 3780, 409, 1755, 2047, 3984, 0, 4095, 4095, 1650, 3166, 254, 3062, 662, 1023, 1381, 491, 1352, 142, 3162, 2362, 4046, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 1194, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 767, 2340, 2047, 3722, 2978, 1023, 0, 0, 4095, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 2205, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 2047, 4095, 4095, 1638, 2835, 2457, 0, 3071, 4095, 0, 1213, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3583, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3510, 2340, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 3071, 0, 0, 2047, 465, 0, 4095, 3071, 2978, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 4095, 0, 0, 0, 0, 4095, 0, 1023, 0, 0, 4095, 4095, 0, 0, 4095, 1724, 3164, 292, 2957, 4095, 1861, 1835, 0, 1023, 73, 3613, 2730, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 819, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3150, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 4095, 4027, 0, 0, 4095, 2918, 4095, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 3981, 0, 0, 0, 4095, 0, 4095, 0, 4095, 3715, 315, 0, 4095, 3947, 3071, 4095, 4095, 4095, 0, 0, 3613, 4095, 4095, 0, 0, 3946, 4095, 0, 4095, 4095, 0, 0, 4095, 3281, 0, 0, 4095, 819, 0, 0, 4095, 0, 4095, 0, 4095, 0, 0, 0, 4095, 0, 3640, 0, 4095, 0, 0, 0, 4095, 0, 4095, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 3583, 3780, 0, 0, 4095, 3935, 0, 0, 4095, 3071, 0, 0, 4095, 3691, 0, 0, 4095, 4095, 0, 0, 4095, 4095, 0, 0, 0, 1228, 1170, 1012, 4095, 4095, 0, 0, 4095, 4095, 0, 0, 4095, 4095, 0, 0, 4095, 1555, 4095, 2314, 4095, 4095, 0, 0, 0, 4095, 4095, 0, 4095, 4095, 4095, 0, 4095, 4095, 0, 0, 0, 4095, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 4095, 306, 0, 4095, 4095, 4095, 0, 4095, 4095, 4095, 2730, 4095, 4095, 3753, 0, 0, 4095, 167, 1365, 1445, 1170, 2275, 0, 0, 4095, 1152, 3071, 3903, 2559, 4095, 0, 4095, 4095, 0, 0, 3276, 4095, 0, 0, 0, 4095, 682, 0, 682, 4095, 4095, 0, 0, 4095, 341, 1535, 1036, 4095, 0, 0, 0, 4095, 1365, 2340, 2605, 4095, 1468, 0, 0, 2047, 2259, 3753, 2087, 4095, 0, 0, 0, 0, 2275, 0, 2457, 0, 4095, 0, 0, 0, 2559, 4095, 4095, 4095, 3918, 0, 0, 4095, 1365, 0, 0, 4095, 2925, 0, 0, 4095, 1755, 0, 0, 4095, 3265, 0, 0, 4095, 3806, 0, 4095, 4095, 4095, 4095, 0, 4095, 2047, 0, 0, 4095, 4054, 0, 0, 4095, 2275, 0, 0, 4095, 3071, 0, 4095, 4095, 3583, 4095, 0, 1329, 4095, 0, 4095, 4095, 3622, 0, 0, 4095, 3239, 0, 0, 4095, 3017, 0, 0, 4095, 4095, 0, 0, 4095, 3620, 0, 0, 4095, 2520, 0, 0, 4085, 3680, 1638, 888, 4095, 3910, 0, 0, 4095, 3983, 0, 2047, 4095, 4095, 0, 0, 4095, 4095, 0, 1116, 4095, 2730, 0, 0, 4095, 1645, 1365, 1794, 4095, 3981, 0, 0, 0, 3549, 0, 0, 4095, 4095, 0, 0, 0, 1592, 2047, 1829, 0, 0, 0, 0, 4095, 0, 2505, 819, 1365, 0, 3412, 511, 0, 0, 2388, 3375, 0, 0, 0, 0, 4095, 0, 0, 276, 1365, 0, 511, 0, 0, 0, 585, 670, 0, 2047, 4095, 0, 4095, 0, 2681, 1766, 1861, 3867, 2494, 738, 0, 0, 0, 787, 0, 0, 4095, 0, 4095, 0, 4095, 1170, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 2184, 0, 0, 0, 0, 1365, 0, 2047, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 511, 0, 0, 0, 0, 0, 0, 1023, 299, 0, 4095, 0, 0, 0, 0, 0, 2578, 0, 0, 0, 0, 0, 0, 1213, 2047, 2047, 4095, 624, 351, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 3217, 1365, 2047, 1489, 195, 1217, 0, 0, 0, 1409, 0, 4095, 0, 0, 0, 0, 2535, 546, 0, 0, 0, 0, 0, 0, 2784, 0, 0, 4095, 4095, 0, 4095, 0, 3185, 130, 0, 0, 862, 0, 0, 0, 0, 82, 0, 0, 0, 0, 0, 1023, 0, 4095, 2047, 1023, 2252, 0, 0, 819, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 372, 0, 4095, 4095, 0, 0, 3536, 0, 1449, 0, 0, 0, 0, 0, 0, 4095, 3722, 0, 0, 351, 0, 0, 1747, 4095, 4095, 0, 0, 0, 0, 4095, 0, 3931, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3448, 4095, 0, 0, 0, 4095, 0, 1328, 2694, 2338, 0, 0, 0, 0, 0, 0, 2047, 639, 0, 0, 0, 682, 0, 0, 0, 72, 0, 4095, 0, 0, 4095, 4095, 3276, 0, 0, 0, 0, 0, 0, 753, 1003, 1723, 0, 4095, 4095, 0, 0, 0, 4095, 930, 4095, 0, 0, 4095, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 1703, 1417, 325, 0, 0, 0, 0, 0, 0, 4095, 123, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1129, 1137, 3527, 0, 0, 0, 0, 0, 4095, 4095, 3412, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 958, 585, 847, 0, 4095, 0, 0, 0, 1068, 2586, 4095, 0, 2047, 4095, 0, 0, 227, 2047, 2002, 0, 4095, 2047, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 2047, 682, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 0, 0, 0, 1428, 767, 3371, 0, 0, 0, 0, 0, 0, 744, 910, 0, 3412, 1260, 1023, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 3707, 0, 0, 0, 0, 0, 163, 0, 1755, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 215, 2835, 240, 4095, 2275, 1706, 1023, 2047, 2431, 1522, 1969, 1170, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 0, 0, 0, 0, 4095, 0, 1260, 0, 0, 4095, 4095, 4095, 0, 0, 3583, 3412, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 3943, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 2047, 273, 2860, 4095, 1638, 2730, 3139, 2268, 3226, 1765, 2388, 4095, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 3412, 0, 0, 0, 0, 0, 1365, 0, 0, 0, 4095, 0, 4095, 3839, 0, 0, 4095, 3276, 0, 0, 4095, 3276, 0, 1023, 4095, 0, 0, 4095, 4095, 0, 3510, 0, 4095, 4095, 4095, 0, 4046, 0, 0, 0, 0, 4095, 4095, 0, 4095, 3715, 1365, 0, 4095, 3923, 2047, 4095, 4095, 3217, 0, 0, 4095, 3822, 0, 0, 4095, 3767, 0, 0, 4095, 1638, 4095, 0, 4095, 4095, 0, 0, 4095, 4095, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 3790, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 585, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 2457, 0, 0, 4095, 3906, 3740, 4095, 4095, 3350, 3911, 0, 0, 4095, 4095, 0, 4095, 4095, 3654, 0, 0, 4095, 2047, 0, 0, 4095, 3538, 0, 0, 4095, 0, 2047, 4095, 38, 409, 423, 2047, 1755, 1638, 1023, 0, 2841, 2813, 2847, 0, 0, 4095, 4095, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 4095, 2047, 0, 0, 0, 0, 4095, 0, 3549, 2805, 0, 551, 4095, 4095, 0, 1508, 2155, 744, 1142, 1785, 0, 0, 3350, 4095, 4095, 1365, 0, 1365, 0, 0, 0, 0, 4095, 4095, 0, 0, 4095, 4095, 4095, 0, 3276, 409, 0, 4095, 0, 4095, 0, 4095, 4095, 4095, 0, 2047, 4095, 0, 4095, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 138, 240, 0, 4095, 0, 0, 0, 4095, 3677, 3744, 4095, 4095, 4095, 3071, 4095, 0, 4095, 3276, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 1192, 3217, 273, 2730, 2324, 3814, 2167, 1801, 2398, 3191, 3004, 0, 4076, 3933, 0, 0, 4095, 3802, 0, 0, 4095, 3961, 0, 0, 4095, 3930, 0, 0, 4095, 585, 4095, 0, 2457, 3644, 372, 1228, 4095, 2730, 0, 0, 1820, 4095, 2205, 4095, 4095, 4078, 2123, 1365, 4095, 4095, 819, 0, 4095, 3917, 0, 0, 4095, 4080, 0, 0, 4095, 4095, 4095, 0, 4095, 4095, 2184, 2047, 4095, 4041, 0, 3879, 3705, 2956, 1401, 0, 4095, 3785, 3722, 0, 4095, 3276, 0, 0, 4095, 4095, 0, 0, 4095, 4095, 0, 0, 4095, 2388, 0, 0, 2047, 1927, 0, 4095, 3071, 4095, 0, 3399, 3999, 4035, 0, 0, 4095, 4012, 0, 0, 4095, 3822, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 3541, 2730, 161, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4011, 4095, 0, 4095, 1365, 2943, 0, 0, 0, 0, 0, 2047, 4095, 0, 4095, 0, 2340, 4095, 1324, 1745, 1433, 1260, 0, 4095, 4095, 4095, 4095, 0, 0, 4095, 0, 0, 3931, 4095, 4095, 4095, 2340, 4095, 0, 0, 0, 0, 0, 0, 2047, 0, 4095, 0, 3276, 4095, 0, 2303, 1320, 3185, 0, 0, 0, 4095, 1365, 0, 0, 0, 3276, 0, 3856, 4095, 0, 4095, 87, 1194, 4095, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 4095, 3071, 4095, 24, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 2925, 0, 1023, 2047, 0, 0, 2866, 0, 0, 0, 4095, 0, 0, 0, 4095, 4095, 0, 0, 0, 4095, 0, 0, 4095, 0, 4095, 0, 0, 4095, 0, 0, 3071, 4095, 0, 4095, 2102, 2730, 0, 0, 0, 0, 0, 4095, 4095, 0, 4095, 4095, 0, 2047, 4095, 0, 630, 1170, 2457, 4095, 0, 0, 0, 0, 0, 4095, 4095, 0, 4095, 4095, 4095, 0, 2047, 4095, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 4095, 4095, 2730, 3879, 4095, 0, 0, 3890, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 3536, 4095, 0, 3071, 255, 1023, 4039, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 4095, 1116, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 2047, 0, 1023, 0, 0, 0, 0, 0, 0, 0, 0, 1365, 4095, 0, 0, 0, 3217, 1365, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 3583, 4095, 0, 4095, 2766, 3854, 0, 0, 3753, 0, 0, 0, 0, 0, 0, 0, 4017, 4095, 0, 2559, 3473, 2408, 0, 4095, 4095, 0, 3251, 2854, 3685, 0, 0, 0, 4095, 4095, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 3549, 0, 2047, 4095, 0, 0, 2478, 617, 1651, 0, 0, 0, 4095, 4095, 0, 0, 3780, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1638, 4095, 0, 0, 0, 0, 2457, 2047, 2730, 0, 0, 0, 4095, 2730, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 1365, 0, 113, 1529, 113, 3822, 2730, 2632, 2529, 372, 2826, 2508, 3383, 0, 0, 0, 511, 0, 0, 0, 1638, 1213, 0, 0, 2730, 4095, 0, 0, 0, 0, 4095, 0, 1228, 0, 0, 0, 1228, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 409, 2047, 4095, 2047, 0, 0, 2730, 3530, 2730, 3652, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 3412, 2047, 0, 3722, 4095, 0, 0, 0, 4095, 1547, 0, 4095, 0, 4095, 0, 2047, 0, 0, 4095, 0, 117, 0, 0, 0, 0, 0, 0, 3276, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 4095, 0, 4095, 0, 2925, 0, 0, 0, 0, 0, 3412, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 2730, 0, 0, 0, 0, 0, 0, 1755, 1589, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3497, 0, 0, 0, 0, 0, 2730, 1365, 4095, 0, 3276, 4095, 4095, 0, 4095, 2047, 0, 0, 744, 3663, 0, 0, 4095, 0, 4095, 0, 0, 4095, 0, 0, 4095, 0, 4095, 0, 0, 0, 4095, 0, 3560, 3071, 0, 0, 3795, 2749, 0, 0, 4095, 0, 4095, 2730, 4095, 4095, 3510, 0, 4095, 3071, 4095, 0, 4095, 0, 4095, 0, 0, 4095, 4095, 0, 744, 4095, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 4095, 0, 3350, 1365, 4095, 3164, 3276, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3327, 0, 0, 0, 0, 0, 3663, 682, 0, 0, 1023, 3071, 0, 0, 4095, 3276, 4095, 0, 4095, 4095, 4095, 0, 4095, 3439, 0, 0, 4095, 0, 0, 0, 4095, 1170, 0, 0, 0, 0, 0, 2457, 0, 2047, 0, 0, 4095, 4095, 4095, 0, 4095, 4095, 0, 0, 0, 682, 0, 0, 1365, 4095, 4095, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 4095, 1023, 4095, 0, 4095, 4095, 4095, 4095, 0, 0, 4095, 0, 4095, 4095, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 4095, 630, 0, 3931, 0, 0, 0, 722, 0, 3753, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1638, 0, 0, 0, 0, 0, 0, 0, 0, 2730, 819, 0, 4095, 0, 0, 0, 4095, 0, 4095, 4095, 0, 4095, 0, 4095, 409, 0, 2666, 4095, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 3350, 0, 0, 3071, 3854, 0, 3583, 4095, 1092, 0, 0, 4095, 0, 0, 4095, 4095, 4095, 0, 0, 3753, 4095, 4095, 0, 4095, 4095, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 2047, 0, 4095, 0, 4095, 0, 2730, 0, 4095, 4095, 3640, 4095, 0, 4095, 0, 0, 4095, 0, 2047, 81, 0, 4095, 4095, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 568, 3685, 4095, 0, 4095, 3276, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 1890, 0, 0, 0, 0, 0, 0, 0, 1365, 4095, 1023, 0, 0, 0, 1462, 2925, 1298, 646, 4095, 4095, 0, 4095, 4095, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 4095, 0, 3931, 3916, 0, 0, 0, 0, 0, 0, 2730, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 4095, 4095, 0, 0, 4095, 4095, 0, 0, 0, 0, 1638, 0, 4095, 4095, 0, 0, 4095, 0, 3412, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 1755, 0, 0, 3185, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 2730, 0, 0, 0, 0, 0, 0, 1023, 3640, 3839, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2730, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 0, 0, 4095, 1023, 0, 2730, 0, 2925, 4095, 1365, 40, 0, 0, 1706, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 3510, 0, 0, 4095, 0, 819, 0, 0, 0, 819, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2730, 0, 0, 0, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 2801, 0, 0, 4095, 4095, 4095, 0, 4095, 2925, 1861, 0, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3583, 0, 0, 0, 4095, 0, 0, 4095, 0, 4095, 4095, 0, 0, 4095, 2512, 0, 0, 0, 0, 0, 0, 0, 1451, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 2047, 0, 2058, 1106, 3893, 0, 4095, 4095, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1023, 1365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1069, 0, 0, 556, 0, 4095, 4095, 1820, 718, 1865, 2835, 1965, 0, 0, 1023, 4095, 97, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 2233, 1638, 1053, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 2957, 0, 0, 963, 0, 80, 4095, 0, 0, 0, 0, 801, 1638, 259, 0, 0, 4095, 2047, 0, 504, 0, 855, 3412, 1894, 0, 2858, 0, 0, 0, 1116, 0, 0, 0, 4095, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3640, 4095, 2047, 0, 0, 0, 2047, 0, 2559, 853, 511, 2275, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 3071, 2746, 4095, 3685, 4095, 0, 0, 151, 2337, 1274, 2476, 1740, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2340, 2907, 0, 2784, 0, 0, 1077, 2529, 2881, 3439, 868, 4095, 4095, 0, 4095, 0, 0, 0, 0, 0, 3510, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 1795, 0, 2388, 0, 0, 0, 0, 334, 744, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3412, 0, 0, 0, 0, 0, 4095, 3071, 4095, 0, 868, 2295, 0, 2765, 3771, 2311, 2559, 877, 3822, 2902, 877, 4095, 4095, 4095, 0, 0, 2047, 0, 0, 4095, 4095, 0, 0, 0, 4095, 2047, 4095, 2047, 4095, 3934, 0, 0, 2842, 2925, 0, 1950, 455, 1791, 955, 277, 3866, 3934, 1384, 3746, 4095, 2704, 0, 0, 4095, 585, 4095, 0, 4095, 3822, 0, 0, 4095, 4095, 4095, 0, 0, 0, 4095, 0, 3953, 1869, 0, 3150, 2047, 0, 2457, 511, 1228, 802, 4095, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1780, 0, 3583, 3990, 3753, 0, 0, 1820, 2626, 0, 4095, 4095, 4095, 0, 0, 4095, 3698, 0, 0, 4095, 0, 0, 0, 4095, 2730, 0, 0, 0, 0, 0, 0, 4095, 3106, 0, 4095, 4095, 4095, 0, 0, 4095, 2730, 4095, 4095, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 2419, 0, 3753, 0, 0, 0, 0, 3751, 4095, 2641, 3131, 4095, 0, 4095, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 4095, 623, 0, 2866, 4095, 0, 0, 0, 4095, 0, 0, 4095, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 2866, 0, 2047, 4095, 4095, 0, 0, 4095, 4095, 0, 0, 4095, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2388, 3475, 0, 2106, 3583, 1293, 0, 2370, 3665, 4023, 2137, 4095, 4095, 877, 0, 4095, 3970, 3388, 4095, 0, 1381, 2275, 2047, 1365, 2730, 4095, 0, 0, 4095, 0, 2047, 4095, 2340, 2549, 0, 1820, 4095, 4095, 0, 2457, 3300, 3356, 2533, 2047, 4095, 1924, 3372, 890, 3372, 4095, 1911, 2155, 372, 1146, 507, 4095, 3276, 3350, 0, 0, 4095, 0, 0, 0, 2047, 2047, 0, 2442, 585, 4095, 4095, 0, 1429, 614, 3953, 4095, 4095, 3251, 0, 0, 4095, 2457, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 3822, 2442, 0, 3071, 0, 0, 0, 0, 4080, 4095, 3826, 2457, 4095, 1638, 0, 0, 4095, 3839, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1170, 2730, 0, 1417, 4095, 0, 4095, 0, 3172, 4005, 3214, 4095, 0, 0, 0, 0, 2047, 0, 4095, 2730, 819, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 1170, 0, 1638, 0, 4095, 0, 4095, 0, 4095, 3185, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3510, 4095, 4095, 0, 4095, 4095, 0, 0, 0, 0, 0, 682, 1755, 0, 2027, 1618, 2245, 1575, 1365, 2390, 3946, 1483, 1414, 4095, 0, 1023, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 787, 2266, 0, 2047, 1023, 2730, 1365, 511, 3562, 706, 2196, 3722, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 511, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1033, 2116, 0, 2259, 1550, 1686, 2594, 0, 3147, 239, 4054, 667, 4095, 0, 0, 0, 3785, 3372, 50, 40, 0, 0, 0, 0, 0, 3146, 4095, 4095, 0, 0, 0, 0, 4095, 3276, 0, 1023, 0, 0, 0, 0, 4095, 3746, 2118, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1451, 0, 0, 0, 4095, 0, 511, 2340, 0, 2047, 1365, 4095, 1686, 0, 3641, 3120, 4095, 4095, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 242, 3565, 0, 1755, 0, 4095, 4095, 0, 3071, 0, 3071, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1213, 0, 2408, 4095, 4095, 0, 0, 2288, 0, 2390, 4095, 0, 1365, 0, 0, 163, 0, 4095, 1365, 0, 0, 0, 0, 0, 0, 2730, 0, 0, 0, 0, 0, 2632, 3753, 0, 240, 2047, 0, 0, 0, 3185, 4095, 186, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 2730, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1365, 0, 0, 0, 4095, 4095, 1774, 1861, 2502, 4026, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1023, 1638, 0, 2730, 0, 0, 1365, 2730, 4095, 2730, 1023, 4095, 0, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 2038, 0, 0, 0, 0, 4095, 4095, 3793, 1535, 2352, 4095, 4095, 3733, 1638, 0, 1560, 2047, 0, 2047, 0, 0, 1092, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1365, 0, 0, 0, 2047, 0, 3839, 0, 2047, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2925, 0, 0, 0, 0, 0, 4095, 4007, 0, 0, 4095, 4095, 4095, 0, 4065, 3571, 0, 0, 0, 0, 0, 0, 4095, 2047, 4095, 0, 1602, 4095, 1671, 0, 4095, 0, 4095, 0, 4095, 767, 3738, 3139, 4095, 3870, 3071, 0, 4001, 4095, 0, 0, 4095, 0, 0, 0, 4095, 4095, 4095, 0, 4095, 3091, 112, 3958, 4095, 4017, 68, 0, 124, 3201, 24, 170, 902, 0, 1724, 0, 4095, 1365, 0, 0, 4095, 4095, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 4095, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 3753, 3510, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 3984, 0, 0, 4095, 0, 4095, 0, 4095, 4095, 0, 0, 0, 0, 0, 4095, 4095, 2978, 0, 0, 4095, 4095, 0, 0, 4095, 1365, 0, 0, 3412, 1064, 0, 372, 2288, 3978, 227, 0, 4095, 4095, 2047, 0, 4095, 2303, 3640, 3780, 4095, 4095, 0, 0, 4095, 4095, 0, 0, 1950, 0, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 2340, 4095, 0, 4095, 1201, 124, 4095, 4095, 2401, 4050, 0, 4095, 4095, 1445, 0, 4095, 2925, 0, 0, 4095, 4095, 0, 0, 4095, 1686, 0, 3510, 4095, 4095, 0, 0, 4095, 3937, 0, 0, 4095, 3412, 0, 0, 4095, 4095, 0, 4095, 4095, 4095, 0, 0, 4095, 1535, 0, 930, 4095, 3276, 0, 0, 4095, 0, 0, 0, 4095, 3458, 0, 0, 0, 4095, 0, 2457, 4095, 0, 0, 0, 0, 4095, 0, 0, 4095, 3096, 0, 0, 0, 2047, 0, 4095, 4095, 3961, 0, 0, 4095, 3616, 0, 0, 4095, 3946, 0, 0, 4065, 2863, 0, 0, 3825, 3690, 819, 0, 4095, 3960, 0, 0, 4095, 3802, 2632, 4095, 4064, 3815, 0, 0, 4095, 4022, 0, 0, 4095, 4095, 0, 0, 4095, 3908, 4095, 0, 4095, 2375, 4095, 0, 946, 4095, 321, 4095, 4095, 915, 1640, 0, 4095, 3882, 1365, 0, 4095, 3916, 0, 0, 4095, 4095, 0, 0, 4095, 4009, 0, 0, 4095, 3877, 0, 0, 4095, 3729, 0, 1023, 4095, 4095, 0, 0, 4095, 4095, 0, 4095, 4095, 4095, 0, 0, 4095, 2047, 0, 0, 4095, 4095, 0, 0, 4095, 2457, 4095, 1876, 4095, 4095, 0, 0, 4095, 2925, 0, 0, 4095, 3412, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 1365, 1638, 0, 0, 0, 0, 0, 0, 0, 0, 0, 95, 0, 4095, 292, 1535, 4095, 1151, 0, 0, 0, 0, 0, 0, 494, 3939, 3640, 0, 4095, 2689, 3978, 2155, 3096, 2423, 405, 0, 4095, 409, 0, 0, 4095, 3698, 0, 4095, 0, 3158, 4095, 4023, 0, 0, 4095, 0, 3753, 1246, 2047, 4095, 0, 1246, 0, 0, 0, 3185, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 819, 0, 0, 0, 2730, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 2925, 0, 0, 0, 0, 0, 0, 0, 2303, 819, 4095, 2730, 1045, 292, 0, 0, 0, 0, 0, 0, 0, 0, 122, 0, 3714, 831, 665, 3771, 1446, 203, 0, 4095, 0, 4095, 0, 1531, 3784, 4095, 4095, 3953, 2457, 0, 1686, 2730, 2457, 4095, 0, 3937, 862, 3071, 1890, 4095, 4095, 4095, 4095, 2047, 2534, 3350, 4095, 4095, 295, 322, 0, 1255, 331, 2641, 3615, 4095, 1651, 0, 0, 0, 0, 0, 1890, 2457, 3722, 1260, 0, 0, 1638, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 3412, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 1755, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 1365, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 3276, 4095, 0, 4095, 0, 0, 0, 0, 2047, 3079, 0, 0, 0, 0, 0, 0, 3640, 862, 130, 4095, 1365, 0, 4095, 0, 0, 4095, 0, 1023, 2457, 2457, 4095, 0, 4095, 4095, 0, 4095, 1365, 0, 0, 844, 1489, 536, 0, 4095, 3652, 0, 4095, 0, 4095, 30, 4095, 4095, 0, 4007, 0, 0, 3395, 0, 4095, 0, 585, 0, 0, 0, 0, 4095, 0, 4095, 0, 4095, 0, 0, 0, 1660, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1053, 4095, 215, 0, 0, 0, 0, 0, 0, 2457, 3854, 2730, 0, 455, 3967, 1023, 0, 4095, 945, 204, 0, 0, 0, 0, 0, 4095, 4095, 0, 4095, 0, 4095, 4095, 1437, 2047, 1204, 0, 0, 341, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1927, 431, 2047, 2047, 1742, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 1365, 0, 0, 0, 0, 0, 0, 0, 0, 2559, 0, 0, 4095, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 511, 65, 3412, 0, 0, 0, 0, 0, 0, 0, 292, 3854, 2730, 0, 0, 4095, 4095, 0, 0, 1228, 0, 4095, 4095, 0, 0, 0, 4095, 4095, 0, 4095, 4095, 4095, 0, 4054, 0, 4095, 4095, 0, 2275, 0, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 3640, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 910, 0, 0, 0, 0, 0, 4095, 3276, 0, 0, 4095, 2047, 2730, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 4095, 1365, 4095, 0, 1876, 3549, 472, 182, 4095, 0, 0, 0, 0, 2275, 3412, 3722, 4095, 2730, 4095, 0, 4095, 3780, 0, 0, 0, 0, 0, 0, 4095, 4095, 4095, 0, 4095, 1813, 183, 635, 4031, 4095, 930, 172, 2047, 3640, 0, 0, 4095, 199, 1137, 0, 0, 0, 1365, 4095, 4095, 2848, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 4095, 0, 2457, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 4095, 1365, 0, 4095, 4095, 4095, 0, 0, 4095, 4095, 0, 0, 0, 4095, 4095, 4095, 4095, 3276, 1638, 0, 3412, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2457, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 3071, 1023, 3711, 4095, 0, 1365, 0, 0, 0, 0, 0, 4095, 3276, 4095, 4095, 0, 4095, 4095, 0, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 4095, 4095, 4095, 4095, 0, 4095, 4095, 3276, 4095, 4095, 0, 0, 4095, 0, 2457, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2457, 0, 0, 0, 4095, 0, 0, 0, 3640, 4095, 4095, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 3583, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 4095, 2655, 0, 0, 0, 3276, 0, 0, 3003, 1077, 0, 0, 3555, 3983, 1023, 945, 0, 3276, 0, 0, 0, 2730, 3780, 4095, 4095, 2047, 4095, 0, 2730, 4095, 2730, 4095, 4095, 0, 0, 0, 4095, 4095, 4095, 0, 4095, 877, 4023, 3217, 4095, 4095, 2047, 0, 4095, 4032, 372, 0, 4095, 4095, 3822, 0, 4095, 4095, 4095, 0, 0, 2978, 4095, 481, 4095, 4095, 0, 0, 4095, 3412, 0, 0, 4095, 4095, 3977, 4095, 4095, 4095, 0, 4095, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 2047, 4095, 0, 4095, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 3685, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1116, 0, 3783, 3071, 1560, 4095, 1521, 151, 0, 2047, 0, 0, 0, 99, 4095, 4095, 4095, 409, 2714, 1508, 2492, 4095, 3510, 1047, 0, 4095, 2047, 0, 0, 4095, 3802, 4095, 4095, 0, 3428, 3038, 4095, 4095, 263, 3972, 0, 4095, 2084, 1240, 4095, 0, 682, 0, 4095, 0, 3780, 4095, 2761, 4095, 2007, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 3750, 4095, 1755, 4046, 3019, 3477, 0, 0, 0, 0, 0, 0, 0, 0, 3978, 0, 3888, 4095, 3873, 4095, 3934, 103, 4095, 0, 4095, 0, 4095, 0, 4095, 0, 4095, 0, 3412, 4095, 0, 4095, 227, 819, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3560, 4095, 0, 3549, 2340, 0, 4095, 0, 585, 0, 0, 0, 0, 0, 1023, 0, 3556, 4095, 664, 4095, 22, 895, 0, 0, 0, 0, 0, 0, 3583, 0, 0, 4095, 3640, 4095, 0, 4095, 2559, 0, 0, 4095, 0, 0, 0, 4095, 4095, 4095, 4095, 0, 4031, 4095, 4095, 4095, 2835, 4047, 1141, 4095, 433, 0, 2541, 0, 4095, 0, 0, 0, 3525, 4095, 4024, 4095, 3303, 0, 3102, 0, 2850, 0, 3762, 0, 4095, 0, 2047, 0, 3345, 4095, 4095, 4095, 1365, 0, 2957, 0, 4095, 0, 3773, 0, 3951, 0, 3106, 0, 3276, 4095, 3518, 4095, 3412, 455, 3688, 0, 2457, 0, 0, 0, 585, 0, 4095, 0, 3738, 4095, 4095, 4095, 1137, 409, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3854, 4095, 0, 3916, 1365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 114, 3937, 936, 357, 4095, 0, 0, 0, 0, 484, 3428, 3307, 3822, 3465, 3367, 2457, 1023, 4095, 65, 2193, 0, 4095, 0, 4095, 2047, 4095, 3760, 4095, 4095, 4052, 1628, 3995, 4001, 4095, 682, 1602, 386, 3972, 328, 399, 4095, 4095, 511, 0, 0, 0, 3911, 4095, 0, 4095, 3937, 1343, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 4095, 0, 819, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 58, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 3900, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1365, 4095, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1023, 0, 0, 204, 2687, 4095, 1023, 105, 0, 0, 0, 0, 0, 2340, 2340, 4095, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 567, 18, 0, 4095, 1098, 19, 0, 83, 3902, 0, 0, 0, 682, 0, 0, 0, 4095, 0, 0, 4095, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4050, 4095, 4095, 2047, 1365, 2426, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 682, 0, 0, 0, 534, 4095, 1194, 468, 0, 0, 0, 0, 0, 435, 4095, 2925, 4095, 0, 4095, 0, 1365, 0, 0, 4095, 945, 4095, 0, 4095, 0, 4095, 4095, 0, 4095, 0, 3888, 0, 1170, 0, 48, 4095, 0, 1638, 192, 0, 1755, 0, 1755, 0, 0, 0, 0, 0, 1820, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2730, 0, 1170, 0, 2559, 0, 0, 0, 0, 0, 0, 0, 2047, 0, 2314, 0, 2205, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1023, 0, 4095, 3657, 0, 0, 4095, 4095, 0, 0, 4074, 3026, 0, 0, 4095, 0, 0, 0, 4095, 3185, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 1365, 0, 4095, 4095, 4089, 0, 0, 4095, 4036, 1820, 0, 4095, 2340, 0, 0, 4095, 3276, 3071, 0, 4095, 3794, 0, 0, 4095, 3412, 2047, 0, 2645, 4095, 3610, 0, 4095, 4095, 0, 0, 3510, 0, 0, 0, 2388, 0, 0, 0, 1890, 0, 0, 0, 3336, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 1547, 0, 0, 0, 4095, 0, 0, 0, 3026, 0, 796, 0, 3997, 3685, 1106, 0, 4095, 4095, 910, 0, 1365, 4095, 0, 0, 4095, 3635, 3071, 0, 4095, 0, 4095, 0, 4095, 3656, 0, 0, 4095, 4095, 2269, 1387, 0, 3839, 0, 0, 0, 4095, 0, 0, 0, 3879, 0, 0, 5, 819, 0, 163, 428, 4095, 952, 32, 0, 4095, 0, 0, 0, 282, 3516, 3549, 4095, 3605, 1474, 273, 963, 2047, 819, 2047, 255, 4095, 0, 4095, 0, 4095, 4095, 4095, 4095, 3672, 4006, 3967, 4095, 3276, 1335, 753, 0, 1870, 206, 0, 4095, 4095, 1061, 0, 0, 2756, 0, 1219, 0, 0, 0, 0, 0, 1462, 0, 4095, 0, 3705, 0, 0, 0, 3510, 0, 0, 0, 4095, 0, 0, 0, 2730, 0, 0, 0, 4095, 0, 0, 4095, 585, 0, 1365, 4095, 4095, 0, 0, 0, 4095, 4095, 0, 4095, 3315, 0, 0, 4095, 3465, 1045, 711, 4095, 2457, 0, 0, 0, 2047, 0, 0, 0, 3996, 0, 0, 0, 0, 0, 0, 3510, 4057, 0, 0, 0, 4095, 0, 0, 4095, 4091, 0, 0, 3468, 3520, 0, 0, 2527, 4016, 72, 0, 0, 4095, 0, 0, 4073, 3695, 3822, 3839, 4095, 4030, 1047, 0, 1023, 4095, 113, 2383, 0, 3327, 178, 4095, 1023, 4095, 3992, 4095, 4095, 4095, 4095, 0, 1967, 4095, 1365, 4095, 107, 4095, 160, 4095, 3276, 4042, 3442, 0, 4095, 4046, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 4095, 4078, 0, 0, 4095, 3223, 0, 2730, 4095, 4095, 0, 0, 4095, 4095, 0, 2457, 0, 4095, 0, 0, 4095, 4095, 0, 0, 4095, 4095, 0, 0, 0, 1365, 2047, 1116, 4095, 4095, 0, 0, 4095, 3613, 0, 0, 4095, 3822, 0, 0, 0, 2047, 0, 2730, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 292, 0, 0, 110, 717, 3663, 455, 12, 0, 0, 0, 0, 0, 562, 3672, 3196, 4095, 3164, 3705, 0, 2275, 2047, 3613, 1474, 0, 2581, 1043, 1765, 2047, 3931, 4048, 0, 4095, 3987, 4095, 0, 2572, 0, 1365, 4059, 0, 229, 3240, 4095, 4095, 0, 945, 0, 0, 0, 0, 0, 423, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 2431, 0, 1323, 0, 819, 0, 597, 0, 3750, 0, 2730, 0, 4095, 0, 2730, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3102, 0, 3944, 0, 0, 0, 3194, 0, 0, 0, 2730, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 2730, 455, 0, 0, 0, 4095, 0, 3276, 3276, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 4095, 4095, 0, 4095, 2520, 3795, 3071, 4095, 0, 2877, 248, 208, 2983, 125, 0, 0, 0, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 2047, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3776, 0, 1820, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1686, 0, 0, 0, 0, 0, 630, 0, 0, 1365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 2047, 4095, 0, 4095, 0, 0, 0, 0, 4095, 0, 744, 4095, 2632, 0, 4095, 0, 4095, 4095, 1365, 4095, 0, 4095, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 1365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1179, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1560, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 1706, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28, 0, 0, 0, 900, 4095, 819, 0, 0, 1365, 0, 0, 0, 1260, 4095, 4095, 0, 2047, 0, 0, 4095, 0, 0, 0, 0, 4095, 4095, 0, 2047, 4095, 4095, 0, 4095, 4095, 4095, 4095, 1562, 0, 0, 76, 0, 2730, 0, 4095, 4095, 0, 1023, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3510, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 511, 4095, 1890, 0, 0, 0, 0, 0, 0, 372, 4095, 0, 0, 4095, 4095, 4095, 0, 0, 0, 4095, 2632, 4095, 0, 767, 0, 4095, 0, 0, 0, 4095, 4095, 0, 3962, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 2047, 0, 0, 0, 0, 0, 744, 0, 2047, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 877, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 1638, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1365, 0, 4095, 0, 0, 0, 4095, 3276, 0, 0, 4095, 0, 0, 0, 4095, 2047, 0, 0, 4095, 0, 0, 0, 1170, 0, 0, 0, 609, 0, 0, 105, 4095, 0, 0, 0, 0, 315, 4095, 4095, 4095, 3022, 4095, 0, 4095, 4095, 0, 0, 2047, 0, 0, 0, 4095, 3276, 4095, 0, 4095, 3406, 1170, 4095, 4095, 4095, 3802, 0, 1945, 4051, 4095, 0, 3217, 3003, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 4095, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 3685, 4095, 0, 0, 4095, 4095, 0, 0, 4095, 4095, 0, 0, 4095, 3573, 4095, 0, 2632, 0, 0, 0, 4095, 3640, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 4095, 0, 0, 0, 4095, 0, 0, 0, 2730, 4095, 0, 1365, 4095, 2047, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 4095, 4095, 0, 4095, 3071, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 3488, 0, 0, 4095, 2457, 0, 0, 4095, 2340, 0, 0, 4095, 1023, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 4095, 0, 0, 4095, 4095, 0, 0, 4095, 3823, 0, 0, 3526, 1575, 4095, 0, 4076, 4095, 0, 0, 4095, 3879, 0, 0, 0, 2047, 2047, 0, 3867, 4048, 0, 3071, 1365, 3685, 0, 2047, 4095, 4095, 0, 4095, 4095, 3921, 2275, 541, 3883, 3523, 780, 945, 4077, 2169, 187, 406, 2047, 4046, 4095, 0, 4095, 3444, 0, 0, 0, 4095, 0, 0, 4095, 3648, 0, 0, 3967, 3635, 0, 0, 4095, 4095, 0, 0, 4095, 4095, 0, 0, 0, 4095, 0, 0, 4095, 3711, 0, 0, 4095, 1575, 0, 0, 4095, 4095, 0, 0, 4095, 0, 0, 0, 4095, 4095, 0, 0, 0, 4095, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2730, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 4095, 0, 0, 4095, 0, 0, 4095, 1638, 1638, 1023, 1365, 4095, 4095, 2047, 0, 1023, 2047, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 0, 1365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2559, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3602, 0, 0, 2047, 0, 0, 0, 0, 0, 3379, 0, 0, 0, 0, 0, 0, 0, 4095, 2730, 0, 2047, 0, 4095, 0, 4095, 4095, 2730, 4095, 2730, 3753, 3762, 0, 3839, 0, 0, 2340, 1023, 106, 255, 1126, 4095, 0, 3998, 0, 0, 0, 4095, 0, 4095, 0, 4095, 0, 4095, 0, 3372, 0, 4095, 0, 4095, 0, 4095, 0, 3854, 0, 819, 0, 819, 0, 4095, 0, 4095, 0, 4095, 0, 4095, 0, 4095, 0, 4095, 0, 4095, 0, 4095, 0, 3762, 0, 4095, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 3640, 0, 0, 4095, 0, 0, 0, 4095, 1365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 3854, 1365, 0, 4095, 3900, 0, 4095, 0, 4095, 0, 0, 4095, 4095, 0, 0, 4095, 3748, 0, 0, 4095, 1365, 0, 0, 4095, 4095, 0, 0, 4095, 4095, 0, 0, 4095, 3685, 0, 0, 4095, 0, 0, 0, 4095, 4095, 0, 0, 4095, 0, 0, 0, 4095, 1365, 0, 0, 4095, 0, 0, 0, 4095, 4095, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 4095, 0, 0, 4095, 4054, 0, 0, 0, 4095, 0, 0, 4095, 3388, 0, 0, 4095, 0, 0, 0, 4095, 2730, 0, 0, 0, 0, 2047, 1260, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 1365, 4095, 3583, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 3241, 0, 1320, 0, 4095, 0, 0, 0, 1137, 4095, 3412, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 1638, 0, 2047, 0, 4095, 0, 0, 0, 1365, 0, 1717, 0, 0, 0, 0, 0, 1638, 4095, 2730, 4095, 4095, 0, 0, 0, 3510, 0, 3033, 4095, 2145, 0, 0, 0, 3510, 0, 4095, 0, 0, 0, 0, 0, 2047, 0, 0, 4095, 4095, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 4095, 0, 0, 4095, 3892, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 4066, 0, 0, 0, 0, 0, 0, 4095, 4059, 0, 0, 4095, 3510, 0, 0, 4095, 3810, 0, 2233, 4095, 4095, 0, 0, 0, 0, 0, 2340, 0, 0, 0, 0, 4095, 2730, 0, 0, 0, 4095, 0, 0, 0, 1861, 0, 787, 0, 0, 0, 0, 4095, 4095, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 2730, 0, 0, 0, 2047, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 1861, 1188, 2047, 4095, 1901, 1023, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 2047, 4001, 988, 3791, 1800, 491, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 2502, 3510, 0, 0, 0, 2047, 0, 0, 4095, 0, 0, 0, 0, 0, 3037, 0, 2804, 0, 0, 0, 141, 0, 3880, 0, 3071, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3830, 4095, 4095, 0, 1365, 0, 3210, 0, 1535, 0, 3556, 0, 4095, 0, 2457, 3185, 2047, 3003, 1082, 154, 630, 0, 2457, 4095, 4095, 0, 0, 0, 0, 0, 3131, 4095, 0, 4095, 3276, 3822, 0, 4095, 4095, 1213, 0, 4095, 0, 0, 0, 0, 4095, 4095, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 292, 0, 0, 3350, 0, 0, 0, 356, 0, 0, 0, 0, 0, 0, 0, 455, 0, 4022, 2340, 3750, 0, 3671, 0, 0, 0, 3583, 0, 4004, 0, 0, 0, 4026, 682, 4095, 4095, 1883, 0, 3665, 0, 3983, 2730, 3658, 0, 0, 0, 3115, 0, 4095, 0, 1923, 2730, 3696, 849, 3952, 2047, 4095, 4095, 4009, 0, 4095, 0, 2801, 0, 676, 3071, 0, 4095, 511, 0, 4095, 0, 2211, 0, 0, 0, 0, 0, 0, 0, 3071, 4095, 0, 4095, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 3510, 1433, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2457, 1638, 0, 4095, 0, 0, 0, 409, 0, 0, 0, 0, 0, 0, 0, 0, 3276, 1755, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 3549, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 1365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 1023, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 770, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1398, 1474, 323, 0, 3071, 585, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 1310, 3424, 2047, 4095, 1279, 840, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 3412, 0, 0, 0, 0, 0, 1023, 0, 2047, 0, 0, 0, 0, 0, 0, 2340, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1365, 1023, 273, 4095, 2808, 2439, 1142, 1489, 2124, 2491, 3196, 127, 0, 0, 3412, 4095, 0, 682, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 204, 2559, 2047, 2047, 0, 4095, 3071, 2457, 2815, 0, 0, 0, 4095, 4095, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 2730, 4095, 945, 1443, 1927, 3031, 4095, 0, 4095, 3185, 1287, 2509, 1737, 4095, 2948, 0, 2684, 4095, 0, 4095, 0, 438, 3928, 0, 4095, 0, 4095, 0, 1638, 0, 0, 0, 2047, 4095, 0, 2047, 4095, 2047, 4095, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 4095, 4095, 2730, 0, 3583, 0, 4095, 0, 2968, 0, 2047, 0, 2649, 0, 0, 3071, 4095, 4095, 3999, 0, 2047, 1228, 4095, 4095, 0, 4095, 4095, 0, 0, 4095, 4095, 0, 4095, 4095, 4095, 0, 511, 0, 4095, 4095, 0, 0, 4095, 0, 0, 0, 4095, 3412, 4095, 4095, 4095, 3290, 0, 0, 0, 4095, 4095, 0, 0, 0, 4095, 0, 4095, 3527, 4095, 4095, 4095, 4095, 3089, 0, 4095, 4095, 594, 0, 4095, 0, 4095, 0, 4095, 4095, 3603, 4095, 2032, 30, 0, 0, 3106, 1791, 3460, 585, 2798, 2504, 3016, 0, 4095, 0, 4095, 4095, 3762, 0, 3092, 0, 4095, 0, 4095, 0, 4095, 4095, 4095, 0, 4095, 0, 4095, 4095, 3867, 0, 3003, 0, 3613, 3663, 4095, 0, 4095, 4095, 0, 0, 4095, 0, 2047, 4095, 4095, 2925, 0, 0, 4095, 2047, 2233, 0, 4095, 4095, 0, 0, 0, 0, 2457, 4095, 73, 86, 423, 3185, 1116, 722, 1638, 455, 2360, 2540, 3233, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 3276, 2256, 0, 883, 0, 0, 0, 2457, 3071, 1638, 1204, 1251, 0, 0, 3412, 4095, 0, 4095, 0, 132, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 2047, 0, 3731, 1365, 0, 4095, 0, 4095, 4095, 4095, 0, 0, 0, 0, 4095, 4095, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 157, 0, 4095, 0, 0, 0, 0, 4095, 2047, 4095, 4095, 0, 0, 4095, 4095, 4095, 2632, 3722, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 646, 2047, 0, 0, 3276, 0, 2730, 2047, 2605, 1414, 875, 0, 0, 0, 4095, 4095, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 2730, 3780, 0, 2047, 0, 4095, 0, 4095, 4095, 4095, 3412, 0, 0, 0, 767, 0, 0, 4095, 988, 195, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 2644, 4095, 0, 4016, 1638, 744, 0, 0, 0, 4095, 2376, 2818, 829, 0, 4095, 0, 3185, 4095, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 2340, 2047, 4095, 0, 0, 0, 0, 4095, 819, 4095, 0, 0, 4095, 4095, 4095, 3978, 4095, 2866, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 0, 0, 2408, 3217, 1365, 3276, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 3911, 4095, 0, 4095, 1015, 511, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4021, 4095, 1911, 3276, 608, 2730, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4028, 4095, 4095, 2730, 3474, 1023, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 3803, 4095, 2340, 2649, 1570, 945, 0, 0, 0, 0, 0, 0, 0, 0, 2437, 0, 3313, 4095, 2403, 3368, 2448, 853, 3901, 0, 1638, 0, 4095, 0, 0, 0, 0, 0, 3627, 3445, 819, 3583, 2970, 58, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 3795, 4095, 1755, 0, 1470, 372, 4095, 0, 2844, 0, 4095, 0, 3802, 0, 4095, 0, 4095, 4095, 0, 4095, 630, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 3825, 4095, 0, 4095, 1124, 320, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 819, 2730, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 4095, 1933, 0, 0, 0, 455, 0, 0, 0, 0, 0, 0, 0, 3672, 4095, 3071, 1646, 1739, 3455, 0, 0, 1693, 0, 0, 0, 0, 0, 2008, 0, 4095, 4095, 0, 0, 2190, 0, 4095, 0, 4095, 0, 0, 0, 4084, 0, 0, 0, 3627, 4095, 4042, 3916, 3226, 806, 3715, 0, 4095, 0, 2047, 0, 0, 0, 0, 0, 3867, 4095, 0, 4095, 529, 264, 4095, 0, 1755, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 4095, 1324, 323, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3890, 4095, 0, 4095, 380, 3217, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3819, 4095, 0, 4095, 309, 602, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3940, 4095, 1620, 1999, 3428, 2801, 0, 0, 0, 682, 3613, 1023, 2559, 0, 0, 0, 3729, 2730, 0, 4095, 274, 372, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 1365, 1835, 0, 0, 0, 0, 0, 2457, 1535, 1302, 0, 0, 0, 4021, 4095, 0, 4095, 2801, 1365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3276, 1560, 0, 3839, 819, 4095, 0, 0, 0, 0, 2866, 2730, 1939, 0, 0, 0, 3861, 4095, 0, 0, 0, 2730, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 386, 1279, 195, 3839, 2047, 2047, 2730, 585, 3061, 2925, 3354, 0, 0, 0, 2047, 0, 0, 4095, 455, 2408, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1906, 383, 1861, 3668, 1721, 1199, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 4095, 0, 3276, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 2730, 3071, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 0, 2730, 0, 0, 0, 0, 0, 630, 585, 2047, 2047, 3492, 409, 585, 0, 1950, 1129, 240, 3350, 2559, 1417, 1365, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 2047, 0, 0, 0, 4095, 1023, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1620, 0, 0, 0, 290, 4095, 0, 0, 1365, 0, 0, 2047, 80, 4095, 0, 0, 3326, 0, 1575, 0, 1023, 0, 341, 0, 3722, 4095, 1462, 4095, 3987, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 0, 0, 744, 3640, 0, 4095, 0, 0, 0, 0, 2838, 0, 3382, 0, 3276, 0, 2643, 0, 0, 0, 2677, 0, 4095, 3900, 0, 0, 4095, 4095, 4095, 0, 2698, 3830, 2509, 435, 2866, 0, 4095, 287, 2925, 0, 3071, 4095, 0, 2866, 3465, 383, 3708, 3150, 1365, 2529, 1441, 292, 3217, 0, 4095, 3992, 0, 0, 4017, 3996, 4095, 0, 4095, 0, 2047, 0, 4095, 4095, 3802, 0, 3663, 3895, 0, 0, 4095, 4095, 3722, 0, 4095, 3993, 895, 0, 4095, 4095, 0, 0, 4095, 0, 3981, 0, 4095, 0, 0, 0, 2730, 4095, 3419, 4095, 3276, 4095, 455, 0, 4095, 0, 4095, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 3979, 0, 4095, 0, 0, 0, 4095, 0, 2047, 0, 4000, 3830, 4095, 0, 4095, 4095, 4095, 0, 4095, 4095, 1449, 0, 4019, 3658, 0, 0, 3916, 2047, 988, 0, 3412, 3412, 0, 0, 0, 2047, 0, 2205, 0, 3924, 0, 4095, 4095, 4095, 4095, 4095, 2047, 4095, 0, 0, 0, 2593, 0, 4095, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 2047, 0, 0, 0, 1842, 0, 0, 0, 3276, 0, 0, 4095, 0, 0, 0, 0, 4095, 4095, 0, 0, 585, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 1919, 1638, 1382, 0, 4095, 0, 4095, 0, 1462, 4095, 2730, 4095, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 1023, 0, 2047, 0, 4095, 0, 0, 0, 0, 0, 840, 0, 0, 0, 0, 0, 4095, 0, 2457, 4095, 3879, 0, 4095, 0, 3350, 0, 1710, 4095, 3753, 0, 0, 0, 3276, 0, 0, 0, 2730, 0, 0, 0, 0, 0, 0, 4095, 4078, 0, 0, 4095, 4095, 0, 0, 4095, 3459, 0, 0, 4095, 3307, 0, 0, 4095, 4040, 0, 0, 0, 3549, 0, 0, 4095, 4044, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 341, 3412, 0, 0, 4095, 1842, 0, 0, 4095, 4095, 0, 0, 4095, 2317, 0, 0, 4095, 4066, 0, 0, 4095, 4095, 0, 0, 0, 819, 0, 0, 3722, 4073, 0, 2730, 3575, 3461, 4095, 4095, 4095, 2771, 2047, 1240, 4095, 4095, 0, 0, 0, 4095, 0, 585, 0, 0, 0, 0, 0, 4095, 0, 0, 3812, 2658, 0, 0, 0, 2730, 585, 799, 910, 4095, 0, 0, 4095, 3981, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 1023, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 3817, 819, 44, 3071, 819, 0, 0, 3780, 0, 4095, 4095, 1820, 0, 3071, 3372, 0, 1508, 710, 1092, 2340, 3873, 208, 2730, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3618, 0, 292, 0, 893, 0, 0, 0, 2047, 3276, 248, 591, 0, 0, 4050, 4095, 2685, 0, 2323, 0, 3071, 0, 660, 0, 3616, 1365, 900, 3026, 4069, 877, 4058, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 3867, 0, 0, 0, 0, 0, 2616, 0, 4048, 0, 1724, 0, 2890, 0, 0, 0, 3350, 0, 0, 0, 4095, 0, 4095, 0, 4095, 0, 3170, 0, 3856, 4095, 3640, 4095, 1755, 0, 4095, 0, 4095, 0, 4095, 0, 4095, 1228, 4095, 1365, 4095, 1365, 4095, 0, 4095, 0, 4095, 0, 0, 0, 4095, 4095, 4095, 0, 4095, 0, 4095, 0, 4095, 4095, 4095, 0, 2866, 0, 1365, 0, 0, 0, 3004, 0, 0, 0, 864, 0, 0, 0, 4095, 0, 0, 0, 3915, 0, 4095, 0, 3719, 0, 1238, 1365, 2128, 494, 3700, 0, 4095, 0, 0, 0, 4095, 0, 3916, 0, 0, 0, 3257, 1228, 3591, 2047, 3917, 0, 4062, 2047, 3535, 0, 3471, 0, 2500, 0, 3583, 0, 3340, 819, 4095, 0, 3718, 0, 481, 0, 3715, 0, 2423, 0, 0, 0, 4095, 0, 3987, 0, 1776, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 2848, 2730, 0, 4095, 546, 0, 0, 0, 2730, 1228, 2047, 1706, 4095, 0, 3185, 4095, 864, 1470, 585, 2290, 2808, 674, 1365, 0, 0, 0, 0, 0, 0, 2730, 0, 0, 0, 195, 0, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 409, 372, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 315, 4095, 1535, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1053, 1820, 1535, 2047, 0, 0, 0, 0, 1535, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 33, 0, 2275, 0, 0, 2047, 0, 3071, 3685, 2586, 0, 1965, 0, 3753, 0, 4095, 409, 4095, 0, 0, 4095, 3008, 1675, 282, 2239, 2770, 368, 0, 0, 0, 1638, 0, 0, 2275, 2011, 0, 3071, 0, 0, 0, 4095, 0, 0, 0, 3276, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 2047, 0, 3583, 1023, 0, 4095, 4095, 2047, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 3071, 0, 2197, 4095, 0, 0, 0, 0, 0, 0, 3350, 0, 0, 0, 0, 0, 0, 0, 3510, 2162, 1652, 1425, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 910, 1861, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 1365, 0, 0, 0, 2978, 0, 4095, 3510, 4095, 0, 682, 2116, 3756, 566, 273, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 546, 3003, 0, 4095, 0, 4095, 409, 0, 895, 1330, 3738, 1365, 2557, 0, 1438, 0, 0, 0, 240, 0, 3940, 0, 3185, 0, 4095, 0, 0, 0, 0, 0, 511, 0, 2730, 3071, 0, 1365, 0, 0, 0, 1365, 1065, 3665, 3741, 4095, 0, 0, 0, 0, 3276, 0, 4095, 0, 4095, 0, 2620, 0, 1365, 0, 3412, 0, 4095, 3583, 0, 0, 1072, 682, 0, 1806, 2848, 2047, 3640, 630, 3294, 3208, 2193, 4095, 2047, 0, 0, 0, 0, 0, 0, 0, 4095, 2047, 4095, 0, 0, 0, 0, 0, 4095, 3798, 0, 0, 3071, 2160, 0, 1895, 2316, 2047, 988, 1365, 2285, 4095, 1467, 97, 4095, 3962, 0, 0, 4095, 4095, 2620, 0, 3937, 3413, 299, 0, 4095, 4095, 0, 0, 4095, 0, 3957, 0, 0, 630, 0, 3276, 3276, 0, 2940, 1638, 3420, 2110, 215, 186, 4095, 0, 4095, 0, 4095, 0, 0, 0, 4095, 4095, 0, 0, 1691, 0, 4034, 0, 4095, 0, 0, 0, 624, 930, 4095, 2571, 1602, 3675, 4088, 2047, 4095, 2778, 3058, 4095, 332, 4095, 1575, 0, 3861, 3260, 0, 0, 4095, 0, 1170, 0, 4095, 3984, 0, 0, 0, 0, 0, 0, 0, 3583, 0, 4095, 0, 4095, 0, 819, 1358, 3276, 1279, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 3753, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 2047, 3867, 0, 2730, 0, 0, 0, 0, 4046, 4095, 1001, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 1535, 0, 4095, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 4095, 4059, 0, 4095, 0, 4095, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 4095, 3510, 0, 0, 0, 0, 0, 0, 4095, 3961, 0, 0, 0, 0, 2047, 0, 3851, 3924, 4095, 0, 0, 0, 0, 0, 4052, 3751, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 3502, 0, 0, 0, 4054, 0, 0, 0, 0, 0, 0, 1178, 2757, 3276, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 3746, 0, 4095, 0, 4095, 0, 273, 3598, 2571, 3150, 4095, 4095, 3742, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 585, 3276, 0, 2457, 0, 4095, 4095, 0, 3381, 2291, 879, 0, 4095, 4095, 0, 0, 4095, 3839, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3071, 2730, 0, 2047, 0, 0, 0, 0, 897, 3885, 1416, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3844, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 333, 3150, 0, 4095, 0, 0, 0, 0, 3747, 3598, 4095, 4095, 3081, 0, 2047, 0, 0, 0, 2047, 0, 3523, 0, 4095, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 4095, 3455, 4095, 2605, 0, 0, 0, 1365, 3293, 2293, 3201, 4095, 0, 0, 0, 0, 2866, 0, 4095, 0, 4095, 0, 2457, 0, 0, 0, 3276, 0, 0, 0, 4095, 0, 1296, 2313, 4095, 2983, 2751, 3611, 2523, 847, 2359, 1862, 396, 976, 0, 1365, 0, 0, 0, 0, 4095, 372, 1911, 3631, 945, 3350, 3943, 1686, 4095, 0, 0, 0, 0, 0, 1638, 2730, 0, 0, 4095, 0, 4095, 0, 4095, 4090, 682, 4095, 0, 0, 0, 0, 0, 0, 2730, 0, 0, 0, 744, 0, 0, 0, 0, 0, 0, 0, 3896, 0, 0, 2047, 0, 2457, 0, 0, 3518, 4095, 877, 3276, 4095, 0, 4095, 0, 4048, 0, 4095, 0, 0, 4095, 3879, 2641, 1320, 2047, 3974, 2502, 0, 0, 0, 0, 0, 0, 4095, 3583, 243, 0, 4052, 0, 4095, 0, 1535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 546, 2730, 0, 2457, 0, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 819, 1023, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 1638, 1638, 0, 2605, 0, 0, 4095, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 1820, 2047, 390, 3232, 756, 0, 0, 0, 2559, 2340, 4095, 2925, 1861, 1365, 3967, 4095, 2047, 2263, 1267, 3239, 3199, 1424, 3583, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 2730, 1116, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 3071, 0, 0, 0, 4095, 0, 2047, 1365, 2730, 1638, 0, 3412, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2419, 0, 0, 0, 0, 0, 4095, 3071, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3640, 4095, 0, 2047, 1023, 0, 0, 4095, 0, 0, 4095, 4095, 0, 0, 4095, 0, 2632, 1023, 1365, 2340, 2047, 890, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3916, 0, 0, 0, 1927, 0, 0, 0, 0, 0, 0, 2925, 0, 0, 0, 0, 3611, 0, 1737, 0, 4095, 0, 273, 0, 4095, 0, 2362, 4095, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2661, 0, 3849, 0, 2047, 0, 3126, 0, 496, 0, 2520, 0, 4095, 3839, 0, 0, 4095, 0, 4095, 0, 4095, 3488, 4095, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 4095, 4095, 0, 819, 910, 0, 4095, 3945, 1861, 0, 4095, 4030, 3185, 4095, 0, 3412, 0, 0, 4095, 4095, 0, 0, 4095, 4021, 0, 0, 4095, 3106, 1560, 0, 3583, 4027, 0, 0, 4095, 4095, 0, 0, 4095, 2047, 4033, 0, 4095, 0, 4095, 0, 0, 0, 3653, 0, 4095, 4095, 0, 0, 4095, 0, 4095, 0, 4095, 0, 0, 0, 4095, 0, 1445, 1890, 0, 0, 4095, 0, 4095, 0, 0, 0, 3830, 0, 4095, 0, 2131, 3942, 4095, 0, 4095, 4095, 0, 0, 4095, 4095, 0, 0, 4095, 3707, 0, 0, 4095, 4095, 585, 0, 4095, 3927, 0, 0, 0, 630, 0, 2730, 0, 4095, 0, 0, 4095, 4095, 0, 2730, 0, 4021, 0, 0, 0, 1749, 2293, 1586, 0, 4095, 0, 0, 0, 2965, 0, 4095, 4095, 0, 0, 0, 0, 3861, 0, 4095, 0, 4095, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 3904, 4095, 0, 0, 4095, 0, 0, 0, 2757, 3185, 1787, 0, 0, 0, 0, 0, 3948, 4095, 1535, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 170, 0, 0, 0, 3903, 0, 0, 4095, 3890, 0, 0, 4095, 2730, 0, 0, 4095, 0, 0, 0, 0, 3350, 4095, 0, 4095, 4095, 0, 0, 0, 3003, 0, 4095, 4095, 3017, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 1316, 0, 4095, 4040, 3811, 0, 0, 0, 3276, 0, 4095, 0, 4095, 0, 0, 1638, 3217, 0, 0, 4078, 3590, 0, 0, 0, 3753, 0, 4095, 0, 819, 0, 0, 4095, 4035, 0, 0, 0, 4088, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 4095, 3378, 0, 0, 4095, 2047, 0, 0, 0, 0, 0, 0, 4095, 3953, 0, 4095, 4095, 433, 0, 0, 4095, 4021, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 4095, 3985, 0, 0, 0, 1535, 4095, 1535, 0, 0, 0, 0, 4095, 4095, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 862, 0, 2730, 0, 1279, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 1365, 390, 4095, 0, 1755, 819, 0, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 2716, 2900, 585, 3705, 1978, 722, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 1170, 0, 0, 4095, 0, 4095, 0, 0, 2047, 0, 0, 0, 0, 0, 3570, 0, 1941, 4095, 4095, 0, 215, 0, 3843, 0, 0, 2340, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 3488, 0, 4095, 0, 3230, 2047, 1638, 0, 3232, 0, 0, 1365, 2600, 1023, 4095, 1228, 1967, 287, 0, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 3700, 4010, 4095, 4095, 2324, 3666, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 3412, 4095, 0, 4095, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1228, 3412, 0, 4095, 2331, 910, 0, 0, 174, 0, 0, 0, 0, 0, 4095, 0, 1713, 1023, 3555, 1456, 2013, 105, 1683, 0, 3709, 4095, 642, 0, 3935, 0, 4095, 0, 4011, 1365, 4095, 0, 1686, 341, 3626, 1023, 3961, 0, 3520, 0, 4080, 0, 3678, 0, 4095, 1023, 3536, 4095, 1083, 0, 3126, 0, 4095, 0, 3241, 0, 0, 0, 1950, 0, 3663, 4095, 4012, 4095, 341, 1365, 4095, 0, 2388, 0, 0, 0, 0, 0, 0, 0, 3782, 4095, 0, 0, 0, 4095, 0, 501, 4095, 3372, 0, 0, 0, 0, 0, 0, 2973, 2903, 0, 4095, 0, 4095, 0, 682, 299, 3309, 0, 0, 0, 0, 0, 1116, 4095, 1146, 0, 4095, 0, 0, 0, 1225, 3276, 3510, 0, 0, 0, 0, 0, 0, 2730, 4022, 0, 0, 0, 0, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 3071, 4095, 910, 0, 0, 0, 0, 0, 682, 4095, 801, 0, 0, 0, 0, 2457, 4095, 2047, 2605, 2047, 0, 0, 0, 0, 2047, 0, 2275, 0, 0, 0, 0, 0, 511, 4095, 585, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 988, 4095, 2666, 0, 0, 0, 0, 0, 1116, 0, 3722, 0, 0, 0, 0, 0, 0, 2047, 2047, 0, 0, 0, 0, 3071, 0, 0, 4095, 0, 0, 4095, 0, 0, 273, 0, 2047, 0, 0, 0, 0, 0, 341, 4095, 455, 0, 0, 0, 0, 0, 321, 2047, 551, 4095, 4095, 843, 630, 0, 1023, 0, 4095, 0, 0, 0, 0, 0, 819, 2167, 273, 1023, 0, 1729, 47, 0, 170, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2730, 1023, 0, 0, 0, 0, 0, 0, 0, 1535, 3976, 2502, 1126, 1695, 240, 4095, 0, 2047, 2589, 4095, 3962, 0, 0, 4095, 0, 0, 3071, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2275, 4095, 0, 4095, 1365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2457, 4095, 0, 4095, 2866, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 4095, 0, 0, 682, 0, 0, 4095, 4095, 4095, 0, 0, 0, 0, 3663, 0, 2794, 4095, 0, 4095, 1638, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 4095, 0, 4095, 1365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 4095, 0, 3150, 0, 4095, 0, 3038, 0, 0, 0, 3185, 0, 4095, 4095, 4095, 4095, 4095, 0, 0, 0, 4095, 0, 3185, 0, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 0, 4095, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 3722, 4095, 4095, 4095, 2586, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 0, 4095, 4095, 4095, 4095, 2047, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 4095, 0, 3656, 4095, 2362, 0, 2047, 4095, 4095, 0, 4033, 4095, 4095, 0, 4095, 0, 0, 0, 4095, 4095, 4095, 1023, 853, 4095, 2730, 0, 0, 0, 0, 0, 3583, 0, 0, 0, 4095, 0, 0, 0, 3443, 0, 2457, 4095, 4095, 0, 0, 3549, 0, 0, 0, 4095, 3276, 0, 4095, 3629, 0, 0, 4095, 0, 2457, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 1365, 0, 3900, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3071, 4095, 0, 4095, 1365, 455, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2457, 4095, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3822, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 4095, 2047, 4095, 4095, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 4095, 3336, 0, 0, 0, 4095, 0, 0, 0, 3839, 4095, 4095, 4095, 2692, 0, 0, 0, 4095, 0, 0, 4095, 4095, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 1023, 0, 2047, 4028, 988, 1170, 4095, 4084, 0, 0, 0, 4095, 0, 0, 4095, 3764, 4095, 0, 0, 4095, 0, 819, 4095, 4064, 0, 4095, 4095, 3634, 0, 2047, 4095, 4095, 3480, 4095, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 2730, 0, 4095, 4095, 2123, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2730, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3970, 3430, 0, 4095, 2352, 1145, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3877, 4095, 0, 3142, 1200, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3439, 4095, 0, 4095, 1023, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 3290, 4095, 292, 4095, 3549, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 3142, 0, 3497, 4095, 0, 3501, 3855, 1023, 4095, 0, 2047, 0, 3839, 0, 2730, 0, 0, 0, 3094, 4095, 0, 4095, 3839, 15, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 2184, 4095, 2909, 4095, 4095, 0, 3302, 0, 0, 0, 2047, 0, 0, 0, 3492, 4095, 0, 4095, 2457, 2047, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 3502, 4095, 0, 4095, 2743, 819, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 3924, 4095, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2730, 4095, 0, 4095, 1535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2766, 3276, 3510, 3071, 2457, 2730, 4095, 4095, 3681, 2047, 819, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 341, 1077, 2388, 264, 0, 3302, 3199, 141, 0, 0, 0, 0, 3185, 4095, 0, 4095, 947, 1184, 2925, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 3241, 4095, 0, 4095, 305, 244, 4095, 0, 3822, 0, 0, 0, 0, 0, 0, 0, 3839, 4095, 0, 4095, 2474, 97, 4095, 0, 0, 2925, 0, 0, 0, 4095, 0, 0, 4095, 4095, 4095, 4095, 4095, 0, 4095, 0, 0, 4095, 4095, 3327, 2730, 0, 0, 0, 3757, 4095, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3544, 4095, 4095, 4095, 819, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3570, 4095, 0, 4095, 4023, 3937, 2866, 4095, 455, 831, 0, 0, 4095, 334, 0, 0, 2925, 4095, 0, 4095, 3556, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3276, 4095, 0, 4095, 2113, 1023, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3982, 4095, 0, 0, 3003, 1023, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 2047, 0, 2047, 0, 0, 0, 2047, 0, 0, 3412, 4095, 0, 4095, 1820, 0, 0, 0, 2047, 4095, 4095, 0, 4095, 0, 0, 0, 2457, 4095, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 2047, 1398, 2960, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2340, 4095, 0, 4095, 0, 4050, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4052, 4095, 0, 4095, 292, 2543, 3613, 0, 1489, 1755, 0, 372, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3879, 0, 0, 0, 477, 0, 0, 0, 4095, 4095, 1535, 3402, 0, 0, 4095, 744, 3609, 0, 1005, 0, 0, 0, 2925, 0, 3783, 1525, 1228, 871, 3674, 452, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2641, 0, 4095, 0, 0, 0, 2180, 0, 0, 0, 2925, 0, 4095, 4095, 0, 0, 2275, 0, 4095, 0, 4009, 4095, 2764, 3698, 4095, 0, 4095, 409, 4095, 4095, 4095, 0, 0, 0, 4095, 0, 2205, 2047, 3379, 4095, 4095, 0, 4095, 0, 4095, 4095, 0, 0, 4095, 4095, 4095, 0, 4095, 2047, 4095, 0, 4095, 4095, 4095, 0, 4095, 4095, 4095, 0, 4095, 0, 3519, 0, 4095, 4095, 0, 0, 4095, 0, 4095, 0, 4095, 4095, 4059, 0, 4095, 0, 4095, 0, 1701, 0, 3030, 3873, 2047, 0, 4095, 170, 0, 0, 4070, 0, 4095, 0, 2559, 0, 1378, 0, 2978, 2411, 4095, 18, 4095, 0, 4095, 0, 0, 0, 0, 0, 3835, 0, 2911, 4095, 4095, 0, 4095, 4095, 4095, 0, 0, 0, 234, 0, 4095, 3536, 0, 0, 3822, 0, 877, 0, 4095, 0, 0, 0, 0, 0, 4095, 1365, 0, 4095, 0, 0, 1365, 3071, 982, 2620, 0, 0, 4095, 620, 0, 735, 2047, 1847, 0, 4095, 4095, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 3583, 3583, 409, 0, 0, 0, 0, 819, 3412, 335, 3288, 4095, 0, 4095, 351, 1706, 1849, 1116, 0, 722, 1023, 2193, 110, 3185, 86, 455, 1003, 3505, 91, 750, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1638, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 409, 0, 0, 0, 4095, 0, 0, 0, 682, 4095, 0, 1365, 4085, 0, 0, 19, 1820, 2419, 2047, 0, 0, 4095, 431, 0, 1365, 4095, 0, 4095, 3195, 0, 0, 0, 3937, 3412, 4095, 0, 0, 0, 0, 0, 4095, 4095, 4095, 0, 4095, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 1365, 4095, 511, 1445, 0, 4095, 4095, 409, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 1349, 0, 341, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2457, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2275, 2730, 99, 3430, 0, 0, 4095, 255, 0, 151, 0, 372, 3583, 0, 4095, 0, 250, 0, 0, 3327, 4095, 0, 0, 0, 0, 0, 0, 2730, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 1023, 0, 0, 0, 0, 0, 0, 2559, 0, 1023, 0, 1365, 0, 0, 0, 0, 4095, 1407, 1901, 0, 0, 4095, 534, 1958, 0, 2303, 0, 0, 0, 2457, 0, 2877, 2483, 3071, 3961, 3934, 199, 4095, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 3071, 0, 0, 0, 4095, 2730, 2388, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 910, 1445, 2047, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 2047, 1365, 0, 2730, 3510, 0, 0, 0, 0, 3150, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 2730, 1228, 0, 0, 0, 4095, 0, 0, 0, 3953, 0, 2787, 0, 0, 0, 2047, 3071, 3204, 2632, 0, 0, 4095, 819, 2388, 0, 3904, 4095, 0, 0, 2047, 0, 1535, 776, 2730, 0, 4031, 0, 4095, 0, 3984, 4095, 4095, 3276, 0, 0, 442, 0, 0, 900, 4095, 4095, 0, 0, 0, 0, 0, 1116, 4095, 4095, 0, 0, 0, 0, 0, 0, 2925, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 1328, 3849, 2163, 0, 0, 4095, 0, 0, 843, 4026, 3196, 4095, 0, 4095, 0, 49, 432, 1257, 938, 4095, 2545, 0, 0, 0, 2149, 4095, 182, 0, 0, 0, 0, 0, 1102, 3985, 436, 0, 0, 0, 0, 0, 1616, 4095, 1304, 0, 0, 0, 0, 0, 1686, 4095, 910, 0, 0, 0, 0, 0, 910, 4095, 1023, 0, 0, 0, 0, 819, 1535, 3356, 124, 0, 0, 4095, 1365, 4095, 910, 4095, 4095, 4095, 0, 0, 372, 0, 186, 240, 2978, 120, 0, 0, 0, 0, 1791, 4095, 0, 0, 0, 0, 0, 0, 819, 4095, 455, 0, 0, 0, 0, 0, 1651, 4095, 2303, 0, 0, 0, 0, 0, 1717, 4095, 1939, 0, 0, 0, 0, 0, 292, 4095, 819, 0, 0, 0, 0, 1201, 3685, 82, 3019, 0, 0, 4095, 421, 4095, 1638, 3854, 87, 1820, 0, 4095, 160, 2400, 715, 3958, 1652, 3796, 138, 0, 0, 0, 1324, 4095, 1166, 0, 0, 0, 0, 0, 1462, 4095, 4095, 0, 0, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 48, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 4095, 3663, 3685, 0, 0, 4095, 546, 0, 0, 4095, 0, 0, 0, 4095, 0, 4095, 236, 4095, 2657, 2578, 107, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 929, 2047, 3241, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3071, 4095, 1102, 2388, 0, 0, 4095, 146, 0, 1638, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 1535, 3125, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4005, 0, 576, 0, 830, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 0, 2707, 0, 2408, 0, 4095, 0, 564, 0, 3834, 0, 706, 0, 4047, 0, 3549, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2437, 0, 3762, 0, 3071, 0, 3125, 0, 682, 0, 3474, 0, 2730, 1750, 4095, 0, 4095, 0, 4095, 0, 2810, 2184, 360, 2848, 4095, 0, 4095, 348, 614, 0, 4095, 4095, 0, 0, 4095, 0, 2384, 337, 674, 3841, 3839, 0, 2866, 0, 4095, 4095, 0, 0, 4095, 4095, 4095, 0, 4095, 4095, 0, 0, 4095, 4095, 4095, 0, 2047, 4095, 0, 0, 0, 1365, 2866, 0, 4095, 3726, 401, 0, 4095, 0, 4095, 0, 0, 4095, 3948, 0, 4095, 0, 4083, 0, 2928, 0, 2705, 3908, 4095, 0, 2987, 0, 2275, 0, 3751, 1873, 1365, 0, 3895, 996, 2102, 0, 155, 1365, 3372, 606, 4039, 0, 3613, 0, 4095, 0, 4095, 0, 2637, 0, 2535, 4095, 4064, 0, 3762, 4095, 4095, 0, 0, 0, 3663, 0, 4095, 3217, 3916, 0, 4004, 0, 1755, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2586, 4095, 334, 3756, 0, 4095, 4095, 819, 2784, 744, 0, 2047, 0, 2047, 4095, 0, 36, 0, 0, 4082, 4095, 2047, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3185, 3276, 0, 4095, 4095, 819, 0, 0, 0, 0, 0, 2730, 4095, 0, 4043, 1023, 0, 609, 3562, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 4095, 0, 4095, 4095, 4095, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 21, 0, 0, 4095, 0, 1023, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 1820, 0, 0, 4095, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 1219, 4095, 132, 3717, 4095, 4095, 4095, 1365, 4095, 0, 0, 0, 4095, 0, 2275, 0, 1170, 75, 0, 4095, 4095, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 1365, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3867, 0, 0, 0, 240, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 4095, 0, 2457, 0, 1706, 0, 0, 0, 682, 0, 3695, 0, 819, 1927, 3988, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1170, 0, 3722, 0, 3640, 0, 3282, 0, 0, 0, 2632, 0, 0, 0, 4095, 0, 4095, 0, 4095, 0, 4095, 0, 2730, 0, 0, 0, 0, 0, 0, 0, 0, 1365, 4095, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3573, 0, 0, 0, 427, 0, 0, 0, 0, 0, 0, 0, 3844, 0, 4095, 0, 4042, 0, 3737, 0, 898, 0, 1385, 0, 3088, 0, 0, 0, 4095, 0, 4095, 0, 3741, 0, 3850, 0, 3159, 0, 1230, 0, 4095, 0, 2812, 0, 0, 0, 1918, 0, 3124, 0, 3788, 0, 4034, 0, 4095, 0, 2134, 0, 1861, 0, 455, 0, 3412, 0, 4095, 0, 4095, 0, 1489, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 1365, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 35, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 3071, 2866, 0, 0, 3854, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 455, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2088, 0, 1077, 4095, 0, 0, 1592, 0, 3978, 0, 2559, 0, 4017, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2087, 0, 4095, 0, 0, 0, 3084, 0, 0, 0, 819, 0, 4095, 3549, 4095, 0, 4095, 0, 4095, 0, 4045, 3640, 4095, 0, 4095, 0, 0, 0, 4095, 0, 4095, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 4095, 4095, 511, 0, 4095, 3412, 0, 4095, 4095, 2047, 0, 0, 4095, 4095, 4095, 0, 4095, 4095, 0, 0, 4095, 3350, 3640, 0, 0, 4095, 234, 0, 4095, 4095, 0, 0, 4095, 0, 4048, 0, 0, 4095, 0, 0, 4007, 4095, 2532, 0, 0, 0, 0, 0, 3412, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 2730, 0, 0, 4095, 4095, 0, 4065, 0, 0, 0, 3968, 4095, 3098, 0, 3218, 4095, 4068, 0, 0, 4095, 0, 0, 198, 0, 4095, 0, 4095, 3908, 0, 0, 4095, 0, 2559, 0, 0, 4095, 0, 0, 0, 3802, 0, 0, 4095, 0, 0, 0, 0, 2835, 2047, 1965, 0, 4095, 0, 0, 0, 303, 2303, 1318, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 1023, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 1213, 2520, 1968, 0, 3071, 0, 0, 0, 0, 2730, 4095, 0, 4095, 4095, 0, 0, 2457, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1820, 4095, 0, 0, 4095, 0, 0, 0, 546, 4095, 4095, 4095, 4095, 0, 0, 0, 1755, 4095, 2370, 0, 0, 0, 0, 0, 2205, 0, 4095, 4095, 0, 0, 0, 0, 2340, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 4095, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 3780, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 2730, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 4095, 2942, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 4095, 0, 0, 0, 0, 3583, 4095, 2047, 0, 0, 0, 0, 0, 2730, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 2866, 255, 2286, 853, 1331, 322, 0, 0, 0, 3071, 0, 0, 0, 0, 0, 0, 372, 321, 0, 0, 1365, 585, 0, 2047, 0, 4095, 0, 0, 0, 0, 0, 0, 3570, 4032, 0, 3879, 3071, 1724, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 3276, 0, 4095, 0, 1365, 0, 4095, 0, 0, 0, 0, 0, 0, 2457, 0, 0, 0, 0, 0, 0, 0, 3071, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 2559, 0, 0, 0, 2047, 0, 0, 0, 3774, 3412, 0, 4095, 215, 75, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 3536, 3890, 0, 4095, 1638, 3633, 0, 682, 4095, 4095, 0, 0, 0, 0, 0, 0, 3276, 4095, 0, 4095, 2047, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 2730, 4095, 0, 4095, 4095, 1638, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 585, 0, 2275, 2457, 2507, 63, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3071, 107, 0, 4095, 1365, 0, 0, 0, 4013, 1365, 0, 0, 0, 0, 0, 83, 3871, 1958, 0, 4095, 1611, 124, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 4095, 2047, 0, 0, 2559, 2925, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 1365, 3510, 0, 0, 0, 4095, 0, 1129, 0, 3071, 0, 0, 0, 0, 4095, 646, 1724, 2670, 0, 0, 0, 4095, 0, 1365, 4095, 682, 0, 0, 0, 0, 0, 255, 3613, 1489, 0, 0, 0, 0, 0, 682, 4095, 1365, 0, 0, 0, 0, 4095, 1638, 3536, 877, 0, 0, 0, 0, 0, 2047, 0, 2047, 0, 0, 0, 0, 0, 877, 2730, 2866, 0, 0, 0, 0, 0, 2408, 4095, 1365, 0, 0, 0, 0, 0, 2047, 3412, 2730, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3276, 409, 0, 0, 0, 0, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 752, 2890, 3204, 0, 0, 0, 0, 0, 910, 4095, 1638, 0, 0, 0, 0, 0, 4095, 0, 819, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1638, 3372, 0, 0, 0, 0, 0, 0, 199, 4095, 1092, 0, 0, 0, 0, 0, 1919, 1170, 682, 0, 4095, 568, 1638, 0, 3526, 1638, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 2047, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 3822, 3583, 819, 0, 0, 1755, 0, 0, 0, 0, 1365, 0, 0, 0, 0, 0, 0, 799, 1126, 2047, 3412, 1440, 234, 0, 0, 4095, 3812, 0, 0, 0, 0, 0, 447, 2916, 2035, 0, 4095, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 1638, 0, 0, 4095, 3276, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 2877, 1365, 1050, 910, 2641, 2877, 3583, 1023, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2730, 2730, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 3071, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4060, 0, 0, 0, 784, 1628, 0, 3327, 0, 1365, 0, 2730, 292, 3412, 3510, 2730, 2978, 0, 1720, 0, 0, 0, 426, 511, 3712, 0, 1489, 0, 4034, 0, 2047, 0, 0, 0, 0, 0, 3071, 4095, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2824, 0, 3791, 0, 2925, 0, 3050, 0, 0, 0, 3204, 0, 4095, 3802, 4095, 0, 4095, 4095, 3998, 0, 4095, 4095, 4095, 0, 4095, 0, 4095, 0, 4095, 0, 4095, 0, 0, 0, 4095, 0, 4095, 0, 4095, 0, 4095, 0, 4095, 0, 4095, 3947, 4095, 0, 4095, 3583, 3685, 0, 4095, 2047, 0, 0, 4095, 4095, 4095, 0, 4095, 3753, 0, 0, 4095, 4095, 2593, 4095, 3753, 4043, 330, 0, 4095, 0, 4095, 0, 4095, 0, 3908, 0, 3931, 0, 2541, 0, 3802, 0, 4018, 4095, 4095, 0, 4084, 0, 0, 0, 4095, 0, 3071, 0, 1023, 0, 1706, 0, 1638, 0, 220, 0, 4089, 0, 2925, 0, 0, 0, 4053, 4095, 2482, 2730, 2847, 3861, 4035, 4095, 4095, 4095, 0, 4095, 4095, 0, 2778, 0, 4095, 3428, 186, 0, 3981, 0, 1950, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 910, 499, 0, 979, 0, 4095, 3276, 1489, 2165, 2329, 3323, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2559, 2694, 0, 1023, 0, 0, 0, 4095, 3071, 1755, 682, 1780, 0, 0, 0, 0, 0, 0, 390, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 819, 0, 0, 0, 0, 682, 1023, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 481, 0, 2457, 0, 0, 0, 0, 2388, 3510, 4095, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 819, 0, 0, 0, 3071, 2340, 3276, 0, 1801, 2002, 2275, 0, 0, 4095, 4095, 4095, 4095, 4095, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 3412, 511, 0, 0, 0, 0, 4095, 4095, 0, 4095, 0, 0, 4095, 0, 0, 4095, 3854, 2419, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 4095, 0, 4095, 3722, 0, 767, 2687, 3685, 2730, 3350, 2744, 2494, 1082, 0, 4095, 0, 3613, 4095, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 4095, 3992, 1365, 0, 0, 4095, 0, 0, 0, 3071, 2291, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 372, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 4095, 4095, 1365, 4095, 2611, 630, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1365, 0, 4095, 0, 3485, 91, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2457, 4095, 0, 4095, 2454, 2, 0, 0, 0, 0, 0, 0, 0, 0, 4005, 0, 3313, 4095, 204, 1911, 2225, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 3021, 0, 1663, 4095, 2259, 0, 1349, 1356, 3688, 0, 1116, 0, 4092, 0, 2047, 0, 0, 0, 0, 0, 0, 1365, 3893, 2906, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 1587, 4095, 2522, 2340, 650, 39, 4095, 0, 3402, 0, 1365, 0, 3185, 0, 0, 0, 4095, 4095, 4095, 4095, 727, 0, 4095, 0, 4095, 0, 4095, 0, 0, 0, 4095, 0, 4095, 4095, 0, 0, 3309, 37, 4095, 0, 4095, 0, 4095, 0, 4095, 0, 4095, 0, 0, 0, 4095, 0, 4095, 0, 4095, 0, 4095, 0, 0, 0, 4095, 0, 4095, 0, 4095, 4095, 0, 0, 2363, 4095, 4095, 0, 372, 0, 0, 0, 3908, 0, 0, 0, 3856, 0, 0, 0, 1756, 4095, 0, 0, 2816, 0, 4095, 0, 0, 0, 1770, 0, 4095, 0, 0, 0, 1041, 0, 4095, 0, 4095, 0, 0, 0, 4095, 0, 4095, 0, 2730, 0, 4095, 0, 2165, 0, 3267, 0, 4095, 0, 0, 0, 4095, 0, 4095, 0, 2388, 4095, 1170, 0, 1060, 0, 3924, 0, 916, 0, 0, 0, 0, 0, 0, 0, 2205, 4095, 0, 0, 867, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 258, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 3439, 0, 4095, 1583, 31, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3617, 4095, 2643, 1035, 1469, 1060, 4095, 0, 4095, 3465, 3071, 1575, 2520, 0, 0, 0, 0, 0, 0, 0, 3667, 110, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 504, 0, 0, 0, 0, 0, 3232, 682, 2978, 0, 0, 0, 0, 0, 0, 0, 3204, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3780, 4095, 0, 0, 3510, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 3830, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 190, 1365, 0, 4095, 2047, 2730, 1638, 0, 3071, 2586, 2632, 0, 0, 0, 0, 0, 0, 4095, 1755, 585, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2559, 4095, 0, 3753, 2730, 4014, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3867, 4095, 0, 4095, 0, 3510, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2730, 0, 4095, 0, 0, 0, 0, 3071, 4095, 3640, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 2925, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3737, 0, 0, 0, 507, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 2786, 0, 2172, 0, 4095, 0, 722, 0, 3644, 0, 2896, 0, 4066, 0, 2730, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 2992, 0, 3927, 0, 2815, 0, 3035, 0, 315, 0, 3007, 0, 4095, 3350, 4095, 0, 4067, 4095, 4095, 0, 4095, 3478, 4095, 0, 3603, 4095, 0, 0, 4095, 4095, 4095, 0, 4095, 0, 4095, 0, 4095, 0, 4095, 0, 4095, 0, 4095, 0, 4095, 3544, 0, 0, 4095, 0, 4095, 0, 4095, 0, 4095, 0, 4030, 4095, 4095, 0, 1116, 0, 0, 0, 4095, 2730, 3035, 0, 4095, 0, 653, 0, 4095, 0, 0, 0, 4095, 4095, 3602, 0, 4095, 4095, 4095, 0, 3549, 0, 3162, 0, 4095, 0, 4095, 0, 3250, 0, 4095, 0, 4095, 0, 0, 0, 4095, 0, 4095, 0, 4095, 0, 3973, 0, 2586, 0, 0, 0, 3701, 4095, 1105, 0, 3886, 4095, 4095, 0, 0, 0, 4095, 0, 0, 0, 3579, 0, 4095, 3071, 0, 0, 4051, 0, 1999, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 4095, 3774, 0, 910, 0, 4095, 0, 0, 2730, 1418, 3071, 1513, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 4095, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 4095, 4095, 4095, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 4095, 83, 1365, 1510, 4095, 4095, 0, 0, 4095, 1200, 2426, 3539, 0, 4095, 0, 0, 4095, 1023, 4095, 4095, 4095, 4095, 0, 0, 4095, 534, 4095, 2184, 4095, 0, 0, 0, 0, 787, 1562, 1327, 0, 0, 0, 0, 4095, 3854, 0, 682, 4095, 1137, 0, 0, 4095, 2457, 4095, 1859, 4095, 0, 0, 0, 0, 1116, 3946, 744, 0, 0, 0, 0, 0, 1604, 0, 4095, 4095, 3448, 0, 0, 4095, 1968, 0, 0, 4095, 3732, 0, 0, 4095, 2625, 0, 0, 4095, 3017, 0, 0, 4095, 4059, 0, 0, 4095, 4095, 0, 0, 4095, 3685, 0, 0, 4095, 4004, 0, 4095, 1820, 3753, 0, 0, 1170, 4095, 0, 0, 4095, 3071, 0, 0, 4095, 4095, 0, 0, 4095, 3913, 0, 0, 4095, 4095, 0, 0, 4095, 2730, 0, 0, 1365, 3767, 0, 2866, 4095, 4095, 4095, 0, 1638, 3685, 0, 4095, 4095, 3834, 3412, 1330, 4095, 4095, 0, 0, 4095, 2362, 0, 1760, 4095, 4095, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 3248, 2881, 1729, 4095, 3960, 0, 0, 4095, 0, 0, 3510, 0, 4095, 0, 0, 0, 744, 4095, 1592, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 585, 4095, 4095, 0, 0, 0, 0, 0, 4095, 0, 2047, 0, 0, 0, 0, 0, 682, 4095, 1023, 0, 0, 0, 0, 0, 1365, 0, 0, 0, 0, 0, 0, 0, 341, 4095, 0, 0, 0, 0, 0, 0, 1365, 4095, 2047, 0, 0, 0, 0, 0, 1023, 0, 1365, 0, 0, 0, 0, 4095, 2047, 0, 0, 0, 0, 0, 0, 4095, 1365, 0, 4095, 1023, 0, 0, 0, 2815, 240, 1675, 1365, 0, 0, 0, 0, 4095, 585, 819, 2047, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2730, 4095, 227, 0, 0, 3916, 0, 0, 0, 0, 4095, 2730, 0, 4095, 0, 4095, 0, 3201, 315, 0, 0, 2730, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 819, 4095, 3185, 0, 0, 0, 0, 0, 255, 4095, 0, 0, 0, 0, 0, 0, 0, 1365, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 1489, 0, 0, 1365, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 2047, 3685, 0, 4095, 0, 3839, 1365, 2189, 4095, 2835, 0, 1911, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 4072, 2167, 4078, 895, 4053, 0, 4095, 0, 2852, 0, 4095, 4095, 4030, 0, 3493, 0, 2922, 2559, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 2047, 1170, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 653, 4095, 3656, 0, 0, 0, 0, 0, 543, 4095, 2925, 0, 0, 0, 0, 0, 792, 4095, 455, 0, 0, 0, 0, 0, 930, 4095, 534, 0, 0, 0, 4095, 0, 393, 4095, 1146, 0, 0, 0, 0, 0, 334, 4095, 4018, 0, 0, 0, 0, 0, 655, 4095, 0, 0, 0, 0, 0, 0, 383, 4095, 4095, 0, 0, 0, 0, 0, 542, 4095, 1470, 0, 0, 0, 0, 0, 646, 0, 4095, 0, 0, 0, 0, 0, 682, 4095, 0, 0, 0, 0, 0, 0, 170, 4095, 819, 1638, 0, 0, 0, 2047, 0, 0, 2047, 1092, 2649, 2288, 0, 0, 1150, 4095, 2719, 0, 0, 0, 0, 0, 682, 4095, 2047, 0, 0, 0, 0, 0, 0, 4095, 1791, 0, 3510, 0, 4095, 4095, 1638, 4095, 2047, 2047, 4095, 910, 0, 0, 347, 4095, 344, 0, 0, 0, 0, 0, 356, 4095, 3071, 0, 0, 0, 0, 0, 722, 4095, 1675, 2730, 1219, 0, 2632, 0, 1638, 4095, 481, 0, 0, 0, 4095, 0, 1535, 4095, 248, 0, 0, 0, 0, 0, 141, 0, 273, 0, 0, 0, 0, 0, 0, 0, 2457, 4095, 606, 0, 4095, 4095, 819, 4095, 2047, 0, 1365, 0, 0, 0, 1023, 0, 4095, 0, 0, 0, 0, 0, 2457, 2047, 2741, 0, 0, 0, 0, 0, 910, 4095, 4095, 0, 0, 0, 0, 0, 426, 4095, 2508, 0, 682, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3217, 0, 1927, 4095, 2047, 0, 0, 3958, 3350, 2681, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 186, 2925, 4095, 0, 0, 0, 0, 0, 390, 57, 0, 0, 3185, 0, 2047, 0, 0, 0, 2047, 0, 3071, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 819, 0, 3276, 0, 0, 0, 0, 427, 3083, 4095, 0, 0, 0, 0, 0, 2340, 0, 4095, 0, 0, 0, 3603, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 1023, 2362, 0, 2586, 4095, 3890, 4095, 0, 4066, 862, 3995, 481, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 2835, 0, 0, 744, 2835, 0, 2434, 4095, 0, 1023, 190, 3570, 3839, 3298, 2925, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 4095, 0, 4080, 0, 74, 776, 4095, 3276, 4095, 4095, 3249, 4095, 3997, 3071, 4095, 4095, 4095, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 2848, 4095, 1116, 0, 4095, 0, 0, 4095, 3139, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 2340, 0, 0, 4095, 4095, 0, 0, 2873, 48, 4095, 0, 0, 4095, 0, 0, 4095, 4095, 0, 0, 4095, 4095, 0, 0, 4095, 0, 0, 0, 0, 2047, 0, 0, 2047, 2881, 0, 1575, 4095, 0, 0, 4095, 4095, 4095, 3253, 4095, 4095, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 4095, 4095, 0, 0, 4095, 0, 0, 0, 4095, 2730, 0, 2047, 4095, 0, 0, 4095, 2047, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 1365, 0, 3071, 0, 0, 0, 4095, 4095, 0, 95, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 3775, 3336, 0, 0, 4095, 3815, 0, 0, 3962, 3736, 3885, 4095, 4095, 3760, 0, 0, 4095, 3835, 0, 0, 4095, 4095, 0, 0, 4095, 4095, 0, 0, 4095, 3276, 0, 0, 3685, 4027, 0, 2047, 2835, 4095, 0, 4095, 2324, 1365, 120, 0, 4095, 3879, 0, 0, 4095, 4095, 0, 0, 4095, 3276, 0, 0, 4095, 3372, 0, 0, 4095, 3839, 0, 0, 129, 281, 0, 1630, 3199, 4051, 0, 4095, 2845, 3858, 2280, 1068, 4095, 4070, 0, 0, 4095, 4095, 0, 0, 4095, 4095, 0, 0, 4095, 4047, 0, 0, 4095, 4095, 0, 0, 1365, 3071, 0, 2047, 4095, 0, 0, 0, 4095, 1503, 862, 4095, 0, 0, 0, 0, 4095, 3780, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1575, 1421, 0, 2086, 4095, 315, 372, 4095, 2917, 3071, 3009, 1638, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4066, 0, 0, 0, 1059, 204, 0, 2113, 1985, 4095, 0, 3071, 3271, 2016, 3780, 1462, 2984, 0, 630, 0, 0, 0, 819, 0, 3583, 0, 4095, 0, 4087, 0, 0, 0, 0, 0, 0, 0, 0, 3920, 0, 2457, 0, 0, 0, 2047, 3962, 63, 2373, 0, 0, 0, 0, 0, 2457, 0, 4095, 0, 0, 0, 3583, 0, 0, 0, 2730, 0, 0, 0, 0, 0, 455, 2890, 4095, 1732, 4095, 0, 0, 0, 1129, 1206, 819, 27, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 4095, 0, 0, 0, 4095, 0, 642, 3711, 983, 4095, 0, 0, 2047, 0, 0, 0, 1638, 0, 3071, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 4095, 0, 0, 0, 3757, 0, 3600, 3412, 4095, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2457, 0, 3465, 0, 4095, 0, 0, 0, 887, 3180, 3071, 2559, 1365, 0, 2730, 0, 3879, 3873, 1068, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 819, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 682, 0, 2047, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2925, 0, 0, 0, 0, 0, 0, 2047, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3780, 0, 0, 0, 409, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 2821, 0, 1445, 0, 4095, 0, 1638, 0, 3822, 0, 3350, 0, 4095, 0, 2047, 0, 0, 0, 4095, 0, 585, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 3603, 0, 4095, 0, 0, 0, 2906, 0, 0, 0, 4095, 0, 4095, 585, 0, 0, 4095, 3791, 4095, 0, 4004, 3483, 4095, 0, 4095, 0, 4095, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 4095, 3768, 1820, 0, 4095, 0, 4095, 0, 4095, 0, 0, 0, 4095, 4095, 4095, 0, 4095, 0, 0, 0, 4095, 0, 4095, 0, 4095, 0, 0, 0, 4095, 4095, 0, 0, 4095, 4095, 0, 0, 4095, 0, 4095, 0, 4095, 0, 3521, 0, 4095, 0, 0, 0, 4095, 0, 4095, 0, 4095, 0, 0, 0, 4095, 0, 4095, 0, 4095, 0, 0, 0, 3174, 0, 0, 0, 4095, 0, 4095, 0, 2304, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 3276, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 706, 4095, 0, 0, 4095, 0, 0, 4095, 0, 4095, 0, 0, 4095, 0, 0, 0, 0, 4095, 4095, 4095, 4095, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 4095, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3204, 3071, 0, 4095, 0, 0, 0, 4095, 4095, 4095, 0, 4095, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3780, 4095, 0, 4095, 85, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 4095, 1023, 0, 0, 0, 0, 0, 0, 0, 2136, 0, 4095, 4095, 4095, 0, 0, 4095, 2486, 0, 4095, 4095, 3510, 0, 0, 4095, 3276, 0, 0, 4095, 2233, 0, 0, 4095, 3802, 0, 0, 4095, 4095, 0, 0, 4095, 4095, 0, 0, 4095, 3071, 0, 0, 4095, 4095, 0, 0, 4095, 4095, 0, 0, 4095, 3150, 0, 0, 4095, 4095, 0, 0, 4095, 3738, 0, 0, 4095, 3412, 0, 0, 4095, 4095, 0, 0, 4095, 0, 0, 0, 4095, 3510, 0, 0, 4095, 4095, 0, 0, 4095, 4017, 4095, 0, 4095, 1365, 0, 0, 0, 4095, 0, 0, 4095, 4095, 0, 0, 4095, 0, 0, 2275, 4095, 4095, 0, 0, 0, 2801, 2047, 0, 0, 4095, 0, 0, 4095, 3437, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 1365, 0, 0, 0, 1911, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 2457, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2943, 3448, 0, 4095, 2900, 1489, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3753, 0, 2047, 0, 74, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3648, 0, 1170, 0, 4095, 0, 1638, 0, 3839, 0, 3412, 4095, 4043, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2210, 0, 4095, 0, 0, 0, 3322, 0, 0, 0, 2730, 0, 0, 0, 3026, 3753, 4095, 2815, 2233, 124, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 3728, 4095, 0, 4095, 2340, 3017, 0, 0, 0, 0, 4095, 0, 4095, 0, 4095, 0, 819, 4095, 0, 0, 4095, 0, 4095, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 2957, 2730, 0, 0, 2457, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3217, 1535, 1381, 255, 4095, 0, 215, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 4095, 0, 4095, 0, 4095, 819, 3350, 4095, 3510, 0, 1780, 0, 0, 1365, 4095, 4095, 0, 0, 0, 0, 4095, 0, 1170, 4095, 2730, 4095, 3397, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3071, 2649, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 2801, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 2047, 4095, 767, 0, 0, 0, 4095, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 2047, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 1023, 3412, 0, 3943, 2155, 682, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 1861, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 2047, 0, 0, 455, 1365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 767, 409, 2047, 3071, 1727, 599, 0, 0, 4095, 3412, 0, 0, 0, 0, 4095, 1365, 3510, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1023, 1365, 0, 4095, 3071, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1023, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 2047, 0, 2730, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 3510, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 3879, 0, 0, 4054, 3565, 0, 0, 0, 0, 0, 0, 4095, 2457, 4095, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 4095, 4095, 4095, 0, 4095, 3996, 4095, 0, 4095, 3526, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 3948, 3592, 0, 0, 4095, 3276, 0, 0, 4095, 4095, 2457, 0, 4095, 341, 4095, 0, 4095, 4095, 0, 0, 4095, 0, 4095, 0, 4095, 0, 1023, 0, 4095, 0, 0, 0, 4095, 4095, 4095, 4095, 2047, 0, 819, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 3530, 4095, 682, 0, 0, 4095, 0, 4095, 0, 0, 4095, 3929, 0, 0, 0, 0, 4095, 0, 4095, 3906, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 3465, 0, 0, 4095, 4095, 0, 0, 4095, 3276, 0, 0, 4095, 4095, 0, 0, 4095, 3071, 0, 0, 4095, 3276, 0, 0, 4095, 4095, 0, 0, 4095, 0, 1638, 4095, 3071, 4095, 0, 0, 4095, 1228, 0, 0, 4095, 4095, 0, 0, 4095, 4095, 0, 4095, 4095, 3510, 0, 0, 4095, 4095, 0, 0, 4095, 4095, 0, 0, 4095, 4095, 0, 0, 4095, 4095, 0, 0, 4095, 0, 0, 0, 4095, 3685, 0, 0, 4095, 2047, 0, 0, 4095, 2047, 0, 0, 4095, 2047, 0, 0, 4095, 4095, 0, 0, 4095, 4095, 0, 0, 3071, 1365, 0, 0, 4095, 0, 0, 0, 4095, 849, 0, 0, 4095, 4095, 0, 0, 4095, 2047, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 4095, 4095, 0, 0, 4095, 2796, 0, 0, 4095, 2123, 0, 0, 4095, 3566, 0, 0, 4095, 3424, 4095, 0, 4095, 2349, 0, 0, 4095, 4049, 0, 0, 4095, 3003, 0, 0, 4095, 1638, 0, 0, 4095, 2992, 0, 0, 4095, 4095, 0, 0, 4095, 2047, 0, 0, 4095, 2670, 1170, 0, 3350, 4095, 1971, 0, 4095, 3709, 0, 0, 4095, 2408, 0, 0, 4095, 3276, 4095, 1365, 3412, 3412, 455, 409, 4095, 4052, 0, 0, 4095, 1965, 0, 0, 4095, 3822, 3217, 4095, 4095, 2578, 0, 4095, 4095, 3916, 0, 0, 4095, 4095, 0, 0, 4095, 4095, 3948, 4095, 3839, 3879, 4095, 0, 4095, 4095, 0, 0, 4095, 3967, 0, 0, 4095, 0, 0, 0, 4073, 4028, 1116, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 4095, 3611, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 4095, 2271, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 2784, 4095, 3017, 0, 229, 1856, 0, 0, 0, 0, 0, 0, 0, 0, 2925, 0, 4026, 4095, 0, 4095, 2340, 767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 836, 4095, 4095, 0, 461, 215, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3622, 4095, 4095, 0, 1137, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 3802, 4095, 0, 4095, 1627, 292, 0, 0, 0, 0, 4095, 0, 2730, 0, 0, 0, 2730, 4095, 0, 4095, 0, 0, 2047, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 3071, 4095, 0, 4095, 1023, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 2347, 4095, 2145, 2047, 2834, 292, 3098, 0, 1456, 0, 3767, 0, 2275, 0, 2457, 0, 3716, 4095, 744, 2047, 1965, 0, 2502, 0, 2925, 0, 1324, 0, 2866, 0, 3017, 0, 3155, 4095, 3805, 910, 1090, 193, 3519, 0, 2605, 0, 4095, 0, 1804, 0, 910, 0, 3640, 4095, 0, 4095, 3680, 273, 0, 0, 687, 0, 0, 0, 0, 0, 0, 0, 3468, 4095, 2314, 2218, 591, 288, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3540, 4095, 341, 4095, 957, 485, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 3953, 4095, 0, 4095, 3047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2571, 4095, 0, 4095, 3653, 3962, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1365, 4095, 0, 0, 2472, 68, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 130, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2843, 4095, 1023, 2978, 2705, 1228, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1575, 4095, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3510, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 1365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2730, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1365, 0, 2835, 0, 2494, 0, 0, 0, 585, 0, 0, 0, 0, 0, 0, 0, 3725, 0, 273, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 227, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 0, 0, 0, 4095, 0, 2047, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 1365, 0, 4095, 0, 4095, 0, 0, 0, 4095, 0, 4095, 0, 2047, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 4095, 0, 4095, 0, 4095, 0, 0, 4095, 2047, 0, 0, 0, 0, 0, 4095, 0, 3631, 0, 1365, 0, 0, 0, 2457, 4095, 0, 0, 4095, 4095, 1365, 0, 3185, 4095, 2233, 0, 2167, 0, 1126, 0, 3276, 4095, 1365, 0, 1445, 0, 1911, 0, 0, 0, 2047, 0, 3510, 0, 1638, 0, 2545, 0, 3722, 0, 3412, 0, 0, 0, 1433, 0, 2047, 0, 2505, 0, 2457, 0, 4095, 0, 1521, 0, 3802, 4095, 1755, 0, 4095, 3640, 4095, 0, 2379, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 0, 2047, 0, 0, 0, 0, 4095, 551, 4095, 1204, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1755, 4095, 1504, 0, 0, 0, 0, 0, 372, 4095, 3276, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3583, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 4095, 0, 0, 0, 1638, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 4095, 4095, 0, 0, 4095, 3780, 0, 0, 4095, 0, 0, 0, 4095, 2047, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 1204, 3948, 1137, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 862, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1116, 0, 1090, 0, 0, 0, 0, 0, 3926, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 3824, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 2047, 0, 1023, 0, 0, 0, 4095, 0, 0, 0, 1365, 0, 1023, 0, 3827, 0, 4095, 0, 3815, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 4095, 2233, 2047, 0, 1023, 0, 3071, 2047, 2047, 2047, 4095, 0, 4095, 0, 2925, 1535, 4095, 0, 4095, 0, 511, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 1632, 178, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1365, 4095, 585, 0, 0, 0, 0, 0, 1706, 4095, 0, 0, 0, 0, 0, 0, 1489, 4095, 416, 0, 0, 0, 0, 0, 3276, 0, 511, 0, 0, 0, 0, 0, 1050, 4095, 3071, 0, 0, 0, 0, 0, 1365, 0, 2193, 0, 0, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 1706, 4095, 895, 0, 0, 0, 0, 0, 2047, 4095, 0, 0, 0, 0, 0, 0, 1755, 4095, 0, 0, 0, 0, 0, 0, 1365, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1023, 0, 2835, 0, 0, 0, 0, 0, 1365, 4095, 1861, 0, 0, 0, 0, 0, 1023, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 2047, 4095, 327, 0, 0, 0, 0, 0, 682, 0, 3053, 0, 0, 0, 0, 0, 1324, 4095, 235, 0, 0, 0, 0, 0, 1365, 0, 2925, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 511, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 4095, 0, 0, 4095, 3663, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 3510, 0, 0, 4095, 2047, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 1365, 0, 4095, 4095, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 1602, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 3217, 0, 0, 4095, 3722, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 2047, 0, 0, 4095, 0, 0, 0, 4095, 2047, 0, 0, 4095, 4095, 0, 0, 4095, 910, 0, 0, 4095, 4095, 0, 0, 4095, 4095, 0, 0, 4095, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 0, 4095, 4095, 0, 0, 4095, 2730, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 4095, 0, 0, 4095, 3807, 0, 0, 4095, 0, 0, 0, 4095, 4095, 0, 0, 4095, 4095, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}
+#define TEXT1_Data_d {8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 21848, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 5960, 8, 16376, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 6408, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 18728, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 32760, 65528, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 27592, 8, 65528, 8, 65528, 8, 8, 8, 28664, 8, 8, 8, 65528, 8, 8, 8, 60488, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8936, 23832, 39320, 8, 26216, 32760, 8, 17864, 8, 49144, 8, 8, 8, 8, 8, 28088, 8, 65528, 8, 8, 8, 8, 8, 21848, 8, 13112, 8, 8, 8, 8, 8, 21848, 64344, 33752, 8, 65528, 8, 65528, 8, 37448, 8, 58616, 8, 8, 8, 8, 8, 32760, 8, 43688, 8, 8, 8, 8, 8, 16376, 65528, 21848, 8, 8, 8, 8, 8, 43688, 13112, 8, 8, 8, 8, 65528, 8, 16376, 65528, 8, 8, 8, 8, 8, 8, 26216, 54600, 18728, 8, 8, 8, 8, 8, 16376, 8, 8, 8, 8, 8, 8, 8, 9368, 8, 16376, 8, 8, 8, 8, 8, 39320, 8, 14040, 8, 8, 8, 8, 8, 8, 65528, 21848, 8, 8, 8, 8, 8, 8, 8, 16376, 8, 8, 8, 8, 8, 8, 37080, 21848, 32760, 57336, 16024, 26216, 8, 8, 65528, 32760, 8, 8, 8, 8, 8, 8, 64888, 33240, 32760, 8, 8, 59128, 8, 8, 8, 53960, 8, 8, 8, 8, 65528, 43688, 17640, 49144, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 16376, 53960, 8, 8, 28088, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 4088, 3128, 43688, 51480, 26472, 2168, 8, 32760, 8, 8184, 8, 8, 8, 8, 8, 65528, 14328, 24568, 8, 65528, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 21848, 10920, 8, 8, 24568, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 43688, 8, 8, 8, 8, 8, 8, 30792, 54792, 8, 65528, 8, 60056, 8, 23928, 65528, 38712, 8, 8, 8, 8, 8, 36408, 56968, 27928, 8, 8, 8, 8, 8, 30504, 65528, 21848, 8, 8, 8, 8, 8, 40088, 65528, 11624, 8, 8, 8, 8, 8, 29128, 65528, 62792, 8, 8, 8, 8, 8, 37720, 65528, 35928, 8, 8, 8, 8, 8, 26808, 8, 14568, 8, 8, 8, 8, 8, 25736, 65528, 40568, 8, 65528, 8, 65528, 8, 30104, 65528, 10536, 8, 8, 8, 8, 8, 17864, 65528, 58968, 8, 8, 8, 8, 8, 20472, 8, 7288, 8, 8, 8, 8, 8, 4856, 65528, 5176, 8, 8, 8, 8, 8, 9368, 8, 6904, 8, 8, 8, 8, 8, 35288, 8, 29192, 8, 8, 8, 8, 8, 24568, 65528, 18344, 8, 8, 8, 8, 8, 8, 65528, 28824, 8, 8, 8, 8, 8, 13112, 8, 65528, 8, 8, 8, 8, 8, 30984, 65528, 25640, 8, 8, 8, 8, 8, 38824, 8, 38600, 8, 8, 8, 8, 8, 30024, 46408, 9512, 8, 8, 4680, 8, 8, 20168, 65528, 32760, 8, 8, 8, 8, 8, 41688, 65528, 2616, 8, 8, 27304, 8, 8, 3640, 8, 4568, 8, 8, 8, 8, 8, 9368, 8, 13112, 8, 8, 65528, 8, 8, 14568, 8, 10920, 8, 8, 8, 8, 8, 16376, 15128, 61096, 65528, 65528, 9096, 11912, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 43688, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 5464, 8, 65528, 10920, 58248, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 26216, 18728, 16376, 32760, 32760, 8, 8, 37800, 36408, 45864, 65528, 8, 8, 57336, 65528, 8, 8, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 8, 62824, 65528, 8, 8, 8, 34328, 20968, 49144, 8, 8, 8, 65528, 65528, 8, 8, 17864, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 3976, 28760, 8, 27480, 17240, 36696, 40952, 55128, 35064, 42312, 35160, 32760, 8, 8, 65528, 65528, 8, 8, 8, 2616, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 65528, 54600, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 65528, 65528, 16376, 50408, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 49144, 65528, 8, 8, 45864, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 65528, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 65528, 8, 65528, 65528, 65528, 8, 43688, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 65528, 65528, 65528, 8, 23832, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 32760, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 65528, 40952, 9368, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 3128, 7912, 10920, 29480, 32760, 65528, 65528, 24136, 40904, 48888, 46040, 8, 9032, 8, 52424, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 65528, 8, 46808, 47048, 1688, 12824, 13112, 65528, 8, 53960, 21848, 8, 26216, 16872, 65528, 8, 65528, 8, 8, 8, 43688, 28088, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 6248, 56168, 39320, 58248, 8, 65528, 8, 8, 43688, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 61880, 8, 8, 8, 8, 50968, 32760, 65528, 8, 8, 8, 65528, 8, 65528, 8, 49144, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 15416, 65528, 9368, 8, 46808, 38216, 8, 29784, 34056, 31368, 36584, 8, 8, 8, 65528, 65528, 65528, 8, 46808, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 65528, 8, 65528, 14568, 32760, 8, 8, 8, 65528, 26216, 52424, 55688, 8, 8, 65528, 8, 8, 8, 8, 4088, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 32760, 16376, 13112, 8, 8, 65528, 8, 8, 18792, 46680, 21416, 8, 65528, 65528, 57848, 65528, 8, 65528, 65528, 65528, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 32760, 6552, 8, 65528, 8, 8, 8, 65528, 65528, 8, 49144, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 4088, 45640, 6552, 53480, 8, 8, 8, 65528, 21848, 8, 8, 65528, 8, 8, 44808, 65528, 8, 65528, 23224, 6472, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 52152, 65528, 26216, 46344, 14376, 48728, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 53240, 65528, 8, 65528, 48184, 53960, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 55448, 65528, 8, 21848, 15384, 35736, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 51928, 65528, 7288, 63656, 58392, 23832, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 42120, 65528, 8, 65528, 46808, 5048, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 37448, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 61672, 65528, 8, 26216, 3448, 20168, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 54056, 65528, 8, 65528, 49144, 25480, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 40952, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 62904, 65528, 8, 65528, 26664, 63368, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 46808, 65528, 8, 8, 38216, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 56792, 65528, 8, 8, 17544, 13112, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 52424, 65528, 8, 65528, 54168, 1144, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 65528, 65528, 37880, 31032, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 60168, 65528, 8, 65528, 46296, 65528, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 53608, 65528, 8, 65528, 17864, 4568, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 45320, 65528, 8, 36696, 59768, 34488, 8, 8, 65528, 8, 55816, 16376, 57960, 8, 8, 8, 65528, 65528, 8, 65528, 37448, 408, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 28088, 8, 11912, 32760, 8, 8, 8, 32760, 65528, 38952, 34680, 42344, 8, 8, 8, 63592, 65528, 8, 8, 58968, 21848, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 6552, 56168, 8, 65528, 18728, 43688, 8, 8, 8, 8, 32760, 10920, 65528, 8, 8, 8, 46808, 65528, 8, 8, 26216, 9368, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 23832, 6904, 64680, 32760, 65528, 8, 8, 45944, 49144, 44936, 8, 65528, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 4232, 61432, 65528, 8, 8, 65528, 8, 8, 8, 8, 65528, 8, 65528, 65528, 8, 8, 14040, 35736, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 10920, 21848, 2024, 8, 65528, 8, 8, 49144, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 32760, 8, 8, 8, 8, 8, 16984, 8, 6552, 8, 2504, 65528, 65528, 32760, 7288, 16376, 65528, 32760, 32760, 8, 32760, 8, 27432, 20056, 10920, 39000, 53960, 32760, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 49144, 8, 8, 8, 8, 8, 65528, 13112, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 29128, 8, 43688, 8, 8, 4088, 8, 8, 8, 21848, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 40328, 22792, 35496, 60840, 49144, 10344, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 49144, 43688, 8, 8, 8, 8184, 65528, 26216, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 21848, 8, 8, 8, 8, 8, 35352, 49144, 26216, 6712, 14248, 8, 63432, 4600, 48280, 8936, 5240, 6136, 65528, 8, 49144, 13752, 37352, 37816, 7992, 37208, 41112, 9464, 21064, 4680, 8, 65528, 8, 8, 65528, 32760, 8, 16376, 8, 8, 65528, 8, 65528, 65528, 47528, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 32760, 8, 32760, 8, 8, 8, 65528, 65528, 13112, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 10920, 8, 8, 8, 65528, 8, 8, 8, 16376, 32760, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 14568, 8, 21848, 8, 54600, 8, 16984, 4088, 16984, 16376, 65528, 65528, 10920, 8, 8184, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 65528, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 7080, 60056, 14168, 8, 43688, 8, 54600, 65528, 15576, 6552, 62776, 13112, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 7016, 65528, 8, 65528, 8, 8, 8, 8, 8, 65528, 12216, 8, 43688, 8, 8, 8, 8, 52424, 25736, 43688, 8, 8, 8, 8, 8, 43688, 25896, 8, 8, 8, 8, 8, 32760, 8, 8, 65528, 8, 8, 8, 8, 6920, 65528, 65528, 8, 43688, 8, 8, 65528, 46696, 8, 65528, 65528, 7288, 65528, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 65528, 8, 8, 8, 17240, 8, 49144, 8, 55448, 8, 8, 16376, 21848, 65528, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 54600, 55448, 16376, 8, 65528, 8, 65528, 65528, 65528, 32760, 8, 25368, 8, 65528, 8, 8, 8, 8, 8, 22792, 65528, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 55240, 41256, 31512, 54920, 65528, 8, 8, 8, 39320, 8, 21848, 65528, 8, 8, 8, 8, 26216, 8, 13896, 8, 8, 8, 8, 8, 8, 8, 8, 8, 4376, 8, 65528, 63400, 65528, 8, 61160, 8184, 49144, 8, 65528, 26216, 26216, 32760, 7704, 21848, 41688, 61672, 17480, 26040, 15928, 5704, 54296, 48424, 6600, 56552, 8, 8, 5960, 8, 8, 65528, 37448, 8, 65528, 8, 8, 8, 8, 65528, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 49144, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 35496, 60600, 11528, 10552, 65528, 65528, 65528, 42312, 8, 16376, 8, 65528, 8, 8, 65528, 8, 43688, 26216, 5960, 8, 65528, 41688, 65528, 8, 8, 8, 32760, 8, 8, 21848, 8, 65528, 65528, 8, 8, 21848, 65528, 8, 65528, 10920, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 26216, 8, 8, 21848, 8, 65528, 8, 60056, 38216, 65528, 65528, 65528, 8, 8, 65528, 8, 8, 65528, 8, 8, 8, 8, 8, 43688, 54600, 8, 8, 8, 8, 8, 8, 8, 19656, 65528, 8, 49144, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 32760, 8, 8, 40952, 8, 8, 65528, 8, 48616, 8, 9832, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 43688, 39320, 8, 15720, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 13112, 8, 65528, 8, 16184, 65528, 65528, 65528, 10920, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 43688, 16376, 8, 49144, 13112, 8, 65528, 8, 56168, 32760, 36856, 13736, 37448, 32760, 45864, 65528, 43368, 19352, 7816, 25240, 47960, 12232, 29128, 8, 8, 15416, 43688, 10216, 8, 3848, 8, 65528, 8, 4680, 65528, 49144, 65528, 65528, 65528, 8, 8, 10920, 8, 65528, 8, 8, 8, 8, 8, 10088, 9368, 1736, 8, 8, 8, 8, 8, 8, 8, 8, 8, 42120, 8, 65528, 2520, 8, 65528, 3224, 1816, 28088, 8, 16376, 8, 8, 8, 8, 65528, 28088, 8, 8, 54600, 56168, 8, 39320, 65528, 10232, 8, 8, 8, 22600, 21416, 31592, 8, 8, 3848, 65528, 32760, 10920, 8, 14520, 30424, 65528, 52424, 8, 8, 3336, 8, 7560, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 20840, 9368, 58824, 65528, 8, 8, 8, 54600, 8, 32760, 65528, 45864, 8, 54600, 8, 65528, 280, 24968, 19768, 52424, 8, 8, 46808, 45464, 26344, 9544, 38360, 39288, 6824, 8, 8, 8, 1336, 21848, 13848, 60488, 31576, 8, 42536, 8, 8, 65528, 18040, 8, 8, 8, 65528, 8, 8, 65528, 3368, 8, 8, 8, 8, 8, 8, 8, 10920, 8, 8, 8, 8, 8, 16376, 57160, 4232, 8, 8, 8, 8, 32760, 11640, 6904, 37720, 19656, 8, 65528, 52424, 8, 8, 8, 8, 8, 8, 8, 30248, 26216, 65528, 10088, 32760, 52424, 8, 8, 8, 8, 8, 8, 53448, 8, 8, 8, 8, 8, 2856, 65528, 42840, 65528, 8, 46808, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 5144, 65528, 1496, 2552, 10920, 8, 61160, 18568, 8, 8, 8, 8, 8, 8, 8, 8, 32760, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 27304, 31752, 8, 61944, 8, 8, 8, 8, 39992, 65528, 8232, 60488, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 35736, 33080, 8, 62248, 39320, 52424, 1720, 29640, 35496, 45864, 40328, 20600, 8, 8, 8, 8, 8, 8, 8, 8, 8, 49144, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 16376, 30504, 8, 62248, 8, 8, 8, 8, 52728, 50968, 65528, 49144, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 18728, 24856, 8, 60840, 21848, 8, 8, 8744, 17192, 41496, 32760, 57336, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 43688, 8, 8, 8, 8, 8, 8, 8, 54600, 8, 8, 41448, 37032, 8, 50984, 65528, 65528, 8, 9656, 16936, 54552, 6408, 53960, 65528, 32760, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 25976, 8, 65528, 16376, 8, 8, 26984, 20696, 48056, 64488, 56168, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 23400, 8, 62248, 8, 65528, 8, 8, 28088, 65528, 65528, 65528, 8, 8, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 32760, 38904, 8, 65528, 8, 8, 8, 8, 28488, 43688, 39880, 10920, 8, 43688, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 21848, 8, 8, 39320, 28584, 8, 62792, 8, 8, 8, 8, 58968, 65528, 440, 47320, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 5464, 8, 56168, 8, 8, 8, 36408, 8, 54600, 26216, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 52424, 65528, 65528, 65528, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 32760, 56840, 8, 65528, 8, 8, 8, 16376, 17704, 8520, 65528, 2216, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 43688, 13656, 8, 65528, 8, 8, 8, 8, 50968, 65528, 52424, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 46248, 33464, 8, 61048, 8, 65528, 8, 8, 56488, 65528, 64408, 65528, 65528, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 32760, 32760, 8, 63224, 8, 8, 8, 8, 44824, 47448, 9000, 65528, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 16376, 17544, 8, 65528, 8, 65528, 8, 10920, 36408, 65016, 10232, 23832, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 13112, 8, 65528, 8, 8, 8, 8, 32760, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 20168, 37704, 8, 59640, 65528, 8, 8, 28088, 65096, 63560, 65528, 42392, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 21848, 36696, 8, 50280, 8, 8, 8, 7288, 42120, 14568, 65528, 49144, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 18152, 35496, 8, 51288, 21608, 65528, 1928, 19480, 48200, 2920, 29128, 27304, 32760, 65528, 8, 32760, 8, 21848, 65528, 8, 44552, 53960, 11560, 57656, 58248, 11128, 58248, 8, 8, 8, 8, 8, 65528, 23656, 8, 53240, 8, 8, 8, 8, 23832, 65528, 17000, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 15416, 8, 52424, 21848, 8, 29784, 8, 3752, 65528, 65528, 65528, 8, 8, 8, 8, 8, 65528, 8, 65528, 50280, 34744, 3640, 52840, 62904, 40600, 8, 8, 8, 8, 8, 8, 65528, 55000, 8, 32760, 8, 8, 8, 8, 16376, 1528, 32760, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 11912, 8, 26216, 8, 8, 8, 65528, 43688, 65528, 65528, 26216, 8, 8, 8, 8, 65528, 65528, 65528, 8, 32760, 32760, 10920, 57336, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 14568, 8, 54600, 8, 8, 8, 8, 65528, 65528, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 6552, 8, 43688, 34648, 54600, 7288, 58616, 5048, 21848, 65528, 376, 24568, 13112, 50968, 14568, 14568, 8, 62072, 32760, 32440, 40120, 11400, 50104, 53960, 20472, 56376, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 34184, 30248, 35736, 60488, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 54600, 8, 65528, 8, 5176, 65528, 32760, 54056, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 39560, 8, 8, 8, 8, 8, 8, 49144, 43688, 21848, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 57960, 8, 8, 39320, 26216, 8, 65528, 8, 65528, 8, 8, 8, 65528, 8, 32760, 8, 43688, 21848, 8, 62248, 32760, 13112, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 11560, 8, 65528, 8, 9624, 8, 65528, 8, 8, 65528, 13112, 8, 36040, 35288, 38712, 35736, 47656, 16376, 42920, 25208, 16376, 43688, 18728, 26216, 43688, 21848, 8, 65528, 65528, 34632, 48616, 14616, 52344, 34392, 27816, 15048, 14328, 26552, 4232, 45864, 35736, 8184, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 16376, 8, 65528, 8, 8, 65528, 8, 8, 52424, 8, 8, 65528, 8, 65528, 8, 65528, 32760, 8, 32760, 65528, 1080, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 43688, 8, 8, 65528, 8, 57656, 8, 8, 8, 8, 65528, 8, 65528, 25688, 8, 8, 65528, 65528, 8, 62936, 8, 65528, 65528, 13112, 8, 65528, 8, 8, 32760, 8, 32760, 8, 8, 65528, 8, 8, 65528, 65528, 32760, 43688, 29128, 43688, 8, 32760, 21848, 8, 36408, 10568, 54600, 65528, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 65528, 21848, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 33816, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 53608, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 18728, 65528, 8, 8, 8, 65528, 58488, 8, 43688, 8, 8, 65528, 8, 52536, 13960, 30584, 28088, 63848, 54840, 1336, 15816, 2856, 9144, 8, 54600, 65528, 15224, 60568, 58616, 32760, 42728, 22792, 65528, 57656, 8, 20328, 18728, 8, 39320, 37448, 65528, 32760, 65528, 39448, 9832, 65528, 18872, 22216, 9256, 45128, 26216, 43352, 36472, 8, 45448, 24728, 21848, 42728, 19656, 51624, 8, 8, 7288, 65528, 3272, 8, 8, 8, 8, 8, 16632, 34952, 61240, 8, 8, 65528, 8, 43688, 1256, 65528, 8, 8, 8, 8, 8, 8, 7080, 16728, 11352, 65528, 65016, 8, 8, 8, 5064, 48280, 19848, 8, 8, 8, 8, 8, 16376, 65528, 8, 8, 8, 8, 8, 8, 8, 45864, 25432, 65528, 65528, 8, 8, 8, 8, 8, 43688, 8, 8, 8, 8, 8, 17864, 8, 65528, 8, 65528, 8, 8, 8, 32760, 8, 43688, 8, 8, 65528, 8, 8, 8, 8, 8, 37448, 65528, 8, 8, 6552, 9368, 8, 65528, 65528, 8, 8, 65528, 8, 65528, 43688, 8, 8, 65528, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 65528, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 9368, 32760, 8, 8, 65528, 8, 65528, 6024, 26216, 15000, 8, 65528, 8, 8, 8, 8, 8, 22552, 65528, 8, 8, 8, 8, 8, 8, 30584, 8, 8, 8, 8, 8, 60488, 53240, 16984, 8, 8, 8, 8, 8, 16376, 8, 8, 8, 8, 8, 8, 8, 8, 8, 20696, 8, 8, 8, 8, 65528, 8, 8, 8, 32760, 8, 50632, 16376, 8, 8, 32760, 37448, 8, 8, 65528, 8, 8, 8, 46808, 58248, 26216, 9368, 26216, 35288, 34488, 8, 8, 35736, 8, 8184, 65528, 65528, 8, 8, 35048, 65528, 8, 8, 8, 65528, 8, 8, 65528, 52424, 8, 8, 65528, 8, 8, 8, 32760, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 49144, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 65528, 8, 32760, 18728, 65528, 8, 8, 8, 8, 8, 8, 51352, 8, 8, 8, 8, 8, 8, 872, 8, 8, 8, 8, 8, 8, 8, 8, 17864, 8, 8, 8, 8, 8, 8, 8, 8184, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 32760, 11560, 32760, 53608, 22552, 13656, 8, 8, 21848, 60840, 8, 8, 65528, 8, 8, 8, 61800, 61080, 65528, 65528, 36408, 60760, 8, 8, 8, 21848, 8, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 21848, 8, 8, 8, 8, 28088, 8, 8, 65528, 8, 8, 8, 41928, 65528, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 2344, 8, 43688, 35496, 10248, 2120, 8, 8, 8, 40952, 8, 8, 65528, 8, 8, 8, 53608, 8, 8, 65528, 21848, 47656, 8, 8, 58968, 5048, 8, 8, 8, 8, 8, 32760, 65528, 9704, 46808, 46808, 34840, 1672, 8, 20232, 65528, 65528, 8, 8, 8, 8, 8, 8184, 65528, 8, 8, 8, 8, 8, 8, 8184, 65528, 43688, 8, 8, 8, 8, 8, 8, 63944, 50552, 8, 65528, 8, 64024, 8, 4376, 8, 25352, 8, 8, 65528, 8, 65528, 936, 53384, 6776, 8, 65528, 65528, 63656, 42840, 4856, 8, 14456, 39320, 8, 8, 8, 65528, 39320, 39320, 2344, 21848, 8, 8, 18728, 32760, 8184, 32760, 43416, 32760, 49144, 65528, 8, 65528, 25368, 45800, 40952, 37864, 32760, 19944, 19272, 8, 28568, 4280, 29480, 43688, 65528, 8, 8, 8, 8, 32760, 8552, 8, 8, 8, 8, 8, 8, 4680, 1464, 8, 8, 65528, 10920, 8, 32760, 35736, 3272, 8, 8, 8, 8, 8, 8, 8, 26808, 8, 8, 8, 8, 8, 8, 49144, 4856, 8, 8, 8, 8, 8, 8, 8, 4232, 8, 8, 8, 8, 8, 8, 65528, 21528, 8, 8, 8, 8, 8, 8, 8, 25320, 8, 8, 8, 8, 8, 8, 52424, 44504, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 32760, 5048, 39320, 3608, 32760, 65528, 8, 8, 8, 13112, 52424, 50664, 8, 8, 65528, 8, 8, 16376, 13112, 14824, 65528, 8, 24024, 10920, 8, 8, 8, 39016, 8, 8, 43688, 8, 8, 8, 8, 8, 8, 8, 33704, 8, 8, 65528, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 10920, 8, 8, 32760, 8, 8, 8, 24760, 8, 8, 8, 65528, 8, 8, 8, 16376, 59512, 47656, 47320, 23064, 9112, 65528, 59480, 65528, 38216, 4232, 54600, 8, 8, 8, 8184, 21848, 63176, 8, 65528, 8, 65528, 8, 3688, 65528, 43000, 8, 8, 8, 8, 8, 39320, 46808, 8, 8, 8, 16904, 14568, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 28088, 8, 13800, 32760, 8, 8, 8, 8, 65528, 168, 8, 58968, 60952, 8, 54600, 29128, 28232, 32760, 32760, 56792, 65528, 59560, 8, 65528, 65528, 65528, 36408, 32760, 16376, 8, 65528, 39320, 36408, 32760, 8, 26216, 65528, 54952, 9832, 36408, 65528, 30648, 59144, 11656, 50792, 24136, 22968, 22760, 6552, 18056, 4200, 17112, 48424, 64488, 8, 8, 7624, 8, 52424, 8, 43688, 8, 8, 8, 8, 65528, 8, 32760, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 65528, 10920, 45048, 8, 7288, 1592, 63208, 52648, 504, 4440, 8, 8, 8, 65528, 8, 43304, 56968, 52600, 16376, 65528, 43688, 65528, 65528, 65528, 8, 65528, 43688, 8, 11912, 8, 8, 65528, 47448, 8, 65528, 49144, 36408, 5960, 65528, 32760, 8184, 21848, 8, 20840, 5464, 50968, 8, 65448, 55176, 8, 8, 8, 8, 8, 8, 32760, 8, 8, 8, 8, 36408, 32760, 65528, 8, 8, 9368, 8, 8, 8, 8, 8, 8, 65528, 8, 65528, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 52424, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 25368, 8, 8, 60056, 8, 8, 8, 65528, 65528, 8, 3272, 65528, 8, 8, 21848, 8, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 65528, 8, 8, 65528, 8, 65528, 32760, 65528, 26216, 8, 8, 8, 65528, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 56168, 8, 8, 65528, 8, 8, 8, 32760, 8, 65528, 8, 8, 65528, 16376, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 43688, 8, 65528, 65528, 8, 8, 8, 8, 10920, 10920, 8, 8, 8, 8, 8, 1000, 28088, 8, 40728, 64920, 65528, 8, 9368, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 43688, 8, 65528, 8, 65528, 8, 8, 8, 8, 65528, 8, 32760, 8, 8, 65528, 58344, 43112, 14040, 20696, 35496, 21848, 24568, 8, 51480, 8184, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 9368, 21848, 8, 8, 8, 8, 65528, 8, 60520, 65528, 8, 65528, 8, 50408, 8, 63384, 8, 65528, 65528, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 43688, 8, 8, 8, 65528, 8, 42392, 8, 40952, 32760, 10920, 65528, 65528, 8, 42120, 29784, 26216, 32760, 43688, 8, 8, 8, 65528, 57336, 53608, 54600, 49144, 30840, 62568, 6904, 13112, 32760, 9368, 56168, 32760, 56968, 8, 65528, 65528, 51032, 45176, 19656, 47256, 33704, 41368, 9000, 10696, 16296, 8392, 40616, 43688, 56488, 8, 8, 8, 8, 30248, 65528, 65528, 65528, 4040, 63704, 8, 8, 7864, 10920, 8, 8, 65528, 8, 8, 8, 61160, 32760, 8, 65528, 65528, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 53608, 65528, 65528, 65528, 5960, 21848, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 52424, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 2520, 8, 27304, 8, 8, 65528, 65528, 18728, 65528, 8, 9368, 43688, 56168, 8, 65528, 65528, 8, 8, 65528, 8, 8, 8, 4792, 8, 8, 16376, 8, 65528, 8, 8, 13112, 8, 65528, 19656, 26216, 60488, 46808, 32760, 25208, 61880, 8, 54600, 8, 65528, 8, 8, 8, 8, 8, 8, 36216, 65528, 20600, 17336, 65224, 1608, 65528, 8, 49144, 8, 20840, 8, 8, 65528, 32760, 8, 52424, 65528, 8, 8, 2376, 10088, 24232, 19416, 8, 39320, 56488, 4856, 8, 8, 8, 8, 40952, 65528, 8, 8, 8136, 1592, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 45864, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 61160, 65528, 32760, 8, 18728, 3608, 65528, 49144, 11912, 65528, 8, 8, 8, 65528, 8, 2040, 8, 8, 43688, 25480, 65528, 4088, 38216, 18344, 45864, 56168, 61672, 12488, 8, 8, 8, 65528, 664, 65528, 21848, 4088, 5512, 1960, 8, 65528, 40952, 8, 8, 8, 21848, 65528, 65528, 55960, 28584, 43240, 38312, 12280, 20728, 20344, 3944, 42264, 12488, 55592, 28392, 8, 8, 8, 8, 8, 56696, 65528, 65528, 65528, 22024, 2440, 46808, 61160, 9976, 32392, 8, 8, 65528, 7992, 8, 8, 26216, 8, 8, 65528, 25496, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 32760, 8, 8, 65528, 7080, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 39320, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 53384, 65528, 10920, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 52856, 65528, 19656, 32760, 2984, 47656, 16376, 32760, 8, 8, 8, 65528, 8, 11912, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 32760, 65528, 53608, 59560, 8, 32760, 65528, 8, 52424, 4088, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8184, 63656, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 64312, 65528, 8, 65528, 4088, 56664, 8, 8, 37448, 8, 60056, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 61816, 8, 65528, 8, 65528, 8, 6616, 6552, 31448, 21848, 9368, 8, 65528, 42840, 64264, 58248, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 19656, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 49144, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8856, 65528, 504, 25240, 8, 8, 65528, 4280, 8, 65528, 65528, 8, 8, 8, 56376, 8, 64792, 46728, 5048, 62648, 64616, 424, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 32760, 65528, 1320, 30328, 8, 8, 65528, 3640, 56168, 8, 49144, 6552, 65528, 65528, 37720, 9704, 18072, 23400, 16376, 34184, 32760, 9832, 60600, 18344, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 65528, 8, 65528, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 16376, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 1000, 25688, 8, 8, 65528, 2584, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 51912, 65528, 8, 21848, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 4680, 65528, 8, 8, 8, 13656, 50968, 8328, 33000, 8, 8, 65528, 2552, 61880, 5960, 65528, 53048, 45864, 8, 58968, 8, 1640, 1720, 2040, 63800, 61000, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 65528, 8, 8, 8, 8, 8, 54600, 12360, 8, 8, 8, 8, 30008, 45832, 792, 31848, 65528, 8, 65528, 10392, 43688, 6552, 37448, 46104, 22792, 632, 64024, 7288, 40216, 34344, 8, 48776, 63880, 20648, 8, 8, 8, 9368, 8, 5720, 8, 8, 8, 8, 8, 8, 43688, 8, 65528, 8, 8, 8, 8, 32760, 65528, 25576, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 58616, 8, 8, 32760, 65528, 1992, 15480, 21848, 32760, 50968, 2312, 37448, 8, 8, 8, 65528, 16376, 61880, 5464, 8, 17480, 5048, 55928, 40952, 8, 65528, 9368, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 23256, 8, 8, 65528, 2680, 65528, 16376, 8, 16376, 8, 65528, 8, 8, 8, 8, 8, 22936, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 27592, 41688, 20664, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 16376, 6552, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 39592, 65528, 5800, 40360, 8, 8, 65528, 23560, 49144, 8, 8, 47656, 16376, 8, 29128, 8, 1880, 1016, 88, 60840, 61512, 1848, 65528, 5048, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 10920, 65528, 3032, 17720, 8, 8, 65528, 3464, 8, 8, 8, 8, 65528, 8, 65528, 8, 51032, 33432, 8, 59016, 64936, 33320, 48280, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 2264, 14568, 8, 8, 65528, 7016, 8, 8, 8, 8, 56168, 8, 10920, 65528, 8, 8, 65528, 8, 60056, 14568, 8, 8, 65528, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 36408, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 30248, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 22600, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 17480, 60056, 360, 30024, 8, 8, 65528, 4632, 8, 19656, 8, 6248, 54600, 11128, 60600, 43688, 14104, 8, 1160, 33384, 8, 8184, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 9064, 14568, 31544, 8, 8, 8, 8, 8, 8, 8, 21848, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 6312, 3544, 2936, 8, 8, 8, 8, 8, 65528, 2728, 27880, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 16376, 26696, 27944, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 2920, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 53240, 59816, 1128, 19208, 8, 8, 65528, 4680, 32760, 8, 8, 1896, 8, 8, 58616, 8, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 9480, 40952, 968, 8, 8, 8, 8, 8, 8, 8, 24376, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 16376, 8, 8, 8, 8, 8, 8, 28488, 65528, 3816, 19064, 8, 8, 65528, 2600, 55448, 8, 65528, 8, 65528, 8, 65528, 8, 56216, 47144, 3848, 56424, 46872, 33240, 65528, 8, 8, 8, 8, 59560, 8, 8, 8, 8, 8, 10920, 8, 43688, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 24856, 8, 8, 65528, 2184, 37448, 8, 8, 8, 65528, 8, 58968, 65528, 8, 8, 8, 29864, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 32760, 65528, 1576, 23896, 8, 8, 65528, 5624, 39320, 39320, 8, 43688, 8, 8, 53608, 19656, 8, 8, 8, 62728, 65528, 1256, 14248, 8, 65528, 65528, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 32760, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 51960, 65528, 12504, 30120, 8, 8, 65528, 7160, 65528, 8, 8, 8, 8, 60488, 65528, 8184, 52920, 8, 5960, 32760, 32760, 1816, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 65528, 8, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 43352, 65528, 1096, 25992, 8, 8, 65528, 6008, 44904, 8, 57336, 21848, 17032, 39320, 65528, 29784, 15336, 8616, 56, 48920, 58888, 8456, 8, 8, 65528, 65528, 8, 8, 65528, 8, 65528, 65528, 8, 65528, 32760, 32760, 8, 65528, 8, 8, 65528, 38408, 43688, 1272, 38408, 49144, 32760, 7704, 65528, 24568, 6344, 37448, 32760, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 3848, 21848, 31448, 8, 65528, 3512, 8, 65528, 8, 8, 8, 8, 65528, 8, 60488, 3064, 8, 5512, 64456, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 4376, 18200, 16376, 8, 65528, 3640, 21848, 8, 8, 8, 59560, 60488, 65528, 8, 8, 8, 8, 65528, 8, 32760, 8, 8, 8, 8, 8, 8, 8, 43688, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 65528, 65528, 46408, 41144, 3704, 63368, 21848, 29128, 21192, 8, 8424, 8, 43352, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 12488, 63176, 8, 8, 65528, 9368, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 64312, 8, 8, 16376, 41688, 65528, 56168, 8, 21848, 8, 8, 8, 8, 8, 8, 59288, 7288, 21848, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 32760, 8, 8, 8, 65528, 8, 8, 65528, 65528, 43688, 50968, 38216, 8, 8, 29784, 8, 30584, 14568, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 43688, 65528, 1176, 50008, 8, 8, 65528, 9592, 8, 8, 8, 65528, 65528, 65528, 65528, 8, 8, 8, 8, 1016, 1080, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 64744, 8, 8, 65528, 1880, 65528, 65528, 54328, 9144, 11912, 8, 32760, 65528, 8, 65528, 8, 65528, 37448, 44824, 35736, 32760, 18728, 61672, 50968, 10920, 49144, 56792, 65528, 32760, 63960, 49144, 65528, 64152, 20040, 49544, 7032, 46600, 32760, 38216, 16088, 5960, 27448, 5064, 48056, 32760, 60488, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 43688, 8, 43688, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 32760, 24968, 9368, 40952, 25208, 33816, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 42696, 32760, 568, 21848, 2424, 8, 8, 8, 24568, 8744, 40952, 8, 43688, 43688, 65528, 43688, 28312, 15128, 5048, 46952, 61544, 22248, 51928, 424, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 32760, 65528, 65528, 65528, 65528, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 32760, 58248, 58248, 8, 21848, 49144, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 13800, 65528, 65528, 65528, 46808, 13112, 8, 8, 8, 8, 65528, 8, 8, 65528, 8, 8, 8, 8, 65528, 8, 8, 39320, 8, 8, 65528, 65528, 8, 8, 65528, 25208, 32760, 28088, 52424, 8, 8, 4680, 8, 43688, 3752, 51480, 8, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 1560, 3848, 8, 8, 8, 8, 21848, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 5464, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8184, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 65528, 8, 8, 26216, 65528, 8, 8, 8, 8, 65528, 8, 8, 65528, 65528, 8, 8, 8, 52424, 65528, 32760, 65528, 8, 8, 8, 8, 4680, 1896, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 65528, 43688, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 62136, 32760, 27448, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 10776, 65528, 37448, 16376, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 16376, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 60488, 1000, 8, 65528, 8, 65528, 8, 8, 65528, 8, 10088, 49144, 8, 65528, 8, 65528, 8, 8, 8, 65528, 34984, 8, 21848, 8, 8, 8, 15368, 8, 56968, 8, 8, 8, 32760, 8, 8, 21848, 8, 8, 8, 8, 8, 8, 1816, 8, 65528, 8, 8, 8, 8, 8, 4088, 14568, 8584, 8, 8, 8, 8, 8, 19944, 13800, 65528, 8, 8, 8, 8, 8, 8, 20696, 27304, 8, 8, 8, 8, 8, 7288, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 6552, 8, 65528, 8, 8, 8, 8, 8, 32760, 8, 8, 26216, 65528, 8, 8, 8, 8, 8, 8, 8, 32760, 65528, 8, 8, 43688, 32760, 8, 8, 8, 37448, 8, 8, 65528, 8, 8, 8, 8, 65528, 8, 65528, 8, 65528, 8, 8, 8, 8, 65528, 8, 43688, 24568, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 22520, 43688, 13528, 8, 8, 8, 8, 8, 16376, 8, 21848, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 29416, 34488, 19160, 8, 8, 8, 8, 8, 43688, 8, 8, 8, 8, 8, 8, 8, 6552, 8, 15416, 8, 8, 8, 8, 8, 8, 5960, 32760, 35736, 16376, 26216, 1976, 8, 8, 32760, 8, 8, 8, 8, 8, 8, 14568, 60488, 63352, 32760, 8, 8, 21848, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 33784, 48056, 8, 57336, 3752, 44552, 8, 8, 8, 12232, 8, 8, 8, 8, 39656, 8, 51656, 28088, 42120, 8, 21848, 65528, 8, 8, 1080, 8, 8, 8, 8, 8, 8, 8, 7288, 3448, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 10920, 3368, 8, 8, 8, 6552, 8, 9368, 8, 13112, 8, 8, 8, 8, 8, 8, 26424, 42920, 32760, 51480, 20552, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 58040, 65080, 24568, 65528, 10344, 57944, 8, 8, 8, 32760, 8, 43688, 65528, 8, 65528, 8, 22680, 16376, 8, 65528, 8, 8, 8, 13112, 21848, 8, 8, 8, 65528, 8, 65528, 8, 42296, 24568, 58040, 5464, 14376, 3128, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 32760, 1352, 11560, 42120, 49144, 26344, 9096, 8, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 21848, 39320, 65528, 65528, 19656, 8, 8, 37448, 8, 4920, 8, 8, 8, 8, 8, 8, 4376, 20840, 54600, 36408, 25000, 3192, 8, 35736, 65528, 65528, 8, 8, 8, 8, 8, 8, 35288, 43688, 8, 8, 8, 43688, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 37448, 2856, 8, 65528, 8, 16376, 8, 21848, 8, 65096, 8, 8, 8, 8, 8, 8, 43688, 10920, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 32760, 9368, 3848, 4232, 8, 8, 8, 43688, 8, 16984, 46872, 28312, 8, 8, 8, 8, 61880, 8, 46808, 16376, 60840, 8, 8, 65528, 8, 8, 52424, 8, 8, 8, 8, 8, 8, 8, 32760, 14568, 8, 65528, 8, 8, 8, 8, 8, 40456, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 43688, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 1048, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 32760, 65528, 33672, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 32760, 8, 8, 8, 8, 24136, 40952, 36408, 8, 8, 52424, 8, 8, 29128, 5960, 1768, 32760, 28088, 13352, 16376, 8, 8, 8, 22936, 8, 8, 8, 8, 8, 8, 47656, 8, 65528, 8, 35016, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 40952, 8, 8, 8, 34952, 8, 8, 26520, 58248, 65528, 8, 8, 8, 8, 65528, 8, 9368, 60120, 27304, 43688, 16376, 6136, 8, 8, 8, 65528, 8, 8, 8, 8, 65528, 8, 24568, 56376, 8, 65528, 8, 8, 8, 5960, 8, 18728, 8, 8, 8, 8, 8, 65528, 35496, 8, 65528, 65528, 6248, 4680, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 32760, 10920, 8, 65528, 8, 8, 8, 41688, 8744, 27304, 54600, 8, 8, 8, 8, 8, 65528, 56584, 8, 8, 8, 8, 8, 8, 8, 58248, 8, 8, 8, 16376, 8, 10920, 49144, 24568, 59288, 11912, 8, 8, 8, 49144, 32760, 25208, 8, 65528, 8, 62072, 8, 8, 8, 21384, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 45864, 16376, 63480, 46248, 8, 8, 8, 65528, 8, 65528, 8, 65528, 8, 8, 8, 8, 8, 21848, 3848, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 37928, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 8, 33816, 13112, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 32760, 65528, 51192, 8, 65528, 8, 8, 8, 8, 32760, 65528, 8, 8, 65528, 8, 8, 39320, 8, 16376, 32760, 8, 65528, 8, 8, 65528, 8, 8, 8, 8, 65528, 10920, 8, 8, 8, 47656, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 54600, 8, 8, 8, 8, 8, 65528, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 45864, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 50104, 8, 8, 65528, 8, 65528, 8, 65528, 8, 65528, 8, 8, 8, 8, 65528, 26216, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 2424, 1640, 38824, 50968, 32760, 65528, 32760, 4376, 30872, 43080, 47720, 8, 65528, 8, 8, 8, 16376, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 58248, 8, 8, 8, 8, 8, 61000, 43048, 16376, 14824, 65528, 65528, 8, 15416, 27800, 3128, 15464, 29848, 65528, 8, 32760, 8, 65528, 8, 52424, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 53240, 21848, 21848, 65528, 8, 8, 32760, 26216, 65528, 8, 65528, 8, 8, 8, 21848, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 3272, 2184, 9368, 65528, 8, 32760, 8, 8, 49144, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 60056, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 4328, 3128, 5704, 8, 30424, 34184, 29272, 18200, 28392, 40568, 48056, 8, 65528, 8, 8, 8, 39320, 8, 65528, 8, 65528, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 52424, 8, 65528, 65528, 65528, 8, 8, 42120, 56168, 46808, 8, 65528, 8, 50680, 8, 8, 58968, 18072, 10920, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 57960, 35736, 8184, 65528, 39320, 8, 65528, 31224, 38536, 24104, 8, 65528, 65528, 54456, 65528, 8, 65528, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 18728, 65528, 8, 48056, 8, 8, 8, 8, 8, 8, 65528, 8, 65528, 8, 8, 65528, 8, 65528, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 10920, 39576, 8, 26696, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 39320, 32760, 32760, 65528, 25896, 27704, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 10488, 43480, 2744, 23624, 8, 8, 8, 8, 8, 8, 8, 65528, 6552, 8, 62072, 43688, 61320, 8, 30488, 61544, 8, 8, 21848, 8, 8, 8, 8, 8, 8, 8, 16376, 16376, 21848, 21848, 26568, 21848, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 48056, 60488, 8, 13112, 32088, 200, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 4792, 46072, 12328, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 2728, 3848, 8, 8, 6344, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 27848, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 60840, 65528, 38568, 3512, 8, 8, 8, 8, 8, 8, 65528, 65528, 65528, 8, 65528, 65528, 52424, 32760, 8, 8184, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 65528, 8, 65528, 8, 20168, 58968, 8, 65528, 57336, 8, 8, 8, 8, 8, 8, 8, 44824, 65528, 60056, 18728, 13544, 6904, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 39320, 65528, 8, 8, 44024, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 2408, 65528, 65528, 44824, 35288, 34120, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 47048, 3448, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 32760, 65528, 8, 65528, 28568, 40952, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 5240, 32760, 8, 65528, 21032, 9832, 8, 8, 8, 8, 21848, 8, 8, 8, 65528, 8, 59560, 65528, 65528, 65528, 18168, 28488, 8, 8, 45368, 8, 8, 8, 8, 8, 8, 8, 41688, 63528, 3032, 3224, 21160, 32504, 8, 49144, 16376, 8, 40712, 41496, 55496, 8, 8, 8, 8, 8, 8, 8, 37032, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 10920, 8, 8, 10920, 32760, 3048, 8, 43688, 32760, 34680, 32760, 42712, 17208, 28472, 65528, 8, 8, 8, 8, 8, 8, 58248, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 16376, 65528, 8, 8, 8, 8, 65528, 49144, 8, 8, 8, 8, 9832, 65528, 35096, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 54600, 8, 8, 8, 65528, 8, 1016, 19416, 29128, 65016, 24568, 13112, 24568, 13112, 39992, 44712, 56168, 2728, 8, 8, 21848, 8, 8, 65528, 8, 4088, 8, 21848, 8, 65528, 8, 8, 8, 8, 8, 8, 9368, 32760, 8, 65528, 7288, 64408, 8, 8, 8, 65528, 65528, 65528, 8, 32760, 8, 8, 61368, 65528, 8, 65528, 7288, 43688, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 11560, 12600, 8, 8, 8, 21848, 8, 32760, 31496, 36856, 48424, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 32760, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 43688, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 16376, 65528, 65528, 23832, 2024, 200, 8, 8, 65528, 8, 6248, 8, 18968, 8, 18728, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 5464, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 552, 120, 8, 8, 8, 8, 8, 7704, 8, 25688, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 21848, 45864, 65528, 52424, 65528, 65528, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 16376, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 65528, 8, 8, 65528, 65528, 8, 8, 65528, 8, 8, 8, 65528, 65528, 60840, 8, 8, 8, 65528, 8, 65528, 8, 8, 8, 8, 65528, 45368, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 21848, 8, 65528, 8, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 65528, 54600, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 39320, 14248, 26088, 8, 8, 8, 8, 8, 60488, 8, 8, 8, 8, 8, 8, 8, 15960, 46248, 36696, 16376, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 8, 65528, 8, 8, 8, 39320, 8, 104, 8, 8, 504, 8, 8, 8, 65528, 8, 65528, 8, 65528, 8, 8, 65528, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 6232, 48728, 23016, 8, 32760, 8, 8, 8, 22440, 32760, 63352, 65528, 1592, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 5144, 8, 3928, 8, 8, 8, 8, 8, 4232, 19176, 40488, 8, 8, 8, 8, 8, 2728, 8, 7288, 38216, 8, 8, 8, 8, 8, 9000, 27304, 8, 8, 8, 8, 8, 8, 8, 8, 8, 88, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 65528, 8, 32760, 32760, 65528, 8, 8, 8, 21848, 65528, 8, 8, 32760, 65528, 8, 8, 8, 39320, 8, 8, 8, 65528, 65528, 65528, 8, 8, 65528, 65528, 65528, 8, 8, 65528, 8, 8, 8, 8, 65528, 65528, 16376, 8, 8, 65528, 65528, 8, 61672, 8, 8, 65528, 8, 8, 3144, 8, 65528, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 65528, 8, 65528, 10776, 65528, 17832, 8, 8, 8, 8, 8, 21848, 8, 19448, 8, 8, 8, 8, 8, 65528, 8, 16376, 8, 8, 8, 8, 8, 31208, 51480, 21192, 18728, 8, 8, 8, 47656, 43688, 8, 8, 8, 8, 8, 8, 8, 9368, 43688, 33336, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 60056, 65528, 8, 8, 8, 65528, 8, 65528, 37448, 9368, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8456, 8, 8, 8, 26216, 8, 65528, 8, 8, 8, 9368, 40856, 8, 8, 32760, 8, 65528, 8, 58968, 3128, 47768, 8, 8, 65528, 8, 8, 8, 65528, 62408, 8, 8, 8, 8, 8, 35288, 8, 32760, 8, 8, 8, 8, 8, 8, 5464, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 21848, 8, 8, 8, 8, 32760, 8, 8, 60280, 8, 54600, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 3448, 8, 8, 8, 8, 8, 8, 65528, 30136, 8, 8, 8, 65528, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 32760, 8, 8, 8, 8, 8, 8, 15416, 8, 8, 65528, 8, 8, 8, 65528, 57256, 65528, 65528, 8, 8, 8, 32760, 10344, 65528, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 10920, 8, 65528, 8, 8, 8, 8, 8, 24568, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 59480, 52424, 26216, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 23912, 65528, 65528, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 4680, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 8, 11560, 32760, 19224, 8, 8, 8, 8, 8, 8, 8, 39320, 13112, 65528, 8, 8, 8, 8, 8, 53576, 8, 8, 65528, 8, 8, 20792, 4616, 34152, 8184, 43688, 8, 8, 8, 1400, 8, 248, 8, 8, 8, 8, 65528, 19816, 54600, 16488, 65528, 8, 8, 8, 8, 8, 8, 3544, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 16376, 8, 1704, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 13208, 13112, 14952, 4088, 8, 8, 8, 7704, 9192, 26808, 8984, 18584, 36568, 24968, 8, 8, 21848, 26216, 42344, 8, 8, 8, 8, 8, 8, 8, 9240, 8, 8, 8, 8, 8, 24568, 65528, 22968, 8, 21848, 8, 65528, 8, 28088, 8, 63960, 32760, 8, 8, 8, 8, 14648, 12312, 44152, 28088, 65528, 8, 8, 8, 25016, 65528, 49272, 8, 8, 65528, 8, 8, 12328, 29080, 59448, 43688, 41576, 8, 46104, 8, 8, 8, 10792, 8, 8, 65528, 65528, 8, 26984, 46408, 184, 57704, 8, 8, 65528, 8, 1080, 24568, 11912, 8, 8, 8, 8, 8, 28568, 1192, 53816, 8, 8, 8, 8, 8, 22936, 8, 29480, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 35496, 8, 8, 8, 8, 8, 21848, 65528, 63096, 8, 8, 8, 65528, 8, 6824, 65528, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 28088, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8744, 29416, 65528, 57336, 6136, 8, 8, 8184, 8, 59432, 48056, 8, 8, 8, 11912, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 32760, 8, 8, 8, 8, 8, 5464, 10920, 8, 18728, 8, 10920, 8, 28488, 36408, 46568, 41192, 10088, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 696, 888, 8, 2600, 8, 8, 8, 8, 35800, 3624, 8824, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 1560, 21848, 8, 50968, 65528, 65528, 8, 54600, 65528, 38408, 65528, 15672, 8, 8, 8, 8, 14248, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 65528, 8, 8, 65528, 29240, 43688, 65528, 8, 8, 8, 8, 58248, 65528, 42392, 65528, 8, 8, 65528, 8, 8, 8, 8, 65528, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 392, 65528, 65528, 8, 65528, 8, 43688, 8, 43176, 64600, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 15128, 8, 49144, 8, 65528, 65528, 8, 49656, 8520, 39320, 65528, 8, 8, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 49144, 8, 65528, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 10920, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 32760, 32760, 8, 65528, 8, 8, 8, 8, 58824, 18600, 37448, 32760, 8, 8, 21848, 8, 18728, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 10920, 43688, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 26216, 8, 8, 50968, 8, 8, 38216, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 6248, 25320, 8, 24856, 53240, 29784, 18344, 8, 65304, 52968, 58440, 35736, 8, 8, 8, 8, 52424, 61000, 8, 8, 25688, 24264, 16376, 8, 8, 8, 8, 21848, 65528, 65528, 65528, 8, 8, 26216, 8, 32760, 8, 65528, 8, 8, 56952, 54952, 41512, 3128, 65528, 45144, 44984, 11400, 62536, 8, 21848, 34808, 6552, 27800, 3192, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 2344, 26392, 8, 43688, 22792, 65528, 65528, 39320, 62248, 18904, 38264, 32760, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 28088, 16376, 8, 43688, 8, 8, 65528, 8, 65528, 65528, 56584, 65528, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 10920, 8, 52424, 8, 21848, 8, 8, 64872, 48280, 16968, 13112, 8, 8, 8, 65528, 21848, 8, 8, 19656, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 35736, 8, 8, 8, 56168, 13304, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 31032, 47448, 65528, 8, 65528, 65528, 8, 8, 8, 8, 8, 184, 18072, 8, 21848, 8, 5048, 26216, 8, 63416, 11336, 21256, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 856, 48120, 8, 7176, 8376, 8488, 1656, 6984, 15528, 1208, 22824, 8328, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 30248, 23560, 8, 46104, 48056, 56168, 21848, 65528, 37848, 1528, 62328, 12744, 49144, 8, 8, 2264, 57336, 38536, 568, 6632, 8, 8, 8, 8, 8, 50232, 65528, 65528, 8, 8, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 65528, 61160, 40792, 65528, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 16136, 8, 8, 8, 8, 8, 8, 65528, 8, 65528, 8, 8, 8, 65528, 54008, 32760, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 61160, 8, 8, 8, 8, 8, 8, 65528, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 2728, 8, 35736, 39320, 65528, 23944, 8, 65528, 8, 8, 65528, 8, 6552, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 11560, 29624, 8, 37928, 8, 8, 8, 65528, 8, 32760, 8, 11560, 8, 8, 8, 8, 8, 8, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 63880, 12280, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 7288, 9368, 8, 32760, 14040, 9368, 8, 45480, 15384, 36264, 59384, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 11912, 8, 8, 8, 8, 8, 65528, 26216, 8, 8, 65528, 8, 8, 8, 8, 54600, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 65528, 8, 8, 8, 8, 41448, 8, 8, 8, 49144, 8, 59560, 49928, 30248, 24920, 65528, 65528, 38456, 23976, 21848, 56968, 32760, 4376, 57336, 8184, 47416, 18200, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 440, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 14328, 5464, 8, 8, 55336, 65528, 3576, 296, 56168, 8, 8, 8, 65528, 34488, 64792, 61432, 49144, 65528, 10920, 8, 65528, 65528, 65528, 32760, 8, 65528, 8, 8, 32760, 65528, 65528, 8, 65528, 48424, 2648, 61464, 65528, 8, 23736, 8, 8, 13512, 13624, 8, 39768, 8, 44552, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 65528, 60056, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 35736, 18504, 8, 8, 8, 8, 8, 32760, 29784, 43176, 8, 8, 8, 8, 40952, 26216, 8, 23256, 58904, 65528, 504, 2728, 8, 65528, 8, 8, 8, 52424, 65528, 54600, 8, 7288, 8, 8, 8, 21848, 8, 8, 8, 8, 8, 8, 8, 57336, 2856, 8, 42120, 4168, 27224, 25912, 56168, 8, 8, 59736, 8, 8, 39464, 8, 43688, 8, 45576, 8, 8, 5880, 27880, 18440, 8, 8, 8, 8, 8, 15016, 65528, 57656, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 21848, 8, 21848, 8, 8, 8, 8, 8, 8, 26216, 18520, 8, 8, 8, 8, 8, 26216, 32760, 65528, 8, 8, 8, 8, 8, 8, 65528, 23832, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 47656, 8, 8, 8, 65528, 8, 8, 8, 60056, 65528, 8, 8, 8, 8, 8, 5464, 21848, 8, 8, 51896, 65528, 5320, 824, 8, 43688, 8, 8, 8, 45368, 65528, 50968, 8, 65528, 65528, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 65528, 65528, 8, 65528, 5960, 65528, 8, 8, 8, 8, 65528, 65528, 33240, 792, 8, 8, 65528, 53608, 8, 8, 13112, 8, 8, 8, 8, 8, 8, 8, 28088, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 26216, 8, 65528, 8, 8, 8, 8, 8, 8184, 8, 8, 8, 8, 8, 8, 8, 26216, 8, 8, 8, 8, 8, 21848, 16376, 24024, 8, 8, 8, 8, 8, 65528, 8, 8, 65528, 8, 8, 8, 8, 65528, 8, 26216, 8, 8, 8, 8, 8, 8, 65528, 65528, 13112, 8, 41688, 16376, 8, 8, 8, 65528, 8, 8, 8, 8, 12680, 8, 8, 31032, 20216, 54120, 5112, 8, 8, 8, 8, 21848, 8, 19784, 65528, 26216, 8, 55624, 62520, 53816, 65528, 65528, 21848, 29128, 8, 15128, 5464, 8, 8744, 62664, 10920, 8, 41192, 8, 64776, 8, 61192, 8, 8, 65016, 8, 43144, 40952, 8, 8, 8, 40952, 8, 8, 43688, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 21848, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 37128, 8, 50968, 40952, 7224, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 5624, 8, 58392, 21720, 40520, 63704, 1416, 12424, 8, 32760, 8, 8, 8, 15064, 63608, 49672, 65528, 56168, 55208, 17864, 28088, 26216, 15608, 8552, 8, 40328, 2552, 60056, 8, 65528, 65528, 60488, 65528, 64360, 14984, 10840, 65528, 8, 44840, 9848, 23368, 20024, 56, 25672, 8, 8, 28152, 8, 8, 8, 2520, 8, 18728, 49144, 11000, 2264, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 60488, 32760, 65528, 65528, 8, 8, 8, 38216, 65528, 34952, 8, 8, 8, 8, 65528, 8, 65528, 39784, 32760, 65528, 31288, 1880, 8, 14744, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 26216, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 4520, 46808, 34680, 8, 8, 8, 8, 10920, 5704, 65528, 8, 47656, 65528, 3128, 8, 43688, 5960, 43688, 16376, 32760, 49144, 65528, 49144, 8, 8, 52424, 8, 8, 8, 8, 8, 8, 5208, 47656, 58968, 8, 52424, 17480, 8, 58392, 21848, 54600, 54088, 62744, 8, 8, 47736, 8, 53464, 64888, 8, 8, 8, 49144, 8, 8, 10344, 65528, 21848, 8, 8, 8, 8, 8, 3848, 65528, 13928, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 6904, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 4008, 65528, 54600, 8, 8, 8, 8, 8, 18728, 65528, 45816, 8, 8, 8, 8, 8, 5960, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 5464, 1352, 65528, 1992, 18264, 65528, 8, 2856, 8, 4680, 65528, 8, 8, 19944, 65528, 65528, 65528, 22264, 6904, 17784, 8, 65528, 11400, 40152, 8, 8, 65528, 8, 8, 65528, 65528, 8, 65528, 8, 65400, 8, 65528, 8, 17480, 8, 8, 48408, 21848, 8, 8, 8, 18728, 8, 8, 3368, 8, 49144, 8, 8, 5960, 8, 8, 5048, 35736, 8, 8, 8, 8, 8, 65528, 8, 27912, 28568, 32760, 46808, 21560, 13832, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 65528, 50968, 8, 65528, 8, 8, 8, 8, 8, 32760, 8, 8, 8, 8, 8, 8, 47656, 8, 65528, 65528, 27112, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 38696, 50408, 18728, 1016, 8, 8, 8, 8, 8, 51480, 61528, 16760, 8, 65528, 8, 8, 8, 8, 37448, 65528, 43688, 8, 8, 8, 8, 65528, 51480, 8, 61960, 8, 65528, 8, 65352, 8, 63096, 62664, 8, 8, 46968, 8, 8, 8, 27720, 8, 8, 8, 8, 8, 8, 8, 25048, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 54600, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 5960, 8, 8, 8, 58296, 65528, 4680, 8, 8, 8, 8, 8, 8, 62248, 64792, 45368, 65528, 8, 8, 8, 52424, 65528, 8, 8, 8, 65528, 8, 8, 65528, 65528, 8, 8, 65528, 41672, 28280, 23048, 8, 8, 19448, 42600, 15720, 63704, 8, 8, 2984, 8, 44552, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 52424, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 62472, 65528, 65528, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 43688, 43688, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 36152, 65528, 5960, 8, 8, 65528, 8, 8, 8, 40952, 65528, 43688, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 61544, 5464, 64936, 24568, 8, 14568, 25736, 59560, 65528, 65528, 8184, 8, 8, 8, 65528, 8, 8, 16376, 8, 8, 8, 8, 49928, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 31880, 65528, 8, 9368, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 65528, 8, 60920, 8, 65528, 65528, 24264, 8, 8, 65528, 8, 8, 8, 65528, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 10920, 8, 8, 8, 8, 8, 65528, 8, 8, 65528, 8, 61528, 65528, 8, 65528, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 32760, 65528, 8, 65528, 49144, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 49144, 8, 43688, 17480, 13720, 65528, 37256, 440, 8, 8, 8, 8, 8, 28568, 65528, 65528, 8, 8, 46808, 65528, 8, 65528, 8, 43688, 8, 5960, 8, 65528, 16376, 65528, 65528, 32760, 59560, 1880, 65528, 32760, 65528, 8, 6904, 20616, 8, 8, 49144, 32760, 65528, 8, 58744, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 40040, 64024, 25208, 10344, 54216, 3848, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 62136, 65528, 18728, 8, 30616, 20168, 8, 8, 8, 8, 8, 8, 8, 8, 21848, 8, 8, 8, 22680, 65528, 27928, 27016, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 56712, 65528, 48424, 5960, 2456, 49272, 8, 65528, 40328, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 29672, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 9368, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 61384, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 34424, 8, 8, 8, 8, 8, 8, 8, 8, 8, 5400, 8, 8, 8, 52616, 65528, 6952, 1032, 8, 8, 8, 8, 8, 60840, 64776, 60488, 8, 65528, 8, 8, 8, 8, 48568, 26216, 8, 8, 8, 8, 8, 65528, 30248, 32760, 63304, 8, 58440, 65528, 52568, 8, 18024, 46632, 8, 43688, 60296, 8, 8, 65528, 49144, 8, 8, 8, 43528, 65528, 26440, 16376, 53224, 25480, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 54184, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 7704, 8, 8, 8, 55208, 65528, 13656, 8, 8, 8, 8, 8, 8, 25480, 65528, 49144, 65528, 57336, 32760, 8, 8, 8, 2424, 8, 8, 65528, 28488, 8, 8, 65528, 65528, 8, 65528, 54712, 5096, 22344, 65528, 58248, 11384, 14696, 8, 11176, 15832, 62088, 19016, 65528, 42120, 8, 8, 8, 8, 8, 8, 8, 8, 61160, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 59480, 65528, 8, 65528, 8, 45864, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 13112, 65528, 3448, 8, 8, 8, 8, 8, 8, 6552, 65528, 8, 8, 41688, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 54600, 8, 8, 64568, 8, 64824, 8, 50968, 8, 824, 65528, 8, 3592, 61608, 8, 8, 8, 46808, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 13112, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 65528, 65528, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 65528, 8, 8, 8, 8, 8, 8, 65528, 63560, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 37448, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 19272, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 21848, 19416, 65528, 16376, 47688, 65528, 552, 2392, 8, 8, 8, 8, 8, 50968, 64504, 43688, 8, 28088, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 65528, 14040, 8, 65128, 8, 65416, 8, 65528, 8, 8, 65128, 8, 20168, 59384, 32760, 65528, 5048, 38216, 8, 8, 24024, 8, 18072, 8, 8, 8, 8, 8, 42728, 8, 52424, 8, 8, 8, 8, 8, 32760, 8, 8, 8, 8, 8, 8, 8, 21848, 8, 8, 8, 8, 8, 8, 8, 8, 28088, 18424, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 20472, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 63368, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 41352, 30104, 5048, 760, 8, 8, 8, 8, 8, 11624, 65528, 61432, 8, 11560, 65528, 8, 8, 65528, 8, 8, 8, 8, 65528, 65528, 8, 65528, 46808, 65528, 65528, 65528, 65528, 8, 36664, 65528, 2088, 65528, 8, 8, 6072, 65528, 65528, 60376, 26808, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 16376, 8, 21848, 8, 65528, 8, 8, 8, 8, 8, 13112, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 17576, 49144, 13592, 8, 8, 8, 8, 8, 58968, 8, 8, 8, 8, 8, 8, 8, 8, 8, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 728, 8, 8, 40264, 55688, 5416, 2168, 8, 8, 8, 8, 8, 17784, 64280, 58248, 3448, 8552, 4872, 8, 8, 65528, 952, 13256, 8, 49928, 17480, 38376, 32760, 51576, 24568, 8, 57992, 3048, 63432, 5240, 11576, 8, 55688, 65528, 8, 40904, 14744, 65528, 65208, 8, 23624, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 44552, 65528, 8184, 8, 20168, 8, 8, 8, 8, 53608, 63048, 32760, 8, 8, 8, 43688, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 65528, 8, 8, 65528, 33304, 65528, 32760, 65528, 8, 22840, 8, 8, 8456, 1480, 8, 8, 8, 47656, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 21848, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 9368, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 21848, 8, 63304, 8, 8, 8, 8, 8, 8, 8, 8, 36856, 65528, 4088, 8, 43688, 65528, 8, 8, 8, 32760, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 12456, 61240, 54632, 8, 16376, 8, 8, 65192, 8, 64280, 8, 65528, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 14568, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 5464, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 21848, 8, 8, 8, 5960, 65528, 39320, 248, 8, 4088, 65528, 8, 8, 32760, 65528, 65528, 8, 29128, 8, 232, 8, 8, 8, 8, 8, 8, 8, 1320, 8, 8, 8, 8, 65528, 8, 65528, 8, 51416, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 52424, 8, 8, 8, 8, 8, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 35736, 39320, 25208, 5704, 49144, 8, 8, 65528, 65528, 32760, 60840, 21848, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 3640, 8, 54600, 8, 8, 8, 37448, 8, 8, 65528, 8, 8, 8, 8, 43688, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 19656, 8, 8, 8, 10440, 46808, 18728, 1528, 65528, 8, 8, 8, 8, 4680, 63992, 29784, 65528, 65528, 18728, 8, 65528, 8, 8, 41688, 65528, 65528, 8, 49144, 65528, 65528, 8, 8, 8, 8, 65528, 8, 8, 8, 7688, 65528, 8, 26216, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 21848, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 16376, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 6552, 8, 49144, 8, 8, 65528, 65528, 13112, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 39320, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 2616, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 32760, 65528, 8, 8, 65528, 53048, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 21848, 8, 65528, 43688, 34488, 36856, 18728, 32760, 49144, 48056, 31336, 43688, 13112, 34328, 8, 8, 65528, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 65528, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 42584, 600, 8, 8, 2680, 65528, 56168, 8, 20168, 65528, 32760, 8, 65528, 8, 32760, 8, 52424, 65528, 2728, 32760, 43688, 13112, 43688, 8, 32760, 21848, 8, 32760, 8, 45160, 8, 8, 27512, 13400, 47880, 18200, 31624, 32760, 14568, 14248, 32760, 30712, 3688, 61880, 15288, 36696, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 62664, 8, 456, 8, 8, 8, 8, 8, 8, 57336, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 43688, 65528, 32760, 60840, 59560, 8, 65528, 8, 8, 8, 8, 6552, 8, 54600, 8, 8, 64072, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 13112, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 13112, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 16376, 8, 8, 8, 6280, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 50968, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 4792, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 34184, 8, 41384, 8, 40952, 8, 57960, 8, 47880, 8, 41688, 8, 32760, 8, 16376, 8, 41688, 8, 45048, 8, 28088, 8, 23832, 8, 51864, 8, 24568, 8, 43688, 8, 41688, 65528, 7288, 8, 62536, 65528, 50632, 65528, 52424, 8, 32760, 8, 58616, 8, 39320, 8, 65528, 65528, 52424, 8, 49144, 8, 65528, 8, 65528, 65528, 8, 8, 8, 8, 49144, 8, 8, 8, 18104, 8, 13496, 8, 20008, 8, 25976, 8, 19272, 8, 48216, 8, 15816, 8, 23832, 8, 45976, 8, 31208, 8, 23592, 8, 34488, 8, 55096, 8, 28328, 8, 25816, 8, 50104, 8, 24568, 8, 16552, 8, 47832, 8, 31976, 8, 35096, 8, 43688, 8, 35656, 8, 27304, 8, 26216, 8, 24136, 65528, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 17864, 8, 8, 8, 8, 8, 47944, 8, 15288, 8, 8, 8, 8, 8, 10680, 30472, 22728, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 16376, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 15128, 8, 8, 8, 12600, 39784, 18168, 8, 65528, 8, 8, 8, 14840, 52424, 65272, 8, 8, 8, 65528, 8, 8, 8, 32760, 8, 8, 8, 8, 8, 19272, 8, 8, 8, 8, 8, 8, 8, 8, 8, 20280, 8, 8, 8, 8, 8, 62792, 8, 45048, 8, 8, 8, 8, 8, 8, 696, 18888, 8, 8, 8, 8, 8, 16376, 65528, 39320, 8, 8, 8, 8, 8, 2424, 8, 8, 8, 65528, 8, 8, 8, 29640, 8, 8, 8, 8, 8, 8, 8, 13112, 8, 8, 65528, 65528, 8, 8, 8, 21848, 8, 8, 8, 8, 8, 8, 8, 21848, 8, 8, 8, 65528, 8, 8, 8, 21848, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 65528, 32760, 65528, 15128, 8, 8, 8, 8, 8, 9368, 65528, 24904, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 47176, 50968, 13496, 8, 8, 8, 8, 8, 65528, 8, 32760, 8, 8, 8, 8, 8, 57544, 8, 24568, 8, 8, 8, 8, 8, 8, 35288, 584, 21848, 43688, 35368, 3640, 8, 32760, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 32760, 8, 65528, 8, 8, 8, 8, 8, 8, 51960, 64280, 8, 65528, 65528, 65528, 8, 8, 8, 50728, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 43688, 43688, 52424, 65528, 21848, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 53240, 26216, 65528, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 10632, 8, 6472, 8184, 8, 8, 8, 8, 8, 3848, 8, 8, 8, 8, 8, 8, 8, 8, 5960, 43688, 8, 8, 8, 8, 8, 8, 15656, 8, 8, 8, 8, 8, 8, 5464, 38536, 8, 39320, 14568, 17576, 10872, 8, 16376, 65528, 65528, 8, 8, 65528, 8, 8, 49144, 58616, 64744, 8, 65528, 36408, 60216, 65528, 52424, 65528, 65528, 32760, 8, 65528, 8, 8, 43688, 19016, 8, 8, 65528, 43688, 16376, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 48056, 54600, 8, 8, 26216, 32760, 8, 16376, 8, 43688, 8, 8, 8, 8, 8, 8, 4440, 8, 27304, 8, 39816, 4808, 8, 8, 17096, 8, 48280, 8, 5960, 8, 8, 4376, 43688, 8, 14568, 8, 49144, 8, 65528, 37128, 61784, 20696, 8, 8, 5960, 8, 52424, 8, 45048, 20472, 32760, 23128, 26152, 2136, 34680, 27592, 10920, 8, 32760, 8, 23832, 8, 8, 8, 51480, 65528, 65528, 8, 50104, 21848, 8, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 43688, 13112, 8, 65528, 8, 65528, 8, 4776, 65528, 27128, 8, 8, 8, 8, 8, 6584, 31032, 21848, 8, 8, 8, 65528, 8, 10200, 65528, 8744, 8, 8, 8, 8, 8, 19112, 60488, 6552, 8, 8, 8, 8, 8, 2632, 63448, 14136, 8, 8, 8, 8, 8, 20296, 59560, 64168, 8, 8, 8, 65528, 8, 18024, 8, 8, 8, 8, 8, 8, 8, 3784, 65528, 24568, 8, 8, 8, 8, 8, 25880, 65528, 57288, 8, 8, 8, 8, 8, 13112, 65528, 8, 8, 8, 8, 8, 8, 32760, 65528, 32760, 8, 8, 8, 8, 8, 8472, 65528, 8, 8, 8, 8, 8, 8, 5240, 8, 5464, 8, 8, 8, 8, 8, 19624, 43688, 32760, 8, 8, 8, 8, 8, 21336, 65528, 26984, 8, 8, 8, 8, 8, 19016, 52424, 23400, 8, 8, 8, 8, 8, 8, 8, 39320, 8, 8, 8, 8, 8, 18104, 40952, 4296, 8, 8, 8, 8, 8, 18728, 65528, 49144, 8, 8, 8, 8, 8, 14872, 24792, 5976, 49144, 49144, 14760, 17576, 8, 18488, 65528, 2312, 8, 8, 8, 8, 8, 8744, 32760, 600, 8, 8, 16808, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 29128, 8, 28088, 8, 8, 41688, 8, 8, 11560, 65528, 8, 8, 8, 8, 8, 8, 8, 24312, 36728, 29128, 25736, 12168, 10920, 8, 8, 8, 32760, 8, 8, 8, 8, 8, 8, 21848, 45864, 8, 8, 8, 8, 8, 5464, 8, 65528, 8, 8, 8, 8, 8, 8, 39320, 8, 8, 65528, 21848, 5240, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 856, 9976, 8, 65528, 18200, 40952, 23400, 8, 29784, 39560, 39384, 10920, 8, 8, 8, 8, 10920, 8184, 60488, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 6552, 65528, 8, 65528, 4152, 65528, 8, 8, 8, 8, 50968, 8, 26216, 8, 8, 8, 8, 8, 32760, 8, 64280, 8, 8, 8, 8, 8, 8, 8, 8, 8, 9672, 8, 8, 8, 8136, 22168, 20056, 28088, 21848, 52424, 32760, 62792, 16632, 33352, 19848, 29128, 24968, 8, 12264, 8, 6344, 8, 60392, 8, 42152, 8, 17864, 8, 13496, 8, 5960, 8, 17480, 8, 8184, 8, 8, 8, 22792, 8, 52424, 8, 8, 8, 32760, 65528, 8, 8, 8, 8, 8, 8, 29656, 8, 57960, 8, 40568, 8, 8, 8, 8, 8, 24968, 8, 13112, 8, 65528, 8, 49144, 65528, 15416, 65528, 62072, 8, 50408, 8, 8, 8, 65528, 8, 65528, 8, 65528, 8, 29784, 8, 65528, 8, 65528, 8, 65528, 8, 65528, 8, 65528, 8, 65528, 65528, 8, 8, 43688, 8, 65528, 8, 43688, 8, 65528, 65528, 65528, 8, 65528, 8, 26216, 32760, 65528, 8, 8, 8, 25400, 8, 63176, 65528, 4424, 8, 3848, 8, 43688, 8, 8, 8, 59816, 8, 62248, 8, 65000, 8, 65528, 8, 51864, 8, 64376, 8, 53960, 8, 65528, 8, 60488, 8, 65528, 8, 39320, 8, 59560, 8, 65528, 8, 63704, 8, 65528, 8, 64904, 8, 65528, 8, 55176, 16376, 61672, 16376, 61272, 8, 63000, 65528, 65528, 8, 65528, 65528, 6552, 8, 8, 65528, 63176, 8, 34952, 8, 36408, 8, 16984, 8, 8, 8, 8, 8, 8, 8, 8, 8, 2120, 10168, 21128, 16376, 49144, 65528, 21848, 35496, 28280, 42184, 55848, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 43304, 42216, 8, 14328, 8, 8, 51480, 30840, 12744, 16376, 5464, 29496, 8, 8, 8, 8, 8, 8, 25640, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 14792, 34232, 55448, 65528, 8, 8, 43688, 8, 8, 8, 8, 8, 8, 8, 8, 6552, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 6552, 8, 9928, 65528, 49144, 59176, 11912, 8, 13240, 19064, 38712, 32760, 8, 8, 8, 8, 8, 8, 8600, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 1016, 16376, 18728, 21848, 32760, 26216, 47656, 26216, 23320, 21592, 51976, 8, 8, 8, 65528, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 5464, 49144, 16376, 16376, 8, 8, 8, 65528, 9368, 8, 65528, 8, 8, 8, 10920, 8, 8, 8, 19912, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 7016, 43688, 32760, 8, 8, 13112, 8, 52424, 33576, 33384, 10024, 8, 65528, 8, 60232, 65528, 8, 65528, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 7288, 8, 8, 8, 61288, 8, 65528, 8, 8, 8, 65528, 65528, 8, 32760, 65528, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 10920, 49144, 8936, 17864, 8, 8, 8, 65528, 8, 8, 8, 56168, 65528, 8, 49144, 65528, 45368, 23592, 21928, 824, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 21848, 49144, 28664, 43688, 8, 8, 8, 8, 65528, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 47320, 65528, 7064, 16376, 18280, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 49144, 8, 41384, 64712, 25864, 1672, 37800, 22504, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 65528, 23832, 42584, 8, 65528, 8, 8, 8, 8, 8, 8, 1992, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 47624, 65528, 40040, 65528, 63800, 11448, 8, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 63256, 1096, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 984, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 58248, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 22680, 65528, 51240, 21368, 17752, 104, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 24568, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 54600, 65528, 50408, 65528, 53048, 28296, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 54728, 65528, 8, 50840, 32760, 46808, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 1160, 8, 56808, 8, 32760, 8, 49144, 16376, 50456, 37032, 52840, 8, 8, 8, 8, 8, 8, 8, 55448, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 21848, 65528, 65528, 43000, 18424, 49144, 8, 8, 8, 8, 8, 8, 8, 24264, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 16376, 65528, 32760, 8, 8, 8, 8, 65528, 24568, 16376, 45864, 8, 8, 8, 53384, 65528, 34952, 6904, 65528, 104, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 5832, 49144, 8, 65528, 40952, 39320, 16376, 6904, 39704, 42728, 48120, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 21848, 65528, 10920, 65528, 39320, 60728, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 11560, 59560, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 6248, 8, 8, 8, 65528, 8, 32760, 31032, 16376, 50408, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 55688, 65528, 26216, 19656, 18728, 32760, 8, 65528, 49144, 37448, 43688, 8, 21848, 8, 65528, 8, 28392, 36408, 3496, 21848, 55960, 19816, 32760, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 21848, 8, 8, 8, 21848, 62072, 35736, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 24568, 8, 8, 14040, 8, 8, 65528, 8, 65528, 8, 616, 50968, 32760, 10920, 8, 8, 8, 8, 8, 16376, 20472, 13112, 65528, 65528, 7288, 25368, 8, 8, 8, 5960, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 61288, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 43688, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 32760, 8, 8, 42840, 65528, 17080, 3416, 8744, 59384, 63480, 872, 8, 9368, 43688, 8, 8, 8, 46808, 16376, 45192, 54600, 4680, 53384, 44328, 5240, 32760, 8, 8, 39320, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 19944, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 29784, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 45864, 39320, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 32760, 21848, 8, 39320, 8, 8, 8, 8, 65528, 8, 8, 8, 37448, 8, 12280, 8, 8, 8, 8, 65528, 62408, 57336, 65528, 16376, 65528, 8, 8, 8, 5464, 65528, 32760, 65528, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 9368, 8, 8, 9368, 36408, 8, 8, 28088, 65528, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 32760, 8, 8, 8, 8, 8, 34072, 52424, 11816, 8, 13112, 8, 8, 65528, 17320, 46248, 58792, 8, 8, 8, 8, 8, 8184, 8, 30248, 8, 8, 8, 8, 8, 6488, 32760, 28088, 8, 8, 8, 8, 8, 10920, 37528, 26376, 8, 8, 8, 8, 8, 16376, 21848, 32760, 65528, 8, 8, 8, 8, 8, 8, 26824, 8, 8, 8, 8, 8, 17480, 8, 5960, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 21848, 8, 65528, 8, 8, 49144, 55688, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 43688, 8, 8, 8, 8, 8, 8, 8, 49144, 21848, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 57336, 8, 8, 8, 50408, 65528, 65528, 43688, 5288, 50968, 27784, 8, 65528, 8, 8, 8, 4856, 51864, 32632, 8, 8, 8, 8, 8, 65528, 8, 28088, 8, 8, 8, 65528, 8, 45688, 29480, 28408, 8, 65528, 8, 8, 8, 12600, 21848, 21848, 8, 8, 8, 8, 8, 8616, 51480, 28712, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 57512, 32760, 264, 49144, 8, 55176, 13112, 65528, 54600, 8, 43688, 16376, 13112, 16376, 49928, 8, 30648, 16872, 12904, 53656, 50056, 4952, 29784, 8, 8, 40952, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 46808, 8, 8, 11336, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 23400, 61672, 9064, 13864, 54600, 8, 65528, 48728, 8, 8, 8, 2376, 8, 8, 65528, 5960, 42120, 40952, 1400, 65528, 64856, 17864, 65176, 8, 8, 8, 21848, 8, 8, 39320, 8, 32760, 8, 63800, 32760, 8, 65528, 8, 43688, 32760, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 13112, 8, 8, 65528, 8, 8, 65528, 43688, 15128, 8, 52424, 65528, 65528, 8, 8, 8, 8, 8, 8, 21848, 8, 8, 26216, 8, 8, 8, 8, 8, 42120, 8, 8, 8, 32760, 8, 8, 65528, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 65528, 8, 8, 65528, 46808, 44040, 65528, 8, 65528, 8, 12600, 8, 8, 8, 8, 8, 8, 32760, 8, 28088, 43240, 43688, 19448, 8, 7288, 8, 8, 8, 10920, 65528, 43688, 8, 8, 8, 8, 8, 18856, 65528, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 65528, 8, 8, 47512, 8648, 14984, 12872, 9368, 43688, 65528, 65528, 38040, 19272, 51272, 38184, 18728, 25208, 34392, 65528, 43240, 24824, 10968, 39608, 53320, 11704, 32760, 8, 8, 14712, 43688, 48024, 8, 8, 8, 8, 8, 20968, 65528, 15128, 8, 65528, 8, 8, 8, 136, 32760, 41288, 8, 8, 8, 8, 8, 18728, 56168, 1368, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 32760, 8, 8, 21848, 21848, 8408, 440, 2984, 32760, 65528, 16376, 8, 65528, 32760, 43688, 8, 8, 65528, 8, 39320, 19272, 8, 50408, 49144, 16376, 65528, 8, 8, 16376, 65528, 15560, 8, 8, 10088, 21848, 8, 39320, 8, 18520, 39880, 42392, 39320, 8, 8, 4008, 12040, 12936, 8, 8, 8, 8, 8, 16376, 65528, 376, 8, 8, 8, 8, 8, 43688, 65528, 54392, 8, 32760, 8, 8, 8, 8, 65528, 62344, 43000, 60344, 6552, 16376, 8, 18728, 26216, 8552, 65528, 8, 32760, 65528, 41960, 7432, 20504, 36088, 44088, 12216, 8, 8, 8, 15336, 8552, 8488, 25208, 37448, 8, 48280, 8, 8, 65528, 51720, 8, 8, 8, 65528, 8, 4088, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 11912, 65528, 8, 15128, 8, 8, 32760, 65528, 8, 5048, 10344, 35288, 8, 65528, 18728, 65528, 8, 8, 2696, 8, 8, 65528, 55096, 65528, 22312, 19416, 45416, 8, 8, 65528, 8, 8, 8, 65528, 65080, 8, 8, 8, 65528, 8, 5480, 60056, 42424, 25208, 8, 13112, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 1384, 1208, 29784, 65528, 65528, 28088, 8, 8, 8, 8, 8, 8, 8, 8, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 9368, 42536, 8, 40328, 8, 8, 8, 16376, 18584, 56488, 29176, 5464, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 48472, 8, 44200, 49144, 8, 8, 2984, 65528, 1816, 1992, 31432, 63224, 60552, 11560, 60472, 8, 8, 8, 8, 8, 21848, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 32760, 4200, 8, 43688, 65528, 8, 8, 8, 53512, 50040, 32760, 4376, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 26216, 36408, 65528, 49144, 21848, 8, 8, 23832, 35288, 16376, 49144, 49144, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 65528, 8, 32760, 65528, 65528, 8, 7288, 25208, 8, 47528, 58248, 8, 32760, 13112, 21992, 60536, 50920, 47656, 8, 8, 8, 8, 65528, 8, 43688, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 17336, 8, 3448, 37448, 16376, 8, 26984, 65528, 7656, 21848, 13800, 50312, 63416, 7288, 8, 8, 22680, 8, 65528, 8, 8, 8, 20472, 8, 37448, 8, 25480, 8, 26216, 8, 14040, 8, 8, 8, 8552, 18728, 8184, 65528, 35544, 39320, 21848, 8, 64360, 10568, 54888, 65528, 10920, 8, 10920, 8, 65528, 46808, 65528, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 65528, 8, 8, 10920, 8, 28392, 8, 54600, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 23832, 54600, 8, 39320, 8, 8, 8, 8, 28552, 65528, 10536, 36408, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 26216, 8, 8, 8, 52424, 8, 18728, 8, 8, 8, 43688, 46184, 8, 5464, 43688, 16376, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8184, 8, 65528, 8, 8, 8, 8, 65528, 24568, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 10920, 52024, 8, 20168, 8, 10920, 10920, 8, 60104, 49688, 65528, 65528, 8, 8, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 64328, 8, 65528, 8, 8, 8, 8, 21848, 45576, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 296, 40792, 8, 17864, 8, 65528, 56168, 12280, 45368, 65528, 65528, 22520, 65528, 65528, 8, 8, 8, 65528, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 47320, 8, 65528, 8, 8, 65528, 8, 34616, 60344, 32888, 6136, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 65528, 32760, 8, 8, 39320, 5704, 57816, 4680, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 24136, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 12600, 45368, 8, 65528, 43688, 8, 8, 8, 37592, 63256, 19656, 32760, 8, 8, 32760, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 9368, 34808, 8, 32760, 8, 8, 8, 26216, 48568, 46984, 64968, 616, 8, 8, 8, 8, 13112, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 5240, 35544, 65528, 44264, 31512, 21848, 20408, 16376, 40744, 14568, 2776, 8072, 32760, 8, 8, 8, 21848, 16376, 56168, 8, 24024, 44280, 14328, 52632, 55176, 15960, 56168, 8, 8, 8, 8, 8, 8, 54600, 8, 32760, 8, 8, 8, 8, 19656, 57608, 56504, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 49144, 8, 8, 41384, 8, 3848, 65528, 13720, 56792, 65528, 8, 43688, 49144, 65528, 43688, 8, 8, 8, 65528, 52776, 31528, 1320, 46808, 64952, 45208, 65528, 8, 8, 8, 8, 8, 8, 59816, 8, 8, 8, 8, 8, 8, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8744, 46808, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 32760, 39320, 21848, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 1928, 43688, 8, 43688, 8, 13112, 29304, 8, 8, 8, 8, 1768, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 32760, 8, 8, 47768, 52424, 6456, 52088, 4376, 3128, 1496, 408, 14568, 53608, 40568, 40328, 29128, 16376, 61240, 65528, 26152, 23064, 26296, 57048, 54296, 8568, 47048, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 25208, 58968, 17304, 57816, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 5048, 49144, 65528, 65528, 65528, 8, 8, 2984, 13112, 32760, 65528, 48648, 8, 8, 65528, 8, 8, 8, 8, 32760, 65528, 21848, 8, 65528, 65528, 8, 56168, 8, 8, 8, 8, 8, 8, 48056, 8, 8, 8, 8, 8, 65528, 49144, 8, 8184, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 57960, 21848, 8, 32760, 8, 8, 8, 8, 65528, 8, 65528, 65528, 65528, 8, 56168, 8, 21128, 15720, 7288, 52920, 57336, 28360, 21848, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 39176, 8, 51576, 8, 8, 8, 8, 8, 8, 46808, 8, 8, 18728, 8, 49144, 8, 36712, 16376, 8, 8, 26216, 8, 65528, 8, 5048, 8, 46008, 8, 48056, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 58968, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 49144, 49144, 8, 10920, 8, 9368, 8, 56792, 8, 49144, 8, 65528, 8, 16376, 8, 9368, 8, 65528, 8, 18728, 8, 8, 8, 50968, 8, 23832, 43688, 16376, 8, 43688, 8, 8, 65528, 21848, 8, 32760, 65528, 8, 8, 8, 8, 8, 8, 16376, 8, 28088, 8, 32760, 52424, 3848, 8, 8, 8, 47560, 8, 62664, 8, 8, 8, 65528, 8, 65528, 8, 8, 8, 6376, 8, 4520, 8, 5400, 8, 11768, 65528, 4280, 16376, 44936, 8, 7288, 8, 7768, 8, 9912, 8, 8552, 8, 32760, 65528, 12440, 8, 5464, 39880, 13160, 8, 8408, 8, 22312, 8, 54600, 8, 4536, 8, 7384, 8, 36168, 8, 11160, 8, 57528, 8, 8344, 8, 6552, 8, 22680, 8, 58248, 23976, 64616, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 1432, 21848, 26216, 8, 8, 8, 8, 43688, 26216, 8, 8184, 8, 8, 65528, 8, 8, 14328, 65528, 65528, 8, 8, 8, 8, 7288, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 29480, 65528, 11400, 8, 8, 8, 8, 65528, 20168, 59816, 44552, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 16376, 8, 6248, 65528, 65528, 8, 8, 8, 32760, 65528, 5464, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 17752, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 43688, 8, 8, 65528, 8, 8, 39320, 8, 8, 65528, 65528, 65528, 8, 8, 8, 8, 26984, 65528, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 51656, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 9368, 8, 8, 8, 65528, 8, 65528, 8, 65528, 52424, 8, 8, 8, 8, 8, 8, 65528, 21848, 8, 37448, 8, 8, 8, 8, 65528, 8, 8, 65528, 8, 8, 8, 32760, 52424, 12600, 8, 8, 8, 8, 8, 32760, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 45368, 3640, 36408, 26216, 37960, 5400, 8, 8, 8, 65528, 8, 8, 65528, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 58872, 63880, 52424, 60056, 45368, 56168, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 32760, 8, 10344, 8, 7992, 8, 8, 65528, 8, 10920, 8, 8, 8, 8, 65528, 8, 32760, 8, 26504, 8, 39320, 8, 10664, 8, 60088, 8, 36408, 65528, 64904, 8, 30024, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 49624, 8, 62008, 8, 7288, 65528, 1928, 8, 9704, 8, 47256, 8, 8, 8, 45768, 2424, 19656, 54600, 15992, 4056, 65528, 8, 16376, 65528, 8, 8, 43688, 8, 8, 8, 54472, 65528, 62664, 65528, 52424, 61608, 8, 17480, 4920, 65528, 8, 8, 43688, 8, 32760, 8, 8, 8, 32760, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 16072, 57336, 8, 8, 40424, 8, 37448, 8, 14568, 8, 8, 8, 8, 8, 8, 8, 8280, 8, 37128, 42120, 33672, 1048, 23832, 8, 21848, 65528, 63480, 8, 32760, 8, 49144, 8, 61960, 16376, 46808, 8, 8, 8, 13112, 16376, 32760, 8, 28664, 8, 29784, 8, 8, 8, 39320, 65528, 62280, 65528, 27752, 2808, 53608, 8, 43688, 8, 49144, 8, 34680, 8, 65528, 8, 8, 8184, 8, 8, 64168, 8, 60328, 8, 28312, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 65528, 9368, 8, 61816, 8, 8, 65528, 8, 8, 7288, 8, 8, 65528, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8744, 8, 8, 8, 8, 8, 4376, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 29128, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 43688, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 41688, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 3128, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 57336, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 23304, 8, 8, 8, 8, 8, 9368, 3800, 7864, 8, 21848, 16872, 14168, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 32760, 8, 32760, 8, 22152, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 5960, 8, 8, 32760, 8, 8, 21848, 16376, 8, 8, 8, 8, 8, 8, 8, 22712, 46376, 24568, 53384, 13288, 19464, 65528, 65528, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 23400, 8, 8, 8, 8, 8, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 25208, 8, 8, 49144, 18072, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 5464, 8, 65528, 8, 8, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 21848, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 61432, 8, 8, 8, 8, 8, 8, 8, 8, 8, 36408, 8, 8, 8, 13448, 8, 49144, 8, 8, 8, 65528, 65528, 8, 8, 8, 8, 16376, 8, 30248, 8, 4376, 32760, 65528, 2264, 8, 8, 8, 8, 65528, 8, 5464, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 13112, 8, 8, 8, 8, 8, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 8, 10920, 8, 34488, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 15416, 8, 53608, 8, 65528, 8, 49144, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 38536, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 21848, 8, 8, 8, 20472, 8, 32760, 65528, 8, 32760, 32760, 8, 49144, 8, 8, 8, 8, 65528, 65528, 8, 41688, 8, 19272, 8, 8, 65528, 43688, 8, 8, 8, 8, 8, 8, 8, 8, 8, 20280, 8, 58968, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 32760, 40040, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 7288, 8, 35736, 65528, 7288, 8, 8, 8, 8, 6552, 60488, 16376, 8, 8, 65528, 8, 65528, 8, 8, 8, 8, 65528, 65528, 65528, 8, 8, 8, 8, 8, 8, 65528, 8, 9368, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 20168, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 13112, 61736, 8, 5048, 8, 60840, 65528, 8, 8, 8, 8, 8, 8, 8, 13112, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 56168, 8, 8, 65528, 8, 8, 8, 32760, 8, 8, 8, 8, 8, 8, 65528, 65528, 65528, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 10920, 904, 8, 49144, 26088, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 65528, 8, 8, 8, 65528, 65528, 65528, 61816, 65528, 8, 65528, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 10088, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 14568, 8, 8, 65528, 8, 65528, 8, 51480, 39320, 8, 65528, 15752, 3032, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 6552, 24968, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 59400, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 15064, 65528, 24824, 15608, 53480, 40728, 9368, 65528, 8, 65528, 8, 8, 18728, 65528, 45368, 8, 44808, 65528, 37448, 8, 25864, 7704, 61240, 8, 65528, 8, 8, 8, 29128, 8, 8, 8, 26216, 45368, 8, 10920, 37560, 1752, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 32760, 65528, 7288, 8, 40568, 8, 8, 8, 37880, 8, 8, 8, 10920, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 26216, 8, 8, 8, 8, 8, 8, 8, 21848, 65528, 8, 8, 8264, 18728, 8, 8, 4520, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 32760, 8, 8, 8, 32760, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 36664, 65528, 16376, 50408, 22344, 312, 54328, 65528, 29480, 8, 14504, 17864, 37448, 8, 34952, 49144, 46808, 65528, 18200, 50408, 16216, 6168, 41880, 22936, 1880, 55688, 50408, 3784, 45048, 8, 8, 8, 44392, 51960, 8744, 28088, 1096, 296, 35736, 8, 32760, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 39320, 8, 65528, 8, 65528, 8, 8, 8, 8, 8, 31448, 65528, 21848, 43688, 35896, 8, 65528, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 65528, 65528, 8, 8, 65528, 1496, 65528, 8, 8, 8, 65528, 8, 13112, 8, 65528, 8, 48472, 65528, 13112, 15416, 57576, 9048, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 49832, 65528, 7288, 28088, 36360, 3480, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 51048, 65528, 21416, 1976, 11096, 536, 28088, 65528, 14088, 37304, 8, 8, 65528, 6120, 8, 8, 8, 8, 8, 8, 11608, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 19656, 65528, 37448, 8, 1832, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 3272, 65528, 21848, 8, 65528, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 50632, 65528, 64312, 8, 984, 216, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 35288, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 47656, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 32760, 65528, 8, 8, 39320, 61432, 8, 65528, 8, 65528, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 13112, 32760, 65528, 13112, 8, 32760, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 61288, 8, 13832, 8, 50888, 8, 8, 8, 21848, 57336, 8680, 47688, 8, 8, 52424, 36568, 58744, 8, 8, 8, 8, 8, 65528, 8, 63512, 5768, 49640, 22488, 47656, 2072, 8, 8, 6776, 8, 1560, 8, 7288, 8, 8, 8, 8, 8, 8, 8, 21848, 8, 8, 8, 8, 8, 8, 8, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 40040, 8, 13112, 8, 26216, 8, 14040, 65528, 8328, 55496, 13112, 8, 40040, 37448, 21848, 8, 6552, 65528, 21128, 26216, 45368, 63400, 45864, 8, 50968, 13416, 61160, 8, 23832, 8, 12600, 65528, 7288, 8, 32760, 65528, 50408, 8, 11704, 8, 19656, 8, 11912, 8, 16376, 8, 9368, 65528, 16376, 8, 8, 8, 61976, 8, 65528, 32760, 8, 8, 8, 8, 50408, 8, 8, 8, 20296, 8, 8952, 8, 15896, 8, 19800, 65528, 16104, 60200, 39320, 8, 23768, 35736, 16200, 8, 13144, 8, 11912, 8, 22280, 8, 19400, 8, 28360, 54056, 13304, 8, 16136, 8, 41032, 8, 16376, 8, 11400, 8, 23048, 8, 34872, 8, 8936, 8, 34328, 8, 8344, 8, 17480, 8, 5240, 8, 26216, 65528, 63928, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 28296, 65528, 10008, 43032, 8, 8, 65528, 11448, 65528, 11112, 49144, 61000, 65528, 8, 65528, 8, 65528, 280, 8, 65528, 65528, 1304, 8, 1640, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 10920, 65528, 16696, 8, 8, 8, 8, 41544, 37240, 3608, 47064, 65528, 32760, 65528, 17096, 65528, 8, 8, 60840, 65528, 8, 65528, 32760, 5048, 2920, 65528, 54424, 65528, 9480, 8, 8, 8, 21848, 18200, 24344, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 65528, 8, 8, 8, 32760, 8, 21128, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 54600, 35096, 632, 35496, 8, 65528, 65528, 17864, 8, 8, 8, 8, 65528, 43688, 65528, 8, 8, 19656, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 26216, 8, 5704, 25208, 8, 8, 65528, 13112, 65528, 10344, 65528, 43688, 8, 8, 65528, 8, 8, 13224, 1048, 27512, 65528, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 34584, 21848, 12424, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 21848, 8, 62904, 8, 8, 8, 32760, 8, 13112, 8, 65528, 32760, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 33896, 8, 65528, 8, 8, 8, 8, 8, 49144, 57816, 8456, 48760, 8, 8, 65528, 43688, 40952, 8, 37128, 8, 8, 8, 65528, 8, 58968, 56296, 4760, 46072, 60280, 8, 43688, 8, 8, 8, 13704, 8, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 32760, 8, 8, 8, 9368, 8, 8, 8, 49144, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 43688, 8, 18728, 65528, 8, 65528, 50968, 8, 8, 65528, 8, 8, 8, 8, 8, 3448, 8, 65528, 65528, 65528, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 65528, 8, 65528, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 18728, 8, 8, 8, 65528, 8, 8, 8, 57336, 8, 40952, 8, 65528, 8, 49144, 65528, 26984, 37448, 65528, 8, 65528, 8, 65528, 8, 21848, 8, 8, 8, 43688, 8, 65528, 15128, 65528, 21848, 32760, 8, 39320, 8, 65528, 8, 8, 65528, 43688, 8, 43688, 8, 58616, 7864, 49144, 8, 8, 8, 29128, 8, 8, 8, 8, 8, 49144, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 53608, 14168, 6552, 58248, 65528, 8, 65528, 11304, 46808, 10632, 7864, 45048, 49144, 9368, 65528, 59560, 1432, 776, 4008, 2376, 65000, 1992, 8, 8, 8, 8, 2920, 7288, 8, 8, 8, 8, 8, 9096, 32760, 51544, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 48056, 8, 8, 8, 8, 8, 6552, 65528, 32760, 8, 8, 8, 8, 28088, 8, 8, 37192, 8, 8, 65528, 8, 8, 10088, 8, 7288, 8, 8, 65528, 65528, 53768, 88, 8, 61800, 19464, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 1800, 8, 8, 8, 8, 8, 8, 8, 43688, 7288, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 14040, 65528, 1992, 58584, 32760, 8, 65528, 28296, 29128, 6552, 8, 27112, 8, 16376, 46808, 65528, 64168, 25064, 12536, 55816, 48808, 1656, 32760, 8, 8, 12600, 65528, 21848, 8, 8, 8, 8, 8, 16376, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 49144, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 52424, 65528, 4088, 53128, 8, 8, 65528, 28088, 8, 8, 8, 8, 8, 65528, 65528, 8, 65528, 46360, 8, 65528, 46808, 33944, 65528, 8, 8, 8, 65528, 49144, 8, 8, 8, 8, 8, 65528, 65528, 34952, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 45368, 65528, 5784, 39880, 8, 8, 65528, 15720, 8, 8, 8, 65528, 21848, 8, 65528, 8, 8, 8, 8, 8824, 7336, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 5960, 8, 8, 8, 38216, 8, 8, 65528, 8, 8, 65528, 65528, 13112, 8, 8, 8, 28088, 8, 6552, 8, 8, 8, 65528, 8, 2296, 8, 16376, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 3640, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 5992, 65528, 10872, 49368, 8, 8, 65528, 13592, 61384, 20056, 22680, 47320, 23592, 8184, 65528, 65528, 28568, 30136, 4856, 63464, 65128, 10728, 8, 8, 65528, 65528, 8, 8, 65528, 65528, 65528, 8, 65528, 8, 65528, 8, 65528, 8, 8, 8, 65528, 65528, 65528, 8, 65528, 8, 8, 8, 32760, 65528, 8, 8, 8, 8, 65528, 8, 8, 8, 64936, 8, 65528, 8, 64904, 8, 58616, 65528, 48872, 58152, 65528, 8, 65528, 35544, 60200, 17160, 64600, 59560, 54952, 6552, 61384, 8, 57448, 8, 32392, 63592, 54456, 536, 64136, 8, 64808, 8, 65528, 8, 65528, 8, 65192, 8, 65528, 8, 65528, 8, 60840, 8, 65528, 8, 10088, 8, 8, 8, 65528, 8, 8, 8, 38216, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 43688, 65528, 1368, 48600, 8, 8, 65528, 23688, 19448, 10232, 3192, 40472, 49416, 34984, 61880, 8, 29240, 8, 8, 60840, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 46808, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 1912, 8, 6712, 13496, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 65528, 65528, 8, 54600, 8, 8, 65528, 21848, 8, 8, 8, 65528, 26216, 56168, 65528, 65528, 8, 8, 8, 65528, 65528, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 64600, 8, 8, 65528, 65528, 65528, 8, 8, 8, 8, 43688, 8, 8, 8, 8, 8, 8, 8, 49144, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 19272, 8, 3128, 14568, 8, 8, 65528, 8, 65528, 16376, 8, 64312, 38536, 55176, 65528, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 39320, 8, 8, 8, 4680, 8, 8, 8, 41384, 65528, 8, 45272, 8, 8, 65528, 5464, 53608, 8, 8, 8, 8, 8, 65528, 8, 57816, 3128, 8, 8, 22600, 8, 32760, 8, 8, 8, 8, 8, 4376, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 56168, 8, 43688, 8, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 21848, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 21848, 65528, 8, 10088, 8, 65528, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 39320, 8, 39320, 8, 8, 8, 26744, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 65528, 8, 61000, 8, 32760, 8, 32760, 8, 24856, 8, 65528, 8, 16376, 43688, 49144, 43688, 8, 65528, 41032, 44776, 1880, 42584, 64552, 53560, 32760, 8, 65528, 8, 65528, 8, 43688, 8, 65528, 8, 65528, 8, 65528, 8, 65528, 8, 8, 8, 28088, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 49144, 8, 8, 65528, 8, 8, 8, 8, 8, 65528, 8, 65528, 26216, 54600, 32760, 32760, 65528, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 65528, 8, 8, 152, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 59560, 61784, 51512, 8, 50968, 62456, 46104, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 21848, 8, 8, 8, 4376, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 16168, 65528, 65528, 8, 8, 8, 58840, 8, 50408, 8, 8, 8, 16376, 8, 19272, 8, 8, 8, 14568, 8, 8, 8, 21848, 8, 8, 8, 13112, 8, 8, 8, 8, 8, 8, 8, 39320, 8, 62248, 8, 65528, 8, 8, 8, 43688, 8, 43688, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 65528, 52424, 8, 8, 65528, 8, 8, 8, 65528, 65528, 8712, 8, 65528, 8, 8, 8, 8, 8, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 57336, 8, 19848, 8, 8, 8, 8, 8, 8, 21848, 8, 27064, 8, 8, 8, 8, 8, 61768, 8, 22792, 8, 8, 8, 8, 8, 18456, 29480, 25448, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 19272, 8, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 1800, 8, 8, 8, 2424, 45864, 20840, 8, 28088, 8, 8, 65528, 14888, 8, 35736, 65528, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 9368, 8, 8, 8, 8, 8, 8, 8, 6904, 2600, 3320, 8, 8, 8, 8, 8, 1128, 8, 2520, 8, 8, 8, 8, 8, 8, 56, 4536, 8, 8, 8, 8, 8, 552, 8, 8, 8, 8, 8, 8, 8, 10088, 65528, 65528, 8, 8, 8, 8, 8, 19176, 8, 8, 8, 8, 8, 8, 8, 29128, 65528, 8, 65528, 8, 8, 8, 8, 24568, 8, 8, 8, 8, 8, 8, 8, 39320, 8, 8, 8, 8, 8, 8, 8, 32760, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 65528, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 65528, 5704, 43688, 18488, 8, 8, 8, 8, 8, 8, 8, 24136, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 43688, 21848, 29208, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 26216, 8, 8, 8, 8, 8, 8, 65528, 8, 52424, 10920, 14408, 4376, 8, 29784, 65528, 57336, 8, 8, 8, 8, 8, 27304, 26216, 15416, 43688, 13112, 39320, 6776, 8, 38216, 10920, 21848, 8, 8, 8, 8, 8, 43688, 32216, 29368, 43688, 8, 24904, 2856, 8, 1208, 65528, 42120, 8, 8, 8, 8, 8, 49144, 8, 9368, 8, 8, 8, 8, 8, 37448, 8, 3848, 8, 8, 8, 8, 65528, 24568, 8184, 14568, 4376, 8, 8, 8, 8, 21848, 8, 4088, 5240, 8, 21848, 8, 8, 19656, 28008, 8, 65528, 8, 65528, 8, 57336, 40952, 21848, 1128, 2984, 8, 8, 8, 13112, 2520, 44152, 12008, 23304, 5112, 24776, 6936, 8, 2120, 8, 2680, 8, 8, 43688, 8, 8, 52424, 8, 1080, 32760, 8, 63880, 8, 8, 36408, 1960, 50104, 7288, 8, 43688, 8, 8, 34328, 10680, 14328, 41256, 16376, 27016, 2728, 8, 40952, 8, 65528, 8, 8, 8, 8, 8, 43688, 57160, 47320, 8, 65528, 49144, 60840, 8, 49144, 8, 63336, 8, 8, 8, 8, 8, 59816, 32760, 6552, 65528, 8, 8, 8, 8, 56168, 8, 39320, 8, 8, 8, 8, 8, 43688, 43688, 32760, 8, 8, 32760, 8, 8, 43688, 9480, 5464, 8, 8, 8, 8, 8, 27304, 8, 8, 43688, 32760, 32760, 8, 8, 29128, 13112, 16376, 65528, 8, 8, 8, 8, 32760, 65528, 32760, 65528, 65528, 8, 8, 8, 35736, 42120, 17240, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 32760, 30840, 8, 8, 23400, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 29128, 28536, 23256, 8, 8, 8, 8, 8, 8, 45864, 34952, 8, 8, 8, 8, 8, 19624, 65528, 46968, 8, 8, 8, 8, 8, 9016, 41688, 17480, 8, 65528, 8, 8, 8, 19448, 43688, 15560, 8, 8, 8, 8, 8, 19224, 27672, 22712, 8, 8, 8, 8, 8, 9960, 36264, 12344, 8, 8, 8, 8, 8, 31432, 46808, 50792, 8, 8, 8, 8, 8, 30248, 8, 13656, 8, 8, 8, 8, 8, 14280, 65528, 10664, 8, 8, 8, 8, 8, 26744, 65528, 29400, 8, 8, 8, 8, 8, 41864, 8, 32760, 8, 8, 8, 8, 8, 18200, 65528, 1816, 8, 8, 8, 8, 8, 10008, 44808, 11608, 8, 8, 8, 8, 8, 15816, 8, 1288, 8, 8, 8, 8, 8, 11288, 2264, 22152, 8, 8, 8, 8, 8, 29976, 65528, 24344, 8, 8, 8, 8, 8, 34392, 18728, 36184, 8, 8, 8, 8, 8, 50968, 8, 21848, 8, 8, 8, 8, 8, 18968, 13112, 18344, 8, 8, 8, 8, 8, 27256, 13112, 11048, 8, 8, 8, 8, 8, 7144, 38616, 5480, 8, 8, 32760, 21848, 8, 30344, 8, 10600, 8, 8, 8, 8, 8, 30584, 8, 8, 8, 8, 8, 8, 8, 2872, 8, 12680, 8, 8, 8, 8, 8, 41688, 65528, 32760, 8, 8, 8, 8, 8, 16936, 8, 54600, 8, 8, 8, 8, 8, 43688, 18728, 18200, 32760, 52424, 23128, 9928, 8, 8, 8, 39320, 8, 8, 8, 8, 8, 8, 16376, 50408, 8, 8, 65528, 8, 8, 5704, 65528, 52424, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 55448, 8, 65528, 32760, 65528, 8, 65528, 31032, 15288, 32760, 65528, 8, 8, 16376, 8, 16376, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 424, 8, 8, 8, 8, 49144, 8, 8, 8, 8, 4872, 4376, 424, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 49144, 8, 8184, 8, 4168, 18584, 8, 20696, 21848, 5048, 65528, 47320, 27304, 40152, 15672, 23128, 8, 8, 39320, 8, 8, 8, 65528, 8, 40328, 8, 65528, 8, 2856, 8, 8, 8, 6344, 8, 8, 8, 8, 264, 13112, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 1256, 8, 32760, 8, 8, 8, 16376, 8, 3192, 8, 8, 8, 8, 8, 65528, 65528, 8, 57336, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 65528, 65528, 65528, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 8, 56168, 8, 8, 8, 8, 8, 8, 8, 65528, 12072, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 65528, 8, 8, 8, 32760, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 65528, 65528, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 65528, 8, 1432, 3272, 8, 65528, 65528, 49144, 8, 5960, 47144, 53816, 41688, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 40952, 41960, 8, 9224, 152, 88, 8, 7496, 1720, 19848, 808, 28632, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 616, 8, 8, 8, 8, 8, 8, 2616, 632, 8, 43688, 8, 8, 8, 54600, 7288, 8, 8, 8, 8, 8, 10920, 8, 8, 8, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 472, 13688, 8, 3592, 8, 8, 8, 63000, 1608, 616, 120, 1032, 8, 8, 8, 8, 40, 8, 2056, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 2424, 65528, 8, 8, 38216, 32760, 65528, 32760, 45096, 38488, 49320, 8, 8, 8, 65528, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 65528, 8, 32760, 65528, 65528, 43688, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 16376, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 5464, 19272, 32760, 65528, 8, 65272, 29592, 40136, 24872, 8, 65528, 8, 55288, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 30584, 21848, 43688, 8, 8, 8, 8, 65528, 43688, 8, 8, 8, 8, 8, 8, 8, 65528, 39320, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 52424, 39320, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 65528, 8, 63176, 65528, 8, 54600, 60056, 168, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 33976, 65528, 8, 26984, 8, 32760, 8, 8, 8, 52568, 1208, 8, 8, 8, 8, 8, 58968, 8, 8, 32760, 43688, 8, 8, 8, 8, 8, 8, 8, 8, 8, 13112, 8, 20168, 8, 8, 56168, 4680, 65528, 8, 8, 8, 65528, 18728, 8, 8, 8, 8, 8, 50648, 65528, 8968, 36856, 64360, 1688, 60488, 8, 65528, 8, 2520, 8, 8, 8, 8, 8, 60840, 46808, 8, 17992, 424, 8, 8, 8, 8, 65528, 1992, 8, 8, 8, 8, 8, 24568, 8, 472, 8, 16376, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 65528, 8, 37448, 65528, 65528, 8, 8, 8, 65528, 65528, 8, 8, 65528, 8, 8, 57336, 65528, 8, 65528, 53624, 13272, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 32760, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 24024, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 52424, 54296, 49144, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 43688, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 64088, 65528, 8, 65528, 8, 13112, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 52424, 65528, 8, 65528, 47528, 504, 8, 8, 32760, 8, 8, 8, 8, 8, 8, 8, 52424, 65528, 8, 65528, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8024, 65528, 8, 65528, 25048, 65528, 8, 8, 8, 13112, 8, 8, 8, 8, 8, 8, 60488, 65528, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 59512, 59336, 10088, 10632, 43688, 43688, 65528, 8, 8, 8, 51864, 35736, 19016, 8, 8, 8, 32760, 8, 8, 8, 65432, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 264, 42392, 8, 8, 8, 8, 65528, 15192, 2424, 15976, 8, 8, 8, 27592, 8, 8, 8, 43688, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 42504, 65528, 8, 8, 8, 16376, 8, 8, 8, 8, 52424, 32760, 65528, 8, 8, 8, 57336, 65528, 8, 10920, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 33816, 8, 65528, 29784, 29784, 7288, 3128, 33016, 39688, 51944, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 16376, 32760, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 46808, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 10920, 8, 8, 8, 8, 43688, 8, 21848, 18200, 50408, 54600, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 65528, 8, 8, 16376, 4376, 8, 8744, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 10920, 8, 65528, 8, 8, 8, 8, 13112, 37448, 65528, 8, 8, 8, 28088, 8184, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 13112, 8, 8, 8, 8, 8, 32760, 8, 10920, 8, 9368, 8, 8, 53960, 65528, 8, 8, 8, 8, 8, 536, 8, 65528, 8, 8, 8, 9368, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 32760, 65528, 8, 8, 19944, 55448, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 65528, 65528, 8, 8, 8, 8, 39320, 8, 65528, 65528, 16376, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 65528, 65528, 37448, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 16376, 8, 8, 8, 65528, 26216, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 16376, 4088, 8, 8, 8, 8, 8, 28088, 65528, 65528, 65528, 65528, 8, 8, 8, 13800, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 11912, 65528, 8, 8, 8, 8, 1640, 488, 8, 8, 8, 39320, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 6776, 65528, 18200, 8, 65528, 8, 8, 8, 16376, 32760, 38904, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 1000, 8, 8, 8, 8, 8, 1304, 4040, 3448, 8, 4328, 8, 8, 8, 2088, 8, 31336, 1192, 8, 8, 8, 8, 6552, 8, 408, 376, 8, 8, 8, 8, 8, 8, 16376, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 65528, 8, 22600, 65528, 65528, 8, 1880, 8, 8, 8, 8, 65528, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 4520, 8, 8, 8, 8, 8, 8, 8, 37448, 8, 8, 8, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 65528, 65528, 8, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 8, 21848, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 53160, 32760, 29128, 8, 65528, 63480, 8, 8, 52424, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 32760, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 10920, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 32760, 32760, 8, 8, 8, 8, 8, 65528, 8, 8, 65528, 8, 65528, 8, 65528, 8, 8, 6552, 8184, 8, 65528, 8, 8, 8, 65528, 8, 65528, 8, 8, 8, 8184, 8, 8, 14984, 8, 18728, 8, 488, 8, 32760, 8, 8, 9368, 8, 46248, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 49144, 8, 65528, 8, 8, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 43688, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 26216, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 32760, 8, 65528, 8, 23128, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 35288, 8, 55144, 8, 8, 8, 8, 8, 14888, 61432, 5560, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 35736, 8, 8, 65528, 8, 8, 8, 8, 14152, 53960, 11016, 8, 8, 8, 16376, 8, 8, 32760, 16376, 8, 8, 8, 8, 8, 8, 8, 2344, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 25896, 65528, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 25640, 23832, 8, 8, 1208, 8, 8, 8, 8, 8, 24136, 34024, 42264, 45624, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 32760, 8, 52984, 8, 8, 8, 8, 8, 65528, 8, 30984, 8, 65528, 8, 8, 8, 8, 8, 65528, 8, 65528, 45864, 21848, 8, 65528, 8, 32760, 8, 8, 8, 8, 8, 21256, 32760, 27304, 8, 8, 8, 8, 8, 4680, 8, 7704, 21848, 36776, 8, 28600, 8, 8, 8, 19848, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 49144, 8, 8, 8, 8, 8, 8, 8, 8, 16376, 32760, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 65528, 8, 8, 8, 58248, 32760, 32760, 46808, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 56168, 42808, 8, 58504, 8, 8, 8, 57080, 7512, 63864, 17688, 43688, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 32760, 8, 8, 8, 10232, 26616, 8, 65528, 12488, 8, 8, 54600, 5960, 49144, 3976, 8, 8, 8, 6552, 8, 2680, 8, 8, 8, 43688, 8, 8, 8, 8, 8, 8, 8, 4680, 8, 8, 8, 8, 1768, 8, 54600, 8, 8, 8, 58872, 2424, 62792, 568, 968, 8, 8, 8, 8, 8, 8, 2728, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 27304, 8, 65528, 65528, 49704, 8, 45672, 63000, 47176, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 13112, 8, 8, 3432, 15352, 8, 41384, 45864, 10088, 46248, 54216, 61496, 64760, 49752, 4712, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 32760, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 6280, 8, 65528, 65528, 8, 8, 65528, 38216, 54824, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 6552, 8, 65528, 65528, 8, 8, 65528, 42392, 65528, 5464, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 30840, 7800, 8, 34952, 65528, 65528, 8, 25208, 33544, 13816, 16376, 65528, 8, 65528, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 39320, 17864, 8, 65528, 2728, 8, 8, 59096, 54344, 60664, 50792, 1640, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 32760, 8, 8, 32760, 8, 8, 8, 65528, 8, 65528, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 2424, 984, 8, 28088, 8, 1496, 65528, 8, 39640, 8, 20472, 248, 872, 40664, 8, 8, 62184, 17640, 8, 8, 65528, 3640, 8, 8, 8, 19656, 8, 8, 8, 8, 8, 8, 61432, 5960, 8, 65528, 65528, 8, 8, 60840, 12632, 11016, 8, 8, 65528, 8, 8, 8, 65528, 920, 8, 8, 65528, 5784, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 60488, 3384, 8, 65528, 8, 8, 8, 65528, 5464, 49144, 8, 8, 65528, 8, 8, 8, 8, 10920, 8, 8, 65528, 5576, 8, 8, 65528, 5960, 8, 8, 65528, 8, 8, 8, 65528, 32760, 8, 65528, 65528, 1080, 8, 58696, 28088, 14984, 65528, 65528, 65528, 15544, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 43688, 12488, 8, 65528, 8, 8, 8, 61944, 57656, 65528, 30520, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 45048, 8, 65528, 8, 8, 8, 65528, 14920, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 504, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 21848, 8, 8, 8, 8, 15944, 8, 65528, 8, 8, 8, 57336, 62248, 51832, 41688, 8, 8, 8, 65528, 8, 6552, 8, 8, 8, 36408, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 88, 1784, 8, 2168, 37448, 19144, 45864, 30584, 28664, 7288, 7576, 296, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 1944, 27688, 8, 40600, 17336, 22792, 65528, 57656, 29768, 6424, 248, 5704, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 21848, 8, 54600, 8, 8, 8, 47656, 8, 65528, 3928, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 13112, 8, 8, 65528, 8, 8, 8, 8, 232, 32760, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 58968, 8, 8, 8, 8, 8, 32760, 8, 1384, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 16376, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 2728, 8, 50632, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 24, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 21848, 8, 8, 8, 8, 8, 43688, 32760, 65528, 32760, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 46744, 8, 8, 8, 8, 8, 32760, 49144, 8, 7704, 63336, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 49144, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 54600, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 16376, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 65528, 39320, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 55448, 65528, 8, 65528, 9368, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 40328, 25160, 22232, 8, 8, 8, 8, 8, 53896, 8, 45864, 8, 8, 8, 8, 65528, 19656, 65528, 35576, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 56168, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 936, 65528, 8536, 8, 8, 8, 8, 8, 23944, 65528, 63144, 65528, 8, 8, 8, 8, 24568, 65528, 32760, 8, 8, 8, 8, 8, 13496, 65528, 49144, 65528, 8, 8, 8, 8, 4376, 23400, 47480, 8, 8, 8, 8, 8, 38216, 65528, 39320, 65528, 26216, 8, 8, 65528, 20648, 8, 30136, 53608, 504, 8, 8, 8, 13112, 8, 32760, 8, 8, 8, 8, 8, 10920, 8, 8, 8, 8, 8, 8, 58968, 28088, 8, 8, 8, 8, 8, 8, 65528, 10920, 8, 8, 8, 8, 8, 8, 39320, 2984, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 29784, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 7704, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 3848, 8, 8, 65528, 9368, 8, 8, 65528, 12488, 65528, 14248, 65528, 45864, 8, 8, 8, 8, 8, 34680, 65528, 8, 8, 8, 65528, 46808, 8, 50408, 8, 8, 8, 8, 8, 28536, 30024, 26984, 65528, 21848, 8, 8, 8, 52424, 65528, 8, 8, 32760, 8, 8, 8, 8, 65528, 26216, 8, 8, 8, 8, 8, 65528, 8, 8, 5176, 12824, 37080, 10088, 8, 8, 8, 61160, 8, 8, 8, 8, 8, 8, 8, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 15144, 39560, 56168, 65528, 1816, 65528, 8, 8, 8, 16376, 8, 8, 8, 8, 8, 8, 8, 52424, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 49144, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 26216, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 49144, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 1000, 1208, 264, 1848, 2184, 65528, 8, 8, 8, 2984, 8, 8, 8, 8, 8, 8, 43688, 49848, 8, 8, 15016, 1720, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 57816, 62248, 8, 8, 49144, 58968, 8, 8, 65528, 29304, 8, 8, 8, 8, 8, 8, 8, 35288, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 43688, 21848, 8, 8, 7288, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 21848, 8, 8, 49144, 65528, 30104, 16376, 8, 21848, 65528, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 58248, 32760, 23128, 8, 8, 8, 8, 65528, 8, 65528, 17864, 7496, 51480, 12568, 1416, 8, 23704, 65528, 65528, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 65528, 27224, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 10920, 9368, 22552, 8, 8, 8, 8, 8, 8, 8, 17480, 8, 8, 8, 8, 8, 32760, 65528, 47976, 8, 8, 8, 8, 8, 10552, 6408, 2504, 8, 8, 8, 8, 8, 3688, 14168, 46216, 8, 8, 8, 8, 8, 8, 8, 8184, 8, 8, 8, 8, 8, 14824, 3480, 35736, 8, 8, 8, 8, 8, 5048, 8, 3832, 8, 8, 8, 8, 8, 8, 8, 34968, 8, 8, 8, 8, 8, 8, 26216, 20168, 8, 8, 8, 8, 8, 32760, 8, 328, 8, 8, 8, 8, 8, 8, 8, 600, 8, 8, 8, 8, 8, 8, 8, 1816, 8, 8, 8, 8, 8, 8, 8, 120, 8, 8, 8, 8, 8, 8, 34952, 22264, 8, 8, 8, 8, 8, 5464, 8, 44872, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 1624, 8, 8, 8, 8, 8, 15032, 65528, 26216, 8, 8, 8, 8, 8, 12680, 18296, 21192, 8, 8, 14040, 13112, 8, 8, 8, 6344, 8, 8, 8, 8, 8, 54600, 8, 8, 8, 8, 4680, 8, 8, 8, 8, 4424, 8, 8, 8, 8, 8, 13896, 8, 9368, 8, 8, 65528, 8, 8, 14744, 8, 8, 8, 8, 8, 8, 8, 8, 10920, 28088, 21848, 39320, 14408, 32760, 8, 8, 8, 47656, 8, 8, 8, 8, 8, 8, 56168, 58248, 8, 8, 8, 8, 8, 6552, 65528, 32760, 8, 8, 8, 8, 8, 8, 43688, 8, 8, 8, 16376, 10920, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 20024, 8, 1304, 8, 40728, 8, 5464, 8, 1816, 8, 8, 8, 8, 8, 760, 8, 34344, 8, 8, 8, 8, 8, 1064, 28792, 8, 8, 5464, 8, 8, 8, 18728, 8, 11560, 8, 5960, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 152, 8, 8, 8, 8, 8, 65528, 8, 65528, 8, 8, 8, 8, 8, 65528, 8, 43688, 8, 60840, 8, 65528, 8, 60840, 43688, 8, 8, 65528, 8, 65528, 8, 65528, 8, 8, 8, 32760, 8, 65528, 8, 63256, 8, 43688, 8, 8, 8, 65528, 8, 53960, 65528, 8, 8, 65192, 57336, 65528, 8, 49928, 16376, 21848, 8, 63960, 56168, 8, 8, 65528, 61064, 8, 8, 21848, 65528, 31880, 8, 56584, 62072, 8, 8, 65528, 65528, 8, 8, 8, 8, 18856, 8, 31336, 8, 44264, 8, 43000, 8, 14568, 8, 64376, 8, 29128, 8, 34680, 8, 40424, 8, 46808, 8, 37448, 8, 28088, 8, 32760, 8, 39848, 8, 25480, 8, 49144, 8, 8, 8, 29128, 8, 16376, 8, 45912, 49800, 25208, 8, 51864, 65528, 23016, 8, 8, 8, 8, 8, 64376, 60488, 57928, 8, 8, 8, 8, 8, 65528, 53608, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 1608, 1544, 8, 8, 8, 43688, 8, 8, 5112, 28088, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 52424, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 32760, 8, 8, 16376, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 53960, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 64136, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 26216, 8, 65528, 9224, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 65528, 8, 60488, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 37448, 8, 59400, 65528, 8, 41688, 47096, 488, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 43688, 8, 8, 104, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 18536, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 32760, 8, 46408, 8, 8, 8, 65528, 8, 32760, 8, 8, 8, 8, 8, 65528, 8, 32760, 8, 35736, 8, 8, 8, 65528, 8, 8, 8, 21848, 8, 8, 8, 8184, 8, 8, 8, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 12744, 8, 38616, 8, 37448, 8, 31272, 8, 38584, 8, 54952, 8, 24568, 8, 8184, 8, 58664, 8, 8, 8, 8, 8, 43688, 8, 13112, 8, 6728, 8, 7560, 8, 32760, 8, 14040, 65528, 59624, 8, 7640, 8, 39448, 8, 8, 8, 64376, 8, 49768, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 23832, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 63384, 65528, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 50968, 57336, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 61528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 13112, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 43688, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 16376, 8, 8, 2344, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 62072, 8, 7704, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 23832, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 49144, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 21848, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 32760, 65528, 8, 32760, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 15416, 8, 8, 8, 13112, 8, 16376, 8, 8, 8, 21848, 8, 8, 8, 37448, 8, 6552, 8, 32760, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 13112, 8, 8, 8, 8, 8, 8, 8, 39320, 8, 46248, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 32760, 8184, 8, 8, 8, 8, 8, 49144, 8, 8, 8, 8, 8, 8, 8, 25368, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 13112, 8, 8, 8, 8, 8, 8, 8, 2264, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 1208, 8, 8, 8, 18728, 47656, 19656, 8, 8, 8, 8, 8, 17016, 8, 55688, 8, 8, 8, 8, 8, 10920, 8, 8, 8, 8, 8, 8, 8, 9368, 65528, 6552, 8, 8, 8, 8, 8, 23400, 23832, 10584, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 1064, 27592, 8, 20056, 8, 8, 8, 8, 8, 8, 16376, 4008, 8, 8, 8, 8, 8, 49144, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 7288, 8, 9368, 8, 8, 8, 8, 8, 8, 8, 20472, 8, 8, 8, 8, 8, 32760, 8, 16376, 8, 8, 8, 8, 8, 43688, 46808, 26600, 8, 8, 8, 8, 26216, 21848, 8, 8, 8, 8, 8, 8, 8, 28088, 65528, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 65528, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 6408, 8, 45992, 8, 8, 8, 54600, 8, 8, 8, 65528, 8, 15128, 8, 63832, 8, 50408, 8, 8, 8, 42120, 8, 8, 8, 13112, 8, 8, 8, 51720, 8, 1000, 8, 8, 8, 8, 8, 8, 8, 32760, 3848, 8184, 8, 8, 8, 8, 8, 8, 16808, 9368, 65528, 8, 8, 8, 8, 8, 8, 37592, 8, 65528, 8, 8, 8, 8, 8, 44824, 8, 43688, 8, 29784, 8, 40952, 8, 16376, 8, 50408, 8, 17864, 8, 8, 8, 13112, 8, 24264, 8, 18728, 8, 32760, 8, 56584, 62408, 54600, 8, 53240, 8, 65528, 8, 8184, 40328, 8, 8, 43688, 8, 13112, 8, 8744, 65528, 32760, 8, 16376, 8, 26216, 8, 39320, 8, 8, 8, 60888, 8, 65528, 8, 65528, 8, 8, 8, 45864, 8, 32760, 8, 19880, 8, 12520, 8, 15960, 8, 28568, 8, 14904, 8, 58008, 8, 24568, 8, 15976, 8, 18232, 8, 5288, 8, 16376, 8, 28952, 23832, 43000, 34856, 34952, 8, 18968, 8, 34808, 32760, 32760, 36408, 6664, 8, 21192, 8, 44424, 25112, 47320, 65528, 54360, 8, 5912, 8, 21848, 2264, 34680, 26216, 13112, 8, 64024, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 43688, 8, 31336, 8, 8, 8, 8, 8, 8, 8, 1384, 8, 8, 8, 8, 8, 16376, 8, 45992, 8, 8, 8, 8, 8, 21192, 8, 13576, 8, 8, 8, 8, 8, 3976, 65528, 37448, 8, 8, 8, 8, 8, 728, 8, 1976, 8, 8, 8, 8, 8, 17864, 8, 10920, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 11560, 8, 8, 8, 8, 8, 8, 8, 8, 8, 29128, 8, 8, 8, 8, 8, 13112, 8, 51224, 8, 8, 8, 8, 8, 3192, 2984, 6648, 8, 8, 8, 8, 8, 712, 10088, 28824, 8, 8, 8, 8, 8, 3400, 4216, 48728, 8, 8, 8, 8, 8, 8, 8, 7896, 8, 8, 8, 8, 8, 25432, 33464, 27624, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 9656, 5048, 25848, 8, 8, 8, 8, 8, 14792, 65528, 17064, 8, 8, 8, 8, 8, 18728, 8, 29048, 8, 8, 8, 8, 8, 8, 8, 40856, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 10696, 48056, 6920, 8, 8, 8, 8, 8, 12280, 65528, 26216, 8, 8, 8, 8, 8, 16376, 8, 8, 8, 8, 8, 8, 8, 8, 26216, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 14248, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 21848, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 10920, 8, 13560, 8, 3448, 8, 8, 8, 4088, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 968, 8, 8, 8, 25640, 8, 26808, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 62664, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 8, 8, 65528, 8, 8, 8, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 52424, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 34952, 8, 8, 8, 8, 8, 8, 8, 57336, 4504, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 65528, 65528, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 65528, 64504, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 65528, 65528, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 21848, 8, 36616, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 53176, 8, 30248, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 10920, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 47848, 8, 8, 8, 8, 8, 16376, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 43688, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 13112, 8, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 55448, 8, 8, 8, 8, 8, 8, 8, 8, 8, 3448, 8, 24136, 8, 10088, 8, 34328, 8, 13112, 8, 46808, 8, 28088, 8, 9368, 8, 3128, 8, 8, 8, 8, 8, 9368, 8, 65528, 8, 15608, 8, 13112, 8, 28088, 8, 8, 8, 4376, 8, 26216, 8, 42440, 8, 8, 8, 46808, 8, 11192, 8, 8, 8, 32760, 8, 65528, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 60056, 32760, 8, 8, 8, 8, 8, 8, 65528, 7288, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 32760, 8, 8, 65528, 8, 8, 8, 41544, 8, 8, 8, 65528, 8, 8, 8, 8, 65528, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 65528, 65528, 65528, 8, 65528, 8, 65528, 8, 65528, 8, 8, 8, 65528, 8, 65528, 8, 65528, 8, 8, 8, 8, 65528, 8, 8, 65528, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 65528, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 53608, 8, 8184, 65528, 65528, 8, 8, 65528, 65528, 8, 8, 65528, 65528, 8, 8, 65528, 29672, 65528, 65528, 65528, 65528, 8, 8, 65528, 56168, 8, 8, 65528, 49144, 8, 8, 65528, 65528, 8, 8, 65528, 56168, 8, 8, 65528, 35288, 8, 8, 65528, 65528, 8, 8, 65528, 5240, 8, 8, 65528, 48280, 8, 8, 65528, 65528, 8, 8, 65528, 65528, 8, 8, 65528, 7016, 21848, 18536, 32760, 32760, 8, 8, 65528, 25592, 8, 63960, 65528, 65528, 8, 65528, 65528, 65528, 8, 8, 65528, 65528, 8, 8, 65528, 39784, 8, 8, 65528, 65528, 8, 8, 8, 37192, 35288, 20680, 65528, 65528, 8, 8, 65528, 58248, 65528, 39320, 8, 8, 8, 8, 8, 60488, 8, 26696, 65528, 8, 8, 8, 8, 28088, 8, 8, 65528, 65528, 8, 8, 8, 19112, 65528, 21848, 65528, 60696, 8, 8, 65528, 59224, 8, 8, 65528, 62952, 8, 8, 65528, 64232, 8, 8, 65528, 52424, 8, 8, 65528, 64120, 8, 8, 65528, 65528, 8, 8, 65528, 59560, 65528, 65528, 65528, 63256, 8, 8, 65528, 40952, 8, 8, 65528, 65528, 8, 8, 65528, 62072, 8, 8, 65528, 65528, 8, 8, 65528, 65528, 8, 8, 65528, 63000, 8, 8, 65528, 60664, 8, 8, 65528, 65528, 8, 8, 65528, 48616, 8, 8, 65528, 65528, 8, 8, 65528, 58248, 8, 17240, 65528, 61160, 8, 8, 65528, 53384, 65528, 26216, 65528, 65528, 8, 8, 65528, 65528, 8, 65528, 65528, 65528, 8, 8, 65528, 56376, 32760, 24856, 32760, 32760, 8, 8, 65528, 49144, 65528, 8, 8, 8, 8, 8, 8, 14040, 56168, 23400, 8, 8, 8, 8, 8, 8, 43688, 8, 65528, 8, 13112, 6552, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 7704, 8, 8, 35608, 9368, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 53352, 60168, 47480, 56920, 29960, 19992, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 16376, 8, 65528, 8, 8, 8, 65528, 8, 8, 13112, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 65528, 8, 8, 8, 43688, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 13112, 8, 43688, 8, 8, 8, 8, 8, 52424, 13112, 8, 8, 8, 8, 8, 8, 39032, 38408, 59560, 46248, 16760, 15992, 2984, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 60680, 62488, 8, 65528, 21848, 64792, 43688, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 65528, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 65528, 37448, 8, 8, 10920, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 37448, 8, 33624, 11768, 8, 8, 8, 8, 65528, 8, 65528, 8, 8, 8, 65528, 7864, 8, 26216, 32760, 8, 65528, 65528, 8, 8, 65528, 8, 8, 8, 8, 8, 65528, 65528, 65528, 8, 26216, 3048, 59048, 20024, 65528, 59560, 65528, 8, 65528, 8, 8, 8, 46808, 16376, 8, 65528, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 60664, 49144, 8, 8, 8, 8, 8, 21848, 8, 34072, 8, 8, 8, 8, 8, 32760, 59816, 44824, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 20040, 42840, 24424, 8, 8, 8, 8, 8, 8, 43688, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 49144, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 14968, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 48696, 8, 8, 8, 8, 8, 8, 8, 3720, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 5960, 21848, 152, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 8184, 27592, 18728, 8, 8, 4376, 7288, 8, 65528, 8, 65528, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 49144, 26216, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 6552, 65528, 26216, 8, 32760, 21848, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 40328, 25640, 21848, 28088, 16600, 6904, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 20840, 8, 8, 32760, 8, 8, 12040, 8, 28824, 8, 8, 8, 8, 8, 8, 36408, 65528, 8, 8, 26216, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 14568, 8, 65528, 17864, 65528, 8, 8, 33752, 32328, 36504, 21848, 8, 8, 65528, 21848, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 65528, 65528, 65528, 8, 8, 52424, 30248, 43688, 26216, 8, 8, 65528, 65528, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 11096, 31480, 8, 39496, 50632, 37448, 32760, 53960, 35016, 35288, 27400, 47096, 65528, 8, 49144, 8, 8, 8, 65528, 8, 28088, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 65528, 8, 65528, 8, 8, 8, 59560, 8, 8, 8, 8, 8, 8, 63096, 65528, 65528, 65528, 43688, 8, 56168, 65528, 65528, 65528, 8, 65528, 8, 65528, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 58680, 65528, 65528, 65528, 64296, 8, 8, 8, 8, 65528, 8, 65528, 32760, 8, 8, 61432, 63032, 8, 8, 65528, 65528, 8, 8, 8, 61912, 65528, 8, 65528, 8, 8, 8, 65528, 63992, 65528, 8, 65128, 65528, 57336, 8, 8, 8, 49144, 8, 8, 8, 32760, 8, 8, 8, 65528, 65528, 65528, 8, 11912, 8, 65528, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 56792, 8, 8, 65528, 21848, 65528, 65528, 65528, 8, 65528, 8, 8, 65528, 65528, 65528, 8, 65528, 59336, 7496, 8, 65528, 65528, 8, 8, 65528, 65528, 8, 8, 8, 65528, 65528, 65528, 1128, 3144, 6552, 28088, 32760, 39320, 29784, 40328, 39480, 41528, 55688, 8, 18344, 8, 65528, 65528, 8, 21848, 8, 54600, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 32760, 65528, 36408, 45304, 8, 14792, 49144, 8, 8, 52424, 58968, 29128, 19112, 19064, 8, 21848, 65528, 39320, 8, 65528, 24136, 8, 65528, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 43688, 65528, 65528, 5464, 8, 8, 43688, 8, 8, 65528, 65528, 21848, 65528, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 65528, 8, 11912, 8, 8, 54600, 8, 8, 8, 8, 62072, 64632, 65528, 65528, 8, 8, 65528, 65528, 65528, 32760, 49144, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 65528, 8, 11080, 32760, 8, 8, 32760, 61304, 32760, 8, 40808, 60808, 42824, 8, 65528, 64680, 65528, 8, 65528, 43688, 8, 8, 65528, 65528, 8, 8, 65528, 55176, 8, 8, 65528, 8, 65528, 65528, 58968, 64056, 4088, 65528, 65528, 63928, 57336, 65528, 58744, 58744, 57816, 8, 65528, 51784, 20168, 7704, 56168, 65528, 8744, 8, 65528, 63656, 8, 8, 65528, 65528, 8, 8, 64072, 62328, 8, 8, 8, 20168, 5048, 13112, 65432, 61016, 43688, 57336, 30504, 53288, 15768, 28824, 65528, 65240, 65528, 65528, 65528, 64856, 8, 65528, 65528, 51864, 8, 8, 65528, 65528, 8, 8, 65528, 26040, 8, 8, 64904, 49928, 8, 47656, 8, 65528, 8, 65528, 35736, 9368, 48056, 8, 8, 65528, 8, 8, 65528, 63096, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 29784, 30712, 16376, 50408, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 64200, 64024, 8, 65528, 64488, 1464, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65128, 65528, 13112, 21848, 3848, 43688, 8, 8, 8, 8, 65528, 8, 8, 65528, 8, 8, 63656, 65528, 8, 65528, 16760, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 62632, 65528, 8, 56792, 38216, 43688, 8, 8, 8, 65528, 8, 8, 8, 8, 65528, 8, 63848, 65528, 65528, 65528, 23848, 6248, 43688, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 65528, 65528, 8, 51480, 8, 1352, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 65528, 65528, 65528, 8, 21848, 8, 8, 8, 32760, 8, 8, 8, 8, 8, 8, 8, 64184, 65528, 8, 32760, 18728, 8184, 65528, 8, 65528, 8, 65528, 8, 8, 8, 65528, 8, 53112, 65528, 8, 65528, 44248, 168, 65528, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 52424, 43688, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 65528, 21848, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65016, 65528, 8, 43688, 23128, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 54120, 65528, 8, 8, 56584, 8, 65528, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 61448, 65528, 65528, 65528, 24264, 9704, 9368, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 61752, 65528, 8, 65528, 58968, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 60376, 65528, 8, 65528, 32408, 5464, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 60152, 65528, 8, 65528, 44824, 50968, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 59704, 65528, 8, 65528, 39320, 10920, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 59160, 65528, 1688, 32760, 53144, 41928, 21848, 43688, 32760, 8, 57624, 41384, 54600, 3848, 8, 8, 63176, 65528, 8, 65528, 59128, 43688, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 21848, 8568, 65528, 8, 8, 8, 8, 41192, 16376, 30248, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 8, 65528, 8, 8, 65528, 8, 16376, 57336, 16376, 8, 8, 8, 60840, 65528, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 4136, 41256, 1336, 64840, 47880, 37448, 46248, 10088, 46184, 48888, 50632, 8, 8, 8, 8, 8, 32760, 8, 24344, 24344, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 43688, 6552, 63000, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 60840, 65528, 8, 8, 8, 43688, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 16376, 8, 8, 8, 8, 8, 32760, 43000, 50408, 50968, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 58712, 32760, 53880, 8, 9832, 8, 8, 8, 32760, 22600, 36696, 18968, 47496, 38536, 13112, 65528, 37736, 15496, 11560, 52776, 54232, 10968, 27304, 8, 8, 8, 8, 8, 65528, 65528, 8, 65528, 65528, 65528, 49144, 32760, 65528, 65528, 53528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 7288, 65528, 8, 65528, 3272, 8, 8, 65528, 2408, 49144, 65528, 8, 43688, 8, 21848, 65528, 65528, 8, 8, 65528, 65528, 50408, 13112, 54600, 60488, 24568, 26216, 8, 8, 8, 8, 8, 8, 32760, 8, 57336, 43688, 35736, 8, 65528, 16376, 36264, 29784, 8, 8, 8, 8, 8, 65528, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 65528, 65528, 65528, 8, 61464, 49144, 8, 45864, 49144, 47656, 16984, 2024, 57896, 34184, 65528, 8008, 58968, 21848, 21848, 65528, 65528, 32760, 65528, 5320, 56664, 49144, 8408, 41816, 47384, 9640, 55032, 4520, 65528, 50632, 8, 8, 65528, 62232, 8, 65528, 60840, 8, 8, 65528, 60344, 54152, 64808, 8, 65528, 60680, 8, 8, 65528, 49144, 8, 8, 65528, 62712, 32760, 8, 65528, 65528, 8, 8, 65528, 65528, 65528, 8, 65528, 65528, 8, 65528, 65528, 8, 58744, 65528, 21848, 52424, 35288, 65528, 65528, 32760, 65528, 8, 8, 8, 8, 8, 65528, 65528, 8, 65528, 8, 8, 65528, 8, 8, 8, 8, 8, 65528, 21848, 8, 65528, 63576, 61752, 65528, 8, 65528, 65528, 65528, 8, 65528, 65528, 8, 8, 65528, 53464, 8, 8, 65528, 65528, 8, 8, 65528, 65528, 8, 8, 65528, 65528, 8, 43688, 8, 49144, 8, 65528, 65528, 64152, 65528, 65528, 44552, 65528, 65528, 8, 65528, 6136, 8, 65528, 65528, 32760, 8, 8, 8, 52424, 8, 8, 65528, 8, 8, 8, 8, 13112, 8, 8, 8, 55288, 8, 49144, 8, 28088, 8, 8, 65528, 65528, 65528, 8, 8, 27880, 8, 32760, 8, 65528, 8, 8, 8, 52424, 65528, 8, 8, 65528, 8, 8, 8, 47320, 8, 8, 8, 47656, 8, 65528, 65528, 25208, 21848, 55336, 8, 65528, 8, 8, 65528, 65528, 8, 8, 8, 50968, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 65528, 15416, 53240, 30184, 8, 56168, 8, 65528, 65528, 8, 8, 8, 65528, 54952, 65528, 8, 65528, 47176, 8, 30840, 65528, 61160, 8, 8, 65528, 57336, 8, 8, 65528, 51720, 8, 8, 65528, 32760, 8, 21848, 65528, 65528, 8, 65528, 31592, 62056, 488, 21848, 32120, 35112, 5960, 8, 46808, 55592, 43688, 65528, 57336, 63864, 43688, 8, 31256, 35784, 2792, 45160, 47880, 26040, 11912, 8, 8, 62728, 8, 8, 65528, 65528, 8, 65528, 65528, 62360, 8, 8, 2984, 25208, 65528, 8, 65528, 62824, 8, 8, 8, 65528, 8, 8, 65528, 63704, 8, 8, 8, 65528, 8, 8, 65528, 62568, 8, 8, 8, 57336, 8, 65528, 58248, 63144, 54600, 8, 55816, 64328, 65528, 21848, 65528, 62504, 32760, 23128, 65528, 65528, 8, 8, 8, 60488, 8, 32760, 8, 65528, 8, 8, 65528, 65528, 8, 8, 65528, 32760, 8, 40952, 65528, 59320, 32760, 26216, 29128, 61432, 11240, 8, 65528, 63000, 65528, 65528, 65528, 63528, 8, 8, 65528, 8, 8, 18728, 8, 8, 8, 8, 8, 8, 8, 8, 8, 10920, 8, 65528, 49192, 56168, 8, 47320, 4184, 60488, 20024, 63400, 36408, 8, 37448, 28088, 35736, 28088, 51720, 23400, 21544, 7704, 7160, 48072, 56584, 21272, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 65528, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 13112, 65528, 8, 32760, 51272, 57816, 6952, 19480, 63592, 8, 65528, 56968, 32760, 8, 16376, 8, 8, 8, 65528, 8, 56792, 45864, 10920, 65528, 63560, 13112, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 49144, 11304, 10920, 63224, 8, 8, 8, 8, 8, 65528, 8, 43688, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 65528, 32760, 8, 65528, 51800, 8, 6776, 46808, 23656, 32760, 32760, 9368, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 65528, 65528, 65528, 65528, 26216, 8, 51720, 8, 65528, 65528, 8, 8, 65528, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 43688, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 16376, 8, 65528, 63880, 8, 48936, 8, 1080, 6552, 8, 7704, 65528, 8, 8, 8, 50968, 32760, 65528, 8, 55976, 20776, 39320, 53960, 50968, 8456, 8, 43688, 8, 8, 8, 8, 65528, 26216, 8, 65528, 8, 11096, 65528, 65528, 65528, 8, 21848, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 37448, 8, 49144, 51464, 21848, 16376, 32760, 28088, 32760, 16376, 65528, 32760, 9368, 40328, 49144, 32760, 32760, 61672, 54600, 48856, 35288, 9480, 39656, 55128, 9608, 52920, 8, 8, 8, 8, 8, 8, 23400, 8, 46808, 8, 32760, 8, 8, 65528, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 60056, 8, 8, 8, 4184, 8, 8, 32760, 8, 8, 65528, 32760, 8, 8, 8, 8, 54600, 43688, 26216, 8, 65528, 10920, 8, 8, 8, 8, 8, 8, 3640, 8, 2264, 8, 54600, 8, 8, 64392, 27128, 46552, 27064, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 11560, 42264, 8, 65528, 63176, 8, 65528, 61944, 42392, 32760, 27720, 8, 65528, 8, 8, 8, 65528, 8, 8, 54600, 43224, 28648, 8616, 30008, 41128, 20696, 8, 8, 8, 21848, 8, 8, 21848, 33224, 8, 50840, 8, 8, 8, 2232, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 65528, 8, 8, 65528, 8, 26216, 49640, 32760, 65528, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 39320, 65528, 8, 65528, 21848, 8, 8, 8, 8, 8, 52424, 8, 8, 8, 65528, 8, 3848, 8, 48536, 65528, 32760, 5960, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 42392, 54600, 8, 14328, 5960, 29128, 65528, 34488, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 38712, 45096, 8, 47656, 32760, 14568, 65528, 8, 9912, 20296, 22616, 19512, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 16376, 37096, 8, 58248, 21848, 43688, 8, 29128, 12936, 41928, 52424, 30584, 65528, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 37448, 8, 8, 8, 8, 8, 8, 8, 65528, 31512, 8, 63032, 8, 8, 65528, 8, 8, 19224, 38536, 39320, 8, 8, 8, 8, 65528, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 65528, 45864, 8, 17640, 30104, 8, 45368, 50552, 59816, 14568, 46408, 47416, 31128, 8744, 59560, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 65528, 59336, 8, 8, 33032, 33160, 8, 40088, 38712, 46408, 54088, 4856, 48792, 65304, 15656, 10728, 65528, 65528, 8, 8, 65528, 16376, 8, 8, 65528, 64632, 65528, 8, 65528, 8, 8, 8, 65528, 8, 65528, 8, 24568, 33288, 26216, 54392, 8, 43688, 26216, 44552, 28088, 24904, 63256, 32760, 8, 65528, 65528, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 65528, 27592, 8, 54600, 37448, 65528, 65528, 8, 55448, 65528, 32760, 65528, 8, 65528, 8, 8, 65528, 59304, 8, 8, 8, 65528, 8, 8, 65528, 46808, 8, 8, 8, 65528, 8, 8, 23912, 47256, 8, 28824, 32760, 65528, 8, 56792, 46552, 488, 45672, 65528, 65528, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 52424, 34152, 8, 57784, 8, 8, 8, 8, 22712, 65528, 18024, 21848, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 32760, 8, 60056, 8, 8, 16376, 21848, 16376, 8, 29784, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 21848, 8, 65528, 8, 8, 8, 8, 62072, 65528, 65528, 8, 8, 8, 8, 8, 65528, 28088, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 10296, 47880, 8, 49416, 59560, 41688, 59864, 3368, 44248, 39704, 54600, 58248, 8, 8, 8, 8, 65528, 57816, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 65528, 52056, 8, 8, 8, 58552, 8, 65528, 8, 8, 8, 8, 59320, 51144, 65528, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 18968, 33976, 8, 55224, 8, 65528, 65528, 30024, 46408, 63848, 63048, 65528, 65528, 65224, 8, 8, 8, 65528, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 11912, 41128, 8, 54728, 15416, 55848, 21128, 32760, 12120, 64184, 32840, 58248, 8, 65528, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 48280, 8, 45864, 8, 8, 8, 8, 2728, 41688, 9832, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 43688, 8, 65528, 8, 8, 8, 8, 32760, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 17480, 31624, 8, 50792, 8, 19656, 8, 53960, 25720, 8952, 61816, 12040, 60056, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 32760, 8, 8, 8, 8, 8, 8, 8, 22408, 33128, 8, 49400, 12488, 8, 65528, 8648, 60680, 28088, 53608, 65528, 8, 8, 8, 8, 65528, 8, 65528, 8, 8, 8, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 8, 46248, 35000, 8, 40392, 53352, 40568, 34584, 34328, 33016, 4280, 2952, 35288, 8, 65528, 65528, 8, 65528, 21848, 65528, 8, 32760, 45256, 4088, 52424, 58248, 26216, 65528, 8, 65528, 8, 8, 8, 39320, 29544, 8, 56344, 65528, 8, 8, 8, 63240, 59704, 744, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 57336, 8, 65528, 43688, 8, 40328, 8, 47096, 55816, 8, 8, 8, 8, 65528, 65528, 8, 65528, 8, 65528, 57816, 39320, 2344, 49144, 62664, 44392, 8, 8, 8, 8, 8, 8, 16376, 62328, 8, 65528, 8, 8, 8, 65528, 42920, 18200, 16376, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 32760, 15128, 57336, 26216, 8, 8, 65528, 8, 21848, 8, 32760, 8, 8, 8, 8, 65528, 8, 8, 8, 16376, 52424, 8, 65528, 60488, 8, 8, 8, 8, 8, 8, 8, 13800, 16872, 8, 33704, 65528, 65528, 26984, 8, 65528, 65528, 216, 39320, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 32760, 8, 65528, 39016, 29128, 10088, 41688, 5240, 32760, 8, 8, 32760, 45864, 65528, 40952, 18728, 16376, 54216, 16376, 28568, 38392, 12280, 58040, 61672, 21128, 57816, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 32760, 36856, 65528, 56584, 61160, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 920, 3192, 4520, 16376, 38536, 17864, 26216, 4280, 37608, 45000, 50216, 47480, 8, 8, 8, 8, 8, 8, 8, 32760, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 46376, 8, 8, 8, 8, 8, 65528, 39320, 21848, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 2984, 8, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 25208, 32760, 8, 65528, 65528, 27592, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 65528, 8, 16376, 65528, 21848, 50104, 10920, 8, 8, 8, 8, 8, 65528, 65528, 13112, 31544, 16376, 49144, 28088, 54600, 65528, 46808, 8744, 8, 65528, 43688, 8, 32760, 8, 65528, 54120, 43144, 3976, 61704, 43688, 30424, 12072, 6552, 54120, 6968, 47656, 39320, 32760, 5960, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 32760, 8, 8, 8, 8, 8, 49144, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 3128, 65528, 6552, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 65528, 8, 65528, 8, 49144, 8, 65528, 8, 8, 8, 65528, 63800, 8, 8, 65528, 8, 8, 8, 65528, 35736, 26216, 16376, 8, 8, 8, 8, 65528, 16376, 52424, 8, 8, 8, 65528, 5048, 40200, 8, 8, 56168, 65528, 8, 64440, 8, 65528, 64248, 65528, 65528, 65528, 65528, 65528, 8, 65528, 8, 8, 8, 65528, 65528, 8, 8, 65528, 63096, 59560, 16376, 65528, 10920, 8, 32760, 49144, 60936, 7288, 65528, 65528, 65528, 8, 8, 8, 8, 65528, 8, 65528, 65528, 8, 8, 65528, 8, 62664, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 37080, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 61672, 62296, 8, 8, 65528, 65528, 8, 8, 65528, 49144, 8, 8, 65528, 59304, 8, 8, 65528, 8, 8, 8, 65528, 65528, 8, 8, 8, 37448, 23128, 15560, 65528, 8, 8, 8, 65528, 65528, 8, 32760, 8, 65528, 8, 8, 32328, 12840, 32760, 48760, 61608, 52648, 5096, 16376, 17864, 22792, 8, 63256, 65528, 13272, 61912, 52424, 8, 52424, 36408, 65528, 52424, 65528, 65528, 8, 8, 8, 26216, 65528, 16376, 57336, 41816, 65528, 60840, 19272, 29128, 6552, 51272, 54600, 37032, 36296, 8040, 54600, 50808, 65528, 49144, 65528, 57576, 8, 8, 13528, 26216, 31000, 8, 8, 8, 8, 54600, 11976, 32760, 62360, 8, 65528, 8, 8, 8, 62248, 8, 8, 65528, 8, 8, 8, 8, 5240, 8, 18728, 65528, 65528, 8, 8, 65528, 7704, 32760, 19128, 65528, 8, 8, 8, 8, 9368, 8, 13112, 65528, 65528, 8, 8, 8, 57656, 26216, 23944, 65528, 56168, 8, 8, 8, 65528, 8, 32760, 8, 8, 8, 8, 8, 50312, 65528, 8, 65528, 65528, 8, 8, 8, 32760, 8, 8, 8, 8, 8, 8, 63992, 23080, 8, 65528, 65528, 52168, 8, 8, 8, 49144, 8, 65528, 65528, 13112, 8, 8, 8, 52424, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 62472, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 61160, 8, 8, 65528, 23592, 8, 8, 65528, 49880, 54600, 18264, 8, 65528, 8, 8, 8, 16376, 8, 20168, 8, 65528, 8, 8, 8, 65528, 8, 19656, 65528, 14248, 8, 8, 8, 45976, 30840, 20872, 65528, 65528, 8, 8, 49144, 58552, 65528, 8, 65528, 65528, 8, 8, 65528, 8, 43688, 32760, 8, 8, 8, 8, 8, 8, 32760, 8, 32760, 8, 44824, 26216, 8, 8, 8, 11400, 8, 8, 8, 32760, 8, 8, 65528, 62072, 8, 4376, 8, 50232, 9368, 8, 8, 3848, 8, 8, 8, 8, 8, 8, 65528, 31144, 8, 65528, 65528, 43688, 8, 8, 8, 7288, 8, 65528, 65528, 8, 8, 8, 65528, 7704, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 61160, 8, 8, 8, 8, 8, 8, 8, 9368, 8, 8, 8, 8, 8, 65528, 8, 16376, 26216, 8, 8, 32760, 8, 65528, 43688, 8, 58968, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 65528, 65528, 8, 8, 54600, 65528, 8, 8, 8, 8, 8, 8, 47448, 35096, 16376, 65528, 17448, 2040, 32760, 8, 65528, 65528, 8, 8, 8, 32760, 8, 8, 56568, 65528, 52424, 60488, 20024, 50360, 56168, 8, 43688, 7288, 65528, 8, 65528, 8, 8, 8, 65528, 13112, 16376, 8, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 10792, 19656, 65528, 65528, 19656, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 13240, 8, 28664, 25544, 31000, 2424, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 21848, 65528, 65528, 21848, 8, 8, 32760, 60056, 29128, 61784, 8, 8, 8, 65528, 8, 65528, 8, 8, 8, 37208, 1640, 56968, 25320, 65528, 65528, 8, 8, 8, 8, 8, 8, 65528, 5464, 8, 8, 32760, 8, 65528, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 60056, 65528, 31592, 8, 8, 65528, 8, 8, 8, 8, 376, 8, 8, 8, 8, 8, 7288, 8, 17864, 8, 8, 8, 8, 8, 21848, 8, 3128, 8, 8, 8, 8, 8, 17160, 24568, 45848, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 19800, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8136, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 8, 8, 28088, 5960, 36408, 8, 8, 8, 8, 8, 29128, 8, 8, 8, 8, 8, 8, 8, 280, 48424, 54600, 8, 8, 8, 8, 8, 8, 65528, 43192, 8, 8, 8, 8, 8, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 4680, 32760, 4920, 8, 8, 8, 8, 8, 23832, 54600, 28488, 8, 8, 8, 8, 65528, 22600, 32488, 50904, 39320, 34952, 24136, 5768, 8, 8, 8, 8, 8, 8, 49144, 8, 65528, 8, 36696, 8, 26216, 6904, 24824, 504, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 14568, 8, 8, 49144, 8, 65528, 16984, 65528, 65528, 8, 8, 8, 8, 8, 8, 25368, 54120, 46248, 45864, 23560, 7496, 65528, 65528, 8, 43688, 6552, 8, 8, 8, 8, 65528, 62536, 52424, 65528, 65528, 32760, 8, 8, 8, 8, 19656, 8, 8, 8, 8, 8, 8, 38216, 8, 65528, 47656, 29672, 1640, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 21848, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 8, 8, 65528, 8, 26216, 65528, 62024, 65528, 65528, 49144, 17304, 8, 43688, 65528, 65528, 8, 65528, 65528, 65528, 8, 39320, 65528, 8, 8, 40952, 39320, 30584, 8, 49144, 49144, 60488, 51272, 8, 8, 65528, 31688, 59000, 9272, 47176, 31208, 32088, 25752, 8552, 22904, 2728, 43688, 45368, 60056, 8, 8, 8, 8, 43688, 65528, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 49144, 8, 8, 8, 8, 8184, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 65528, 8, 65528, 8, 65528, 8, 49144, 8, 65528, 8, 8, 8, 65528, 59192, 8, 8, 65528, 8, 8, 8, 65528, 39944, 8, 8, 8, 8, 8, 8, 34952, 5960, 8, 1528, 60520, 53720, 392, 4792, 65528, 8, 8, 8, 65528, 44248, 45864, 54600, 65528, 60760, 65528, 8, 65528, 64904, 49752, 65528, 32760, 21848, 8, 8, 64264, 65528, 46808, 65528, 65528, 61848, 45576, 8, 62440, 43688, 10920, 27304, 56168, 56200, 3752, 54600, 32760, 65528, 56344, 8, 8, 8, 65528, 8, 8, 32760, 8, 8, 21848, 65528, 8, 65528, 65528, 8, 65528, 8, 8, 65528, 8, 65528, 8, 8, 8, 8, 65528, 8, 8, 8, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 63880, 64088, 8, 8, 65528, 65528, 8, 8, 65528, 65528, 65528, 8, 65528, 59528, 8, 8, 65528, 8, 8, 8, 65528, 59288, 8, 8, 8, 8, 8, 8, 8, 58968, 32760, 8, 65528, 65528, 8, 8, 8, 65528, 8, 8, 37448, 60280, 39320, 8, 38712, 62824, 8, 32760, 16376, 52920, 8, 65528, 65528, 43688, 39320, 65528, 8, 40152, 8, 65528, 8, 39320, 65528, 8, 8, 8, 8, 8, 8, 65528, 6552, 8, 65528, 61672, 43688, 8, 65528, 65528, 8, 8, 8, 65528, 21848, 8, 65528, 65528, 8, 8, 8, 65528, 8, 65528, 8, 8, 8, 8, 8, 65528, 8, 32760, 8, 65528, 8, 8, 8, 65528, 32760, 8, 8, 32760, 8, 8, 8, 65528, 8, 65528, 8, 48280, 8, 8, 65528, 9368, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 63688, 8, 8, 8, 8, 8, 8, 65528, 55176, 36408, 8, 65528, 8, 8, 8, 8, 57336, 8, 8, 8, 8, 8, 8, 65528, 65144, 8, 8, 8, 65528, 8, 8, 65528, 65528, 8, 8, 65528, 15864, 8, 54600, 59432, 65112, 6424, 58968, 52424, 65080, 8, 8, 8, 34152, 63176, 52424, 8, 8, 8, 8, 65528, 65528, 65528, 8, 65528, 65528, 8, 8, 65528, 8, 60488, 8, 64936, 57704, 25368, 8, 60760, 63608, 30136, 5464, 65528, 64648, 13112, 65528, 8, 65528, 32760, 8, 65528, 62920, 39320, 65528, 65528, 65528, 8, 16376, 65352, 46072, 32760, 8, 65528, 60408, 8, 8, 65528, 49832, 54984, 65528, 8, 65528, 8, 65528, 65528, 58936, 8, 8, 65528, 45048, 8, 8, 63880, 56328, 8, 8, 65528, 45192, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 65528, 63752, 8, 65528, 65528, 61880, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 10920, 8, 8, 65528, 8, 59144, 8, 53240, 29784, 8, 57336, 59704, 5464, 36568, 18728, 8, 8, 8, 8, 8, 8, 65528, 38712, 44392, 45368, 19656, 42728, 63064, 5512, 17480, 50408, 19016, 26216, 31208, 39784, 8, 65528, 65528, 27224, 34040, 15432, 36088, 30136, 19512, 25784, 3752, 35080, 6488, 48568, 39320, 49928, 8, 8, 65528, 8, 12408, 65528, 8, 65528, 20632, 6728, 8, 8, 8, 8, 8, 8, 65528, 8, 65528, 8, 65528, 65528, 8, 65528, 47096, 3640, 8, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 64856, 65528, 65528, 65528, 65528, 22712, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 52424, 65528, 65528, 8, 52504, 8, 8, 8, 26216, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 21848, 8, 8, 65528, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 49144, 32760, 56168, 65528, 47448, 32760, 65528, 8, 8, 32760, 8, 65528, 65528, 8, 8, 8, 8, 43688, 32760, 8, 65528, 32760, 8, 8, 8, 8, 8, 8, 54600, 65528, 65528, 11912, 46248, 8, 8, 8, 43688, 45864, 8, 50968, 26216, 65528, 8, 8, 65528, 8, 8, 8, 55816, 65528, 8, 65528, 3576, 6904, 63480, 8, 61944, 8, 25048, 8, 65528, 65528, 32760, 8, 65528, 65528, 65528, 8, 13112, 6824, 42120, 12744, 20472, 53960, 37448, 8, 32760, 8, 8, 8, 13176, 65528, 44232, 36408, 8296, 2008, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 36408, 65528, 8, 43688, 64488, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 43688, 65528, 8, 8, 1608, 4008, 65528, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 32760, 65528, 8, 32760, 39704, 65528, 63656, 65528, 5048, 5960, 8, 65528, 65528, 38952, 65528, 65528, 65528, 4072, 8, 8, 65528, 8, 8, 32760, 8, 8, 65528, 65528, 56456, 61608, 38296, 32296, 37064, 15800, 27784, 5560, 49720, 8408, 34840, 34856, 8, 8, 8, 8, 8, 60280, 65528, 16376, 8, 46264, 50408, 45864, 65528, 15240, 22056, 8, 8, 65528, 10216, 8, 8, 65528, 8, 8, 65528, 65528, 3448, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 4376, 65528, 8, 8, 2184, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 14568, 65528, 8, 40952, 8, 8, 65528, 8, 8, 8, 8, 8, 65528, 8, 8, 18728, 65528, 8, 15128, 8, 2616, 21848, 21848, 4680, 8, 8, 8, 65528, 21848, 8, 8, 32760, 43688, 8, 8, 8, 11032, 16376, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 13496, 52424, 56168, 8, 29000, 1912, 32760, 8, 65528, 8, 8, 65528, 8, 8, 8, 8, 65528, 8, 8, 65528, 8, 65096, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65368, 65528, 65528, 62536, 6392, 46712, 60280, 22680, 1928, 11400, 40952, 26984, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 904, 49144, 8, 8, 46808, 16376, 54600, 57848, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 64088, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 65528, 65528, 6776, 52632, 8, 8, 26216, 23832, 43688, 8, 32760, 65528, 65528, 8, 65528, 8, 65528, 14808, 37800, 4424, 57064, 8472, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 49144, 8, 65528, 8, 8, 8, 41384, 8, 8, 8, 8, 8, 8, 62248, 65528, 8, 65528, 53384, 8, 8, 58968, 62136, 32760, 39880, 65528, 8, 65528, 8, 62536, 8, 8, 8, 65528, 8, 3176, 65528, 63320, 59688, 2344, 45304, 50968, 23544, 65528, 18728, 65528, 61288, 8, 8, 65528, 63000, 8, 8, 8, 8, 65528, 8, 65528, 65528, 65528, 8, 65528, 59096, 65528, 8, 65528, 28088, 8, 8, 8, 62408, 8, 8, 8, 8, 65528, 8, 65528, 8, 65528, 8, 65528, 8, 8, 8, 65528, 65528, 57768, 46808, 65528, 8, 65528, 32760, 65528, 8, 65528, 8, 65528, 8, 65528, 8, 4088, 8, 8, 44200, 65016, 40, 65528, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 21848, 65528, 65528, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 65528, 57336, 8, 8, 65528, 65528, 8, 8, 65528, 65528, 8, 8, 8, 5048, 24568, 17160, 65528, 65528, 8, 8, 42392, 60488, 8, 49704, 8, 65528, 65528, 8, 60488, 18376, 32760, 21848, 65528, 8, 18200, 10920, 728, 696, 616, 51496, 65528, 3640, 65528, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 65528, 8, 8, 8184, 32760, 65528, 8, 65528, 8, 8, 65528, 8, 8, 8, 8, 65528, 65528, 8, 65528, 8, 17864, 19432, 8, 65528, 8, 8, 46920, 17496, 7832, 51336, 65528, 8, 65528, 13736, 33704, 5560, 40328, 40328, 12600, 65528, 57960, 65528, 25384, 27848, 65528, 40472, 53496, 13240, 8, 8, 65528, 16984, 29128, 21288, 65528, 8, 8, 8, 8, 14568, 8, 28088, 65528, 54600, 8, 8, 8, 65528, 65016, 28136, 65528, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 52424, 8, 8, 65528, 62872, 8, 8, 62072, 8, 4680, 65528, 53608, 43688, 65528, 16376, 28088, 50968, 8, 8, 65528, 51352, 13112, 7288, 32760, 56696, 616, 53144, 64984, 664, 8, 21848, 65528, 19656, 8, 8, 65528, 63912, 8, 8, 8, 13112, 8, 8, 65528, 8, 65528, 8, 65528, 49576, 8, 65528, 65528, 65528, 8, 8, 65528, 35736, 8, 8, 65528, 64936, 8, 8, 65528, 9368, 65528, 8, 8, 8, 8, 8, 58312, 51720, 1176, 46248, 65528, 64264, 65528, 2344, 63400, 36760, 52424, 26920, 65528, 65464, 65528, 8, 39320, 1944, 1496, 16760, 65528, 456, 8, 8, 65528, 65528, 8, 49144, 65528, 5464, 8, 8, 8, 27304, 39320, 26888, 8, 65528, 8, 8, 65528, 58968, 65528, 8, 65528, 65528, 8, 8, 8, 8, 65528, 30104, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 39320, 58440, 8, 8, 8, 11912, 8, 8, 8, 57336, 40952, 8, 8, 8, 8, 824, 12600, 18200, 65528, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 27592, 8, 8, 65528, 8, 8, 8, 32760, 29784, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 57336, 65528, 8, 43688, 8, 8, 65528, 39320, 8, 8, 40328, 8, 8, 8, 14568, 8, 48776, 34856, 8, 56424, 50904, 2520, 14888, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 14040, 65528, 8, 65528, 8, 8, 8, 2920, 53768, 8, 8, 65528, 8, 8, 8, 65528, 37448, 8, 8, 65528, 8, 8, 8, 8, 8, 65528, 8, 65528, 8, 8, 8, 65528, 14568, 14568, 8, 8, 65528, 32088, 4440, 65528, 32040, 54952, 8, 65528, 8, 65528, 8, 8, 2984, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 61160, 8, 8, 8, 8, 8, 8, 8, 32760, 65528, 8, 8, 65528, 65528, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 36776, 21848, 30536, 65528, 8, 65528, 8, 8, 8, 8, 65528, 8, 8, 65528, 8, 8, 16664, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 50968, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 43688, 13112, 19208, 8, 8, 65528, 16376, 8, 8, 65528, 32760, 65528, 8, 38216, 8, 2120, 296, 5960, 63080, 8, 3640, 24568, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 2952, 18536, 49448, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 4200, 65528, 1800, 8, 8, 8, 8, 43688, 8, 8, 40824, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 1464, 8, 63512, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 17640, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 2856, 65528, 8, 46552, 8, 8, 65528, 8, 8, 8, 8, 23128, 65528, 65528, 55816, 32760, 8, 9864, 10824, 53208, 65528, 8, 65528, 8, 8, 7704, 3448, 29368, 8, 8, 8, 8, 8, 8, 8, 15640, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 4088, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 28088, 65528, 8, 18344, 8, 8, 65528, 32760, 65528, 8, 8, 8, 8, 8, 65528, 8, 62664, 21064, 3160, 25720, 40264, 21240, 8, 8, 8, 8, 8, 56968, 8, 8, 8, 8, 8, 1176, 65528, 61160, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 13112, 60056, 8, 8, 65528, 8, 57336, 8, 8, 8, 8, 8, 24568, 65528, 8, 8, 8, 59224, 65288, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 21848, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 61432, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 32760, 8, 65528, 8, 8, 8, 41688, 8, 8, 8, 8, 8, 8, 61880, 8, 8, 65528, 8, 8, 8, 64216, 43688, 8, 55176, 65528, 8, 8, 49144, 65528, 8, 8, 8, 8, 8, 16376, 8, 5464, 8, 8, 65528, 46808, 4680, 65528, 8, 65528, 65528, 8, 8, 65528, 65528, 8, 8, 65528, 8, 8, 8, 65528, 65528, 65528, 8, 65528, 54888, 65528, 8, 8, 65528, 8, 8, 8, 61544, 8, 8, 8, 65528, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 32760, 65528, 11656, 55832, 8, 8, 65528, 4856, 8, 8, 65528, 8, 8, 8, 65528, 65528, 62008, 296, 8, 42344, 6168, 472, 63656, 8, 8, 8, 8, 8, 8, 8, 8, 8, 52424, 65528, 65528, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 65528, 60664, 8, 8, 65528, 8, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 46808, 8, 8, 49144, 65528, 3400, 46744, 8, 65528, 65528, 7768, 59560, 5272, 31208, 38488, 23752, 47496, 24856, 32760, 5624, 952, 8, 65128, 65320, 37128, 888, 8, 65528, 8, 8, 65528, 65528, 8, 32760, 8, 16376, 32760, 16376, 65528, 8, 60280, 8, 8, 65528, 40664, 50680, 2264, 56168, 26216, 14040, 15816, 8, 53048, 4584, 45496, 43688, 62328, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 56168, 65528, 8, 65528, 8, 8, 65528, 65528, 8, 65528, 8, 8, 8, 8, 8, 8, 65528, 11112, 8, 55672, 46808, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 65528, 8, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 60408, 65528, 8, 8, 8, 21848, 26216, 8, 8, 65528, 8, 65528, 10920, 8, 8, 61640, 60792, 8, 65528, 744, 8, 8, 65528, 8, 64264, 8, 8, 65528, 64008, 65528, 21848, 65528, 64776, 65528, 65528, 65528, 65528, 8, 8, 65528, 8, 8, 65528, 65528, 46008, 48536, 2984, 63160, 55448, 30248, 31704, 43688, 5752, 4376, 18280, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 62408, 65528, 8, 65528, 8, 65528, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 50408, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 20472, 45048, 8, 8, 65528, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 18728, 21848, 8, 13112, 65528, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 21848, 40952, 13112, 39320, 8, 8, 54600, 8, 32760, 39320, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 56424, 65528, 9928, 35288, 8, 8, 65528, 25208, 51864, 8, 8, 65528, 62408, 14888, 32760, 8, 65528, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 46808, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 52424, 792, 65528, 65528, 59816, 13832, 20472, 49144, 8, 6088, 8, 65528, 8, 65528, 65528, 39320, 25208, 32760, 9832, 56168, 45368, 24568, 60488, 6552, 28088, 32760, 63752, 8, 65528, 65528, 26408, 50664, 4072, 49000, 10600, 16376, 22104, 7864, 21640, 2280, 50600, 37800, 64744, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 19112, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 12280, 37448, 32760, 59560, 47656, 16376, 8, 8, 65528, 8, 8, 8, 65528, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 35288, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 32760, 65528, 65528, 26216, 45368, 39320, 8, 49144, 65528, 8, 19416, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 57336, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 56168, 37448, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 49144, 8, 8, 32760, 7448, 8, 65528, 49144, 47656, 8, 8, 8, 8, 8, 65528, 8, 8, 65528, 65528, 8, 8, 8, 8, 65528, 8, 16376, 8, 8, 65528, 65528, 8, 8, 65528, 27592, 50632, 4680, 47320, 65528, 29784, 29368, 8, 16376, 1176, 57816, 43688, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 13112, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 50408, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 65528, 64440, 8, 8, 65528, 46696, 65528, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 65528, 8, 63704, 8, 8, 8, 65528, 8, 65528, 8, 65528, 59448, 5048, 8, 65528, 63160, 49144, 65528, 65528, 65528, 8, 8, 57816, 65528, 65528, 8, 8, 63144, 65528, 8, 65528, 65528, 8, 8, 65528, 52504, 8, 8, 65528, 13112, 8, 8, 65528, 8, 65528, 8, 65528, 8, 8, 8, 65528, 8, 58248, 8, 65528, 8, 8, 8, 65528, 8, 65528, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 65528, 8, 65528, 8, 57336, 60488, 8, 8, 65528, 62968, 8, 8, 65528, 49144, 8, 8, 65528, 59064, 8, 8, 65528, 65528, 8, 8, 65528, 65528, 8, 8, 8, 19656, 18728, 16200, 65528, 65528, 8, 8, 65528, 65528, 8, 8, 65528, 65528, 8, 8, 65528, 24888, 65528, 37032, 65528, 65528, 8, 8, 8, 65528, 65528, 8, 65528, 65528, 65528, 8, 65528, 65528, 8, 8, 8, 65528, 8, 8, 65528, 8, 65528, 8, 8, 8, 8, 8, 65528, 4904, 8, 65528, 65528, 65528, 8, 65528, 65528, 65528, 43688, 65528, 65528, 60056, 8, 8, 65528, 2680, 21848, 23128, 18728, 36408, 8, 8, 65528, 18440, 49144, 62456, 40952, 65528, 8, 65528, 65528, 8, 8, 52424, 65528, 8, 8, 8, 65528, 10920, 8, 10920, 65528, 65528, 8, 8, 65528, 5464, 24568, 16584, 65528, 8, 8, 8, 65528, 21848, 37448, 41688, 65528, 23496, 8, 8, 32760, 36152, 60056, 33400, 65528, 8, 8, 8, 8, 36408, 8, 39320, 8, 65528, 8, 8, 8, 40952, 65528, 65528, 65528, 62696, 8, 8, 65528, 21848, 8, 8, 65528, 46808, 8, 8, 65528, 28088, 8, 8, 65528, 52248, 8, 8, 65528, 60904, 8, 65528, 65528, 65528, 65528, 8, 65528, 32760, 8, 8, 65528, 64872, 8, 8, 65528, 36408, 8, 8, 65528, 49144, 8, 65528, 65528, 57336, 65528, 8, 21272, 65528, 8, 65528, 65528, 57960, 8, 8, 65528, 51832, 8, 8, 65528, 48280, 8, 8, 65528, 65528, 8, 8, 65528, 57928, 8, 8, 65528, 40328, 8, 8, 65368, 58888, 26216, 14216, 65528, 62568, 8, 8, 65528, 63736, 8, 32760, 65528, 65528, 8, 8, 65528, 65528, 8, 17864, 65528, 43688, 8, 8, 65528, 26328, 21848, 28712, 65528, 63704, 8, 8, 8, 56792, 8, 8, 65528, 65528, 8, 8, 8, 25480, 32760, 29272, 8, 8, 8, 8, 65528, 8, 40088, 13112, 21848, 8, 54600, 8184, 8, 8, 38216, 54008, 8, 8, 8, 8, 65528, 8, 8, 4424, 21848, 8, 8184, 8, 8, 8, 9368, 10728, 8, 32760, 65528, 8, 65528, 8, 42904, 28264, 29784, 61880, 39912, 11816, 8, 8, 8, 12600, 8, 8, 65528, 8, 65528, 8, 65528, 18728, 65528, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 34952, 8, 8, 8, 8, 21848, 8, 32760, 8, 8, 65528, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8184, 8, 8, 8, 8, 8, 8, 16376, 4792, 8, 65528, 8, 8, 8, 8, 8, 41256, 8, 8, 8, 8, 8, 8, 19416, 32760, 32760, 65528, 9992, 5624, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 51480, 21848, 32760, 23832, 3128, 19480, 8, 8, 8, 22552, 8, 65528, 8, 8, 8, 8, 40568, 8744, 8, 8, 8, 8, 8, 8, 44552, 8, 8, 65528, 65528, 8, 65528, 8, 50968, 2088, 8, 8, 13800, 8, 8, 8, 8, 1320, 8, 8, 8, 8, 8, 16376, 8, 65528, 32760, 16376, 36040, 8, 8, 13112, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 5960, 8, 65528, 65528, 8, 8, 56584, 8, 23192, 8, 8, 8, 8, 8, 8, 65528, 59560, 8, 8, 5624, 8, 8, 27960, 65528, 65528, 8, 8, 8, 8, 65528, 8, 62904, 8, 8, 65528, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 55176, 65528, 8, 8, 8, 65528, 8, 21256, 43112, 37416, 8, 8, 8, 8, 8, 8, 32760, 10232, 8, 8, 8, 10920, 8, 8, 8, 1160, 8, 65528, 8, 8, 65528, 65528, 52424, 8, 8, 8, 8, 8, 8, 12056, 16056, 27576, 8, 65528, 65528, 8, 8, 8, 65528, 14888, 65528, 8, 8, 65528, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 27256, 22680, 5208, 8, 8, 8, 8, 8, 8, 65528, 1976, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 18072, 18200, 56440, 8, 8, 8, 8, 8, 65528, 65528, 54600, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 15336, 9368, 13560, 8, 65528, 8, 8, 8, 17096, 41384, 65528, 8, 32760, 65528, 8, 8, 3640, 32760, 32040, 8, 65528, 32760, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 32760, 10920, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 32760, 8, 8, 8, 22856, 12280, 53944, 8, 8, 8, 8, 8, 8, 11912, 14568, 8, 54600, 20168, 16376, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 59320, 8, 8, 8, 8, 8, 2616, 8, 28088, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 3448, 45368, 3848, 65528, 36408, 27304, 16376, 32760, 38904, 24360, 31512, 18728, 8, 8, 65528, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 32760, 8, 8, 8, 8, 65528, 8, 20168, 8, 8, 65528, 65528, 65528, 8, 8, 57336, 54600, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 63096, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 32760, 4376, 45768, 65528, 26216, 43688, 50232, 36296, 51624, 28248, 38216, 65528, 8, 65528, 8, 8, 8, 8, 8, 65528, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 54600, 8, 8, 8, 8, 8, 21848, 8, 8, 8, 65528, 8, 65528, 61432, 8, 8, 65528, 52424, 8, 8, 65528, 52424, 8, 16376, 65528, 8, 8, 65528, 65528, 8, 56168, 8, 65528, 65528, 65528, 8, 64744, 8, 8, 8, 8, 65528, 65528, 8, 65528, 59448, 21848, 8, 65528, 62776, 32760, 65528, 65528, 51480, 8, 8, 65528, 61160, 8, 8, 65528, 60280, 8, 8, 65528, 26216, 65528, 8, 65528, 65528, 8, 8, 65528, 65528, 8, 8, 8, 8, 65528, 8, 65528, 8, 8, 8, 8, 8, 60648, 8, 8, 8, 8, 65528, 8, 8, 65528, 8, 8, 8, 9368, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 39320, 8, 8, 65528, 62504, 59848, 65528, 65528, 53608, 62584, 8, 8, 65528, 65528, 8, 65528, 65528, 58472, 8, 8, 65528, 32760, 8, 8, 65528, 56616, 8, 8, 65528, 8, 32760, 65528, 616, 6552, 6776, 32760, 28088, 26216, 16376, 8, 45464, 45016, 45560, 8, 8, 65528, 65528, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 65528, 32760, 8, 8, 8, 8, 65528, 8, 56792, 44888, 8, 8824, 65528, 65528, 8, 24136, 34488, 11912, 18280, 28568, 8, 8, 53608, 65528, 65528, 21848, 8, 21848, 8, 8, 8, 8, 65528, 65528, 8, 8, 65528, 65528, 65528, 8, 52424, 6552, 8, 65528, 8, 65528, 8, 65528, 65528, 65528, 8, 32760, 65528, 8, 65528, 8, 65528, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 2216, 3848, 8, 65528, 8, 8, 8, 65528, 58840, 59912, 65528, 65528, 65528, 49144, 65528, 8, 65528, 52424, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 19080, 51480, 4376, 43688, 37192, 61032, 34680, 28824, 38376, 51064, 48072, 8, 65224, 62936, 8, 8, 65528, 60840, 8, 8, 65528, 63384, 8, 8, 65528, 62888, 8, 8, 65528, 9368, 65528, 8, 39320, 58312, 5960, 19656, 65528, 43688, 8, 8, 29128, 65528, 35288, 65528, 65528, 65256, 33976, 21848, 65528, 65528, 13112, 8, 65528, 62680, 8, 8, 65528, 65288, 8, 8, 65528, 65528, 65528, 8, 65528, 65528, 34952, 32760, 65528, 64664, 8, 62072, 59288, 47304, 22424, 8, 65528, 60568, 59560, 8, 65528, 52424, 8, 8, 65528, 65528, 8, 8, 65528, 65528, 8, 8, 65528, 38216, 8, 8, 32760, 30840, 8, 65528, 49144, 65528, 8, 54392, 63992, 64568, 8, 8, 65528, 64200, 8, 8, 65528, 61160, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 56664, 43688, 2584, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 64184, 65528, 8, 65528, 21848, 47096, 8, 8, 8, 8, 8, 32760, 65528, 8, 65528, 8, 37448, 65528, 21192, 27928, 22936, 20168, 8, 65528, 65528, 65528, 65528, 8, 8, 65528, 8, 8, 62904, 65528, 65528, 65528, 37448, 65528, 8, 8, 8, 8, 8, 8, 32760, 8, 65528, 8, 52424, 65528, 8, 36856, 21128, 50968, 8, 8, 8, 65528, 21848, 8, 8, 8, 52424, 8, 61704, 65528, 8, 65528, 1400, 19112, 65528, 8, 65528, 8, 65528, 8, 8, 8, 8, 8, 65528, 8, 65528, 49144, 65528, 392, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 46808, 8, 16376, 32760, 8, 8, 45864, 8, 8, 8, 65528, 8, 8, 8, 65528, 65528, 8, 8, 8, 65528, 8, 8, 65528, 8, 65528, 8, 8, 65528, 8, 8, 49144, 65528, 8, 65528, 33640, 43688, 8, 8, 8, 8, 8, 65528, 65528, 8, 65528, 65528, 8, 32760, 65528, 8, 10088, 18728, 39320, 65528, 8, 8, 8, 8, 8, 65528, 65528, 8, 65528, 65528, 65528, 8, 32760, 65528, 65528, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 65528, 65528, 43688, 62072, 65528, 8, 8, 62248, 8, 8, 8, 8, 8, 65528, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 65528, 8, 56584, 65528, 8, 49144, 4088, 16376, 64632, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 65528, 17864, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 32760, 8, 16376, 8, 8, 8, 8, 8, 8, 8, 8, 21848, 65528, 8, 8, 8, 51480, 21848, 8, 8, 8, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 57336, 65528, 8, 65528, 44264, 61672, 8, 8, 60056, 8, 8, 8, 8, 8, 8, 8, 64280, 65528, 8, 40952, 55576, 38536, 8, 65528, 65528, 8, 52024, 45672, 58968, 8, 8, 8, 65528, 65528, 8, 8, 8, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 56792, 8, 32760, 65528, 8, 8, 39656, 9880, 26424, 8, 8, 8, 65528, 65528, 8, 8, 60488, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 26216, 65528, 8, 8, 8, 8, 39320, 32760, 43688, 8, 8, 8, 65528, 43688, 8, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 21848, 8, 1816, 24472, 1816, 61160, 43688, 42120, 40472, 5960, 45224, 40136, 54136, 8, 8, 8, 8184, 8, 8, 8, 26216, 19416, 8, 8, 43688, 65528, 8, 8, 8, 8, 65528, 8, 19656, 8, 8, 8, 19656, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 6552, 32760, 65528, 32760, 8, 8, 43688, 56488, 43688, 58440, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 54600, 32760, 8, 59560, 65528, 8, 8, 8, 65528, 24760, 8, 65528, 8, 65528, 8, 32760, 8, 8, 65528, 8, 1880, 8, 8, 8, 8, 8, 8, 52424, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 65528, 65528, 8, 65528, 8, 46808, 8, 8, 8, 8, 8, 54600, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 43688, 8, 8, 8, 8, 8, 8, 28088, 25432, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 55960, 8, 8, 8, 8, 8, 43688, 21848, 65528, 8, 52424, 65528, 65528, 8, 65528, 32760, 8, 8, 11912, 58616, 8, 8, 65528, 8, 65528, 8, 8, 65528, 8, 8, 65528, 8, 65528, 8, 8, 8, 65528, 8, 56968, 49144, 8, 8, 60728, 43992, 8, 8, 65528, 8, 65528, 43688, 65528, 65528, 56168, 8, 65528, 49144, 65528, 8, 65528, 8, 65528, 8, 8, 65528, 65528, 8, 11912, 65528, 8, 8, 8, 8, 65528, 8, 8, 65528, 8, 8, 65528, 8, 53608, 21848, 65528, 50632, 52424, 8, 65528, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 53240, 8, 8, 8, 8, 8, 58616, 10920, 8, 8, 16376, 49144, 8, 8, 65528, 52424, 65528, 8, 65528, 65528, 65528, 8, 65528, 55032, 8, 8, 65528, 8, 8, 8, 65528, 18728, 8, 8, 8, 8, 8, 39320, 8, 32760, 8, 8, 65528, 65528, 65528, 8, 65528, 65528, 8, 8, 8, 10920, 8, 8, 21848, 65528, 65528, 8, 8, 8, 8, 8, 65528, 8, 65528, 8, 8, 8, 65528, 8, 65528, 8, 8, 8, 65528, 16376, 65528, 8, 65528, 65528, 65528, 65528, 8, 8, 65528, 8, 65528, 65528, 8, 8, 8, 8, 65528, 8, 65528, 8, 8, 8, 8, 8, 65528, 10088, 8, 62904, 8, 8, 8, 11560, 8, 60056, 65528, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 26216, 8, 8, 8, 8, 8, 8, 8, 8, 43688, 13112, 8, 65528, 8, 8, 8, 65528, 8, 65528, 65528, 8, 65528, 8, 65528, 6552, 8, 42664, 65528, 8, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 53608, 8, 8, 49144, 61672, 8, 57336, 65528, 17480, 8, 8, 65528, 8, 8, 65528, 65528, 65528, 8, 8, 60056, 65528, 65528, 8, 65528, 65528, 8, 8, 65528, 8, 65528, 8, 8, 8, 8, 8, 65528, 8, 8, 32760, 8, 65528, 8, 65528, 8, 43688, 8, 65528, 65528, 58248, 65528, 8, 65528, 8, 8, 65528, 8, 32760, 1304, 8, 65528, 65528, 65528, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 9096, 58968, 65528, 8, 65528, 52424, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 30248, 8, 8, 8, 8, 8, 8, 8, 21848, 65528, 16376, 8, 8, 8, 23400, 46808, 20776, 10344, 65528, 65528, 8, 65528, 65528, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 65528, 8, 62904, 62664, 8, 8, 8, 8, 8, 8, 43688, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 65528, 65528, 8, 8, 65528, 65528, 8, 8, 8, 8, 26216, 8, 65528, 65528, 8, 8, 65528, 8, 54600, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 8, 28088, 8, 8, 50968, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 65528, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 43688, 8, 8, 8, 8, 8, 8, 16376, 58248, 61432, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 43688, 8, 8, 8, 8, 8, 8, 8, 8, 8, 32760, 8, 8, 65528, 16376, 8, 43688, 8, 46808, 65528, 21848, 648, 8, 8, 27304, 8, 8, 8, 65528, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 56168, 8, 8, 65528, 8, 13112, 8, 8, 8, 13112, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 43688, 8, 8, 8, 8, 8, 8, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 65528, 8, 8, 8, 44824, 8, 8, 65528, 65528, 65528, 8, 65528, 46808, 29784, 8, 65528, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 57336, 8, 8, 8, 65528, 8, 8, 65528, 8, 65528, 65528, 8, 8, 65528, 40200, 8, 8, 8, 8, 8, 8, 8, 23224, 8, 8, 8, 8, 65528, 8, 65528, 8, 8, 8, 8, 32760, 8, 32936, 17704, 62296, 8, 65528, 65528, 8, 65528, 8, 65528, 8, 8, 8, 8, 8, 8, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 16376, 21848, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 17112, 8, 8, 8904, 8, 65528, 65528, 29128, 11496, 29848, 45368, 31448, 8, 8, 16376, 65528, 1560, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 35736, 26216, 16856, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 47320, 8, 8, 15416, 8, 1288, 65528, 8, 8, 8, 8, 12824, 26216, 4152, 8, 8, 65528, 32760, 8, 8072, 8, 13688, 54600, 30312, 8, 45736, 8, 8, 8, 17864, 8, 8, 8, 65528, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 58248, 65528, 32760, 8, 8, 8, 32760, 8, 40952, 13656, 8184, 36408, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 65528, 8, 8, 49144, 43944, 65528, 58968, 65528, 8, 8, 2424, 37400, 20392, 39624, 27848, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 37448, 46520, 8, 44552, 8, 8, 17240, 40472, 46104, 55032, 13896, 65528, 65528, 8, 65528, 8, 8, 8, 8, 8, 56168, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 28728, 8, 38216, 8, 8, 8, 8, 5352, 11912, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 54600, 8, 8, 8, 8, 8, 65528, 49144, 65528, 8, 13896, 36728, 8, 44248, 60344, 36984, 40952, 14040, 61160, 46440, 14040, 65528, 65528, 65528, 8, 8, 32760, 8, 8, 65528, 65528, 8, 8, 8, 65528, 32760, 65528, 32760, 65528, 62952, 8, 8, 45480, 46808, 8, 31208, 7288, 28664, 15288, 4440, 61864, 62952, 22152, 59944, 65528, 43272, 8, 8, 65528, 9368, 65528, 8, 65528, 61160, 8, 8, 65528, 65528, 65528, 8, 8, 8, 65528, 8, 63256, 29912, 8, 50408, 32760, 8, 39320, 8184, 19656, 12840, 65528, 65528, 8, 8, 65528, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 28488, 8, 57336, 63848, 60056, 8, 8, 29128, 42024, 8, 65528, 65528, 65528, 8, 8, 65528, 59176, 8, 8, 65528, 8, 8, 8, 65528, 43688, 8, 8, 8, 8, 8, 8, 65528, 49704, 8, 65528, 65528, 65528, 8, 8, 65528, 43688, 65528, 65528, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 65528, 38712, 8, 60056, 8, 8, 8, 8, 60024, 65528, 42264, 50104, 65528, 8, 65528, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 65528, 8, 8, 8, 65528, 9976, 8, 45864, 65528, 8, 8, 8, 65528, 8, 8, 65528, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 45864, 8, 32760, 65528, 65528, 8, 8, 65528, 65528, 8, 8, 65528, 65528, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 38216, 55608, 8, 33704, 57336, 20696, 8, 37928, 58648, 64376, 34200, 65528, 65528, 14040, 8, 65528, 63528, 54216, 65528, 8, 22104, 36408, 32760, 21848, 43688, 65528, 8, 8, 65528, 8, 32760, 65528, 37448, 40792, 8, 29128, 65528, 65528, 8, 39320, 52808, 53704, 40536, 32760, 65528, 30792, 53960, 14248, 53960, 65528, 30584, 34488, 5960, 18344, 8120, 65528, 52424, 53608, 8, 8, 65528, 8, 8, 8, 32760, 32760, 8, 39080, 9368, 65528, 65528, 8, 22872, 9832, 63256, 65528, 65528, 52024, 8, 8, 65528, 39320, 8, 8, 8, 65528, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 61160, 39080, 8, 49144, 8, 8, 8, 8, 65288, 65528, 61224, 39320, 65528, 26216, 8, 8, 65528, 61432, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 18728, 43688, 8, 22680, 65528, 8, 65528, 8, 50760, 64088, 51432, 65528, 8, 8, 8, 8, 32760, 8, 65528, 43688, 13112, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 18728, 8, 26216, 8, 65528, 8, 65528, 8, 65528, 50968, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 56168, 65528, 65528, 8, 65528, 65528, 8, 8, 8, 8, 8, 10920, 28088, 8, 32440, 25896, 35928, 25208, 21848, 38248, 63144, 23736, 22632, 65528, 8, 16376, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 12600, 36264, 8, 32760, 16376, 43688, 21848, 8184, 57000, 11304, 35144, 59560, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8184, 8, 8, 8, 8, 8, 8, 8, 8, 8, 16536, 33864, 8, 36152, 24808, 26984, 41512, 8, 50360, 3832, 64872, 10680, 65528, 8, 8, 8, 60568, 53960, 808, 648, 8, 8, 8, 8, 8, 50344, 65528, 65528, 8, 8, 8, 8, 65528, 52424, 8, 16376, 8, 8, 8, 8, 65528, 59944, 33896, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 23224, 8, 8, 8, 65528, 8, 8184, 37448, 8, 32760, 21848, 65528, 26984, 8, 58264, 49928, 65528, 65528, 65528, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 3880, 57048, 8, 28088, 8, 65528, 65528, 8, 49144, 8, 49144, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 19416, 8, 38536, 65528, 65528, 8, 8, 36616, 8, 38248, 65528, 8, 21848, 8, 8, 2616, 8, 65528, 21848, 8, 8, 8, 8, 8, 8, 43688, 8, 8, 8, 8, 8, 42120, 60056, 8, 3848, 32760, 8, 8, 8, 50968, 65528, 2984, 8, 8, 8, 8, 8, 8, 65528, 8, 65528, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 65528, 43688, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 21848, 8, 8, 8, 65528, 65528, 28392, 29784, 40040, 64424, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 16376, 26216, 8, 43688, 8, 8, 21848, 43688, 65528, 43688, 16376, 65528, 8, 8, 8, 8, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 32616, 8, 8, 8, 8, 65528, 65528, 60696, 24568, 37640, 65528, 65528, 59736, 26216, 8, 24968, 32760, 8, 32760, 8, 8, 17480, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 21848, 8, 8, 8, 32760, 8, 61432, 8, 32760, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 46808, 8, 8, 8, 8, 8, 65528, 64120, 8, 8, 65528, 65528, 65528, 8, 65048, 57144, 8, 8, 8, 8, 8, 8, 65528, 32760, 65528, 8, 25640, 65528, 26744, 8, 65528, 8, 65528, 8, 65528, 12280, 59816, 50232, 65528, 61928, 49144, 8, 64024, 65528, 8, 8, 65528, 8, 8, 8, 65528, 65528, 65528, 8, 65528, 49464, 1800, 63336, 65528, 64280, 1096, 8, 1992, 51224, 392, 2728, 14440, 8, 27592, 8, 65528, 21848, 8, 8, 65528, 65528, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 65528, 65528, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 60056, 56168, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 65528, 63752, 8, 8, 65528, 8, 65528, 8, 65528, 65528, 8, 8, 8, 8, 8, 65528, 65528, 47656, 8, 8, 65528, 65528, 8, 8, 65528, 21848, 8, 8, 54600, 17032, 8, 5960, 36616, 63656, 3640, 8, 65528, 65528, 32760, 8, 65528, 36856, 58248, 60488, 65528, 65528, 8, 8, 65528, 65528, 8, 8, 31208, 8, 65528, 65528, 65528, 65528, 65528, 65528, 65528, 37448, 65528, 8, 65528, 19224, 1992, 65528, 65528, 38424, 64808, 8, 65528, 65528, 23128, 8, 65528, 46808, 8, 8, 65528, 65528, 8, 8, 65528, 26984, 8, 56168, 65528, 65528, 8, 8, 65528, 63000, 8, 8, 65528, 54600, 8, 8, 65528, 65528, 8, 65528, 65528, 65528, 8, 8, 65528, 24568, 8, 14888, 65528, 52424, 8, 8, 65528, 8, 8, 8, 65528, 55336, 8, 8, 8, 65528, 8, 39320, 65528, 8, 8, 8, 8, 65528, 8, 8, 65528, 49544, 8, 8, 8, 32760, 8, 65528, 65528, 63384, 8, 8, 65528, 57864, 8, 8, 65528, 63144, 8, 8, 65048, 45816, 8, 8, 61208, 59048, 13112, 8, 65528, 63368, 8, 8, 65528, 60840, 42120, 65528, 65032, 61048, 8, 8, 65528, 64360, 8, 8, 65528, 65528, 8, 8, 65528, 62536, 65528, 8, 65528, 38008, 65528, 8, 15144, 65528, 5144, 65528, 65528, 14648, 26248, 8, 65528, 62120, 21848, 8, 65528, 62664, 8, 8, 65528, 65528, 8, 8, 65528, 64152, 8, 8, 65528, 62040, 8, 8, 65528, 59672, 8, 16376, 65528, 65528, 8, 8, 65528, 65528, 8, 65528, 65528, 65528, 8, 8, 65528, 32760, 8, 8, 65528, 65528, 8, 8, 65528, 39320, 65528, 30024, 65528, 65528, 8, 8, 65528, 46808, 8, 8, 65528, 54600, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 21848, 26216, 8, 8, 8, 8, 8, 8, 8, 8, 8, 1528, 8, 65528, 4680, 24568, 65528, 18424, 8, 8, 8, 8, 8, 8, 7912, 63032, 58248, 8, 65528, 43032, 63656, 34488, 49544, 38776, 6488, 8, 65528, 6552, 8, 8, 65528, 59176, 8, 65528, 8, 50536, 65528, 64376, 8, 8, 65528, 8, 60056, 19944, 32760, 65528, 8, 19944, 8, 8, 8, 50968, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 13112, 8, 8, 8, 43688, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 46808, 8, 8, 8, 8, 8, 8, 8, 36856, 13112, 65528, 43688, 16728, 4680, 8, 8, 8, 8, 8, 8, 8, 8, 1960, 8, 59432, 13304, 10648, 60344, 23144, 3256, 8, 65528, 8, 65528, 8, 24504, 60552, 65528, 65528, 63256, 39320, 8, 26984, 43688, 39320, 65528, 8, 63000, 13800, 49144, 30248, 65528, 65528, 65528, 65528, 32760, 40552, 53608, 65528, 65528, 4728, 5160, 8, 20088, 5304, 42264, 57848, 65528, 26424, 8, 8, 8, 8, 8, 30248, 39320, 59560, 20168, 8, 8, 26216, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 54600, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 28088, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 21848, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 52424, 65528, 8, 65528, 8, 8, 8, 8, 32760, 49272, 8, 8, 8, 8, 8, 8, 58248, 13800, 2088, 65528, 21848, 8, 65528, 8, 8, 65528, 8, 16376, 39320, 39320, 65528, 8, 65528, 65528, 8, 65528, 21848, 8, 8, 13512, 23832, 8584, 8, 65528, 58440, 8, 65528, 8, 65528, 488, 65528, 65528, 8, 64120, 8, 8, 54328, 8, 65528, 8, 9368, 8, 8, 8, 8, 65528, 8, 65528, 8, 65528, 8, 8, 8, 26568, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 16856, 65528, 3448, 8, 8, 8, 8, 8, 8, 39320, 61672, 43688, 8, 7288, 63480, 16376, 8, 65528, 15128, 3272, 8, 8, 8, 8, 8, 65528, 65528, 8, 65528, 8, 65528, 65528, 23000, 32760, 19272, 8, 8, 5464, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 30840, 6904, 32760, 32760, 27880, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 21848, 8, 8, 8, 8, 8, 8, 8, 8, 40952, 8, 8, 65528, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8184, 1048, 54600, 8, 8, 8, 8, 8, 8, 8, 4680, 61672, 43688, 8, 8, 65528, 65528, 8, 8, 19656, 8, 65528, 65528, 8, 8, 8, 65528, 65528, 8, 65528, 65528, 65528, 8, 64872, 8, 65528, 65528, 8, 36408, 8, 8, 8, 8, 32760, 8, 8, 8, 8, 8, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 58248, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 14568, 8, 8, 8, 8, 8, 65528, 52424, 8, 8, 65528, 32760, 43688, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 65528, 21848, 65528, 8, 30024, 56792, 7560, 2920, 65528, 8, 8, 8, 8, 36408, 54600, 59560, 65528, 43688, 65528, 8, 65528, 60488, 8, 8, 8, 8, 8, 8, 65528, 65528, 65528, 8, 65528, 29016, 2936, 10168, 64504, 65528, 14888, 2760, 32760, 58248, 8, 8, 65528, 3192, 18200, 8, 8, 8, 21848, 65528, 65528, 45576, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 65528, 8, 65528, 8, 39320, 8, 65528, 8, 8, 8, 8, 8, 65528, 8, 65528, 8, 8, 8, 65528, 21848, 8, 65528, 65528, 65528, 8, 8, 65528, 65528, 8, 8, 8, 65528, 65528, 65528, 65528, 52424, 26216, 8, 54600, 8, 8, 8, 8, 8, 8, 8, 8, 8, 39320, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 49144, 16376, 59384, 65528, 8, 21848, 8, 8, 8, 8, 8, 65528, 52424, 65528, 65528, 8, 65528, 65528, 8, 65528, 8, 8, 65528, 8, 8, 8, 8, 8, 65528, 8, 65528, 65528, 65528, 65528, 8, 65528, 65528, 52424, 65528, 65528, 8, 8, 65528, 8, 39320, 8, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 39320, 8, 8, 8, 65528, 8, 8, 8, 58248, 65528, 65528, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 57336, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 65528, 42488, 8, 8, 8, 52424, 8, 8, 48056, 17240, 8, 8, 56888, 63736, 16376, 15128, 8, 52424, 8, 8, 8, 43688, 60488, 65528, 65528, 32760, 65528, 8, 43688, 65528, 43688, 65528, 65528, 8, 8, 8, 65528, 65528, 65528, 8, 65528, 14040, 64376, 51480, 65528, 65528, 32760, 8, 65528, 64520, 5960, 8, 65528, 65528, 61160, 8, 65528, 65528, 65528, 8, 8, 47656, 65528, 7704, 65528, 65528, 8, 8, 65528, 54600, 8, 8, 65528, 65528, 63640, 65528, 65528, 65528, 8, 65528, 8, 8, 8, 8, 65528, 65528, 8, 8, 8, 8, 32760, 65528, 8, 65528, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 58968, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 17864, 8, 60536, 49144, 24968, 65528, 24344, 2424, 8, 32760, 8, 8, 8, 1592, 65528, 65528, 65528, 6552, 43432, 24136, 39880, 65528, 56168, 16760, 8, 65528, 32760, 8, 8, 65528, 60840, 65528, 65528, 8, 54856, 48616, 65528, 65528, 4216, 63560, 8, 65528, 33352, 19848, 65528, 8, 10920, 8, 65528, 8, 60488, 65528, 44184, 65528, 32120, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 60008, 65528, 28088, 64744, 48312, 55640, 8, 8, 8, 8, 8, 8, 8, 8, 63656, 8, 62216, 65528, 61976, 65528, 62952, 1656, 65528, 8, 65528, 8, 65528, 8, 65528, 8, 65528, 8, 54600, 65528, 8, 65528, 3640, 13112, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 56968, 65528, 8, 56792, 37448, 8, 65528, 8, 9368, 8, 8, 8, 8, 8, 16376, 8, 56904, 65528, 10632, 65528, 360, 14328, 8, 8, 8, 8, 8, 8, 57336, 8, 8, 65528, 58248, 65528, 8, 65528, 40952, 8, 8, 65528, 8, 8, 8, 65528, 65528, 65528, 65528, 8, 64504, 65528, 65528, 65528, 45368, 64760, 18264, 65528, 6936, 8, 40664, 8, 65528, 8, 8, 8, 56408, 65528, 64392, 65528, 52856, 8, 49640, 8, 45608, 8, 60200, 8, 65528, 8, 32760, 8, 53528, 65528, 65528, 65528, 21848, 8, 47320, 8, 65528, 8, 60376, 8, 63224, 8, 49704, 8, 52424, 65528, 56296, 65528, 54600, 7288, 59016, 8, 39320, 8, 8, 8, 9368, 8, 65528, 8, 59816, 65528, 65528, 65528, 18200, 6552, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 61672, 65528, 8, 62664, 21848, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 1832, 63000, 14984, 5720, 65528, 8, 8, 8, 8, 7752, 54856, 52920, 61160, 55448, 53880, 39320, 16376, 65528, 1048, 35096, 8, 65528, 8, 65528, 32760, 65528, 60168, 65528, 65528, 64840, 26056, 63928, 64024, 65528, 10920, 25640, 6184, 63560, 5256, 6392, 65528, 65528, 8184, 8, 8, 8, 62584, 65528, 8, 65528, 63000, 21496, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 65528, 8, 13112, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 936, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 65528, 62408, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 21848, 65528, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 16376, 8, 8, 3272, 43000, 65528, 16376, 1688, 8, 8, 8, 8, 8, 37448, 37448, 65528, 8, 8, 65528, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 8, 9080, 296, 8, 65528, 17576, 312, 8, 1336, 62440, 8, 8, 8, 10920, 8, 8, 8, 65528, 8, 8, 65528, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 64808, 65528, 65528, 32760, 21848, 38824, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 10920, 8, 8, 8, 8552, 65528, 19112, 7496, 8, 8, 8, 8, 8, 6968, 65528, 46808, 65528, 8, 65528, 8, 21848, 8, 8, 65528, 15128, 65528, 8, 65528, 8, 65528, 65528, 8, 65528, 8, 62216, 8, 18728, 8, 776, 65528, 8, 26216, 3080, 8, 28088, 8, 28088, 8, 8, 8, 8, 8, 29128, 8, 8, 8, 8, 8, 8, 8, 8, 8, 43688, 8, 18728, 8, 40952, 8, 8, 8, 8, 8, 8, 8, 32760, 8, 37032, 8, 35288, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 16376, 8, 65528, 58520, 8, 8, 65528, 65528, 8, 8, 65192, 48424, 8, 8, 65528, 8, 8, 8, 65528, 50968, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 21848, 8, 65528, 65528, 65432, 8, 8, 65528, 64584, 29128, 8, 65528, 37448, 8, 8, 65528, 52424, 49144, 8, 65528, 60712, 8, 8, 65528, 54600, 32760, 8, 42328, 65528, 57768, 8, 65528, 65528, 8, 8, 56168, 8, 8, 8, 38216, 8, 8, 8, 30248, 8, 8, 8, 53384, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 24760, 8, 8, 8, 65528, 8, 8, 8, 48424, 8, 12744, 8, 63960, 58968, 17704, 8, 65528, 65528, 14568, 8, 21848, 65528, 8, 8, 65528, 58168, 49144, 8, 65528, 8, 65528, 8, 65528, 58504, 8, 8, 65528, 65528, 36312, 22200, 8, 61432, 8, 8, 8, 65528, 8, 8, 8, 62072, 8, 8, 88, 13112, 8, 2616, 6856, 65528, 15240, 520, 8, 65528, 8, 8, 8, 4520, 56264, 56792, 65528, 57688, 23592, 4376, 15416, 32760, 13112, 32760, 4088, 65528, 8, 65528, 8, 65528, 65528, 65528, 65528, 58760, 64104, 63480, 65528, 52424, 21368, 12056, 8, 29928, 3304, 8, 65528, 65528, 16984, 8, 8, 44104, 8, 19512, 8, 8, 8, 8, 8, 23400, 8, 65528, 8, 59288, 8, 8, 8, 56168, 8, 8, 8, 65528, 8, 8, 8, 43688, 8, 8, 8, 65528, 8, 8, 65528, 9368, 8, 21848, 65528, 65528, 8, 8, 8, 65528, 65528, 8, 65528, 53048, 8, 8, 65528, 55448, 16728, 11384, 65528, 39320, 8, 8, 8, 32760, 8, 8, 8, 63944, 8, 8, 8, 8, 8, 8, 56168, 64920, 8, 8, 8, 65528, 8, 8, 65528, 65464, 8, 8, 55496, 56328, 8, 8, 40440, 64264, 1160, 8, 8, 65528, 8, 8, 65176, 59128, 61160, 61432, 65528, 64488, 16760, 8, 16376, 65528, 1816, 38136, 8, 53240, 2856, 65528, 16376, 65528, 63880, 65528, 65528, 65528, 65528, 8, 31480, 65528, 21848, 65528, 1720, 65528, 2568, 65528, 52424, 64680, 55080, 8, 65528, 64744, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 65528, 65256, 8, 8, 65528, 51576, 8, 43688, 65528, 65528, 8, 8, 65528, 65528, 8, 39320, 8, 65528, 8, 8, 65528, 65528, 8, 8, 65528, 65528, 8, 8, 8, 21848, 32760, 17864, 65528, 65528, 8, 8, 65528, 57816, 8, 8, 65528, 61160, 8, 8, 8, 32760, 8, 43688, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 4680, 8, 8, 1768, 11480, 58616, 7288, 200, 8, 8, 8, 8, 8, 9000, 58760, 51144, 65528, 50632, 59288, 8, 36408, 32760, 57816, 23592, 8, 41304, 16696, 28248, 32760, 62904, 64776, 8, 65528, 63800, 65528, 8, 41160, 8, 21848, 64952, 8, 3672, 51848, 65528, 65528, 8, 15128, 8, 8, 8, 8, 8, 6776, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 38904, 8, 21176, 8, 13112, 8, 9560, 8, 60008, 8, 43688, 8, 65528, 8, 43688, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 49640, 8, 63112, 8, 8, 8, 51112, 8, 8, 8, 43688, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 43688, 7288, 8, 8, 8, 65528, 8, 52424, 52424, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 65528, 65528, 8, 65528, 40328, 60728, 49144, 65528, 8, 46040, 3976, 3336, 47736, 2008, 8, 8, 8, 8, 8, 8, 32760, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 65528, 8, 32760, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 60424, 8, 29128, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 26984, 8, 8, 8, 8, 8, 10088, 8, 8, 21848, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 32760, 65528, 8, 65528, 8, 8, 8, 8, 65528, 8, 11912, 65528, 42120, 8, 65528, 8, 65528, 65528, 21848, 65528, 8, 65528, 8, 8, 65528, 8, 65528, 8, 8, 8, 8, 21848, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 18872, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 24968, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 27304, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 456, 8, 8, 8, 14408, 65528, 13112, 8, 8, 21848, 8, 8, 8, 20168, 65528, 65528, 8, 32760, 8, 8, 65528, 8, 8, 8, 8, 65528, 65528, 8, 32760, 65528, 65528, 8, 65528, 65528, 65528, 65528, 25000, 8, 8, 1224, 8, 43688, 8, 65528, 65528, 8, 16376, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 56168, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8184, 65528, 30248, 8, 8, 8, 8, 8, 8, 5960, 65528, 8, 8, 65528, 65528, 65528, 8, 8, 8, 65528, 42120, 65528, 8, 12280, 8, 65528, 8, 8, 8, 65528, 65528, 8, 63400, 8, 65528, 8, 8, 8, 8, 8, 65528, 8, 32760, 8, 8, 8, 8, 8, 11912, 8, 32760, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 14040, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 26216, 8, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 21848, 8, 65528, 8, 8, 8, 65528, 52424, 8, 8, 65528, 8, 8, 8, 65528, 32760, 8, 8, 65528, 8, 8, 8, 18728, 8, 8, 8, 9752, 8, 8, 1688, 65528, 8, 8, 8, 8, 5048, 65528, 65528, 65528, 48360, 65528, 8, 65528, 65528, 8, 8, 32760, 8, 8, 8, 65528, 52424, 65528, 8, 65528, 54504, 18728, 65528, 65528, 65528, 60840, 8, 31128, 64824, 65528, 8, 51480, 48056, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 65528, 65528, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 65528, 8, 65528, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 58968, 65528, 8, 8, 65528, 65528, 8, 8, 65528, 65528, 8, 8, 65528, 57176, 65528, 8, 42120, 8, 8, 8, 65528, 58248, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 65528, 65528, 8, 8, 8, 65528, 8, 8, 8, 43688, 65528, 8, 21848, 65528, 32760, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 65528, 65528, 8, 65528, 49144, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 55816, 8, 8, 65528, 39320, 8, 8, 65528, 37448, 8, 8, 65528, 16376, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 8, 65528, 8, 8, 65528, 65528, 8, 8, 65528, 61176, 8, 8, 56424, 25208, 65528, 8, 65224, 65528, 8, 8, 65528, 62072, 8, 8, 8, 32760, 32760, 8, 61880, 64776, 8, 49144, 21848, 58968, 8, 32760, 65528, 65528, 8, 65528, 65528, 62744, 36408, 8664, 62136, 56376, 12488, 15128, 65240, 34712, 3000, 6504, 32760, 64744, 65528, 8, 65528, 55112, 8, 8, 8, 65528, 8, 8, 65528, 58376, 8, 8, 63480, 58168, 8, 8, 65528, 65528, 8, 8, 65528, 65528, 8, 8, 8, 65528, 8, 8, 65528, 59384, 8, 8, 65528, 25208, 8, 8, 65528, 65528, 8, 8, 65528, 8, 8, 8, 65528, 65528, 8, 8, 8, 65528, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 43688, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 32760, 65528, 8, 8, 65528, 8, 8, 65528, 26216, 26216, 16376, 21848, 65528, 65528, 32760, 8, 16376, 32760, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 32760, 8, 21848, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 40952, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 57640, 8, 8, 32760, 8, 8, 8, 8, 8, 54072, 8, 8, 8, 8, 8, 8, 8, 65528, 43688, 8, 32760, 8, 65528, 8, 65528, 65528, 43688, 65528, 43688, 60056, 60200, 8, 61432, 8, 8, 37448, 16376, 1704, 4088, 18024, 65528, 8, 63976, 8, 8, 8, 65528, 8, 65528, 8, 65528, 8, 65528, 8, 53960, 8, 65528, 8, 65528, 8, 65528, 8, 61672, 8, 13112, 8, 13112, 8, 65528, 8, 65528, 8, 65528, 8, 65528, 8, 65528, 8, 65528, 8, 65528, 8, 65528, 8, 60200, 8, 65528, 8, 65528, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 58248, 8, 8, 65528, 8, 8, 8, 65528, 21848, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 61672, 21848, 8, 65528, 62408, 8, 65528, 8, 65528, 8, 8, 65528, 65528, 8, 8, 65528, 59976, 8, 8, 65528, 21848, 8, 8, 65528, 65528, 8, 8, 65528, 65528, 8, 8, 65528, 58968, 8, 8, 65528, 8, 8, 8, 65528, 65528, 8, 8, 65528, 8, 8, 8, 65528, 21848, 8, 8, 65528, 8, 8, 8, 65528, 65528, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 65528, 65528, 8, 8, 65528, 64872, 8, 8, 8, 65528, 8, 8, 65528, 54216, 8, 8, 65528, 8, 8, 8, 65528, 43688, 8, 8, 8, 8, 32760, 20168, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 21848, 65528, 57336, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 51864, 8, 21128, 8, 65528, 8, 8, 8, 18200, 65528, 54600, 8, 8, 8, 65528, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 26216, 8, 32760, 8, 65528, 8, 8, 8, 21848, 8, 27480, 8, 8, 8, 8, 8, 26216, 65528, 43688, 65528, 65528, 8, 8, 8, 56168, 8, 48536, 65528, 34328, 8, 8, 8, 56168, 8, 65528, 8, 8, 8, 8, 8, 32760, 8, 8, 65528, 65528, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 65528, 65528, 8, 8, 65528, 62280, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 32760, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 65528, 65064, 8, 8, 8, 8, 8, 8, 65528, 64952, 8, 8, 65528, 56168, 8, 8, 65528, 60968, 8, 35736, 65528, 65528, 8, 8, 8, 8, 8, 37448, 8, 8, 8, 8, 65528, 43688, 8, 8, 8, 65528, 8, 8, 8, 29784, 8, 12600, 8, 8, 8, 8, 65528, 65528, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 43688, 8, 8, 8, 32760, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 29784, 19016, 32760, 65528, 30424, 16376, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 32760, 64024, 15816, 60664, 28808, 7864, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 65528, 8, 40040, 56168, 8, 8, 8, 32760, 8, 8, 65528, 8, 8, 8, 8, 8, 48600, 8, 44872, 8, 8, 8, 2264, 8, 62088, 8, 49144, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 61288, 65528, 65528, 8, 21848, 8, 51368, 8, 24568, 8, 56904, 8, 65528, 8, 39320, 50968, 32760, 48056, 17320, 2472, 10088, 8, 39320, 65528, 65528, 8, 8, 8, 8, 8, 50104, 65528, 8, 65528, 52424, 61160, 8, 65528, 65528, 19416, 8, 65528, 8, 8, 8, 8, 65528, 65528, 8, 8, 65528, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 4680, 8, 8, 53608, 8, 8, 8, 5704, 8, 8, 8, 8, 8, 8, 8, 7288, 8, 64360, 37448, 60008, 8, 58744, 8, 8, 8, 57336, 8, 64072, 8, 8, 8, 64424, 10920, 65528, 65528, 30136, 8, 58648, 8, 63736, 43688, 58536, 8, 8, 8, 49848, 8, 65528, 8, 30776, 43688, 59144, 13592, 63240, 32760, 65528, 65528, 64152, 8, 65528, 8, 44824, 8, 10824, 49144, 8, 65528, 8184, 8, 65528, 8, 35384, 8, 8, 8, 8, 8, 8, 8, 49144, 65528, 8, 65528, 8, 65528, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 56168, 22936, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 39320, 26216, 8, 65528, 8, 8, 8, 6552, 8, 8, 8, 8, 8, 8, 8, 8, 52424, 28088, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 56792, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 65528, 21848, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 16376, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 12328, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 22376, 23592, 5176, 8, 49144, 9368, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 20968, 54792, 32760, 65528, 20472, 13448, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 54600, 8, 8, 8, 8, 8, 16376, 8, 32760, 8, 8, 8, 8, 8, 8, 37448, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 21848, 16376, 4376, 65528, 44936, 39032, 18280, 23832, 33992, 39864, 51144, 2040, 8, 8, 54600, 65528, 8, 10920, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 3272, 40952, 32760, 32760, 8, 65528, 49144, 39320, 45048, 8, 8, 8, 65528, 65528, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 43688, 65528, 15128, 23096, 30840, 48504, 65528, 8, 65528, 50968, 20600, 40152, 27800, 65528, 47176, 8, 42952, 65528, 8, 65528, 8, 7016, 62856, 8, 65528, 8, 65528, 8, 26216, 8, 8, 8, 32760, 65528, 8, 32760, 65528, 32760, 65528, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 65528, 65528, 43688, 8, 57336, 8, 65528, 8, 47496, 8, 32760, 8, 42392, 8, 8, 49144, 65528, 65528, 63992, 8, 32760, 19656, 65528, 65528, 8, 65528, 65528, 8, 8, 65528, 65528, 8, 65528, 65528, 65528, 8, 8184, 8, 65528, 65528, 8, 8, 65528, 8, 8, 8, 65528, 54600, 65528, 65528, 65528, 52648, 8, 8, 8, 65528, 65528, 8, 8, 8, 65528, 8, 65528, 56440, 65528, 65528, 65528, 65528, 49432, 8, 65528, 65528, 9512, 8, 65528, 8, 65528, 8, 65528, 65528, 57656, 65528, 32520, 488, 8, 8, 49704, 28664, 55368, 9368, 44776, 40072, 48264, 8, 65528, 8, 65528, 65528, 60200, 8, 49480, 8, 65528, 8, 65528, 8, 65528, 65528, 65528, 8, 65528, 8, 65528, 65528, 61880, 8, 48056, 8, 57816, 58616, 65528, 8, 65528, 65528, 8, 8, 65528, 8, 32760, 65528, 65528, 46808, 8, 8, 65528, 32760, 35736, 8, 65528, 65528, 8, 8, 8, 8, 39320, 65528, 1176, 1384, 6776, 50968, 17864, 11560, 26216, 7288, 37768, 40648, 51736, 8, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 52424, 36104, 8, 14136, 8, 8, 8, 39320, 49144, 26216, 19272, 20024, 8, 8, 54600, 65528, 8, 65528, 8, 2120, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 32760, 8, 59704, 21848, 8, 65528, 8, 65528, 65528, 65528, 8, 8, 8, 8, 65528, 65528, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 2520, 8, 65528, 8, 8, 8, 8, 65528, 32760, 65528, 65528, 8, 8, 65528, 65528, 65528, 42120, 59560, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 10344, 32760, 8, 8, 52424, 8, 43688, 32760, 41688, 22632, 14008, 8, 8, 8, 65528, 65528, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 43688, 60488, 8, 32760, 8, 65528, 8, 65528, 65528, 65528, 54600, 8, 8, 8, 12280, 8, 8, 65528, 15816, 3128, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 42312, 65528, 8, 64264, 26216, 11912, 8, 8, 8, 65528, 38024, 45096, 13272, 8, 65528, 8, 50968, 65528, 8, 65528, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 37448, 32760, 65528, 8, 8, 8, 8, 65528, 13112, 65528, 8, 8, 65528, 65528, 65528, 63656, 65528, 45864, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 32760, 8, 8, 38536, 51480, 21848, 52424, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 62584, 65528, 8, 65528, 16248, 8184, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 64344, 65528, 30584, 52424, 9736, 43688, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 64456, 65528, 65528, 43688, 55592, 16376, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 60856, 65528, 37448, 42392, 25128, 15128, 8, 8, 8, 8, 8, 8, 8, 8, 39000, 8, 53016, 65528, 38456, 53896, 39176, 13656, 62424, 8, 26216, 8, 65528, 8, 8, 8, 8, 8, 58040, 55128, 13112, 57336, 47528, 936, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 60728, 65528, 28088, 8, 23528, 5960, 65528, 8, 45512, 8, 65528, 8, 60840, 8, 65528, 8, 65528, 65528, 8, 65528, 10088, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 61208, 65528, 8, 65528, 17992, 5128, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 13112, 43688, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 65528, 30936, 8, 8, 8, 7288, 8, 8, 8, 8, 8, 8, 8, 58760, 65528, 49144, 26344, 27832, 55288, 8, 8, 27096, 8, 8, 8, 8, 8, 32136, 8, 65528, 65528, 8, 8, 35048, 8, 65528, 8, 65528, 8, 8, 8, 65352, 8, 8, 8, 58040, 65528, 64680, 62664, 51624, 12904, 59448, 8, 65528, 8, 32760, 8, 8, 8, 8, 8, 61880, 65528, 8, 65528, 8472, 4232, 65528, 8, 28088, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 65528, 21192, 5176, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 62248, 65528, 8, 65528, 6088, 51480, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 61112, 65528, 8, 65528, 4952, 9640, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 63048, 65528, 25928, 31992, 54856, 44824, 8, 8, 8, 10920, 57816, 16376, 40952, 8, 8, 8, 59672, 43688, 8, 65528, 4392, 5960, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 21848, 29368, 8, 8, 8, 8, 8, 39320, 24568, 20840, 8, 8, 8, 64344, 65528, 8, 65528, 44824, 21848, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 52424, 24968, 8, 61432, 13112, 65528, 8, 8, 8, 8, 45864, 43688, 31032, 8, 8, 8, 61784, 65528, 8, 8, 8, 43688, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 6184, 20472, 3128, 61432, 32760, 32760, 43688, 9368, 48984, 46808, 53672, 8, 8, 8, 32760, 8, 8, 65528, 7288, 38536, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 30504, 6136, 29784, 58696, 27544, 19192, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 65528, 8, 52424, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 32760, 43688, 49144, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 32760, 8, 43688, 8, 8, 8, 8, 8, 10088, 9368, 32760, 32760, 55880, 6552, 9368, 8, 31208, 18072, 3848, 53608, 40952, 22680, 21848, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 65528, 32760, 8, 8, 8, 65528, 16376, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 25928, 8, 8, 8, 4648, 65528, 8, 8, 21848, 8, 8, 32760, 1288, 65528, 8, 8, 53224, 8, 25208, 8, 16376, 8, 5464, 8, 59560, 65528, 23400, 65528, 63800, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 32760, 8, 8, 11912, 58248, 8, 65528, 8, 8, 8, 8, 45416, 8, 54120, 8, 52424, 8, 42296, 8, 8, 8, 42840, 8, 65528, 62408, 8, 8, 65528, 65528, 65528, 8, 43176, 61288, 40152, 6968, 45864, 8, 65528, 4600, 46808, 8, 49144, 65528, 8, 45864, 55448, 6136, 59336, 50408, 21848, 40472, 23064, 4680, 51480, 8, 65528, 63880, 8, 8, 64280, 63944, 65528, 8, 65528, 8, 32760, 8, 65528, 65528, 60840, 8, 58616, 62328, 8, 8, 65528, 65528, 59560, 8, 65528, 63896, 14328, 8, 65528, 65528, 8, 8, 65528, 8, 63704, 8, 65528, 8, 8, 8, 43688, 65528, 54712, 65528, 52424, 65528, 7288, 8, 65528, 8, 65528, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 63672, 8, 65528, 8, 8, 8, 65528, 8, 32760, 8, 64008, 61288, 65528, 8, 65528, 65528, 65528, 8, 65528, 65528, 23192, 8, 64312, 58536, 8, 8, 62664, 32760, 15816, 8, 54600, 54600, 8, 8, 8, 32760, 8, 35288, 8, 62792, 8, 65528, 65528, 65528, 65528, 65528, 32760, 65528, 8, 8, 8, 41496, 8, 65528, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 32760, 8, 8, 8, 29480, 8, 8, 8, 52424, 8, 8, 65528, 8, 8, 8, 8, 65528, 65528, 8, 8, 9368, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 30712, 26216, 22120, 8, 65528, 8, 65528, 8, 23400, 65528, 43688, 65528, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 16376, 8, 32760, 8, 65528, 8, 8, 8, 8, 8, 13448, 8, 8, 8, 8, 8, 65528, 8, 39320, 65528, 62072, 8, 65528, 8, 53608, 8, 27368, 65528, 60056, 8, 8, 8, 52424, 8, 8, 8, 43688, 8, 8, 8, 8, 8, 8, 65528, 65256, 8, 8, 65528, 65528, 8, 8, 65528, 55352, 8, 8, 65528, 52920, 8, 8, 65528, 64648, 8, 8, 8, 56792, 8, 8, 65528, 64712, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 5464, 54600, 8, 8, 65528, 29480, 8, 8, 65528, 65528, 8, 8, 65528, 37080, 8, 8, 65528, 65064, 8, 8, 65528, 65528, 8, 8, 8, 13112, 8, 8, 59560, 65176, 8, 43688, 57208, 55384, 65528, 65528, 65528, 44344, 32760, 19848, 65528, 65528, 8, 8, 8, 65528, 8, 9368, 8, 8, 8, 8, 8, 65528, 8, 8, 61000, 42536, 8, 8, 8, 43688, 9368, 12792, 14568, 65528, 8, 8, 65528, 63704, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 16376, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 61080, 13112, 712, 49144, 13112, 8, 8, 60488, 8, 65528, 65528, 29128, 8, 49144, 53960, 8, 24136, 11368, 17480, 37448, 61976, 3336, 43688, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 57896, 8, 4680, 8, 14296, 8, 8, 8, 32760, 52424, 3976, 9464, 8, 8, 64808, 65528, 42968, 8, 37176, 8, 49144, 8, 10568, 8, 57864, 21848, 14408, 48424, 65112, 14040, 64936, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 65528, 8, 8, 8, 61880, 8, 8, 8, 8, 8, 41864, 8, 64776, 8, 27592, 8, 46248, 8, 8, 8, 53608, 8, 8, 8, 65528, 8, 65528, 8, 65528, 8, 50728, 8, 61704, 65528, 58248, 65528, 28088, 8, 65528, 8, 65528, 8, 65528, 8, 65528, 19656, 65528, 21848, 65528, 21848, 65528, 8, 65528, 8, 65528, 8, 8, 8, 65528, 65528, 65528, 8, 65528, 8, 65528, 8, 65528, 65528, 65528, 8, 45864, 8, 21848, 8, 8, 8, 48072, 8, 8, 8, 13832, 8, 8, 8, 65528, 8, 8, 8, 62648, 8, 65528, 8, 59512, 8, 19816, 21848, 34056, 7912, 59208, 8, 65528, 8, 8, 8, 65528, 8, 62664, 8, 8, 8, 52120, 19656, 57464, 32760, 62680, 8, 65000, 32760, 56568, 8, 55544, 8, 40008, 8, 57336, 8, 53448, 13112, 65528, 8, 59496, 8, 7704, 8, 59448, 8, 38776, 8, 8, 8, 65528, 8, 63800, 8, 28424, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 45576, 43688, 8, 65528, 8744, 8, 8, 8, 43688, 19656, 32760, 27304, 65528, 8, 50968, 65528, 13832, 23528, 9368, 36648, 44936, 10792, 21848, 8, 8, 8, 8, 8, 8, 43688, 8, 8, 8, 3128, 8, 8, 8, 65528, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 6552, 5960, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 5048, 65528, 24568, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 16856, 29128, 24568, 32760, 8, 8, 8, 8, 24568, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 65528, 536, 8, 36408, 8, 8, 32760, 8, 49144, 58968, 41384, 8, 31448, 8, 60056, 8, 65528, 6552, 65528, 8, 8, 65528, 48136, 26808, 4520, 35832, 44328, 5896, 8, 8, 8, 26216, 8, 8, 36408, 32184, 8, 49144, 8, 8, 8, 65528, 8, 8, 8, 52424, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 32760, 8, 57336, 16376, 8, 65528, 65528, 32760, 65528, 8, 8, 8, 8, 8, 65528, 8, 8, 49144, 8, 35160, 65528, 8, 8, 8, 8, 8, 8, 53608, 8, 8, 8, 8, 8, 8, 8, 56168, 34600, 26440, 22808, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 14568, 29784, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 21848, 8, 8, 8, 47656, 8, 65528, 56168, 65528, 8, 10920, 33864, 60104, 9064, 4376, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8744, 48056, 8, 65528, 8, 65528, 6552, 8, 14328, 21288, 59816, 21848, 40920, 8, 23016, 8, 8, 8, 3848, 8, 63048, 8, 50968, 8, 65528, 8, 8, 8, 8, 8, 8184, 8, 43688, 49144, 8, 21848, 8, 8, 8, 21848, 17048, 58648, 59864, 65528, 8, 8, 8, 8, 52424, 8, 65528, 8, 65528, 8, 41928, 8, 21848, 8, 54600, 8, 65528, 57336, 8, 8, 17160, 10920, 8, 28904, 45576, 32760, 58248, 10088, 52712, 51336, 35096, 65528, 32760, 8, 8, 8, 8, 8, 8, 8, 65528, 32760, 65528, 8, 8, 8, 8, 8, 65528, 60776, 8, 8, 49144, 34568, 8, 30328, 37064, 32760, 15816, 21848, 36568, 65528, 23480, 1560, 65528, 63400, 8, 8, 65528, 65528, 41928, 8, 63000, 54616, 4792, 8, 65528, 65528, 8, 8, 65528, 8, 63320, 8, 8, 10088, 8, 52424, 52424, 8, 47048, 26216, 54728, 33768, 3448, 2984, 65528, 8, 65528, 8, 65528, 8, 8, 8, 65528, 65528, 8, 8, 27064, 8, 64552, 8, 65528, 8, 8, 8, 9992, 14888, 65528, 41144, 25640, 58808, 65416, 32760, 65528, 44456, 48936, 65528, 5320, 65528, 25208, 8, 61784, 52168, 8, 8, 65528, 8, 18728, 8, 65528, 63752, 8, 8, 8, 8, 8, 8, 8, 57336, 8, 65528, 8, 65528, 8, 13112, 21736, 52424, 20472, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 60056, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 32760, 61880, 8, 43688, 8, 8, 8, 8, 64744, 65528, 16024, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 24568, 8, 65528, 65528, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 32760, 8, 8, 8, 8, 8, 8, 65528, 64952, 8, 65528, 8, 65528, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 65528, 56168, 8, 8, 8, 8, 8, 8, 65528, 63384, 8, 8, 8, 8, 32760, 8, 61624, 62792, 65528, 8, 8, 8, 8, 8, 64840, 60024, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 65528, 56040, 8, 8, 8, 64872, 8, 8, 8, 8, 8, 8, 18856, 44120, 52424, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 59944, 8, 65528, 8, 65528, 8, 4376, 57576, 41144, 50408, 65528, 65528, 59880, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 9368, 52424, 8, 39320, 8, 65528, 65528, 8, 54104, 36664, 14072, 8, 65528, 65528, 8, 8, 65528, 61432, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 49144, 43688, 8, 32760, 8, 8, 8, 8, 14360, 62168, 22664, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 61512, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 5336, 50408, 8, 65528, 8, 8, 8, 8, 59960, 57576, 65528, 65528, 49304, 8, 32760, 8, 8, 8, 32760, 8, 56376, 8, 65528, 8, 65528, 8, 65528, 8, 8, 8, 8, 8, 65528, 55288, 65528, 41688, 8, 8, 8, 21848, 52696, 36696, 51224, 65528, 8, 8, 8, 8, 45864, 8, 65528, 8, 65528, 8, 39320, 8, 8, 8, 52424, 8, 8, 8, 65528, 8, 20744, 37016, 65528, 47736, 44024, 57784, 40376, 13560, 37752, 29800, 6344, 15624, 8, 21848, 8, 8, 8, 8, 65528, 5960, 30584, 58104, 15128, 53608, 63096, 26984, 65528, 8, 8, 8, 8, 8, 26216, 43688, 8, 8, 65528, 8, 65528, 8, 65528, 65448, 10920, 65528, 8, 8, 8, 8, 8, 8, 43688, 8, 8, 8, 11912, 8, 8, 8, 8, 8, 8, 8, 62344, 8, 8, 32760, 8, 39320, 8, 8, 56296, 65528, 14040, 52424, 65528, 8, 65528, 8, 64776, 8, 65528, 8, 8, 65528, 62072, 42264, 21128, 32760, 63592, 40040, 8, 8, 8, 8, 8, 8, 65528, 57336, 3896, 8, 64840, 8, 65528, 8, 24568, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8744, 43688, 8, 39320, 8, 8, 8, 8, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 13112, 16376, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 26216, 26216, 8, 41688, 8, 8, 65528, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 29128, 32760, 6248, 51720, 12104, 8, 8, 8, 40952, 37448, 65528, 46808, 29784, 21848, 63480, 65528, 32760, 36216, 20280, 51832, 51192, 22792, 57336, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 43688, 17864, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 49144, 8, 8, 8, 65528, 8, 32760, 21848, 43688, 26216, 8, 54600, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 38712, 8, 8, 8, 8, 8, 65528, 49144, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 58248, 65528, 8, 32760, 16376, 8, 8, 65528, 8, 8, 65528, 65528, 8, 8, 65528, 8, 42120, 16376, 21848, 37448, 32760, 14248, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 62664, 8, 8, 8, 30840, 8, 8, 8, 8, 8, 8, 46808, 8, 8, 8, 8, 57784, 8, 27800, 8, 65528, 8, 4376, 8, 65528, 8, 37800, 65528, 65528, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 42584, 8, 61592, 8, 32760, 8, 50024, 8, 7944, 8, 40328, 8, 65528, 61432, 8, 8, 65528, 8, 65528, 8, 65528, 55816, 65528, 65528, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 65528, 65528, 8, 13112, 14568, 8, 65528, 63128, 29784, 8, 65528, 64488, 50968, 65528, 8, 54600, 8, 8, 65528, 65528, 8, 8, 65528, 64344, 8, 8, 65528, 49704, 24968, 8, 57336, 64440, 8, 8, 65528, 65528, 8, 8, 65528, 32760, 64536, 8, 65528, 8, 65528, 8, 8, 8, 58456, 8, 65528, 65528, 8, 8, 65528, 8, 65528, 8, 65528, 8, 8, 8, 65528, 8, 23128, 30248, 8, 8, 65528, 8, 65528, 8, 8, 8, 61288, 8, 65528, 8, 34104, 63080, 65528, 8, 65528, 65528, 8, 8, 65528, 65528, 8, 8, 65528, 59320, 8, 8, 65528, 65528, 9368, 8, 65528, 62840, 8, 8, 8, 10088, 8, 43688, 8, 65528, 8, 8, 65528, 65528, 8, 43688, 8, 64344, 8, 8, 8, 27992, 36696, 25384, 8, 65528, 8, 8, 8, 47448, 8, 65528, 65528, 8, 8, 8, 8, 61784, 8, 65528, 8, 65528, 8, 8, 8, 8, 65528, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 62472, 65528, 8, 8, 65528, 8, 8, 8, 44120, 50968, 28600, 8, 8, 8, 8, 8, 63176, 65528, 24568, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 2728, 8, 8, 8, 62456, 8, 8, 65528, 62248, 8, 8, 65528, 43688, 8, 8, 65528, 8, 8, 8, 8, 53608, 65528, 8, 65528, 65528, 8, 8, 8, 48056, 8, 65528, 65528, 48280, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 21064, 8, 65528, 64648, 60984, 8, 8, 8, 52424, 8, 65528, 8, 65528, 8, 8, 26216, 51480, 8, 8, 65256, 57448, 8, 8, 8, 60056, 8, 65528, 8, 13112, 8, 8, 65528, 64568, 8, 8, 8, 65416, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 65528, 54056, 8, 8, 65528, 32760, 8, 8, 8, 8, 8, 8, 65528, 63256, 8, 65528, 65528, 6936, 8, 8, 65528, 64344, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 65528, 8, 65528, 63768, 8, 8, 8, 24568, 65528, 24568, 8, 8, 8, 8, 65528, 65528, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 13800, 8, 43688, 8, 20472, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 21848, 6248, 65528, 8, 28088, 13112, 8, 8, 8, 65528, 8, 8, 8, 8, 65528, 8, 43464, 46408, 9368, 59288, 31656, 11560, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 18728, 8, 8, 65528, 8, 65528, 8, 8, 32760, 8, 8, 8, 8, 8, 57128, 8, 31064, 65528, 65528, 8, 3448, 8, 61496, 8, 8, 37448, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 55816, 8, 65528, 8, 51688, 32760, 26216, 8, 51720, 8, 8, 21848, 41608, 16376, 65528, 19656, 31480, 4600, 8, 8, 8, 65528, 8, 8, 8, 8, 65528, 8, 59208, 64168, 65528, 65528, 37192, 58664, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 54600, 65528, 8, 65528, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 19656, 54600, 8, 65528, 37304, 14568, 8, 8, 2792, 8, 8, 8, 8, 8, 65528, 8, 27416, 16376, 56888, 23304, 32216, 1688, 26936, 8, 59352, 65528, 10280, 8, 62968, 8, 65528, 8, 64184, 21848, 65528, 8, 26984, 5464, 58024, 16376, 63384, 8, 56328, 8, 65288, 8, 58856, 8, 65528, 16376, 56584, 65528, 17336, 8, 50024, 8, 65528, 8, 51864, 8, 8, 8, 31208, 8, 58616, 65528, 64200, 65528, 5464, 21848, 65528, 8, 38216, 8, 8, 8, 8, 8, 8, 8, 60520, 65528, 8, 8, 8, 65528, 8, 8024, 65528, 53960, 8, 8, 8, 8, 8, 8, 47576, 46456, 8, 65528, 8, 65528, 8, 10920, 4792, 52952, 8, 8, 8, 8, 8, 17864, 65528, 18344, 8, 65528, 8, 8, 8, 19608, 52424, 56168, 8, 8, 8, 8, 8, 8, 43688, 64360, 8, 8, 8, 8, 8, 8, 8, 32760, 8, 8, 8, 8, 8, 49144, 65528, 14568, 8, 8, 8, 8, 8, 10920, 65528, 12824, 8, 8, 8, 8, 39320, 65528, 32760, 41688, 32760, 8, 8, 8, 8, 32760, 8, 36408, 8, 8, 8, 8, 8, 8184, 65528, 9368, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 15816, 65528, 42664, 8, 8, 8, 8, 8, 17864, 8, 59560, 8, 8, 8, 8, 8, 8, 32760, 32760, 8, 8, 8, 8, 49144, 8, 8, 65528, 8, 8, 65528, 8, 8, 4376, 8, 32760, 8, 8, 8, 8, 8, 5464, 65528, 7288, 8, 8, 8, 8, 8, 5144, 32760, 8824, 65528, 65528, 13496, 10088, 8, 16376, 8, 65528, 8, 8, 8, 8, 8, 13112, 34680, 4376, 16376, 8, 27672, 760, 8, 2728, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 43688, 16376, 8, 8, 8, 8, 8, 8, 8, 24568, 63624, 40040, 18024, 27128, 3848, 65528, 8, 32760, 41432, 65528, 63400, 8, 8, 65528, 8, 8, 49144, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 36408, 65528, 8, 65528, 21848, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 39320, 65528, 8, 65528, 45864, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 32760, 65528, 8, 8, 10920, 8, 8, 65528, 65528, 65528, 8, 8, 8, 8, 58616, 8, 44712, 65528, 8, 65528, 26216, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 65528, 65528, 8, 65528, 21848, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 65528, 8, 50408, 8, 65528, 8, 48616, 8, 8, 8, 50968, 8, 65528, 65528, 65528, 65528, 65528, 8, 8, 8, 65528, 8, 50968, 8, 8, 8, 65528, 8, 8, 8, 8, 65528, 8, 8, 65528, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 59560, 65528, 65528, 65528, 41384, 8, 8, 8, 65528, 8, 8, 65528, 8, 8, 8, 8, 65528, 65528, 65528, 65528, 32760, 8, 8, 8, 65528, 8, 8, 65528, 8, 8, 8, 65528, 8, 58504, 65528, 37800, 8, 32760, 65528, 65528, 8, 64536, 65528, 65528, 8, 65528, 8, 8, 8, 65528, 65528, 65528, 16376, 13656, 65528, 43688, 8, 8, 8, 8, 8, 57336, 8, 8, 8, 65528, 8, 8, 8, 55096, 8, 39320, 65528, 65528, 8, 8, 56792, 8, 8, 8, 65528, 52424, 8, 65528, 58072, 8, 8, 65528, 8, 39320, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 21848, 8, 62408, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 49144, 65528, 8, 65528, 21848, 7288, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 39320, 65528, 8, 65528, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 61160, 8, 65528, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 8, 65528, 32760, 65528, 65528, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 65528, 8, 8, 65528, 53384, 8, 8, 8, 65528, 8, 8, 8, 61432, 65528, 65528, 65528, 43080, 8, 8, 8, 65528, 8, 8, 65528, 65528, 8, 8, 8, 8, 65528, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 16376, 8, 32760, 64456, 15816, 18728, 65528, 65352, 8, 8, 8, 65528, 8, 8, 65528, 60232, 65528, 8, 8, 65528, 8, 13112, 65528, 65032, 8, 65528, 65528, 58152, 8, 32760, 65528, 65528, 55688, 65528, 8, 65528, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 43688, 8, 65528, 65528, 33976, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 43688, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 63528, 54888, 8, 65528, 37640, 18328, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 62040, 65528, 8, 50280, 19208, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 55032, 65528, 8, 65528, 16376, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 52648, 65528, 4680, 65528, 56792, 65528, 8, 65528, 8, 8, 8, 8, 8, 8, 50280, 8, 55960, 65528, 8, 56024, 61688, 16376, 65528, 8, 32760, 8, 61432, 8, 43688, 8, 8, 8, 49512, 65528, 8, 65528, 61432, 248, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 34952, 65528, 46552, 65528, 65528, 8, 52840, 8, 8, 8, 32760, 8, 8, 8, 55880, 65528, 8, 65528, 39320, 32760, 8, 8, 65528, 8, 8, 8, 8, 8, 65528, 8, 56040, 65528, 8, 65528, 43896, 13112, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 62792, 65528, 8, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 43688, 65528, 8, 65528, 24568, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 44264, 52424, 56168, 49144, 39320, 43688, 65528, 65528, 58904, 32760, 13112, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 5464, 17240, 38216, 4232, 8, 52840, 51192, 2264, 8, 8, 8, 8, 50968, 65528, 8, 65528, 15160, 18952, 46808, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 51864, 65528, 8, 65528, 4888, 3912, 65528, 8, 61160, 8, 8, 8, 8, 8, 8, 8, 61432, 65528, 8, 65528, 39592, 1560, 65528, 8, 8, 46808, 8, 8, 8, 65528, 8, 8, 65528, 65528, 65528, 65528, 65528, 8, 65528, 8, 8, 65528, 65528, 53240, 43688, 8, 8, 8, 60120, 65528, 8, 65528, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 56712, 65528, 65528, 65528, 13112, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 57128, 65528, 8, 65528, 64376, 63000, 45864, 65528, 7288, 13304, 8, 8, 65528, 5352, 8, 8, 46808, 65528, 8, 65528, 56904, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 52424, 65528, 8, 65528, 33816, 16376, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 63720, 65528, 8, 8, 48056, 16376, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 65528, 32760, 8, 32760, 8, 8, 8, 32760, 8, 8, 54600, 65528, 8, 65528, 29128, 8, 8, 8, 32760, 65528, 65528, 8, 65528, 8, 8, 8, 39320, 65528, 8, 65528, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 32760, 22376, 47368, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 37448, 65528, 8, 65528, 8, 64808, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 64840, 65528, 8, 65528, 4680, 40696, 57816, 8, 23832, 28088, 8, 5960, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 62072, 8, 8, 8, 7640, 8, 8, 8, 65528, 65528, 24568, 54440, 8, 8, 65528, 11912, 57752, 8, 16088, 8, 8, 8, 46808, 8, 60536, 24408, 19656, 13944, 58792, 7240, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 42264, 8, 65528, 8, 8, 8, 34888, 8, 8, 8, 46808, 8, 65528, 65528, 8, 8, 36408, 8, 65528, 8, 64152, 65528, 44232, 59176, 65528, 8, 65528, 6552, 65528, 65528, 65528, 8, 8, 8, 65528, 8, 35288, 32760, 54072, 65528, 65528, 8, 65528, 8, 65528, 65528, 8, 8, 65528, 65528, 65528, 8, 65528, 32760, 65528, 8, 65528, 65528, 65528, 8, 65528, 65528, 65528, 8, 65528, 8, 56312, 8, 65528, 65528, 8, 8, 65528, 8, 65528, 8, 65528, 65528, 64952, 8, 65528, 8, 65528, 8, 27224, 8, 48488, 61976, 32760, 8, 65528, 2728, 8, 8, 65128, 8, 65528, 8, 40952, 8, 22056, 8, 47656, 38584, 65528, 296, 65528, 8, 65528, 8, 8, 8, 8, 8, 61368, 8, 46584, 65528, 65528, 8, 65528, 65528, 65528, 8, 8, 8, 3752, 8, 65528, 56584, 8, 8, 61160, 8, 14040, 8, 65528, 8, 8, 8, 8, 8, 65528, 21848, 8, 65528, 8, 8, 21848, 49144, 15720, 41928, 8, 8, 65528, 9928, 8, 11768, 32760, 29560, 8, 65528, 65528, 8, 8, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 57336, 57336, 6552, 8, 8, 8, 8, 13112, 54600, 5368, 52616, 65528, 8, 65528, 5624, 27304, 29592, 17864, 8, 11560, 16376, 35096, 1768, 50968, 1384, 7288, 16056, 56088, 1464, 12008, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 26216, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 8, 6552, 8, 8, 8, 65528, 8, 8, 8, 10920, 65528, 8, 21848, 65368, 8, 8, 312, 29128, 38712, 32760, 8, 8, 65528, 6904, 8, 21848, 65528, 8, 65528, 51128, 8, 8, 8, 63000, 54600, 65528, 8, 8, 8, 8, 8, 65528, 65528, 65528, 8, 65528, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 65528, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 21848, 65528, 8184, 23128, 8, 65528, 65528, 6552, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 21592, 8, 5464, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 39320, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 36408, 43688, 1592, 54888, 8, 8, 65528, 4088, 8, 2424, 8, 5960, 57336, 8, 65528, 8, 4008, 8, 8, 53240, 65528, 8, 8, 8, 8, 8, 8, 43688, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 16376, 8, 8, 8, 8, 8, 8, 40952, 8, 16376, 8, 21848, 8, 8, 8, 8, 65528, 22520, 30424, 8, 8, 65528, 8552, 31336, 8, 36856, 8, 8, 8, 39320, 8, 46040, 39736, 49144, 63384, 62952, 3192, 65528, 8, 8, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 49144, 8, 8, 8, 65528, 43688, 38216, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 65528, 14568, 23128, 32760, 8, 8, 65528, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 32760, 21848, 8, 43688, 56168, 8, 8, 8, 8, 50408, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 43688, 19656, 8, 8, 8, 65528, 8, 8, 8, 63256, 8, 44600, 8, 8, 8, 32760, 49144, 51272, 42120, 8, 8, 65528, 13112, 38216, 8, 62472, 65528, 8, 8, 32760, 8, 24568, 12424, 43688, 8, 64504, 8, 65528, 8, 63752, 65528, 65528, 52424, 8, 8, 7080, 8, 8, 14408, 65528, 65528, 8, 8, 8, 8, 8, 17864, 65528, 65528, 8, 8, 8, 8, 8, 8, 46808, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 32760, 21256, 61592, 34616, 8, 8, 65528, 8, 8, 13496, 64424, 51144, 65528, 8, 65528, 8, 792, 6920, 20120, 15016, 65528, 40728, 8, 8, 8, 34392, 65528, 2920, 8, 8, 8, 8, 8, 17640, 63768, 6984, 8, 8, 8, 8, 8, 25864, 65528, 20872, 8, 8, 8, 8, 8, 26984, 65528, 14568, 8, 8, 8, 8, 8, 14568, 65528, 16376, 8, 8, 8, 8, 13112, 24568, 53704, 1992, 8, 8, 65528, 21848, 65528, 14568, 65528, 65528, 65528, 8, 8, 5960, 8, 2984, 3848, 47656, 1928, 8, 8, 8, 8, 28664, 65528, 8, 8, 8, 8, 8, 8, 13112, 65528, 7288, 8, 8, 8, 8, 8, 26424, 65528, 36856, 8, 8, 8, 8, 8, 27480, 65528, 31032, 8, 8, 8, 8, 8, 4680, 65528, 13112, 8, 8, 8, 8, 19224, 58968, 1320, 48312, 8, 8, 65528, 6744, 65528, 26216, 61672, 1400, 29128, 8, 65528, 2568, 38408, 11448, 63336, 26440, 60744, 2216, 8, 8, 8, 21192, 65528, 18664, 8, 8, 8, 8, 8, 23400, 65528, 65528, 8, 8, 8, 8, 8, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 776, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 65528, 58616, 58968, 8, 8, 65528, 8744, 8, 8, 65528, 8, 8, 8, 65528, 8, 65528, 3784, 65528, 42520, 41256, 1720, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 14872, 32760, 51864, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 49144, 65528, 17640, 38216, 8, 8, 65528, 2344, 8, 26216, 8, 65528, 8, 65528, 8, 8, 8, 8, 8, 24568, 50008, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 64088, 8, 9224, 8, 13288, 8, 8, 8, 65528, 8, 8, 65528, 8, 8, 8, 8, 43320, 8, 38536, 8, 65528, 8, 9032, 8, 61352, 8, 11304, 8, 64760, 8, 56792, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 39000, 8, 60200, 8, 49144, 8, 50008, 8, 10920, 8, 55592, 8, 43688, 28008, 65528, 8, 65528, 8, 65528, 8, 44968, 34952, 5768, 45576, 65528, 8, 65528, 5576, 9832, 8, 65528, 65528, 8, 8, 65528, 8, 38152, 5400, 10792, 61464, 61432, 8, 45864, 8, 65528, 65528, 8, 8, 65528, 65528, 65528, 8, 65528, 65528, 8, 8, 65528, 65528, 65528, 8, 32760, 65528, 8, 8, 8, 21848, 45864, 8, 65528, 59624, 6424, 8, 65528, 8, 65528, 8, 8, 65528, 63176, 8, 65528, 8, 65336, 8, 46856, 8, 43288, 62536, 65528, 8, 47800, 8, 36408, 8, 60024, 29976, 21848, 8, 62328, 15944, 33640, 8, 2488, 21848, 53960, 9704, 64632, 8, 57816, 8, 65528, 8, 65528, 8, 42200, 8, 40568, 65528, 65032, 8, 60200, 65528, 65528, 8, 8, 8, 58616, 8, 65528, 51480, 62664, 8, 64072, 8, 28088, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 41384, 65528, 5352, 60104, 8, 65528, 65528, 13112, 44552, 11912, 8, 32760, 8, 32760, 65528, 8, 584, 8, 8, 65320, 65528, 32760, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 50968, 52424, 8, 65528, 65528, 13112, 8, 8, 8, 8, 8, 43688, 65528, 8, 64696, 16376, 8, 9752, 57000, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 65528, 65528, 8, 65528, 65528, 65528, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 344, 8, 8, 65528, 8, 16376, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 29128, 8, 8, 65528, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 19512, 65528, 2120, 59480, 65528, 65528, 65528, 21848, 65528, 8, 8, 8, 65528, 8, 36408, 8, 18728, 1208, 8, 65528, 65528, 65528, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 21848, 8, 8, 65528, 8, 8, 8, 8, 8, 65528, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 61880, 8, 8, 8, 3848, 8, 8, 8, 65528, 8, 8, 65528, 8, 8, 65528, 8, 39320, 8, 27304, 8, 8, 8, 10920, 8, 59128, 8, 13112, 30840, 63816, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 18728, 8, 59560, 8, 58248, 8, 52520, 8, 8, 8, 42120, 8, 8, 8, 65528, 8, 65528, 8, 65528, 8, 65528, 8, 43688, 8, 8, 8, 8, 8, 8, 8, 8, 21848, 65528, 8, 8, 8, 65528, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 65528, 8, 65528, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 57176, 8, 8, 8, 6840, 8, 8, 8, 8, 8, 8, 8, 61512, 8, 65528, 8, 64680, 8, 59800, 8, 14376, 8, 22168, 8, 49416, 8, 8, 8, 65528, 8, 65528, 8, 59864, 8, 61608, 8, 50552, 8, 19688, 8, 65528, 8, 45000, 8, 8, 8, 30696, 8, 49992, 8, 60616, 8, 64552, 8, 65528, 8, 34152, 8, 29784, 8, 7288, 8, 54600, 8, 65528, 8, 65528, 8, 23832, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 21848, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 568, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 49144, 45864, 8, 8, 61672, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 7288, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 33416, 8, 17240, 65528, 8, 8, 25480, 8, 63656, 8, 40952, 8, 64280, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 33400, 8, 65528, 8, 8, 8, 49352, 8, 8, 8, 13112, 8, 65528, 56792, 65528, 8, 65528, 8, 65528, 8, 64728, 58248, 65528, 8, 65528, 8, 8, 8, 65528, 8, 65528, 8, 8, 65528, 8, 8, 65528, 8, 8, 8, 8, 8, 65528, 8, 65528, 65528, 8184, 8, 65528, 54600, 8, 65528, 65528, 32760, 8, 8, 65528, 65528, 65528, 8, 65528, 65528, 8, 8, 65528, 53608, 58248, 8, 8, 65528, 3752, 8, 65528, 65528, 8, 8, 65528, 8, 64776, 8, 8, 65528, 8, 8, 64120, 65528, 40520, 8, 8, 8, 8, 8, 54600, 8, 65528, 8, 8, 8, 8, 8, 65528, 8, 43688, 8, 8, 65528, 65528, 8, 65048, 8, 8, 8, 63496, 65528, 49576, 8, 51496, 65528, 65096, 8, 8, 65528, 8, 8, 3176, 8, 65528, 8, 65528, 62536, 8, 8, 65528, 8, 40952, 8, 8, 65528, 8, 8, 8, 60840, 8, 8, 65528, 8, 8, 8, 8, 45368, 32760, 31448, 8, 65528, 8, 8, 8, 4856, 36856, 21096, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 16376, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 65528, 8, 8, 8, 19416, 40328, 31496, 8, 49144, 8, 8, 8, 8, 43688, 65528, 8, 65528, 65528, 8, 8, 39320, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 65528, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 29128, 65528, 8, 8, 65528, 8, 8, 8, 8744, 65528, 65528, 65528, 65528, 8, 8, 8, 28088, 65528, 37928, 8, 8, 8, 8, 8, 35288, 8, 65528, 65528, 8, 8, 8, 8, 37448, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 65528, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 60488, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 43688, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 65528, 47080, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 32760, 65528, 8, 8, 8, 8, 57336, 65528, 32760, 8, 8, 8, 8, 8, 43688, 8, 8, 65528, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 45864, 4088, 36584, 13656, 21304, 5160, 8, 8, 8, 49144, 8, 8, 8, 8, 8, 8, 5960, 5144, 8, 8, 21848, 9368, 8, 32760, 8, 65528, 8, 8, 8, 8, 8, 8, 57128, 64520, 8, 62072, 49144, 27592, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 65528, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 52424, 8, 65528, 8, 21848, 8, 65528, 8, 8, 8, 8, 8, 8, 39320, 8, 8, 8, 8, 8, 8, 8, 49144, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 65528, 8, 8, 8, 40952, 8, 8, 8, 32760, 8, 8, 8, 60392, 54600, 8, 65528, 3448, 1208, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 56584, 62248, 8, 65528, 26216, 58136, 8, 10920, 65528, 65528, 8, 8, 8, 8, 8, 8, 52424, 65528, 8, 65528, 32760, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 43688, 65528, 8, 65528, 65528, 26216, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 9368, 8, 36408, 39320, 40120, 1016, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 49144, 1720, 8, 65528, 21848, 8, 8, 8, 64216, 21848, 8, 8, 8, 8, 8, 1336, 61944, 31336, 8, 65528, 25784, 1992, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 65528, 32760, 8, 8, 40952, 46808, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 21848, 56168, 8, 8, 8, 65528, 8, 18072, 8, 49144, 8, 8, 8, 8, 65528, 10344, 27592, 42728, 8, 8, 8, 65528, 8, 21848, 65528, 10920, 8, 8, 8, 8, 8, 4088, 57816, 23832, 8, 8, 8, 8, 8, 10920, 65528, 21848, 8, 8, 8, 8, 65528, 26216, 56584, 14040, 8, 8, 8, 8, 8, 32760, 8, 32760, 8, 8, 8, 8, 8, 14040, 43688, 45864, 8, 8, 8, 8, 8, 38536, 65528, 21848, 8, 8, 8, 8, 8, 32760, 54600, 43688, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 52424, 6552, 8, 8, 8, 8, 8, 8, 8, 32760, 8, 8, 8, 8, 8, 12040, 46248, 51272, 8, 8, 8, 8, 8, 14568, 65528, 26216, 8, 8, 8, 8, 8, 65528, 8, 13112, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 26216, 53960, 8, 8, 8, 8, 8, 8, 3192, 65528, 17480, 8, 8, 8, 8, 8, 30712, 18728, 10920, 8, 65528, 9096, 26216, 8, 56424, 26216, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 65528, 8, 32760, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 61160, 57336, 13112, 8, 8, 28088, 8, 8, 8, 8, 21848, 8, 8, 8, 8, 8, 8, 12792, 18024, 32760, 54600, 23048, 3752, 8, 8, 65528, 61000, 8, 8, 8, 8, 8, 7160, 46664, 32568, 8, 65528, 8, 8, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 26216, 8, 8, 65528, 52424, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 46040, 21848, 16808, 14568, 42264, 46040, 57336, 16376, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 43688, 43688, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 49144, 8, 8, 8, 8, 8, 8, 8, 8, 8, 64968, 8, 8, 8, 12552, 26056, 8, 53240, 8, 21848, 8, 43688, 4680, 54600, 56168, 43688, 47656, 8, 27528, 8, 8, 8, 6824, 8184, 59400, 8, 23832, 8, 64552, 8, 32760, 8, 8, 8, 8, 8, 49144, 65528, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 45192, 8, 60664, 8, 46808, 8, 48808, 8, 8, 8, 51272, 8, 65528, 60840, 65528, 8, 65528, 65528, 63976, 8, 65528, 65528, 65528, 8, 65528, 8, 65528, 8, 65528, 8, 65528, 8, 8, 8, 65528, 8, 65528, 8, 65528, 8, 65528, 8, 65528, 8, 65528, 63160, 65528, 8, 65528, 57336, 58968, 8, 65528, 32760, 8, 8, 65528, 65528, 65528, 8, 65528, 60056, 8, 8, 65528, 65528, 41496, 65528, 60056, 64696, 5288, 8, 65528, 8, 65528, 8, 65528, 8, 62536, 8, 62904, 8, 40664, 8, 60840, 8, 64296, 65528, 65528, 8, 65352, 8, 8, 8, 65528, 8, 49144, 8, 16376, 8, 27304, 8, 26216, 8, 3528, 8, 65432, 8, 46808, 8, 8, 8, 64856, 65528, 39720, 43688, 45560, 61784, 64568, 65528, 65528, 65528, 8, 65528, 65528, 8, 44456, 8, 65528, 54856, 2984, 8, 63704, 8, 31208, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 14568, 7992, 8, 15672, 8, 65528, 52424, 23832, 34648, 37272, 53176, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 40952, 43112, 8, 16376, 8, 8, 8, 65528, 49144, 28088, 10920, 28488, 8, 8, 8, 8, 8, 8, 6248, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 13112, 8, 8, 8, 8, 10920, 16376, 8, 8, 8, 8, 65528, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 7704, 8, 39320, 8, 8, 8, 8, 38216, 56168, 65528, 8, 8, 8, 8, 8, 65528, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 13112, 8, 8, 8, 49144, 37448, 52424, 8, 28824, 32040, 36408, 8, 8, 65528, 65528, 65528, 65528, 65528, 65528, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 54600, 8184, 8, 8, 8, 8, 65528, 65528, 8, 65528, 8, 8, 65528, 8, 8, 65528, 61672, 38712, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 65528, 65528, 8, 65528, 59560, 8, 12280, 43000, 58968, 43688, 53608, 43912, 39912, 17320, 8, 65528, 8, 57816, 65528, 8, 65528, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 65528, 63880, 21848, 8, 8, 65528, 8, 8, 8, 49144, 36664, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 65528, 5960, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 65528, 65528, 21848, 65528, 41784, 10088, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 21848, 8, 65528, 8, 55768, 1464, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 39320, 65528, 8, 65528, 39272, 40, 8, 8, 8, 8, 8, 8, 8, 8, 64088, 8, 53016, 65528, 3272, 30584, 35608, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 48344, 8, 26616, 65528, 36152, 8, 21592, 21704, 59016, 8, 17864, 8, 65480, 8, 32760, 8, 8, 8, 8, 8, 8, 21848, 62296, 46504, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 25400, 65528, 40360, 37448, 10408, 632, 65528, 8, 54440, 8, 21848, 8, 50968, 8, 8, 8, 65528, 65528, 65528, 65528, 11640, 8, 65528, 8, 65528, 8, 65528, 8, 8, 8, 65528, 8, 65528, 65528, 8, 8, 52952, 600, 65528, 8, 65528, 8, 65528, 8, 65528, 8, 65528, 8, 8, 8, 65528, 8, 65528, 8, 65528, 8, 65528, 8, 8, 8, 65528, 8, 65528, 8, 65528, 65528, 8, 8, 37816, 65528, 65528, 8, 5960, 8, 8, 8, 62536, 8, 8, 8, 61704, 8, 8, 8, 28104, 65528, 8, 8, 45064, 8, 65528, 8, 8, 8, 28328, 8, 65528, 8, 8, 8, 16664, 8, 65528, 8, 65528, 8, 8, 8, 65528, 8, 65528, 8, 43688, 8, 65528, 8, 34648, 8, 52280, 8, 65528, 8, 8, 8, 65528, 8, 65528, 8, 38216, 65528, 18728, 8, 16968, 8, 62792, 8, 14664, 8, 8, 8, 8, 8, 8, 8, 35288, 65528, 8, 8, 13880, 168, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 4136, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 55032, 8, 65528, 25336, 504, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 57880, 65528, 42296, 16568, 23512, 16968, 65528, 8, 65528, 55448, 49144, 25208, 40328, 8, 8, 8, 8, 8, 8, 8, 58680, 1768, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 8072, 8, 8, 8, 8, 8, 51720, 10920, 47656, 8, 8, 8, 8, 8, 8, 8, 51272, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 60488, 65528, 8, 8, 56168, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 61288, 65528, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 3048, 21848, 8, 65528, 32760, 43688, 26216, 8, 49144, 41384, 42120, 8, 8, 8, 8, 8, 8, 65528, 28088, 9368, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 40952, 65528, 8, 60056, 43688, 64232, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 61880, 65528, 8, 65528, 8, 56168, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 43688, 8, 65528, 8, 8, 8, 8, 49144, 65528, 58248, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 8, 8, 46808, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 59800, 8, 8, 8, 8120, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 44584, 8, 34760, 8, 65528, 8, 11560, 8, 58312, 8, 46344, 8, 65064, 8, 43688, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 32760, 8, 8, 8, 8, 8, 8, 47880, 8, 62840, 8, 45048, 8, 48568, 8, 5048, 8, 48120, 8, 65528, 53608, 65528, 8, 65080, 65528, 65528, 8, 65528, 55656, 65528, 8, 57656, 65528, 8, 8, 65528, 65528, 65528, 8, 65528, 8, 65528, 8, 65528, 8, 65528, 8, 65528, 8, 65528, 8, 65528, 56712, 8, 8, 65528, 8, 65528, 8, 65528, 8, 65528, 8, 64488, 65528, 65528, 8, 17864, 8, 8, 8, 65528, 43688, 48568, 8, 65528, 8, 10456, 8, 65528, 8, 8, 8, 65528, 65528, 57640, 8, 65528, 65528, 65528, 8, 56792, 8, 50600, 8, 65528, 8, 65528, 8, 52008, 8, 65528, 8, 65528, 8, 8, 8, 65528, 8, 65528, 8, 65528, 8, 63576, 8, 41384, 8, 8, 8, 59224, 65528, 17688, 8, 62184, 65528, 65528, 8, 8, 8, 65528, 8, 8, 8, 57272, 8, 65528, 49144, 8, 8, 64824, 8, 31992, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 65528, 60392, 8, 14568, 8, 65528, 8, 8, 43688, 22696, 49144, 24216, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 65528, 65528, 8, 8, 65528, 8, 8, 8, 8, 65528, 8, 8, 65528, 8, 8, 65528, 65528, 65528, 8, 8, 8, 8, 65528, 8, 8, 65528, 8, 8, 65528, 1336, 21848, 24168, 65528, 65528, 8, 8, 65528, 19208, 38824, 56632, 8, 65528, 8, 8, 65528, 16376, 65528, 65528, 65528, 65528, 8, 8, 65528, 8552, 65528, 34952, 65528, 8, 8, 8, 8, 12600, 25000, 21240, 8, 8, 8, 8, 65528, 61672, 8, 10920, 65528, 18200, 8, 8, 65528, 39320, 65528, 29752, 65528, 8, 8, 8, 8, 17864, 63144, 11912, 8, 8, 8, 8, 8, 25672, 8, 65528, 65528, 55176, 8, 8, 65528, 31496, 8, 8, 65528, 59720, 8, 8, 65528, 42008, 8, 8, 65528, 48280, 8, 8, 65528, 64952, 8, 8, 65528, 65528, 8, 8, 65528, 58968, 8, 8, 65528, 64072, 8, 65528, 29128, 60056, 8, 8, 18728, 65528, 8, 8, 65528, 49144, 8, 8, 65528, 65528, 8, 8, 65528, 62616, 8, 8, 65528, 65528, 8, 8, 65528, 43688, 8, 8, 21848, 60280, 8, 45864, 65528, 65528, 65528, 8, 26216, 58968, 8, 65528, 65528, 61352, 54600, 21288, 65528, 65528, 8, 8, 65528, 37800, 8, 28168, 65528, 65528, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 65528, 51976, 46104, 27672, 65528, 63368, 8, 8, 65528, 8, 8, 56168, 8, 65528, 8, 8, 8, 11912, 65528, 25480, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 9368, 65528, 65528, 8, 8, 8, 8, 8, 65528, 8, 32760, 8, 8, 8, 8, 8, 10920, 65528, 16376, 8, 8, 8, 8, 8, 21848, 8, 8, 8, 8, 8, 8, 8, 5464, 65528, 8, 8, 8, 8, 8, 8, 21848, 65528, 32760, 8, 8, 8, 8, 8, 16376, 8, 21848, 8, 8, 8, 8, 65528, 32760, 8, 8, 8, 8, 8, 8, 65528, 21848, 8, 65528, 16376, 8, 8, 8, 45048, 3848, 26808, 21848, 8, 8, 8, 8, 65528, 9368, 13112, 32760, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 43688, 65528, 3640, 8, 8, 62664, 8, 8, 8, 8, 65528, 43688, 8, 65528, 8, 65528, 8, 51224, 5048, 8, 8, 43688, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 24568, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 13112, 65528, 50968, 8, 8, 8, 8, 8, 4088, 65528, 8, 8, 8, 8, 8, 8, 8, 21848, 65528, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 23832, 8, 8, 21848, 8, 65528, 8, 8, 8, 8, 8, 8, 65528, 32760, 58968, 8, 65528, 8, 61432, 21848, 35032, 65528, 45368, 8, 30584, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 65160, 34680, 65256, 14328, 64856, 8, 65528, 8, 45640, 8, 65528, 65528, 64488, 8, 55896, 8, 46760, 40952, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 32760, 18728, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 65528, 8, 10456, 65528, 58504, 8, 8, 8, 8, 8, 8696, 65528, 46808, 8, 8, 8, 8, 8, 12680, 65528, 7288, 8, 8, 8, 8, 8, 14888, 65528, 8552, 8, 8, 8, 65528, 8, 6296, 65528, 18344, 8, 8, 8, 8, 8, 5352, 65528, 64296, 8, 8, 8, 8, 8, 10488, 65528, 8, 8, 8, 8, 8, 8, 6136, 65528, 65528, 8, 8, 8, 8, 8, 8680, 65528, 23528, 8, 8, 8, 8, 8, 10344, 8, 65528, 8, 8, 8, 8, 8, 10920, 65528, 8, 8, 8, 8, 8, 8, 2728, 65528, 13112, 26216, 8, 8, 8, 32760, 8, 8, 32760, 17480, 42392, 36616, 8, 8, 18408, 65528, 43512, 8, 8, 8, 8, 8, 10920, 65528, 32760, 8, 8, 8, 8, 8, 8, 65528, 28664, 8, 56168, 8, 65528, 65528, 26216, 65528, 32760, 32760, 65528, 14568, 8, 8, 5560, 65528, 5512, 8, 8, 8, 8, 8, 5704, 65528, 49144, 8, 8, 8, 8, 8, 11560, 65528, 26808, 43688, 19512, 8, 42120, 8, 26216, 65528, 7704, 8, 8, 8, 65528, 8, 24568, 65528, 3976, 8, 8, 8, 8, 8, 2264, 8, 4376, 8, 8, 8, 8, 8, 8, 8, 39320, 65528, 9704, 8, 65528, 65528, 13112, 65528, 32760, 8, 21848, 8, 8, 8, 16376, 8, 65528, 8, 8, 8, 8, 8, 39320, 32760, 43864, 8, 8, 8, 8, 8, 14568, 65528, 65528, 8, 8, 8, 8, 8, 6824, 65528, 40136, 8, 10920, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 51480, 8, 30840, 65528, 32760, 8, 8, 63336, 53608, 42904, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 2984, 46808, 65528, 8, 8, 8, 8, 8, 6248, 920, 8, 8, 50968, 8, 32760, 8, 8, 8, 32760, 8, 49144, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 13112, 8, 52424, 8, 8, 8, 8, 6840, 49336, 65528, 8, 8, 8, 8, 8, 37448, 8, 65528, 8, 8, 8, 57656, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 16376, 37800, 8, 41384, 65528, 62248, 65528, 8, 65064, 13800, 63928, 7704, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 65528, 45368, 8, 8, 11912, 45368, 8, 38952, 65528, 8, 16376, 3048, 57128, 61432, 52776, 46808, 8, 8, 8, 8, 65528, 8, 65528, 8, 8, 8, 8, 8, 65528, 8, 65528, 8, 65528, 8, 65288, 8, 1192, 12424, 65528, 52424, 65528, 65528, 51992, 65528, 63960, 49144, 65528, 65528, 65528, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 45576, 65528, 17864, 8, 65528, 8, 8, 65528, 50232, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 37448, 8, 8, 65528, 65528, 8, 8, 45976, 776, 65528, 8, 8, 65528, 8, 8, 65528, 65528, 8, 8, 65528, 65528, 8, 8, 65528, 8, 8, 8, 8, 32760, 8, 8, 32760, 46104, 8, 25208, 65528, 8, 8, 65528, 65528, 65528, 52056, 65528, 65528, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 65528, 65528, 8, 8, 65528, 8, 8, 8, 65528, 43688, 8, 32760, 65528, 8, 8, 65528, 32760, 65528, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 21848, 8, 49144, 8, 8, 8, 65528, 65528, 8, 1528, 8, 8, 65528, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 60408, 53384, 8, 8, 65528, 61048, 8, 8, 63400, 59784, 62168, 65528, 65528, 60168, 8, 8, 65528, 61368, 8, 8, 65528, 65528, 8, 8, 65528, 65528, 8, 8, 65528, 52424, 8, 8, 58968, 64440, 8, 32760, 45368, 65528, 8, 65528, 37192, 21848, 1928, 8, 65528, 62072, 8, 8, 65528, 65528, 8, 8, 65528, 52424, 8, 8, 65528, 53960, 8, 8, 65528, 61432, 8, 8, 2072, 4504, 8, 26088, 51192, 64824, 8, 65528, 45528, 61736, 36488, 17096, 65528, 65128, 8, 8, 65528, 65528, 8, 8, 65528, 65528, 8, 8, 65528, 64760, 8, 8, 65528, 65528, 8, 8, 21848, 49144, 8, 32760, 65528, 8, 8, 8, 65528, 24056, 13800, 65528, 8, 8, 8, 8, 65528, 60488, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 25208, 22744, 8, 33384, 65528, 5048, 5960, 65528, 46680, 49144, 48152, 26216, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65064, 8, 8, 8, 16952, 3272, 8, 33816, 31768, 65528, 8, 49144, 52344, 32264, 60488, 23400, 47752, 8, 10088, 8, 8, 8, 13112, 8, 57336, 8, 65528, 8, 65400, 8, 8, 8, 8, 8, 8, 8, 8, 62728, 8, 39320, 8, 8, 8, 32760, 63400, 1016, 37976, 8, 8, 8, 8, 8, 39320, 8, 65528, 8, 8, 8, 57336, 8, 8, 8, 43688, 8, 8, 8, 8, 8, 7288, 46248, 65528, 27720, 65528, 8, 8, 8, 18072, 19304, 13112, 440, 8, 8, 65528, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 32760, 65528, 8, 8, 8, 65528, 8, 10280, 59384, 15736, 65528, 8, 8, 32760, 8, 8, 8, 26216, 8, 49144, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 65528, 65528, 8, 8, 8, 60120, 8, 57608, 54600, 65528, 8, 65528, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 39320, 8, 55448, 8, 65528, 8, 8, 8, 14200, 50888, 49144, 40952, 21848, 8, 43688, 8, 62072, 61976, 17096, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 13112, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 10920, 8, 32760, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 46808, 8, 8, 8, 8, 8, 8, 32760, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 60488, 8, 8, 8, 6552, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 45144, 8, 23128, 8, 65528, 8, 26216, 8, 61160, 8, 53608, 8, 65528, 8, 32760, 8, 8, 8, 65528, 8, 9368, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 57656, 8, 65528, 8, 8, 8, 46504, 8, 8, 8, 65528, 8, 65528, 9368, 8, 8, 65528, 60664, 65528, 8, 64072, 55736, 65528, 8, 65528, 8, 65528, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 65528, 8, 65528, 60296, 29128, 8, 65528, 8, 65528, 8, 65528, 8, 8, 8, 65528, 65528, 65528, 8, 65528, 8, 8, 8, 65528, 8, 65528, 8, 65528, 8, 8, 8, 65528, 65528, 8, 8, 65528, 65528, 8, 8, 65528, 8, 65528, 8, 65528, 8, 56344, 8, 65528, 8, 8, 8, 65528, 8, 65528, 8, 65528, 8, 8, 8, 65528, 8, 65528, 8, 65528, 8, 8, 8, 50792, 8, 8, 8, 65528, 8, 65528, 8, 36872, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 65528, 52424, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 8, 11304, 65528, 8, 8, 65528, 8, 8, 65528, 8, 65528, 8, 8, 65528, 8, 8, 8, 8, 65528, 65528, 65528, 65528, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 65528, 65528, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 51272, 49144, 8, 65528, 8, 8, 8, 65528, 65528, 65528, 8, 65528, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 65528, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 60488, 65528, 8, 65528, 1368, 8, 8, 65528, 8, 65528, 8, 8, 8, 8, 8, 65528, 16376, 8, 8, 8, 8, 8, 8, 8, 34184, 8, 65528, 65528, 65528, 8, 8, 65528, 39784, 8, 65528, 65528, 56168, 8, 8, 65528, 52424, 8, 8, 65528, 35736, 8, 8, 65528, 60840, 8, 8, 65528, 65528, 8, 8, 65528, 65528, 8, 8, 65528, 49144, 8, 8, 65528, 65528, 8, 8, 65528, 65528, 8, 8, 65528, 50408, 8, 8, 65528, 65528, 8, 8, 65528, 59816, 8, 8, 65528, 54600, 8, 8, 65528, 65528, 8, 8, 65528, 8, 8, 8, 65528, 56168, 8, 8, 65528, 65528, 8, 8, 65528, 64280, 65528, 8, 65528, 21848, 8, 8, 8, 65528, 8, 8, 65528, 65528, 8, 8, 65528, 8, 8, 36408, 65528, 65528, 8, 8, 8, 44824, 32760, 8, 8, 65528, 8, 8, 65528, 55000, 65528, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 21848, 8, 8, 8, 30584, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 39320, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 47096, 55176, 8, 65528, 46408, 23832, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 60056, 8, 32760, 8, 1192, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 58376, 8, 18728, 8, 65528, 8, 26216, 8, 61432, 8, 54600, 65528, 64696, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 35368, 8, 65528, 8, 8, 8, 53160, 8, 8, 8, 43688, 8, 8, 8, 48424, 60056, 65528, 45048, 35736, 1992, 65528, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 59656, 65528, 8, 65528, 37448, 48280, 8, 8, 8, 8, 65528, 8, 65528, 8, 65528, 8, 13112, 65528, 8, 8, 65528, 8, 65528, 8, 8, 8, 65528, 8, 65528, 8, 8, 8, 47320, 43688, 8, 8, 39320, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 51480, 24568, 22104, 4088, 65528, 8, 3448, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 65528, 8, 65528, 8, 65528, 8, 65528, 8, 65528, 13112, 53608, 65528, 56168, 8, 28488, 8, 8, 21848, 65528, 65528, 8, 8, 8, 8, 65528, 8, 18728, 65528, 43688, 65528, 54360, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 49144, 42392, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 44824, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 32760, 65528, 12280, 8, 8, 8, 65528, 8, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 32760, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 16376, 54600, 8, 63096, 34488, 10920, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 29784, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 32760, 8, 8, 7288, 21848, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 12280, 6552, 32760, 49144, 27640, 9592, 8, 8, 65528, 54600, 8, 8, 8, 8, 65528, 21848, 56168, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 16376, 21848, 8, 65528, 49144, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 16376, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 65528, 8, 65528, 8, 8, 8, 32760, 8, 43688, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 56168, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 65528, 62072, 8, 8, 64872, 57048, 8, 8, 8, 8, 8, 8, 65528, 39320, 65528, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 65528, 65528, 65528, 8, 65528, 63944, 65528, 8, 65528, 56424, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 63176, 57480, 8, 8, 65528, 52424, 8, 8, 65528, 65528, 39320, 8, 65528, 5464, 65528, 8, 65528, 65528, 8, 8, 65528, 8, 65528, 8, 65528, 8, 16376, 8, 65528, 8, 8, 8, 65528, 65528, 65528, 65528, 32760, 8, 13112, 8, 65528, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 56488, 65528, 10920, 8, 8, 65528, 8, 65528, 8, 8, 65528, 62872, 8, 8, 8, 8, 65528, 8, 65528, 62504, 8, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 65528, 55448, 8, 8, 65528, 65528, 8, 8, 65528, 52424, 8, 8, 65528, 65528, 8, 8, 65528, 49144, 8, 8, 65528, 52424, 8, 8, 65528, 65528, 8, 8, 65528, 8, 26216, 65528, 49144, 65528, 8, 8, 65528, 19656, 8, 8, 65528, 65528, 8, 8, 65528, 65528, 8, 65528, 65528, 56168, 8, 8, 65528, 65528, 8, 8, 65528, 65528, 8, 8, 65528, 65528, 8, 8, 65528, 65528, 8, 8, 65528, 8, 8, 8, 65528, 58968, 8, 8, 65528, 32760, 8, 8, 65528, 32760, 8, 8, 65528, 32760, 8, 8, 65528, 65528, 8, 8, 65528, 65528, 8, 8, 49144, 21848, 8, 8, 65528, 8, 8, 8, 65528, 13592, 8, 8, 65528, 65528, 8, 8, 65528, 32760, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 65528, 65528, 8, 8, 65528, 44744, 8, 8, 65528, 33976, 8, 8, 65528, 57064, 8, 8, 65528, 54792, 65528, 8, 65528, 37592, 8, 8, 65528, 64792, 8, 8, 65528, 48056, 8, 8, 65528, 26216, 8, 8, 65528, 47880, 8, 8, 65528, 65528, 8, 8, 65528, 32760, 8, 8, 65528, 42728, 18728, 8, 53608, 65528, 31544, 8, 65528, 59352, 8, 8, 65528, 38536, 8, 8, 65528, 52424, 65528, 21848, 54600, 54600, 7288, 6552, 65528, 64840, 8, 8, 65528, 31448, 8, 8, 65528, 61160, 51480, 65528, 65528, 41256, 8, 65528, 65528, 62664, 8, 8, 65528, 65528, 8, 8, 65528, 65528, 63176, 65528, 61432, 62072, 65528, 8, 65528, 65528, 8, 8, 65528, 63480, 8, 8, 65528, 8, 8, 8, 65176, 64456, 17864, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 65528, 57784, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 65528, 36344, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 44552, 65528, 48280, 8, 3672, 29704, 8, 8, 8, 8, 8, 8, 8, 8, 46808, 8, 64424, 65528, 8, 65528, 37448, 12280, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 13384, 65528, 65528, 8, 7384, 3448, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 8, 57960, 65528, 65528, 8, 18200, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 65528, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 60840, 65528, 8, 65528, 26040, 4680, 8, 8, 8, 8, 65528, 8, 43688, 8, 8, 8, 43688, 65528, 8, 65528, 8, 8, 32760, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 49144, 65528, 8, 65528, 16376, 8, 65528, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 37560, 65528, 34328, 32760, 45352, 4680, 49576, 8, 23304, 8, 60280, 8, 36408, 8, 39320, 8, 59464, 65528, 11912, 32760, 31448, 8, 40040, 8, 46808, 8, 21192, 8, 45864, 8, 48280, 8, 50488, 65528, 60888, 14568, 17448, 3096, 56312, 8, 41688, 8, 65528, 8, 28872, 8, 14568, 8, 58248, 65528, 8, 65528, 58888, 4376, 8, 8, 11000, 8, 8, 8, 8, 8, 8, 8, 55496, 65528, 37032, 35496, 9464, 4616, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 56648, 65528, 5464, 65528, 15320, 7768, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 63256, 65528, 8, 65528, 48760, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 41144, 65528, 8, 65528, 58456, 63400, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 21848, 65528, 8, 8, 39560, 1096, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 2088, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 45496, 65528, 16376, 47656, 43288, 19656, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 25208, 65528, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 56168, 65528, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 21848, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 43688, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 21848, 8, 45368, 8, 39912, 8, 8, 8, 9368, 8, 8, 8, 8, 8, 8, 8, 59608, 8, 4376, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 3640, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 32760, 8, 8, 8, 65528, 8, 32760, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 8, 21848, 8, 65528, 8, 65528, 8, 8, 8, 65528, 8, 65528, 8, 32760, 8, 8, 8, 8, 8, 65528, 8, 65528, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 65528, 8, 65528, 8, 65528, 8, 8, 65528, 32760, 8, 8, 8, 8, 8, 65528, 8, 58104, 8, 21848, 8, 8, 8, 39320, 65528, 8, 8, 65528, 65528, 21848, 8, 50968, 65528, 35736, 8, 34680, 8, 18024, 8, 52424, 65528, 21848, 8, 23128, 8, 30584, 8, 8, 8, 32760, 8, 56168, 8, 26216, 8, 40728, 8, 59560, 8, 54600, 8, 8, 8, 22936, 8, 32760, 8, 40088, 8, 39320, 8, 65528, 8, 24344, 8, 60840, 65528, 28088, 8, 65528, 58248, 65528, 8, 38072, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 32760, 8, 32760, 8, 8, 8, 8, 65528, 8824, 65528, 19272, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 28088, 65528, 24072, 8, 8, 8, 8, 8, 5960, 65528, 52424, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 57336, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 65528, 65528, 8, 8, 8, 26216, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 65528, 65528, 8, 8, 65528, 60488, 8, 8, 65528, 8, 8, 8, 65528, 32760, 8, 8, 65528, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 19272, 63176, 18200, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 65528, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 32760, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 13800, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 17864, 8, 17448, 8, 8, 8, 8, 8, 62824, 8, 65528, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 61192, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 32760, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 32760, 8, 16376, 8, 8, 8, 65528, 8, 8, 8, 21848, 8, 16376, 8, 61240, 8, 65528, 8, 61048, 8, 65528, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 65528, 8, 65528, 35736, 32760, 8, 16376, 8, 49144, 32760, 32760, 32760, 65528, 8, 65528, 8, 46808, 24568, 65528, 8, 65528, 8, 8184, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 65528, 8, 26120, 2856, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 21848, 65528, 9368, 8, 8, 8, 8, 8, 27304, 65528, 8, 8, 8, 8, 8, 8, 23832, 65528, 6664, 8, 8, 8, 8, 8, 52424, 8, 8184, 8, 8, 8, 8, 8, 16808, 65528, 49144, 8, 8, 8, 8, 8, 21848, 8, 35096, 8, 8, 8, 8, 8, 32760, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 27304, 65528, 14328, 8, 8, 8, 8, 8, 32760, 65528, 8, 8, 8, 8, 8, 8, 28088, 65528, 8, 8, 8, 8, 8, 8, 21848, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 16376, 8, 45368, 8, 8, 8, 8, 8, 21848, 65528, 29784, 8, 8, 8, 8, 8, 16376, 8, 32760, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 32760, 65528, 5240, 8, 8, 8, 8, 8, 10920, 8, 48856, 8, 8, 8, 8, 8, 21192, 65528, 3768, 8, 8, 8, 8, 8, 21848, 8, 46808, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8184, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 65528, 65528, 8, 8, 65528, 58616, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 56168, 8, 8, 65528, 32760, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 21848, 8, 65528, 65528, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 25640, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 65528, 65528, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 51480, 8, 8, 65528, 59560, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 65528, 32760, 8, 8, 65528, 8, 8, 8, 65528, 32760, 8, 8, 65528, 65528, 8, 8, 65528, 14568, 8, 8, 65528, 65528, 8, 8, 65528, 65528, 8, 8, 65528, 8, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 65528, 8, 8, 65528, 65528, 8, 8, 65528, 43688, 8, 8, 65528, 65528, 8, 8, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 65528, 8, 8, 65528, 60920, 8, 8, 65528, 8, 8, 8, 65528, 65528, 8, 8, 65528, 65528, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 8, 8, 65528, 8, 8, 8, 65528, 8, 8, 65528, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8}
 
 #endif // TEXT1_H_
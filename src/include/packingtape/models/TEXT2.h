@@ -2,6 +2,6 @@
 #define TEXT2_H_
 
 // vim.
-#define TEXT2_Data_d {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 3071, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 73, 3329, 1824, 0, 0, 0, 0, 0, 3942, 0, 764, 0, 0, 0, 0, 0, 1345, 1699, 1359, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1638, 4095, 2467, 0, 0, 0, 0, 0, 27, 4095, 1858, 0, 0, 0, 0, 0, 1216, 4029, 1375, 0, 0, 0, 0, 0, 271, 1712, 1242, 0, 4095, 0, 0, 0, 1489, 0, 0, 0, 0, 1365, 0, 0, 7, 0, 1660, 0, 0, 0, 0, 0, 1020, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1291, 2047, 4095, 0, 0, 0, 0, 0, 0, 0, 3071, 0, 0, 0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 1739, 1023, 4095, 0, 0, 0, 0, 0, 2348, 3854, 0, 0, 0, 0, 0, 0, 2548, 4095, 0, 0, 0, 0, 0, 0, 2586, 0, 0, 0, 4095, 0, 0, 0, 2145, 0, 0, 0, 0, 0, 0, 0, 3071, 4095, 0, 0, 0, 0, 0, 0, 3350, 0, 0, 0, 0, 0, 0, 0, 3071, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 2730, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 1294, 0, 1462, 0, 0, 0, 0, 0, 958, 0, 0, 0, 0, 0, 0, 0, 1632, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 177, 1621, 1243, 3581, 2166, 1736, 0, 0, 3123, 2109, 0, 0, 0, 0, 2047, 0, 704, 3983, 585, 0, 604, 0, 0, 0, 1260, 224, 0, 0, 0, 0, 2730, 0, 1320, 1958, 660, 1861, 1293, 144, 0, 4095, 712, 1023, 0, 0, 0, 0, 2047, 4095, 52, 806, 0, 0, 0, 0, 0, 0, 2167, 455, 0, 0, 0, 0, 2047, 0, 16, 0, 0, 0, 0, 0, 0, 0, 2964, 890, 0, 0, 0, 0, 2047, 0, 273, 3071, 0, 2047, 1320, 2178, 3164, 2047, 1365, 702, 2848, 1755, 0, 0, 2047, 0, 35, 819, 0, 0, 1323, 0, 0, 0, 2925, 127, 0, 0, 0, 0, 2457, 0, 3403, 2047, 585, 4056, 1316, 963, 0, 0, 1663, 2155, 0, 0, 0, 0, 2925, 0, 1082, 2649, 1806, 712, 1687, 19, 153, 0, 0, 4095, 0, 0, 0, 0, 3807, 0, 1814, 1538, 0, 0, 0, 0, 3934, 2677, 2850, 853, 3854, 3412, 4095, 0, 3996, 0, 2445, 778, 0, 0, 1247, 0, 0, 0, 469, 3204, 0, 0, 0, 0, 2047, 0, 984, 3019, 0, 0, 0, 0, 0, 0, 1251, 323, 0, 0, 0, 0, 3861, 0, 27, 2047, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 2047, 0, 740, 3287, 4095, 0, 1365, 0, 0, 4087, 0, 0, 0, 0, 0, 0, 1293, 0, 2047, 1023, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2925, 1686, 4027, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 3613, 0, 3203, 3000, 3315, 4095, 0, 4079, 0, 0, 4095, 1426, 0, 0, 0, 0, 3465, 2340, 2580, 3156, 1023, 4095, 0, 0, 0, 767, 0, 1014, 0, 0, 0, 0, 2457, 2457, 2957, 156, 0, 4095, 0, 0, 0, 0, 4095, 1660, 0, 0, 0, 0, 2047, 0, 3583, 742, 0, 4095, 0, 0, 0, 0, 4095, 1677, 0, 0, 0, 0, 2047, 341, 2605, 585, 0, 4095, 511, 0, 0, 728, 0, 959, 0, 0, 0, 0, 2047, 585, 2730, 1365, 0, 4095, 0, 0, 0, 0, 0, 102, 0, 0, 0, 0, 2047, 558, 2730, 56, 0, 4095, 0, 0, 0, 0, 4095, 886, 0, 0, 0, 0, 2457, 831, 2047, 623, 0, 4095, 0, 0, 0, 0, 0, 2146, 0, 0, 0, 0, 2730, 1077, 3386, 1463, 0, 4095, 0, 0, 0, 0, 0, 3071, 0, 0, 0, 0, 2047, 2047, 3276, 84, 0, 4095, 0, 0, 0, 2022, 4095, 1570, 0, 0, 0, 0, 2925, 1061, 438, 293, 0, 0, 819, 0, 0, 4095, 4095, 2174, 0, 0, 0, 0, 4059, 0, 0, 61, 0, 0, 0, 0, 0, 0, 4095, 533, 0, 0, 0, 0, 2047, 0, 0, 3528, 0, 0, 3185, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3276, 0, 2, 4035, 0, 0, 0, 0, 0, 780, 0, 0, 0, 0, 0, 0, 1365, 1116, 0, 4095, 0, 0, 0, 0, 0, 1365, 0, 0, 0, 0, 0, 0, 3276, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 21, 1862, 0, 3682, 3081, 1729, 2940, 31, 1394, 887, 1262, 2371, 4095, 0, 511, 0, 1404, 606, 2730, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 455, 1134, 0, 2866, 3859, 1023, 1638, 3071, 0, 951, 1638, 969, 0, 4095, 0, 1365, 2047, 2535, 455, 3057, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 1820, 2535, 1930, 1618, 435, 1852, 0, 2047, 1820, 1032, 3104, 2306, 1365, 4095, 0, 3150, 1755, 2925, 614, 3640, 2730, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 341, 439, 2047, 3940, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 511, 0, 1365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 2835, 0, 0, 4080, 0, 1791, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 819, 0, 3185, 71, 1194, 3629, 0, 0, 0, 0, 4095, 0, 0, 4095, 4095, 585, 4095, 341, 3572, 1116, 2730, 3276, 0, 3412, 4095, 0, 3738, 4095, 356, 0, 3640, 3543, 3453, 1324, 3896, 1023, 1512, 1188, 0, 1453, 2245, 1718, 0, 4037, 4037, 0, 4095, 0, 3232, 0, 2975, 585, 3753, 4095, 2047, 0, 4095, 0, 490, 2925, 1391, 0, 4095, 0, 0, 0, 1228, 3692, 1585, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 2841, 352, 2400, 1040, 2010, 4095, 2047, 4066, 1713, 2047, 1890, 1023, 4095, 0, 0, 0, 3549, 871, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 3416, 103, 630, 0, 2118, 546, 2419, 0, 946, 2426, 1738, 0, 98, 2989, 0, 0, 4095, 0, 0, 4032, 4095, 0, 0, 0, 4095, 178, 0, 0, 4095, 0, 4095, 4095, 765, 397, 104, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 2408, 549, 2047, 1068, 3247, 165, 1833, 67, 2978, 1547, 2047, 780, 0, 4095, 4095, 0, 2457, 0, 3071, 0, 206, 2885, 3336, 646, 4095, 0, 0, 0, 1848, 2677, 780, 0, 4095, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 407, 0, 3937, 4095, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 3439, 0, 3276, 0, 0, 0, 0, 0, 0, 1590, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 4095, 4095, 4095, 0, 0, 682, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 1365, 0, 0, 0, 3981, 0, 4095, 0, 4095, 0, 0, 1365, 4095, 2730, 0, 4095, 4095, 4095, 349, 2730, 0, 4095, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 4095, 1023, 0, 0, 0, 4095, 4095, 3276, 0, 4095, 0, 0, 0, 3276, 315, 0, 4095, 4095, 579, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 2653, 0, 4095, 0, 0, 0, 0, 2047, 0, 0, 0, 4095, 0, 4095, 0, 431, 1228, 949, 282, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 870, 1388, 0, 2388, 4095, 0, 4095, 2233, 0, 4095, 0, 4095, 0, 50, 455, 0, 4095, 2649, 81, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 2730, 1077, 637, 1718, 826, 246, 1861, 4095, 4095, 4095, 1742, 0, 4095, 0, 4095, 0, 2047, 1950, 0, 0, 3614, 10, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 2047, 1911, 511, 1279, 1534, 0, 2047, 0, 0, 4095, 2340, 0, 4095, 0, 4095, 0, 710, 1302, 0, 4095, 3332, 1604, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 1204, 0, 1706, 3456, 0, 1706, 0, 0, 4095, 1482, 0, 4095, 0, 4095, 0, 0, 0, 0, 4095, 2131, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 372, 4095, 0, 910, 1095, 0, 2233, 0, 0, 4095, 1861, 4095, 4095, 0, 4095, 0, 1549, 4095, 0, 0, 1769, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 1365, 4095, 0, 2047, 2509, 0, 2047, 0, 0, 4095, 1737, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 840, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 1433, 4095, 0, 2047, 2603, 1915, 1927, 0, 0, 4095, 1883, 0, 4095, 0, 4095, 0, 4095, 0, 0, 4095, 1121, 2408, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 2328, 4095, 0, 2047, 1850, 0, 1365, 0, 0, 4095, 1585, 0, 4095, 0, 4095, 0, 2730, 0, 0, 0, 2194, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 1183, 4095, 0, 866, 1831, 56, 2457, 0, 0, 4095, 2766, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 910, 4095, 0, 2730, 694, 0, 2233, 0, 0, 4095, 1556, 0, 4095, 0, 4095, 0, 2248, 898, 0, 4095, 2852, 83, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 2722, 4095, 23, 4095, 3835, 1261, 0, 0, 0, 0, 1023, 4095, 0, 0, 4095, 0, 4095, 4095, 0, 4095, 3465, 19, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 3232, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 4095, 3251, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 799, 0, 0, 83, 3583, 0, 0, 0, 0, 2047, 2340, 819, 0, 4095, 0, 2694, 4095, 4095, 4095, 2275, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 2, 3640, 455, 4081, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 3412, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 2730, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 43, 3866, 3035, 3799, 54, 0, 3290, 378, 2483, 3177, 348, 3196, 2457, 940, 4079, 3448, 3437, 1999, 102, 1796, 3224, 1901, 3930, 7, 0, 0, 0, 0, 0, 2047, 2047, 0, 1489, 2999, 567, 3967, 3350, 3916, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 2047, 2252, 0, 2925, 4095, 1901, 2047, 0, 4095, 2925, 0, 767, 0, 0, 4095, 4095, 4095, 0, 0, 3717, 2314, 1911, 3276, 917, 2275, 0, 0, 0, 0, 0, 0, 0, 4095, 1706, 0, 2303, 2925, 1535, 4095, 0, 2705, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 1170, 3854, 0, 0, 4095, 2047, 0, 901, 2413, 1686, 1456, 3937, 3372, 4095, 0, 3649, 431, 0, 0, 4095, 1535, 4095, 341, 3818, 2593, 273, 1742, 2694, 2674, 0, 4095, 0, 0, 0, 0, 930, 1861, 1890, 0, 1652, 1521, 2375, 819, 0, 4095, 0, 0, 3327, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 4095, 1365, 895, 0, 2219, 2626, 0, 4095, 3685, 1563, 945, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 3640, 0, 3276, 0, 3854, 3071, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1324, 2233, 1566, 4095, 0, 0, 0, 1194, 9, 0, 0, 1755, 240, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1023, 163, 0, 0, 952, 3861, 81, 0, 4095, 2815, 3003, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 409, 0, 0, 0, 0, 0, 0, 0, 0, 2275, 431, 0, 0, 0, 0, 0, 2795, 3583, 0, 0, 1170, 0, 0, 0, 0, 0, 975, 0, 28, 0, 0, 2730, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 390, 0, 0, 0, 63, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2205, 1638, 1508, 0, 2205, 0, 0, 369, 3843, 455, 1675, 4095, 744, 0, 0, 0, 3839, 0, 955, 0, 4095, 0, 0, 3872, 2586, 0, 1883, 3372, 3276, 0, 0, 0, 3480, 0, 1535, 0, 0, 0, 0, 431, 3753, 1023, 284, 646, 3071, 4095, 0, 0, 3924, 0, 910, 0, 0, 0, 0, 0, 3663, 0, 1861, 0, 4095, 0, 0, 0, 3603, 2730, 819, 0, 0, 0, 0, 764, 1855, 3884, 1480, 1320, 3613, 3797, 1535, 0, 303, 0, 4095, 4095, 4095, 1365, 3692, 2116, 2915, 1213, 1971, 3263, 1638, 1365, 1638, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 113, 910, 4095, 0, 4095, 1638, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 536, 73, 263, 511, 819, 4095, 2792, 0, 511, 3495, 436, 2457, 1320, 2303, 0, 4095, 3614, 2628, 522, 1603, 2838, 2557, 682, 0, 0, 2730, 1272, 0, 0, 0, 0, 0, 0, 3510, 409, 0, 0, 0, 4095, 0, 0, 3974, 4095, 0, 0, 0, 0, 0, 0, 4095, 2233, 0, 0, 0, 0, 0, 0, 3412, 3851, 0, 0, 0, 0, 0, 467, 3802, 31, 1228, 3606, 819, 4095, 0, 0, 4095, 0, 1820, 4095, 0, 4095, 0, 2649, 1260, 1835, 2925, 3412, 4095, 0, 0, 0, 1879, 1924, 118, 0, 1365, 0, 0, 2957, 1575, 3379, 4095, 3209, 1849, 3983, 0, 0, 0, 1681, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 585, 3436, 0, 0, 945, 0, 0, 22, 1170, 152, 4035, 1911, 124, 0, 0, 0, 315, 2667, 0, 0, 0, 0, 0, 3748, 2564, 1365, 1927, 2464, 1102, 0, 0, 0, 315, 3552, 0, 0, 0, 0, 0, 0, 2801, 1890, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 4095, 0, 0, 0, 0, 0, 240, 2900, 0, 0, 0, 0, 0, 67, 141, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 558, 0, 0, 2632, 219, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1389, 1053, 0, 0, 0, 0, 0, 0, 3465, 0, 0, 0, 0, 0, 0, 2340, 0, 2047, 0, 0, 3780, 0, 0, 879, 4095, 1564, 0, 0, 0, 0, 0, 3232, 0, 1605, 0, 0, 0, 0, 0, 812, 3900, 893, 0, 0, 0, 0, 0, 4095, 3583, 1228, 0, 4095, 0, 0, 0, 4095, 0, 2303, 0, 0, 0, 0, 0, 315, 0, 1811, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 89, 0, 4095, 904, 297, 0, 0, 3896, 4095, 2047, 0, 1365, 4095, 0, 0, 0, 2457, 3989, 0, 191, 4095, 4095, 0, 0, 0, 521, 4038, 786, 0, 3071, 752, 0, 1365, 120, 4095, 103, 0, 1279, 4095, 0, 0, 0, 4095, 438, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 105, 4051, 2866, 0, 0, 0, 0, 44, 0, 0, 4095, 0, 1365, 0, 0, 0, 224, 4054, 2355, 0, 0, 0, 4095, 2233, 238, 3722, 877, 4095, 1706, 0, 0, 0, 121, 3854, 420, 0, 1724, 0, 0, 0, 0, 4095, 3401, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 722, 4095, 646, 0, 0, 0, 0, 0, 0, 4095, 3164, 0, 0, 0, 4095, 0, 0, 4095, 4040, 0, 0, 0, 0, 0, 0, 0, 3071, 0, 0, 0, 0, 4095, 315, 0, 3412, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2730, 1582, 3042, 4095, 1774, 2279, 1101, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3839, 0, 0, 0, 0, 0, 0, 4095, 0, 321, 1407, 2155, 3476, 0, 2559, 1116, 0, 0, 0, 0, 0, 0, 2730, 1668, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 1535, 1501, 0, 4095, 0, 0, 4087, 2178, 4087, 1089, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 1365, 2259, 0, 780, 2730, 0, 1592, 2739, 2401, 3692, 0, 2866, 1023, 0, 0, 0, 0, 0, 0, 2649, 1092, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 267, 1820, 0, 0, 0, 0, 0, 1307, 1476, 3659, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 2730, 4095, 0, 0, 3071, 1820, 0, 945, 4095, 0, 0, 3222, 1757, 1596, 0, 2559, 409, 0, 0, 0, 0, 0, 255, 2293, 1501, 0, 0, 0, 0, 0, 0, 4095, 341, 0, 0, 44, 1755, 1911, 0, 0, 0, 0, 3708, 1182, 4033, 429, 0, 3327, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 4095, 0, 2388, 0, 3071, 0, 0, 0, 2956, 2327, 1253, 0, 3549, 409, 0, 0, 4095, 0, 0, 0, 2702, 1553, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 3863, 2945, 360, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 255, 361, 0, 0, 2866, 0, 0, 0, 1305, 1760, 2858, 0, 3549, 455, 0, 0, 4095, 0, 0, 0, 3098, 1083, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 1151, 0, 0, 0, 0, 0, 4095, 3998, 3915, 1566, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 2047, 0, 0, 0, 0, 0, 819, 1665, 2744, 1796, 0, 3217, 327, 0, 0, 0, 0, 0, 0, 2175, 1068, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 1535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 2886, 0, 0, 0, 0, 0, 0, 1941, 1795, 910, 0, 2520, 945, 0, 0, 0, 0, 0, 0, 2730, 1404, 0, 0, 0, 0, 0, 0, 0, 3753, 0, 0, 0, 1365, 0, 0, 0, 0, 0, 4095, 1621, 3013, 1678, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 0, 1989, 0, 0, 0, 4095, 0, 0, 2440, 3757, 2832, 0, 2457, 1638, 0, 0, 0, 4095, 0, 0, 2520, 1592, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 682, 4095, 0, 0, 0, 0, 0, 0, 3849, 3435, 1140, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 2155, 0, 0, 1714, 0, 0, 3223, 1149, 3289, 831, 0, 2730, 1755, 0, 0, 0, 0, 0, 0, 3315, 1755, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 163, 0, 0, 0, 0, 0, 682, 3986, 1959, 1050, 0, 3071, 1820, 0, 0, 0, 0, 0, 0, 2730, 1417, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 819, 0, 0, 0, 0, 0, 2047, 2821, 729, 3591, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3818, 0, 23, 2470, 0, 0, 56, 511, 0, 3678, 2017, 991, 457, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 2965, 3818, 1297, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4001, 0, 0, 0, 0, 0, 0, 0, 0, 0, 546, 2590, 3150, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 1643, 140, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 1023, 0, 2121, 0, 1137, 4095, 0, 0, 2089, 3867, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 2047, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 327, 0, 0, 0, 0, 0, 4095, 4095, 0, 910, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 2, 0, 4095, 4095, 4095, 4095, 4095, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 4095, 43, 0, 0, 4095, 0, 0, 0, 3459, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 0, 4095, 1201, 54, 385, 4002, 4067, 130, 1320, 1445, 2047, 534, 252, 3847, 1323, 4095, 1986, 1365, 324, 3611, 885, 3553, 1149, 1065, 1934, 1118, 3015, 2047, 4095, 0, 2415, 4084, 2233, 2111, 723, 3789, 2086, 2074, 2376, 10, 2265, 711, 2998, 722, 4027, 3090, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2275, 1861, 3566, 0, 2641, 1652, 0, 823, 4013, 215, 4095, 4095, 4095, 455, 0, 558, 2801, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 2670, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 1535, 0, 0, 1737, 2583, 0, 141, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 3999, 0, 4095, 1023, 0, 0, 1545, 4095, 0, 2730, 0, 0, 0, 1365, 0, 0, 0, 0, 3310, 1305, 1228, 2520, 3583, 1755, 4095, 1023, 0, 2835, 3583, 2866, 0, 0, 0, 0, 4095, 0, 4095, 0, 4095, 0, 0, 0, 3071, 0, 0, 0, 2559, 1462, 0, 0, 3327, 1279, 0, 2815, 2866, 0, 0, 4095, 1102, 0, 0, 3150, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 2586, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1730, 1861, 1414, 4095, 0, 0, 0, 4095, 0, 0, 0, 2155, 1445, 0, 0, 538, 517, 2549, 3956, 4038, 170, 75, 1513, 2370, 0, 0, 4095, 0, 595, 4095, 0, 4095, 3795, 3854, 0, 2340, 0, 0, 0, 0, 2205, 2457, 2431, 0, 3613, 0, 0, 4095, 1719, 2978, 431, 2632, 585, 1516, 1228, 0, 2481, 1927, 2303, 2457, 0, 4095, 0, 0, 0, 3185, 1260, 0, 0, 0, 0, 0, 1650, 0, 0, 2233, 819, 2457, 0, 1965, 2483, 0, 2399, 4036, 2507, 0, 4095, 0, 0, 0, 2047, 4095, 0, 0, 0, 107, 0, 2730, 0, 0, 0, 0, 0, 0, 2730, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 819, 0, 0, 0, 0, 0, 0, 0, 0, 0, 132, 0, 0, 0, 3465, 1365, 2047, 0, 3071, 0, 0, 0, 3767, 0, 945, 2118, 1890, 819, 0, 43, 523, 0, 2992, 3276, 4095, 0, 4095, 0, 3802, 0, 2764, 4095, 0, 0, 0, 0, 3780, 0, 1365, 0, 4095, 0, 0, 0, 3948, 0, 1820, 0, 0, 0, 0, 0, 3908, 3847, 1194, 4095, 0, 0, 0, 0, 3867, 0, 1820, 4095, 3780, 0, 0, 0, 3916, 2730, 1023, 0, 0, 0, 0, 0, 3879, 0, 1575, 0, 0, 0, 0, 4095, 240, 0, 998, 0, 0, 0, 4095, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1922, 3962, 1365, 0, 1684, 204, 0, 2730, 455, 0, 0, 0, 4095, 0, 0, 585, 1470, 1801, 2730, 0, 0, 0, 0, 2340, 0, 315, 0, 0, 0, 0, 0, 3276, 558, 0, 0, 0, 0, 0, 0, 3809, 1068, 0, 0, 0, 0, 0, 0, 2457, 2970, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 2340, 0, 4095, 0, 0, 0, 0, 4095, 982, 0, 409, 0, 0, 0, 2730, 1681, 0, 3549, 3955, 0, 0, 4095, 0, 3814, 0, 3685, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 3549, 4095, 0, 0, 0, 0, 0, 0, 3948, 0, 0, 0, 0, 0, 4095, 0, 3071, 341, 4095, 682, 1592, 0, 0, 0, 4095, 0, 4095, 0, 4095, 0, 3523, 0, 2140, 3846, 4095, 4095, 4095, 0, 1023, 1365, 1638, 2730, 4095, 0, 2559, 0, 4095, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 432, 1023, 3276, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 4095, 0, 1319, 0, 4095, 0, 4080, 0, 3937, 0, 4058, 0, 4095, 0, 4095, 0, 4095, 0, 4011, 0, 4095, 0, 4095, 4095, 3315, 0, 3598, 2047, 2698, 0, 4095, 0, 3131, 1365, 2730, 2340, 4040, 0, 3772, 0, 3671, 0, 4095, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 326, 1911, 0, 0, 0, 0, 0, 0, 4019, 344, 0, 2047, 0, 0, 0, 3916, 0, 441, 0, 0, 4095, 0, 84, 1219, 1279, 607, 0, 2730, 0, 3726, 0, 3241, 0, 834, 0, 0, 4095, 0, 4095, 4095, 4095, 847, 0, 4095, 1151, 0, 0, 668, 4095, 2287, 0, 0, 0, 0, 4095, 1410, 3470, 2073, 1462, 4095, 234, 2047, 0, 2965, 585, 3434, 0, 0, 0, 0, 0, 0, 3350, 564, 0, 4095, 0, 0, 0, 0, 0, 1260, 0, 0, 0, 0, 105, 0, 2340, 1112, 1686, 2730, 3628, 1279, 0, 455, 0, 3350, 0, 0, 0, 0, 0, 0, 3071, 232, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 2730, 1348, 0, 4095, 0, 0, 0, 0, 0, 3780, 0, 0, 0, 0, 0, 476, 4095, 568, 0, 1755, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 36, 1686, 3832, 655, 3797, 52, 390, 2349, 303, 455, 1638, 2881, 2047, 2866, 1638, 1755, 4095, 0, 1953, 431, 0, 0, 0, 4095, 0, 0, 0, 70, 0, 0, 0, 4020, 4095, 1246, 731, 1316, 1939, 2047, 1755, 1462, 1575, 3631, 423, 2113, 1638, 819, 4095, 0, 0, 0, 3705, 4095, 0, 0, 0, 0, 0, 0, 606, 3913, 0, 0, 4095, 0, 3339, 3867, 499, 3363, 2698, 3131, 0, 4095, 0, 0, 0, 3640, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 2888, 245, 1644, 333, 529, 567, 4095, 0, 2233, 2559, 2047, 3510, 2559, 3276, 0, 0, 4095, 0, 3465, 151, 2818, 1535, 2730, 240, 1365, 3839, 2047, 292, 0, 0, 0, 3705, 4095, 2196, 1655, 906, 3038, 945, 1645, 2463, 0, 3381, 2334, 2772, 0, 0, 0, 0, 2, 0, 2047, 3340, 706, 1246, 3280, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 910, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 3510, 0, 2730, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 819, 3412, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 2932, 4095, 4095, 3849, 0, 0, 0, 2730, 0, 585, 0, 4095, 0, 4095, 0, 208, 0, 0, 2275, 3670, 19, 550, 204, 511, 100, 1023, 4095, 0, 4075, 0, 0, 0, 3780, 0, 4095, 3462, 4095, 4095, 0, 0, 4095, 0, 0, 0, 4095, 2730, 4095, 3653, 1316, 910, 744, 3185, 585, 1260, 2730, 0, 3924, 0, 2457, 0, 0, 4095, 0, 4095, 0, 3753, 4095, 2418, 361, 4095, 4095, 4095, 0, 1489, 0, 4095, 0, 4095, 0, 3276, 0, 2388, 4095, 606, 2529, 0, 4095, 2632, 0, 2649, 4095, 2559, 0, 4095, 0, 4095, 0, 1023, 0, 2328, 1023, 4095, 0, 2377, 0, 4095, 0, 477, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 4095, 4095, 186, 0, 0, 2457, 0, 0, 0, 4095, 0, 4095, 0, 314, 0, 0, 2388, 4071, 34, 0, 4095, 3038, 0, 0, 4095, 4095, 0, 4095, 0, 4095, 0, 3071, 4095, 469, 184, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3159, 1297, 1740, 269, 3368, 556, 2087, 921, 1690, 2177, 511, 4095, 0, 0, 0, 0, 0, 0, 3412, 4095, 2145, 3654, 0, 0, 3583, 0, 0, 0, 3640, 0, 0, 0, 3276, 0, 170, 3150, 3735, 0, 0, 0, 0, 0, 0, 4095, 3510, 0, 0, 0, 0, 0, 0, 0, 910, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2559, 4095, 2925, 1820, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 146, 4095, 0, 4065, 4095, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 397, 4095, 4095, 4095, 0, 0, 0, 1023, 0, 4095, 4095, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1365, 737, 2150, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2730, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 2730, 1365, 0, 4095, 327, 273, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 1551, 2047, 0, 3131, 3294, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1638, 682, 0, 0, 2310, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 1777, 1785, 1365, 4095, 842, 1562, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 735, 1023, 1755, 558, 372, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 963, 0, 4095, 796, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 853, 4095, 0, 0, 282, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 1023, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 4053, 287, 4095, 1023, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 4095, 4095, 0, 3071, 2047, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 2233, 0, 4023, 0, 0, 191, 2730, 0, 3510, 0, 4095, 0, 0, 0, 0, 4095, 0, 1771, 4095, 0, 3981, 3970, 0, 0, 0, 4095, 0, 1539, 2002, 0, 0, 4095, 4095, 3822, 3276, 0, 1365, 46, 0, 0, 0, 240, 0, 525, 4095, 0, 0, 4095, 0, 182, 0, 0, 4095, 2182, 1672, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 3839, 4095, 1365, 684, 341, 0, 4095, 4095, 0, 4095, 0, 0, 0, 0, 23, 0, 0, 0, 4095, 0, 0, 85, 0, 0, 0, 4095, 4095, 0, 0, 0, 4095, 0, 560, 3510, 0, 4095, 612, 67, 0, 0, 0, 0, 0, 0, 4095, 4095, 4095, 2441, 50, 0, 0, 3276, 1064, 0, 0, 2730, 0, 1228, 0, 0, 0, 0, 4095, 0, 1205, 4095, 4095, 4095, 1796, 0, 133, 0, 0, 3685, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 4095, 1960, 80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 379, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 585, 4095, 0, 4095, 3839, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1365, 0, 0, 102, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 819, 511, 1053, 0, 0, 16, 511, 4023, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 4095, 0, 1365, 1365, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 2730, 0, 4095, 0, 4095, 2340, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 3342, 1808, 487, 2031, 3282, 703, 2457, 4095, 3457, 2569, 459, 1946, 2310, 1260, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 146, 0, 1327, 1724, 2047, 1719, 1890, 3982, 0, 0, 4095, 1462, 1170, 0, 0, 0, 0, 0, 2184, 0, 0, 0, 0, 0, 3812, 0, 4095, 1585, 2492, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 80, 0, 0, 455, 1838, 1565, 204, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 3850, 2774, 465, 3288, 3803, 190, 113, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 511, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 2625, 2613, 963, 0, 0, 0, 0, 0, 3448, 0, 151, 3802, 1228, 1309, 2205, 1965, 2911, 164, 0, 0, 4095, 2419, 1228, 0, 2559, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 3722, 1820, 2481, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 4095, 0, 0, 0, 1170, 0, 0, 1755, 2233, 2326, 1433, 0, 4095, 0, 0, 0, 4095, 0, 0, 4095, 682, 364, 0, 2883, 4095, 33, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 2320, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2392, 2586, 914, 4095, 0, 0, 0, 558, 0, 0, 2155, 2366, 1797, 438, 0, 2730, 620, 0, 4095, 1872, 0, 0, 4023, 1417, 268, 486, 3205, 3092, 546, 0, 0, 4095, 910, 1116, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3937, 0, 4095, 850, 2408, 0, 4095, 0, 1170, 0, 0, 0, 4095, 0, 3071, 0, 0, 0, 0, 292, 3722, 2388, 0, 0, 0, 0, 79, 1776, 269, 707, 2047, 2211, 2349, 0, 2047, 722, 0, 4095, 4095, 0, 4095, 4072, 1852, 2269, 0, 2362, 3886, 1416, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3908, 2047, 409, 0, 1023, 0, 0, 0, 2881, 0, 1508, 1660, 2366, 0, 0, 0, 3900, 0, 1137, 4095, 4095, 0, 4095, 1492, 1477, 205, 3067, 2757, 234, 4095, 0, 4095, 2778, 744, 1365, 0, 4095, 0, 0, 0, 3640, 0, 1489, 0, 0, 4095, 4095, 4095, 2382, 2245, 442, 0, 0, 0, 0, 0, 3916, 3948, 877, 0, 4095, 0, 0, 0, 3583, 2047, 1228, 0, 0, 0, 0, 0, 3984, 0, 1137, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 132, 0, 0, 3443, 3946, 511, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 1010, 525, 0, 0, 4095, 0, 0, 2925, 1365, 0, 4095, 0, 1170, 2259, 328, 83, 578, 2919, 2423, 1950, 0, 0, 4095, 2457, 1365, 0, 0, 0, 0, 0, 0, 2457, 3185, 0, 0, 4095, 4095, 0, 4095, 2457, 1445, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 2218, 0, 0, 0, 0, 0, 0, 0, 1146, 722, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 3396, 3500, 3229, 3694, 4043, 178, 4095, 0, 0, 0, 511, 0, 0, 0, 0, 0, 0, 0, 1675, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1246, 0, 0, 0, 0, 0, 0, 0, 3510, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 2275, 0, 4095, 0, 0, 0, 1873, 1890, 2388, 2340, 2285, 255, 0, 0, 4095, 1535, 1706, 0, 0, 0, 0, 0, 0, 0, 3071, 0, 0, 0, 4095, 0, 4095, 1981, 1901, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 107, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 585, 782, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 98, 4095, 1198, 2694, 0, 0, 4095, 0, 0, 2486, 4095, 2457, 4095, 0, 455, 4095, 1614, 432, 218, 3655, 2812, 0, 0, 0, 4095, 2965, 1365, 141, 0, 0, 0, 0, 0, 1077, 4095, 781, 0, 0, 4095, 0, 4095, 2549, 2492, 682, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 307, 4095, 68, 0, 0, 0, 0, 0, 0, 0, 38, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 303, 143, 2644, 2120, 2457, 0, 4095, 0, 0, 0, 4095, 342, 0, 0, 0, 0, 0, 0, 0, 283, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 1365, 4095, 980, 0, 0, 0, 0, 0, 0, 4095, 3247, 0, 0, 0, 0, 898, 4095, 1981, 0, 0, 0, 4095, 0, 0, 0, 0, 851, 4095, 0, 0, 0, 594, 239, 2091, 3692, 3045, 46, 0, 0, 2559, 258, 3659, 593, 0, 0, 0, 0, 0, 576, 0, 4084, 0, 0, 4095, 0, 4095, 1694, 1638, 0, 0, 0, 0, 0, 0, 819, 4095, 4095, 0, 0, 0, 0, 0, 0, 3854, 0, 0, 0, 0, 0, 33, 4095, 0, 2340, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 4095, 4095, 3303, 3735, 0, 3405, 2876, 2470, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 132, 0, 0, 0, 0, 0, 4095, 0, 1365, 0, 0, 0, 4095, 0, 1462, 3999, 416, 992, 2013, 2529, 3637, 0, 0, 0, 4095, 1365, 2233, 0, 0, 0, 0, 0, 2340, 0, 0, 0, 0, 0, 4095, 0, 4095, 2233, 1989, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 3131, 4095, 0, 0, 0, 0, 0, 189, 4095, 236, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 2047, 4095, 1342, 83, 379, 3209, 3239, 0, 0, 0, 4095, 716, 1638, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 1755, 2559, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 268, 0, 724, 1916, 1489, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 1351, 98, 155, 3694, 890, 318, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1638, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 152, 2457, 99, 699, 0, 0, 4095, 0, 13, 0, 0, 0, 1638, 0, 4095, 3969, 53, 203, 0, 3809, 3586, 2136, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 614, 2047, 0, 0, 4095, 0, 2047, 4095, 273, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 15, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 1279, 692, 0, 3597, 3918, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 3, 0, 0, 0, 0, 0, 3071, 0, 0, 4095, 0, 26, 4095, 0, 0, 0, 4095, 0, 4095, 202, 0, 0, 4095, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 1192, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 341, 0, 0, 4095, 2145, 2059, 127, 0, 775, 2079, 4095, 4095, 0, 0, 0, 2730, 2824, 1226, 0, 481, 3685, 0, 2486, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 2047, 0, 1365, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 58, 4095, 0, 2605, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 4007, 4095, 0, 0, 0, 240, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 240, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 3999, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4085, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 186, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 186, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 585, 0, 4095, 0, 4095, 0, 409, 0, 1023, 3071, 2275, 1820, 1755, 1454, 0, 0, 4095, 2179, 238, 3071, 2632, 4095, 1435, 0, 0, 625, 662, 0, 4095, 4095, 0, 4095, 4095, 4095, 0, 0, 0, 0, 0, 0, 1023, 945, 3613, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2623, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1933, 1801, 1401, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 87, 0, 0, 3802, 0, 0, 0, 1706, 1861, 2632, 2233, 1706, 0, 0, 0, 2123, 54, 2815, 0, 313, 2803, 0, 2457, 1820, 1365, 2397, 3071, 1492, 1587, 1487, 2586, 2184, 0, 0, 0, 0, 0, 0, 4095, 0, 372, 4095, 0, 4095, 0, 0, 0, 0, 8, 1109, 884, 0, 4095, 0, 0, 46, 1717, 1365, 1188, 0, 0, 1023, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2293, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 1324, 0, 0, 0, 0, 0, 0, 0, 1023, 0, 0, 0, 0, 0, 3953, 0, 1890, 0, 3488, 0, 0, 0, 3003, 0, 1092, 0, 0, 0, 0, 0, 3412, 0, 945, 0, 4095, 455, 0, 2047, 3033, 1023, 1861, 2340, 0, 0, 0, 4095, 3185, 1592, 273, 0, 4095, 2586, 4095, 0, 3536, 585, 481, 0, 0, 0, 4095, 4095, 3867, 0, 1638, 195, 0, 0, 4095, 0, 3232, 1638, 585, 0, 4095, 0, 0, 0, 3879, 0, 2388, 0, 0, 0, 0, 0, 3958, 0, 1575, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3158, 4095, 2002, 1251, 2089, 301, 0, 3722, 966, 0, 0, 0, 0, 0, 327, 3583, 292, 4095, 4095, 0, 0, 0, 1462, 2047, 963, 2233, 1706, 4095, 0, 0, 568, 1553, 1479, 2184, 4095, 0, 0, 3887, 0, 227, 653, 4095, 0, 0, 0, 3170, 3071, 3722, 3948, 0, 4095, 0, 0, 4095, 0, 0, 0, 534, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1131, 0, 0, 0, 0, 0, 0, 0, 682, 0, 0, 0, 630, 431, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 268, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2661, 534, 0, 0, 273, 0, 0, 1365, 819, 0, 0, 0, 0, 0, 4095, 0, 1265, 409, 3372, 1050, 902, 380, 0, 0, 0, 0, 0, 0, 0, 0, 2068, 0, 2493, 4017, 3194, 0, 0, 0, 910, 2047, 2957, 2340, 2047, 1939, 0, 0, 4095, 3106, 2223, 135, 560, 0, 1228, 229, 0, 720, 0, 963, 0, 0, 4095, 4095, 4095, 0, 4095, 0, 0, 0, 2047, 0, 0, 2047, 1365, 0, 0, 0, 0, 0, 4095, 0, 37, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3071, 4095, 0, 0, 1170, 0, 0, 4095, 4095, 819, 0, 0, 0, 0, 4095, 0, 491, 3071, 0, 0, 2003, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 585, 0, 4095, 0, 4095, 0, 0, 0, 819, 1158, 0, 0, 0, 0, 0, 0, 3276, 953, 0, 1365, 0, 0, 0, 3204, 0, 3715, 0, 0, 0, 0, 0, 3916, 3071, 961, 2047, 3071, 0, 0, 2340, 2288, 1820, 1780, 3071, 4095, 0, 0, 2598, 1445, 3869, 1029, 3854, 4095, 630, 2851, 0, 466, 4095, 574, 0, 0, 4095, 4095, 4095, 4095, 4095, 1187, 3583, 4095, 0, 2978, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 3685, 642, 0, 4095, 0, 0, 0, 455, 4095, 988, 0, 0, 0, 0, 0, 0, 4095, 608, 0, 4095, 0, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 4095, 451, 0, 85, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 1476, 0, 4095, 0, 0, 0, 0, 3953, 2890, 0, 0, 0, 0, 0, 0, 2047, 877, 0, 910, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 368, 585, 4095, 0, 0, 0, 130, 4095, 2835, 0, 0, 0, 0, 4095, 4095, 1916, 231, 4095, 0, 1592, 0, 0, 141, 2047, 3199, 0, 0, 0, 4095, 4095, 0, 2184, 0, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 341, 2730, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 519, 682, 3741, 2388, 1890, 2233, 4095, 1644, 2853, 2140, 1625, 0, 0, 2730, 3185, 1433, 1170, 744, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 1365, 2192, 3869, 585, 2275, 3217, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 3276, 682, 2757, 0, 682, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2835, 585, 132, 1774, 3071, 1023, 0, 0, 0, 0, 1365, 1638, 2730, 0, 0, 0, 1638, 2661, 1620, 871, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2730, 819, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1592, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 2047, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 2205, 0, 2730, 0, 4095, 2047, 0, 0, 0, 4095, 0, 0, 4095, 3322, 1072, 2380, 2047, 4095, 2437, 1365, 4095, 3748, 0, 0, 1313, 0, 0, 4095, 2047, 0, 2340, 234, 4095, 0, 4095, 0, 4095, 4095, 0, 0, 4095, 0, 0, 0, 4095, 0, 4095, 0, 3015, 0, 0, 0, 0, 0, 0, 0, 0, 3276, 0, 0, 4095, 0, 0, 0, 3350, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1592, 3412, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 4095, 1445, 75, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 1535, 81, 682, 0, 4095, 910, 0, 0, 1008, 872, 1881, 0, 2925, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 3071, 4095, 1632, 1941, 0, 672, 0, 0, 0, 0, 0, 0, 0, 0, 4037, 93, 2388, 0, 3150, 409, 4095, 2047, 3941, 31, 0, 0, 2559, 511, 0, 0, 0, 0, 2340, 0, 1575, 3531, 4095, 0, 3822, 0, 0, 0, 1295, 1003, 1489, 0, 3465, 0, 0, 0, 12, 0, 2730, 0, 0, 1023, 0, 0, 0, 0, 0, 0, 1053, 2047, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1023, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 3247, 4095, 0, 0, 4095, 0, 0, 4095, 4095, 0, 0, 3685, 4095, 0, 0, 4095, 3220, 0, 0, 4032, 4095, 0, 0, 0, 3879, 0, 0, 0, 4095, 4095, 0, 4095, 4095, 2184, 3071, 0, 4095, 0, 0, 0, 4095, 0, 4095, 4095, 4095, 3510, 0, 2520, 3625, 2047, 0, 4095, 4095, 0, 0, 0, 4095, 0, 0, 4095, 1929, 2047, 4095, 0, 4095, 4095, 3412, 4095, 4095, 0, 0, 3802, 3408, 0, 0, 4095, 4095, 1023, 4095, 0, 3733, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 697, 0, 0, 0, 3412, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 347, 0, 1756, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 994, 1496, 0, 2047, 0, 0, 4095, 1971, 0, 4095, 0, 0, 0, 0, 1106, 4095, 0, 1087, 633, 0, 0, 0, 0, 0, 4095, 0, 0, 173, 409, 4030, 792, 4095, 2520, 379, 403, 1023, 0, 2559, 4095, 2397, 0, 4095, 4095, 4095, 0, 3071, 1243, 4095, 4095, 1905, 327, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 1780, 819, 0, 2340, 1738, 0, 2047, 0, 0, 4095, 2481, 1861, 3217, 0, 4095, 0, 381, 1251, 0, 4095, 655, 43, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 195, 425, 0, 3488, 1844, 0, 1820, 0, 0, 3722, 1809, 0, 2155, 0, 0, 0, 2275, 481, 0, 3931, 1137, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2730, 0, 0, 2047, 2625, 0, 1023, 0, 0, 4095, 2136, 0, 4095, 0, 0, 0, 3510, 0, 0, 0, 2972, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 3867, 2047, 1543, 1188, 877, 4095, 1535, 4095, 2047, 0, 4095, 4095, 4095, 0, 3003, 4095, 4095, 2047, 1365, 1474, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 2136, 0, 0, 2047, 2080, 1170, 1023, 0, 0, 3822, 2129, 0, 4095, 0, 0, 0, 2764, 4095, 0, 4095, 1342, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 38, 4095, 0, 4095, 1764, 0, 819, 0, 0, 4095, 2275, 0, 4095, 0, 0, 0, 1911, 0, 0, 4095, 3057, 172, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1897, 4095, 0, 2047, 1046, 0, 1638, 0, 0, 4095, 2047, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 232, 3412, 1915, 910, 455, 2171, 1266, 1293, 819, 0, 4061, 2559, 95, 0, 1194, 3159, 3530, 0, 1872, 2047, 1365, 3185, 3018, 724, 0, 0, 195, 0, 0, 0, 0, 0, 4095, 0, 1846, 4095, 0, 4095, 1939, 455, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 4032, 0, 0, 0, 86, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 877, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3746, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1755, 0, 4095, 2978, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 819, 0, 495, 4095, 3583, 4095, 2730, 0, 0, 0, 0, 0, 0, 2925, 0, 0, 4095, 1288, 0, 2486, 48, 4095, 1023, 1414, 0, 277, 606, 2537, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3735, 27, 253, 0, 2225, 3942, 20, 853, 2794, 1218, 347, 1755, 0, 511, 0, 0, 963, 0, 1023, 0, 2047, 0, 0, 2730, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 409, 341, 0, 1116, 2377, 2047, 4095, 0, 0, 0, 0, 0, 0, 0, 1023, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 198, 85, 0, 1006, 150, 2632, 1023, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 455, 0, 0, 0, 2047, 2457, 0, 3671, 4095, 3583, 4095, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 2457, 0, 3071, 1946, 2730, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 2457, 0, 3480, 3071, 2047, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 2766, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1934, 2363, 1066, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 80, 0, 0, 3372, 255, 0, 0, 0, 0, 0, 0, 0, 2730, 0, 0, 66, 4095, 2323, 0, 4095, 0, 455, 3578, 546, 985, 4034, 0, 0, 0, 1652, 3583, 0, 0, 4095, 0, 2730, 0, 0, 4095, 0, 240, 819, 20, 4095, 0, 0, 0, 0, 66, 819, 1355, 0, 0, 0, 0, 0, 2951, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2605, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3071, 3579, 0, 2605, 0, 0, 0, 0, 0, 0, 0, 819, 0, 0, 0, 0, 0, 0, 0, 1365, 0, 0, 0, 0, 0, 1110, 0, 1116, 0, 485, 0, 0, 4095, 3357, 572, 2545, 0, 4095, 0, 4095, 0, 3510, 0, 1204, 1927, 4095, 2047, 0, 0, 4007, 0, 945, 0, 3510, 0, 0, 4095, 3890, 3962, 1535, 2571, 4095, 0, 2113, 2422, 3388, 43, 1890, 0, 0, 0, 4095, 4095, 3924, 3846, 1146, 2340, 4095, 0, 4095, 0, 3931, 0, 945, 0, 4095, 0, 0, 0, 3360, 1023, 767, 0, 630, 0, 0, 3460, 2566, 2755, 2990, 0, 4095, 0, 4095, 0, 1489, 0, 0, 0, 4095, 0, 0, 0, 3003, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 1638, 0, 0, 0, 3480, 0, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 146, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 178, 1742, 3722, 0, 0, 0, 0, 0, 3412, 2047, 3549, 3434, 0, 0, 0, 0, 3900, 558, 0, 0, 1575, 0, 0, 15, 1161, 2848, 2559, 2623, 0, 4095, 2388, 0, 57, 82, 1535, 4095, 0, 0, 631, 4095, 3560, 3315, 2047, 63, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4055, 3812, 0, 0, 0, 0, 0, 2233, 0, 3194, 1638, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 924, 170, 0, 0, 0, 0, 0, 1706, 1996, 3592, 3722, 0, 0, 0, 0, 0, 1983, 2227, 0, 0, 0, 0, 0, 0, 0, 2730, 2047, 0, 0, 0, 0, 0, 0, 2457, 0, 0, 0, 0, 0, 2934, 1023, 3448, 4031, 0, 0, 0, 0, 0, 877, 3177, 0, 4095, 0, 0, 0, 0, 511, 3705, 0, 0, 0, 0, 0, 4095, 481, 3476, 0, 3204, 4095, 141, 0, 3276, 3209, 496, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2784, 819, 0, 0, 0, 0, 0, 0, 0, 2677, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3276, 3510, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1365, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3510, 1828, 1544, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1204, 0, 0, 1365, 3102, 1686, 1127, 0, 0, 4095, 0, 0, 3854, 0, 2434, 0, 0, 4095, 0, 0, 1602, 0, 1920, 0, 0, 0, 0, 358, 235, 3941, 1970, 4095, 0, 0, 1365, 0, 361, 3797, 410, 0, 0, 0, 4095, 2047, 290, 4095, 223, 4095, 0, 0, 0, 0, 0, 4095, 333, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 1661, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 211, 3918, 2383, 0, 0, 0, 0, 0, 731, 4056, 1205, 0, 0, 0, 0, 0, 391, 3978, 1474, 0, 0, 0, 0, 0, 0, 0, 1151, 0, 0, 0, 0, 0, 0, 4095, 2559, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 4095, 0, 0, 0, 148, 3654, 2268, 0, 0, 0, 0, 292, 374, 4095, 3139, 0, 0, 0, 0, 2677, 282, 4051, 3208, 628, 2620, 0, 868, 0, 506, 0, 1535, 0, 0, 0, 0, 3510, 926, 4095, 29, 1365, 0, 0, 4095, 0, 0, 4095, 1933, 0, 0, 0, 0, 0, 455, 4095, 2801, 0, 0, 0, 0, 0, 151, 4095, 1638, 0, 0, 0, 0, 0, 0, 4095, 2948, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1355, 1762, 2667, 0, 2724, 2575, 599, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 630, 2223, 0, 2605, 0, 0, 0, 1462, 3993, 2896, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1831, 2263, 0, 0, 0, 0, 3780, 2600, 3764, 2818, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 47, 2730, 1852, 0, 0, 0, 0, 4095, 642, 1184, 3487, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 329, 0, 0, 81, 968, 1638, 390, 4095, 4095, 0, 4095, 3679, 1837, 3284, 0, 0, 0, 0, 0, 614, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 1768, 0, 2091, 0, 0, 0, 0, 4095, 2824, 4095, 1901, 2047, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1890, 0, 0, 0, 0, 4095, 3866, 2294, 2866, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2559, 0, 0, 0, 0, 0, 4095, 3013, 3612, 575, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1137, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4070, 1706, 3658, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 988, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3284, 511, 0, 0, 0, 0, 0, 0, 1535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 66, 1869, 0, 758, 4095, 0, 0, 3932, 3984, 3216, 2630, 0, 0, 0, 4095, 0, 0, 4095, 4095, 0, 3516, 637, 1922, 2003, 2218, 0, 0, 0, 0, 0, 0, 0, 127, 3466, 2730, 0, 85, 1023, 0, 4095, 3927, 1400, 618, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 3583, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 123, 2827, 0, 0, 0, 4095, 0, 4095, 3917, 3318, 3522, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2457, 0, 0, 0, 0, 0, 2167, 2047, 4095, 1890, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2522, 0, 0, 2047, 0, 0, 3764, 3679, 2502, 1410, 0, 0, 0, 0, 4095, 1365, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 776, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1305, 0, 0, 4095, 0, 0, 4095, 3489, 1405, 2998, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1638, 0, 0, 0, 0, 0, 3980, 3689, 890, 3680, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 461, 1209, 0, 0, 4095, 4095, 0, 3744, 3077, 444, 3227, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 2102, 2275, 3250, 1365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3071, 807, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 341, 4095, 0, 0, 0, 0, 0, 4095, 877, 273, 356, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 963, 0, 0, 0, 0, 0, 2632, 0, 3276, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 890, 0, 0, 0, 0, 0, 4095, 2925, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 3583, 4020, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 731, 2385, 1199, 1501, 2155, 2687, 2399, 1549, 3379, 216, 2710, 3071, 0, 0, 4095, 4095, 2047, 1891, 658, 3063, 2666, 1892, 1507, 88, 3265, 2652, 1825, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 1982, 0, 0, 0, 0, 0, 0, 0, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 3974, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3780, 0, 0, 0, 2492, 2002, 1585, 2129, 2275, 4095, 0, 0, 4095, 4095, 0, 0, 734, 0, 0, 2730, 0, 0, 0, 0, 0, 4095, 0, 4095, 3882, 1656, 738, 3515, 4028, 3217, 2200, 0, 479, 905, 487, 1326, 2375, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1535, 0, 0, 0, 466, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 566, 828, 1616, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3455, 0, 0, 0, 2593, 2340, 2340, 1852, 1310, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 3382, 142, 2831, 0, 719, 626, 0, 1072, 0, 16, 4039, 82, 4095, 0, 0, 0, 1023, 0, 481, 1557, 0, 0, 0, 0, 0, 2408, 4095, 0, 0, 0, 0, 0, 3839, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 0, 0, 0, 0, 4061, 0, 3071, 0, 0, 0, 0, 0, 0, 0, 655, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3974, 0, 1365, 0, 1023, 0, 0, 0, 2457, 0, 1365, 0, 0, 0, 0, 0, 2502, 0, 558, 3445, 4095, 0, 1755, 2586, 2850, 2123, 1820, 2047, 2730, 0, 0, 0, 3705, 0, 1638, 0, 4095, 0, 0, 0, 3890, 0, 1365, 0, 0, 0, 4095, 4074, 2303, 3583, 585, 42, 0, 500, 4068, 2047, 1248, 3916, 2866, 4095, 4095, 0, 0, 0, 3908, 0, 1686, 0, 0, 0, 0, 0, 3839, 0, 1260, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1762, 3950, 2801, 455, 1984, 206, 0, 3071, 290, 0, 0, 0, 0, 0, 10, 1137, 2520, 4095, 2216, 4095, 240, 758, 1911, 1954, 2559, 1228, 2529, 3510, 0, 0, 0, 868, 2362, 2047, 4095, 0, 0, 0, 0, 227, 203, 0, 0, 2047, 0, 4095, 1899, 813, 3542, 0, 3595, 60, 42, 3357, 0, 2296, 3312, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 934, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1494, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 1602, 1023, 0, 0, 0, 0, 0, 0, 3422, 0, 0, 0, 0, 0, 4095, 0, 2730, 0, 819, 67, 928, 0, 0, 0, 0, 0, 0, 0, 0, 0, 151, 0, 1145, 4095, 1668, 4095, 2193, 311, 2263, 2097, 1478, 1680, 1897, 3798, 4095, 0, 4095, 2730, 3802, 0, 4095, 0, 0, 4095, 0, 0, 2047, 0, 0, 4095, 4095, 4095, 4095, 3641, 1365, 395, 3685, 0, 1110, 173, 553, 874, 147, 1223, 82, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 3979, 0, 0, 0, 0, 0, 4095, 2340, 0, 0, 0, 0, 0, 4095, 0, 93, 2047, 0, 0, 1396, 0, 0, 3583, 0, 0, 0, 0, 0, 0, 0, 0, 1170, 0, 0, 0, 1638, 0, 0, 0, 2051, 1502, 0, 0, 0, 0, 0, 0, 4095, 1478, 0, 3071, 0, 0, 0, 4095, 1023, 1579, 0, 0, 0, 0, 0, 3622, 2625, 3138, 1204, 4095, 455, 0, 1116, 2190, 1774, 1569, 1279, 4095, 0, 0, 3232, 1006, 1761, 530, 0, 4095, 0, 0, 0, 2102, 4095, 3947, 0, 1365, 2047, 4095, 2457, 858, 2936, 98, 3707, 630, 534, 2633, 0, 1239, 3769, 1170, 0, 0, 0, 0, 0, 0, 585, 327, 0, 2457, 0, 0, 0, 0, 0, 764, 0, 0, 0, 0, 0, 0, 3071, 706, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1981, 485, 0, 599, 0, 0, 0, 0, 0, 3298, 0, 0, 0, 0, 0, 0, 4095, 591, 0, 402, 0, 0, 0, 446, 4095, 3664, 0, 0, 0, 0, 0, 0, 3185, 1233, 3131, 1023, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 0, 4095, 71, 2025, 4095, 0, 409, 0, 103, 0, 1835, 0, 2388, 0, 0, 4095, 0, 819, 2091, 0, 0, 0, 0, 0, 63, 0, 362, 0, 0, 0, 4095, 4095, 0, 3934, 0, 3663, 0, 341, 3895, 0, 677, 2145, 538, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 2457, 390, 117, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 2730, 1365, 0, 4095, 4095, 0, 3276, 0, 0, 0, 0, 3276, 4095, 4095, 3196, 95, 3921, 120, 3329, 0, 1023, 2167, 0, 0, 491, 0, 0, 0, 0, 0, 0, 0, 819, 744, 1204, 1755, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 3491, 3885, 546, 1653, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 327, 204, 234, 0, 491, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 227, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 3705, 4095, 967, 3247, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2016, 3992, 2340, 0, 0, 0, 0, 0, 0, 2340, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 3997, 3873, 1060, 330, 0, 3802, 1475, 686, 178, 3176, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 963, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2632, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 2437, 1116, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 1575, 401, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2774, 77, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 402, 0, 315, 0, 157, 0, 0, 2749, 390, 182, 3350, 0, 0, 0, 0, 0, 4095, 0, 1965, 819, 2795, 178, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 2925, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1302, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3071, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2632, 3276, 0, 0, 0, 2047, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 4095, 4095, 186, 4095, 4095, 4095, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 310, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2188, 682, 1435, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 744, 1780, 4095, 3195, 6, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 3150, 1204, 0, 4095, 682, 1861, 0, 0, 0, 0, 0, 0, 0, 3773, 3434, 641, 3681, 606, 3697, 299, 506, 2627, 0, 2157, 3572, 0, 4095, 0, 0, 0, 0, 0, 2578, 609, 0, 455, 1253, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 493, 1575, 4095, 4095, 2562, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 252, 0, 0, 2105, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 2172, 3640, 0, 1706, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 1460, 3549, 0, 4050, 223, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 2835, 0, 620, 3465, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 2275, 3058, 4095, 4095, 4095, 1235, 3833, 0, 4095, 1931, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 2195, 178, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2388, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1023, 4095, 0, 4095, 3562, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2730, 4095, 0, 0, 2197, 3336, 0, 0, 0, 0, 0, 0, 0, 0, 0, 409, 0, 4095, 4095, 4095, 2252, 0, 0, 0, 0, 0, 0, 3965, 0, 0, 0, 0, 2047, 0, 0, 0, 866, 3656, 0, 0, 0, 0, 0, 4095, 0, 4095, 3775, 715, 3770, 511, 1323, 599, 1935, 3284, 0, 1409, 3989, 3276, 0, 0, 0, 0, 4095, 0, 1028, 2881, 409, 4038, 1140, 67, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 1585, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 146, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1023, 4095, 0, 57, 2445, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 4095, 1618, 0, 2978, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 4095, 4095, 3393, 941, 1589, 4078, 4095, 1908, 485, 0, 1113, 2509, 3480, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3276, 4095, 900, 0, 0, 0, 0, 0, 0, 3357, 0, 0, 170, 1489, 0, 0, 4095, 0, 0, 0, 2275, 3622, 0, 0, 0, 4095, 4095, 4095, 3660, 455, 2490, 0, 445, 0, 88, 3044, 0, 0, 2286, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 341, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 1801, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 3336, 0, 0, 2457, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3854, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2502, 0, 0, 0, 105, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1503, 819, 1415, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 521, 0, 0, 4095, 2391, 421, 117, 0, 0, 0, 0, 0, 1592, 2129, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 1068, 1842, 0, 4067, 2874, 1233, 3964, 0, 3475, 0, 805, 3255, 2596, 947, 3969, 0, 4005, 0, 0, 0, 0, 0, 2613, 423, 0, 0, 0, 0, 528, 1381, 0, 945, 2233, 0, 0, 0, 3916, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 787, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 455, 0, 1638, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 2890, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20, 0, 4095, 4095, 2162, 4095, 1875, 227, 4095, 0, 0, 0, 0, 3583, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 4095, 4095, 2233, 3733, 1260, 3687, 4095, 0, 3921, 0, 3071, 239, 4095, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 3342, 4095, 2713, 1279, 4095, 4095, 0, 0, 0, 3937, 0, 0, 19, 1365, 0, 0, 4095, 0, 4095, 0, 0, 2047, 2047, 0, 0, 4095, 3997, 3765, 4095, 3583, 3855, 0, 1202, 0, 2661, 4073, 0, 1144, 1365, 2457, 3533, 0, 0, 0, 0, 0, 431, 0, 0, 0, 0, 0, 0, 0, 1706, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3948, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 1023, 0, 0, 4095, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 3500, 2569, 22, 4095, 0, 3605, 34, 0, 1058, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3943, 4095, 1116, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1365, 1147, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 712, 0, 0, 0, 0, 0, 0, 0, 3652, 2047, 0, 0, 409, 0, 0, 0, 1755, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 109, 3412, 2531, 0, 0, 0, 4095, 4095, 2047, 4095, 630, 4095, 0, 0, 4095, 0, 2047, 0, 1365, 0, 0, 0, 0, 0, 0, 0, 3090, 0, 0, 0, 0, 0, 0, 0, 3071, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 405, 4095, 554, 0, 0, 0, 0, 0, 0, 0, 3378, 0, 0, 0, 0, 0, 0, 0, 3071, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 4095, 0, 0, 0, 0, 53, 4095, 2866, 0, 4095, 0, 0, 0, 0, 0, 157, 0, 0, 0, 0, 0, 0, 0, 985, 0, 0, 0, 4095, 4095, 0, 4095, 0, 3292, 0, 0, 4095, 25, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 2978, 0, 0, 0, 2253, 2097, 2059, 1720, 2087, 4095, 0, 0, 468, 2047, 2047, 0, 4095, 0, 0, 0, 3412, 0, 0, 0, 0, 4095, 4095, 4095, 4095, 2088, 1957, 0, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 2047, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 4095, 574, 0, 0, 0, 0, 0, 0, 0, 4095, 2730, 4095, 0, 4095, 4095, 0, 0, 1660, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 3071, 4095, 4095, 0, 4095, 0, 3071, 1023, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 219, 0, 0, 3276, 0, 0, 0, 0, 0, 0, 0, 3640, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4027, 0, 0, 4095, 4095, 0, 4095, 0, 1170, 0, 0, 0, 3521, 0, 0, 0, 0, 0, 0, 0, 1638, 0, 0, 0, 0, 0, 0, 0, 3839, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3656, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3276, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 868, 0, 775, 0, 2799, 0, 0, 0, 0, 0, 3405, 0, 866, 0, 3154, 0, 3275, 0, 0, 4095, 916, 0, 0, 0, 0, 0, 49, 0, 1489, 0, 0, 0, 3124, 0, 291, 0, 163, 0, 0, 0, 0, 0, 341, 0, 0, 0, 0, 0, 273, 0, 0, 0, 196, 0, 585, 0, 335, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3819, 0, 3952, 0, 3935, 0, 3998, 0, 3893, 0, 3947, 0, 3916, 0, 4057, 0, 3869, 0, 3890, 0, 2499, 0, 3767, 0, 4051, 0, 4076, 0, 4025, 0, 3956, 4095, 156, 0, 3682, 0, 2630, 195, 4070, 0, 3999, 0, 3943, 0, 4023, 0, 2730, 0, 2047, 0, 0, 4095, 15, 0, 282, 0, 0, 0, 0, 0, 1565, 0, 2457, 0, 3465, 0, 4068, 0, 3966, 0, 4040, 0, 4027, 0, 4086, 0, 4046, 0, 3830, 0, 4004, 0, 3327, 0, 3900, 0, 3775, 0, 4080, 0, 3639, 0, 4081, 0, 3662, 0, 2730, 0, 4075, 0, 3849, 0, 4010, 0, 4032, 0, 4064, 0, 4084, 0, 3120, 0, 2730, 0, 3465, 0, 0, 0, 3213, 0, 0, 0, 1820, 0, 0, 0, 0, 1992, 1861, 1505, 0, 0, 0, 0, 0, 0, 1170, 2031, 0, 0, 0, 0, 0, 722, 1061, 1365, 3185, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 23, 3427, 0, 1365, 3412, 1508, 1228, 1365, 787, 721, 1513, 2047, 1116, 0, 0, 1039, 0, 0, 0, 0, 0, 534, 446, 0, 0, 0, 0, 0, 0, 0, 173, 1047, 0, 3846, 0, 0, 95, 769, 0, 240, 56, 60, 905, 0, 697, 0, 0, 2078, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2167, 0, 0, 0, 0, 2047, 0, 2730, 0, 0, 0, 0, 0, 0, 0, 2605, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 2205, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 1365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 3510, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 2730, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2526, 4039, 2408, 195, 1593, 197, 0, 0, 737, 0, 0, 0, 0, 0, 4095, 0, 1023, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1638, 0, 2866, 4095, 0, 0, 0, 0, 0, 0, 1419, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1023, 0, 0, 0, 0, 0, 1260, 0, 0, 0, 0, 0, 0, 0, 17, 2457, 3157, 4009, 0, 0, 3071, 620, 3839, 1365, 0, 1170, 3854, 28, 1365, 2730, 3770, 1767, 158, 1598, 3094, 2520, 4095, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 2730, 0, 0, 0, 0, 0, 4095, 0, 2205, 1489, 0, 0, 0, 0, 0, 0, 93, 0, 0, 0, 0, 0, 4095, 0, 1164, 0, 716, 564, 769, 0, 779, 0, 4095, 4095, 0, 0, 0, 0, 4095, 0, 1946, 3458, 3350, 1575, 2239, 0, 0, 0, 2275, 4095, 4095, 2340, 4095, 0, 0, 2047, 2730, 0, 4095, 0, 0, 0, 0, 0, 2047, 0, 4095, 0, 4095, 0, 0, 0, 3150, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 111, 4095, 4095, 0, 4095, 0, 4095, 0, 4095, 0, 4095, 0, 4095, 0, 4095, 0, 3780, 4095, 4095, 0, 2559, 0, 0, 4095, 2730, 0, 1365, 0, 4095, 0, 4001, 0, 56, 0, 4095, 4095, 2691, 0, 0, 0, 4095, 0, 4095, 0, 4095, 0, 0, 0, 4095, 0, 4095, 0, 1508, 0, 0, 0, 1122, 1547, 0, 0, 0, 0, 0, 0, 2925, 1170, 0, 4095, 0, 0, 0, 1638, 0, 2115, 0, 0, 0, 0, 0, 0, 1023, 3550, 0, 4095, 0, 0, 0, 215, 0, 1204, 0, 0, 0, 0, 0, 0, 2047, 660, 0, 4095, 0, 0, 0, 0, 4095, 1451, 0, 0, 0, 0, 0, 0, 819, 339, 0, 2457, 0, 0, 0, 0, 4095, 2691, 0, 0, 0, 0, 0, 0, 1260, 518, 0, 847, 0, 0, 0, 261, 4095, 992, 0, 0, 0, 0, 0, 0, 744, 1116, 0, 1755, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 110, 2457, 258, 0, 4095, 0, 0, 0, 0, 0, 2233, 0, 0, 0, 0, 0, 0, 1638, 517, 0, 3071, 0, 0, 0, 0, 0, 3216, 0, 0, 0, 0, 0, 0, 3367, 1198, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 315, 0, 4095, 0, 0, 0, 117, 4095, 1270, 0, 0, 0, 0, 3830, 435, 127, 1023, 0, 4095, 0, 0, 0, 0, 0, 797, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2200, 0, 0, 0, 0, 0, 0, 0, 1228, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 60, 105, 564, 3839, 1924, 2090, 1777, 3685, 1435, 2300, 1879, 3465, 0, 0, 2730, 3393, 1450, 1246, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 682, 787, 0, 0, 0, 2730, 0, 0, 0, 0, 0, 0, 0, 0, 0, 585, 0, 1575, 0, 819, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3113, 0, 853, 215, 161, 811, 0, 0, 0, 0, 3492, 0, 0, 0, 0, 0, 3372, 0, 620, 963, 2225, 1037, 0, 511, 68, 0, 0, 0, 170, 0, 0, 0, 0, 0, 4095, 372, 215, 455, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 2047, 0, 3412, 0, 0, 0, 0, 0, 3276, 0, 0, 0, 0, 0, 4095, 0, 3448, 4095, 1127, 0, 2913, 0, 4095, 0, 127, 0, 4095, 0, 0, 0, 4095, 0, 4095, 0, 2325, 282, 2520, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3276, 4095, 2340, 0, 4095, 0, 4095, 0, 4095, 4095, 240, 0, 4095, 0, 4095, 0, 0, 4095, 3185, 0, 2978, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3412, 0, 2772, 4095, 3071, 0, 4095, 0, 4095, 0, 4095, 0, 2047, 0, 4095, 0, 3722, 0, 819, 0, 1023, 0, 4095, 0, 4095, 0, 3822, 0, 4095, 0, 4095, 0, 0, 0, 1890, 2906, 3900, 682, 4095, 0, 4095, 0, 4095, 4095, 3867, 0, 3276, 0, 3388, 4095, 739, 731, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1995, 0, 2047, 0, 2730, 2184, 585, 4095, 1351, 3150, 1622, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 142, 0, 2340, 0, 978, 363, 0, 0, 0, 85, 0, 4095, 238, 3150, 664, 0, 819, 0, 2167, 0, 0, 2388, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 208, 292, 0, 0, 0, 0, 0, 0, 491, 236, 94, 0, 0, 0, 0, 0, 608, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2123, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1023, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 12, 1365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3613, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 4095, 630, 0, 186, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3685, 4095, 2730, 0, 0, 0, 0, 0, 3583, 0, 0, 0, 0, 1996, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 600, 0, 0, 0, 4095, 0, 0, 0, 455, 0, 0, 0, 0, 0, 0, 1503, 137, 1871, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3071, 1608, 0, 2275, 0, 0, 4095, 1890, 0, 4095, 0, 0, 0, 2047, 1240, 0, 4095, 1211, 47, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 620, 0, 4095, 1791, 694, 315, 0, 4095, 4095, 1185, 0, 3276, 0, 0, 0, 1293, 409, 0, 2275, 3394, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3393, 0, 1246, 1056, 73, 193, 993, 0, 0, 44, 0, 4095, 468, 2520, 924, 0, 3276, 0, 1886, 2175, 1129, 3503, 1562, 369, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 988, 0, 3583, 1518, 595, 1638, 0, 0, 4095, 2586, 0, 3640, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 1614, 4095, 0, 3705, 608, 0, 1023, 0, 0, 4095, 1592, 0, 4095, 0, 4095, 0, 3722, 4095, 0, 4095, 1957, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 2405, 0, 2047, 0, 0, 4095, 2293, 0, 4095, 0, 0, 0, 2047, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3071, 0, 0, 4095, 872, 2314, 3685, 0, 4095, 4095, 2193, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 2649, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2730, 1774, 0, 1365, 0, 0, 4095, 2047, 0, 4095, 0, 4095, 0, 65, 0, 4095, 4095, 1526, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 2649, 4095, 0, 4095, 2123, 0, 2340, 0, 0, 4095, 3412, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2172, 2047, 0, 4095, 1423, 1068, 332, 0, 0, 4095, 2047, 0, 4095, 0, 4095, 0, 1707, 4095, 0, 4095, 1608, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2515, 341, 0, 585, 0, 0, 744, 292, 666, 0, 0, 0, 3815, 0, 0, 0, 722, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 1732, 1365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 819, 4095, 0, 0, 2730, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 910, 4095, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 855, 4095, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 3979, 2555, 670, 314, 1213, 2909, 272, 2756, 2401, 801, 3629, 3520, 749, 0, 2559, 2241, 2555, 223, 2340, 3218, 1748, 3981, 162, 0, 0, 0, 0, 0, 2730, 2047, 0, 1740, 933, 1638, 3940, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 89, 1535, 0, 42, 47, 2761, 1766, 0, 1170, 511, 0, 4, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2457, 2457, 0, 1535, 2854, 0, 0, 0, 3071, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 1092, 4095, 0, 0, 2275, 2047, 0, 526, 0, 390, 1157, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 4095, 0, 2047, 2730, 0, 0, 0, 4095, 2730, 0, 0, 1801, 2925, 1755, 0, 1489, 2120, 1945, 4095, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 2047, 0, 1092, 0, 0, 4095, 4095, 3071, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 4095, 0, 0, 496, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 350, 2408, 3068, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 3465, 351, 4095, 877, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 255, 0, 0, 1706, 3112, 3510, 0, 3465, 2730, 0, 0, 3071, 0, 0, 1023, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 1791, 918, 0, 0, 0, 0, 242, 1444, 0, 0, 338, 0, 0, 0, 1194, 0, 0, 1583, 0, 0, 0, 0, 110, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 682, 315, 0, 0, 0, 2520, 0, 2730, 0, 0, 0, 0, 0, 0, 0, 85, 2770, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 240, 0, 0, 0, 4095, 0, 0, 3953, 3714, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 4095, 0, 4095, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 819, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 4095, 0, 204, 0, 0, 4095, 0, 0, 0, 0, 3510, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2815, 4095, 2240, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 834, 0, 744, 2047, 0, 0, 0, 2047, 1092, 3510, 3071, 0, 0, 4095, 3852, 2978, 682, 1335, 2138, 2730, 0, 0, 0, 0, 2948, 0, 0, 0, 0, 0, 0, 0, 525, 0, 0, 0, 0, 0, 0, 0, 99, 0, 0, 0, 0, 0, 0, 341, 190, 0, 0, 0, 0, 0, 2047, 0, 3908, 0, 0, 0, 0, 0, 100, 3747, 0, 2945, 4095, 0, 3934, 110, 0, 0, 0, 0, 0, 0, 4095, 0, 2047, 4095, 0, 0, 2047, 4095, 0, 0, 0, 2047, 0, 0, 1638, 0, 4095, 0, 3510, 195, 2375, 4095, 0, 2047, 4095, 0, 0, 3084, 1840, 2047, 0, 0, 0, 0, 0, 0, 1813, 409, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3822, 4095, 0, 4095, 0, 0, 0, 292, 3822, 0, 0, 0, 0, 0, 3890, 2877, 2071, 2784, 2437, 1962, 0, 0, 0, 744, 1253, 0, 0, 0, 0, 0, 4082, 4095, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 455, 0, 4095, 0, 0, 0, 0, 285, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 511, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 286, 0, 0, 722, 2457, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 1791, 1856, 0, 0, 0, 0, 0, 0, 4018, 0, 0, 0, 0, 0, 0, 1023, 0, 665, 0, 0, 0, 0, 0, 0, 0, 3305, 0, 0, 0, 0, 0, 23, 4095, 777, 0, 0, 0, 0, 0, 324, 4095, 1660, 0, 0, 0, 0, 0, 0, 3276, 918, 0, 0, 0, 0, 0, 0, 4095, 206, 0, 0, 0, 0, 0, 0, 4095, 220, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 396, 1489, 0, 145, 0, 3276, 3276, 4061, 4095, 0, 0, 151, 4095, 0, 0, 0, 2457, 0, 2047, 341, 2457, 945, 0, 0, 0, 107, 4095, 101, 4095, 585, 1489, 0, 3276, 796, 3911, 889, 0, 2047, 0, 0, 0, 413, 4069, 1518, 0, 0, 0, 0, 0, 292, 4095, 568, 0, 0, 0, 0, 0, 292, 4020, 1492, 0, 0, 0, 0, 511, 0, 4095, 4095, 0, 4095, 4095, 0, 0, 109, 4095, 1580, 0, 0, 0, 0, 3223, 84, 2817, 2800, 3583, 877, 0, 0, 0, 92, 3890, 698, 0, 3480, 0, 0, 0, 0, 4095, 1453, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1038, 0, 0, 0, 0, 0, 170, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 4095, 30, 0, 0, 0, 0, 45, 0, 0, 2047, 2730, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 784, 3458, 3027, 4095, 2412, 2930, 2105, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 1047, 1883, 682, 0, 2925, 1228, 0, 0, 0, 0, 0, 0, 2881, 853, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 1971, 0, 2586, 13, 0, 0, 334, 3232, 2526, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2660, 0, 1820, 0, 0, 18, 1965, 0, 511, 0, 0, 0, 226, 1764, 3677, 0, 1638, 1170, 0, 0, 0, 0, 0, 0, 2486, 1198, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1592, 585, 0, 0, 0, 0, 4095, 2652, 495, 3434, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 151, 819, 1842, 0, 4095, 0, 0, 0, 2096, 2018, 2431, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 2730, 1445, 0, 0, 3071, 0, 0, 0, 4095, 2559, 0, 0, 136, 1722, 2129, 0, 0, 0, 0, 4095, 1988, 3834, 3212, 0, 3412, 0, 0, 0, 0, 1638, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 3323, 0, 4095, 0, 1535, 3593, 2965, 2177, 469, 0, 3412, 0, 4095, 0, 0, 0, 4095, 0, 3455, 706, 4095, 0, 4095, 0, 4095, 0, 3753, 0, 0, 0, 2730, 3003, 3731, 0, 3071, 0, 0, 4095, 4095, 2730, 2808, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1950, 2436, 341, 0, 1023, 0, 0, 0, 4021, 0, 0, 0, 3071, 862, 0, 0, 4095, 0, 0, 0, 2656, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2189, 4095, 3762, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 1305, 361, 0, 1129, 0, 0, 0, 0, 0, 0, 0, 2848, 992, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1365, 0, 0, 0, 0, 0, 4095, 3412, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1204, 0, 0, 0, 0, 0, 2047, 2886, 2730, 534, 0, 2835, 2457, 0, 0, 0, 4095, 4095, 455, 2578, 1732, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 315, 1056, 0, 0, 0, 0, 0, 4095, 1215, 819, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 3276, 0, 0, 0, 2047, 0, 0, 4095, 0, 0, 1820, 1697, 2846, 250, 0, 2730, 4072, 0, 0, 0, 4095, 0, 0, 3448, 1535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2340, 0, 0, 0, 0, 0, 4095, 1023, 4095, 2565, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1755, 0, 0, 2730, 0, 0, 2303, 710, 2308, 1382, 0, 4095, 1365, 0, 0, 0, 0, 0, 0, 2670, 910, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2506, 0, 0, 0, 0, 253, 0, 0, 409, 0, 2972, 3009, 3093, 3498, 1365, 0, 614, 0, 0, 0, 0, 0, 0, 0, 132, 1188, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 38, 1150, 0, 0, 0, 4095, 0, 1820, 2457, 2432, 3955, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3412, 0, 31, 2067, 0, 0, 139, 0, 0, 2406, 1034, 716, 910, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 4064, 0, 0, 0, 0, 0, 4095, 4021, 3707, 2074, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1462, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3941, 0, 3583, 0, 1170, 0, 359, 0, 0, 4095, 3583, 2324, 2957, 0, 1228, 0, 1365, 0, 0, 0, 0, 0, 2047, 0, 682, 0, 910, 0, 0, 0, 511, 0, 0, 0, 1170, 0, 787, 0, 105, 0, 0, 0, 215, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2730, 0, 0, 0, 0, 0, 767, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 1228, 3152, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 273, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 585, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 3852, 915, 3378, 953, 3439, 3470, 3583, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3867, 4095, 0, 0, 1068, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3765, 0, 3573, 0, 0, 0, 0, 5, 819, 1421, 3520, 0, 1170, 0, 1630, 65, 248, 1397, 2879, 30, 0, 4095, 0, 0, 1170, 0, 0, 0, 0, 0, 0, 0, 1137, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 3365, 3327, 0, 4095, 0, 0, 0, 2815, 0, 3247, 0, 3695, 1365, 2340, 0, 3530, 2047, 3515, 2766, 3412, 0, 455, 3640, 4095, 0, 4095, 4095, 4095, 0, 4095, 0, 4095, 4095, 67, 0, 3220, 2205, 4095, 511, 4095, 0, 4095, 0, 4095, 0, 4095, 0, 3943, 0, 0, 0, 0, 0, 0, 0, 2730, 0, 0, 0, 4095, 0, 334, 0, 0, 0, 3872, 0, 4069, 0, 3801, 0, 3087, 0, 3609, 0, 4044, 2559, 3873, 0, 3412, 255, 3510, 3017, 2866, 0, 4095, 4095, 3589, 0, 3970, 0, 3120, 0, 4095, 0, 2982, 0, 0, 0, 3940, 0, 3573, 0, 2855, 0, 4095, 0, 3605, 0, 4095, 0, 2559, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 1811, 1243, 4095, 0, 0, 0, 0, 0, 0, 356, 1365, 930, 3802, 0, 2730, 296, 0, 0, 2275, 473, 0, 4095, 0, 0, 0, 0, 819, 0, 0, 0, 3854, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 819, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 372, 0, 0, 3685, 0, 0, 0, 0, 0, 3722, 4095, 0, 0, 0, 0, 537, 12, 558, 1287, 3003, 722, 3969, 0, 3412, 63, 240, 1669, 3465, 431, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 1365, 1365, 3934, 0, 963, 2512, 0, 2047, 4095, 2535, 0, 4095, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 4095, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2395, 3827, 1820, 0, 1400, 90, 0, 0, 1706, 0, 0, 0, 4095, 0, 1023, 0, 0, 0, 559, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 93, 0, 2123, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2189, 0, 1732, 0, 990, 0, 0, 0, 0, 0, 0, 292, 1023, 0, 0, 0, 3465, 0, 24, 2027, 101, 0, 0, 2670, 0, 0, 0, 4095, 117, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2340, 4095, 0, 0, 0, 0, 0, 4095, 3492, 0, 0, 0, 0, 0, 4095, 0, 3557, 0, 4095, 4095, 886, 42, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 1564, 4095, 0, 4095, 0, 0, 0, 0, 3412, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 55, 0, 4095, 0, 3900, 0, 3185, 0, 4095, 0, 4095, 0, 4095, 0, 4095, 0, 4095, 4029, 4095, 0, 2047, 910, 4095, 0, 4095, 0, 3412, 0, 4095, 0, 3775, 0, 297, 0, 4095, 0, 3217, 0, 4095, 4095, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 3071, 1365, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 3539, 898, 0, 4095, 0, 0, 0, 0, 0, 2155, 0, 0, 4095, 0, 0, 0, 496, 919, 3852, 651, 0, 3003, 0, 4095, 0, 275, 0, 0, 0, 0, 0, 372, 2925, 902, 0, 4095, 0, 511, 0, 240, 4095, 910, 0, 0, 0, 0, 0, 0, 4095, 711, 0, 4095, 0, 0, 0, 0, 0, 2866, 0, 0, 0, 0, 0, 0, 4095, 564, 0, 92, 0, 0, 175, 0, 0, 89, 0, 0, 4095, 0, 85, 0, 1023, 667, 682, 1068, 2945, 3030, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3071, 414, 0, 1064, 0, 0, 0, 0, 4095, 1077, 0, 0, 0, 0, 0, 1023, 4095, 690, 0, 3276, 0, 0, 0, 0, 4095, 819, 0, 0, 0, 0, 0, 1365, 2263, 1699, 0, 4095, 0, 0, 0, 0, 307, 0, 4095, 0, 4095, 0, 975, 1885, 845, 765, 2354, 511, 0, 2778, 0, 176, 4095, 2289, 0, 0, 0, 0, 4095, 372, 0, 2167, 0, 0, 0, 0, 0, 0, 0, 1096, 0, 0, 0, 0, 4095, 0, 819, 0, 0, 0, 0, 0, 0, 0, 0, 2285, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 455, 682, 3978, 3830, 1489, 0, 4095, 175, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2730, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 2047, 0, 712, 455, 845, 155, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 511, 511, 1023, 4095, 0, 264, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 157, 3510, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3853, 0, 2525, 1462, 945, 85, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1638, 0, 1166, 3325, 1427, 0, 2866, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3890, 3908, 866, 3474, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 215, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 4095, 4095, 4095, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 2308, 2047, 2233, 564, 3808, 538, 4095, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 2730, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 2751, 4095, 4010, 0, 3916, 0, 1565, 4095, 2492, 0, 4095, 0, 4095, 0, 4095, 2025, 1390, 4095, 3560, 382, 4095, 4095, 4095, 0, 4095, 0, 2856, 0, 4095, 0, 2719, 0, 3372, 4095, 2413, 264, 1893, 0, 1804, 0, 4095, 0, 2047, 0, 4095, 0, 4095, 0, 0, 0, 1023, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3276, 0, 682, 1170, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 1462, 744, 0, 1170, 4036, 614, 0, 3776, 4095, 0, 0, 0, 0, 0, 0, 0, 1365, 0, 2792, 1365, 2286, 88, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3951, 0, 1535, 4095, 1043, 1043, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 455, 2988, 3510, 585, 727, 0, 0, 0, 0, 0, 0, 6, 0, 53, 0, 3302, 0, 0, 0, 129, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 125, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2559, 0, 2559, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3640, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 4095, 208, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2245, 573, 1192, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 1204, 630, 0, 1820, 2609, 130, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 792, 0, 0, 1396, 215, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1565, 1116, 0, 4095, 3246, 43, 0, 0, 0, 0, 0, 0, 0, 0, 1774, 0, 1539, 2586, 0, 2250, 2279, 0, 0, 0, 0, 4095, 0, 0, 1365, 0, 0, 0, 2223, 2268, 1023, 4095, 1376, 805, 0, 0, 2047, 0, 0, 0, 0, 0, 4095, 0, 2627, 3269, 3722, 4045, 1333, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 1655, 744, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1638, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2978, 0, 4095, 4095, 3238, 3020, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2457, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3088, 4095, 4095, 4095, 1382, 395, 4095, 0, 682, 0, 1146, 0, 0, 0, 4095, 4095, 1752, 4095, 910, 4095, 2319, 0, 3937, 4095, 712, 1116, 0, 0, 1365, 0, 3583, 0, 1306, 4011, 4095, 3978, 708, 0, 1365, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 178, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 2122, 4095, 0, 4095, 2102, 479, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 3566, 0, 1576, 3549, 1170, 4095, 2615, 27, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 886, 4095, 0, 4095, 785, 77, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 845, 3830, 3560, 3863, 1897, 19, 125, 0, 0, 3640, 0, 0, 3722, 0, 0, 0, 3839, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 1512, 4095, 0, 3237, 474, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 715, 0, 0, 4095, 862, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1592, 4095, 0, 4095, 1744, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 2205, 4095, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 215, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 1403, 1749, 1939, 1170, 3123, 639, 1598, 4095, 3498, 3334, 341, 1835, 3676, 869, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2730, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1735, 0, 2047, 0, 0, 0, 0, 0, 546, 0, 292, 2730, 1478, 2047, 1293, 0, 0, 0, 0, 0, 0, 0, 0, 3583, 3685, 255, 3833, 1116, 2827, 386, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 630, 0, 327, 409, 2457, 2233, 1686, 0, 4095, 0, 0, 0, 0, 0, 4095, 4095, 2502, 671, 409, 1803, 1522, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1365, 0, 1489, 2649, 2687, 963, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 220, 728, 1730, 3141, 3399, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3331, 3627, 1088, 0, 0, 0, 0, 218, 2388, 12, 2511, 1638, 2145, 3264, 3071, 0, 1228, 0, 0, 3967, 0, 4095, 4012, 2478, 281, 311, 1638, 3534, 853, 0, 0, 0, 0, 0, 0, 0, 708, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 546, 0, 0, 0, 0, 225, 1697, 0, 234, 1549, 1675, 2925, 2047, 2730, 0, 0, 0, 0, 0, 4095, 4020, 2149, 1073, 2957, 1245, 3393, 790, 3722, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 3780, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 96, 4095, 0, 146, 1989, 2259, 3382, 0, 0, 0, 0, 0, 0, 2047, 4095, 4095, 2644, 2866, 0, 1444, 3481, 66, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3276, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 34, 451, 0, 3932, 3805, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 431, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3412, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2730, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2646, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2730, 2520, 0, 0, 1535, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 3897, 502, 2951, 4095, 0, 4095, 0, 0, 0, 620, 0, 0, 0, 1365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 2233, 3583, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 4095, 0, 0, 0, 2340, 0, 4095, 0, 4095, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 2661, 0, 585, 0, 1365, 0, 4095, 0, 4095, 0, 0, 0, 4095, 0, 4095, 0, 3276, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 2106, 1254, 0, 0, 0, 0, 0, 0, 2890, 0, 0, 0, 0, 0, 540, 4095, 81, 1020, 0, 0, 4095, 0, 0, 4095, 0, 2340, 4095, 0, 4095, 4095, 955, 130, 0, 438, 3659, 290, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 2233, 0, 0, 0, 0, 0, 0, 0, 97, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3150, 0, 0, 0, 0, 0, 182, 963, 409, 877, 0, 0, 3784, 4095, 0, 0, 0, 0, 0, 0, 4040, 3696, 1892, 28, 0, 3740, 1235, 0, 0, 0, 0, 0, 0, 146, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 1365, 3767, 0, 0, 0, 0, 0, 43, 4095, 67, 480, 4095, 0, 4095, 0, 0, 0, 0, 0, 4095, 4095, 0, 3783, 2457, 1270, 608, 3367, 3335, 241, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1365, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 4095, 1262, 0, 4009, 3420, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 116, 4095, 0, 286, 0, 0, 4095, 0, 4095, 0, 4095, 0, 362, 0, 4095, 4095, 234, 107, 0, 2047, 2016, 116, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 444, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 0, 0, 4095, 0, 0, 0, 0, 77, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 240, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 3675, 0, 0, 0, 0, 0, 28, 0, 0, 2029, 4095, 0, 4095, 4095, 0, 4095, 0, 4095, 0, 0, 3549, 4095, 3410, 898, 1014, 3784, 4040, 1384, 0, 0, 0, 4095, 0, 0, 2925, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 4095, 0, 3986, 0, 96, 3613, 351, 2845, 4095, 0, 3924, 4095, 2263, 0, 4095, 0, 4095, 0, 4095, 3915, 2303, 587, 1430, 3685, 3225, 87, 1365, 0, 4095, 0, 0, 0, 4095, 0, 4095, 0, 3201, 0, 4095, 0, 2047, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3613, 0, 0, 0, 0, 0, 138, 3196, 65, 2180, 4095, 0, 4095, 0, 4095, 2047, 0, 0, 4095, 0, 4095, 4011, 2586, 82, 0, 2913, 3125, 170, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2730, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 2801, 862, 0, 1587, 3900, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 4095, 0, 910, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 842, 56, 0, 4095, 4095, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 1365, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 3943, 2362, 2730, 0, 2340, 2434, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 423, 0, 431, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 125, 0, 4095, 3241, 3583, 0, 0, 0, 0, 570, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3193, 0, 4095, 0, 2559, 0, 4095, 0, 63, 0, 787, 1890, 0, 0, 1116, 0, 0, 0, 0, 0, 5, 0, 4095, 4095, 2047, 0, 0, 630, 3017, 4095, 66, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 4095, 2457, 0, 0, 0, 4095, 0, 2047, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 4095, 0, 4095, 0, 4095, 0, 4095, 0, 0, 0, 4095, 0, 4095, 0, 4095, 0, 0, 0, 4095, 0, 4095, 0, 4095, 0, 4095, 0, 4095, 0, 4095, 0, 4095, 0, 4095, 0, 4095, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2314, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1971, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1407, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3071, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 1365, 0, 0, 0, 0, 0, 1202, 0, 1901, 0, 1927, 0, 2167, 0, 2252, 0, 1657, 0, 1854, 0, 1240, 0, 1797, 0, 1829, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 2047, 0, 1535, 0, 1535, 0, 1535, 0, 1535, 0, 511, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 30, 0, 2275, 0, 0, 3465, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 75, 0, 0, 0, 0, 0, 0, 0, 1737, 0, 2520, 0, 1755, 0, 2047, 0, 1412, 0, 2161, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 56, 0, 0, 0, 0, 0, 1670, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2294, 1306, 1548, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3598, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 511, 0, 0, 0, 0, 0, 0, 0, 930, 0, 0, 0, 0, 0, 2317, 0, 0, 1365, 0, 780, 4076, 3583, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1716, 0, 23, 0, 0, 0, 0, 0, 0, 0, 24, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3530, 3680, 710, 336, 1384, 107, 0, 0, 498, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 105, 0, 830, 0, 0, 0, 0, 0, 0, 0, 413, 0, 0, 0, 0, 0, 0, 0, 141, 107, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 819, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1438, 0, 0, 0, 0, 0, 819, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 777, 810, 445, 0, 819, 0, 368, 0, 1283, 0, 1272, 0, 451, 0, 1051, 0, 574, 0, 906, 215, 0, 0, 0, 0, 0, 0, 1300, 0, 0, 0, 0, 0, 4095, 0, 1866, 0, 819, 0, 1256, 65, 2388, 0, 0, 0, 1023, 0, 0, 0, 4095, 0, 2614, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1638, 1706, 0, 0, 0, 0, 0, 0, 0, 1279, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 79, 0, 0, 0, 0, 0, 4095, 0, 224, 0, 1981, 0, 2109, 0, 2245, 0, 1521, 0, 1985, 0, 0, 0, 0, 0, 4095, 4062, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 178, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 2444, 889, 0, 0, 0, 0, 0, 0, 4095, 347, 0, 4095, 0, 0, 0, 0, 0, 2352, 0, 0, 0, 0, 0, 0, 4095, 967, 0, 4095, 0, 0, 0, 0, 0, 195, 0, 0, 0, 0, 0, 0, 3365, 1457, 0, 2047, 273, 0, 0, 43, 3967, 1117, 0, 0, 0, 0, 0, 0, 819, 422, 0, 528, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3150, 716, 0, 4095, 0, 0, 0, 0, 0, 1633, 0, 0, 0, 0, 0, 0, 4095, 774, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 693, 619, 0, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 66, 2827, 0, 19, 0, 0, 0, 0, 0, 1022, 0, 0, 0, 0, 0, 132, 4095, 655, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 330, 0, 4095, 0, 0, 0, 372, 4095, 15, 0, 0, 0, 0, 3549, 351, 1881, 0, 0, 0, 0, 0, 0, 0, 0, 1765, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1947, 721, 387, 3986, 2792, 2879, 725, 3890, 1629, 2106, 2886, 3327, 0, 0, 4095, 372, 3790, 1170, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 167, 945, 455, 2205, 0, 0, 63, 0, 0, 0, 35, 0, 0, 0, 0, 0, 215, 227, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1861, 0, 1820, 1170, 292, 3276, 0, 0, 0, 0, 0, 0, 0, 0, 1023, 0, 2730, 0, 1198, 3350, 642, 511, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1850, 0, 895, 364, 315, 26, 642, 0, 1287, 0, 1438, 0, 688, 0, 1111, 0, 2091, 0, 700, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1116, 1023, 0, 1890, 0, 2457, 0, 341, 0, 3071, 0, 1023, 0, 0, 0, 0, 0, 0, 0, 3129, 1835, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 3150, 0, 0, 2835, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3276, 0, 0, 0, 0, 0, 1023, 0, 2730, 0, 130, 0, 0, 0, 4095, 0, 0, 0, 2340, 0, 1045, 3336, 2486, 0, 2303, 0, 2161, 0, 1106, 0, 0, 0, 0, 0, 585, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 70, 3096, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2730, 0, 3412, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3685, 0, 0, 0, 4095, 1535, 33, 4095, 506, 1724, 2303, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 202, 998, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 639, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 2047, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 85, 0, 0, 0, 0, 0, 2632, 19, 52, 33, 0, 0, 0, 0, 0, 17, 0, 15, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 2730, 0, 2925, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 95, 0, 0, 4095, 0, 0, 0, 0, 819, 4095, 2730, 0, 0, 0, 341, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 4095, 0, 0, 0, 0, 0, 2730, 2047, 1023, 0, 0, 0, 0, 0, 2323, 218, 1790, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 1958, 0, 910, 0, 0, 4095, 2586, 0, 4095, 0, 0, 0, 0, 651, 0, 4095, 3818, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 558, 0, 3603, 1992, 0, 19, 0, 0, 3873, 133, 0, 585, 0, 0, 0, 0, 521, 0, 0, 2395, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 0, 2392, 1098, 0, 1785, 660, 0, 1535, 0, 0, 3785, 1424, 0, 3465, 0, 3583, 0, 1225, 1622, 4095, 3864, 1805, 5, 0, 0, 0, 0, 0, 0, 0, 0, 2457, 0, 1674, 709, 426, 96, 405, 0, 1653, 0, 2233, 4095, 298, 0, 408, 0, 833, 0, 221, 0, 0, 0, 585, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1023, 0, 1365, 4095, 2311, 0, 877, 0, 0, 4095, 2184, 0, 4095, 0, 0, 0, 0, 4095, 0, 0, 3686, 547, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 1842, 0, 1023, 0, 0, 4095, 1638, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 126, 0, 0, 0, 4095, 0, 0, 0, 1613, 0, 1919, 4095, 1440, 0, 1023, 0, 1521, 4095, 2086, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 1755, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 290, 0, 3071, 0, 0, 4095, 2866, 0, 4095, 0, 0, 0, 2256, 4095, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1260, 0, 0, 1755, 2656, 0, 3071, 0, 0, 4095, 2047, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 810, 0, 87, 0, 0, 4095, 933, 0, 945, 0, 0, 0, 3360, 2730, 0, 0, 1287, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1890, 0, 204, 4095, 356, 660, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 4095, 585, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 315, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 1365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2730, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 2457, 682, 3071, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3448, 0, 0, 0, 0, 4095, 2559, 0, 1755, 0, 4095, 4095, 0, 4095, 0, 0, 0, 0, 227, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 2047, 0, 2047, 0, 2095, 7, 1861, 0, 1881, 14, 2100, 0, 1228, 0, 1545, 0, 2512, 0, 1056, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 0, 1023, 4095, 910, 0, 1706, 0, 1023, 4095, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 1617, 3071, 0, 3217, 3640, 2691, 3185, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 208, 0, 0, 0, 0, 0, 0, 0, 1489, 0, 2136, 4095, 1724, 0, 1365, 215, 1474, 0, 2233, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3081, 1911, 1600, 3900, 141, 0, 0, 1724, 2835, 0, 4095, 4095, 0, 0, 0, 0, 614, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3159, 1911, 4095, 0, 1365, 819, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 409, 0, 0, 0, 0, 0, 0, 0, 0, 0, 646, 0, 0, 0, 0, 0, 2205, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3613, 1468, 1228, 1349, 0, 0, 0, 0, 0, 0, 0, 8, 9, 0, 0, 0, 0, 0, 0, 1638, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2520, 2047, 4095, 0, 0, 4095, 0, 0, 0, 3071, 0, 0, 0, 0, 0, 0, 0, 2047, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 3276, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 2047, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 0, 4095, 0, 0, 722, 2766, 3583, 4095, 0, 0, 0, 0, 0, 0, 0, 1177, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 218, 4095, 2462, 1638, 0, 0, 0, 0, 0, 0, 3822, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2730, 0, 0, 0, 0, 0, 0, 186, 1968, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 1023, 0, 0, 0, 0, 0, 0, 0, 1638, 4095, 472, 1023, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1786, 0, 2159, 0, 1535, 1023, 1638, 0, 1801, 2730, 2384, 0, 2118, 0, 1424, 0, 1724, 1023, 1904, 0, 0, 0, 0, 0, 0, 4095, 1365, 0, 0, 0, 0, 0, 0, 0, 2106, 0, 1260, 2388, 511, 0, 1737, 3477, 93, 4095, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 89, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3412, 780, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1801, 0, 1976, 0, 1901, 0, 1861, 341, 2047, 0, 2245, 0, 0, 0, 0, 0, 2292, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 303, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1147, 1752, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2262, 0, 0, 0, 0, 0, 0, 4095, 548, 0, 0, 0, 0, 0, 0, 0, 658, 0, 0, 0, 0, 0, 0, 3412, 2936, 0, 0, 0, 0, 0, 372, 3443, 1156, 0, 0, 0, 0, 0, 0, 0, 2881, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 910, 0, 819, 0, 0, 0, 0, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 178, 0, 20, 0, 0, 0, 0, 0, 266, 0, 1023, 0, 0, 0, 315, 0, 285, 0, 0, 0, 0, 0, 0, 0, 2691, 0, 0, 0, 0, 0, 626, 4095, 2552, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 227, 0, 162, 0, 0, 0, 0, 0, 455, 4095, 0, 0, 2457, 0, 0, 0, 0, 0, 2559, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1638, 0, 2047, 0, 0, 0, 0, 0, 0, 4095, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2158, 1162, 2470, 0, 1365, 3338, 2187, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1971, 0, 112, 0, 0, 0, 1256, 2819, 1274, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2605, 0, 0, 0, 0, 2047, 2293, 0, 0, 0, 0, 4095, 2866, 4095, 1911, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 2221, 0, 819, 0, 655, 3, 1553, 0, 1712, 0, 2047, 4095, 230, 1842, 692, 0, 829, 0, 1246, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1023, 0, 1023, 2649, 1740, 0, 1365, 0, 511, 4095, 2843, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 281, 0, 0, 5, 1046, 1919, 204, 0, 0, 0, 4095, 3318, 3878, 2397, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 1660, 0, 3759, 0, 1745, 0, 3800, 0, 1897, 0, 2254, 3180, 3753, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 1904, 383, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 34, 1985, 0, 945, 0, 0, 0, 4095, 340, 2748, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 630, 0, 0, 0, 0, 0, 3295, 3579, 2212, 1801, 0, 0, 4095, 0, 0, 0, 2047, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 134, 0, 0, 0, 2047, 0, 0, 0, 1365, 0, 4095, 0, 1365, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 63, 0, 0, 0, 0, 0, 4095, 1047, 154, 0, 0, 15, 0, 0, 0, 722, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3412, 0, 4095, 3564, 3727, 3908, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 2047, 372, 0, 0, 4095, 2047, 0, 0, 3718, 4095, 0, 0, 0, 1724, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 4095, 0, 4095, 1513, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 1489, 0, 0, 0, 0, 0, 4095, 1695, 4095, 2118, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3150, 0, 0, 0, 0, 0, 0, 1299, 4095, 1638, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2957, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1560, 2314, 1365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1992, 0, 1596, 0, 65, 123, 376, 0, 1869, 0, 1755, 438, 367, 1274, 233, 0, 458, 0, 524, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 511, 0, 48, 1939, 2559, 0, 1820, 4095, 1023, 4008, 854, 1400, 374, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 143, 4095, 56, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1675, 0, 1365, 0, 1958, 0, 1608, 0, 1675, 0, 1592, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 3412, 0, 0, 58, 4095, 264, 890, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3583, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 885, 81, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2314, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 69, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1478, 0, 1657, 0, 830, 0, 1535, 0, 1714, 0, 1699, 0, 626, 0, 840, 0, 716, 0, 237, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1023, 0, 1023, 0, 1706, 0, 2559, 0, 1023, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 2233, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 210, 0, 4095, 0, 0, 2730, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 2502, 0, 1508, 0, 2426, 0, 1976, 0, 1835, 0, 2687, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1248, 1020, 1266, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 341, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 99, 0, 4095, 0, 0, 0, 0, 0, 180, 3412, 1320, 0, 0, 0, 0, 0, 2294, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3956, 0, 1170, 0, 0, 0, 0, 1820, 71, 4095, 1365, 0, 0, 0, 0, 0, 0, 1365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3916, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 606, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 1768, 4095, 0, 0, 1650, 442, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1535, 0, 0, 0, 0, 0, 0, 0, 1116, 0, 0, 0, 0, 0, 0, 682, 1550, 0, 0, 0, 0, 0, 0, 209, 2886, 1228, 0, 0, 0, 0, 0, 0, 136, 0, 0, 0, 0, 0, 0, 0, 1585, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3773, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 1820, 115, 274, 0, 819, 0, 1008, 0, 1181, 0, 2275, 0, 1436, 0, 74, 0, 1575, 0, 466, 24, 0, 0, 0, 0, 0, 94, 1516, 0, 0, 0, 0, 0, 4095, 0, 3350, 0, 1023, 3822, 219, 0, 1535, 0, 2047, 0, 3071, 0, 0, 0, 4095, 0, 1894, 4095, 0, 0, 614, 0, 0, 682, 3488, 0, 0, 0, 0, 0, 0, 2233, 1677, 0, 0, 0, 0, 0, 0, 0, 103, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 105, 0, 1809, 0, 1501, 0, 2145, 0, 2167, 0, 1228, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 2047, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 141, 0, 0, 0, 819, 0, 0, 1077, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 2730, 0, 0, 2047, 1586, 2085, 0, 0, 0, 0, 4095, 0, 819, 722, 0, 4095, 0, 0, 0, 0, 0, 191, 0, 0, 0, 0, 0, 0, 3549, 1786, 0, 4095, 0, 0, 0, 1302, 4095, 741, 0, 0, 0, 0, 0, 118, 2747, 342, 0, 1706, 0, 0, 0, 112, 3791, 1289, 0, 0, 0, 0, 0, 0, 1116, 233, 0, 4095, 0, 0, 0, 56, 3448, 700, 0, 0, 0, 0, 0, 1686, 1638, 666, 0, 4095, 0, 0, 0, 0, 0, 2034, 0, 0, 0, 0, 0, 0, 1023, 758, 0, 4095, 0, 0, 0, 0, 0, 737, 0, 0, 0, 0, 0, 114, 151, 599, 0, 11, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 455, 26, 0, 147, 0, 0, 0, 89, 4095, 2925, 0, 0, 0, 0, 0, 0, 2047, 3112, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 614, 3974, 606, 0, 4095, 0, 0, 0, 96, 2978, 2437, 0, 0, 0, 0, 255, 540, 1344, 993, 0, 0, 0, 0, 0, 0, 0, 204, 0, 0, 0, 0, 4095, 0, 2978, 372, 0, 0, 0, 0, 0, 0, 0, 215, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 3412, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 372, 682, 21, 85, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 89, 1365, 0, 3350, 0, 0, 53, 0, 0, 0, 0, 0, 0, 0, 0, 0, 585, 303, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3345, 0, 1365, 585, 511, 0, 3071, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1365, 2730, 1535, 722, 0, 0, 0, 0, 0, 0, 0, 0, 1462, 0, 0, 0, 89, 0, 175, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 2275, 0, 0, 215, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3854, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3762, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3685, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 4095, 0, 4095, 0, 4095, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 4095, 0, 3071, 0, 4095, 1668, 4095, 0, 4095, 0, 0, 0, 288, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1260, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3185, 0, 0, 1023, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3412, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 207, 70, 0, 0, 15, 0, 0, 0, 74, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 315, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 78, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1950, 0, 1620, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 133, 315, 292, 4095, 3634, 728, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1137, 0, 4095, 372, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 682, 0, 0, 1116, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2856, 0, 511, 1204, 0, 0, 2275, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 731, 1279, 0, 4095, 596, 109, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 409, 0, 11, 2514, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 472, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 0, 0, 1732, 195, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 3479, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3120, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 215, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 1808, 4095, 0, 4095, 2291, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 136, 0, 0, 4095, 3185, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3208, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3989, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 862, 4095, 0, 4095, 3879, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 3510, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3622, 0, 0, 0, 3695, 292, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 282, 0, 0, 107, 110, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 100, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 682, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2443, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 3861, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 3613, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1775, 1630, 1683, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 455, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 273, 0, 0, 0, 0, 0, 0, 0, 0, 0, 372, 0, 0, 0, 0, 0, 1417, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1927, 0, 0, 0, 0, 0, 0, 0, 585, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 511, 0, 0, 0, 0, 0, 0, 0, 4027, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2205, 0, 0, 0, 0, 0, 0, 1365, 4095, 0, 0, 0, 0, 0, 2421, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2559, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1842, 0, 0, 0, 0, 0, 0, 0, 292, 1302, 0, 0, 0, 0, 0, 0, 0, 2866, 0, 0, 0, 0, 0, 0, 1904, 1223, 0, 0, 0, 0, 0, 0, 0, 25, 0, 0, 0, 0, 0, 0, 0, 3164, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1842, 2508, 0, 0, 0, 0, 0, 0, 0, 639, 0, 0, 0, 0, 0, 0, 0, 697, 0, 0, 0, 0, 0, 0, 0, 3071, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1365, 3276, 3131, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1234, 1395, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 0, 178, 4095, 2310, 0, 0, 0, 0, 0, 0, 4095, 193, 0, 0, 0, 0, 0, 0, 3276, 23, 0, 0, 0, 0, 0, 0, 0, 3854, 0, 0, 0, 0, 0, 0, 4095, 1445, 0, 0, 0, 0, 0, 0, 4095, 1365, 0, 0, 0, 0, 0, 0, 0, 2730, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 511, 0, 0, 0, 0, 0, 845, 4095, 445, 0, 0, 0, 0, 0, 60, 4095, 1727, 0, 0, 0, 0, 0, 136, 3536, 1802, 0, 0, 0, 0, 0, 0, 0, 1219, 0, 0, 0, 0, 0, 409, 4095, 2825, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 23, 3900, 2201, 0, 0, 0, 0, 0, 136, 4095, 1060, 0, 0, 0, 0, 0, 60, 4095, 157, 0, 0, 0, 0, 0, 0, 0, 2785, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 226, 3327, 2822, 0, 0, 0, 0, 0, 767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1376, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 4095, 0, 0, 2047, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 4095, 4095, 0, 4095, 0, 0, 0, 4095, 0, 4095, 0, 4095, 0, 4095, 0, 4095, 0, 0, 0, 4095, 0, 4095, 0, 4095, 0, 4095, 0, 4095, 0, 0, 0, 4095, 0, 4095, 0, 4095, 0, 4095, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 109, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2297, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3640, 2275, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 4095, 0, 0, 4095, 3955, 0, 0, 0, 4095, 0, 0, 0, 3876, 0, 0, 4095, 3224, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 4095, 3558, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 4095, 4095, 0, 0, 0, 3266, 0, 0, 4095, 4095, 0, 0, 0, 4095, 0, 0, 0, 2575, 0, 0, 0, 4095, 0, 0, 4095, 4095, 0, 0, 4095, 3505, 0, 0, 3725, 4095, 0, 0, 2418, 4061, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2400, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 3509, 0, 0, 4071, 3745, 0, 0, 4009, 3392, 0, 0, 0, 0, 0, 0, 1365, 0, 0, 0, 3583, 3991, 0, 0, 4076, 4027, 0, 0, 4035, 1505, 0, 0, 4037, 3930, 40, 0, 1801, 0, 0, 0, 3906, 4095, 0, 0, 4067, 0, 0, 0, 2457, 0, 0, 0, 4061, 1365, 0, 0, 2559, 4095, 0, 0, 4072, 0, 0, 0, 3967, 4070, 0, 0, 3892, 0, 0, 0, 3839, 0, 0, 0, 3705, 0, 4095, 0, 3738, 0, 0, 0, 3722, 0, 0, 0, 3465, 0, 0, 0, 2340, 0, 0, 0, 3510, 0, 0, 0, 3350, 0, 0, 0, 3929, 4095, 0, 0, 2047, 4095, 0, 0, 4042, 4095, 0, 0, 4082, 0, 0, 0, 4042, 0, 0, 0, 3718, 0, 0, 0, 0, 2576, 4095, 2216, 3185, 2162, 0, 0, 2047, 1143, 0, 0, 2047, 3019, 0, 0, 0, 1365, 0, 0, 1365, 847, 0, 0, 3685, 506, 0, 0, 0, 2512, 0, 0, 0, 254, 0, 0, 327, 1401, 0, 0, 0, 215, 0, 0, 1320, 3049, 955, 0, 0, 2136, 0, 0, 0, 704, 0, 0, 1365, 323, 0, 0, 0, 676, 0, 0, 2047, 117, 0, 1904, 0, 4095, 0, 0, 25, 2848, 0, 0, 831, 1281, 1023, 3071, 0, 1185, 0, 0, 0, 1121, 0, 0, 0, 1565, 0, 0, 0, 2778, 0, 0, 0, 159, 0, 0, 0, 2047, 0, 0, 0, 4074, 0, 0, 4079, 0, 0, 0, 113, 1820, 0, 0, 0, 0, 0, 0, 3867, 0, 0, 0, 3705, 315, 0, 0, 0, 3412, 862, 1137, 3916, 2477, 0, 0, 3185, 4009, 2340, 862, 3931, 4095, 0, 0, 2925, 4087, 2340, 1445, 3185, 4087, 0, 0, 0, 4090, 2047, 409, 0, 4045, 0, 0, 3510, 4076, 2340, 1911, 3920, 4095, 0, 0, 3185, 4031, 2730, 2233, 0, 4095, 0, 0, 3916, 4087, 1489, 1260, 0, 4029, 0, 0, 3970, 4087, 3276, 1638, 0, 4095, 0, 0, 3956, 2831, 2340, 1489, 0, 4095, 0, 0, 2047, 4085, 2340, 1170, 3996, 4035, 0, 0, 3685, 4046, 0, 0, 2047, 4063, 0, 0, 0, 3549, 0, 0, 0, 4074, 0, 0, 2457, 4095, 0, 0, 0, 4095, 0, 0, 0, 3753, 0, 0, 172, 0, 0, 0, 3817, 4095, 0, 0, 168, 0, 0, 0, 2457, 3071, 0, 0, 0, 0, 0, 0, 0, 0, 2448, 4056, 2340, 1365, 1582, 303, 0, 3071, 3471, 0, 0, 0, 0, 0, 0, 3685, 2730, 4095, 1638, 0, 1040, 0, 0, 3276, 1023, 0, 0, 0, 0, 0, 4095, 3685, 1320, 299, 136, 3315, 3276, 0, 0, 1293, 2136, 0, 0, 0, 0, 0, 0, 3510, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3465, 0, 0, 0, 0, 0, 0, 0, 0, 2340, 2047, 3877, 0, 0, 0, 4095, 3412, 1638, 2520, 2047, 3510, 4095, 0, 0, 3942, 1829, 57, 1678, 3480, 3042, 4095, 0, 1365, 0, 423, 0, 1365, 0, 597, 0, 3071, 0, 1023, 0, 2047, 0, 1023, 0, 1820, 0, 2123, 4095, 0, 4095, 0, 0, 0, 0, 2978, 0, 0, 0, 0, 0, 4095, 0, 782, 0, 3510, 0, 1633, 282, 610, 0, 1890, 4095, 332, 0, 3622, 0, 1535, 2047, 2059, 4095, 0, 0, 3839, 4095, 3290, 3510, 3300, 3864, 3607, 2848, 4095, 0, 3255, 0, 3943, 0, 3811, 0, 2394, 0, 3957, 0, 4095, 0, 4095, 0, 2047, 0, 2434, 0, 3583, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 4095, 0, 4095, 0, 4095, 0, 4095, 0, 4095, 0, 0, 0, 4095, 0, 4095, 4095, 4095, 0, 2047, 0, 4095, 2047, 2047, 682, 2730, 0, 0, 0, 4095, 0, 819, 4095, 4095, 0, 4095, 0, 2047, 75, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1992, 1116, 0, 0, 0, 0, 4095, 0, 4095, 1008, 0, 4095, 0, 0, 0, 3879, 0, 3364, 0, 0, 0, 0, 0, 4095, 3510, 897, 0, 1820, 0, 0, 0, 3780, 0, 585, 0, 0, 0, 0, 0, 4095, 2047, 622, 0, 4095, 0, 0, 0, 797, 4095, 410, 0, 0, 0, 0, 0, 3867, 4095, 767, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 585, 0, 4095, 0, 0, 0, 0, 0, 1829, 0, 0, 0, 0, 0, 0, 4095, 855, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 1014, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 429, 0, 4095, 0, 0, 0, 0, 0, 3192, 0, 0, 0, 0, 0, 0, 2047, 455, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 819, 4095, 139, 0, 4095, 0, 0, 0, 372, 0, 0, 0, 0, 0, 0, 4095, 166, 611, 1394, 0, 0, 0, 0, 0, 0, 0, 3645, 0, 0, 0, 0, 4095, 0, 0, 3071, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 105, 2866, 2632, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2008, 2045, 18, 3930, 2997, 3547, 2200, 4095, 1374, 2649, 2148, 3042, 0, 0, 2457, 630, 3854, 910, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 819, 372, 4095, 0, 0, 2586, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 682, 455, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2925, 0, 0, 767, 287, 2652, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 204, 1023, 1837, 234, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1365, 0, 1706, 682, 125, 0, 1365, 0, 1535, 0, 1365, 0, 1365, 0, 1535, 0, 1706, 0, 1023, 0, 1365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 3979, 2957, 0, 3989, 0, 2730, 0, 3164, 0, 3480, 0, 3715, 0, 4095, 0, 17, 0, 4095, 0, 1398, 392, 4095, 4095, 4009, 0, 0, 0, 3640, 0, 4095, 4095, 2047, 3510, 4095, 2047, 3336, 0, 2457, 0, 0, 4095, 4095, 0, 2047, 4095, 0, 4095, 3780, 2063, 3127, 1198, 3863, 1638, 2248, 1660, 120, 2540, 2047, 2423, 0, 3900, 3017, 0, 4095, 4095, 2815, 0, 3802, 3583, 0, 0, 4095, 4095, 0, 0, 4095, 4095, 0, 0, 4095, 4095, 0, 0, 3583, 3822, 0, 0, 4095, 4095, 0, 0, 4095, 4095, 4095, 0, 4095, 3412, 0, 0, 1901, 1968, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4063, 0, 409, 0, 3976, 1365, 491, 4095, 324, 2486, 1622, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 65, 1170, 390, 0, 4095, 4095, 0, 1638, 1694, 2457, 744, 0, 4095, 4095, 4095, 0, 4095, 819, 4095, 0, 0, 4095, 1755, 682, 0, 4057, 4095, 0, 4095, 0, 3583, 4095, 4095, 819, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 3685, 91, 0, 0, 0, 0, 0, 0, 0, 3685, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 2725, 0, 0, 4095, 0, 0, 0, 242, 4095, 0, 0, 3932, 3849, 0, 0, 4095, 4095, 0, 0, 4063, 3382, 0, 0, 4095, 3536, 0, 0, 4095, 4095, 0, 0, 4095, 4095, 0, 0, 0, 4095, 0, 0, 2047, 4095, 0, 4095, 2730, 4095, 0, 0, 3990, 4095, 2047, 0, 3811, 3667, 0, 0, 4046, 4088, 4095, 0, 4005, 4037, 0, 0, 0, 4095, 0, 0, 4017, 1638, 0, 0, 0, 4095, 0, 4095, 3925, 2886, 0, 4095, 3630, 3870, 1501, 0, 3839, 4023, 255, 4095, 4095, 3952, 0, 0, 0, 4095, 0, 0, 4095, 3241, 0, 0, 4095, 2772, 0, 0, 3873, 3705, 0, 0, 0, 4095, 0, 4095, 4095, 3510, 1023, 0, 0, 0, 4095, 0, 3307, 910, 2257, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3780, 2605, 1989, 0, 2340, 0, 0, 4095, 2457, 0, 3510, 0, 0, 0, 3412, 630, 0, 0, 3579, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1365, 562, 1365, 2730, 734, 0, 1755, 0, 0, 4095, 2408, 0, 4095, 0, 0, 0, 2877, 423, 0, 0, 3155, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3185, 0, 2605, 782, 0, 682, 971, 0, 2559, 0, 0, 4095, 2047, 0, 4095, 0, 3916, 0, 24, 1023, 0, 4095, 2242, 200, 0, 0, 0, 0, 0, 0, 0, 0, 1023, 0, 0, 315, 2559, 4095, 1661, 0, 1575, 0, 2047, 4095, 1560, 0, 3150, 0, 2047, 0, 1535, 0, 0, 4095, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3465, 0, 1365, 3276, 1787, 0, 945, 0, 3204, 4095, 2123, 0, 4095, 0, 3920, 0, 1675, 4095, 0, 4095, 2953, 0, 3854, 0, 4095, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 4095, 4095, 2687, 0, 2881, 0, 4095, 4095, 1675, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 2318, 4095, 0, 4095, 2843, 0, 2275, 0, 0, 4095, 2340, 0, 4095, 0, 4095, 0, 4095, 0, 0, 0, 637, 3185, 4095, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 1638, 0, 4095, 2730, 1825, 0, 1365, 0, 4095, 4095, 1890, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 2978, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2007, 0, 0, 1508, 632, 0, 1365, 0, 0, 4095, 2155, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2770, 4095, 0, 4095, 1023, 0, 2047, 0, 0, 4095, 1911, 0, 4095, 0, 0, 0, 3251, 0, 0, 4095, 2661, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 1526, 4095, 540, 3663, 1763, 706, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 3500, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3249, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3583, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3510, 0, 481, 0, 3071, 2866, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 81, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2730, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 111, 3185, 2085, 767, 372, 585, 2559, 337, 2476, 3412, 894, 2518, 3399, 1514, 4095, 3622, 1868, 1671, 250, 2109, 3400, 1050, 2925, 227, 0, 0, 0, 0, 0, 4095, 2730, 0, 2142, 3166, 3395, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1883, 0, 4095, 0, 0, 4095, 2047, 0, 2193, 4095, 4095, 0, 0, 0, 1365, 0, 455, 0, 157, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 1023, 0, 1535, 0, 2047, 4095, 2047, 0, 1791, 2457, 1820, 0, 1706, 2730, 1535, 0, 511, 0, 1706, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 3970, 2932, 0, 2370, 4095, 1820, 0, 1651, 722, 2757, 895, 431, 0, 4095, 0, 0, 0, 4095, 0, 4095, 4095, 4095, 0, 4095, 0, 4095, 0, 3640, 0, 3955, 0, 4095, 1613, 0, 0, 3575, 895, 2835, 0, 3722, 3188, 1186, 2457, 4095, 0, 3510, 0, 3374, 0, 0, 0, 4095, 4095, 0, 0, 1279, 4095, 0, 0, 4095, 0, 4095, 0, 4095, 4095, 4095, 0, 4095, 4095, 2457, 0, 505, 3879, 3948, 4095, 4095, 3382, 0, 0, 4095, 4095, 4095, 0, 4095, 4095, 0, 0, 4095, 309, 0, 0, 4095, 4095, 1901, 0, 4095, 2730, 0, 0, 3802, 3802, 0, 0, 4095, 3904, 0, 4095, 664, 0, 0, 0, 4095, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1780, 3071, 2340, 1365, 2815, 0, 0, 2866, 4095, 0, 0, 273, 2766, 0, 0, 0, 2520, 0, 0, 4095, 0, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3583, 0, 0, 2297, 4095, 1854, 4095, 4095, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 585, 0, 0, 0, 0, 0, 0, 0, 4095, 2047, 0, 0, 0, 0, 0, 0, 2003, 0, 2047, 4095, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 372, 0, 0, 4095, 4095, 0, 0, 0, 95, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 511, 0, 0, 3071, 3185, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 4074, 0, 0, 4095, 2754, 3071, 2047, 772, 2071, 0, 0, 357, 3795, 2978, 3450, 3924, 4095, 0, 0, 4095, 3879, 2730, 1023, 4095, 3968, 0, 0, 4095, 3053, 3071, 455, 4095, 4095, 0, 0, 4095, 3426, 3510, 1462, 4095, 4095, 0, 0, 2233, 3780, 1755, 2184, 3613, 4095, 0, 0, 3908, 3960, 2649, 1228, 0, 4095, 0, 0, 4095, 4032, 3185, 1228, 0, 4095, 0, 0, 4095, 4028, 3839, 1489, 0, 0, 0, 0, 223, 3341, 1445, 1529, 2340, 3931, 4095, 4095, 4095, 1221, 0, 0, 4031, 4095, 0, 0, 0, 2293, 0, 4095, 4095, 884, 0, 0, 4095, 204, 0, 0, 3708, 3080, 0, 0, 362, 4095, 3357, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 2770, 4010, 414, 0, 1638, 2730, 0, 0, 2457, 3753, 0, 4095, 682, 2559, 0, 4095, 3983, 1755, 255, 979, 2730, 1744, 0, 0, 0, 3276, 0, 0, 0, 0, 0, 0, 0, 3071, 0, 0, 0, 0, 0, 0, 0, 2730, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2988, 0, 3924, 0, 0, 0, 0, 0, 1049, 3908, 2381, 553, 4095, 0, 4095, 0, 4095, 0, 117, 4095, 0, 0, 0, 3685, 616, 4095, 1365, 1228, 1188, 682, 0, 0, 2047, 0, 1023, 0, 511, 910, 0, 0, 3973, 0, 1228, 4095, 1638, 0, 1023, 0, 682, 0, 215, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4071, 0, 1228, 0, 3603, 0, 1232, 0, 3868, 4095, 3316, 0, 1023, 0, 906, 0, 4095, 0, 0, 0, 4095, 0, 2605, 4095, 2757, 0, 2490, 2047, 4095, 0, 4095, 0, 4095, 0, 3475, 0, 2866, 0, 2854, 2801, 0, 0, 4095, 0, 2047, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 1890, 787, 2047, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 576, 0, 0, 0, 0, 0, 0, 3343, 0, 0, 4095, 0, 0, 0, 3372, 4095, 585, 0, 0, 0, 0, 0, 4095, 0, 1791, 2047, 0, 0, 0, 0, 3839, 0, 1686, 0, 0, 0, 0, 0, 3802, 0, 2167, 0, 1092, 0, 0, 0, 3916, 0, 1575, 0, 0, 0, 0, 0, 4095, 4095, 862, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 1260, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 248, 0, 0, 0, 97, 4095, 0, 1023, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4051, 0, 3276, 1365, 0, 0, 383, 0, 585, 4095, 0, 4095, 4095, 1023, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 1861, 0, 0, 0, 0, 0, 0, 0, 3732, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 3640, 0, 4095, 4095, 0, 0, 4095, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 4095, 2457, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2735, 2680, 2588, 1535, 1562, 3152, 1699, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 0, 0, 0, 1424, 1997, 372, 0, 3685, 1023, 0, 0, 0, 0, 0, 0, 2486, 2730, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1755, 2136, 0, 3276, 0, 0, 3276, 1344, 2502, 2842, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3640, 0, 0, 0, 0, 4095, 2193, 0, 2047, 0, 0, 0, 1342, 2618, 2893, 0, 4095, 0, 455, 0, 0, 0, 0, 0, 1638, 1592, 0, 0, 0, 0, 0, 0, 1365, 0, 945, 0, 157, 1365, 1820, 0, 2559, 0, 1023, 4095, 2205, 334, 2730, 0, 1023, 0, 1023, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 3870, 4033, 0, 576, 2129, 2314, 0, 1806, 0, 3901, 3826, 2543, 1762, 415, 0, 3276, 2047, 4095, 0, 0, 4095, 0, 0, 3534, 1638, 3412, 1228, 4095, 0, 3658, 0, 3802, 2730, 0, 0, 482, 2360, 3003, 0, 3315, 819, 2925, 3869, 3166, 4040, 1276, 0, 3232, 0, 0, 0, 0, 0, 0, 0, 3510, 4095, 0, 0, 4095, 4095, 4095, 0, 4095, 4095, 4095, 0, 3363, 1587, 1861, 0, 4095, 4095, 2047, 3071, 3164, 2408, 431, 0, 3839, 3465, 4095, 0, 4095, 4095, 0, 372, 3465, 2730, 0, 0, 4095, 1976, 4095, 0, 4095, 4095, 0, 0, 4095, 4095, 0, 0, 4095, 0, 4095, 0, 273, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1797, 0, 0, 0, 0, 0, 2698, 3742, 1438, 538, 0, 3185, 2730, 0, 0, 0, 0, 4095, 0, 3071, 1462, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3276, 0, 0, 0, 0, 0, 4095, 2492, 3977, 788, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1575, 1971, 1592, 0, 2925, 2047, 0, 0, 0, 0, 0, 0, 3583, 2136, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 334, 3976, 0, 0, 4095, 3937, 0, 3350, 2644, 3519, 63, 0, 3738, 3434, 0, 0, 3969, 3924, 0, 0, 3045, 2498, 0, 0, 0, 0, 0, 0, 4064, 3198, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 3985, 2238, 0, 0, 0, 4078, 0, 0, 4095, 4095, 0, 0, 0, 4095, 0, 0, 4095, 4084, 0, 0, 4095, 4095, 0, 0, 2314, 292, 0, 0, 0, 4095, 0, 819, 2433, 2248, 3310, 0, 3918, 3371, 0, 0, 4095, 4095, 0, 0, 3327, 273, 0, 0, 4095, 163, 0, 0, 4095, 0, 0, 0, 0, 2925, 0, 0, 4095, 819, 0, 3759, 803, 4015, 2240, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1129, 0, 0, 0, 0, 0, 2457, 1618, 2086, 1516, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 2925, 1732, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3663, 0, 0, 0, 85, 1890, 0, 0, 0, 0, 0, 2481, 3010, 865, 2640, 0, 3867, 0, 0, 0, 0, 0, 0, 0, 2978, 1890, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1404, 0, 2047, 0, 0, 0, 3969, 3983, 3011, 3867, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3885, 0, 819, 2303, 4095, 0, 341, 0, 3978, 2890, 3736, 156, 744, 0, 3705, 0, 4095, 4095, 0, 0, 0, 0, 3867, 0, 315, 4095, 3412, 0, 4095, 0, 4095, 0, 0, 0, 3276, 4095, 2047, 0, 3412, 0, 4095, 0, 2766, 3908, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 3883, 0, 0, 3276, 0, 0, 186, 0, 4095, 4095, 315, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 682, 0, 0, 0, 0, 0, 2047, 0, 0, 0, 4095, 0, 0, 0, 372, 924, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 2047, 0, 0, 0, 0, 4095, 2730, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32, 1545, 0, 1023, 0, 0, 0, 4095, 0, 2457, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 302, 61, 3833, 3088, 84, 756, 4025, 3618, 1669, 1198, 2457, 1365, 1820, 267, 3838, 1645, 3791, 1766, 1295, 273, 3276, 2362, 3694, 344, 1953, 3878, 323, 1995, 1535, 2047, 327, 1453, 4081, 2158, 2019, 530, 3558, 1660, 1883, 1830, 117, 3146, 504, 3186, 1228, 3901, 90, 0, 2730, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1755, 2340, 3858, 0, 1958, 58, 67, 93, 3722, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 3997, 4073, 0, 2047, 0, 0, 0, 3927, 0, 3549, 0, 1820, 2275, 585, 0, 4046, 1116, 1472, 3350, 1365, 528, 2028, 1436, 564, 0, 4095, 4095, 4095, 0, 4095, 0, 4073, 1865, 97, 0, 2317, 3393, 0, 4032, 0, 0, 4095, 0, 4095, 0, 0, 0, 3442, 0, 0, 4095, 4095, 4095, 0, 4095, 1602, 3530, 0, 0, 0, 4095, 4095, 0, 4095, 4095, 4095, 0, 4095, 4095, 0, 0, 4095, 4095, 4095, 0, 3663, 3480, 0, 0, 2293, 2408, 1102, 2245, 2559, 4095, 0, 4095, 1453, 4095, 0, 4095, 4095, 4095, 4095, 0, 4095, 4095, 0, 0, 4095, 4095, 0, 0, 2605, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 1132, 1813, 1580, 0, 0, 0, 0, 0, 1023, 0, 0, 2233, 1861, 2275, 0, 180, 315, 455, 3106, 4095, 2047, 0, 1737, 0, 2047, 0, 0, 0, 3839, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 1023, 0, 4095, 2730, 4095, 4095, 0, 0, 1228, 0, 0, 0, 0, 0, 0, 0, 671, 2541, 1079, 0, 0, 0, 0, 0, 1644, 0, 819, 2457, 1638, 2184, 0, 66, 952, 0, 1899, 4023, 2829, 0, 3753, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3791, 0, 511, 4095, 3412, 0, 0, 0, 255, 0, 267, 4095, 0, 0, 0, 0, 0, 0, 819, 0, 4095, 0, 0, 0, 3663, 3241, 356, 4095, 4095, 0, 0, 3924, 3988, 3276, 204, 2992, 3663, 819, 0, 3318, 3337, 1365, 1316, 4065, 4074, 0, 3443, 4095, 4040, 3071, 2047, 4095, 0, 0, 0, 0, 3327, 3640, 1755, 3685, 4065, 0, 0, 0, 4009, 4095, 1023, 4095, 0, 0, 0, 4095, 4053, 3071, 341, 0, 4095, 0, 0, 4095, 3916, 4095, 1575, 3350, 3696, 0, 0, 0, 3560, 3663, 2559, 0, 0, 0, 0, 1535, 3266, 2457, 1116, 4031, 2957, 0, 0, 2730, 2565, 0, 1535, 4095, 3854, 0, 4095, 0, 2925, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 3958, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 491, 3990, 1453, 3722, 1742, 2362, 0, 3822, 706, 0, 0, 0, 0, 0, 0, 2730, 2792, 4095, 0, 0, 4095, 0, 0, 2047, 1228, 0, 0, 0, 0, 0, 4095, 1861, 2835, 4095, 0, 4095, 1861, 0, 0, 0, 1015, 0, 0, 0, 0, 0, 0, 2730, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 3583, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2184, 0, 0, 0, 4095, 0, 3185, 2824, 585, 1525, 4095, 0, 215, 4095, 0, 744, 4095, 4095, 3953, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 2275, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 1668, 0, 0, 0, 0, 0, 0, 455, 3419, 0, 0, 0, 0, 0, 0, 0, 2749, 0, 3549, 2340, 2047, 0, 2225, 0, 4095, 0, 4095, 0, 3112, 0, 4095, 585, 1507, 4095, 0, 0, 3071, 0, 1586, 0, 2768, 0, 3125, 0, 3839, 0, 4095, 0, 3658, 0, 1976, 0, 1734, 31, 2675, 0, 0, 0, 0, 0, 0, 0, 113, 3276, 2866, 0, 3744, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 409, 0, 1137, 0, 0, 0, 4095, 0, 0, 0, 4095, 1820, 4095, 0, 0, 0, 0, 3465, 1535, 511, 3629, 0, 0, 0, 4095, 0, 120, 4095, 0, 0, 3753, 0, 1116, 195, 4095, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 4095, 0, 4095, 0, 0, 0, 2408, 2584, 0, 0, 0, 0, 0, 0, 3867, 1194, 0, 4095, 0, 0, 0, 3412, 0, 1593, 0, 0, 4095, 0, 0, 1481, 1365, 3502, 0, 1820, 0, 3217, 0, 2913, 4095, 441, 0, 0, 0, 0, 0, 1549, 4095, 1866, 0, 2730, 682, 0, 0, 315, 3412, 1888, 0, 0, 0, 0, 0, 3302, 4095, 469, 0, 4095, 0, 0, 0, 784, 4095, 2856, 0, 0, 0, 0, 0, 0, 4095, 910, 0, 4095, 0, 0, 0, 0, 0, 1628, 0, 0, 0, 0, 0, 0, 481, 1939, 0, 1820, 0, 0, 0, 0, 1638, 3276, 0, 0, 0, 0, 0, 0, 4095, 862, 0, 4095, 0, 0, 0, 99, 3753, 895, 0, 0, 0, 0, 0, 270, 4095, 1867, 0, 4095, 0, 0, 0, 0, 4095, 2815, 0, 0, 0, 0, 0, 0, 4095, 1433, 0, 2730, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 235, 151, 3839, 554, 3992, 4095, 0, 0, 0, 90, 4095, 1940, 0, 3150, 0, 0, 0, 336, 3799, 201, 0, 0, 4095, 0, 0, 0, 0, 595, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 3412, 0, 39, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 372, 73, 3610, 3802, 4095, 0, 4095, 0, 2559, 4095, 0, 2788, 4056, 1770, 0, 3854, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3839, 0, 4095, 853, 2925, 0, 4095, 0, 1890, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 2593, 1365, 2047, 3071, 0, 0, 1638, 4095, 0, 0, 0, 0, 0, 4095, 4095, 2034, 3071, 585, 3276, 819, 1198, 1077, 0, 3647, 1535, 2047, 0, 0, 0, 0, 4095, 0, 2815, 1023, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 2730, 3553, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 2285, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 3495, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 3917, 0, 0, 3967, 0, 0, 0, 3648, 0, 2362, 0, 0, 0, 4095, 0, 0, 0, 2925, 4095, 3640, 0, 390, 1158, 0, 0, 0, 0, 4095, 4080, 3867, 0, 3297, 4036, 0, 0, 3111, 0, 4095, 0, 0, 0, 4095, 0, 4095, 4095, 0, 0, 3505, 3510, 0, 0, 4095, 3685, 0, 4095, 2340, 4095, 0, 3412, 0, 4095, 0, 0, 4095, 4095, 2661, 4095, 1585, 4095, 4095, 0, 3120, 4095, 0, 0, 4095, 4095, 4095, 0, 4095, 2520, 327, 4095, 1869, 3150, 0, 3363, 4095, 4095, 0, 4095, 4095, 3549, 4095, 0, 4095, 3854, 2370, 3035, 1134, 1598, 0, 4095, 2730, 0, 0, 0, 168, 0, 0, 0, 4095, 0, 4095, 0, 3795, 1188, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 491, 36, 0, 0, 0, 3412, 0, 2730, 4095, 4095, 4095, 0, 40, 2184, 0, 2925, 4095, 2047, 0, 4095, 0, 4095, 0, 4095, 0, 0, 0, 0, 4095, 4095, 1575, 4095, 2047, 1602, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 969, 2047, 1417, 2827, 0, 1023, 1204, 0, 3849, 163, 3916, 0, 4095, 0, 0, 4095, 0, 2502, 4095, 1270, 1911, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 1595, 0, 19, 4095, 0, 0, 0, 4095, 0, 0, 4095, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 4095, 1706, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 3883, 0, 0, 4095, 0, 3583, 4095, 3953, 4057, 0, 0, 3867, 4095, 0, 0, 4095, 4095, 0, 0, 3697, 2067, 0, 4095, 4095, 3313, 2047, 4095, 4083, 3412, 0, 0, 4095, 4064, 0, 0, 0, 4095, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 4095, 3151, 2457, 0, 3999, 3143, 2047, 4095, 3970, 3939, 0, 3640, 0, 3691, 0, 0, 4095, 3780, 0, 0, 4095, 3350, 4095, 0, 3970, 3677, 0, 0, 3921, 3865, 0, 0, 3846, 3771, 722, 4095, 4095, 4095, 0, 0, 3999, 3276, 0, 4095, 4095, 2541, 0, 0, 4095, 4027, 0, 0, 3948, 2824, 0, 0, 4095, 3937, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 1939, 1553, 1560, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 682, 0, 0, 2888, 146, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 1194, 0, 0, 1719, 202, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 95, 614, 0, 4095, 1470, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3885, 0, 2047, 3102, 0, 4095, 953, 1419, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 255, 0, 0, 2920, 87, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 210, 1560, 0, 4095, 1110, 712, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 767, 0, 0, 4095, 3685, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 1023, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 2193, 0, 2925, 4095, 4095, 0, 1886, 0, 4095, 2730, 0, 0, 1365, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 4095, 4095, 0, 0, 4095, 0, 4095, 1023, 4095, 0, 4095, 0, 455, 2047, 0, 3071, 1228, 4095, 0, 0, 4095, 0, 4095, 0, 1660, 4095, 0, 4095, 909, 819, 0, 0, 2730, 0, 1077, 2047, 0, 0, 4095, 4095, 1228, 3071, 1489, 4095, 976, 0, 4095, 0, 0, 2340, 4095, 0, 0, 0, 4095, 0, 1797, 3583, 4095, 4069, 458, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3150, 4095, 0, 4095, 4051, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1968, 4095, 0, 308, 343, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 4095, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 3253, 4095, 0, 4095, 411, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 3649, 107, 2205, 819, 4095, 2149, 24, 0, 3744, 1445, 682, 0, 0, 0, 0, 4095, 0, 1075, 819, 0, 4095, 1475, 834, 283, 0, 0, 3455, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1920, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3177, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2314, 4095, 0, 86, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 4031, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 2047, 3276, 0, 1365, 0, 2047, 2730, 2047, 4095, 1638, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 3251, 1736, 433, 1130, 3456, 391, 2205, 4095, 3678, 3056, 790, 1563, 1957, 881, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 318, 0, 186, 0, 1146, 1462, 2167, 1365, 2616, 3071, 0, 0, 4095, 1228, 1638, 0, 0, 0, 0, 0, 1682, 4095, 0, 0, 0, 0, 3997, 0, 4095, 1675, 2047, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 1881, 0, 0, 0, 0, 0, 0, 0, 1023, 0, 0, 0, 2242, 2233, 0, 0, 195, 0, 0, 3071, 0, 0, 0, 3722, 2300, 599, 392, 137, 3644, 1858, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 2532, 4095, 0, 4095, 0, 0, 0, 3969, 0, 3531, 0, 2109, 1638, 0, 0, 0, 0, 4095, 4095, 3802, 0, 0, 4095, 1703, 1927, 2178, 1602, 3017, 260, 4047, 0, 3627, 3887, 682, 0, 2569, 0, 4095, 0, 2457, 0, 4095, 0, 4095, 0, 4095, 0, 3523, 2486, 1755, 0, 4095, 4095, 0, 0, 819, 4095, 4095, 0, 0, 0, 4095, 0, 4095, 4095, 4095, 0, 4095, 4095, 0, 0, 3900, 4095, 1958, 2047, 3236, 2925, 1849, 0, 4095, 4095, 4095, 0, 4095, 4095, 0, 4095, 1686, 1023, 0, 3135, 2529, 829, 4095, 0, 4095, 4095, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 368, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 1853, 1869, 1285, 0, 0, 0, 0, 110, 1638, 218, 1179, 2541, 2340, 2730, 0, 80, 455, 0, 4095, 2275, 0, 682, 4019, 2087, 507, 417, 3238, 3322, 787, 0, 0, 0, 1365, 819, 0, 0, 4095, 0, 0, 0, 4095, 0, 4095, 0, 4095, 3990, 4095, 4095, 1965, 1927, 0, 4095, 0, 4095, 0, 0, 282, 4095, 0, 0, 0, 0, 0, 0, 351, 2395, 1232, 0, 0, 0, 0, 20, 2103, 0, 1713, 2205, 1965, 2841, 0, 4095, 4095, 0, 0, 0, 2047, 0, 4078, 878, 1298, 0, 1179, 3949, 986, 0, 0, 0, 120, 0, 0, 0, 0, 0, 0, 0, 3873, 4095, 0, 4095, 2047, 0, 0, 0, 204, 0, 501, 4095, 0, 0, 0, 0, 682, 0, 2047, 0, 1968, 0, 0, 0, 3839, 1890, 372, 4095, 4036, 0, 0, 2801, 3385, 728, 455, 2940, 3605, 975, 0, 3553, 3218, 3904, 1820, 3711, 4050, 1023, 3956, 3276, 2249, 718, 3080, 3531, 491, 0, 0, 4095, 3526, 2520, 1890, 0, 4095, 0, 0, 0, 3549, 3071, 819, 0, 4095, 4095, 0, 4095, 3672, 2340, 0, 4095, 4095, 0, 0, 0, 4035, 3762, 2047, 4095, 3894, 0, 0, 4095, 3717, 2596, 877, 0, 0, 0, 0, 182, 4085, 255, 1885, 4095, 4095, 4095, 0, 2957, 2961, 0, 0, 4095, 4095, 0, 4095, 0, 105, 0, 1820, 4026, 2104, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3685, 2730, 282, 0, 0, 0, 0, 4095, 0, 3583, 0, 2730, 1170, 0, 1260, 4095, 1890, 1306, 955, 1248, 1365, 0, 0, 0, 4095, 3412, 1092, 0, 0, 0, 0, 0, 0, 1828, 1655, 0, 0, 0, 4095, 0, 4095, 2620, 2047, 0, 0, 0, 0, 0, 0, 538, 3583, 0, 0, 0, 0, 0, 2205, 853, 341, 0, 0, 0, 0, 0, 682, 0, 1689, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2583, 2198, 0, 2134, 3843, 0, 921, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 110, 0, 0, 0, 0, 0, 0, 0, 3499, 0, 4095, 0, 0, 0, 4095, 0, 2565, 0, 0, 0, 0, 0, 0, 0, 3948, 2730, 4095, 0, 0, 0, 2011, 1699, 2155, 3399, 1954, 2047, 4095, 0, 2925, 862, 1952, 0, 0, 0, 3844, 0, 0, 0, 3071, 0, 0, 0, 4095, 0, 4095, 2047, 1861, 0, 4095, 0, 0, 0, 0, 0, 2093, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 639, 4095, 0, 0, 4095, 0, 0, 0, 2047, 0, 4095, 0, 0, 4095, 4095, 2529, 2047, 2605, 4095, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 61, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1219, 839, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 315, 4095, 0, 1738, 4095, 0, 0, 0, 0, 3663, 4095, 3209, 4095, 0, 0, 4095, 444, 919, 367, 3511, 2843, 215, 0, 0, 4095, 1478, 2730, 511, 0, 0, 0, 0, 0, 158, 4032, 2454, 0, 4095, 4095, 4095, 4095, 3120, 2314, 117, 0, 0, 0, 0, 0, 635, 4095, 0, 0, 0, 0, 0, 0, 305, 4095, 710, 0, 0, 0, 0, 0, 4095, 0, 1534, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 804, 0, 0, 301, 2252, 0, 3071, 0, 0, 0, 0, 178, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 1999, 0, 0, 0, 0, 0, 292, 4095, 135, 0, 0, 0, 0, 6, 0, 0, 1365, 0, 0, 4095, 0, 0, 0, 0, 1170, 0, 0, 1365, 4095, 420, 148, 1179, 2056, 3640, 160, 0, 0, 614, 225, 4013, 1750, 0, 0, 0, 0, 0, 0, 0, 644, 0, 0, 4095, 0, 4095, 2047, 1965, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1872, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 3928, 1276, 264, 798, 3747, 549, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 2293, 0, 0, 0, 4095, 0, 1023, 0, 0, 4095, 2047, 0, 0, 4095, 581, 1999, 2478, 2566, 2978, 218, 0, 0, 0, 1365, 1638, 0, 0, 4095, 0, 0, 2047, 4095, 0, 0, 0, 0, 3839, 0, 4095, 2559, 2136, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 3011, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3566, 0, 0, 0, 0, 0, 0, 4095, 682, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4084, 4095, 0, 4095, 0, 3753, 0, 2605, 0, 2063, 372, 4095, 0, 2704, 0, 4095, 0, 4095, 4095, 4095, 4095, 1801, 4095, 1572, 157, 1404, 3567, 1831, 982, 3455, 0, 4095, 3213, 2730, 0, 2361, 4095, 2909, 0, 2634, 0, 4095, 0, 3350, 0, 4095, 0, 4045, 1585, 2161, 0, 4095, 4095, 0, 0, 2840, 4095, 3071, 0, 4095, 4095, 3656, 0, 4095, 0, 4095, 0, 4095, 0, 0, 0, 96, 2047, 930, 1149, 4095, 0, 4095, 0, 4095, 4095, 0, 4095, 4095, 0, 4095, 2978, 1699, 1113, 66, 3953, 1706, 51, 1774, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 3382, 4095, 4095, 0, 118, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 1165, 0, 4095, 0, 0, 0, 108, 4095, 341, 577, 3791, 4095, 3717, 0, 64, 945, 4095, 4095, 0, 0, 4095, 3010, 574, 979, 0, 3071, 3229, 3583, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 1535, 0, 0, 47, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3671, 4025, 0, 708, 2200, 0, 2047, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 3003, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 3994, 0, 0, 0, 0, 0, 0, 4095, 40, 0, 0, 3276, 4095, 0, 4095, 4095, 4095, 0, 0, 409, 4095, 0, 0, 3988, 3483, 0, 4095, 819, 1835, 0, 4095, 4095, 3830, 0, 0, 4095, 4095, 0, 0, 4095, 4095, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 4095, 0, 0, 4095, 4095, 0, 0, 3982, 3358, 0, 0, 3908, 4095, 0, 0, 4095, 4095, 0, 0, 4095, 0, 0, 0, 4095, 4095, 0, 0, 4095, 3722, 0, 0, 3987, 4095, 0, 0, 4095, 4095, 0, 4095, 1302, 3480, 0, 4095, 1686, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 2730, 0, 4095, 0, 0, 0, 0, 0, 74, 0, 0, 2492, 0, 0, 2730, 0, 1023, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 3276, 157, 211, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 3886, 0, 3276, 0, 0, 0, 2419, 0, 2649, 0, 3, 0, 4095, 4095, 0, 0, 66, 0, 2649, 4095, 1706, 0, 2457, 0, 4095, 0, 3336, 0, 0, 0, 2249, 0, 3970, 0, 3701, 0, 4095, 0, 4095, 0, 1547, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 1820, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2730, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 1149, 0, 3613, 2925, 0, 2714, 606, 0, 1638, 761, 4060, 2047, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3458, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1365, 0, 0, 0, 0, 945, 0, 0, 403, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 3797, 4095, 0, 4095, 3736, 4095, 0, 2784, 639, 2155, 0, 4095, 0, 0, 0, 4091, 0, 397, 3071, 1260, 945, 1321, 2047, 3455, 4009, 4095, 0, 3412, 0, 4095, 0, 4066, 3340, 637, 840, 3795, 4095, 741, 0, 1579, 2713, 254, 3510, 1002, 0, 0, 4095, 4007, 0, 1462, 0, 4095, 4095, 0, 0, 1365, 2978, 0, 0, 0, 4095, 4095, 0, 3780, 0, 4095, 0, 4095, 0, 0, 0, 4095, 0, 4095, 0, 4095, 0, 0, 0, 4095, 0, 4095, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 4095, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 1445, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 1228, 0, 0, 0, 0, 0, 0, 0, 0, 1668, 1365, 1393, 4095, 315, 0, 0, 0, 1638, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 1535, 367, 2047, 910, 1535, 1023, 0, 0, 4095, 767, 3830, 372, 3336, 44, 0, 4095, 0, 4095, 4095, 0, 3480, 2047, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 761, 4095, 4095, 0, 0, 0, 0, 0, 38, 0, 1116, 0, 2457, 0, 0, 0, 1747, 2502, 967, 0, 585, 2233, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 307, 0, 0, 0, 0, 0, 0, 0, 4025, 0, 819, 4095, 2730, 0, 0, 0, 0, 0, 2205, 4095, 0, 0, 0, 0, 0, 0, 546, 4095, 3967, 0, 0, 0, 3185, 2605, 2047, 4095, 4095, 0, 0, 4095, 4062, 2457, 2340, 4095, 4095, 0, 0, 2408, 3712, 3071, 1462, 3957, 3842, 0, 0, 0, 4033, 2605, 1023, 3276, 2605, 0, 0, 4095, 3654, 3753, 1137, 2872, 4086, 2047, 4095, 4095, 3102, 1565, 1706, 0, 2233, 0, 4095, 4095, 4002, 2457, 1462, 0, 4095, 4095, 4095, 4095, 4044, 2730, 1489, 4095, 4095, 0, 0, 4095, 2885, 3071, 1077, 0, 0, 0, 0, 4095, 4041, 3510, 910, 4095, 3942, 0, 0, 2872, 3588, 4095, 0, 0, 4095, 0, 0, 0, 3062, 0, 0, 0, 4095, 0, 0, 4095, 4095, 0, 0, 2047, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 544, 885, 1557, 113, 1296, 20, 0, 3839, 1696, 4095, 0, 0, 0, 0, 0, 3412, 0, 4095, 3780, 0, 0, 4095, 2047, 2559, 1137, 682, 3583, 2100, 0, 0, 4095, 2340, 2340, 0, 4095, 4095, 1755, 3802, 0, 1780, 2064, 511, 0, 0, 0, 4095, 0, 2047, 231, 0, 4095, 0, 1945, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 511, 120, 0, 0, 0, 0, 0, 0, 0, 461, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 3606, 0, 0, 0, 0, 0, 0, 0, 2457, 0, 0, 0, 0, 0, 4095, 0, 3071, 3071, 0, 0, 0, 0, 0, 0, 3003, 0, 0, 0, 0, 0, 0, 0, 3908, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 61, 511, 2609, 1365, 4017, 4095, 507, 0, 1638, 341, 3003, 0, 2457, 4022, 0, 0, 4095, 2047, 3259, 0, 372, 4095, 3542, 311, 2340, 297, 1839, 327, 1365, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 227, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3937, 4095, 3705, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 196, 4095, 0, 0, 0, 0, 0, 4095, 0, 4095, 4095, 0, 0, 4095, 0, 0, 0, 1603, 959, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1616, 4095, 2536, 0, 0, 0, 0, 0, 4095, 0, 2586, 1535, 0, 0, 0, 1023, 1954, 2559, 196, 2047, 1587, 0, 0, 4095, 2047, 1453, 113, 4028, 0, 660, 2948, 0, 413, 3121, 1765, 0, 0, 0, 4095, 0, 998, 4095, 2419, 4095, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 205, 4095, 80, 0, 0, 0, 0, 0, 0, 0, 431, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 553, 0, 0, 0, 0, 0, 0, 0, 3276, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 1875, 0, 0, 0, 0, 0, 1253, 4095, 1320, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 652, 4095, 1027, 754, 0, 0, 0, 0, 498, 4095, 706, 0, 1170, 0, 0, 0, 0, 3327, 693, 1228, 0, 0, 682, 0, 105, 3556, 3960, 4095, 0, 0, 4095, 4095, 862, 4095, 0, 0, 0, 0, 0, 0, 1023, 0, 409, 0, 0, 0, 0, 0, 1535, 4095, 4095, 0, 0, 0, 0, 0, 390, 4095, 4058, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3485, 662, 258, 4017, 3189, 3814, 2273, 2340, 1004, 2484, 2106, 1997, 0, 0, 1365, 4095, 3089, 4095, 0, 0, 0, 0, 0, 0, 0, 1618, 0, 0, 4095, 0, 3946, 0, 2291, 0, 930, 4095, 1262, 4054, 1365, 0, 0, 0, 0, 4095, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2856, 0, 0, 0, 0, 2329, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3879, 0, 758, 0, 255, 2047, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 3708, 2866, 0, 4095, 0, 3812, 0, 2985, 3276, 3890, 0, 0, 0, 4095, 0, 0, 0, 3839, 0, 4095, 0, 945, 0, 3549, 4095, 3603, 0, 4095, 0, 3747, 0, 4095, 3744, 481, 2925, 2268, 4095, 734, 393, 3367, 4095, 3642, 0, 3802, 120, 3276, 4095, 3009, 0, 1861, 0, 4095, 4095, 0, 0, 1806, 4095, 0, 0, 4095, 1365, 4095, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 4095, 4095, 0, 4095, 0, 0, 0, 4095, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 2047, 0, 0, 2155, 0, 0, 4095, 4095, 4095, 0, 53, 0, 682, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 3071, 0, 4095, 694, 3003, 1170, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 790, 0, 73, 0, 4095, 4095, 0, 3276, 0, 2047, 0, 0, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 2538, 0, 0, 0, 0, 0, 0, 13, 3900, 0, 0, 4095, 4095, 0, 0, 4095, 4051, 0, 0, 2936, 3523, 0, 0, 3510, 4095, 0, 0, 3301, 4047, 0, 0, 4095, 3991, 0, 0, 4095, 1365, 4095, 0, 361, 4041, 4095, 3899, 0, 3839, 1365, 4095, 722, 3916, 3327, 4095, 3802, 3879, 4095, 0, 4095, 1624, 0, 0, 3975, 3837, 0, 0, 4095, 3931, 0, 0, 4095, 2079, 0, 0, 0, 3276, 4095, 0, 4039, 3996, 0, 0, 3186, 3590, 1943, 0, 3909, 3963, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 3990, 0, 0, 1365, 4095, 2047, 4095, 0, 0, 0, 0, 1290, 113, 1568, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1535, 157, 1535, 0, 2925, 0, 0, 4095, 1876, 0, 4095, 0, 0, 0, 4095, 0, 3240, 0, 2047, 0, 0, 0, 0, 0, 0, 2952, 0, 0, 4095, 0, 3652, 0, 3488, 945, 139, 756, 1638, 4095, 399, 4095, 2486, 0, 4095, 4095, 0, 0, 4095, 0, 4095, 0, 3455, 819, 0, 0, 0, 0, 0, 0, 0, 0, 3350, 0, 1706, 4095, 0, 2047, 2172, 0, 0, 0, 0, 4095, 2605, 0, 3510, 0, 3663, 0, 2765, 4095, 0, 4095, 3003, 481, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 1959, 0, 0, 0, 0, 4095, 2275, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 682, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 1855, 0, 3753, 0, 1474, 4095, 1433, 0, 1158, 0, 2019, 0, 4095, 0, 4095, 0, 2730, 0, 4095, 0, 819, 0, 0, 1602, 3523, 0, 4061, 0, 3516, 0, 4095, 4095, 2257, 2835, 3199, 4095, 4095, 4095, 2687, 0, 4095, 4095, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 3510, 1570, 0, 1365, 0, 4095, 4095, 1901, 0, 4095, 0, 4095, 0, 4095, 0, 0, 4095, 731, 3276, 0, 0, 0, 0, 0, 0, 3839, 0, 4095, 0, 0, 4095, 0, 4095, 1696, 0, 4050, 0, 4095, 4095, 1445, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 309, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2340, 4095, 186, 2218, 1320, 0, 1365, 0, 0, 4095, 1560, 0, 4095, 0, 0, 0, 0, 0, 1828, 4095, 0, 0, 0, 4095, 0, 0, 0, 1717, 0, 0, 4095, 2205, 2227, 2123, 3937, 4095, 1088, 2600, 240, 3382, 687, 819, 2632, 0, 4095, 4095, 4095, 0, 1865, 4095, 0, 4095, 1724, 139, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1774, 4095, 0, 0, 1213, 1820, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 722, 0, 0, 4095, 3995, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 3916, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 4095, 4095, 0, 3071, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 12, 4095, 1861, 186, 0, 2340, 3780, 682, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 365, 2423, 2837, 0, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1023, 0, 731, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 3627, 0, 1508, 2047, 0, 3071, 3686, 3226, 3097, 938, 4095, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1119, 0, 0, 0, 0, 2047, 1170, 0, 2047, 50, 0, 585, 0, 4095, 4095, 0, 2541, 0, 527, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 819, 0, 1365, 2730, 4095, 0, 0, 1023, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 1838, 3465, 0, 1876, 1438, 3640, 0, 3480, 1638, 3107, 4095, 4095, 0, 0, 0, 3276, 0, 4095, 0, 0, 0, 1535, 0, 4095, 0, 4095, 0, 4095, 0, 1365, 0, 4095, 341, 0, 0, 3454, 2486, 2047, 0, 4050, 4015, 3094, 4095, 4095, 4095, 4095, 0, 4095, 0, 585, 0, 0, 0, 0, 0, 0, 0, 170, 0, 5, 0, 4095, 0, 0, 0, 4095, 0, 0, 646, 0, 0, 2696, 3722, 3276, 4095, 0, 3412, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3071, 0, 0, 0, 0, 0, 3640, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 1365, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 2047, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 4095, 963, 3202, 4095, 2632, 2866, 2965, 3854, 546, 1755, 260, 3924, 4095, 4095, 0, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 372, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2730, 0, 2730, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 1023, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 2496, 2866, 1755, 390, 1002, 0, 0, 3276, 4072, 2730, 1592, 4095, 4033, 0, 0, 1608, 3771, 4095, 945, 2047, 3583, 1755, 0, 0, 4061, 3510, 455, 0, 3822, 0, 0, 4095, 3992, 3830, 3376, 1905, 3640, 2559, 1906, 712, 3921, 536, 2002, 4095, 4095, 0, 4095, 0, 3886, 3382, 945, 0, 3948, 0, 0, 3780, 4026, 3412, 1489, 0, 1904, 0, 0, 4095, 2886, 4095, 1365, 0, 264, 0, 0, 1995, 2280, 3874, 2047, 4095, 3999, 0, 0, 3974, 3434, 0, 0, 0, 4095, 0, 0, 0, 1365, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 4095, 2252, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 2457, 3867, 2670, 4095, 0, 0, 0, 4095, 0, 3071, 682, 0, 3040, 0, 0, 0, 0, 3510, 0, 0, 0, 2925, 0, 0, 4095, 1755, 3695, 0, 1335, 4095, 175, 3890, 0, 1554, 1933, 4095, 4095, 0, 4095, 4095, 0, 431, 2925, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 682, 0, 0, 0, 0, 1638, 0, 0, 481, 2761, 607, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 1116, 64, 0, 682, 4095, 0, 0, 4095, 315, 735, 4095, 4095, 0, 0, 0, 0, 0, 1715, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 4095, 819, 639, 4095, 0, 1962, 2047, 153, 3916, 3546, 0, 4095, 0, 0, 0, 2346, 0, 0, 0, 2047, 0, 3730, 0, 1617, 0, 4040, 4095, 0, 0, 3412, 758, 2983, 4095, 4095, 4095, 3179, 0, 2815, 1608, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1336, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 819, 4095, 0, 4095, 341, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1706, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2492, 2502, 528, 0, 0, 0, 0, 0, 3839, 0, 2239, 0, 0, 0, 0, 0, 2925, 4095, 2478, 0, 0, 0, 0, 4095, 4095, 4095, 511, 3924, 455, 0, 0, 0, 3006, 4095, 2890, 0, 0, 0, 0, 0, 297, 3789, 674, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3924, 2542, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 409, 4095, 1293, 0, 0, 0, 0, 511, 666, 1755, 1000, 2145, 3295, 0, 0, 0, 0, 4095, 1734, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 225, 4095, 1445, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 4095, 1134, 3583, 0, 0, 0, 0, 744, 4095, 570, 0, 1535, 0, 0, 3640, 305, 2362, 352, 1811, 4095, 0, 2184, 0, 392, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2324, 2200, 2992, 1535, 1386, 3057, 1963, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 3071, 0, 0, 0, 4095, 0, 0, 0, 0, 1023, 0, 0, 0, 2730, 4095, 0, 1820, 2340, 1613, 0, 1365, 0, 0, 4095, 3740, 2845, 1581, 278, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 1755, 1965, 0, 0, 0, 0, 4095, 3567, 3033, 2013, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 780, 2205, 2218, 0, 0, 0, 0, 2047, 1535, 1945, 3803, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 3048, 4095, 0, 69, 1512, 1755, 0, 4095, 0, 2496, 3890, 3237, 1186, 819, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 4095, 0, 3315, 2925, 4095, 0, 278, 1504, 2408, 89, 0, 4095, 0, 3396, 3733, 3879, 863, 682, 2925, 0, 0, 0, 4095, 2047, 0, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 100, 2792, 1801, 0, 4095, 0, 4095, 3854, 3912, 1973, 617, 0, 0, 0, 3336, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2730, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 199, 1221, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1023, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 4095, 0, 0, 0, 4095, 0, 4095, 2890, 4095, 2632, 4017, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 3627, 0, 0, 0, 0, 0, 0, 44, 3454, 0, 0, 0, 4095, 0, 3969, 3755, 3088, 500, 0, 0, 4095, 0, 0, 3127, 3936, 4095, 0, 1755, 2520, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 397, 2762, 0, 71, 273, 4095, 0, 1302, 738, 3876, 118, 0, 4095, 4095, 0, 4095, 4095, 2559, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 4095, 2047, 0, 0, 153, 1109, 0, 0, 0, 4095, 4095, 4095, 3152, 3738, 2803, 0, 4095, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 0, 4066, 3722, 1489, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 445, 2111, 0, 186, 0, 0, 0, 3802, 3164, 2822, 3356, 0, 0, 0, 0, 4095, 819, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 2457, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3071, 0, 0, 0, 0, 2619, 0, 157, 3276, 4095, 0, 3336, 1509, 3811, 1607, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 759, 2681, 0, 97, 0, 0, 0, 1950, 3844, 1100, 2351, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 124, 1922, 0, 0, 1365, 204, 3510, 3991, 3542, 3026, 3911, 0, 26, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 2275, 4095, 2502, 0, 4095, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 99, 3071, 0, 0, 0, 0, 0, 4095, 1342, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 630, 372, 0, 0, 0, 0, 0, 4095, 0, 1228, 240, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 585, 0, 0, 0, 0, 0, 4095, 620, 0, 3453, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 2275, 0, 4095, 910, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 3879, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 1023, 0, 0, 0, 0, 1755, 0, 0, 0, 0, 0, 0, 4095, 1239, 2605, 1153, 2138, 2856, 2408, 1428, 2670, 2983, 26, 3226, 3388, 0, 0, 4095, 4095, 2607, 1728, 26, 3680, 1077, 2687, 2238, 195, 3579, 329, 2437, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 146, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1004, 4095, 0, 0, 3015, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1023, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 3230, 0, 0, 4095, 0, 4095, 0, 3978, 0, 4095, 0, 0, 0, 0, 0, 3071, 0, 3378, 4095, 2649, 4095, 0, 0, 1927, 1770, 3071, 2388, 2205, 4095, 0, 0, 4089, 3746, 0, 0, 2289, 0, 1365, 3757, 819, 0, 0, 0, 4095, 0, 0, 4095, 3532, 2311, 126, 2445, 4095, 4095, 1360, 0, 280, 2967, 1107, 0, 2221, 0, 3583, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 332, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 3640, 0, 910, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 2047, 4095, 819, 0, 1424, 2293, 2835, 1820, 2233, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 4095, 1911, 3568, 132, 3583, 2047, 0, 3583, 252, 1249, 3954, 0, 2916, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 2047, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 3482, 0, 0, 0, 3943, 2047, 1675, 0, 4095, 0, 0, 0, 4052, 2340, 1445, 0, 4095, 0, 0, 787, 1578, 2520, 2641, 3805, 3787, 0, 0, 2649, 2730, 2486, 1997, 2492, 4095, 0, 0, 0, 2687, 2730, 1462, 4095, 4095, 0, 0, 0, 3879, 2047, 1861, 0, 4095, 0, 4095, 4078, 3763, 3661, 614, 545, 4095, 1838, 3918, 0, 3454, 2082, 1228, 0, 4035, 0, 0, 4095, 3711, 2340, 1820, 0, 0, 0, 0, 0, 4009, 2730, 1365, 4095, 3641, 0, 0, 3873, 2489, 0, 0, 4095, 4021, 0, 0, 0, 2925, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 3988, 682, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3028, 1436, 3530, 406, 2767, 0, 0, 3640, 341, 0, 0, 0, 0, 0, 12, 744, 2275, 4095, 1397, 4095, 799, 120, 1608, 2047, 1890, 1939, 2362, 3549, 4095, 0, 0, 3583, 1861, 1365, 0, 0, 4095, 0, 0, 3340, 2087, 0, 0, 4095, 1638, 4095, 4095, 2175, 3107, 0, 4074, 1706, 1240, 3412, 4095, 2388, 1628, 0, 2193, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 761, 4095, 0, 0, 0, 0, 3131, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2925, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 2890, 0, 4095, 0, 248, 1638, 0, 0, 4095, 0, 0, 0, 0, 0, 210, 0, 1365, 4095, 1722, 0, 106, 0, 2047, 2293, 2906, 2047, 2730, 4045, 4095, 0, 4095, 0, 0, 0, 2047, 0, 2047, 0, 4095, 0, 0, 0, 0, 4095, 4095, 4095, 4095, 3102, 924, 3024, 4095, 3822, 2245, 168, 96, 2108, 382, 2388, 2275, 0, 2730, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 4095, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 134, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1911, 1922, 0, 0, 0, 0, 0, 0, 0, 0, 0, 642, 0, 4095, 0, 4095, 4095, 561, 0, 0, 0, 0, 2, 1365, 0, 1278, 2541, 4095, 2979, 0, 1694, 2730, 2978, 1116, 1971, 4095, 0, 0, 0, 4095, 2047, 105, 3890, 4095, 0, 0, 0, 804, 4032, 2408, 0, 4095, 0, 4095, 4095, 2444, 481, 46, 4001, 4095, 154, 1573, 0, 246, 2103, 0, 4095, 0, 0, 0, 0, 0, 0, 819, 0, 4095, 0, 0, 0, 2632, 0, 728, 0, 0, 0, 0, 0, 0, 0, 819, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 780, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 819, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 975, 0, 3071, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1365, 1178, 4095, 1023, 1638, 0, 2047, 0, 2978, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 1023, 3918, 2419, 1638, 0, 3480, 168, 0, 2306, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 1204, 2047, 1365, 341, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2586, 0, 0, 0, 0, 0, 4095, 4095, 4095, 0, 4047, 4095, 4095, 4095, 511, 3842, 0, 186, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 819, 2457, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 3471, 2578, 0, 0, 0, 0, 0, 4095, 0, 924, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 3549, 4095, 1638, 819, 4095, 0, 0, 0, 4095, 4095, 0, 0, 4095, 3705, 0, 0, 2505, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 4095, 4095, 3256, 2730, 67, 1633, 4072, 3510, 222, 128, 85, 3964, 0, 0, 0, 78, 4095, 0, 0, 0, 0, 0, 4095, 1228, 4095, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 3071, 0, 4095, 0, 0, 0, 288, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 2047, 4050, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 1365, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 4095, 0, 2047, 4095, 0, 4095, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 3988, 0, 0, 0, 0, 0, 0, 3900, 0, 0, 0, 0, 0, 0, 0, 0, 3097, 0, 0, 0, 0, 0, 0, 4095, 4086, 0, 0, 4095, 3783, 0, 0, 0, 4095, 0, 0, 696, 2818, 0, 4095, 3780, 3266, 292, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 4095, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 4095, 1023, 4095, 0, 4095, 4095, 2340, 4095, 3802, 4095, 4095, 0, 4095, 4095, 0, 0, 4095, 3697, 4095, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 4095, 4095, 0, 0, 4095, 2730, 1137, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 68, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 963, 0, 1618, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 2491, 4095, 2266, 0, 0, 0, 0, 0, 0, 3960, 0, 0, 0, 0, 0, 0, 4095, 0, 682, 0, 0, 4095, 0, 0, 0, 4095, 4095, 4095, 4095, 0, 3542, 585, 4095, 0, 58, 3048, 0, 3749, 1900, 2520, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 97, 0, 0, 4095, 1579, 2437, 0, 0, 682, 0, 0, 0, 0, 0, 4095, 0, 465, 0, 325, 0, 2097, 0, 945, 0, 534, 0, 511, 0, 534, 0, 534, 0, 945, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 17, 0, 2957, 4095, 3276, 4095, 2770, 347, 4095, 0, 4095, 0, 3276, 3893, 0, 0, 4095, 0, 2047, 0, 4095, 4095, 4095, 0, 4095, 4095, 0, 0, 4095, 4095, 4095, 4095, 4095, 1074, 3682, 0, 4095, 0, 2730, 3852, 17, 4048, 2340, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 2476, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 3607, 0, 2047, 0, 819, 0, 4095, 0, 0, 0, 4095, 0, 4095, 0, 4095, 0, 0, 0, 4095, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 4095, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 4095, 2445, 4095, 2544, 819, 0, 3640, 0, 0, 0, 3611, 0, 4095, 0, 0, 4095, 0, 0, 0, 1365, 0, 0, 4095, 0, 4095, 0, 0, 4095, 4095, 4095, 3907, 1664, 3440, 4030, 4095, 351, 723, 48, 3138, 281, 2854, 4095, 0, 0, 0, 0, 0, 1365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2457, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 1116, 0, 0, 2047, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 4095, 63, 45, 2730, 4095, 2295, 51, 0, 84, 3556, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 1981, 4095, 3010, 315, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 2730, 0, 0, 0, 2047, 0, 0, 3556, 4095, 0, 0, 0, 4095, 0, 4095, 4095, 1365, 3683, 0, 3904, 0, 0, 2529, 0, 597, 96, 1755, 4038, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1638, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 3149, 0, 0, 2047, 0, 0, 0, 4011, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 3997, 4095, 0, 0, 3798, 3995, 0, 0, 2730, 0, 0, 0, 4095, 4095, 0, 0, 4095, 0, 0, 4095, 3353, 0, 4095, 0, 4095, 3583, 0, 0, 3112, 3510, 4095, 0, 4095, 2340, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 390, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2925, 0, 0, 0, 426, 0, 0, 0, 1535, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 0, 0, 1525, 0, 1329, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 4095, 1352, 4095, 1081, 296, 0, 2730, 0, 0, 0, 3458, 0, 4095, 0, 0, 0, 2340, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 4095, 1323, 3894, 3579, 3864, 4095, 3785, 971, 0, 2020, 110, 3551, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1508, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 2047, 4095, 0, 0, 0, 0, 0, 0, 1023, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 3514, 0, 0, 0, 3867, 3276, 1575, 0, 3894, 0, 0, 0, 3312, 3276, 1592, 3916, 4028, 0, 0, 1193, 3774, 4095, 3412, 3348, 3919, 1777, 455, 4095, 3921, 3276, 1489, 3815, 2951, 0, 0, 4095, 3827, 2730, 1365, 0, 4095, 0, 0, 0, 3948, 3276, 409, 3685, 4095, 819, 4095, 4095, 4067, 4048, 2780, 2322, 4019, 2866, 2829, 0, 4073, 232, 3194, 4095, 3890, 0, 0, 4095, 4014, 4095, 1365, 0, 4095, 0, 0, 4095, 1842, 2730, 1365, 4075, 3920, 0, 0, 2661, 3599, 0, 0, 0, 4095, 0, 0, 303, 3217, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 3830, 2730, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 3510, 3931, 4095, 0, 0, 0, 0, 0, 423, 2835, 4095, 1930, 4095, 604, 280, 0, 910, 0, 0, 0, 3470, 0, 0, 0, 3510, 1638, 0, 1077, 0, 2047, 0, 0, 2047, 0, 0, 0, 4095, 4095, 4095, 4095, 3136, 3878, 0, 2605, 4095, 218, 3821, 0, 769, 3589, 1852, 3553, 0, 0, 0, 57, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1557, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 2408, 2233, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 1228, 4095, 3510, 4051, 0, 1126, 0, 21, 484, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 77, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 662, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 2537, 0, 0, 0, 0, 0, 4095, 4095, 3139, 3583, 0, 2457, 4095, 0, 4095, 0, 1489, 0, 4095, 0, 0, 0, 4095, 0, 1116, 0, 0, 0, 0, 0, 739, 0, 1663, 0, 4095, 0, 4095, 4095, 2559, 4095, 323, 4095, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32, 0, 0, 0, 0, 0, 0, 4095, 971, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 3890, 0, 0, 0, 0, 0, 259, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 255, 1755, 0, 534, 0, 0, 383, 0, 0, 0, 3465, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 4095, 4095, 0, 4095, 0, 3692, 0, 0, 2370, 0, 2571, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 2340, 4095, 585, 0, 0, 0, 0, 0, 0, 2925, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2728, 4095, 0, 0, 0, 4095, 4095, 4095, 4095, 4095, 4095, 0, 4014, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 3480, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 3552, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 2388, 4095, 0, 0, 0, 0, 0, 0, 4095, 3071, 0, 0, 2520, 4095, 0, 0, 2252, 0, 0, 0, 2986, 0, 0, 0, 0, 4095, 0, 4095, 2730, 2047, 4095, 0, 4095, 0, 2520, 585, 1911, 4095, 0, 4095, 2108, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 945, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 4095, 4095, 3892, 0, 4095, 0, 0, 0, 0, 1365, 3685, 0, 4095, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1575, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3861, 0, 0, 0, 0, 0, 0, 0, 1354, 0, 0, 4095, 2328, 0, 0, 4095, 3809, 0, 0, 4095, 4004, 0, 4095, 0, 4095, 0, 0, 3999, 4047, 0, 0, 4095, 585, 0, 0, 4095, 4095, 0, 0, 4095, 4095, 0, 0, 0, 4095, 0, 0, 4095, 4095, 0, 0, 4007, 4028, 0, 0, 4035, 3908, 0, 0, 4015, 3957, 0, 0, 4095, 4095, 0, 0, 4095, 3976, 0, 0, 0, 4095, 0, 0, 4002, 3918, 0, 0, 4095, 3986, 0, 0, 3949, 3682, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 3949, 3544, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3071, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1126, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 819, 0, 1638, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 4095, 0, 4058, 0, 4095, 0, 4095, 0, 4095, 0, 4012, 0, 4095, 4095, 4095, 0, 3787, 0, 4095, 0, 4095, 0, 4095, 0, 4095, 0, 4095, 0, 4095, 0, 4095, 0, 4095, 0, 845, 0, 4095, 0, 4095, 0, 4095, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2730, 0, 0, 0, 3835, 0, 4095, 0, 3685, 0, 4095, 0, 4095, 0, 4056, 0, 4095, 0, 4095, 0, 4071, 0, 4095, 0, 4095, 0, 4009, 0, 4095, 0, 4067, 0, 4095, 0, 4095, 0, 4095, 0, 3910, 0, 3999, 0, 2780, 0, 1490, 0, 4095, 0, 4095, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2881, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 3985, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 2559, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 3867, 0, 0, 1965, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 0, 0, 3393, 0, 0, 0, 4095, 4095, 0, 0, 1791, 0, 0, 0, 0, 4095, 0, 0, 4002, 1992, 4095, 0, 4095, 2992, 0, 0, 4095, 2900, 0, 0, 4095, 2275, 0, 0, 4095, 2792, 0, 0, 4095, 2649, 0, 0, 4095, 2218, 0, 0, 4095, 2047, 0, 0, 4095, 2502, 0, 0, 4095, 2730, 0, 0, 4095, 0, 0, 0, 631, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2359, 2047, 1801, 4095, 819, 0, 0, 4095, 2340, 0, 0, 4095, 2730, 0, 0, 4095, 2829, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 3854, 0, 0, 0, 0, 0, 0, 0, 0, 910, 0, 0, 0, 0, 0, 0, 0, 16, 0, 1170, 0, 3412, 0, 0, 0, 1638, 0, 0, 0, 4095, 0, 3465, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 3071, 0, 0, 0, 4095, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 3982, 0, 0, 0, 4036, 1365, 195, 4095, 4095, 0, 0, 4095, 4053, 1365, 553, 4095, 4095, 0, 0, 4095, 4062, 1489, 706, 4095, 3833, 0, 0, 4095, 4051, 1365, 160, 0, 0, 0, 0, 0, 4037, 1365, 571, 0, 4095, 0, 0, 0, 4050, 1170, 396, 0, 0, 0, 0, 4095, 4076, 1170, 522, 4095, 0, 0, 0, 0, 4056, 1365, 396, 4095, 4095, 0, 0, 4095, 3982, 1489, 682, 0, 0, 0, 0, 3722, 4084, 1365, 195, 4095, 4095, 0, 0, 4024, 3842, 0, 0, 4095, 4095, 0, 0, 0, 2340, 0, 0, 0, 4095, 0, 0, 4089, 3249, 0, 0, 3992, 1686, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2763, 589, 2149, 406, 1538, 265, 0, 3802, 0, 0, 0, 0, 0, 0, 0, 3839, 455, 0, 341, 0, 0, 0, 0, 3780, 0, 0, 0, 0, 0, 0, 2047, 4095, 1638, 0, 0, 0, 0, 0, 0, 3780, 0, 0, 0, 0, 0, 0, 0, 3071, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3771, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 3510, 0, 0, 0, 0, 0, 0, 0, 255, 0, 0, 3412, 3510, 4095, 0, 0, 2161, 0, 1861, 0, 2792, 0, 2155, 0, 1310, 0, 1228, 0, 1675, 0, 1668, 0, 1462, 0, 1618, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 928, 0, 1023, 4095, 361, 0, 531, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 1535, 4095, 0, 0, 0, 0, 2730, 0, 0, 0, 4095, 1365, 4095, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3839, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 3931, 0, 305, 0, 2669, 0, 3810, 0, 2997, 0, 2161, 0, 2915, 0, 3621, 0, 4095, 0, 4073, 4065, 0, 0, 1357, 0, 3125, 4095, 3231, 0, 3802, 0, 0, 0, 3105, 0, 1950, 4095, 3251, 0, 3684, 0, 3469, 264, 3004, 0, 4095, 0, 2047, 0, 3549, 0, 836, 0, 4095, 4095, 0, 0, 0, 4095, 511, 178, 0, 0, 0, 0, 0, 0, 819, 0, 0, 0, 0, 0, 0, 4095, 0, 651, 0, 0, 0, 0, 0, 4095, 4095, 204, 0, 0, 0, 0, 0, 4023, 0, 301, 0, 0, 0, 0, 0, 4035, 4095, 285, 0, 0, 0, 0, 0, 4095, 0, 359, 0, 0, 0, 0, 0, 4095, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 3931, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 877, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 1478, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 877, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 1090, 2568, 2730, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2388, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 854, 152, 350, 3909, 3397, 2833, 3374, 3640, 1194, 2296, 2768, 3372, 0, 0, 0, 0, 2583, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2167, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1778, 0, 0, 0, 744, 3185, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 3890, 0, 1170, 0, 1356, 1293, 0, 0, 0, 0, 819, 0, 2457, 0, 0, 0, 1575, 0, 1365, 0, 1553, 4095, 1992, 0, 2670, 0, 1939, 0, 2586, 0, 2377, 0, 2047, 0, 2047, 0, 3071, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 2605, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 1450, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 1365, 0, 0, 2379, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 3549, 0, 0, 0, 0, 0, 4095, 0, 2047, 0, 0, 0, 0, 0, 4095, 0, 4058, 1575, 3189, 4095, 704, 3290, 2431, 0, 3558, 2340, 2829, 0, 3809, 2167, 4095, 0, 3827, 2730, 4095, 0, 3863, 2670, 273, 0, 3681, 1516, 0, 0, 3871, 2155, 4095, 0, 2897, 1801, 3276, 0, 3321, 2904, 1137, 0, 3844, 0, 3993, 0, 464, 0, 4038, 0, 3120, 0, 2617, 0, 282, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 0, 3471, 0, 0, 0, 2925, 0, 4095, 4095, 1109, 2957, 1647, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65, 499, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 4095, 4095, 3722, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2978, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4054, 0, 0, 0, 0, 0, 0, 0, 0, 3303, 0, 0, 0, 0, 0, 0, 202, 4095, 0, 0, 4095, 4095, 0, 0, 4095, 4095, 0, 0, 4095, 4095, 0, 0, 4095, 4095, 0, 0, 4095, 3890, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 1023, 2047, 1023, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 1535, 0, 0, 3217, 0, 4095, 0, 0, 0, 4095, 0, 0, 3003, 0, 0, 0, 3722, 4095, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 819, 0, 0, 0, 0, 0, 0, 1814, 35, 2273, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 1440, 0, 1365, 0, 0, 4095, 1602, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 295, 219, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 744, 926, 0, 2047, 0, 0, 4095, 1911, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2871, 0, 900, 0, 0, 3207, 2263, 0, 2730, 0, 4095, 4095, 2486, 2730, 1602, 0, 2827, 0, 1047, 4095, 4095, 4095, 2495, 0, 0, 0, 0, 0, 511, 0, 1365, 0, 1575, 0, 1602, 0, 2047, 3685, 1291, 0, 1876, 0, 1668, 4095, 2403, 0, 2149, 0, 1706, 0, 2541, 0, 0, 0, 372, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2457, 2691, 0, 1023, 0, 0, 3412, 2388, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 3075, 156, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 2320, 0, 0, 0, 0, 4095, 2632, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 3071, 0, 3414, 4095, 1971, 4095, 2315, 830, 1565, 0, 2489, 4095, 2574, 0, 4095, 0, 3769, 0, 4095, 0, 0, 0, 1927, 0, 4095, 0, 4054, 0, 4095, 0, 4062, 0, 3492, 0, 1791, 0, 4095, 4095, 1055, 0, 2995, 0, 3752, 4095, 1890, 0, 2890, 0, 0, 0, 4095, 0, 1638, 0, 971, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 955, 4095, 0, 4095, 2437, 0, 3071, 0, 0, 4095, 3003, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 862, 0, 2047, 0, 0, 4095, 1077, 0, 4095, 0, 0, 0, 2457, 4095, 0, 4095, 356, 819, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 1820, 4095, 0, 4095, 1407, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1056, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1638, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 511, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 0, 0, 4095, 0, 1425, 0, 0, 4095, 3276, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 390, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1638, 3549, 3305, 2184, 388, 1950, 2992, 372, 2520, 2766, 2320, 2467, 2833, 1086, 1820, 2047, 2238, 1952, 167, 2367, 3345, 1459, 2340, 199, 0, 0, 0, 0, 2047, 4095, 2047, 0, 2855, 3240, 2457, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2893, 0, 1365, 0, 0, 4095, 2457, 0, 1638, 1638, 1365, 2866, 0, 0, 0, 0, 2981, 0, 895, 0, 0, 0, 0, 0, 0, 4095, 215, 0, 981, 0, 4095, 0, 1613, 0, 2457, 0, 1478, 4095, 2047, 0, 1732, 1365, 2175, 4095, 2641, 0, 1592, 0, 2047, 0, 1478, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 3818, 0, 0, 655, 1204, 2047, 0, 2047, 3209, 0, 1342, 4095, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 2520, 4095, 0, 0, 3613, 3502, 0, 0, 3085, 1638, 2730, 0, 112, 2873, 2047, 4095, 4095, 0, 4095, 0, 3677, 0, 0, 0, 4095, 4095, 3510, 0, 2278, 4095, 0, 0, 0, 3412, 4095, 0, 4095, 2003, 3341, 0, 3153, 2632, 1697, 0, 3203, 3017, 3047, 4095, 3230, 2303, 0, 0, 4095, 2492, 4036, 0, 4095, 3150, 2730, 0, 4053, 2457, 4095, 0, 3693, 2801, 3674, 0, 4095, 1872, 4095, 0, 3757, 2145, 504, 0, 3941, 2047, 1513, 4095, 1002, 0, 0, 0, 315, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 945, 431, 1263, 4095, 0, 0, 0, 4095, 2047, 0, 0, 4095, 0, 0, 0, 4095, 511, 0, 0, 4095, 0, 0, 0, 4095, 3071, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3780, 4046, 885, 105, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 910, 0, 0, 0, 0, 0, 0, 0, 120, 0, 1251, 0, 0, 0, 0, 0, 2925, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 819, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 2520, 0, 0, 0, 409, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 3436, 0, 0, 0, 3767, 2340, 945, 3510, 3985, 0, 0, 2161, 4082, 3685, 2940, 4095, 3914, 0, 0, 3987, 3978, 3276, 1170, 3987, 4062, 0, 0, 4095, 4028, 4095, 945, 4095, 2628, 0, 0, 0, 3984, 4095, 744, 4095, 4095, 0, 0, 0, 3839, 2835, 341, 3372, 3276, 0, 0, 4095, 3890, 2730, 877, 4095, 3448, 0, 0, 4088, 3937, 2730, 1820, 4095, 4042, 0, 0, 4095, 3900, 3412, 2047, 0, 0, 0, 0, 2189, 3676, 1260, 183, 4006, 3974, 4095, 0, 4057, 1778, 0, 0, 4095, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 3852, 1146, 0, 0, 0, 3815, 897, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 4033, 3958, 460, 0, 0, 0, 0, 0, 0, 819, 0, 3412, 117, 3071, 0, 4095, 4007, 1881, 0, 1170, 2578, 2824, 0, 0, 0, 3276, 0, 0, 0, 0, 0, 0, 0, 3071, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3286, 0, 3835, 0, 0, 2457, 0, 0, 438, 2730, 0, 2890, 0, 0, 3710, 0, 3216, 0, 16, 0, 0, 0, 0, 0, 192, 0, 310, 2730, 445, 4095, 4095, 0, 2649, 0, 2047, 0, 1861, 0, 1404, 0, 2641, 0, 1170, 4095, 2559, 4095, 1613, 0, 1989, 0, 2366, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4041, 0, 2730, 1116, 744, 0, 197, 1686, 2388, 3767, 4095, 0, 0, 0, 4095, 0, 3685, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 1328, 0, 0, 0, 0, 0, 0, 0, 4051, 0, 0, 0, 3951, 0, 2805, 4095, 3622, 0, 820, 2047, 2346, 3185, 1938, 0, 4065, 0, 4095, 0, 4095, 0, 4095, 0, 0, 0, 2667, 0, 3440, 819, 2602, 3071, 4095, 0, 3621, 0, 3753, 0, 1753, 0, 2269, 0, 3374, 268, 159, 0, 2730, 2047, 2083, 0, 3923, 0, 2083, 0, 409, 0, 0, 0, 0, 4095, 1365, 1417, 0, 0, 0, 0, 0, 0, 3320, 0, 0, 0, 0, 0, 0, 4095, 0, 1927, 0, 0, 0, 0, 0, 4095, 0, 1433, 0, 0, 0, 0, 0, 4095, 0, 945, 0, 0, 0, 0, 0, 3685, 0, 744, 0, 4095, 0, 0, 0, 4095, 0, 1820, 0, 0, 0, 0, 0, 4095, 0, 910, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 1755, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 0, 0, 0, 4095, 0, 0, 0, 0, 4095, 1706, 0, 0, 0, 0, 0, 0, 0, 1023, 0, 0, 0, 0, 0, 0, 4095, 824, 0, 0, 0, 0, 423, 3822, 0, 3276, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 2730, 1365, 0, 1976, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 3412, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1170, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 11, 2520, 0, 4095, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1755, 1365, 1365, 3071, 2559, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2062, 2259, 3488, 963, 1982, 2167, 2220, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 1445, 2661, 0, 0, 2925, 0, 0, 0, 175, 0, 0, 0, 1228, 1445, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 996, 0, 2761, 4095, 0, 4095, 1829, 3767, 2167, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1351, 0, 0, 0, 0, 0, 1939, 0, 292, 4095, 0, 4057, 1780, 2165, 2221, 0, 2922, 0, 0, 0, 0, 0, 0, 0, 209, 2047, 33, 0, 3412, 0, 0, 0, 1498, 0, 1170, 0, 2370, 315, 1876, 0, 890, 0, 1694, 4095, 2400, 1139, 1870, 0, 1933, 0, 2314, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 3756, 4095, 0, 52, 1975, 1638, 0, 1347, 4095, 0, 3915, 3071, 1663, 521, 0, 4095, 1365, 4095, 0, 0, 4095, 4095, 2471, 2502, 1023, 0, 0, 4095, 0, 0, 0, 3556, 2618, 0, 0, 1322, 1708, 1260, 163, 3071, 0, 4095, 4095, 3416, 4080, 771, 0, 3677, 0, 0, 0, 4095, 0, 2866, 0, 1780, 4095, 0, 0, 4095, 4095, 4095, 0, 4095, 1876, 3022, 0, 2765, 1650, 2377, 0, 3032, 1208, 3929, 2978, 3780, 3380, 1098, 0, 4095, 2419, 4095, 0, 4095, 2275, 0, 0, 4014, 1861, 3978, 0, 4095, 1797, 3638, 0, 2957, 1042, 0, 0, 2331, 1557, 756, 0, 3221, 0, 2225, 4095, 2580, 3412, 1585, 0, 0, 0, 1023, 0, 2275, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1023, 2047, 0, 4095, 4095, 1755, 0, 1755, 1933, 2275, 273, 0, 3753, 1023, 0, 0, 4095, 0, 0, 0, 2866, 1592, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3357, 4095, 1015, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 1791, 3659, 767, 0, 4095, 2047, 0, 0, 0, 0, 0, 0, 3722, 1575, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 3465, 0, 0, 4095, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 2720, 0, 0, 0, 0, 0, 0, 3722, 4001, 0, 0, 3890, 3987, 0, 3698, 1288, 2207, 2810, 0, 4031, 3439, 0, 0, 3287, 3645, 0, 0, 3412, 3773, 0, 0, 4025, 488, 0, 0, 3758, 3422, 0, 0, 0, 4089, 0, 0, 0, 0, 0, 4095, 2877, 3543, 3583, 0, 0, 4095, 0, 0, 4095, 4095, 0, 0, 4095, 4095, 0, 0, 4095, 3914, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 2795, 3438, 3020, 0, 3908, 3378, 0, 0, 4095, 4095, 0, 0, 2047, 862, 0, 0, 4095, 3276, 0, 0, 0, 0, 0, 0, 71, 1839, 0, 0, 0, 0, 0, 4095, 3680, 1062, 1467, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2388, 0, 0, 2730, 4095, 0, 0, 1568, 3106, 1686, 0, 4095, 0, 3780, 0, 1116, 0, 0, 0, 2835, 744, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3136, 0, 0, 0, 0, 476, 0, 0, 0, 4095, 0, 3914, 3872, 3613, 0, 0, 2759, 0, 1638, 0, 0, 0, 0, 0, 1043, 1228, 4095, 0, 273, 0, 3412, 0, 0, 0, 0, 0, 27, 2699, 0, 0, 4095, 0, 0, 4095, 2963, 425, 3994, 0, 0, 0, 0, 0, 1638, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3439, 0, 11, 793, 282, 0, 787, 3802, 0, 4095, 3391, 1828, 1348, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4001, 4095, 0, 0, 0, 0, 0, 3071, 4095, 372, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 3996, 0, 3685, 2047, 4095, 0, 585, 0, 2811, 4095, 1365, 3583, 4095, 0, 3470, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 1924, 0, 2851, 0, 3465, 0, 0, 0, 4095, 0, 36, 0, 4095, 0, 4095, 4095, 3382, 31, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3276, 0, 0, 0, 0, 0, 4095, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 292, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 214, 4095, 0, 0, 2826, 3524, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1901, 0, 0, 0, 0, 0, 0, 0, 0, 1638, 0, 1023, 2047, 2457, 0, 0, 950, 920, 57, 77, 2796, 2265, 0, 0, 85, 0, 511, 0, 2370, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4042, 0, 0, 0, 0, 0, 0, 3827, 0, 0, 0, 4095, 4095, 0, 0, 4095, 277, 315, 1023, 0, 69, 0, 4095, 0, 0, 0, 4095, 3640, 3822, 0, 0, 4040, 3981, 126, 0, 2655, 3276, 0, 3675, 0, 0, 0, 0, 4095, 0, 0, 0, 3294, 0, 0, 0, 4095, 4095, 1535, 0, 2239, 4095, 2340, 0, 0, 4095, 4095, 0, 4095, 2426, 4080, 0, 4095, 2388, 4095, 0, 3943, 2605, 1704, 0, 3904, 1911, 3560, 0, 2437, 2677, 3610, 2632, 4095, 1965, 4095, 4095, 2965, 2388, 472, 4095, 4095, 2252, 3937, 0, 4095, 2881, 0, 0, 2225, 2303, 4095, 0, 2218, 0, 4095, 0, 877, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 630, 945, 3399, 4095, 1365, 0, 0, 4095, 2047, 0, 0, 3583, 3583, 0, 0, 799, 462, 186, 4095, 4095, 585, 0, 4095, 4095, 1365, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 722, 0, 0, 0, 0, 0, 0, 0, 1755, 4095, 2218, 0, 0, 0, 0, 0, 4095, 0, 0, 2047, 2730, 3987, 0, 240, 75, 0, 2801, 3898, 2325, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 2023, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 3071, 0, 3613, 0, 0, 0, 0, 4095, 0, 4095, 3879, 0, 0, 2502, 4095, 0, 1023, 3913, 3932, 0, 0, 2815, 2632, 0, 2781, 4068, 3603, 0, 4095, 4095, 3677, 0, 0, 4095, 0, 0, 0, 4003, 3964, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 3650, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 3986, 3649, 0, 0, 3934, 3627, 0, 0, 0, 0, 0, 0, 4095, 3999, 0, 0, 4025, 2120, 4095, 0, 0, 4030, 0, 4095, 4095, 3914, 0, 4095, 4095, 3237, 0, 0, 4095, 4095, 0, 0, 4095, 3867, 0, 0, 3822, 3824, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1067, 2667, 3166, 159, 1602, 274, 0, 3787, 1998, 2730, 0, 0, 4095, 0, 0, 0, 0, 819, 1365, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2792, 4095, 0, 0, 0, 0, 0, 0, 3510, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 301, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3613, 3412, 0, 4040, 1849, 0, 3026, 0, 0, 0, 1535, 4095, 4095, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2293, 4095, 3185, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1365, 0, 0, 0, 767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 2242, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3276, 0, 0, 0, 0, 0, 0, 0, 372, 0, 0, 0, 4095, 0, 4095, 0, 2094, 0, 3822, 0, 2041, 0, 1214, 0, 2617, 1365, 736, 0, 3971, 0, 431, 2145, 3524, 4095, 1755, 1365, 3053, 2824, 3905, 0, 3671, 0, 3368, 0, 3960, 0, 1794, 0, 1023, 0, 2832, 0, 2494, 0, 3017, 4095, 0, 0, 4095, 0, 0, 0, 924, 0, 0, 0, 4080, 0, 1365, 0, 0, 0, 1327, 2690, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 630, 0, 0, 4095, 0, 0, 0, 1916, 3632, 0, 2605, 2340, 4095, 0, 0, 0, 1023, 0, 0, 0, 0, 0, 0, 4095, 1638, 0, 0, 0, 0, 0, 479, 4095, 902, 0, 0, 0, 0, 0, 0, 4095, 3185, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1023, 0, 0, 0, 0, 591, 0, 0, 3931, 481, 0, 4095, 4095, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 1535, 4095, 0, 0, 0, 0, 0, 0, 0, 2047, 4095, 0, 4095, 0, 2457, 1039, 0, 3693, 4095, 0, 0, 4095, 0, 0, 0, 1023, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 585, 0, 0, 0, 0, 4095, 4095, 89, 2948, 2419, 112, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 765, 154, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1535, 1387, 1456, 0, 4095, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 1638, 0, 3946, 4095, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 3583, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1638, 0, 2925, 4095, 1820, 1680, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 3217, 4095, 0, 0, 0, 0, 0, 712, 4095, 0, 0, 0, 0, 4095, 0, 1535, 0, 2730, 3131, 3767, 1890, 0, 3987, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 3071, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3080, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 0, 4095, 2388, 4095, 0, 4095, 2541, 4095, 0, 3199, 2730, 744, 0, 4095, 2303, 0, 0, 2129, 790, 0, 2835, 2644, 1352, 0, 4095, 4095, 1774, 0, 0, 4095, 2649, 4095, 0, 4095, 3071, 4095, 4095, 4095, 2866, 4095, 0, 3412, 0, 4095, 0, 1170, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 233, 0, 4095, 0, 0, 0, 68, 0, 0, 409, 4095, 0, 4095, 0, 472, 0, 496, 1535, 4095, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3071, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 105, 3378, 3530, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 4030, 0, 0, 4095, 4095, 0, 0, 4095, 3990, 0, 0, 2730, 2208, 1474, 4095, 4095, 3663, 0, 0, 4088, 3066, 0, 0, 4095, 4095, 0, 0, 0, 4095, 0, 0, 489, 3617, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 3858, 4095, 0, 3986, 3859, 1890, 4095, 4095, 4085, 0, 0, 0, 4095, 0, 0, 3796, 3135, 4095, 0, 0, 4095, 4095, 0, 2730, 4035, 0, 0, 3861, 4040, 4095, 0, 3472, 3188, 1438, 4095, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1164, 837, 940, 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 0, 0, 1023, 0, 0, 0, 3080, 1434, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2233, 0, 0, 4095, 585, 1890, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3276, 0, 2155, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2559, 0, 2209, 4016, 292, 4095, 3733, 0, 0, 0, 4095, 0, 3549, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3071, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 2925, 1638, 0, 0, 3558, 390, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 3822, 0, 0, 4095, 3536, 0, 0, 0, 3164, 0, 2682, 0, 0, 0, 0, 0, 3927, 0, 0, 0, 356, 2559, 4095, 0, 1820, 0, 1638, 0, 4095, 0, 0, 0, 2388, 4095, 0, 0, 1638, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 335, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2812, 4095, 0, 4095, 3247, 0, 4095, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2408, 4095, 0, 0, 67, 819, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2559, 4095, 0, 4095, 1023, 0, 225, 0, 0, 2925, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 3822, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 2730, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 682, 0, 0, 0, 0, 0, 1625, 1638, 358, 2297, 3011, 872, 2605, 0, 3175, 2259, 504, 2093, 3257, 1531, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3276, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3276, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2010, 0, 0, 0, 0, 0, 0, 0, 0, 409, 0, 4095, 2808, 2047, 292, 0, 82, 0, 0, 4045, 0, 0, 0, 4095, 1118, 1204, 20, 1382, 3836, 1485, 0, 0, 0, 0, 0, 0, 585, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 215, 4095, 0, 910, 1592, 1842, 767, 0, 0, 0, 0, 0, 0, 0, 0, 3962, 1260, 952, 255, 1386, 2578, 0, 0, 0, 4095, 4095, 0, 0, 2815, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3603, 0, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 0, 4095, 2047, 4095, 0, 4095, 2815, 4095, 0, 4095, 2900, 4095, 0, 2312, 3125, 2690, 0, 2665, 2213, 2457, 0, 4095, 2492, 4089, 0, 4095, 2370, 0, 4095, 2241, 1820, 2309, 2362, 3927, 134, 4095, 0, 2080, 2303, 0, 0, 4095, 2925, 3813, 0, 2373, 0, 4058, 0, 955, 0, 3583, 0, 0, 0, 847, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 178, 1755, 784, 4095, 0, 0, 0, 1842, 2835, 0, 1204, 2632, 1365, 341, 0, 4095, 0, 0, 4095, 4095, 0, 0, 3276, 1270, 16, 165, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4026, 1890, 0, 0, 0, 0, 14, 4095, 0, 1897, 2047, 3120, 2218, 4095, 0, 4095, 0, 0, 0, 0, 4095, 4095, 2792, 249, 315, 3116, 3207, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 3459, 0, 0, 0, 0, 4095, 4095, 4095, 3973, 0, 0, 577, 4095, 1626, 0, 3022, 3327, 0, 0, 4095, 4095, 4095, 0, 3979, 2978, 0, 4065, 3428, 2671, 306, 2902, 3936, 83, 0, 0, 0, 4095, 4095, 0, 4095, 4095, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 4095, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 361, 4095, 416, 1023, 4095, 4095, 4095, 0, 0, 4095, 0, 0, 4036, 0, 0, 4095, 2925, 574, 0, 1023, 4019, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 64, 4095, 0, 1489, 4095, 0, 4095, 2730, 0, 0, 2730, 0, 0, 0, 0, 4083, 20, 300, 169, 3420, 4095, 66, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1697, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 4095, 0, 0, 0, 3583, 0, 0, 0, 0, 0, 0, 3013, 918, 2665, 264, 3902, 1942, 631, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 3822, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4042, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4043, 0, 3653, 0, 4095, 0, 1833, 4095, 1706, 511, 4095, 0, 2866, 0, 0, 0, 3978, 0, 0, 0, 0, 4095, 2399, 431, 3150, 1638, 2340, 0, 4055, 0, 2557, 0, 4095, 0, 4095, 0, 3549, 0, 292, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 1170, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 102, 4095, 0, 481, 4095, 0, 4095, 4095, 0, 0, 0, 1638, 0, 0, 0, 472, 0, 0, 0, 3648, 2047, 420, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 63, 2047, 3295, 1861, 0, 0, 0, 4095, 0, 0, 4095, 4095, 4095, 0, 4095, 4095, 423, 407, 0, 991, 1023, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 56, 4095, 0, 412, 4095, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 3500, 267, 1448, 0, 1927, 3627, 785, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 2047, 0, 0, 0, 0, 122, 4095, 0, 1638, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 2580, 3276, 1988, 1728, 47, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 501, 4095, 511, 99, 0, 0, 4095, 0, 4095, 0, 4095, 0, 307, 0, 0, 4095, 15, 145, 0, 2230, 4095, 15, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3722, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3021, 0, 0, 0, 204, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 2925, 0, 1526, 0, 0, 0, 0, 0, 0, 4095, 0, 3071, 177, 0, 847, 0, 3510, 0, 0, 0, 0, 0, 4095, 0, 511, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 4095, 4095, 0, 0, 0, 0, 0, 108, 4095, 273, 3402, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 3722, 52, 390, 3425, 3953, 329, 0, 0, 2730, 2047, 0, 0, 3017, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 3981, 0, 0, 0, 4095, 4095, 0, 0, 2457, 4095, 0, 0, 0, 0, 4078, 0, 3879, 2957, 4095, 0, 4095, 3204, 3573, 0, 2378, 3307, 3221, 2553, 3991, 2815, 1536, 0, 4095, 2925, 4095, 0, 4095, 2730, 2457, 4095, 3086, 594, 299, 3315, 3893, 366, 3136, 0, 3896, 2835, 4095, 0, 2314, 3185, 1978, 0, 1173, 0, 4095, 0, 2730, 0, 4038, 0, 0, 0, 1504, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3232, 0, 4095, 3071, 0, 0, 66, 2605, 47, 2298, 4095, 0, 4095, 0, 4095, 0, 0, 4095, 4095, 0, 4095, 4066, 203, 0, 54, 3654, 3863, 2247, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 0, 0, 4095, 1535, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 2916, 3412, 0, 2810, 3375, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 4095, 3298, 0, 0, 4095, 4095, 0, 0, 4095, 4095, 0, 0, 4031, 4095, 4095, 0, 429, 988, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 0, 0, 3899, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 3510, 4095, 0, 0, 4095, 3984, 0, 0, 4095, 4095, 4095, 0, 0, 0, 0, 0, 120, 4095, 0, 2303, 4032, 4095, 4095, 0, 0, 4095, 0, 0, 4095, 4095, 0, 4095, 796, 2948, 0, 4095, 4019, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 910, 4095, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3433, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 585, 0, 2529, 0, 0, 0, 0, 0, 0, 0, 273, 0, 0, 3510, 2145, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 2804, 0, 3778, 0, 3734, 4095, 4095, 0, 1322, 0, 2457, 0, 2047, 0, 4061, 0, 0, 0, 2978, 0, 2710, 0, 3174, 0, 2630, 0, 3292, 0, 3920, 0, 0, 0, 1954, 0, 3211, 0, 2002, 0, 4088, 0, 4095, 0, 1649, 0, 455, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1092, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1141, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2377, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 3767, 4095, 0, 4095, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 3583, 0, 0, 0, 4095, 3185, 53, 0, 3232, 0, 4095, 2730, 0, 0, 0, 0, 4095, 0, 0, 0, 3388, 0, 0, 0, 0, 4095, 2340, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 4095, 2605, 4095, 0, 4095, 3092, 3412, 0, 4095, 2968, 3084, 0, 4041, 3315, 0, 0, 4095, 3201, 4095, 0, 4095, 2821, 0, 0, 4057, 3155, 0, 0, 4095, 2952, 4025, 0, 4012, 3136, 0, 0, 3978, 3185, 2340, 0, 2722, 0, 4095, 0, 1592, 0, 4095, 0, 0, 0, 1881, 0, 2520, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1413, 2328, 731, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 3854, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 819, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1260, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 744, 877, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 3924, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 4095, 3995, 0, 0, 4095, 4095, 0, 0, 4095, 4095, 0, 0, 4095, 4095, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 2047, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 3981, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 837, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 1194, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2887, 2821, 2446, 157, 1052, 141, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 3471, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 1766, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 630, 0, 0, 4095, 487, 195, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 1915, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 4095, 4095, 0, 819, 2047, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 2047, 4095, 0, 4095, 3071, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1023, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 1365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 390, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2212, 623, 1170, 3467, 2197, 3071, 2233, 2535, 1356, 2355, 2455, 2940, 0, 0, 2047, 0, 1939, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2730, 4095, 0, 0, 3026, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2310, 0, 1365, 4095, 2077, 3217, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2894, 0, 409, 4095, 2502, 571, 0, 0, 0, 0, 963, 0, 1215, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 1170, 0, 431, 2730, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 3946, 0, 0, 3276, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 3071, 2265, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 4095, 3671, 0, 0, 3295, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3237, 0, 4095, 0, 4095, 0, 2233, 0, 2233, 4095, 0, 0, 0, 4095, 4095, 0, 4095, 2661, 3952, 4095, 4081, 3164, 3164, 0, 2801, 3017, 3688, 0, 4095, 3131, 2471, 0, 4095, 3003, 4095, 0, 4095, 2457, 2437, 0, 3873, 2866, 2829, 0, 643, 2457, 3968, 0, 3583, 2730, 4095, 0, 3588, 3942, 2967, 0, 2443, 0, 4057, 0, 2912, 0, 4095, 0, 4095, 0, 1835, 4095, 3744, 614, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 638, 0, 0, 0, 4095, 2457, 4095, 4095, 1209, 2457, 1023, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2559, 0, 91, 699, 0, 0, 0, 0, 0, 0, 481, 4095, 3412, 0, 4095, 0, 2457, 4095, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 2252, 1023, 109, 2843, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3071, 0, 455, 0, 0, 0, 0, 0, 0, 0, 0, 3071, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 4063, 0, 0, 0, 0, 0, 0, 112, 4095, 0, 0, 4095, 4095, 0, 0, 4095, 4095, 0, 0, 4095, 4095, 819, 0, 4095, 4095, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 1365, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 4095, 3510, 0, 0, 0, 4095, 0, 0, 0, 3271, 0, 0, 971, 4095, 0, 4095, 0, 4095, 0, 0, 3276, 3822, 0, 0, 0, 4095, 1901, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 93, 0, 0, 4095, 0, 0, 0, 0, 4095, 2047, 3583, 0, 0, 0, 3276, 0, 2107, 380, 841, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 2632, 0, 4095, 0, 0, 4095, 2559, 0, 4095, 0, 0, 0, 0, 0, 285, 0, 3936, 63, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 1404, 0, 0, 0, 0, 4095, 1706, 0, 4095, 0, 4095, 0, 3549, 4095, 0, 4095, 3340, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2899, 0, 753, 4095, 303, 3783, 3615, 0, 0, 0, 4095, 4095, 2978, 0, 219, 0, 3098, 0, 844, 1489, 0, 4095, 2585, 1912, 0, 0, 0, 0, 1443, 0, 2340, 0, 0, 0, 327, 0, 455, 3071, 3905, 0, 4095, 0, 0, 4095, 2925, 0, 4095, 0, 4095, 0, 1133, 4095, 0, 4043, 93, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 409, 4095, 4095, 4095, 3098, 0, 2047, 0, 0, 4095, 3150, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 3577, 700, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 3618, 0, 4095, 0, 0, 4095, 3185, 0, 4095, 0, 4095, 0, 2730, 0, 0, 0, 1298, 0, 3071, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4055, 0, 3622, 4095, 3717, 3833, 1221, 0, 1665, 4095, 3887, 0, 2114, 0, 2691, 0, 4095, 0, 0, 4095, 3086, 0, 4095, 0, 877, 0, 2526, 0, 3542, 0, 3657, 0, 0, 0, 3583, 4095, 980, 0, 3206, 0, 4095, 4095, 1861, 0, 3848, 0, 0, 0, 1283, 4095, 0, 4095, 725, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3276, 0, 4095, 4095, 1320, 0, 0, 0, 0, 4095, 1365, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2589, 3071, 4095, 4095, 682, 0, 4095, 0, 0, 4095, 2047, 0, 4095, 0, 4095, 0, 1397, 4095, 0, 3583, 2290, 23, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 1049, 2468, 1157, 4095, 1520, 1604, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3579, 146, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 4060, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 409, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2730, 0, 1077, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3276, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2730, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 507, 0, 2185, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1023, 4095, 2457, 0, 792, 3693, 1927, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2940, 0, 0, 0, 0, 4095, 2047, 0, 3886, 1560, 4095, 3185, 0, 0, 2670, 0, 395, 0, 859, 4095, 0, 0, 0, 0, 0, 0, 101, 0, 1183, 0, 4095, 0, 0, 0, 0, 0, 0, 1023, 0, 0, 1188, 1662, 1706, 4095, 0, 1365, 0, 0, 0, 0, 0, 0, 292, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 3179, 4095, 0, 4095, 682, 2730, 0, 2565, 1081, 4095, 0, 4095, 0, 0, 0, 4095, 0, 4095, 0, 4095, 0, 0, 0, 4095, 0, 4095, 0, 3640, 0, 0, 0, 4095, 4095, 0, 0, 4095, 4095, 0, 0, 2730, 4095, 1583, 819, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3127, 0, 4095, 4095, 0, 0, 4095, 3276, 4095, 0, 0, 0, 3982, 0, 3543, 4095, 3498, 0, 3767, 2392, 3112, 4095, 2228, 0, 1023, 0, 3368, 0, 4082, 0, 0, 0, 0, 0, 3950, 0, 4095, 0, 4095, 0, 1932, 0, 1666, 0, 0, 0, 3356, 0, 1365, 0, 4095, 1116, 4057, 4095, 2840, 0, 3302, 0, 2835, 0, 2984, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2084, 794, 1403, 0, 0, 0, 0, 863, 3640, 4095, 0, 0, 0, 0, 0, 0, 409, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2559, 4095, 1394, 1638, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3412, 2205, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 585, 0, 0, 1068, 0, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 1421, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 3549, 0, 0, 1544, 2674, 4095, 2457, 4095, 4095, 0, 0, 4095, 4095, 0, 0, 4058, 1438, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 2233, 0, 0, 0, 4095, 0, 0, 969, 3412, 0, 2730, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 390, 0, 0, 3810, 3931, 1151, 3890, 0, 4095, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 4095, 158, 3058, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1535, 4095, 3071, 0, 0, 0, 0, 0, 0, 0, 279, 0, 819, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 400, 0, 0, 0, 327, 1791, 0, 0, 3775, 2275, 3412, 3879, 0, 0, 0, 0, 0, 0, 1365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2514, 921, 3276, 780, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 240, 0, 0, 2559, 1564, 0, 3640, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 1963, 3393, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4017, 0, 4014, 0, 3748, 0, 3805, 0, 1184, 0, 1899, 0, 2677, 0, 4095, 0, 3699, 0, 0, 0, 0, 0, 3782, 1755, 1395, 2340, 4085, 0, 4095, 0, 1977, 0, 4095, 0, 4079, 0, 3326, 0, 2110, 446, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 409, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1638, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 4095, 0, 4095, 2730, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4073, 0, 0, 0, 1592, 1742, 2943, 0, 849, 3102, 1788, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2752, 1365, 511, 0, 1817, 4095, 0, 4095, 3260, 2261, 1350, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 819, 2730, 1890, 0, 0, 0, 0, 4095, 2423, 2685, 3989, 0, 1365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 3276, 0, 0, 0, 0, 0, 1240, 195, 1260, 0, 0, 0, 0, 4095, 356, 2390, 3719, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 3564, 0, 0, 2520, 4095, 2388, 0, 0, 4095, 0, 4095, 3783, 280, 2457, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 237, 2457, 2233, 0, 4095, 0, 0, 3873, 3412, 3640, 2331, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 2047, 4095, 0, 553, 0, 3106, 0, 0, 0, 2359, 4095, 4020, 1990, 937, 0, 0, 0, 3941, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 1092, 132, 3753, 0, 4095, 0, 0, 4095, 3705, 4095, 1306, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1791, 4095, 0, 0, 0, 0, 0, 0, 3355, 1237, 3997, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 3954, 4076, 1545, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 3071, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2730, 0, 0, 0, 0, 0, 0, 0, 4095, 2340, 819, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 380, 1831, 0, 204, 0, 0, 0, 4095, 2951, 2505, 3510, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 319, 3583, 0, 4095, 0, 0, 0, 3873, 1893, 4073, 62, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 539, 2287, 0, 383, 4095, 0, 0, 4095, 3369, 4075, 1492, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 525, 4095, 0, 0, 0, 0, 0, 4095, 4095, 3483, 1431, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 585, 3672, 0, 0, 4095, 0, 0, 4095, 1469, 3767, 3186, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2840, 0, 0, 0, 39, 2511, 0, 0, 0, 4095, 0, 4095, 3480, 2485, 3293, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2730, 0, 585, 0, 0, 0, 0, 0, 0, 0, 161, 1755, 0, 0, 0, 0, 0, 4095, 3278, 949, 3686, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 99, 409, 0, 0, 0, 0, 0, 4095, 1355, 1414, 2403, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 287, 3669, 0, 0, 0, 0, 0, 4095, 1950, 3202, 1602, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 4095, 2047, 0, 0, 0, 0, 1272, 0, 2435, 0, 1706, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 511, 0, 3695, 0, 397, 0, 4095, 0, 2235, 3318, 808, 0, 2047, 0, 0, 4095, 3139, 230, 326, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1890, 1365, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2730, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 893, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2835, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 1222, 0, 1598, 0, 1279, 0, 2047, 0, 1825, 0, 1121, 0, 1378, 0, 1557, 0, 1400, 0, 1710, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 3285, 1535, 0, 1535, 0, 1535, 0, 1535, 0, 1535, 0, 2481, 0, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 21, 0, 0, 0, 2047, 2978, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1602, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 1826, 0, 1907, 0, 2588, 0, 1430, 0, 2047, 0, 1625, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 2118, 0, 0, 0, 4095, 0, 4095, 0, 3685, 0, 0, 0, 0, 0, 0, 0, 775, 0, 0, 0, 0, 0, 4095, 0, 3916, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3798, 2340, 1965, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 630, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3993, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1184, 2162, 2224, 1622, 1320, 297, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1535, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3390, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2012, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 120, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4032, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 118, 0, 0, 0, 682, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 2155, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 13, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 315, 0, 4095, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 0, 0, 0, 0, 4095, 0, 4095, 0, 3822, 0, 4095, 0, 4095, 0, 2047, 4095, 4095, 0, 2293, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 1365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3026, 0, 0, 0, 0, 0, 0, 4095, 3003, 0, 0, 0, 0, 0, 0, 0, 315, 0, 0, 0, 0, 0, 0, 4017, 910, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 124, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 1535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 2661, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3185, 0, 0, 0, 0, 0, 0, 0, 2340, 0, 0, 0, 0, 4095, 0, 0, 1872, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3043, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1131, 299, 0, 0, 1177, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 3241, 315, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 1706, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3510, 0, 0, 0, 4095, 332, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 511, 0, 2445, 273, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 3916, 250, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 2227, 0, 0, 476, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3251, 1023, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 1023, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 2925, 0, 2605, 4095, 1616, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 3780, 4095, 1409, 3412, 0, 0, 0, 0, 2445, 0, 4095, 0, 0, 0, 4095, 0, 2730, 0, 853, 1116, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 2670, 3685, 1658, 1474, 4095, 0, 4095, 0, 227, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4082, 0, 4095, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 819, 620, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 1985, 4095, 1207, 3112, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 2481, 884, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 745, 4095, 1960, 3685, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3873, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 939, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 3276, 4095, 2673, 1365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1170, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 372, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 3071, 0, 1873, 372, 1731, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 1114, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1116, 4095, 0, 4095, 2875, 364, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2999, 2978, 0, 4095, 2955, 195, 0, 0, 0, 0, 0, 0, 0, 0, 3071, 0, 2649, 0, 4095, 4095, 1304, 1365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 2706, 1447, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 1047, 0, 0, 4095, 2742, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3022, 0, 0, 4095, 99, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1413, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 2056, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2730, 0, 0, 0, 735, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 2020, 3900, 0, 4095, 1702, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 488, 4095, 0, 3787, 2091, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 1474, 3753, 0, 4095, 934, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2730, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 682, 4095, 0, 4095, 371, 549, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 839, 4095, 4095, 4095, 1224, 2094, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3375, 4095, 0, 4095, 1334, 96, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 501, 4095, 0, 4095, 2238, 1648, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 257, 0, 0, 4095, 3863, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 430, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 1462, 4095, 0, 4095, 3062, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1890, 4095, 0, 0, 2457, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3150, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2730, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 3583, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 4095, 0, 0, 0, 4095, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 2047, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 4095, 0, 0, 0, 298, 0, 0, 0, 0, 0, 0, 0, 0, 1549, 1585, 1246, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 116, 0, 0, 0, 4095, 0, 0, 0, 594, 4095, 0, 0, 0, 0, 0, 0, 1638, 0, 0, 0, 4095, 0, 0, 0, 1023, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 546, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 794, 0, 0, 4095, 0, 0, 0, 4095, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 342, 0, 0, 0, 0, 0, 0, 0, 1869, 0, 184, 0, 0, 0, 0, 0, 665, 0, 0, 0, 0, 0, 0, 0, 405, 0, 0, 0, 0, 0, 0, 0, 3586, 0, 0, 0, 0, 0, 0, 0, 224, 4095, 0, 0, 0, 0, 0, 0, 2550, 0, 0, 0, 0, 0, 3276, 0, 28, 0, 0, 0, 0, 0, 0, 0, 538, 0, 0, 0, 0, 0, 0, 0, 372, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 246, 0, 0, 0, 0, 0, 0, 0, 112, 0, 0, 0, 0, 0, 0, 0, 118, 0, 0, 0, 0, 0, 0, 0, 3029, 0, 0, 0, 0, 0, 0, 0, 2113, 0, 0, 0, 0, 0, 0, 0, 1976, 0, 0, 0, 0, 0, 0, 0, 85, 0, 0, 0, 0, 0, 0, 0, 1807, 0, 0, 0, 0, 0, 0, 14, 63, 0, 0, 0, 0, 0, 0, 0, 1516, 0, 0, 0, 0, 0, 0, 0, 264, 0, 0, 0, 0, 0, 0, 0, 280, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2866, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3510, 0, 1839, 0, 0, 0, 0, 0, 0, 0, 3155, 0, 0, 0, 0, 0, 693, 4095, 1398, 0, 0, 0, 0, 0, 0, 0, 50, 0, 0, 0, 0, 0, 0, 4095, 2212, 0, 0, 0, 0, 0, 1365, 4095, 1048, 0, 0, 0, 0, 0, 0, 0, 1923, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 4095, 1047, 0, 0, 0, 0, 0, 0, 0, 2118, 0, 0, 0, 0, 0, 0, 0, 992, 0, 0, 0, 0, 0, 1365, 0, 14, 0, 0, 0, 0, 0, 0, 4095, 526, 0, 0, 0, 0, 0, 0, 0, 729, 0, 0, 0, 0, 0, 0, 0, 3114, 0, 0, 0, 0, 0, 0, 4042, 1123, 0, 0, 0, 0, 0, 0, 0, 2605, 0, 0, 0, 0, 0, 2047, 0, 441, 0, 0, 0, 0, 0, 0, 4095, 2337, 0, 0, 0, 0, 0, 0, 0, 1142, 0, 0, 0, 0, 0, 0, 4095, 906, 0, 0, 0, 0, 0, 0, 0, 406, 0, 0, 0, 0, 0, 0, 0, 1126, 0, 0, 0, 0, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1023, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 1605, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}
+#define TEXT2_Data_d {32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 6553, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 49152, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 62557, 32768, 1024, 32768, 32768, 32768, 32768, 45875, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 1180, 53253, 29200, 32768, 32768, 32768, 32768, 10922, 63008, 4096, 12503, 32768, 32768, 32768, 32768, 8192, 21612, 27306, 21802, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 26624, 54613, 39404, 16384, 32768, 32768, 32768, 10922, 509, 54613, 29764, 32768, 32768, 32768, 32768, 8192, 19531, 64408, 22060, 32768, 32768, 32768, 32768, 5461, 4423, 27501, 19894, 248, 49152, 32768, 32768, 2184, 24576, 32768, 32768, 32768, 32768, 24576, 8192, 399, 136, 32768, 26587, 32768, 32768, 32768, 32768, 10922, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 20716, 32768, 49152, 32768, 32768, 32768, 32768, 8192, 5461, 32768, 45875, 32768, 32768, 32768, 32768, 5461, 178, 32768, 32768, 32768, 32768, 32768, 32768, 2340, 27844, 18204, 65511, 32768, 32768, 32768, 32768, 2730, 37559, 60074, 32768, 32768, 32768, 32768, 32768, 8192, 40603, 54613, 32768, 32768, 32768, 32768, 32768, 10922, 40960, 32768, 32768, 32768, 49152, 32768, 32768, 10922, 34257, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 48371, 54613, 32768, 32768, 32768, 32768, 32768, 10922, 51882, 32768, 32768, 32768, 32768, 32768, 32768, 8192, 45875, 32768, 32768, 32768, 32768, 32768, 32768, 6553, 1310, 54613, 32768, 32768, 32768, 32768, 32768, 10922, 42598, 32768, 32768, 32768, 32768, 32768, 32768, 6553, 341, 32768, 5461, 32768, 32768, 32768, 32768, 8192, 8192, 32768, 49152, 32768, 32768, 32768, 32768, 10922, 20795, 32768, 24029, 32768, 32768, 32768, 32768, 3640, 15351, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 26171, 32768, 32768, 32768, 32768, 32768, 32768, 3640, 409, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 2845, 25970, 19998, 57274, 34667, 27787, 10922, 4096, 49698, 33746, 32768, 32768, 32768, 32768, 32768, 10922, 11503, 63666, 12288, 32768, 10041, 2184, 10922, 10922, 20631, 3985, 32768, 32768, 32768, 32768, 42130, 32768, 21202, 31358, 11264, 29918, 20765, 2667, 10922, 49152, 11852, 17644, 32768, 32768, 32768, 32768, 32768, 63811, 908, 13205, 32768, 32768, 32768, 32768, 10922, 32768, 34588, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 402, 1927, 32768, 32768, 32768, 32768, 1365, 10922, 47380, 14406, 32768, 32768, 32768, 32768, 32768, 32768, 4986, 47331, 32768, 32768, 21504, 34816, 49864, 32768, 22685, 11832, 45056, 28672, 32768, 32768, 32768, 32768, 643, 14336, 32768, 10922, 21348, 595, 10922, 32768, 46720, 2978, 32768, 32768, 32768, 32768, 38229, 16384, 54448, 32768, 12288, 64848, 21134, 15621, 10922, 32768, 26687, 34406, 32768, 32768, 32768, 32768, 45056, 10922, 17350, 42130, 29023, 12288, 27016, 390, 2490, 32768, 32768, 60074, 32768, 32768, 32768, 32768, 60773, 16384, 29086, 24662, 32768, 32768, 32768, 32768, 62672, 42477, 45545, 13915, 60074, 51492, 58982, 8192, 63585, 32768, 39140, 12652, 32768, 32768, 20006, 158, 10922, 32768, 7927, 50517, 32768, 32768, 32768, 32768, 32768, 32768, 15823, 48168, 32768, 32768, 32768, 32768, 10922, 32768, 20369, 5532, 32768, 32768, 32768, 32768, 60984, 32768, 646, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 49152, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 11969, 52547, 49152, 16384, 24576, 16384, 10922, 65344, 10922, 32768, 32768, 32768, 32768, 32768, 21005, 16384, 32768, 19660, 32768, 32768, 49152, 8192, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 45056, 27150, 64424, 54613, 32768, 32768, 16384, 32768, 10922, 1638, 63015, 16384, 32768, 32768, 32768, 32768, 56433, 32768, 51191, 47962, 52130, 60854, 2340, 65267, 2730, 134, 65476, 22840, 32768, 32768, 32768, 32768, 53833, 36864, 41233, 50502, 19660, 63975, 2048, 6553, 10922, 12705, 32768, 16246, 32768, 32768, 32768, 32768, 38229, 38229, 46565, 2560, 8192, 60854, 2730, 4681, 10922, 4096, 49152, 26593, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 11899, 6553, 58982, 3276, 16384, 10922, 32768, 54613, 26881, 32768, 32768, 32768, 32768, 32768, 7561, 40960, 9463, 8192, 58982, 10922, 4096, 10922, 12109, 32768, 15365, 32768, 32768, 32768, 32768, 32768, 12288, 42130, 21983, 10922, 60854, 5461, 4681, 10922, 32768, 32768, 2397, 32768, 32768, 32768, 32768, 32768, 9466, 40960, 958, 4096, 58982, 3276, 6553, 10922, 32768, 62259, 14213, 32768, 32768, 32768, 32768, 38229, 13611, 32768, 10014, 16384, 58982, 8192, 10922, 10922, 32768, 32768, 34350, 32768, 32768, 32768, 32768, 42130, 17513, 54084, 23444, 8192, 60854, 4096, 6553, 10922, 32768, 32768, 45875, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 1380, 8192, 58982, 2978, 6553, 10922, 32368, 63897, 25145, 32768, 32768, 32768, 32768, 45056, 17554, 7249, 4717, 32768, 32768, 16384, 32768, 10922, 54613, 54613, 34792, 32768, 32768, 32768, 32768, 64826, 32768, 728, 1100, 32768, 32768, 32768, 16384, 10922, 32768, 58982, 8567, 32768, 32768, 32768, 32768, 32768, 8192, 306, 56102, 32768, 32768, 49152, 5461, 10922, 32768, 32768, 6553, 32768, 32768, 32768, 32768, 50641, 32768, 49, 64533, 32768, 32768, 32768, 32768, 68, 13405, 32768, 32768, 32768, 32768, 32768, 32768, 23405, 18139, 352, 65417, 32768, 32768, 32768, 32768, 78, 22420, 32768, 32768, 32768, 32768, 32768, 32768, 50641, 8192, 404, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 32768, 32768, 32768, 341, 29813, 105, 58855, 49152, 27781, 46870, 568, 22324, 14215, 20209, 37952, 54613, 32768, 10922, 8192, 22755, 9850, 43369, 936, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 10922, 57344, 9830, 18334, 1129, 44683, 61686, 17644, 27306, 45875, 32768, 15400, 26466, 15745, 32768, 54613, 32768, 24576, 32768, 40215, 9830, 48720, 6553, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 2520, 49152, 29491, 40517, 30921, 25988, 7509, 29683, 4096, 32768, 29257, 16657, 49412, 36864, 24576, 60854, 32768, 49152, 28672, 46530, 10922, 55705, 40960, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 10922, 49152, 6553, 7086, 32768, 62501, 2340, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 32768, 32768, 32768, 10922, 3276, 22282, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 58982, 44470, 32768, 32768, 65282, 16384, 28912, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 129, 32768, 16384, 6553, 50723, 1333, 19255, 57898, 16384, 32768, 32768, 32768, 54613, 32768, 32768, 49152, 57344, 12288, 63811, 7561, 56661, 19114, 42130, 50641, 16384, 51492, 49152, 6553, 58709, 62557, 6826, 1260, 57344, 56675, 55003, 21370, 62259, 18204, 24327, 19456, 936, 23323, 35840, 27573, 32768, 64390, 64390, 32768, 61895, 5461, 50790, 32768, 47581, 12288, 57974, 57344, 32768, 10922, 54613, 32768, 7996, 46484, 22370, 32768, 57344, 8192, 32768, 32768, 19917, 58866, 25600, 16384, 58982, 6553, 32768, 32768, 57344, 16384, 32768, 32768, 61440, 4096, 16384, 32768, 45388, 5679, 38321, 16896, 32182, 49152, 32768, 65003, 27460, 32768, 30285, 17164, 54613, 32768, 32768, 32768, 56403, 14336, 62259, 2978, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 3640, 54613, 32768, 54653, 1746, 11702, 1424, 33860, 9054, 38466, 6553, 15181, 38817, 27838, 4681, 1588, 47781, 32768, 32768, 61440, 4681, 32768, 64371, 64599, 8192, 32768, 32768, 57344, 4096, 32768, 32768, 65087, 167, 54613, 49152, 12345, 6490, 1927, 207, 32768, 32768, 32768, 32768, 49152, 2048, 32768, 49152, 38494, 8847, 32768, 17749, 51758, 2760, 29394, 1246, 46421, 24846, 32768, 13405, 32768, 60854, 63351, 32768, 38725, 289, 47331, 32768, 3344, 46160, 53148, 11468, 63195, 186, 32768, 32768, 29601, 42773, 12557, 32768, 63195, 103, 16384, 32768, 64940, 885, 60074, 1724, 32768, 4096, 32768, 32768, 63015, 2520, 32768, 32768, 63715, 1310, 32768, 32768, 6650, 420, 61895, 65093, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 54613, 32768, 32768, 32768, 54193, 2730, 52151, 4681, 32768, 32768, 32768, 32768, 32768, 25516, 32768, 32768, 54613, 819, 32768, 32768, 138, 49152, 8192, 8192, 32768, 49152, 32768, 32768, 32768, 54613, 32768, 32768, 54613, 61895, 62259, 32768, 32768, 14043, 49152, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 24576, 32768, 32768, 239, 62879, 595, 65391, 32768, 54613, 16384, 32768, 24576, 54613, 40960, 32768, 54613, 64225, 58982, 5651, 40960, 16384, 60074, 16384, 49152, 54613, 32768, 32768, 32768, 32768, 32768, 32768, 64322, 17039, 16384, 32768, 3276, 60854, 57344, 49152, 32768, 63195, 32768, 32768, 32768, 49152, 7021, 32768, 57344, 49152, 9493, 54613, 32768, 63715, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 5461, 1560, 63351, 2048, 42463, 32768, 54613, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 32768, 63897, 32768, 8192, 20083, 15263, 4840, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 1927, 32768, 32768, 595, 14020, 22304, 164, 37809, 63715, 32768, 62557, 35659, 32768, 60854, 24, 62805, 32768, 940, 8623, 32768, 65476, 42385, 1348, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 2730, 40960, 18022, 10685, 27573, 13278, 3969, 30037, 49152, 60074, 64225, 27989, 32768, 62259, 32768, 54613, 32768, 32768, 31278, 32768, 32768, 57817, 254, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 8192, 32768, 30720, 10922, 21202, 24576, 780, 32768, 32768, 32768, 62557, 37319, 32768, 62805, 32768, 54613, 32768, 11584, 21370, 32768, 63975, 53291, 25708, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 10922, 49152, 20024, 16384, 27726, 55283, 173, 27726, 32768, 32768, 61895, 23881, 32768, 57344, 32768, 54613, 32768, 32768, 32768, 32768, 54613, 34091, 474, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 10922, 8192, 49152, 6553, 16384, 17585, 744, 35498, 32768, 32768, 61895, 29855, 49152, 63195, 32768, 54613, 32768, 25007, 61895, 32768, 32768, 28319, 64, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 10922, 23405, 49152, 10922, 32768, 40108, 712, 32768, 32768, 32768, 62557, 27949, 32768, 62259, 32768, 54613, 32768, 32768, 32768, 32768, 32768, 13926, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 10922, 23177, 60854, 16384, 32768, 41660, 30687, 30947, 32768, 32768, 61895, 30197, 32768, 62557, 32768, 54613, 32768, 54613, 32768, 32768, 62259, 17976, 38502, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 8192, 37179, 63195, 16384, 32768, 29625, 341, 22937, 32768, 32768, 61895, 25600, 32768, 60074, 32768, 54613, 32768, 40960, 32768, 32768, 32768, 35115, 70, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 6553, 19233, 63488, 910, 13983, 29318, 1122, 38725, 32768, 32768, 62557, 43978, 32768, 62557, 32768, 54613, 32768, 32768, 32768, 32768, 32768, 16384, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 57344, 10922, 16384, 57344, 16384, 42130, 11127, 1024, 35498, 32768, 32768, 61895, 25057, 32768, 60854, 32768, 54613, 32768, 35918, 14823, 32768, 63897, 45638, 1398, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 712, 43514, 63351, 561, 64275, 61367, 20248, 32768, 32768, 32768, 32768, 19660, 49152, 32768, 32768, 54613, 32768, 65087, 54613, 32768, 54613, 55280, 465, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 99, 32768, 32768, 630, 32768, 51667, 2340, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 54613, 32768, 32768, 32768, 32768, 58982, 52010, 309, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 57344, 10922, 8192, 12818, 148, 32768, 1402, 56912, 32768, 32768, 32768, 32768, 32768, 36864, 16384, 32768, 57344, 32768, 42850, 49152, 60854, 63351, 36044, 3276, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 3640, 60074, 32768, 49, 55705, 9830, 65268, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 65467, 32768, 1820, 6553, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 58982, 3276, 799, 63488, 341, 32768, 32768, 65417, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 65457, 32768, 52932, 60854, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 3640, 40960, 32768, 404, 32768, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 699, 61798, 48558, 60770, 889, 5461, 52313, 6090, 39638, 50743, 6144, 51042, 39249, 15179, 65217, 54067, 54994, 32008, 1656, 28751, 51586, 30427, 62827, 181, 32768, 10922, 32768, 32768, 3276, 32768, 32768, 10922, 24094, 47920, 9222, 62557, 51882, 61440, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 57344, 32768, 32768, 32768, 35888, 6553, 46613, 64225, 30508, 32768, 5461, 61440, 46173, 94, 13492, 2048, 8192, 57344, 49152, 57344, 32768, 32768, 59152, 36864, 30720, 50641, 14995, 36217, 32768, 32768, 32768, 10922, 32768, 32768, 10922, 54613, 27726, 6553, 36623, 45875, 25486, 49152, 1638, 43115, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 20480, 60074, 32768, 32768, 49152, 32768, 4096, 14596, 38570, 27069, 23405, 62444, 53365, 64791, 5461, 57866, 7561, 4096, 32768, 61895, 25486, 63488, 7561, 60802, 41224, 6144, 27989, 42850, 42598, 10922, 49152, 32768, 4096, 32768, 32768, 15671, 30037, 30427, 4681, 26553, 24460, 37908, 16384, 16384, 61895, 16384, 10922, 52043, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 61895, 4681, 54613, 32768, 61440, 23405, 14894, 6553, 35520, 41870, 8192, 57344, 56599, 25161, 16384, 32768, 60074, 8192, 32768, 32768, 61895, 6553, 32768, 32768, 61895, 6553, 32768, 32768, 60074, 8192, 32768, 32768, 61440, 4096, 32768, 32768, 60854, 10922, 32768, 32768, 55705, 10922, 50641, 32768, 60074, 47331, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 21533, 35498, 25096, 60074, 2340, 32768, 32768, 19660, 168, 16384, 32768, 28398, 5461, 32768, 32768, 60074, 1820, 32768, 32768, 63015, 474, 32768, 32768, 60074, 655, 32768, 32768, 32768, 16384, 32768, 32768, 18, 6553, 10922, 32768, 19660, 3780, 799, 32768, 15639, 61382, 1415, 1820, 65061, 44683, 47104, 90, 10922, 682, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 8936, 8192, 32768, 32768, 1129, 32768, 4681, 16384, 6553, 36044, 8192, 32768, 1213, 2340, 8192, 2730, 44544, 54613, 8192, 6553, 20480, 6553, 3640, 10922, 32768, 16384, 16384, 32768, 682, 5461, 32768, 40960, 1424, 32768, 2730, 64225, 10922, 64275, 10922, 5461, 668, 227, 57, 1213, 289, 431, 936, 7447, 83, 3276, 6553, 1512, 618, 728, 1310, 481, 16384, 217, 256, 1092, 992, 481, 512, 32768, 32768, 6553, 181, 1170, 155, 32768, 32768, 32768, 35225, 27306, 24576, 3276, 35195, 32768, 32768, 6113, 61429, 9830, 27069, 49152, 13653, 32768, 8192, 10922, 59753, 10922, 15855, 32768, 54613, 32768, 32768, 61772, 41170, 2520, 30197, 53663, 51882, 32768, 32768, 32768, 54613, 8192, 25486, 32768, 32768, 32768, 32768, 7561, 59336, 17644, 4802, 11468, 47891, 49152, 32768, 32768, 61603, 6553, 16384, 32768, 32768, 32768, 32768, 32768, 57344, 16384, 30037, 32768, 60074, 32768, 32768, 32768, 56713, 42598, 14894, 16384, 32768, 32768, 32768, 12503, 29719, 62126, 23795, 21504, 57109, 60269, 25057, 1129, 5851, 32768, 49152, 54613, 64599, 24576, 59028, 33860, 46421, 19894, 31597, 51924, 26425, 22528, 27306, 32768, 10922, 32768, 32768, 32768, 61895, 32768, 32768, 61895, 1898, 14959, 62557, 32768, 62259, 26810, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 64275, 32768, 32768, 54613, 32768, 32768, 8706, 1183, 4237, 10922, 14043, 57344, 44165, 32768, 9637, 55666, 7329, 38912, 21504, 36623, 6553, 60854, 57798, 42015, 8483, 25689, 45379, 40886, 14043, 32768, 6, 43480, 20534, 46, 32768, 32768, 32768, 32768, 32768, 53248, 8936, 32768, 32768, 32768, 57344, 151, 32768, 62727, 57344, 32768, 32768, 32768, 32768, 32768, 32768, 57344, 35617, 16384, 32768, 32768, 32768, 32768, 32768, 54314, 61603, 32768, 32768, 8192, 32768, 16384, 7561, 60201, 625, 19917, 57526, 16384, 65437, 32768, 32768, 54613, 32768, 29491, 61895, 32768, 57344, 10922, 41870, 21065, 29491, 46173, 53463, 58982, 32768, 16384, 762, 30125, 30800, 2340, 5461, 23405, 1820, 4681, 46565, 25301, 54006, 63195, 50876, 29696, 63577, 8192, 8192, 3640, 27019, 474, 3640, 4096, 1424, 5461, 32768, 32768, 10922, 145, 32768, 116, 32768, 32768, 6553, 12288, 54806, 32768, 8192, 16384, 32768, 16384, 401, 19051, 2520, 64545, 30720, 2445, 1927, 8192, 32768, 7021, 42635, 16384, 32768, 32768, 32768, 32768, 59782, 40960, 22082, 30862, 39410, 17929, 32768, 32768, 32768, 7021, 56777, 32768, 16384, 32768, 32768, 32768, 32768, 44632, 30310, 32768, 32768, 60074, 1724, 32768, 32768, 32768, 3276, 32768, 32768, 32768, 32768, 32768, 32768, 63015, 63015, 49152, 32768, 32768, 32768, 32768, 32768, 5461, 45875, 32768, 32768, 32768, 32768, 32768, 1253, 3276, 65267, 16384, 16384, 1260, 32768, 442, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 49152, 3276, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 54613, 32768, 32768, 32768, 32768, 6553, 9972, 2730, 32768, 41506, 4024, 4681, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 22277, 16891, 32768, 32768, 32768, 32768, 32768, 8192, 55261, 32768, 32768, 32768, 32768, 32768, 48, 37287, 32768, 32768, 8192, 32768, 58514, 32768, 5461, 14235, 63715, 25065, 32768, 32768, 32768, 32768, 32768, 50790, 32768, 25721, 32768, 32768, 32768, 32768, 16384, 13156, 61952, 14362, 32768, 3276, 32768, 32768, 32768, 63715, 54613, 20284, 32768, 49152, 32768, 32768, 32768, 63715, 32768, 36780, 32768, 32768, 32768, 32768, 32768, 6068, 32768, 29005, 32768, 32768, 32768, 32768, 32768, 10922, 54613, 6553, 32768, 32768, 32768, 32768, 1662, 16384, 49152, 14548, 5266, 32768, 32768, 62298, 49152, 32768, 32768, 23405, 49152, 32768, 32768, 32768, 38229, 63575, 32768, 3528, 54613, 57344, 32768, 32768, 2048, 8471, 64207, 12614, 32768, 45875, 12079, 728, 24576, 2107, 54613, 1705, 32768, 21202, 49152, 32768, 10922, 360, 63608, 7044, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 58982, 32768, 32768, 32768, 32768, 16384, 2073, 64673, 45766, 16384, 32768, 32768, 32768, 1057, 32768, 32768, 63715, 32768, 24576, 16384, 4681, 2730, 3712, 64783, 37683, 32768, 32768, 32768, 58982, 35498, 4143, 58982, 14062, 64512, 27726, 32768, 32768, 2730, 2132, 60074, 6752, 215, 27852, 32768, 4681, 32768, 564, 60854, 54316, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 168, 32768, 32768, 32768, 32768, 32768, 12743, 60074, 11468, 32768, 32768, 32768, 32768, 32768, 2520, 64322, 50244, 1560, 32768, 32768, 63351, 1638, 461, 65433, 64610, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 45875, 32768, 32768, 32768, 10922, 49152, 7021, 16384, 51492, 57344, 16384, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 504, 16384, 32768, 43300, 25486, 48241, 63195, 28421, 36464, 17700, 4681, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 59753, 32768, 32768, 32768, 32768, 32768, 574, 64225, 195, 5671, 22633, 34462, 55536, 32768, 40049, 19114, 32768, 1820, 32768, 32768, 32768, 1820, 43194, 26916, 32768, 32768, 54613, 1724, 24, 32768, 32768, 2730, 32768, 32768, 135, 25486, 24173, 2978, 58982, 32768, 32768, 65357, 34853, 65386, 17438, 1927, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 62805, 32768, 8192, 24576, 36100, 2520, 12954, 42598, 668, 25683, 43819, 38385, 59084, 461, 44683, 18204, 32768, 16384, 32768, 5461, 32768, 1057, 42130, 17969, 32768, 32768, 32768, 1489, 32768, 32768, 32768, 10922, 32768, 32768, 1024, 4880, 29184, 1927, 32768, 32768, 32768, 32768, 20977, 23633, 58518, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 42598, 57344, 32768, 5461, 47331, 29184, 1560, 16384, 49152, 1489, 4096, 51529, 28137, 25668, 32768, 40049, 8936, 32768, 32768, 32768, 32768, 32768, 5782, 36548, 24311, 32768, 32768, 32768, 1638, 32768, 32768, 49152, 6553, 32768, 32768, 751, 28299, 30619, 1424, 32768, 32768, 32768, 58861, 18977, 64510, 6956, 309, 52043, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 60854, 6553, 54613, 32768, 58982, 16384, 38139, 3276, 45875, 5461, 4096, 4096, 47266, 37236, 20128, 32768, 55296, 8936, 32768, 32768, 54613, 10922, 32768, 2184, 43048, 25122, 32768, 32768, 57344, 2340, 32768, 32768, 54613, 6553, 32768, 32768, 60074, 8192, 32768, 32768, 32768, 32768, 32768, 64111, 61288, 46892, 6054, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 54613, 32768, 5782, 6553, 32768, 16384, 44683, 8192, 3640, 4681, 20943, 28225, 45511, 32768, 55296, 9830, 32768, 32768, 60074, 1724, 32768, 2184, 49152, 17788, 32768, 16384, 32768, 1638, 32768, 32768, 54613, 682, 32768, 32768, 655, 18866, 32768, 2730, 32768, 32768, 32768, 49152, 63968, 62634, 25075, 32768, 16384, 1927, 32768, 32768, 32768, 1424, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 468, 32768, 32768, 32768, 2184, 54613, 32768, 4096, 32768, 32768, 16384, 10922, 3276, 8192, 16384, 26760, 43802, 28813, 32768, 50244, 6301, 32768, 32768, 32768, 3640, 32768, 1927, 34753, 17749, 32768, 32768, 32768, 1927, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 60074, 64673, 25486, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 4096, 32768, 32768, 32768, 10922, 54613, 32768, 520, 45980, 32768, 2730, 8192, 32768, 10922, 5461, 31069, 28746, 14959, 1092, 39789, 16384, 32768, 32768, 32768, 32768, 32768, 2184, 43395, 22755, 32768, 32768, 32768, 1365, 32768, 32768, 32768, 59517, 32768, 32768, 32768, 24576, 32768, 32768, 32768, 32768, 32768, 62259, 25972, 48111, 26954, 289, 32768, 62259, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 64599, 32768, 32768, 32768, 10922, 57344, 32768, 1024, 31857, 32768, 2340, 16384, 57344, 8192, 6553, 39044, 60037, 45207, 32768, 38725, 27306, 32768, 32768, 32768, 54613, 32768, 2184, 40049, 25869, 32768, 32768, 32768, 2978, 32768, 32768, 32768, 10922, 32768, 32768, 14043, 54613, 32768, 32768, 32768, 32768, 32768, 32768, 61440, 54870, 18268, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 58982, 32768, 555, 34448, 32768, 2048, 27554, 32768, 221, 51200, 18452, 52538, 13412, 10922, 42130, 28672, 32768, 32768, 32768, 32768, 32768, 1927, 52130, 28216, 32768, 32768, 32768, 1424, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 57344, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 8192, 54613, 32768, 1724, 3780, 32768, 4681, 16384, 32768, 10922, 14043, 63765, 31361, 17203, 32768, 47331, 29491, 32768, 32768, 32768, 32768, 32768, 2184, 43417, 23058, 32768, 32768, 32768, 2340, 32768, 32768, 32768, 10922, 32768, 32768, 1057, 13458, 963, 3276, 32768, 32768, 32768, 32768, 45110, 11713, 57432, 2978, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 6553, 60802, 32768, 564, 39494, 32768, 474, 1042, 10922, 6553, 58436, 32296, 15881, 7473, 461, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 57344, 49152, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 65313, 32768, 10922, 32768, 32768, 32768, 54613, 46967, 60940, 20825, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 64007, 32768, 32768, 32768, 32768, 32768, 292, 32768, 32768, 32768, 9054, 41421, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 58982, 26338, 2289, 184, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 8192, 54613, 32768, 19660, 4681, 33945, 210, 18266, 54613, 32768, 32768, 33441, 60362, 2978, 574, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 49152, 8192, 32768, 58982, 16384, 32768, 32768, 32768, 6553, 32768, 32768, 2184, 6301, 32768, 16384, 32768, 4681, 32768, 63351, 58982, 5461, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 61895, 32768, 32768, 5461, 32768, 32768, 48, 10922, 49152, 61895, 62259, 49152, 54613, 375, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 68, 32768, 32768, 1820, 32768, 6553, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 6553, 62259, 32768, 799, 32768, 32768, 63488, 1024, 32768, 16384, 54613, 32768, 32768, 32768, 55281, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 78, 32768, 32768, 10922, 62557, 32768, 4681, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 61895, 32768, 16384, 10922, 32768, 32768, 404, 32768, 32768, 32768, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 876, 101, 64905, 19262, 887, 6182, 63824, 65056, 2110, 21504, 23665, 32768, 9557, 4468, 61555, 21261, 65238, 31792, 21945, 5245, 57647, 14659, 56672, 18455, 17269, 30962, 17950, 48143, 32768, 65472, 4681, 38502, 65323, 35739, 33784, 11618, 60629, 33374, 33196, 38026, 252, 36251, 11407, 47966, 12743, 64368, 49436, 8192, 32768, 32768, 54613, 32768, 32768, 32768, 32768, 32768, 2978, 32768, 10922, 6553, 36044, 30037, 56320, 32768, 42130, 26553, 512, 13284, 64016, 3954, 49152, 64823, 54613, 9830, 16384, 9972, 44236, 1820, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 64365, 42325, 54613, 32768, 32768, 4681, 32768, 32768, 32768, 32768, 10922, 6553, 32768, 25057, 4681, 32768, 27949, 41208, 32768, 3276, 2048, 2184, 16384, 16384, 5461, 32768, 32768, 4096, 61895, 1927, 63921, 32768, 64046, 19660, 1213, 32768, 24879, 54613, 32768, 40960, 32768, 16384, 32768, 24576, 32768, 32768, 32768, 32768, 52565, 21065, 20852, 39789, 54613, 28672, 54613, 18204, 712, 44470, 54613, 44683, 32768, 10922, 32768, 32768, 62259, 8192, 57344, 32768, 60074, 8192, 32768, 32768, 47331, 4681, 32768, 6553, 40478, 24029, 6553, 32768, 52043, 21202, 3640, 44333, 44683, 4096, 32768, 49152, 18204, 5461, 1560, 49971, 61440, 5461, 32768, 32768, 61440, 16384, 32768, 32768, 61440, 5461, 32768, 32768, 40960, 32768, 32768, 32768, 1260, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 27752, 30037, 22685, 64111, 468, 32768, 32768, 61895, 2730, 32768, 4681, 34406, 23665, 3640, 32768, 8749, 8533, 40656, 62805, 64207, 3040, 1503, 24401, 37683, 618, 4681, 64406, 32768, 9947, 60074, 32768, 60074, 60074, 60854, 6553, 36864, 425, 32768, 32768, 32768, 35108, 38229, 38725, 32768, 56433, 2730, 16384, 60854, 27577, 46421, 8192, 41506, 12288, 24576, 20284, 2184, 39514, 30947, 36739, 38229, 381, 49152, 16384, 32768, 6553, 50322, 21065, 32768, 32768, 32768, 32768, 910, 26466, 1024, 2520, 35498, 14336, 38725, 32768, 31482, 39713, 442, 38356, 64151, 39976, 2184, 63608, 16384, 1927, 32768, 32768, 54613, 4681, 8192, 32768, 2520, 184, 40960, 32768, 32768, 32768, 32768, 32768, 32768, 42130, 32768, 49152, 32768, 32768, 32768, 32768, 963, 2048, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 4096, 32768, 32768, 32768, 2600, 32768, 32768, 32768, 54613, 23405, 32768, 32768, 47331, 32768, 32768, 32768, 59234, 6553, 16384, 33860, 30427, 16384, 32768, 782, 8466, 1560, 47606, 49152, 64940, 32768, 62805, 16384, 59886, 840, 43957, 62805, 8192, 32768, 32768, 32768, 58514, 8192, 22528, 32768, 63488, 32768, 32768, 32768, 62146, 6553, 29318, 32768, 32768, 32768, 32768, 32768, 61261, 61481, 19660, 65413, 32768, 32768, 32768, 32768, 60362, 8192, 29318, 63488, 58514, 32768, 32768, 32768, 61440, 43008, 17347, 32768, 32768, 32768, 32768, 16384, 60620, 8192, 25746, 32768, 32768, 32768, 32768, 49152, 5461, 6553, 16384, 10922, 3640, 32768, 57344, 992, 1424, 10922, 60854, 60854, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 6553, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 30801, 62464, 23405, 3276, 26997, 3568, 10922, 42130, 8623, 2730, 32768, 32768, 54613, 32768, 992, 9906, 23530, 28987, 40960, 32768, 32768, 32768, 1424, 36864, 1129, 6068, 32768, 32768, 32768, 32768, 32768, 49152, 9972, 3640, 32768, 32768, 32768, 32768, 32768, 60322, 17320, 32768, 32768, 32768, 32768, 32768, 32768, 38229, 47261, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 245, 32768, 36864, 32768, 54613, 32768, 32768, 32768, 8192, 49152, 16384, 3640, 7192, 32768, 32768, 32768, 43534, 27019, 6553, 56638, 63209, 1057, 1820, 54613, 32768, 60665, 2978, 58136, 58982, 2730, 90, 32768, 10922, 32768, 682, 4681, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 55296, 54613, 8192, 32768, 32768, 32768, 32768, 32768, 62146, 32768, 32768, 32768, 4681, 32768, 49152, 32768, 45875, 7561, 60074, 14043, 25869, 10922, 32768, 32768, 64322, 32768, 63195, 32768, 57344, 32768, 55854, 32768, 34224, 61134, 49152, 61440, 58982, 16384, 19660, 24576, 27306, 42130, 58982, 32768, 40049, 32768, 54613, 32768, 32768, 10922, 49152, 32768, 63608, 5461, 32768, 32768, 7103, 19660, 49152, 32768, 32768, 32768, 49152, 54613, 992, 16384, 32768, 32768, 2184, 32768, 32768, 64736, 54613, 16384, 10922, 1260, 10922, 32768, 62805, 32768, 21245, 16384, 65308, 32768, 65250, 32768, 61895, 32768, 64673, 32768, 65104, 32768, 64599, 32768, 63897, 10922, 64118, 32768, 62259, 32768, 58982, 60074, 52736, 5461, 57221, 32768, 42962, 32768, 64225, 32768, 49864, 24576, 40960, 36864, 64450, 32768, 60160, 32768, 57890, 32768, 64543, 32768, 65054, 32768, 65024, 32768, 32768, 16384, 32768, 32768, 58982, 32768, 181, 32768, 64365, 32768, 5359, 30601, 32768, 32768, 32768, 32768, 32768, 16384, 63748, 5802, 4096, 32768, 1820, 2520, 300, 61440, 144, 7172, 32768, 32768, 65295, 32768, 1410, 19797, 20852, 9774, 2730, 42598, 1057, 59371, 16384, 51118, 3276, 13702, 32768, 32768, 57344, 32768, 54613, 62805, 60074, 13777, 5461, 60854, 18866, 2978, 32768, 10922, 61440, 36588, 32768, 32768, 32768, 32768, 61895, 22635, 55159, 33185, 24029, 60854, 4551, 32768, 2520, 47208, 12288, 54272, 32768, 32768, 32768, 32768, 32768, 8192, 51882, 9441, 6553, 60854, 2184, 3640, 32768, 16384, 32768, 20355, 32768, 32768, 32768, 32768, 2457, 2978, 36864, 17982, 27306, 42598, 57842, 21202, 1724, 8623, 8192, 51882, 32768, 16384, 32768, 32768, 16384, 1489, 47331, 3846, 2978, 62805, 2184, 5461, 32768, 32768, 32768, 2730, 32768, 32768, 32768, 32768, 32768, 32768, 40960, 21713, 8192, 61440, 2340, 3640, 32768, 32768, 32768, 60259, 32768, 32768, 32768, 32768, 32768, 8192, 60074, 9265, 6553, 28299, 2048, 4681, 10922, 32768, 58982, 32768, 32768, 32768, 32768, 32768, 862, 27306, 61067, 10593, 60269, 894, 6491, 37524, 5851, 8623, 27306, 45875, 32768, 45660, 26810, 28672, 64406, 8192, 31278, 8192, 32768, 32768, 32768, 49152, 16384, 496, 32768, 1141, 10922, 16384, 762, 64262, 65283, 20218, 12429, 21270, 31129, 32768, 28398, 24029, 25746, 57647, 7074, 33792, 26810, 16384, 57344, 10922, 32768, 4681, 58088, 49152, 32768, 32768, 32768, 32768, 5461, 668, 10532, 62295, 32768, 32768, 49152, 32768, 53248, 60362, 8064, 53106, 42962, 49782, 32768, 63488, 32768, 32768, 32768, 55705, 4681, 6553, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 32768, 32768, 728, 32768, 32768, 49152, 32768, 16384, 10922, 32768, 32768, 32768, 32768, 46149, 4497, 26312, 5492, 8491, 9316, 61440, 16384, 35617, 40049, 32768, 53248, 40049, 51200, 32768, 32768, 63608, 5461, 53833, 2797, 44950, 25486, 42130, 5461, 22055, 59753, 32768, 6553, 6553, 32768, 32768, 58088, 65121, 35155, 26559, 14646, 48538, 15777, 26370, 39374, 270, 54036, 37327, 44297, 2730, 16384, 32768, 32768, 45, 32768, 32768, 52932, 11663, 20480, 52475, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 3276, 16384, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 8192, 151, 32768, 32768, 32768, 54613, 55523, 16384, 40960, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 57344, 14894, 52932, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 64478, 46754, 63608, 64998, 61038, 37, 32768, 32768, 40960, 32768, 12288, 32768, 49152, 32768, 49152, 32768, 3411, 381, 5461, 36364, 58675, 477, 9155, 4681, 9637, 1864, 19660, 49152, 32768, 65172, 32768, 32768, 32768, 58514, 32768, 54613, 55251, 58982, 60074, 4096, 32768, 61895, 32768, 32768, 32768, 57344, 40960, 62259, 58218, 21468, 16384, 13653, 50014, 10922, 21065, 43115, 1260, 61603, 5461, 38229, 32768, 32768, 49152, 32768, 64838, 6553, 59336, 64406, 38674, 5914, 65054, 54613, 63015, 16384, 24576, 6553, 64225, 32768, 60854, 32768, 50641, 185, 38117, 64478, 10128, 40452, 32768, 64365, 41506, 963, 41870, 63351, 40049, 182, 57344, 32768, 63811, 8192, 18204, 32768, 37179, 17039, 65061, 32768, 37888, 32768, 61440, 32768, 7756, 32768, 60074, 32768, 32768, 32768, 32768, 32768, 54613, 32768, 145, 32768, 32768, 32768, 116, 32768, 32768, 32768, 32768, 32768, 58982, 32768, 61440, 49152, 63975, 3046, 32768, 32768, 38725, 8192, 1638, 8192, 57344, 1424, 61440, 32768, 5063, 992, 655, 37809, 65069, 694, 2520, 65497, 48128, 309, 504, 54613, 63897, 16384, 57344, 32768, 65217, 1092, 47891, 49152, 7927, 3178, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 50062, 20833, 27972, 4681, 53573, 9191, 33398, 15185, 27096, 34833, 8791, 63608, 32768, 2520, 32768, 32768, 32768, 5461, 52932, 49152, 34292, 58397, 32768, 32768, 56599, 187, 32768, 32768, 55705, 1489, 32768, 32768, 51492, 697, 3932, 50079, 59321, 1724, 32768, 32768, 32768, 330, 32768, 60074, 55366, 2978, 32768, 32768, 32768, 1213, 32768, 32768, 16384, 4681, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 63015, 54613, 63015, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 414, 32768, 32768, 32768, 32768, 40478, 49152, 45056, 29318, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 182, 8192, 3389, 49152, 32768, 64843, 49152, 63351, 16384, 32768, 1260, 32768, 32768, 32768, 65093, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 32768, 16384, 32768, 57344, 62259, 32768, 32768, 62805, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 32768, 32768, 32768, 32768, 54613, 32768, 49152, 32768, 32768, 32768, 49152, 32768, 32768, 2730, 4681, 6616, 64170, 63195, 54613, 32768, 32768, 5461, 17644, 606, 57344, 60854, 32768, 32768, 32768, 32768, 58982, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 21904, 11995, 34418, 258, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 40960, 32768, 64695, 173, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 74, 32768, 43008, 22197, 32768, 54613, 6301, 6144, 8192, 32768, 32768, 32768, 16384, 2520, 32768, 32768, 60074, 32768, 24917, 32768, 16384, 49152, 52616, 297, 16384, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 27306, 11627, 32768, 32768, 36955, 280, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 28480, 28672, 24576, 64998, 13554, 25107, 6553, 32768, 1560, 6553, 32768, 32768, 49152, 32768, 32768, 32768, 49152, 12288, 19660, 28672, 9972, 8192, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 15915, 32768, 49152, 13284, 1024, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 14417, 54613, 32768, 32768, 4761, 352, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 32768, 32768, 10922, 19660, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 242, 6553, 49152, 32768, 32768, 49152, 64704, 5084, 64950, 19660, 32768, 32768, 32768, 32768, 64225, 28, 32768, 49152, 16384, 49152, 49152, 32768, 45875, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 35498, 8192, 64111, 16384, 32768, 3528, 40960, 32768, 53248, 16384, 57344, 32768, 16384, 32768, 32768, 63488, 32768, 28374, 64322, 16384, 63291, 63484, 260, 32768, 32768, 49152, 6553, 24651, 32063, 668, 32768, 54613, 49152, 60995, 49152, 780, 24576, 795, 1560, 32768, 32768, 5461, 4096, 9011, 49152, 32768, 32768, 54613, 32768, 3240, 32768, 32768, 63608, 34928, 26810, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 6553, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 61086, 54613, 24576, 11038, 6199, 385, 54613, 58982, 10922, 49152, 32768, 32768, 32768, 32768, 549, 2978, 32768, 32768, 60854, 16384, 32768, 2006, 32768, 32768, 10922, 54613, 49152, 16384, 3276, 16384, 62805, 32768, 9072, 54613, 8192, 65427, 9882, 1153, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 58982, 60074, 38950, 1198, 5461, 2978, 51949, 17056, 203, 32768, 43417, 2340, 20852, 32768, 32768, 32768, 32768, 62805, 32768, 19381, 60074, 49152, 63608, 28757, 330, 2275, 32768, 1724, 58658, 32768, 32768, 63195, 32768, 32768, 32768, 65275, 32768, 32768, 60854, 31402, 1499, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 6217, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 57344, 32768, 60074, 59753, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 22685, 32768, 32768, 1683, 62557, 936, 1560, 32768, 32768, 32768, 32768, 32768, 32768, 2184, 14043, 10922, 17076, 32768, 32768, 320, 10922, 64333, 32768, 32768, 32768, 32768, 32768, 49152, 54613, 32768, 32768, 10922, 32768, 32768, 58982, 32768, 24576, 24576, 32768, 10922, 32768, 32768, 32768, 32768, 54613, 32768, 32768, 58982, 42850, 16384, 63195, 32768, 49152, 36864, 10922, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 504, 32768, 49152, 32768, 32768, 32768, 53289, 28961, 8095, 32507, 52377, 11353, 38229, 63608, 55282, 41093, 7494, 31155, 36961, 20233, 4681, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 32768, 49152, 2048, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 564, 16384, 32768, 64225, 65343, 32768, 2874, 6553, 21344, 27683, 32768, 27627, 30294, 63566, 32768, 32768, 58982, 24029, 19660, 5461, 32768, 32768, 1820, 32768, 34816, 32768, 32768, 32768, 32768, 32768, 60074, 32768, 63811, 25600, 39594, 1260, 32768, 32768, 32768, 32768, 32768, 54613, 64716, 32768, 24, 32768, 32768, 32768, 32768, 32768, 62805, 32768, 32768, 32768, 32768, 32768, 1408, 32768, 2340, 9830, 29491, 25278, 4681, 32768, 16384, 3640, 32768, 32768, 32768, 32768, 62557, 65480, 61547, 44371, 8009, 52615, 60848, 3072, 2656, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 10922, 54613, 32768, 32768, 2730, 32768, 32768, 8192, 32768, 10922, 32768, 41779, 41642, 16384, 32768, 910, 3276, 8192, 4681, 54801, 32768, 3510, 58982, 19720, 20999, 35250, 31470, 46515, 2660, 404, 32768, 57344, 38466, 20852, 10922, 40049, 16384, 16384, 32768, 32768, 32768, 61440, 32768, 32768, 32768, 64736, 32768, 58789, 29225, 39514, 2048, 32768, 32768, 32768, 32768, 49152, 32768, 64572, 32768, 32768, 32768, 32768, 32768, 61895, 6553, 54613, 32768, 62557, 8192, 32768, 32768, 18970, 16384, 630, 28672, 35693, 37137, 23405, 32768, 57344, 5461, 32768, 32768, 57344, 16384, 32768, 60074, 11047, 6121, 32, 46120, 65024, 599, 16384, 32768, 57344, 16384, 32768, 32768, 60854, 10922, 32768, 32768, 36996, 32768, 32768, 32768, 1489, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 38229, 40960, 14705, 58982, 123, 32768, 32768, 9292, 2978, 2184, 34406, 37754, 28867, 7909, 32768, 43467, 10601, 16384, 49152, 30037, 115, 2730, 63841, 22740, 4356, 7909, 51186, 49317, 9513, 32768, 32768, 58982, 16384, 19114, 8192, 32768, 352, 16384, 32768, 32768, 32768, 32768, 6553, 32768, 32768, 61895, 16384, 64046, 13863, 38385, 1489, 49152, 5461, 20480, 8192, 32768, 840, 64625, 32768, 47331, 481, 32768, 32768, 16384, 6553, 58789, 38010, 32768, 32768, 32768, 32768, 1290, 28476, 4486, 11416, 32768, 35338, 37524, 32768, 32768, 12743, 3640, 54613, 58982, 2978, 63195, 65007, 29654, 36309, 1489, 37802, 62153, 22706, 218, 32768, 4096, 1129, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 4681, 32768, 16384, 61440, 32768, 32768, 32768, 32768, 10922, 32768, 16384, 32768, 170, 32768, 32768, 32768, 61261, 32768, 8936, 32768, 19660, 32768, 32768, 5461, 45641, 1024, 24576, 26731, 37754, 1927, 32768, 16384, 61067, 5461, 18970, 61895, 49152, 2730, 63015, 23969, 23683, 3363, 49054, 44078, 4153, 61895, 32768, 57344, 44067, 13653, 22685, 32768, 64716, 32768, 32768, 32768, 56912, 10922, 24576, 32768, 32768, 64225, 49152, 64046, 38034, 35840, 7760, 32768, 32768, 32768, 32768, 32768, 61440, 62146, 15291, 32768, 64443, 32768, 32768, 32768, 55898, 32768, 20852, 32768, 32768, 32768, 32768, 32768, 62949, 8192, 18970, 32768, 32768, 32768, 32768, 32768, 4096, 32768, 32768, 32768, 58982, 32768, 64111, 3072, 618, 1927, 54613, 62805, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 61440, 32768, 32768, 10922, 32768, 32768, 230, 16384, 16384, 9011, 32768, 32768, 63015, 32768, 4096, 45056, 24576, 32768, 63608, 32768, 19362, 36044, 5369, 1368, 9388, 46596, 38666, 31243, 32768, 32768, 58982, 39009, 22937, 8192, 32768, 32768, 32768, 32768, 32768, 38229, 50014, 32768, 32768, 49152, 64365, 32768, 63195, 39161, 23405, 2184, 32768, 32768, 16384, 32768, 32768, 32768, 64673, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 35442, 32768, 32768, 32768, 32768, 32768, 630, 32768, 18904, 12743, 32768, 32768, 63015, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 60854, 54303, 56009, 51427, 59109, 64676, 2938, 63015, 32768, 16384, 32768, 9637, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 27069, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 20128, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 32768, 32768, 10922, 32768, 32768, 4096, 32768, 49152, 16384, 32768, 32768, 49152, 32768, 10922, 32768, 36044, 32768, 57344, 32768, 3640, 16384, 30037, 30310, 38139, 37398, 36491, 4964, 32768, 32768, 60074, 25057, 27525, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 47331, 32768, 32768, 32768, 64322, 32768, 63715, 31744, 30508, 1724, 32768, 32768, 32768, 32768, 32768, 32768, 64695, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 16384, 32768, 58982, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 61440, 32768, 2520, 5461, 57344, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 12288, 12822, 32768, 32768, 32768, 32768, 32768, 16384, 60074, 32768, 32768, 10922, 32768, 32768, 1724, 63195, 19504, 43115, 32768, 32768, 63488, 32768, 8192, 39547, 49152, 39069, 54613, 32768, 9830, 63811, 25863, 7001, 3582, 58441, 44892, 2730, 574, 32768, 61440, 46967, 22528, 3276, 32768, 32768, 32768, 32768, 8192, 17408, 63811, 12554, 32768, 32768, 64225, 32768, 64111, 40656, 39739, 11368, 32768, 32768, 32768, 32768, 32768, 32768, 64791, 32768, 32768, 32768, 32768, 32768, 16384, 5135, 65441, 1120, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 712, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 62259, 4983, 2406, 42226, 33931, 39214, 1260, 65246, 32768, 32768, 32768, 49152, 5585, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 4818, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 63715, 32768, 32768, 32768, 32768, 32768, 23405, 54613, 15720, 32768, 32768, 32768, 32768, 32768, 5461, 54613, 51336, 32768, 8192, 32768, 32768, 14823, 63195, 31744, 1724, 32768, 32768, 63195, 32768, 16384, 32768, 32768, 13783, 58982, 32768, 3640, 16384, 9637, 3932, 33450, 59004, 48529, 865, 32768, 32768, 40049, 4437, 58026, 9609, 32768, 32768, 32768, 32768, 32768, 9557, 32768, 65325, 32768, 32768, 64225, 32768, 63195, 27306, 26466, 3640, 32768, 32768, 32768, 32768, 32768, 16384, 64599, 49152, 32768, 32768, 32768, 32768, 32768, 10922, 60074, 32768, 32768, 32768, 32768, 32768, 614, 49152, 10922, 36864, 32768, 32768, 32768, 32768, 32768, 4681, 58982, 49152, 32768, 32768, 60074, 64961, 52830, 59680, 840, 54441, 46011, 39514, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 58982, 32768, 32768, 6553, 32768, 32768, 2440, 32768, 819, 1129, 32768, 32768, 64512, 32768, 22235, 1724, 32768, 32768, 65314, 32768, 24029, 63301, 6774, 16056, 32239, 40433, 58062, 655, 10922, 32768, 58982, 23405, 35498, 8192, 32768, 32768, 32768, 32768, 37236, 32768, 32768, 32768, 32768, 32768, 64322, 32768, 60854, 35617, 31857, 1213, 32768, 32768, 32768, 32768, 32768, 32768, 64853, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 63195, 32768, 49152, 32768, 32768, 32768, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 49152, 57344, 32768, 32768, 10922, 32768, 32768, 3475, 49152, 4327, 1260, 62259, 32768, 63488, 32768, 16384, 32768, 32768, 32768, 54613, 32768, 32768, 64046, 21578, 1364, 6175, 51241, 51561, 409, 885, 32768, 58982, 11988, 26810, 6553, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 64225, 32768, 63897, 28195, 40632, 2048, 32768, 32768, 32768, 32768, 32768, 32768, 64478, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 60854, 32768, 32768, 32768, 32768, 32768, 4459, 32768, 11784, 30720, 24094, 32768, 63897, 2978, 32768, 32768, 32768, 32768, 32768, 32768, 63608, 65115, 21737, 1645, 2543, 58936, 14511, 5146, 2730, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 27306, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 60854, 32768, 61895, 270, 32768, 32768, 2600, 38229, 1973, 11363, 32768, 4096, 65080, 32768, 322, 2730, 4096, 16384, 27306, 936, 62805, 63053, 1260, 3461, 27, 60893, 57247, 34133, 448, 32768, 54613, 1638, 32768, 32768, 32768, 2520, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 49152, 10922, 32768, 16384, 2520, 49152, 32768, 32768, 60854, 5285, 4096, 32768, 32768, 4681, 32768, 32768, 32768, 10922, 54613, 32768, 32768, 32768, 32768, 32768, 10922, 3640, 32768, 364, 54613, 10922, 54613, 32768, 10922, 2978, 32768, 32768, 32768, 840, 32768, 54613, 20852, 11377, 2520, 57438, 62674, 442, 32768, 16384, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 1057, 32768, 32768, 32768, 32768, 54613, 32768, 64791, 78, 32768, 32768, 32768, 32768, 8192, 47891, 32768, 32768, 58982, 32768, 638, 54613, 32768, 32768, 32768, 63488, 32768, 62805, 3533, 2340, 262, 65353, 57344, 62557, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 60074, 49152, 32768, 32768, 32768, 32768, 54613, 32768, 32768, 32768, 32768, 32768, 4681, 60854, 6553, 32768, 32768, 32768, 57344, 32768, 32768, 58982, 32768, 32768, 32768, 32768, 32768, 58982, 284, 496, 50, 64443, 19159, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 57344, 32768, 32768, 10922, 32768, 32768, 6553, 16384, 3276, 57344, 34333, 32962, 2238, 32768, 12528, 33264, 49152, 54613, 32768, 32768, 32768, 40960, 45150, 19689, 16384, 9102, 56599, 1820, 39666, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 16384, 32768, 32768, 24576, 10922, 32768, 58982, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 62805, 32768, 32768, 32768, 32768, 32768, 1170, 49152, 574, 41316, 32768, 32768, 58982, 16384, 32768, 32768, 4681, 32768, 32768, 32768, 32768, 63488, 49152, 6553, 4096, 8192, 4096, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 32768, 32768, 3640, 32768, 32768, 32768, 32768, 5461, 32768, 32768, 32768, 32768, 32768, 15, 16384, 54613, 32768, 32768, 49152, 32768, 61895, 32768, 3276, 32768, 16384, 32768, 10922, 65482, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 65467, 32768, 32768, 32768, 32768, 32768, 5461, 32768, 32768, 32768, 6553, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 62557, 32768, 32768, 3276, 32768, 32768, 118, 32768, 32768, 32768, 32768, 32768, 32768, 2048, 287, 49152, 32768, 10922, 16384, 32768, 54613, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 63301, 139, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 65301, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 2978, 32768, 32768, 60854, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 32768, 32768, 3640, 32768, 32768, 16384, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 1198, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 57344, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 1, 75, 72, 10922, 8192, 341, 57, 36, 211, 1260, 14, 110, 5461, 132, 2730, 35, 18, 136, 642, 4274, 1365, 1310, 2340, 4096, 1057, 2730, 312, 4096, 190, 12, 210, 372, 10922, 242, 282, 315, 258, 528, 59, 697, 1092, 179, 799, 1365, 1260, 173, 49, 277, 368, 642, 240, 3075, 96, 376, 595, 284, 4681, 6553, 10922, 63, 1092, 10922, 885, 936, 5461, 19, 23, 20, 61, 60, 35, 192, 150, 15, 668, 762, 55, 58, 55, 52, 58, 4681, 38, 23, 22, 123, 121, 40, 1489, 4681, 2340, 65, 119, 74, 3276, 32768, 54613, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 49152, 32768, 57344, 32768, 8936, 32768, 18204, 47331, 36044, 29491, 28672, 23405, 32768, 32768, 64838, 34848, 4096, 48496, 42079, 54613, 22996, 728, 6553, 10162, 10922, 8192, 54613, 49152, 32768, 65223, 62557, 54613, 3640, 16384, 16384, 32768, 1489, 8192, 18204, 16384, 56433, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 41905, 32768, 32768, 32768, 489, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 30953, 28987, 22441, 49152, 173, 32768, 32768, 16384, 16384, 3640, 32768, 32768, 32768, 32768, 32768, 10922, 2048, 32768, 32768, 58982, 414, 3640, 32768, 27726, 30037, 41506, 35498, 27726, 16384, 32768, 32768, 33938, 914, 44683, 728, 5066, 44821, 1057, 38725, 29257, 23405, 38229, 45875, 23928, 25434, 23845, 41316, 34882, 6553, 32768, 32768, 32768, 5461, 4096, 54613, 32768, 6746, 63715, 32768, 61895, 93, 32768, 32768, 5461, 171, 17901, 14359, 75, 62557, 32768, 32768, 1092, 27539, 23405, 19456, 32768, 32768, 19660, 165, 54613, 32768, 16384, 32768, 32768, 16384, 10922, 16384, 32768, 5461, 32768, 32768, 32768, 32768, 32768, 32768, 1170, 244, 682, 1424, 4096, 8192, 5461, 3276, 16384, 36548, 6553, 6553, 32768, 10922, 4681, 6553, 321, 885, 32768, 21533, 16384, 4096, 8192, 4096, 32768, 32768, 10922, 18204, 32768, 642, 32768, 32768, 32768, 62259, 8192, 30427, 32768, 55003, 32768, 32768, 32768, 47104, 8192, 18432, 32768, 32768, 32768, 32768, 10922, 53908, 4681, 16384, 32768, 54613, 9830, 32768, 32768, 47981, 17644, 29918, 36864, 32768, 32768, 32768, 63351, 50322, 25869, 6144, 1170, 61440, 40960, 64406, 2520, 55563, 12288, 9102, 32768, 32768, 32768, 58982, 64716, 60362, 5461, 26526, 4468, 32768, 3276, 64572, 32768, 50790, 27306, 12288, 32768, 49152, 32768, 32768, 32768, 60620, 16384, 37809, 32768, 32768, 32768, 32768, 32768, 62364, 5461, 25746, 32768, 32768, 32768, 32768, 2730, 1638, 32768, 32768, 32768, 32768, 32768, 32768, 341, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 24576, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 50502, 65372, 32055, 20369, 33435, 4910, 32768, 58412, 15710, 32768, 32768, 32768, 32768, 32768, 6301, 54613, 6553, 49152, 63608, 32768, 1927, 32768, 24029, 32768, 16384, 35498, 27726, 60074, 32768, 32768, 9195, 25122, 23756, 34816, 64406, 936, 3276, 61849, 16384, 3870, 10692, 60854, 181, 10922, 668, 50176, 47331, 57344, 62661, 6553, 63015, 32768, 32768, 64406, 32768, 32768, 668, 9557, 16384, 5461, 32768, 32768, 32768, 5461, 8192, 840, 10922, 992, 6553, 32768, 8192, 6553, 18299, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 14043, 4096, 10922, 8192, 11702, 8192, 32768, 32768, 54613, 1724, 2730, 32768, 16384, 32768, 32768, 4681, 4756, 744, 8192, 3640, 1820, 6553, 4681, 2730, 4681, 10922, 1820, 2730, 2048, 4681, 1560, 32768, 42130, 9557, 2730, 3640, 6144, 1724, 10922, 24576, 13335, 32768, 32768, 16384, 16384, 32768, 61895, 32768, 20480, 8936, 52792, 17203, 14594, 6702, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 33095, 32768, 39864, 63990, 50758, 32768, 1129, 6553, 16384, 32768, 46565, 36864, 32768, 31087, 32768, 32768, 65437, 49152, 35550, 2417, 9163, 32768, 19804, 3944, 10922, 11702, 885, 15671, 2184, 32768, 54613, 64695, 49152, 32768, 64170, 32768, 32768, 32768, 32768, 6553, 32768, 32768, 23405, 8192, 6553, 32768, 32768, 32768, 64917, 16384, 703, 32768, 49152, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 45875, 64443, 32768, 32768, 20480, 10922, 32768, 49152, 49152, 16384, 32768, 32768, 32768, 32768, 65150, 32768, 8192, 45875, 32768, 32768, 32085, 6553, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 12288, 32768, 54613, 32768, 61895, 10922, 32768, 32768, 13429, 18583, 32768, 32768, 32768, 32768, 32768, 32768, 50641, 15498, 3276, 22341, 1213, 4096, 32768, 50517, 10922, 59222, 32768, 32768, 32768, 32768, 16384, 61440, 45875, 15556, 32768, 47331, 1092, 6553, 37236, 36512, 29491, 28672, 47331, 54613, 32768, 32768, 41557, 23315, 61832, 16566, 60854, 61440, 10510, 45415, 8192, 7552, 58982, 9226, 32768, 32768, 61440, 64867, 49152, 63897, 57344, 19141, 56744, 60854, 1638, 47224, 32768, 2520, 57344, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 56599, 10712, 6553, 61895, 1724, 2730, 16384, 9830, 60074, 15846, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 10048, 6553, 60854, 1260, 2340, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 54613, 7434, 1560, 1484, 1129, 3640, 32768, 122, 32768, 2730, 32768, 32768, 32768, 32768, 32768, 5461, 57344, 23783, 8192, 60854, 1724, 2340, 4681, 762, 62259, 46211, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 14478, 4096, 15213, 1724, 2184, 32768, 32768, 63195, 32768, 32768, 32768, 32768, 32768, 4681, 8192, 63897, 6189, 12288, 60854, 1927, 3640, 10922, 2322, 60074, 44470, 32768, 32768, 32768, 32768, 57344, 61440, 30720, 4247, 60074, 32768, 25683, 2340, 10922, 2776, 32768, 50641, 32768, 32768, 32768, 62805, 65295, 32768, 34882, 1560, 54613, 32768, 32768, 60854, 32768, 4681, 6553, 32768, 32768, 32768, 32768, 32768, 32768, 6553, 40960, 32768, 32768, 32768, 32768, 32768, 16384, 1092, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 6553, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 4105, 8411, 14043, 59753, 38010, 30427, 35498, 63975, 26340, 45597, 34257, 26054, 10922, 32768, 40960, 50014, 23177, 20480, 13653, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 64625, 32768, 64716, 22685, 35081, 61885, 10922, 36217, 50244, 10922, 32768, 32768, 32768, 54613, 32768, 32768, 64111, 32768, 49152, 14043, 43909, 3276, 11796, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 44470, 10922, 3072, 28539, 47331, 19660, 32768, 32768, 32768, 8192, 23405, 27306, 40960, 32768, 32768, 32768, 26810, 42358, 25980, 14336, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 40960, 16384, 2048, 64673, 58982, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 25869, 32768, 32768, 6553, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 65517, 63195, 32768, 32768, 8192, 32768, 32768, 32768, 32768, 54613, 32768, 32768, 32768, 32768, 32768, 32768, 8192, 32768, 49152, 49152, 35195, 2184, 42598, 32768, 64650, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 64275, 52792, 17527, 37981, 32768, 49152, 38936, 21909, 62805, 59915, 642, 32768, 21238, 10922, 32768, 57344, 32768, 32768, 37137, 4153, 62557, 8192, 57344, 963, 49152, 64543, 2730, 32768, 65445, 32768, 32768, 32768, 57344, 32768, 57344, 32768, 48118, 32768, 4681, 32768, 32768, 10922, 32768, 32768, 6553, 49152, 8192, 32768, 57344, 32768, 32768, 32768, 52713, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 25869, 53739, 10922, 10922, 57344, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 49152, 23665, 1503, 32768, 32768, 32768, 32768, 32768, 32768, 60854, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 24903, 1927, 12603, 16384, 54613, 15521, 3640, 5461, 16384, 14269, 30181, 32768, 46173, 1260, 32768, 32768, 32768, 819, 32768, 32768, 32768, 780, 32768, 32768, 63015, 780, 32768, 32768, 4681, 120, 47891, 54613, 26170, 31096, 6553, 10866, 32768, 16384, 32768, 4096, 16384, 4096, 16384, 32768, 64170, 2184, 37809, 16384, 49758, 7067, 54613, 32768, 62704, 622, 32768, 32768, 40049, 8495, 32768, 32768, 32768, 1638, 36864, 32768, 25746, 56301, 54613, 32768, 59392, 2048, 32768, 32768, 20827, 16224, 23898, 16384, 54613, 655, 32768, 32768, 298, 2048, 40960, 16384, 16384, 19660, 32768, 32768, 32768, 32768, 32768, 32768, 17294, 32768, 16384, 4681, 780, 1489, 49152, 32768, 57344, 992, 32768, 32768, 2048, 32768, 32768, 32768, 32768, 32768, 32768, 324, 18204, 10922, 16384, 32768, 10922, 32768, 1260, 32768, 54613, 1724, 32768, 32768, 32768, 762, 32768, 10922, 202, 51336, 49152, 32768, 32768, 65308, 32768, 32768, 54613, 65478, 32768, 32768, 56599, 64322, 10922, 32768, 63351, 51373, 16384, 32768, 64068, 65104, 32768, 32768, 32768, 61334, 32768, 32768, 32768, 63897, 54613, 32768, 61895, 65453, 34816, 47891, 32768, 63015, 32768, 32768, 16384, 58982, 10922, 60074, 63015, 64905, 53248, 2730, 39789, 57608, 32768, 10922, 63975, 65061, 32768, 32768, 32768, 64225, 32768, 32768, 63608, 30906, 32768, 49152, 936, 57344, 57344, 51492, 54613, 65316, 32768, 32768, 58982, 54411, 16384, 32768, 62805, 64443, 16586, 58982, 32768, 58982, 32768, 32768, 32768, 65054, 32768, 32768, 32768, 65024, 32768, 32768, 32768, 32768, 16384, 16384, 32768, 11221, 32768, 32768, 32768, 51492, 32768, 32768, 181, 16384, 16384, 32768, 32768, 64365, 32768, 32768, 5671, 303, 28114, 55, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 10922, 16153, 24029, 2048, 32768, 32768, 4096, 62805, 31597, 32768, 63488, 32768, 292, 32768, 6553, 18108, 65394, 32768, 17455, 10365, 32768, 32768, 32768, 32768, 32768, 65303, 32768, 32768, 2840, 8936, 64000, 13312, 64406, 39789, 6134, 6521, 17644, 32768, 40049, 62557, 38229, 32768, 63488, 65248, 49152, 32768, 48371, 20120, 62259, 60854, 30515, 6301, 32768, 32768, 32768, 32768, 32768, 8192, 32768, 32768, 49152, 10922, 28672, 13863, 32768, 36864, 27868, 655, 32768, 32768, 10922, 62557, 39514, 30037, 50244, 32768, 61440, 32768, 6188, 20369, 8192, 64111, 10507, 717, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 3640, 3400, 7141, 3276, 55407, 29540, 376, 29491, 5461, 32768, 57344, 29044, 10922, 34406, 2520, 2520, 32768, 36342, 8192, 4681, 61755, 18970, 574, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 40960, 32768, 10922, 32768, 41893, 1927, 19660, 32768, 32768, 62557, 34133, 32768, 62557, 32768, 32768, 32768, 53248, 32768, 32768, 32768, 47518, 167, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 64773, 16384, 62557, 32768, 60362, 32768, 24810, 19456, 15291, 61440, 25486, 62557, 32768, 321, 63015, 60074, 64046, 32768, 47566, 54613, 60854, 32768, 23405, 23945, 32768, 32768, 54613, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 34133, 32768, 10922, 32768, 33298, 19362, 17644, 32768, 32768, 59392, 34028, 32768, 61895, 32768, 32768, 32768, 43957, 49152, 16384, 62805, 21669, 2184, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 667, 64853, 16384, 61440, 28275, 385, 16384, 32768, 32768, 62805, 36217, 32768, 63015, 32768, 32768, 32768, 30720, 32768, 32768, 60854, 48834, 2832, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 30427, 60074, 32768, 32768, 16858, 1170, 27306, 32768, 2184, 63195, 32768, 32768, 62805, 32768, 8192, 32768, 32768, 32768, 32768, 64961, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 3864, 51492, 30687, 16384, 9830, 34739, 20295, 20852, 16384, 360, 64949, 40478, 1579, 2978, 19393, 50062, 55705, 10922, 29985, 32768, 24576, 49152, 48202, 11734, 10922, 10922, 4468, 618, 4681, 6553, 6553, 8192, 54613, 1129, 29571, 63811, 668, 65381, 31054, 9830, 32768, 32768, 32768, 32768, 32768, 49152, 4681, 16384, 49152, 32768, 64304, 32768, 32768, 32768, 1396, 537, 10922, 32768, 16384, 32768, 762, 32768, 4096, 86, 32768, 24, 992, 2184, 819, 5461, 14307, 1724, 2978, 3276, 6553, 6553, 3640, 4681, 3276, 5461, 3640, 5461, 4096, 618, 414, 3276, 59830, 1724, 4681, 6553, 6553, 16384, 32768, 8192, 10922, 32768, 32768, 32768, 28672, 32768, 54613, 47014, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 14336, 16384, 8088, 54613, 56599, 65080, 42130, 289, 32768, 10922, 32768, 32768, 32768, 45056, 32768, 32768, 64111, 20753, 16384, 39547, 862, 64853, 17164, 22820, 1927, 4646, 10128, 40504, 32768, 32768, 54613, 64853, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 3640, 4681, 32768, 6553, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 4681, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 420, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 49152, 32768, 54613, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 59321, 655, 4311, 8192, 35623, 63080, 499, 14417, 44718, 19551, 5782, 28398, 32768, 10922, 16384, 32768, 16384, 1724, 19660, 4681, 32768, 16384, 10922, 42130, 6553, 5461, 57344, 2520, 32768, 32768, 32768, 32768, 32768, 1927, 5461, 32768, 2340, 7399, 5782, 4681, 18311, 37969, 32768, 60854, 6553, 6553, 1170, 16384, 183, 287, 16384, 16948, 4681, 5461, 1927, 16384, 3276, 32768, 32768, 32768, 32768, 32768, 10922, 655, 32768, 352, 67, 61, 504, 3640, 1581, 885, 16384, 2573, 41807, 18204, 211, 337, 512, 409, 188, 32768, 606, 118, 504, 436, 420, 242, 1927, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 65529, 9830, 32768, 32768, 2184, 32768, 38725, 992, 58315, 62557, 55898, 64275, 65301, 65477, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 57344, 38725, 10922, 48188, 31182, 42130, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 57344, 32768, 65384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 57344, 38229, 1057, 54613, 48496, 32768, 54613, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 2730, 32768, 32768, 6553, 63351, 43978, 10922, 63015, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 30965, 37788, 17079, 32768, 1927, 32768, 537, 6553, 414, 22, 32768, 32768, 32768, 32768, 32768, 4096, 1890, 32768, 32768, 52792, 5782, 8192, 32768, 32768, 16384, 32768, 32768, 32768, 40960, 32768, 32768, 1114, 64046, 37137, 32768, 61440, 5461, 7970, 57028, 9132, 15803, 64417, 16384, 420, 2730, 26553, 55898, 2184, 10922, 65271, 8192, 40960, 16384, 32768, 49152, 32768, 4681, 16384, 352, 54613, 936, 16384, 32768, 2048, 1560, 16384, 21732, 32768, 32768, 32768, 10922, 394, 47190, 49152, 6553, 32768, 4681, 4096, 32768, 32768, 32768, 32768, 3640, 32768, 16384, 32768, 32768, 32768, 2730, 32768, 40960, 16384, 10922, 32768, 3276, 655, 103, 1489, 1489, 3276, 10922, 2340, 10922, 45875, 57116, 2340, 40960, 2978, 6553, 4681, 2184, 504, 618, 16384, 13653, 5461, 32768, 8192, 3640, 32768, 32768, 32768, 23405, 32768, 16384, 32768, 32768, 32768, 18022, 6553, 18521, 1820, 8192, 32768, 512, 65291, 53601, 9287, 40528, 32768, 65061, 32768, 54613, 5461, 55366, 16384, 20024, 30947, 58982, 32768, 32768, 32768, 63488, 32768, 16384, 32768, 53248, 32768, 32768, 54613, 60854, 63258, 25057, 40960, 64478, 32768, 33792, 38684, 53521, 1024, 30262, 32768, 32768, 5461, 64893, 60074, 61603, 60717, 18904, 36864, 62805, 32768, 63608, 8192, 61755, 180, 16384, 32768, 60074, 32768, 32768, 32768, 53248, 19660, 13492, 2184, 11702, 2048, 744, 55224, 40960, 43994, 47616, 16384, 65061, 32768, 49152, 2048, 24219, 32768, 32768, 32768, 61440, 32768, 32768, 101, 47566, 32768, 32768, 32768, 60074, 32768, 32768, 32768, 8192, 32768, 32768, 32768, 27306, 32768, 32768, 8192, 55146, 1424, 62259, 140, 32768, 49152, 32768, 32768, 10922, 32768, 32768, 2448, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 6553, 32768, 32768, 32768, 3276, 32768, 16384, 64111, 4096, 27890, 58412, 32768, 32768, 32768, 32768, 1927, 51492, 32768, 55296, 54272, 32768, 6553, 10922, 32768, 61067, 9972, 6553, 32768, 25746, 32768, 32768, 271, 18793, 45317, 40478, 41842, 32768, 61440, 37809, 10922, 1001, 1453, 25057, 63351, 32768, 32768, 10137, 61895, 55978, 52861, 32768, 1512, 32768, 32768, 58982, 32768, 1638, 49152, 32768, 32768, 8192, 32768, 32768, 32768, 64590, 60074, 16384, 2730, 2184, 32768, 10922, 35693, 3640, 50998, 26624, 49152, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 32768, 32768, 32768, 32768, 32768, 3640, 15360, 2908, 468, 1092, 1365, 368, 2184, 27525, 31958, 57272, 57344, 1024, 1129, 744, 2184, 260, 31759, 35617, 188, 546, 4681, 16384, 840, 16384, 32768, 42850, 32768, 32768, 32768, 32768, 32768, 32768, 6553, 38229, 32768, 3276, 1489, 32768, 5461, 46734, 16783, 54613, 64388, 32768, 32768, 32768, 32768, 6553, 14689, 50743, 10922, 54613, 32768, 32768, 32768, 16384, 10922, 58088, 32768, 32768, 32768, 32768, 32768, 58982, 9102, 55545, 256, 50517, 49152, 2318, 744, 49152, 51118, 8673, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 330, 32768, 32768, 32768, 32768, 3276, 6553, 44110, 14894, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 42477, 32768, 32768, 32768, 32768, 32768, 61440, 5461, 4681, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 51672, 53248, 5461, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 2520, 32768, 23405, 32768, 63015, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 53248, 29288, 24733, 32768, 32768, 32768, 32768, 32768, 1213, 32768, 32768, 4096, 20024, 32768, 10922, 24576, 49152, 27306, 18062, 32768, 32768, 49152, 32768, 16384, 60074, 32768, 38804, 32768, 32768, 57344, 32768, 32768, 25796, 32768, 30746, 32768, 32768, 32768, 32768, 5833, 3808, 62805, 31543, 64443, 16384, 32768, 24576, 32768, 5941, 60269, 6642, 16384, 10922, 32768, 64046, 32768, 4732, 64950, 3680, 64322, 32768, 32768, 32768, 32768, 16384, 49152, 5541, 32768, 442, 32768, 32768, 32768, 32768, 32768, 6553, 32768, 57344, 32768, 32768, 64406, 32768, 32768, 26682, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 5461, 32768, 32768, 32768, 3276, 32768, 32768, 32768, 3463, 62520, 38128, 10922, 8192, 16384, 32768, 10922, 11950, 64608, 19324, 4681, 2048, 32768, 10922, 1927, 6323, 62805, 23609, 8192, 32768, 16384, 3640, 32768, 32768, 4096, 18652, 32768, 32768, 32768, 32768, 32768, 1820, 62557, 40892, 32768, 10922, 32768, 32768, 32768, 16384, 54613, 62259, 32768, 49152, 32768, 10922, 1213, 2416, 58088, 36301, 32768, 32768, 32768, 32768, 6553, 6079, 63715, 50176, 32768, 32768, 32768, 32768, 42477, 4640, 64512, 51326, 10190, 41590, 32768, 14456, 32768, 8374, 32768, 25486, 32768, 32768, 32768, 32768, 53248, 15034, 64791, 702, 22043, 32768, 32768, 58982, 32768, 520, 64111, 30996, 32768, 32768, 32768, 32768, 32768, 8623, 60854, 44797, 32768, 32768, 32768, 32768, 16384, 3510, 62259, 26526, 32768, 32768, 32768, 32768, 32768, 3276, 49152, 46631, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 2730, 16384, 32768, 21768, 28262, 42598, 1024, 43567, 41183, 9703, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 10922, 32768, 32768, 32768, 618, 55, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 54613, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 9, 16384, 32768, 32768, 5461, 11702, 35498, 2340, 40960, 32768, 32768, 10922, 23569, 63537, 46031, 32768, 4681, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 16384, 32768, 2520, 32768, 32768, 32768, 32768, 32768, 32768, 5461, 32768, 32768, 546, 29407, 36128, 1129, 16384, 32768, 6553, 58514, 41472, 60074, 45056, 3640, 16384, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 952, 42130, 29719, 3640, 32768, 32768, 32768, 54613, 10329, 18997, 55730, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 60854, 5509, 32768, 32768, 1467, 15595, 26425, 6858, 54613, 49152, 32768, 65154, 58799, 29449, 52361, 585, 2978, 32768, 32768, 32768, 10922, 32768, 5461, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 60074, 32768, 32768, 28398, 16384, 33450, 3640, 3640, 16384, 1310, 57344, 44986, 65211, 30468, 32768, 57344, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 111, 32768, 32768, 26, 489, 30310, 1927, 32768, 32768, 32768, 60074, 61782, 36688, 45618, 6553, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 992, 40049, 32768, 10922, 32768, 32768, 32768, 63488, 48128, 57764, 9400, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 1638, 32768, 32768, 32768, 32768, 6553, 32768, 18970, 60854, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 2048, 32768, 32768, 32768, 2730, 32768, 32768, 32768, 32768, 32768, 32768, 221, 2048, 3640, 32768, 10922, 4681, 32768, 2184, 32768, 8192, 32768, 16384, 65042, 27329, 58206, 58982, 32768, 489, 6553, 8192, 10922, 32768, 3640, 32768, 4681, 8192, 32768, 2520, 10922, 1310, 22, 32768, 32768, 32768, 6553, 16384, 16384, 32768, 32768, 16384, 32768, 10922, 32768, 32768, 16384, 16384, 54613, 16384, 32768, 32768, 10922, 16384, 32768, 16384, 32768, 8192, 32768, 32768, 32768, 32768, 32768, 8192, 32768, 32768, 32768, 3640, 2184, 3276, 8192, 6553, 10922, 289, 16384, 16384, 16384, 32768, 52364, 10922, 8192, 6553, 10922, 32768, 10922, 3276, 25486, 8192, 32768, 4681, 32768, 32768, 16384, 32768, 32768, 1170, 32768, 32768, 32768, 1820, 32768, 32768, 1321, 29949, 32768, 12873, 49152, 32768, 10922, 62644, 63704, 51441, 42028, 8192, 32768, 32768, 49152, 32768, 10922, 60074, 60074, 32768, 56190, 10337, 30801, 32085, 35442, 32768, 32768, 32768, 32768, 6553, 32768, 5461, 2978, 55345, 40960, 2978, 2006, 19660, 10922, 65318, 62813, 22685, 10315, 32768, 32768, 4681, 32768, 32768, 63811, 16384, 2978, 58982, 936, 54613, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 1724, 32768, 32768, 2053, 45202, 4096, 655, 32768, 49152, 16384, 65350, 62679, 53086, 56349, 655, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 8192, 38725, 32768, 16384, 32768, 32768, 32768, 34588, 32768, 65447, 30285, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 546, 40309, 32768, 2978, 32768, 16384, 78, 59814, 58750, 39666, 22635, 32768, 32768, 8192, 32768, 58982, 24576, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 98, 16384, 1057, 32768, 32768, 16384, 32768, 2184, 32768, 4096, 10922, 32768, 16384, 32768, 12773, 16384, 16384, 32768, 32768, 32768, 10922, 32768, 32768, 4096, 32768, 16384, 10922, 32768, 2048, 32768, 10922, 32768, 32768, 2520, 32768, 32768, 146, 21014, 10922, 2184, 57344, 32768, 32768, 65428, 55786, 22648, 47966, 4096, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 6553, 32768, 936, 1024, 287, 78, 26810, 2730, 4096, 840, 4096, 3640, 63412, 58993, 14321, 58863, 8192, 6553, 32768, 1927, 555, 910, 2520, 2520, 6553, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 1489, 32768, 32768, 7479, 19475, 6553, 4681, 49152, 49152, 32768, 59164, 49226, 7154, 51543, 1424, 99, 1927, 32768, 32768, 64225, 32768, 2340, 327, 32768, 32768, 32768, 32768, 32768, 64716, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 65365, 32768, 32768, 32768, 32768, 32768, 62259, 33630, 36342, 51899, 24576, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49082, 13198, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 7561, 54613, 32768, 8192, 32768, 32768, 32768, 60074, 15291, 4834, 6826, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 1724, 16384, 32768, 16384, 32768, 32768, 28, 41807, 32768, 50641, 64599, 32768, 1560, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 63351, 32768, 91, 6553, 3640, 16384, 618, 15018, 32768, 3640, 32768, 32768, 40, 54613, 45056, 16384, 2520, 48, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 16384, 32768, 10922, 16384, 32768, 32768, 32768, 10922, 32768, 32768, 49152, 32768, 32768, 32768, 6553, 32768, 54613, 64220, 16384, 32768, 16384, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 180, 16384, 5461, 5461, 2520, 6553, 32768, 10922, 2184, 16384, 32768, 10922, 8192, 6553, 4681, 8192, 16384, 8192, 3640, 6553, 10922, 32768, 5461, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 64365, 16384, 32768, 32768, 32768, 474, 32768, 32768, 32768, 60074, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 65131, 11776, 38139, 19288, 24087, 34406, 42944, 38338, 25007, 53959, 3529, 43235, 47331, 2978, 32768, 64046, 65191, 32768, 30288, 10594, 48962, 42449, 30294, 24162, 1497, 52213, 42432, 29242, 4681, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 16384, 1927, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 504, 32768, 16384, 32768, 57344, 32768, 32768, 1129, 31744, 184, 32768, 32768, 431, 8192, 6553, 32768, 768, 574, 630, 936, 799, 762, 606, 963, 780, 682, 4681, 181, 32768, 32768, 32768, 32768, 32768, 3640, 1927, 3640, 1927, 3640, 3640, 32768, 32768, 32768, 32768, 32768, 1820, 32768, 32768, 32768, 179, 250, 32768, 63195, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 6553, 297, 32768, 32768, 32768, 963, 992, 1489, 1310, 1092, 885, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 442, 32768, 32768, 24, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 65131, 63161, 32768, 32768, 32768, 2730, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 129, 4681, 32768, 32768, 58514, 32768, 2978, 16384, 39739, 32055, 25600, 34028, 36310, 49152, 32768, 32768, 64046, 49152, 655, 32768, 11826, 32768, 16384, 40960, 32768, 32768, 32768, 32768, 32768, 62557, 16384, 65481, 61921, 26520, 11982, 56151, 64225, 50244, 35219, 34, 7899, 14503, 7829, 21330, 37908, 16384, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 24903, 32768, 32768, 32768, 7586, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 9076, 13306, 25884, 32768, 468, 32768, 32768, 32768, 4681, 2048, 32768, 16384, 32768, 32768, 32768, 5461, 512, 32768, 32768, 54613, 173, 10922, 16384, 41224, 37340, 37319, 29719, 21425, 6553, 32768, 32768, 585, 32768, 2730, 32768, 57344, 436, 4681, 10922, 2730, 436, 32768, 32768, 712, 49152, 16384, 65477, 54100, 2340, 45273, 204, 11796, 10287, 300, 17347, 341, 393, 64628, 1638, 65136, 381, 32768, 32768, 18204, 496, 9102, 24975, 2520, 6553, 6553, 32768, 292, 38519, 49152, 32768, 16384, 204, 32768, 32768, 59753, 1310, 32768, 32768, 32768, 1927, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 315, 32768, 32768, 963, 151, 1024, 963, 4818, 910, 963, 32768, 32768, 64939, 32768, 45875, 32768, 32768, 32768, 32768, 6553, 10922, 32768, 11342, 32768, 474, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 230, 32768, 32768, 32768, 62727, 6553, 22528, 32768, 19660, 32768, 32768, 32768, 39069, 8192, 23405, 32768, 32768, 32768, 32768, 780, 39852, 16384, 9972, 54784, 62805, 3640, 28672, 41170, 45465, 33938, 29206, 32768, 43194, 32768, 32768, 32768, 58088, 5461, 27306, 32768, 62557, 32768, 32768, 32768, 60854, 16384, 22685, 32768, 32768, 32768, 63488, 65034, 36800, 57211, 9906, 701, 32768, 8146, 65032, 32768, 20093, 62621, 45251, 49152, 58982, 32768, 32768, 32768, 61261, 16384, 27306, 32768, 32768, 32768, 32768, 32768, 59753, 10922, 21065, 32768, 32768, 32768, 32768, 2340, 1820, 32768, 32768, 32768, 32768, 32768, 32768, 289, 3276, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 28220, 63082, 44632, 7745, 31753, 3400, 32768, 45875, 4747, 32768, 32768, 32768, 32768, 32768, 256, 18970, 39789, 54613, 35435, 58982, 4411, 12873, 30653, 31311, 40711, 20083, 40257, 55109, 32768, 32768, 489, 14456, 37714, 32768, 49152, 32768, 32768, 8192, 910, 4428, 3357, 32768, 1489, 32768, 8192, 65336, 30415, 13153, 56672, 399, 57502, 1424, 1003, 53677, 682, 36722, 52713, 2184, 32768, 32768, 32768, 32768, 32768, 6553, 2340, 5461, 2520, 6553, 6553, 32768, 32768, 32768, 15150, 63897, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 6553, 4096, 32768, 32768, 32768, 6553, 10922, 512, 16384, 910, 32768, 910, 24029, 1129, 992, 885, 862, 32768, 32768, 4096, 60074, 32768, 5461, 4096, 8192, 32768, 49152, 32768, 25721, 19660, 32768, 489, 32768, 32768, 8192, 4681, 54452, 32768, 32768, 32768, 32768, 32768, 60854, 32768, 43453, 6553, 13863, 1585, 15090, 762, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 2438, 1129, 18449, 65243, 26728, 62805, 35089, 5324, 36128, 33548, 23911, 27033, 30427, 60386, 49152, 32768, 54613, 42130, 58982, 4681, 62259, 32768, 32768, 54613, 32768, 6553, 32768, 10922, 32768, 63195, 54613, 65460, 65492, 58199, 21856, 6360, 58343, 32768, 17787, 2800, 9175, 14004, 2397, 19624, 1404, 32768, 32768, 32768, 63897, 32768, 256, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 58982, 63260, 32768, 8192, 10922, 32768, 32768, 60854, 36864, 4096, 32768, 32768, 32768, 32768, 64929, 32768, 2184, 32768, 32768, 32768, 22573, 4681, 32768, 54613, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 20480, 16384, 32768, 32768, 27306, 6553, 32768, 32768, 32839, 24082, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 23911, 3276, 47331, 1638, 10922, 32768, 64111, 19660, 25383, 32768, 32768, 32768, 32768, 1820, 57040, 41779, 50127, 19470, 61895, 7970, 2978, 18311, 35002, 28539, 25182, 20852, 60074, 32768, 32768, 50790, 16246, 28248, 8561, 4096, 64755, 1365, 2340, 8192, 33630, 61440, 63122, 1560, 24576, 32768, 65067, 39256, 13848, 46984, 1602, 59270, 10649, 8664, 42130, 390, 19894, 60013, 20480, 32768, 3640, 32768, 32768, 32768, 6553, 10922, 5782, 2184, 38725, 2048, 2978, 32768, 32768, 32768, 12258, 32768, 32768, 32768, 32768, 32768, 32768, 45875, 12014, 6553, 60854, 2048, 4681, 32768, 32768, 32768, 16384, 32768, 496, 32768, 16384, 32768, 963, 31727, 7839, 992, 10142, 606, 6553, 32768, 16384, 32768, 52251, 32768, 32768, 32768, 32768, 32768, 32768, 60854, 9530, 6553, 6870, 1560, 2520, 32768, 7606, 64111, 58596, 32768, 32768, 32768, 32768, 32768, 1213, 49152, 19894, 49152, 16948, 1724, 4681, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 325, 2184, 54613, 1216, 32419, 60854, 595, 7192, 32768, 2048, 32768, 29435, 32768, 37809, 32768, 32768, 60074, 2340, 13863, 33450, 32768, 32768, 32768, 32768, 32768, 1512, 32768, 6144, 32768, 32768, 32768, 65275, 65243, 16384, 62818, 6553, 57344, 32768, 7561, 61635, 6553, 11000, 34292, 9242, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 8192, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 3640, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 4096, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 229, 3276, 54613, 10922, 39245, 7447, 2730, 5461, 32768, 32768, 32768, 32768, 32768, 63015, 32768, 4096, 1638, 32768, 40960, 22685, 4681, 49152, 49152, 10922, 49152, 1724, 32768, 32768, 1310, 50641, 63195, 63897, 51075, 2234, 62733, 2808, 53186, 819, 16568, 34676, 728, 780, 8822, 1560, 32768, 32768, 32768, 32768, 32768, 3640, 14894, 12822, 20024, 28672, 6553, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 57344, 32768, 55637, 61802, 9132, 26585, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 546, 32768, 32768, 32768, 1424, 6301, 3996, 4551, 1260, 8822, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 64572, 5461, 60074, 4039, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 60854, 61440, 58088, 60074, 15798, 51336, 32768, 32768, 57344, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 574, 16384, 32768, 32768, 32271, 63138, 37137, 8192, 32768, 32768, 32768, 32768, 32768, 37236, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 60854, 63608, 61906, 17020, 5309, 2048, 60362, 23623, 11003, 4096, 50823, 55, 1927, 1024, 1489, 32768, 32768, 49152, 32768, 32768, 32768, 16384, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 6553, 32768, 2184, 3276, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 41807, 32768, 32768, 32768, 1724, 32768, 32768, 32768, 32768, 32768, 60854, 32768, 38936, 18521, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 25486, 6596, 32768, 32768, 32768, 2048, 10922, 32768, 32768, 32768, 32768, 32768, 4096, 2520, 32768, 32768, 44032, 1820, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 6553, 32768, 32768, 32768, 5461, 12908, 16384, 10922, 32768, 4681, 32768, 32768, 1820, 32768, 16384, 32768, 6870, 585, 5564, 799, 3091, 496, 564, 43923, 6858, 3561, 53007, 5461, 32768, 885, 32768, 32768, 63015, 910, 31507, 14894, 44626, 3171, 6553, 32768, 32768, 32768, 32768, 32768, 57344, 697, 32768, 32768, 60074, 32768, 32768, 32768, 45056, 1489, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 585, 32768, 32768, 32768, 1260, 1092, 1129, 22166, 1129, 1024, 32768, 32768, 177, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 21370, 528, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 399, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 48496, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 2520, 32768, 32768, 32768, 41807, 49152, 32768, 2340, 32768, 32768, 32768, 32768, 32768, 54613, 32768, 32768, 32768, 32768, 32768, 32768, 60074, 57344, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 61895, 32768, 49152, 64893, 4274, 61440, 54613, 58982, 2978, 32768, 64322, 32768, 32768, 32768, 62557, 32768, 32768, 32768, 60074, 16384, 32768, 32768, 32768, 57344, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 5379, 49152, 32768, 58982, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 35002, 11319, 23013, 595, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 4681, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 151, 4681, 32768, 12528, 28584, 63015, 51089, 155, 32768, 4681, 32768, 32768, 32768, 63488, 32768, 32768, 2730, 32768, 49152, 19660, 32768, 54613, 12072, 29855, 32768, 4096, 32768, 32768, 1927, 16384, 32768, 59864, 54910, 10437, 58855, 9990, 59132, 5461, 8359, 42030, 762, 34510, 56661, 10922, 65229, 32768, 32768, 32768, 32768, 2520, 41108, 10240, 2520, 9830, 20316, 6553, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 65348, 32768, 7926, 25348, 49152, 65141, 40989, 78, 32768, 32768, 32768, 16384, 32768, 528, 32768, 8192, 32768, 862, 1057, 4468, 1129, 780, 33684, 2730, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 34734, 55705, 32768, 27351, 3640, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 61440, 32768, 23430, 55296, 32768, 64734, 3602, 762, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 2520, 32768, 32768, 49152, 44904, 32768, 9955, 55377, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 65104, 65402, 36278, 48896, 62557, 65061, 65015, 19853, 61051, 963, 64853, 30947, 32768, 54613, 275, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 35126, 4096, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 37809, 32768, 32768, 32768, 344, 2978, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 1724, 32768, 32768, 32768, 32768, 697, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16748, 54613, 32768, 63195, 56974, 104, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 43115, 49152, 32768, 8192, 35146, 52662, 32768, 32768, 8192, 32768, 32768, 32768, 32768, 32768, 48, 8936, 32768, 63195, 63897, 63488, 35888, 16384, 32768, 32768, 32768, 32768, 32768, 62976, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 14043, 57626, 32768, 6553, 32768, 32768, 1927, 58982, 16384, 58982, 60362, 11776, 60306, 8791, 21348, 10142, 30984, 52513, 992, 22620, 63744, 49152, 32768, 32768, 32768, 32768, 63975, 3640, 16492, 45641, 8936, 64515, 18269, 1124, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 65255, 2978, 32768, 32768, 25447, 41, 32768, 32768, 32768, 32768, 32768, 618, 32768, 32768, 32768, 1424, 3389, 1365, 1129, 1424, 1724, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 19660, 60854, 32768, 1365, 39052, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 49152, 1927, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 66, 8192, 32768, 49152, 26065, 32768, 47014, 1560, 32768, 32768, 32768, 32768, 32768, 62259, 32768, 32768, 32768, 32768, 60854, 32768, 32768, 58982, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 60074, 32768, 65344, 65167, 54255, 15266, 25459, 65129, 63351, 30553, 7845, 131, 17840, 40151, 55627, 1724, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 6553, 32768, 32768, 32768, 16384, 6553, 32768, 32768, 32768, 32768, 32768, 227, 8192, 32768, 32768, 52043, 63351, 14777, 32768, 32768, 32768, 32768, 32768, 32768, 53328, 32768, 32768, 3932, 24576, 936, 32768, 49152, 32768, 32768, 10922, 36044, 57813, 32768, 32768, 1489, 60074, 49152, 64905, 58500, 7835, 39789, 712, 7669, 606, 1742, 48616, 618, 136, 36559, 6553, 54613, 32768, 32768, 32768, 32768, 6553, 3640, 6553, 3640, 3640, 6553, 32768, 16384, 32768, 32768, 7561, 32768, 32768, 32768, 32768, 1310, 1170, 32768, 60854, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 574, 32768, 32768, 32768, 1724, 1638, 1170, 1092, 1092, 992, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 436, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 62259, 28987, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 58982, 52662, 32768, 32768, 39069, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 65087, 60074, 16384, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 60074, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 60074, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 39917, 32768, 32768, 32768, 2457, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 24112, 16384, 22685, 32768, 668, 32768, 32768, 32768, 3640, 10922, 32768, 16384, 2730, 32768, 32768, 8561, 372, 32768, 49152, 38229, 7123, 2730, 16384, 32768, 555, 32768, 32768, 25869, 34053, 32768, 32768, 16384, 3276, 16384, 32768, 32768, 630, 32768, 10922, 32768, 1638, 32768, 64823, 17749, 29647, 32768, 64871, 45918, 19894, 63427, 606, 55541, 885, 13212, 52030, 41453, 15331, 63219, 4681, 63444, 595, 32768, 32768, 32768, 630, 41642, 7220, 3640, 3640, 6553, 32768, 8842, 22235, 32768, 15777, 35498, 1170, 32768, 32768, 62050, 390, 32768, 32768, 32768, 51, 32768, 32768, 58982, 1724, 32768, 32768, 32768, 595, 32768, 32768, 4096, 55, 744, 1057, 13349, 936, 1057, 32768, 32768, 2978, 32768, 16384, 32768, 32768, 32768, 32768, 1638, 744, 32768, 10922, 63015, 489, 32768, 32768, 32768, 9830, 32768, 27306, 62259, 431, 32768, 32768, 32768, 6553, 32768, 32768, 32768, 45875, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 402, 1820, 49152, 49152, 34598, 64823, 30037, 4170, 64046, 2048, 32768, 32768, 32768, 56599, 62557, 32768, 32768, 10922, 32768, 8192, 32768, 32768, 32768, 16384, 32768, 8192, 32768, 32768, 32768, 64046, 57344, 65154, 65205, 35693, 59698, 20480, 58972, 64170, 1820, 62626, 528, 48371, 3861, 64807, 64406, 63195, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 4096, 1489, 32768, 10922, 32768, 49152, 32768, 32768, 468, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 4681, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 6553, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 5461, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 65377, 368, 32768, 32768, 32768, 1489, 175, 32768, 32768, 32768, 32768, 32768, 49, 1560, 54613, 60074, 53394, 63488, 43369, 20852, 54613, 64275, 4096, 10922, 4681, 62784, 32768, 32768, 381, 24576, 1489, 8192, 61440, 16384, 49152, 2340, 8192, 32768, 32768, 32768, 32768, 65205, 63249, 60105, 65342, 55898, 61603, 630, 19253, 32768, 42358, 65104, 885, 18382, 22528, 39161, 56360, 32768, 32768, 32768, 32768, 10922, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 27726, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 8192, 1820, 8192, 10922, 10922, 16384, 32768, 2520, 32768, 32768, 16384, 32768, 32768, 16384, 10922, 32768, 4681, 62146, 3640, 4096, 32768, 32768, 32768, 32768, 16384, 60854, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 6553, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 2520, 4681, 3640, 32768, 58982, 32768, 62, 19660, 32768, 10922, 54613, 49152, 32768, 54613, 32768, 32768, 10922, 32768, 2978, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 840, 32768, 32768, 32768, 16384, 54613, 64406, 55653, 41039, 378, 64046, 32768, 57650, 688, 431, 16951, 284, 32768, 16384, 16384, 49152, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 62025, 58982, 19114, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 4096, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 86, 22140, 18432, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 264, 85, 12288, 32768, 32768, 32768, 32768, 16384, 6553, 32768, 57775, 32768, 32768, 8192, 8936, 32768, 2978, 32768, 28672, 32768, 58982, 32768, 32768, 151, 3640, 32768, 2978, 32768, 32768, 32768, 32768, 8192, 2029, 54022, 40478, 32768, 32768, 32768, 64046, 65255, 32768, 64823, 10922, 65306, 32768, 32768, 65383, 32768, 32768, 10922, 22118, 32768, 32768, 32768, 32768, 32768, 1927, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 4681, 32768, 48883, 32768, 32768, 32768, 32768, 32768, 6553, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 6553, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 6553, 32768, 1724, 32768, 32768, 32768, 32768, 32768, 5461, 32768, 1638, 32768, 32768, 32768, 32768, 4681, 6615, 64599, 9032, 16384, 32768, 32768, 32768, 16384, 1213, 32768, 53547, 32768, 32768, 32768, 32768, 32768, 3276, 32768, 47891, 32768, 10922, 32768, 32768, 32768, 5461, 32768, 32768, 32768, 32768, 32768, 32768, 4681, 5461, 32768, 509, 60854, 32768, 32768, 32768, 32768, 1063, 49152, 44683, 32768, 57344, 32768, 32768, 10922, 436, 32768, 3640, 32768, 32768, 32768, 32768, 32768, 3276, 32768, 16086, 32768, 32768, 32768, 65368, 65283, 4096, 65061, 1820, 52672, 32768, 32768, 64478, 614, 436, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 4681, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 4681, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 6553, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 8192, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 1424, 4681, 49152, 32768, 46421, 32768, 10922, 8192, 36044, 33562, 32963, 27563, 33398, 60074, 32768, 32768, 7669, 32768, 32768, 963, 54613, 16384, 32768, 3640, 51492, 32768, 32768, 32768, 32768, 63195, 49152, 60074, 65054, 33423, 31334, 474, 16384, 32768, 1927, 32768, 16384, 3276, 1820, 32768, 1365, 936, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 16384, 32768, 10922, 10922, 32768, 32768, 10922, 10922, 10922, 32768, 32768, 32768, 32768, 6553, 16384, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 58982, 32768, 32768, 32768, 32768, 1927, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 326, 5461, 32768, 49152, 9604, 32768, 1820, 1129, 32768, 32768, 32768, 32768, 49152, 42130, 49152, 32768, 57344, 49152, 32768, 32768, 26731, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 65273, 45875, 49152, 58982, 32768, 63351, 32768, 45875, 19660, 237, 3640, 344, 60074, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 5461, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 1310, 32768, 32768, 32768, 528, 3640, 32768, 57344, 4024, 32768, 32768, 49152, 1560, 32768, 32768, 2340, 32768, 32768, 32768, 55705, 2340, 32768, 32768, 60854, 2730, 32768, 32768, 10, 16384, 16384, 32768, 32768, 3640, 32768, 6553, 32768, 32768, 32768, 16384, 63950, 16384, 32768, 61895, 63015, 1424, 62259, 4096, 19660, 2978, 10922, 32768, 55898, 431, 10922, 32768, 32768, 51, 8192, 32768, 27306, 1424, 32768, 32768, 32768, 32768, 32768, 32768, 60998, 414, 32768, 32768, 49152, 992, 32768, 32768, 60074, 682, 32768, 32768, 32768, 404, 32768, 32768, 32768, 992, 32768, 32768, 57626, 1820, 32768, 32768, 32768, 10922, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 520, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 46, 32768, 32768, 32768, 62557, 32768, 32768, 32768, 32768, 32768, 32768, 1927, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 6553, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 60074, 58982, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 61440, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 60074, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 2978, 32768, 32768, 32768, 32768, 2730, 32768, 32768, 32768, 32768, 32768, 118, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 63488, 32768, 273, 32768, 16384, 57344, 32768, 32768, 54613, 6553, 16384, 32768, 32768, 32768, 32768, 54613, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 762, 139, 32768, 32768, 32768, 32768, 1927, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 697, 62, 159, 546, 32768, 10922, 2048, 6553, 2978, 489, 32768, 1057, 546, 1365, 6553, 1560, 32768, 512, 762, 910, 3640, 10922, 137, 16384, 16384, 2184, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 47, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 4096, 32768, 32768, 32768, 32768, 32768, 2978, 32768, 32768, 32768, 32768, 32768, 32768, 63015, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 3640, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 10922, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 372, 16384, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 57344, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 50641, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 13902, 32768, 12457, 32768, 44775, 32768, 10922, 32768, 8192, 32768, 54272, 32768, 13896, 32768, 50471, 32768, 52402, 399, 1260, 49152, 14667, 32768, 110, 32768, 5461, 32768, 928, 32768, 24576, 32768, 35, 32768, 49987, 32768, 4778, 32768, 3212, 32768, 1489, 16384, 1365, 32768, 6553, 32768, 2340, 32768, 4096, 32768, 5285, 32768, 2730, 32768, 3432, 32768, 12288, 32768, 5524, 32768, 12, 32768, 210, 32768, 372, 32768, 10922, 32768, 60924, 32768, 62993, 32768, 62700, 32768, 63744, 32768, 61836, 32768, 63115, 32768, 62050, 32768, 64791, 32768, 61842, 32768, 61539, 32768, 39909, 1170, 59234, 32768, 64669, 32768, 65192, 32768, 64147, 32768, 63057, 62259, 2782, 32768, 58763, 32768, 42078, 4468, 65051, 32768, 63652, 32768, 62557, 32768, 64111, 32768, 42130, 32768, 32768, 32768, 10922, 54613, 316, 32768, 5461, 32768, 10922, 32768, 885, 32768, 25278, 32768, 38229, 32768, 55455, 32768, 65080, 32768, 63463, 32768, 64606, 32768, 64395, 32768, 65356, 32768, 64572, 32768, 61176, 32768, 64080, 32768, 52830, 32768, 61725, 32768, 60370, 32768, 65244, 32768, 58199, 32768, 65273, 32768, 58560, 32768, 42130, 32768, 65189, 32768, 61579, 32768, 64163, 32768, 64423, 32768, 64929, 32768, 65334, 32768, 49152, 32768, 42130, 32768, 53833, 32768, 65, 32768, 51356, 32768, 74, 32768, 29491, 32768, 32768, 32768, 32768, 31899, 30037, 24159, 32768, 242, 32768, 32768, 32768, 2520, 19660, 32507, 32768, 16384, 32768, 32768, 3640, 12743, 17183, 22528, 50014, 1560, 32768, 32768, 32768, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 2340, 27, 32768, 32768, 394, 54693, 16384, 24576, 54022, 24576, 20852, 24576, 12633, 11615, 24259, 32768, 19114, 1092, 4681, 16721, 6553, 3640, 3640, 6553, 3640, 9557, 7606, 1170, 32768, 2730, 32768, 32768, 8192, 67, 3185, 16830, 28, 61419, 862, 1213, 1883, 12373, 32768, 5461, 969, 1118, 14667, 32768, 11605, 1170, 173, 33260, 297, 1092, 4096, 1310, 862, 2184, 32768, 16384, 32768, 32768, 32768, 268, 16384, 574, 16384, 10922, 34588, 5461, 16384, 32768, 16384, 32768, 32768, 40960, 1310, 32768, 8192, 32768, 2520, 5461, 2340, 40960, 10922, 2048, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 1129, 32768, 32768, 16384, 2520, 32768, 32768, 32768, 58982, 32768, 32768, 32768, 35108, 60074, 32768, 32768, 32768, 32768, 32768, 32768, 5461, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 23405, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 58982, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 53248, 32768, 32768, 32768, 32768, 32768, 32768, 862, 489, 32768, 32768, 32768, 57344, 32768, 32768, 368, 42850, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 4096, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 40419, 64572, 38385, 4468, 25499, 3198, 32768, 6553, 11900, 16384, 32768, 32768, 32768, 32768, 49152, 32768, 19660, 10922, 3640, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 26810, 32768, 45745, 49152, 32768, 32768, 32768, 32768, 16384, 1638, 22809, 32768, 1927, 32768, 32768, 32768, 2520, 3640, 420, 2520, 3640, 2520, 2520, 3640, 2520, 3640, 19660, 16384, 32768, 32768, 32768, 32768, 21065, 1724, 46, 2048, 2184, 404, 595, 16384, 352, 39214, 50426, 64007, 668, 32768, 45875, 10601, 59753, 22685, 6553, 20480, 60074, 682, 24576, 40960, 60152, 28330, 2772, 25661, 49392, 40234, 64773, 341, 2184, 1927, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 42598, 32768, 4096, 32768, 32768, 5461, 54613, 32768, 35250, 24576, 32768, 992, 32768, 1129, 32768, 3640, 1578, 32768, 32768, 32768, 32768, 32768, 63351, 32768, 18639, 2978, 11731, 9830, 12471, 744, 12496, 32768, 58982, 63608, 32768, 32768, 32768, 32768, 65365, 16384, 31165, 55175, 51882, 25746, 35792, 1424, 32768, 32768, 36217, 57344, 61895, 36864, 65370, 885, 32768, 32768, 42130, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 32768, 49152, 32768, 32768, 32768, 49971, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 64940, 32768, 1912, 62557, 64853, 32768, 64111, 32768, 61440, 32768, 57344, 32768, 60074, 32768, 62259, 32768, 49152, 32768, 58514, 65285, 58982, 32768, 40049, 16384, 32768, 60074, 40960, 10922, 23405, 32768, 58982, 32768, 63798, 32768, 1328, 32768, 58982, 58982, 42780, 1260, 16384, 4681, 63488, 32768, 57344, 32768, 61440, 32768, 32768, 32768, 54613, 32768, 54613, 32768, 24576, 6553, 32768, 712, 18204, 24795, 32768, 32768, 32768, 32768, 32768, 32768, 45056, 19005, 4096, 61440, 2048, 2184, 32768, 26810, 6553, 33858, 32768, 32768, 32768, 32768, 32768, 8192, 18204, 56768, 4096, 60854, 1820, 2520, 32768, 4201, 32768, 19302, 32768, 32768, 32768, 32768, 3276, 2978, 32768, 10806, 3640, 60854, 1638, 3640, 1365, 49, 64572, 23248, 1927, 16384, 32768, 32768, 3640, 6553, 14894, 5561, 2340, 38725, 1489, 2340, 6553, 3640, 63975, 42780, 32768, 32768, 32768, 32768, 32768, 819, 21065, 8601, 2340, 14199, 1170, 4681, 682, 4778, 49152, 15927, 1820, 1424, 32768, 468, 2520, 8192, 13653, 18204, 1170, 28398, 1424, 4096, 32768, 32768, 60074, 4681, 32768, 32768, 32768, 4096, 32768, 2184, 38229, 4289, 3276, 60854, 1489, 2340, 697, 16384, 32768, 35717, 3276, 16384, 32768, 936, 32768, 2048, 27306, 8533, 4681, 47331, 2340, 5461, 32768, 5461, 32768, 51378, 32768, 32768, 32768, 32768, 32768, 682, 53426, 19290, 8192, 60854, 1638, 2520, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 1365, 54613, 5305, 4681, 60854, 2048, 4096, 32768, 2730, 62259, 20392, 32768, 32768, 32768, 32768, 60416, 7509, 2978, 16560, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 13023, 32768, 32768, 32768, 32768, 65410, 32768, 1024, 352, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 35195, 32768, 32768, 32768, 32768, 32768, 4681, 32768, 20852, 32768, 32768, 32768, 32768, 16384, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 977, 1713, 9830, 61302, 30808, 33447, 28456, 57734, 22989, 36804, 30084, 54613, 32768, 32768, 40960, 53703, 23309, 20218, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 642, 10922, 54613, 12603, 13349, 16384, 32768, 8192, 40960, 618, 32768, 32768, 799, 32768, 32768, 10922, 2520, 3640, 10922, 1724, 25486, 3276, 14336, 3640, 3640, 2520, 1638, 1260, 32768, 32768, 32768, 32768, 49753, 455, 14417, 4915, 2816, 13165, 1638, 3640, 32768, 425, 55237, 10922, 1820, 4681, 5461, 368, 52792, 32768, 10101, 16384, 35596, 16815, 2184, 10922, 1267, 32768, 10922, 32768, 3343, 32768, 4096, 520, 10922, 4681, 54613, 8192, 3640, 7680, 60074, 32768, 32768, 2048, 32768, 32768, 65424, 122, 32768, 1129, 61895, 32768, 32768, 32768, 54167, 32768, 1560, 8192, 16384, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 54067, 54613, 18256, 10922, 46369, 32768, 54613, 32768, 2978, 32768, 58982, 32768, 32768, 32768, 57344, 32768, 58982, 32768, 37173, 5461, 39789, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 54613, 36864, 32768, 54613, 32768, 57344, 32768, 62805, 54613, 5461, 10922, 58982, 32768, 49152, 32768, 32768, 60074, 50014, 32768, 46421, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 51492, 32768, 44187, 65024, 48787, 32768, 57344, 32768, 61895, 32768, 63715, 32768, 32768, 32768, 60854, 32768, 57344, 32768, 14894, 4681, 19660, 32768, 63715, 32768, 62805, 32768, 59392, 32768, 60854, 32768, 63975, 10922, 32768, 32768, 30427, 46080, 61067, 14043, 62805, 32768, 61895, 32768, 63351, 49152, 60362, 32768, 49152, 32768, 53521, 49152, 12119, 12429, 32768, 32768, 32768, 32768, 16384, 32768, 16384, 32768, 32768, 32768, 32768, 3640, 32768, 32768, 31948, 840, 32768, 16384, 40960, 34816, 9906, 62557, 21740, 49758, 26093, 6553, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 2542, 630, 36864, 16384, 15750, 5908, 6553, 312, 2340, 1592, 32768, 62259, 4062, 49152, 11210, 32768, 14894, 6553, 34588, 4096, 3276, 38010, 3640, 6553, 1724, 1638, 1365, 177, 32768, 32768, 32768, 32768, 32768, 93, 2978, 1260, 3640, 4792, 268, 6553, 248, 1638, 32768, 10922, 8192, 4056, 1685, 2520, 5461, 6553, 159, 1057, 10048, 1024, 330, 1560, 1213, 4681, 32768, 32768, 32768, 10922, 32768, 414, 32768, 16384, 32768, 32768, 32768, 33938, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 10922, 2730, 32768, 32768, 32768, 16384, 16384, 17347, 10922, 8192, 32768, 6553, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 618, 49152, 32768, 300, 24576, 32768, 32768, 32768, 16384, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 56433, 49152, 32768, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 57344, 32768, 64443, 32768, 32768, 32768, 32768, 5461, 54613, 10922, 32768, 32768, 32768, 49152, 10922, 32768, 3640, 61895, 819, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 385, 32768, 32768, 489, 56599, 49152, 40960, 32768, 32768, 32768, 32768, 1310, 56360, 6553, 32768, 32768, 32768, 31962, 60854, 32768, 61440, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 40, 32768, 32768, 4681, 9714, 32768, 16384, 32768, 54613, 16384, 32768, 32768, 9830, 5461, 32768, 32768, 32768, 32768, 32768, 24091, 2340, 29955, 144, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 47331, 25869, 1820, 36044, 32768, 2048, 61440, 30340, 32768, 61440, 32768, 32768, 32768, 32768, 20239, 10922, 64823, 19436, 812, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 3276, 32768, 49152, 10601, 16384, 57344, 28714, 11468, 7021, 3276, 54613, 60854, 19324, 32768, 49152, 32768, 2520, 2340, 21005, 7192, 3640, 36044, 54184, 1820, 6553, 3640, 1057, 1489, 32768, 32768, 32768, 32768, 54148, 122, 20218, 17408, 1724, 3188, 15974, 668, 8192, 1045, 32768, 61440, 7845, 39789, 15360, 431, 49152, 32768, 30195, 34784, 18568, 55839, 25010, 5976, 32768, 32768, 32768, 32768, 32768, 4096, 32768, 170, 32768, 16384, 64512, 16384, 32768, 54613, 24393, 9947, 27306, 819, 32768, 60854, 40960, 32768, 55705, 1092, 32768, 32768, 1489, 32768, 32768, 6553, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 60074, 32768, 25869, 62805, 16384, 58677, 9752, 1092, 19660, 32768, 32768, 61895, 25869, 32768, 62805, 32768, 49152, 32768, 57344, 49152, 32768, 60074, 31321, 121, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 38400, 2730, 32768, 32768, 32768, 60854, 36548, 32768, 63195, 32768, 32768, 32768, 32768, 6553, 54613, 54613, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 45875, 32768, 32768, 62805, 14070, 36864, 57734, 32768, 65419, 60854, 35027, 32768, 61895, 32768, 32768, 32768, 65413, 32768, 32768, 32768, 41870, 1310, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 5461, 32768, 32768, 40960, 28470, 1424, 24576, 32768, 32768, 60854, 32768, 32768, 63195, 32768, 63488, 32768, 1138, 32768, 49152, 65007, 24468, 103, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 32768, 42130, 63488, 10922, 60854, 33959, 1638, 36864, 32768, 1489, 60854, 53463, 32768, 63351, 32768, 32768, 32768, 32768, 32768, 32768, 63195, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 1638, 32768, 34753, 32768, 32768, 64512, 22798, 17209, 6036, 3640, 32768, 60854, 32768, 32768, 61895, 32768, 58982, 32768, 27355, 63811, 32768, 64543, 25988, 2184, 32768, 32768, 5461, 10922, 32768, 32768, 32768, 32768, 32768, 8192, 32768, 4096, 1129, 910, 40215, 6553, 1489, 10922, 32768, 32768, 12822, 6553, 11170, 4681, 10922, 32768, 60854, 6553, 2978, 840, 12170, 39, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 1057, 32768, 239, 63488, 58982, 2184, 27913, 22043, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 4681, 32768, 32768, 14336, 57344, 6553, 32768, 43453, 5461, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 15213, 60074, 49152, 57344, 32768, 1820, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 58982, 32768, 13974, 58982, 32768, 61895, 49152, 289, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 8192, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 2544, 63654, 40885, 10922, 5099, 19894, 46211, 4381, 43896, 38396, 13246, 58044, 56133, 12144, 8192, 40632, 35877, 40876, 3649, 37442, 51476, 27989, 63502, 2891, 4681, 32768, 32768, 32768, 8192, 40960, 32768, 630, 27972, 15254, 27306, 62501, 2978, 54613, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 315, 489, 32768, 32768, 32768, 32768, 32768, 174, 49152, 32768, 10922, 1761, 25486, 6553, 727, 795, 43938, 28283, 1092, 20480, 10922, 2048, 112, 82, 6553, 65371, 10922, 16384, 32768, 32768, 32768, 32768, 32768, 54613, 32768, 32768, 32768, 642, 32768, 1365, 32768, 32768, 16384, 38229, 38229, 16384, 25057, 45296, 3276, 32768, 1560, 45875, 16384, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 63195, 17969, 57344, 32768, 6553, 36044, 32768, 10922, 8768, 16384, 6858, 18824, 54613, 4681, 62557, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 57344, 32768, 58982, 54613, 8192, 32768, 40960, 10922, 32768, 32768, 49152, 43115, 32768, 32768, 28912, 45875, 28398, 1213, 23920, 33917, 31169, 63195, 32768, 32768, 32768, 16384, 63608, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 54613, 32768, 16384, 18432, 16384, 32768, 64673, 58982, 45875, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 61440, 32768, 32768, 8673, 32768, 58982, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 5619, 38385, 49055, 63015, 1129, 32768, 32768, 8192, 2048, 2340, 10922, 54613, 1170, 32768, 32768, 53833, 6371, 57344, 15291, 60854, 284, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 1820, 32768, 32768, 3640, 32768, 32768, 32768, 49152, 5782, 32768, 16384, 27726, 49152, 54613, 32768, 53833, 42598, 16384, 32768, 45875, 520, 10922, 17644, 8192, 1424, 32768, 32768, 32768, 1560, 32768, 49152, 62259, 334, 32768, 32768, 32768, 862, 28912, 14866, 697, 2340, 1129, 642, 4009, 23150, 32768, 6553, 5640, 468, 96, 404, 19660, 266, 1092, 25365, 431, 162, 32768, 32768, 2586, 1057, 910, 16384, 54613, 3640, 32768, 1724, 1365, 520, 32768, 32768, 12603, 7021, 489, 6553, 32768, 40049, 8192, 40960, 32768, 8192, 728, 32768, 1638, 1927, 32768, 2006, 44002, 32768, 32768, 32768, 32768, 89, 10922, 49152, 32768, 528, 32768, 32768, 32768, 5461, 32768, 32768, 32768, 57344, 32768, 32768, 62259, 59133, 32768, 32768, 60854, 32768, 32768, 32768, 32768, 32768, 54613, 10922, 32768, 65287, 32768, 32768, 58982, 8192, 49152, 58982, 57344, 32768, 32768, 32768, 32768, 6553, 32768, 32768, 32768, 54613, 32768, 32768, 6553, 14043, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 49152, 32768, 16384, 49152, 32768, 32768, 799, 61440, 1424, 3996, 10922, 32768, 61440, 32768, 32768, 3276, 32768, 53248, 32768, 49152, 32768, 32768, 27, 1927, 32768, 32768, 60854, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 6553, 6553, 10922, 16384, 44333, 60854, 35830, 64512, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 4681, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 63608, 32768, 32768, 32768, 32768, 32768, 2048, 63897, 13548, 16384, 13653, 32768, 16384, 32768, 32768, 32768, 18432, 53248, 47331, 32768, 5461, 49152, 61505, 47331, 11280, 21612, 34208, 43453, 16384, 32768, 4681, 2048, 46631, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 9011, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 2340, 32768, 32768, 32768, 32768, 32768, 32768, 7561, 3723, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 62482, 32768, 8192, 1310, 32768, 10922, 1798, 59528, 334, 46892, 58982, 32768, 62905, 2586, 32768, 32768, 16384, 16384, 32768, 16384, 61895, 32768, 32768, 58982, 4096, 32768, 32768, 49152, 32768, 32768, 16384, 32768, 744, 16384, 27306, 4096, 49152, 32768, 53248, 4468, 37908, 60074, 32768, 32768, 54613, 10922, 8192, 49152, 29466, 32768, 32768, 32768, 32768, 32768, 8192, 5461, 29075, 8936, 32768, 32768, 32768, 32768, 32768, 32768, 1424, 32768, 8192, 6553, 32768, 32768, 3640, 5461, 59392, 65191, 32768, 54613, 32768, 32768, 16384, 6553, 59392, 32768, 32768, 32768, 32768, 32768, 61895, 45702, 33149, 44110, 38936, 31430, 16384, 32768, 6553, 12822, 20316, 32768, 32768, 32768, 32768, 32768, 65236, 54613, 63488, 32768, 16384, 54613, 16384, 32768, 16384, 32768, 8192, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 1213, 9830, 16384, 49152, 16384, 32768, 4681, 32768, 5213, 32768, 64736, 32768, 32768, 16384, 32768, 32768, 32768, 8192, 8936, 32768, 32768, 32768, 32768, 32768, 63488, 32768, 32768, 6553, 32768, 32768, 61440, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 4866, 32768, 4681, 12170, 38229, 32768, 16384, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 64275, 32768, 32768, 32768, 32768, 2730, 28735, 29749, 32768, 32768, 32768, 32768, 32768, 32768, 64235, 32768, 32768, 32768, 10922, 32768, 24, 19660, 2730, 10834, 32768, 16384, 32768, 32768, 32768, 10922, 32768, 52802, 32768, 32768, 32768, 32768, 32768, 564, 54613, 12476, 32768, 32768, 32768, 32768, 277, 5281, 64275, 26612, 10922, 32768, 32768, 32768, 5461, 728, 51672, 14818, 8192, 32768, 16384, 32768, 111, 25, 58982, 3378, 32768, 32768, 32768, 32768, 32768, 1927, 63488, 3580, 32768, 32768, 32768, 32768, 32768, 1820, 54613, 1560, 32768, 2048, 2730, 32768, 7168, 24576, 8192, 2378, 4096, 50641, 51200, 64878, 58982, 32768, 16384, 3510, 54613, 16384, 32768, 16384, 38912, 8192, 32768, 6018, 38229, 16384, 32768, 1170, 10922, 2520, 64512, 1667, 49152, 12288, 24576, 32768, 49152, 13284, 62405, 14349, 6553, 32768, 10922, 32768, 1927, 6671, 64925, 24302, 32768, 32768, 32768, 32768, 32768, 6553, 63715, 9156, 32768, 32768, 32768, 32768, 32768, 4929, 64059, 23969, 16384, 16384, 32768, 16384, 8468, 32768, 49152, 61440, 32768, 60074, 49152, 5461, 16384, 2155, 58982, 25311, 32768, 32768, 32768, 32768, 51394, 1445, 44981, 44799, 56599, 14689, 32768, 32768, 2978, 1616, 60854, 11215, 537, 54613, 32768, 4096, 32768, 32768, 57344, 23552, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 287, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16839, 32768, 32768, 32768, 32768, 32768, 3932, 61440, 32768, 16384, 32768, 16384, 32768, 32768, 32768, 65427, 65015, 32768, 32768, 32768, 32768, 32768, 16384, 61895, 597, 32768, 32768, 32768, 32768, 895, 16384, 16384, 32768, 40960, 10922, 32768, 49152, 32768, 32768, 32768, 64365, 32768, 32768, 32768, 32768, 12629, 54850, 48349, 49152, 38593, 46831, 33688, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 4096, 8192, 315, 1638, 16948, 30197, 11796, 32768, 45056, 20852, 32768, 32768, 4096, 32768, 32768, 1724, 45641, 14417, 32768, 32768, 32768, 1170, 32768, 32768, 219, 32768, 32768, 32768, 6553, 54613, 31597, 2978, 40960, 324, 32768, 32768, 5461, 51541, 40356, 2048, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 1310, 161, 32768, 32768, 32768, 32768, 42563, 481, 29491, 16384, 1560, 446, 31507, 4681, 10922, 436, 1260, 2184, 3657, 28299, 58809, 376, 26624, 20480, 32768, 204, 799, 3276, 32768, 1310, 39547, 19504, 6553, 32768, 32768, 1365, 32768, 230, 32768, 16384, 32768, 32768, 5461, 25869, 9906, 1820, 32768, 2978, 32768, 60854, 42351, 8057, 54272, 6553, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 8192, 32768, 10922, 32768, 32768, 32768, 58982, 1638, 54613, 32768, 3510, 14043, 29647, 4681, 54613, 32768, 4681, 4096, 33539, 32312, 38817, 32768, 58982, 8192, 32768, 32768, 54613, 32768, 32768, 1927, 43194, 23405, 4681, 5461, 45875, 1820, 16384, 32768, 54613, 40632, 32768, 32768, 2283, 27610, 34028, 1260, 8192, 32768, 32768, 65291, 31829, 61256, 51394, 2048, 51492, 32768, 32768, 32768, 32768, 27306, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 61895, 32768, 65211, 5461, 52896, 3640, 62259, 32768, 25486, 57016, 47356, 34832, 7725, 32768, 51492, 6553, 60074, 32768, 32768, 32768, 49152, 1820, 54613, 12014, 54613, 32768, 62259, 2184, 63015, 32768, 57974, 32768, 32768, 32768, 43253, 47566, 59124, 4681, 47331, 32768, 16384, 64225, 63811, 42130, 44767, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 1129, 32768, 32768, 2520, 32768, 4096, 3276, 31232, 38912, 6553, 32768, 19660, 2520, 32768, 32768, 64170, 344, 32768, 1927, 48496, 14745, 32768, 32768, 64695, 1260, 32768, 32768, 42253, 885, 8192, 32768, 16384, 404, 32768, 32768, 32768, 10922, 32768, 32768, 35016, 65408, 60074, 32768, 32768, 8192, 32768, 32768, 58982, 16384, 32768, 32768, 32768, 32768, 1129, 1724, 60854, 862, 32768, 32768, 16384, 197, 2048, 32768, 2520, 390, 32768, 32768, 16384, 1129, 8192, 5461, 32768, 21065, 6553, 885, 18327, 190, 32768, 655, 5461, 1560, 32768, 1927, 45056, 16384, 177, 32768, 32768, 840, 32768, 399, 32768, 1489, 32768, 32768, 3640, 22118, 32768, 10922, 32768, 4681, 16384, 49152, 51492, 10922, 1927, 2978, 5461, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 420, 32768, 32768, 32768, 16384, 32768, 32768, 2730, 20024, 32768, 32768, 4096, 32768, 5461, 32768, 46110, 43619, 9557, 4681, 44470, 38229, 32768, 32768, 32768, 64673, 49152, 8192, 40960, 27913, 32768, 32768, 32768, 1724, 32768, 32768, 32768, 58982, 32768, 32768, 7021, 17408, 32768, 16384, 16384, 32768, 32768, 63015, 19660, 13863, 1927, 3640, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 63488, 32768, 32768, 32768, 49152, 32768, 32768, 51, 32768, 32768, 642, 49152, 32768, 32768, 29491, 27209, 45401, 4302, 32768, 42130, 64995, 32768, 32768, 32768, 49152, 32768, 2048, 54067, 25057, 32768, 32768, 32768, 1638, 32768, 32768, 32768, 32768, 32768, 32768, 3640, 36864, 32768, 32768, 32768, 32768, 32768, 65104, 16568, 65262, 41037, 1724, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 936, 28216, 32768, 1638, 43194, 16384, 2184, 36623, 11525, 36864, 22265, 32768, 60074, 24576, 32768, 32768, 2184, 32768, 32768, 1724, 42325, 15521, 32768, 32768, 32768, 1724, 32768, 32768, 936, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 1024, 1260, 32768, 64989, 4681, 32768, 49152, 32768, 32768, 32768, 32768, 1820, 32768, 32768, 32768, 32768, 32768, 32768, 595, 819, 32768, 32768, 32768, 32768, 40069, 712, 4096, 2520, 360, 4346, 697, 728, 8936, 630, 47331, 47981, 49466, 55849, 21989, 504, 10922, 10922, 330, 840, 252, 51, 1424, 2184, 2176, 19456, 2978, 32768, 936, 992, 3640, 385, 6553, 1170, 10922, 32768, 918, 18568, 10922, 4681, 10922, 49152, 10922, 29491, 39240, 38881, 63161, 1092, 10922, 32768, 10922, 32768, 1560, 16384, 618, 32768, 4681, 32768, 6553, 32768, 5461, 32768, 8192, 32768, 32768, 10922, 54216, 32768, 756, 33077, 32768, 1489, 2577, 32768, 32768, 38486, 16711, 11731, 15521, 3276, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 60854, 32768, 16384, 32768, 32768, 16384, 32768, 32768, 1927, 64802, 32768, 32768, 32768, 32768, 32768, 49152, 64341, 59050, 33199, 32768, 10922, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 23623, 32768, 32768, 32768, 4096, 32768, 86, 32768, 32768, 32768, 63057, 32768, 56599, 32768, 19660, 32768, 6214, 32768, 5461, 54613, 56912, 37079, 46565, 32768, 20852, 32768, 22937, 32768, 6553, 32768, 6553, 32768, 32768, 32768, 14043, 32768, 16384, 32768, 5461, 32768, 10922, 32768, 5461, 32768, 20480, 32768, 12983, 32768, 2073, 32768, 3276, 32768, 4915, 146, 762, 32768, 4681, 32768, 6553, 32768, 6553, 32768, 16384, 32768, 32768, 32768, 8192, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 6553, 40960, 32768, 32768, 8192, 10922, 4681, 13492, 32768, 49152, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 49152, 32768, 32768, 2520, 8192, 16384, 32768, 235, 63897, 32768, 8192, 6553, 1024, 32768, 65080, 6553, 20852, 50301, 32768, 32768, 32768, 10922, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 5461, 32768, 32768, 32768, 32768, 32768, 1424, 528, 546, 1260, 32768, 1424, 1820, 33, 4681, 32768, 520, 1170, 6144, 270, 1365, 1170, 32768, 229, 963, 618, 404, 992, 712, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 520, 32768, 145, 2978, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 3276, 32768, 4096, 32768, 32768, 32768, 5461, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 12288, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 63608, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 61613, 14894, 53804, 15403, 54873, 55462, 55898, 32768, 32768, 120, 32768, 32768, 5461, 32768, 32768, 4681, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 4681, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 2978, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 420, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 61716, 64940, 32768, 32768, 17749, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 5461, 242, 60074, 16384, 56974, 840, 8192, 32768, 28, 118, 13405, 22761, 56236, 16384, 19362, 2730, 26110, 1078, 4096, 22430, 46011, 602, 712, 63715, 32768, 2184, 20480, 8192, 16384, 32768, 32768, 1129, 2340, 6553, 18970, 32768, 8192, 16384, 4681, 32768, 16384, 16384, 16384, 32768, 10922, 32768, 10922, 6553, 6553, 32768, 4096, 32768, 32768, 8192, 2520, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 65367, 53580, 52043, 32768, 60074, 32768, 32768, 32768, 44333, 32768, 51336, 5461, 58824, 22937, 36864, 32768, 55705, 32768, 56042, 43978, 51492, 8192, 8623, 55705, 58982, 32768, 58982, 54613, 64365, 2340, 49152, 32768, 65363, 63811, 1342, 32768, 51336, 35108, 64046, 10922, 60854, 32768, 60074, 32768, 63608, 32768, 49152, 32768, 62025, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 40960, 32768, 32768, 32768, 54613, 32768, 5898, 32768, 32768, 32768, 61660, 32768, 65060, 32768, 60784, 32768, 49152, 32768, 57344, 5461, 64524, 40049, 61224, 32768, 54167, 5782, 56050, 47513, 44683, 1489, 60854, 54613, 57291, 32768, 63242, 16384, 49664, 32768, 65126, 32768, 47645, 32768, 32768, 32768, 62501, 32768, 57106, 32768, 45534, 32768, 65099, 32768, 57432, 32768, 65293, 32768, 40478, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 325, 28996, 19917, 63015, 489, 32768, 32768, 1170, 2730, 936, 6826, 23405, 15671, 60201, 32768, 42598, 5149, 4681, 2184, 36310, 7789, 32768, 64625, 32768, 207, 32768, 58, 14894, 32768, 32768, 32768, 60074, 474, 32768, 32768, 32768, 455, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 8192, 32768, 32768, 32768, 481, 32768, 32768, 32768, 2978, 32768, 32768, 32768, 8192, 32768, 32768, 58136, 2048, 32768, 32768, 32768, 1724, 57344, 49152, 32768, 32768, 32768, 32768, 8984, 297, 9292, 20711, 47104, 12743, 63219, 32768, 51492, 1170, 4681, 26764, 53833, 7561, 32768, 63608, 32768, 6553, 32768, 61440, 32768, 2520, 32768, 32768, 32768, 16384, 32768, 32768, 63811, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 64170, 6553, 32768, 32768, 40, 453, 32768, 32768, 32768, 75, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 61895, 32768, 32768, 16384, 32768, 1927, 4681, 24576, 24576, 62385, 32768, 16384, 40049, 4096, 32768, 60854, 40215, 32768, 65306, 32768, 32768, 16384, 60074, 60854, 32768, 32768, 32768, 32768, 65024, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 57344, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 2340, 63608, 16384, 32768, 32768, 32768, 60074, 32768, 32768, 2184, 2184, 64275, 54613, 32768, 16384, 63015, 16384, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 38316, 61159, 29193, 448, 22422, 1499, 32768, 32768, 27525, 32768, 32768, 32768, 65334, 32768, 19660, 32768, 414, 10922, 8971, 32768, 32768, 64365, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 2184, 32768, 33959, 49152, 32768, 32768, 32768, 10922, 1638, 1057, 2048, 49152, 1927, 32768, 32768, 32768, 32768, 32768, 16384, 6553, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 963, 32768, 32768, 32768, 32768, 35034, 799, 27913, 1092, 16123, 270, 32768, 1820, 5461, 1927, 2730, 6553, 16783, 1260, 2184, 306, 55109, 2978, 460, 32451, 1880, 156, 10922, 42325, 420, 3640, 2730, 62259, 2730, 1365, 32768, 528, 2184, 32768, 10922, 32768, 32768, 248, 8192, 32768, 16384, 10922, 10922, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 37340, 57344, 6553, 16384, 27, 4681, 32768, 54613, 55237, 32768, 16384, 32768, 32768, 32768, 63488, 32768, 56551, 16384, 58982, 49152, 14283, 1013, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 32768, 65163, 32768, 25122, 65392, 32768, 49152, 5461, 10922, 32768, 32768, 51492, 32768, 61440, 32768, 32768, 32768, 57344, 32768, 32768, 32768, 32768, 32768, 61895, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 62805, 32768, 32768, 32768, 58982, 61440, 49152, 32768, 10922, 32768, 32768, 32768, 3276, 32768, 65430, 32768, 913, 32768, 64046, 32768, 61067, 32768, 49152, 32768, 54613, 32768, 63195, 32768, 54613, 32768, 49152, 8192, 63811, 64235, 63195, 16384, 32768, 16384, 62557, 32768, 58982, 32768, 51492, 32768, 63351, 32768, 59990, 32768, 5266, 16384, 49152, 32768, 50846, 4096, 60074, 49152, 32768, 32768, 57344, 32768, 61895, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 45875, 24576, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 56251, 14823, 4096, 61440, 1310, 2520, 885, 10922, 364, 34406, 32768, 32768, 65154, 32768, 8192, 224, 8673, 14736, 61488, 10922, 1260, 47566, 32768, 57344, 16384, 4611, 32768, 32768, 32768, 10922, 1424, 8192, 45056, 14745, 16384, 60854, 1424, 10922, 1724, 5461, 54613, 15521, 4681, 5461, 32768, 32768, 32768, 32768, 54613, 11507, 16384, 60854, 1724, 6553, 32768, 32768, 10922, 45251, 32768, 32768, 32768, 32768, 32768, 1213, 54613, 9441, 2520, 1589, 1560, 606, 3230, 436, 10922, 2091, 8192, 5461, 64838, 744, 2006, 697, 18204, 10922, 11013, 17749, 47014, 48340, 32768, 1820, 32768, 16384, 5461, 32768, 32768, 420, 32768, 5461, 45875, 6963, 4681, 17347, 1129, 2978, 6553, 6553, 49152, 17644, 32768, 32768, 32768, 1927, 6553, 17644, 54613, 11312, 179, 49152, 1820, 4096, 32768, 32768, 65067, 13405, 32768, 32768, 32768, 32768, 32768, 22099, 36128, 27255, 8192, 60074, 1489, 4096, 1560, 32768, 5594, 6553, 63488, 32768, 65104, 32768, 16002, 30193, 13824, 12466, 37563, 8344, 1170, 44265, 16384, 3137, 54613, 36623, 32768, 32768, 32768, 16384, 63608, 6746, 1638, 34640, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 17821, 32768, 32768, 32768, 32768, 65436, 32768, 14894, 1365, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 36491, 32768, 32768, 32768, 32768, 32768, 32768, 8192, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 8192, 10922, 49152, 32768, 32768, 32768, 57344, 8192, 14043, 62805, 60416, 24576, 32768, 62259, 2928, 32768, 32768, 32768, 16384, 16384, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 120, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 42130, 32768, 32768, 32768, 32768, 32768, 32768, 151, 1213, 32768, 32768, 32768, 49152, 32768, 32768, 1260, 12288, 8623, 13574, 2598, 54613, 64111, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 122, 32768, 54613, 10922, 10922, 19660, 54613, 2340, 5120, 321, 32768, 32768, 1724, 32768, 8192, 32768, 32768, 32768, 54613, 3640, 55109, 8192, 58982, 32768, 32768, 32768, 2520, 2048, 32768, 32768, 32768, 32768, 61650, 414, 40288, 23728, 15777, 1592, 1724, 2978, 381, 455, 32768, 3640, 481, 2978, 4096, 712, 27306, 32768, 18698, 53039, 22887, 1424, 44683, 2520, 32768, 1489, 32768, 32768, 32768, 1365, 40, 75, 32768, 3640, 60854, 61261, 14220, 55468, 60854, 4681, 512, 16384, 32768, 32768, 32768, 32768, 32768, 6553, 32768, 32768, 4915, 32768, 54613, 49152, 32768, 32768, 32768, 32768, 8192, 32768, 32768, 32768, 32768, 32768, 60074, 49152, 58982, 65217, 54613, 64365, 16384, 32768, 1724, 32768, 1365, 4681, 58982, 32768, 58982, 32768, 36864, 32768, 35617, 9830, 60804, 8785, 62259, 62557, 32768, 5461, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 40960, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 62557, 32768, 43858, 64111, 64136, 1927, 62259, 32768, 25278, 49152, 39594, 4681, 65167, 32768, 63488, 32768, 63351, 32419, 22452, 64736, 56472, 6371, 49152, 64170, 64512, 4681, 64406, 32768, 45428, 32768, 63351, 32768, 43430, 32768, 53365, 64512, 38570, 4531, 30319, 32768, 28945, 32768, 60854, 32768, 32768, 32768, 64695, 32768, 49152, 32768, 32768, 32768, 19660, 3640, 16384, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 14043, 20480, 32768, 49152, 1820, 10922, 668, 5461, 32768, 16384, 62805, 32768, 23623, 12226, 936, 19660, 64454, 10389, 4681, 60350, 63715, 295, 32768, 32768, 32768, 10922, 32768, 32768, 22937, 32768, 44165, 23405, 36548, 1577, 10922, 32768, 32768, 10922, 32768, 32768, 16384, 16384, 32768, 32768, 62711, 57, 25486, 49152, 17014, 17014, 32768, 32768, 49152, 436, 32768, 16384, 32768, 32768, 32768, 32768, 49152, 9830, 47427, 53248, 9772, 11720, 256, 10922, 5461, 364, 32768, 10922, 155, 399, 1276, 32768, 52224, 461, 963, 468, 2389, 6553, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 2316, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 3276, 32768, 6553, 32768, 40049, 1820, 40049, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 55705, 1820, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 504, 840, 3640, 32768, 60854, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 60074, 1560, 16384, 4681, 60074, 32768, 32768, 62259, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 58982, 32768, 32768, 32768, 32768, 49152, 32768, 8192, 32768, 6553, 16384, 32768, 63715, 63015, 32768, 32768, 57344, 3822, 61440, 32768, 10922, 32768, 63015, 32768, 32768, 8192, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 4681, 35888, 9637, 19114, 135, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 64322, 32768, 32768, 32768, 32768, 32768, 3640, 32768, 2520, 5461, 32768, 32768, 54613, 32768, 57344, 16384, 20024, 10649, 1820, 29318, 41748, 2224, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 10922, 32768, 32768, 13312, 32768, 32768, 22573, 3954, 32768, 32768, 32768, 32768, 32768, 8192, 32768, 32768, 32768, 32768, 25278, 18311, 32768, 54613, 51854, 857, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 28417, 348, 24642, 41242, 6553, 35991, 36446, 564, 16384, 618, 3276, 49152, 32768, 32768, 24576, 16384, 32768, 32768, 35571, 36263, 19660, 64950, 22068, 13212, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 1489, 57344, 16384, 42039, 52166, 58412, 64639, 21351, 203, 32768, 1170, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 62557, 32768, 32768, 49152, 26537, 13653, 32768, 32768, 442, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 27306, 32768, 32768, 32768, 32768, 8192, 32768, 32768, 32768, 32768, 399, 1129, 46421, 32768, 49152, 64170, 51661, 48228, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 38229, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 3276, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49380, 63975, 61440, 65334, 22166, 6405, 54613, 32768, 12603, 32768, 18904, 32768, 32768, 32768, 62259, 49152, 28070, 64971, 16384, 65240, 37111, 240, 61895, 64111, 12288, 18311, 32768, 32768, 23405, 32768, 55898, 32768, 20929, 63569, 49152, 62805, 11365, 63, 24576, 32768, 32768, 32768, 49152, 32768, 61895, 32768, 32768, 32768, 32768, 32768, 61440, 32768, 3485, 1560, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 62557, 32768, 33955, 61440, 32768, 64736, 33645, 7899, 32768, 32768, 5461, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 54613, 32768, 2978, 32768, 32768, 32768, 57344, 32768, 32768, 10922, 32768, 56320, 32768, 25240, 56022, 20480, 65136, 41849, 480, 16384, 4096, 32768, 32768, 16384, 32768, 32768, 32768, 63715, 16384, 14234, 64755, 32768, 64046, 12625, 1360, 32768, 32768, 1560, 2520, 32768, 32768, 32768, 32768, 63195, 655, 13578, 60416, 55978, 61603, 30368, 354, 2162, 455, 3276, 57700, 32768, 32768, 58789, 2048, 32768, 32768, 61242, 1724, 10922, 32768, 60074, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 1724, 49152, 4681, 24327, 63897, 32768, 51386, 7779, 16384, 885, 1489, 32768, 32768, 32768, 32768, 32768, 6553, 32768, 32768, 11776, 32768, 32768, 64111, 14745, 1820, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 25869, 57344, 32768, 60854, 27965, 131, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 35195, 49152, 32768, 62259, 63015, 3640, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 62259, 32768, 32768, 49152, 4096, 4915, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 2730, 32768, 61440, 32768, 32768, 32768, 22528, 28044, 31065, 18922, 49698, 10414, 25746, 60854, 55915, 53301, 5666, 29382, 58759, 14019, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 1129, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 618, 32768, 166, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 3640, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 40960, 3276, 32768, 32768, 5461, 16384, 32768, 32768, 32768, 4096, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 8192, 16384, 32768, 32768, 32768, 32768, 27776, 32768, 32768, 10922, 32768, 16384, 32768, 32768, 10240, 3640, 6553, 42130, 23911, 32768, 21299, 32768, 1560, 2048, 32768, 32768, 2978, 32768, 10922, 54613, 58552, 4185, 61179, 17892, 45201, 6336, 1003, 3640, 4681, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 2340, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 60074, 32768, 32768, 32768, 32768, 32768, 10426, 32768, 6301, 7801, 39110, 35659, 27150, 32768, 49152, 32768, 32768, 32768, 6553, 32768, 49152, 63975, 39852, 10922, 7801, 28890, 24432, 154, 1820, 32768, 49152, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 57344, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 175, 23405, 3640, 24576, 42130, 42697, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 57344, 3589, 11882, 27711, 50186, 54006, 401, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 53197, 57890, 17521, 32768, 348, 32768, 32768, 3535, 37809, 303, 40146, 26425, 34257, 51991, 45875, 32768, 20852, 32768, 16384, 62557, 642, 60854, 64061, 39489, 4600, 5285, 26331, 56320, 13850, 585, 32768, 2730, 32768, 32768, 32768, 32768, 11747, 32768, 32768, 1820, 2340, 32768, 32768, 5461, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 4681, 32768, 10922, 32768, 16384, 32768, 32768, 6553, 1820, 62557, 9513, 32768, 1057, 32768, 32768, 3696, 27306, 134, 3950, 25007, 26942, 46669, 32768, 43253, 32768, 16384, 10922, 1310, 32768, 64111, 64059, 34366, 17239, 46565, 19969, 54167, 12994, 57344, 8192, 6553, 2340, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 49152, 16384, 32768, 32768, 32768, 16384, 8192, 32768, 32768, 58514, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 1489, 32768, 32768, 32768, 32768, 65426, 32768, 32768, 49152, 32768, 32768, 1567, 63351, 83, 2394, 31857, 36044, 53954, 32768, 32768, 6553, 1560, 32768, 32768, 32768, 63897, 65430, 42130, 45868, 146, 23156, 55588, 1560, 6553, 32768, 32768, 32768, 32768, 32768, 60074, 64111, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 992, 32768, 2340, 49152, 32768, 32768, 54613, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 63608, 688, 7424, 341, 62868, 60649, 1820, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 442, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 6553, 32768, 32768, 32768, 1927, 4681, 10922, 51492, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 43008, 32768, 8192, 32768, 32768, 32768, 32768, 32768, 2730, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 42288, 300, 2048, 32768, 3640, 1024, 32768, 32768, 4096, 32768, 42130, 39789, 8192, 32768, 25057, 32768, 32768, 32768, 8192, 16384, 32768, 32768, 16384, 64170, 63015, 62296, 8133, 47189, 64406, 315, 54613, 300, 32768, 32768, 10270, 32768, 6553, 32768, 24576, 32768, 10922, 32768, 32768, 32768, 3640, 32768, 32768, 32768, 4681, 32768, 8192, 32768, 32768, 32768, 2520, 32768, 54613, 32768, 1310, 32768, 65513, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 6553, 32768, 16384, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 54613, 16384, 32768, 32768, 32768, 32768, 49152, 32768, 35617, 54613, 32768, 8192, 16384, 32768, 32768, 32768, 32768, 32768, 54613, 32768, 16384, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 57344, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 61895, 32768, 63351, 32768, 62259, 32768, 5461, 32768, 36864, 32768, 54613, 32768, 65246, 32768, 49152, 32768, 16384, 32768, 49152, 32768, 32768, 32768, 42130, 399, 12288, 16384, 24576, 32768, 58982, 32768, 54613, 32768, 32768, 32768, 54613, 32768, 62259, 32768, 49152, 2520, 57344, 32768, 32768, 32768, 60854, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 33678, 20284, 32768, 32768, 32768, 32768, 32768, 32768, 45511, 32768, 32768, 32768, 32768, 32768, 8768, 57344, 1606, 16384, 32768, 32768, 64773, 5461, 32768, 49152, 32768, 36864, 54613, 32768, 62805, 65433, 15855, 2141, 193, 7068, 58485, 4864, 862, 32768, 32768, 32768, 32768, 10922, 32768, 16384, 32768, 32768, 2048, 762, 60854, 35727, 32768, 4681, 32768, 32768, 574, 128, 215, 2286, 1213, 1365, 1310, 1365, 1365, 1213, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 4681, 32768, 3077, 16384, 6877, 14117, 16384, 10922, 60156, 49152, 528, 10922, 8192, 8192, 10922, 32768, 64242, 59017, 30300, 495, 885, 59734, 19842, 2520, 5461, 32768, 32768, 16384, 4681, 3389, 32768, 32768, 32768, 1424, 32768, 762, 6553, 5461, 840, 32768, 3276, 6553, 799, 32768, 16384, 2730, 32768, 32768, 32768, 16384, 6553, 32768, 32768, 60854, 32768, 32768, 32768, 32768, 32768, 24576, 59234, 4096, 32768, 32768, 32768, 32768, 739, 64170, 1253, 7817, 61895, 32768, 65205, 32768, 32768, 32768, 32768, 10922, 49152, 49152, 32768, 60411, 39294, 20333, 9896, 53855, 53315, 3885, 655, 32768, 32768, 10922, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 25486, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 8192, 24576, 6553, 4681, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 4096, 32768, 32768, 61895, 62259, 57344, 20284, 16384, 64077, 54613, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 62805, 32768, 32768, 32768, 32768, 32768, 2076, 62557, 295, 4778, 32768, 32768, 64512, 16384, 54613, 10922, 49152, 32768, 5865, 32768, 62259, 65238, 4551, 1860, 819, 32768, 32282, 2009, 63195, 32768, 32768, 32768, 6553, 32768, 32768, 32768, 32768, 5461, 23405, 10922, 32768, 32768, 32768, 32768, 32768, 10922, 1310, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 10922, 32768, 32768, 32768, 7183, 32768, 16384, 32768, 1057, 32768, 32768, 32768, 16384, 32768, 49152, 32768, 32768, 32768, 2184, 32768, 32768, 32768, 4096, 32768, 32768, 32768, 32768, 54613, 16384, 32768, 32768, 32768, 1820, 1560, 49152, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 1489, 32768, 32768, 32768, 10922, 32768, 6553, 32768, 32768, 32768, 5461, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 49152, 57344, 58163, 32768, 32768, 32768, 32768, 32768, 503, 32768, 188, 32479, 60854, 32768, 64716, 49152, 16384, 61440, 32768, 54613, 32768, 32768, 55296, 65447, 54528, 14415, 16384, 60533, 64602, 22179, 2520, 32768, 32768, 49152, 32768, 32768, 45056, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 58982, 32768, 32768, 32768, 64905, 32768, 64543, 32768, 63523, 32768, 1587, 57344, 6371, 45329, 62805, 32768, 62192, 49152, 36128, 32768, 61440, 32768, 61895, 32768, 63351, 62401, 36813, 9431, 22925, 58658, 51518, 1447, 22937, 32768, 58982, 32768, 32768, 32768, 63608, 32768, 64980, 32768, 50907, 32768, 63015, 32768, 32768, 32768, 58982, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 57109, 32768, 32768, 655, 32768, 32768, 2269, 50712, 1290, 34868, 60854, 32768, 64695, 32768, 54613, 32768, 1638, 10922, 49152, 4681, 60854, 63996, 41356, 1355, 56, 46556, 49790, 2768, 1213, 32768, 51, 10922, 1092, 32768, 32768, 455, 32768, 32768, 32768, 862, 32768, 32768, 1560, 32768, 225, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 40960, 32768, 32768, 455, 32768, 2048, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 5461, 32768, 100, 61440, 2730, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 62259, 44236, 14745, 1310, 25559, 61952, 256, 10922, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 1724, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 60854, 32768, 32768, 799, 49152, 4681, 15521, 32768, 32768, 63897, 32768, 32768, 32768, 32768, 32768, 62259, 32768, 32768, 64599, 13614, 1052, 442, 63351, 49152, 32768, 32768, 32768, 32768, 64650, 32768, 32768, 32768, 64046, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 58982, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 585, 62259, 2978, 24576, 32768, 32768, 57344, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 62025, 37622, 40960, 512, 36864, 38804, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 7645, 32768, 8192, 5461, 32768, 32768, 58982, 32768, 32768, 32768, 32768, 32768, 2040, 32768, 62557, 51118, 56912, 2978, 630, 3640, 819, 9228, 32768, 32768, 1560, 32768, 16384, 32768, 32768, 32768, 32768, 4096, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 2184, 32768, 32768, 51063, 32768, 60074, 32768, 40049, 32768, 49152, 32768, 1489, 32768, 13349, 30427, 32768, 32768, 19114, 32768, 32768, 32768, 32768, 32768, 121, 32768, 58982, 61440, 32768, 5461, 16384, 11702, 47513, 54613, 1108, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 10922, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 32768, 32768, 32768, 32768, 32768, 3276, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 58982, 32768, 32768, 32768, 49152, 65275, 38229, 118, 16384, 32768, 57344, 1560, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 65355, 32768, 49152, 32768, 60074, 32768, 60074, 32768, 63015, 32768, 58982, 32768, 32768, 32768, 54613, 32768, 63351, 32768, 49152, 32768, 32768, 32768, 54613, 32768, 57344, 32768, 58982, 32768, 60854, 32768, 57344, 32768, 49152, 32768, 57344, 32768, 61895, 32768, 58982, 32768, 54613, 32768, 32768, 32768, 60074, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 1170, 6553, 32768, 32768, 32768, 32768, 32768, 32768, 86, 404, 6553, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 5461, 5461, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 151, 37019, 404, 289, 192, 217, 528, 218, 284, 1424, 799, 390, 224, 468, 442, 1024, 1092, 668, 173, 52, 1170, 1024, 442, 4096, 1057, 963, 32768, 32768, 32768, 32768, 1170, 32768, 147, 65, 50, 201, 248, 50, 489, 390, 92, 1092, 963, 113, 95, 111, 137, 77, 2730, 244, 47, 86, 96, 268, 270, 4681, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 1927, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 31597, 49152, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 22685, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 799, 1927, 32768, 45875, 32768, 32768, 1129, 32768, 156, 66, 184, 49152, 32768, 32768, 32768, 32768, 431, 32768, 24576, 32768, 6553, 32768, 32768, 32768, 19351, 16384, 30468, 32768, 30877, 32768, 34640, 32768, 35964, 32768, 26671, 32768, 29733, 32768, 20239, 32768, 28867, 32768, 29354, 32768, 4681, 32768, 181, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 60854, 54613, 32768, 32768, 25057, 32768, 25486, 32768, 25057, 32768, 25486, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 1820, 32768, 32768, 32768, 54613, 32768, 32768, 32768, 65358, 32768, 717, 32768, 36044, 32768, 32768, 53833, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 60074, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 58982, 32768, 1489, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 27949, 32768, 40140, 32768, 28299, 32768, 32768, 32768, 22937, 32768, 34539, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 8192, 32768, 1328, 32768, 16384, 32768, 32768, 32768, 26736, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 36713, 20945, 24785, 32768, 32768, 32768, 32768, 32768, 16384, 2520, 32768, 32768, 10922, 32768, 32768, 16384, 936, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 122, 819, 3640, 32768, 2184, 57221, 32768, 3640, 4096, 1365, 32768, 49152, 2520, 32768, 4096, 32768, 885, 728, 728, 840, 1260, 1057, 1424, 1170, 1129, 936, 32768, 10922, 32768, 32768, 32768, 32768, 8192, 14, 6553, 15291, 17, 32768, 32768, 32768, 113, 37055, 32768, 32768, 24576, 16384, 13405, 65101, 54613, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 1927, 32768, 2978, 10922, 32768, 32768, 53, 1260, 135, 90, 119, 67, 885, 546, 144, 10922, 27485, 8192, 564, 35, 40, 26, 32768, 157, 1489, 25, 422, 28, 152, 170, 936, 431, 348, 10922, 32768, 49152, 4096, 16384, 32768, 32768, 4681, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 4681, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 2048, 1310, 32768, 32768, 32768, 32768, 32768, 32768, 132, 1092, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 60074, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 56480, 58789, 11451, 5756, 22182, 1852, 32768, 32768, 8301, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 4681, 32768, 2048, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 2073, 32768, 13544, 32768, 32768, 32768, 32768, 6553, 1560, 762, 6761, 10922, 1424, 5461, 5461, 32768, 1213, 1170, 3276, 2520, 1365, 840, 840, 1024, 992, 1213, 6553, 1820, 32768, 32768, 32768, 32768, 13458, 32768, 16384, 32768, 2730, 32768, 32768, 32768, 32768, 6553, 23156, 32768, 4681, 32768, 10922, 32768, 14336, 32768, 436, 32768, 32768, 32768, 32768, 32768, 712, 32768, 32768, 10922, 10922, 32768, 32768, 53, 12584, 13001, 7175, 992, 13292, 103, 6036, 16384, 20720, 585, 20534, 2048, 7326, 32768, 17039, 306, 9335, 5461, 14576, 4915, 655, 12, 334, 10922, 1489, 244, 20956, 32768, 32768, 32768, 32768, 32768, 60854, 10922, 29918, 32768, 14336, 10922, 20239, 1536, 37809, 32768, 6553, 32768, 19660, 32768, 32768, 32768, 65255, 32768, 41740, 65255, 32768, 49152, 32768, 32768, 16384, 32768, 204, 10922, 32768, 32768, 32768, 32768, 16384, 26624, 27525, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 21202, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 1575, 32768, 32768, 32768, 32768, 32768, 64650, 32768, 3717, 32768, 31744, 32768, 33731, 32768, 35840, 10922, 24576, 32768, 31804, 32768, 32768, 32768, 32768, 32768, 58982, 64949, 32768, 32768, 49152, 8192, 32768, 62805, 32768, 32768, 32768, 32768, 32768, 32768, 6553, 32768, 10922, 32768, 32768, 32768, 1489, 2340, 32768, 4096, 474, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 58982, 32768, 58982, 32768, 32768, 32768, 39088, 14296, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 6007, 3276, 60074, 1365, 2184, 32768, 32768, 8192, 37636, 32768, 32768, 32768, 32768, 32768, 32768, 62805, 15645, 4681, 58982, 2048, 3640, 32768, 32768, 32768, 4468, 32768, 32768, 32768, 32768, 130, 642, 53580, 23483, 4681, 32768, 5285, 1365, 762, 758, 63015, 17899, 1638, 32768, 3640, 8192, 1213, 697, 13534, 7021, 1310, 9216, 697, 799, 1310, 1092, 4096, 963, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 11988, 3640, 60854, 2520, 4096, 32768, 16384, 32768, 26155, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 12934, 5461, 58982, 2184, 3276, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 474, 6553, 308, 11419, 9966, 936, 1156, 461, 2520, 19, 595, 32768, 120, 128, 321, 1820, 42, 936, 2340, 1310, 45215, 96, 345, 2340, 1820, 10922, 16384, 2978, 16384, 32768, 32768, 32768, 32768, 32768, 3072, 58982, 10922, 6553, 58982, 2048, 2730, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 5721, 6553, 58982, 1638, 3276, 32768, 7123, 64572, 369, 32768, 32768, 32768, 32768, 55296, 6371, 30181, 1024, 32768, 32768, 32768, 32768, 32768, 16384, 10922, 28299, 32768, 32768, 32768, 32768, 65295, 32768, 2730, 5461, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 4096, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 8192, 289, 64275, 5461, 32768, 32768, 32768, 32768, 32768, 32768, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 31179, 11663, 6485, 63688, 44165, 45875, 11729, 60854, 26089, 33706, 46160, 52043, 32768, 32768, 54613, 8192, 60588, 19208, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32, 8192, 3276, 16384, 9830, 35108, 32768, 1724, 1134, 203, 32768, 5461, 854, 1638, 268, 3640, 963, 1260, 4201, 4428, 1213, 992, 1024, 1724, 1310, 885, 2730, 461, 32768, 16384, 8192, 32768, 29833, 32768, 29257, 19660, 5649, 51882, 4681, 5461, 32768, 16384, 32768, 32768, 32768, 16384, 19660, 32768, 43395, 32768, 19504, 53007, 10365, 8791, 32768, 32768, 1489, 32768, 16384, 4096, 4681, 10922, 32768, 90, 29647, 260, 14478, 6411, 5159, 448, 10498, 32768, 20768, 46, 23156, 4681, 11195, 2730, 17999, 101, 33450, 2340, 11410, 222, 512, 368, 936, 32768, 1213, 1057, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 19114, 19660, 32768, 30427, 32768, 38229, 32768, 7561, 32768, 45875, 32768, 19660, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49917, 29491, 32768, 1129, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 58982, 49152, 32768, 32768, 44470, 32768, 54613, 32768, 32768, 32768, 32768, 32768, 6553, 32768, 3640, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 19660, 32768, 40960, 32768, 2560, 32768, 16384, 32768, 64625, 32768, 32768, 32768, 37319, 32768, 17066, 52662, 39547, 32768, 36739, 32768, 34539, 32768, 18108, 32768, 32768, 32768, 32768, 32768, 12288, 32768, 32768, 5461, 32768, 32768, 60074, 32768, 4096, 32768, 57344, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 1666, 49152, 8192, 16384, 32768, 32768, 489, 32768, 10922, 32768, 32768, 32768, 40960, 32768, 51492, 32768, 63015, 574, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 2978, 32768, 32768, 57734, 762, 6553, 32768, 63975, 25486, 660, 49152, 8374, 27852, 36780, 6553, 32768, 32768, 32768, 32768, 32768, 1057, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 11, 256, 655, 32768, 3533, 16384, 32768, 237, 91, 128, 32768, 2730, 125, 246, 324, 4681, 936, 840, 1024, 910, 10922, 910, 799, 963, 910, 712, 4681, 222, 32768, 10922, 10922, 32768, 32768, 2978, 1724, 6553, 16384, 2340, 2520, 32768, 16384, 2978, 32768, 32768, 49152, 16384, 32768, 10922, 32768, 1310, 32768, 32768, 60854, 4681, 54613, 32768, 32768, 32768, 32768, 862, 32768, 6553, 32768, 49, 32768, 41, 606, 94, 160, 1434, 46, 237, 6553, 496, 16384, 41506, 339, 901, 560, 504, 221, 2520, 21, 61, 309, 420, 382, 284, 85, 564, 2978, 32768, 49152, 10922, 32768, 32768, 32768, 1365, 32768, 32768, 232, 32768, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 58982, 4096, 65067, 32768, 32768, 57344, 54613, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 3640, 40960, 6553, 45056, 16384, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 574, 32768, 32768, 2234, 16384, 16384, 49152, 32768, 32768, 32768, 32768, 13741, 63488, 43115, 32768, 32768, 32768, 5908, 62259, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 60074, 54613, 49152, 32768, 32768, 32768, 32768, 32768, 40960, 32768, 19660, 32768, 32768, 32768, 32768, 32768, 37163, 3611, 28672, 284, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 31402, 2340, 16384, 32768, 107, 65015, 40960, 32768, 54613, 6553, 32768, 32768, 32768, 10922, 8192, 62805, 61026, 448, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 17, 16384, 712, 9466, 2184, 56713, 31894, 153, 459, 112, 32768, 61224, 2275, 66, 10012, 32768, 780, 1489, 885, 8777, 1365, 1092, 38280, 574, 885, 1365, 32768, 324, 32768, 32768, 32768, 32768, 32768, 2048, 38229, 17944, 630, 28672, 10625, 682, 25486, 1638, 32768, 60074, 23210, 32768, 53833, 32768, 54613, 32768, 19702, 26093, 49152, 61440, 28933, 137, 1560, 32768, 10922, 1560, 10922, 16384, 32768, 63, 39161, 385, 26828, 11641, 6865, 1585, 6500, 992, 26585, 41, 35659, 63975, 4851, 910, 6606, 66, 13509, 32768, 3615, 352, 537, 237, 12288, 10922, 32768, 6553, 3640, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 19660, 32768, 22685, 54613, 36929, 3640, 15291, 32768, 6553, 63015, 34816, 32768, 62557, 32768, 32768, 32768, 5461, 62259, 32768, 32768, 58967, 8878, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 57344, 29571, 3276, 19660, 32768, 32768, 62259, 26624, 32768, 60854, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 2482, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 26021, 32768, 30782, 64478, 23080, 668, 16880, 32768, 24576, 62259, 33374, 32768, 58982, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 28672, 1092, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 60854, 4738, 574, 45875, 32768, 585, 62259, 45251, 32768, 63015, 32768, 32768, 32768, 36044, 60854, 32768, 64111, 65417, 79, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 20631, 32768, 8192, 28672, 42379, 1057, 45875, 2340, 1424, 62557, 32768, 32768, 60854, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 90, 16384, 1820, 32768, 32768, 54613, 13008, 1927, 1724, 496, 32768, 63015, 15254, 16384, 15564, 4681, 32768, 32768, 53507, 40960, 32768, 32768, 20935, 936, 32768, 32768, 5461, 1820, 32768, 32768, 32768, 32768, 32768, 5461, 30427, 32768, 4681, 60074, 6826, 11264, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 65289, 16384, 32768, 32768, 65087, 12288, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 133, 32768, 93, 2978, 8192, 2048, 93, 7021, 2340, 546, 585, 32768, 32768, 2184, 1724, 82, 574, 2340, 32768, 528, 289, 1560, 595, 22166, 5461, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 40960, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 61895, 32768, 442, 32768, 60074, 5461, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 2184, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 122, 32768, 2730, 32768, 32768, 54613, 54613, 3640, 39229, 11248, 48371, 8192, 668, 3640, 1927, 16384, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 1424, 32768, 16384, 3276, 32768, 54067, 32768, 32768, 32768, 16384, 54613, 40049, 6553, 28672, 32768, 54613, 49152, 32768, 49152, 10922, 32768, 3640, 1927, 5173, 32768, 32768, 32768, 32768, 32768, 1310, 32768, 54613, 3640, 32768, 2184, 32768, 85, 32768, 23, 32768, 16384, 33512, 140, 29876, 1489, 30181, 351, 33587, 5461, 19822, 1310, 24879, 250, 40049, 32768, 17164, 16384, 390, 8192, 1489, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 18204, 54613, 15521, 6553, 27726, 5461, 19660, 57344, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 8192, 32768, 32768, 2184, 25974, 45875, 436, 51164, 55705, 42780, 50322, 32768, 32768, 32768, 32768, 57344, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 3822, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 24219, 32768, 34133, 54613, 27726, 10922, 22166, 4915, 23945, 32768, 35617, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 963, 5461, 32768, 32768, 60074, 474, 58982, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49232, 30653, 25652, 61725, 2606, 32768, 5461, 27683, 44470, 4681, 64170, 49152, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 64225, 4096, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 474, 32768, 16384, 32768, 32768, 32768, 32768, 4681, 50062, 30630, 49152, 744, 22937, 14894, 2730, 10922, 32768, 8192, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 7801, 3276, 1724, 32768, 32768, 32768, 32768, 32768, 8192, 10922, 11468, 32768, 32768, 32768, 32768, 910, 35241, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 3276, 32768, 32768, 32768, 963, 32768, 268, 1638, 219, 1057, 96, 57, 409, 17, 65, 56433, 23523, 20852, 21722, 53, 120, 10, 76, 201, 6553, 135, 169, 194, 32768, 744, 32768, 1024, 32768, 118, 27306, 32768, 300, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 39789, 32768, 62259, 8192, 32768, 49152, 32768, 32768, 32768, 45875, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 32768, 32768, 6553, 32768, 32768, 32768, 51200, 32768, 3276, 32768, 32768, 49152, 32768, 32768, 32768, 3640, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 60854, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 57344, 32768, 32768, 32768, 57344, 32768, 32768, 2978, 1489, 32768, 32768, 32768, 32768, 32768, 32768, 385, 5461, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 60854, 32768, 32768, 12170, 44127, 55898, 60854, 32768, 32768, 32768, 32768, 16384, 16384, 1927, 18854, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 3880, 62557, 39368, 26624, 32768, 32768, 10922, 32768, 32768, 5461, 59392, 32768, 10922, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 3276, 16384, 42850, 32768, 32768, 32768, 32768, 6553, 2978, 4274, 31531, 16384, 16384, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 16384, 32768, 32768, 32768, 32768, 19660, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 27306, 54613, 8495, 18204, 57344, 32768, 10922, 32768, 32768, 32768, 4681, 32768, 32768, 32768, 32768, 32768, 1820, 32768, 32768, 32768, 16384, 16384, 32768, 32768, 28672, 4681, 34523, 16384, 24743, 19660, 26374, 32768, 28912, 42850, 38092, 32768, 33878, 16384, 23007, 282, 27726, 19660, 30533, 4681, 4681, 744, 5461, 32768, 32768, 49152, 22140, 32768, 32768, 32768, 32768, 32768, 32768, 2520, 33678, 32768, 21065, 37809, 10922, 10922, 27949, 55351, 1840, 58982, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 6553, 2091, 4681, 32768, 32768, 32768, 32768, 32768, 5461, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 51492, 13405, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 585, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 28987, 32768, 31675, 32768, 30508, 32768, 29918, 7561, 32768, 32768, 35840, 32768, 32768, 32768, 32768, 32768, 36664, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 54613, 431, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 1927, 5851, 528, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 18457, 28067, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 4681, 4096, 36196, 32768, 32768, 32768, 32768, 32768, 2730, 61895, 9027, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 341, 1820, 53739, 46724, 32768, 32768, 32768, 6553, 574, 6015, 54858, 18549, 2340, 16384, 2048, 32768, 32768, 32768, 10922, 45641, 32768, 32768, 32768, 32768, 8192, 32768, 32768, 268, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 13292, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 461, 32768, 537, 65046, 4096, 32768, 491, 1092, 16384, 32768, 655, 32768, 4492, 8192, 18204, 2978, 6553, 16384, 7021, 32768, 5213, 32768, 10922, 32768, 32768, 32768, 8192, 32768, 43046, 32768, 32768, 32768, 32768, 32768, 10260, 63608, 40801, 16384, 49152, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 57344, 32768, 32768, 32768, 32768, 32768, 8192, 32768, 32768, 32768, 32768, 32768, 5173, 32768, 2838, 32768, 32768, 32768, 32768, 32768, 8192, 54613, 6553, 436, 38725, 32768, 16384, 32768, 32768, 32768, 40760, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 4681, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 27306, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 65258, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 34515, 18786, 39424, 3276, 21911, 53203, 34982, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 5461, 1560, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 74, 32768, 910, 32768, 32768, 32768, 31597, 2340, 2214, 348, 32768, 2184, 20177, 45100, 20416, 16384, 32768, 32768, 4096, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 436, 5461, 32768, 16384, 32768, 40960, 32768, 32768, 32768, 8192, 32768, 36548, 2978, 32768, 16384, 32768, 54613, 45251, 58982, 30653, 1560, 32768, 32768, 4096, 10922, 32768, 32768, 32768, 32768, 1927, 32768, 16384, 2730, 32768, 1365, 58982, 88, 35498, 77, 13269, 1489, 10612, 79, 24948, 2048, 27501, 42, 32768, 57344, 3731, 29647, 11152, 48, 13516, 32768, 20128, 102, 368, 289, 4096, 3640, 32768, 224, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 17644, 32768, 17164, 42130, 27972, 4096, 22685, 32768, 10922, 49152, 45166, 2048, 58982, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 4656, 32768, 32768, 142, 16924, 30782, 4681, 32768, 16384, 32768, 65167, 53022, 61991, 38350, 642, 32768, 32768, 32768, 32768, 60074, 16384, 49152, 32768, 32768, 32768, 528, 32768, 32768, 32768, 57344, 32768, 32768, 574, 26731, 32768, 60053, 1092, 28011, 6553, 60659, 2520, 30427, 32768, 36044, 50704, 57974, 32768, 63975, 4681, 32768, 32768, 63975, 8192, 32768, 32768, 64046, 8192, 32768, 32768, 63975, 8192, 32768, 32768, 63975, 6553, 32768, 32768, 30533, 6950, 16384, 3640, 32768, 32768, 461, 64893, 3640, 32768, 1424, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 4096, 32768, 32768, 819, 31789, 10922, 16384, 32768, 8192, 2048, 65445, 5469, 43838, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 4681, 32768, 32768, 32768, 32768, 32768, 32768, 132, 49152, 3276, 32768, 5461, 11702, 32768, 2978, 1310, 394, 32768, 52272, 57257, 35394, 28874, 126, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 58982, 8192, 546, 32768, 32768, 10922, 32768, 32768, 2642, 16384, 32768, 10922, 32768, 32768, 32768, 32768, 24576, 32768, 49152, 32768, 24576, 49152, 32768, 32768, 10922, 32768, 4681, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 414, 32768, 1724, 32768, 104, 32768, 68, 318, 682, 191, 1044, 1365, 2978, 32768, 309, 32768, 65015, 16857, 2662, 1560, 105, 373, 16384, 16384, 240, 12170, 963, 32768, 32768, 32768, 4096, 275, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 51492, 32768, 64170, 56875, 59489, 61261, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 64111, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 6553, 32768, 32768, 54613, 32768, 32768, 32768, 59247, 49152, 2978, 32768, 32768, 27726, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 3276, 32768, 32768, 32768, 58982, 32768, 32768, 32768, 64736, 32768, 32768, 63811, 32768, 32768, 32768, 32768, 49152, 32768, 62259, 32768, 62805, 24401, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 58982, 32768, 32768, 963, 24576, 32768, 10922, 32768, 32768, 32768, 63195, 27197, 65484, 33894, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 4096, 49152, 32768, 10922, 16384, 16384, 799, 32768, 20909, 65046, 27306, 1424, 32768, 32768, 32768, 32768, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 20, 16384, 1560, 16384, 32768, 32768, 32768, 330, 295, 179, 32768, 46565, 282, 176, 1092, 4096, 32768, 32768, 16384, 3640, 32768, 32768, 32768, 32768, 32768, 32768, 1820, 188, 32768, 32768, 32768, 8192, 16384, 32768, 32768, 32768, 16384, 6553, 32768, 32768, 32768, 32768, 32768, 32768, 25057, 36864, 24576, 1260, 32768, 32768, 6553, 16384, 32768, 32768, 32768, 16384, 1927, 32768, 32768, 6553, 16384, 1260, 32768, 130, 31905, 52, 25668, 207, 1078, 2002, 6179, 44, 29979, 222, 28216, 7909, 5967, 20525, 3780, 75, 7561, 16384, 8501, 78, 27, 84, 1024, 442, 32768, 655, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 1560, 10922, 32768, 867, 31058, 40049, 1638, 29491, 49152, 19660, 64041, 13704, 22458, 6041, 2978, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 65255, 2978, 32768, 32768, 32768, 32768, 32768, 2824, 64650, 945, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 618, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 27069, 32768, 22235, 16384, 31402, 32768, 25988, 32768, 27069, 32768, 25869, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 8192, 49152, 32768, 51492, 32768, 32768, 1384, 49152, 5120, 14641, 5461, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 16384, 1820, 32768, 32768, 54613, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 58, 32768, 5461, 32768, 8192, 16384, 32768, 4096, 936, 1560, 32768, 32768, 2048, 55898, 1489, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 2520, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 4681, 32768, 32768, 32768, 32768, 32768, 58982, 61440, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 2340, 32768, 32768, 32768, 168, 32768, 368, 442, 78, 168, 1424, 128, 309, 10922, 134, 32768, 1424, 117, 106, 32, 630, 69, 32768, 32, 117, 118, 50, 295, 115, 1724, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 2048, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 6553, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 101, 32768, 2340, 32768, 32768, 32768, 32768, 1820, 14417, 1622, 32768, 1927, 306, 165, 2520, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 3276, 376, 32768, 16384, 32768, 32768, 36864, 16384, 3640, 4681, 840, 32768, 32768, 32768, 32768, 16384, 16384, 49152, 32768, 32768, 10922, 32768, 546, 88, 1724, 1281, 32768, 32768, 32768, 32768, 1489, 32768, 32768, 2184, 32768, 16384, 32768, 99, 23911, 54, 26671, 4681, 13544, 85, 24719, 32768, 27554, 697, 27306, 32768, 10150, 10922, 13687, 185, 11644, 32768, 3881, 1489, 64, 414, 3640, 8192, 16384, 436, 2340, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 6553, 32768, 18204, 32768, 19660, 32768, 27726, 32768, 40049, 32768, 19660, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 35498, 16384, 32768, 32768, 32768, 32768, 60074, 32768, 32768, 32768, 64365, 10922, 4096, 32768, 54613, 32768, 32768, 42130, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 32768, 574, 32768, 32768, 10922, 32768, 32768, 64225, 32768, 39666, 32768, 24576, 32768, 38619, 32768, 31675, 32768, 29491, 32768, 42697, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 436, 32768, 32768, 32768, 32768, 32768, 54613, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 20002, 16384, 20278, 32768, 32768, 32768, 32768, 16384, 16384, 10922, 32768, 32768, 32768, 32768, 32768, 16384, 6018, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 5461, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 2340, 32768, 65074, 32768, 32768, 32768, 32768, 5461, 3324, 51492, 21325, 32768, 32768, 32768, 32768, 442, 36690, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 5461, 32768, 32768, 32768, 32768, 32768, 368, 1489, 324, 16384, 32768, 32768, 16384, 6553, 32768, 32768, 63142, 16384, 20480, 32768, 32768, 32768, 32768, 29318, 1694, 49152, 23405, 32768, 963, 32768, 32768, 32768, 16384, 24576, 6553, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 16384, 61440, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 63897, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10532, 668, 32768, 32768, 32768, 32768, 32768, 32768, 168, 1638, 32768, 32768, 32768, 32768, 32768, 32768, 62557, 60854, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 57344, 32768, 32768, 32768, 32768, 32768, 32768, 28333, 65115, 6553, 16384, 26425, 7220, 32768, 6553, 341, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 25486, 32768, 10922, 32768, 32768, 32768, 16384, 32768, 19114, 32768, 32768, 32768, 32768, 32768, 27, 12072, 24891, 32768, 32768, 32768, 32768, 5461, 170, 3561, 45980, 20852, 258, 936, 210, 2520, 32768, 32768, 2685, 6553, 32768, 32768, 32768, 32768, 2730, 4096, 25600, 504, 32768, 32768, 32768, 16384, 10922, 32768, 3276, 32768, 16384, 32768, 8192, 6553, 32768, 32768, 59864, 32768, 32768, 16384, 6553, 32768, 32768, 32768, 1638, 32768, 32768, 32768, 32768, 712, 1638, 4681, 2730, 1424, 32768, 32768, 49152, 60, 29206, 2013, 4481, 211, 13312, 12, 16384, 292, 19166, 74, 36310, 762, 23163, 295, 1232, 67, 25395, 618, 7530, 496, 60, 295, 840, 156, 16384, 1653, 24427, 32768, 32768, 32768, 32768, 32768, 54613, 32768, 53248, 32768, 17164, 60250, 4024, 4681, 25486, 32768, 32768, 32768, 45875, 32768, 32768, 32768, 65007, 3640, 30358, 64625, 32768, 32768, 10922, 4681, 5461, 14043, 55003, 16384, 32768, 32768, 32768, 32768, 10922, 35680, 26916, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 1702, 32768, 32768, 32768, 32768, 32768, 32768, 6553, 1724, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 595, 16384, 32768, 32768, 32768, 32768, 61895, 32768, 1730, 32768, 29044, 32768, 24311, 32768, 34257, 5461, 34640, 32768, 20083, 32768, 32768, 32768, 32768, 32768, 2978, 49152, 32768, 32768, 32768, 16384, 32768, 58982, 32768, 32768, 32768, 32768, 32768, 32768, 64443, 32768, 2776, 32768, 32768, 32768, 16384, 16384, 32768, 17644, 489, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 3640, 49152, 32768, 32768, 40960, 10922, 32768, 32768, 25453, 33366, 32768, 32768, 32768, 32768, 49152, 32768, 16384, 12743, 16384, 58982, 3640, 5461, 32768, 32768, 744, 3104, 32768, 32768, 32768, 32768, 32768, 32768, 55296, 28672, 16384, 58982, 2730, 4096, 16384, 21370, 58982, 11952, 32768, 32768, 32768, 32768, 26, 1977, 43827, 5521, 32768, 27726, 2730, 574, 214, 1884, 60173, 20650, 368, 448, 234, 2184, 32768, 1260, 18521, 3915, 16384, 58982, 4096, 6553, 992, 974, 54954, 11295, 32768, 2978, 16384, 32768, 32768, 27306, 27306, 11170, 10922, 58982, 2340, 5461, 32768, 32768, 32768, 32555, 32768, 32768, 16384, 32768, 32768, 32768, 19660, 12873, 16384, 58982, 3276, 16384, 16384, 3276, 32768, 12207, 6553, 6553, 32768, 108, 32768, 1981, 3510, 9667, 564, 206, 409, 266, 153, 41, 54613, 252, 1365, 2184, 682, 112, 248, 32768, 9830, 467, 17, 2633, 2730, 390, 32768, 1662, 63715, 46769, 32768, 32768, 32768, 32768, 32768, 5461, 32768, 49638, 32768, 58982, 4681, 8192, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 10113, 63161, 10128, 10922, 58982, 2184, 4096, 16384, 1684, 46421, 38978, 32768, 32768, 32768, 32768, 4176, 8694, 21684, 15943, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 3342, 32768, 32768, 32768, 32768, 65191, 10922, 46421, 6746, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 3830, 32768, 32768, 32768, 32768, 32768, 32768, 4681, 32768, 32768, 32768, 32768, 32768, 10922, 1092, 60854, 52932, 32768, 32768, 32768, 32768, 32768, 32768, 6553, 5461, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 5461, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 149, 219, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 7123, 14043, 520, 2006, 32768, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 18, 32768, 2091, 24576, 6553, 51882, 32768, 728, 1070, 116, 32768, 1724, 297, 268, 360, 2048, 32768, 10922, 12288, 5851, 32768, 32768, 10922, 32768, 4681, 32768, 2184, 186, 32768, 32768, 32768, 32768, 53487, 10922, 24576, 12288, 9175, 10922, 45875, 32768, 2184, 2520, 16384, 32768, 16384, 10922, 2184, 32768, 8192, 32768, 24576, 40960, 24903, 12743, 32768, 32768, 32768, 32768, 32768, 295, 16384, 697, 24029, 54, 32768, 37, 2091, 206, 3230, 26, 474, 32768, 25, 34, 32768, 6553, 381, 1057, 1489, 50, 376, 32768, 52, 193, 260, 39, 520, 520, 1213, 196, 32768, 32768, 32768, 32768, 32768, 32768, 65483, 36044, 10922, 32768, 4915, 10922, 32768, 32768, 64443, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 61124, 992, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 59499, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 57734, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 65310, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 57344, 32768, 63715, 32768, 57344, 32768, 54613, 32768, 54613, 32768, 49152, 32768, 32768, 32768, 63015, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 54613, 32768, 49152, 32768, 47331, 32768, 49152, 26916, 61895, 32768, 61440, 32768, 32768, 32768, 5006, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 1489, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 32768, 32768, 32768, 32768, 368, 5461, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 244, 32768, 3640, 32768, 21065, 32768, 32768, 3276, 32768, 3276, 8192, 32768, 31, 32768, 8192, 16384, 32768, 32768, 49152, 2978, 5461, 18204, 32768, 16384, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 52932, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 64695, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 2520, 32768, 606, 630, 455, 840, 399, 13, 1213, 16384, 284, 32768, 32768, 3536, 1198, 72, 10922, 368, 16384, 20, 87, 1266, 32768, 32768, 32768, 8192, 32768, 16384, 32768, 32768, 8192, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 6068, 32768, 58982, 61895, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 1854, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 4096, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 86, 32768, 31243, 2520, 25948, 309, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 2378, 7021, 4689, 58982, 57890, 11840, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 780, 32768, 6553, 18970, 32768, 61440, 8192, 574, 8192, 3276, 32768, 32768, 3276, 3276, 3276, 5461, 32768, 32768, 2978, 12603, 32768, 32768, 19114, 4096, 32768, 32768, 32768, 1365, 32768, 32768, 32768, 32768, 45662, 32768, 10922, 20024, 32768, 32768, 36217, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 58982, 32768, 11827, 21202, 4681, 64478, 9767, 1966, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 585, 32768, 101, 1560, 7399, 32768, 265, 40112, 4096, 32768, 135, 32768, 32768, 32768, 32768, 32768, 143, 32768, 32768, 6553, 2520, 4096, 32768, 8495, 2340, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 5782, 32768, 32768, 32768, 27746, 3810, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 4681, 32768, 32768, 64838, 55656, 121, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 6553, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 6553, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 6553, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 5461, 32768, 32768, 32768, 4915, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 61440, 32768, 28961, 64046, 32768, 64599, 36651, 1424, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 3171, 32768, 32768, 49152, 49152, 455, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 51225, 62557, 32768, 32768, 63975, 3276, 32768, 32768, 3640, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 5461, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 203, 32768, 3640, 32768, 32768, 32768, 63750, 3276, 2520, 2048, 32768, 32768, 1560, 8192, 1129, 32768, 49152, 32768, 13887, 61895, 32768, 49152, 60620, 4096, 32768, 32768, 10922, 2184, 32768, 5461, 32768, 32768, 54613, 8192, 436, 32768, 32768, 32768, 55366, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 57655, 32768, 32768, 32768, 58514, 6553, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 138, 32768, 192, 5461, 32768, 32768, 2127, 2586, 32768, 153, 33, 32768, 32768, 8192, 32768, 3640, 780, 186, 16384, 1864, 399, 8192, 32768, 32768, 3276, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 4681, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 23405, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 6553, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 585, 32768, 2730, 32768, 32768, 16384, 32768, 4681, 12603, 1560, 32768, 10922, 3640, 16384, 8192, 32768, 481, 394, 404, 385, 390, 385, 330, 455, 425, 409, 10922, 2978, 32768, 32768, 32768, 32768, 39059, 1927, 1927, 1927, 1927, 1927, 963, 32768, 16384, 10922, 49152, 32768, 32768, 32768, 3640, 32768, 87, 43, 32768, 60984, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 1365, 32768, 4681, 32768, 1310, 32768, 436, 442, 260, 390, 368, 474, 32768, 10922, 642, 32768, 32768, 1092, 32768, 16384, 16384, 799, 32768, 2184, 32768, 143, 32768, 32768, 936, 1365, 32768, 936, 32768, 32768, 32768, 32768, 32768, 57344, 56433, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 61440, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 54613, 32768, 32768, 32768, 54613, 32768, 54613, 32768, 32768, 32768, 32768, 32768, 54613, 32768, 54613, 32768, 54613, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 58982, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 63351, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 28436, 26151, 26947, 32768, 32768, 32768, 32768, 32768, 32768, 1489, 32768, 32768, 32768, 32768, 32768, 32768, 9830, 32768, 60074, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 89, 16384, 4681, 32768, 32768, 32768, 32768, 5461, 546, 1424, 32768, 60074, 1310, 32768, 936, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 6144, 8192, 4096, 32768, 16384, 32768, 32768, 5461, 2730, 32768, 7123, 32768, 32768, 32768, 32768, 1024, 23058, 32768, 32768, 32768, 32768, 32768, 32768, 148, 55, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 6553, 32768, 16384, 32768, 248, 4681, 2340, 16384, 10922, 32768, 3276, 32768, 32768, 32768, 30947, 32768, 32768, 4681, 2730, 2048, 8192, 224, 12288, 3640, 1260, 344, 32768, 32768, 4096, 100, 94, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 2048, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 9175, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 63950, 54613, 3640, 32768, 32768, 32768, 32768, 8192, 606, 8192, 32768, 32768, 32768, 32768, 16384, 6553, 1560, 32768, 32768, 32768, 32768, 6553, 1129, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 16384, 3640, 35108, 32768, 32768, 32768, 32768, 32768, 32768, 23405, 62805, 32768, 32768, 32768, 32768, 32768, 38757, 32768, 16384, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 40049, 58982, 32768, 32768, 6553, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 16384, 29544, 16384, 16384, 32768, 32768, 32768, 237, 32768, 6553, 21370, 8192, 2184, 117, 4096, 32768, 2978, 4681, 44683, 32768, 10922, 32768, 32768, 32768, 4096, 30533, 19744, 16384, 6553, 1724, 32768, 32768, 32768, 16384, 465, 16384, 8192, 32768, 32768, 32768, 8192, 10922, 49864, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 6553, 29544, 40049, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 5461, 11605, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 48949, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 992, 32768, 32768, 32768, 32768, 32768, 24576, 51672, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 61895, 5461, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 54613, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 19926, 22382, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 37, 1092, 32768, 32768, 32768, 32768, 32768, 4096, 64111, 36864, 32768, 32768, 32768, 32768, 32768, 992, 64365, 3176, 32768, 32768, 32768, 32768, 1927, 1820, 49152, 552, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 60854, 32768, 32768, 32768, 32768, 3640, 193, 49152, 23242, 32768, 32768, 32768, 32768, 32768, 762, 64940, 22937, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 40960, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 385, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 4681, 32768, 9637, 32768, 32768, 32768, 32768, 10922, 13741, 57344, 7262, 32768, 32768, 32768, 32768, 16384, 1424, 62805, 27661, 32768, 32768, 32768, 32768, 4096, 2269, 55563, 28858, 32768, 32768, 32768, 32768, 32768, 2978, 32768, 19797, 32768, 32768, 32768, 32768, 32768, 7801, 63195, 45184, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 2520, 442, 61067, 35229, 32768, 32768, 32768, 32768, 32768, 2685, 60854, 17051, 32768, 32768, 32768, 32768, 5461, 1195, 63351, 2751, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 44554, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 295, 32768, 32768, 32768, 32768, 4681, 3796, 52043, 45056, 32768, 32768, 32768, 32768, 32768, 13492, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 2978, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 2730, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 118, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 57344, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 2048, 32768, 32768, 22118, 32768, 32768, 32768, 16384, 32768, 32768, 8192, 32768, 32768, 32768, 32768, 32768, 10922, 6553, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 762, 32768, 125, 32768, 32768, 32768, 49152, 57344, 32768, 32768, 32768, 32768, 63608, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 65449, 32768, 32768, 32768, 64980, 64111, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 64838, 32768, 65474, 49152, 65376, 32768, 65015, 10922, 32768, 32768, 60074, 32768, 63488, 32768, 58982, 32768, 62557, 32768, 65046, 32768, 32768, 32768, 64478, 32768, 64989, 32768, 64170, 32768, 58982, 32768, 63975, 32768, 32768, 32768, 65024, 32768, 64773, 32768, 64625, 32768, 61895, 32768, 54613, 32768, 65398, 32768, 16384, 32768, 16384, 32768, 63351, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 151, 32768, 32768, 32768, 235, 37, 32768, 32768, 404, 32768, 32768, 49152, 292, 32768, 32768, 32768, 192, 32768, 32768, 32768, 1953, 32768, 32768, 32768, 528, 32768, 32768, 2978, 222, 32768, 32768, 32768, 284, 32768, 8192, 32768, 1424, 32768, 32768, 2340, 862, 32768, 32768, 32768, 390, 32768, 32768, 32768, 224, 32768, 32768, 32768, 468, 32768, 2520, 32768, 442, 32768, 32768, 32768, 1024, 32768, 32768, 32768, 1092, 32768, 32768, 32768, 668, 32768, 32768, 32768, 173, 32768, 32768, 36755, 254, 32768, 32768, 32768, 1170, 32768, 32768, 32768, 1024, 32768, 32768, 32768, 442, 32768, 32768, 61440, 32768, 32768, 32768, 32768, 1057, 32768, 32768, 32768, 963, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 55705, 36217, 32768, 32768, 32768, 32768, 32768, 32768, 63351, 65378, 32768, 32768, 32768, 65470, 32768, 32768, 65039, 63243, 32768, 32768, 32768, 65334, 32768, 32768, 32768, 61812, 32768, 32768, 60854, 51580, 32768, 32768, 32768, 65046, 32768, 32768, 32768, 65145, 32768, 32768, 54613, 56878, 32768, 32768, 32768, 64443, 32768, 32768, 32768, 64572, 32768, 32768, 60854, 65420, 32768, 32768, 32768, 52218, 32768, 32768, 54613, 65424, 32768, 32768, 32768, 65398, 32768, 32768, 32768, 41191, 32768, 32768, 32768, 62805, 32768, 32768, 60854, 65280, 32768, 32768, 63608, 56068, 32768, 32768, 59408, 65409, 32768, 32768, 38684, 64743, 32768, 32768, 32768, 65267, 32768, 32768, 32768, 65265, 32768, 32768, 32768, 60854, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 3640, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 38353, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 57344, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 2978, 1170, 32768, 58982, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 65534, 56156, 32768, 32768, 65070, 59614, 32768, 32768, 63943, 54225, 32768, 32768, 10922, 32768, 32768, 32768, 24576, 32768, 32768, 32768, 55898, 63488, 16384, 32768, 65173, 64193, 32768, 32768, 64422, 24112, 32768, 32768, 64529, 62883, 963, 32768, 28987, 32768, 32768, 10922, 62508, 65471, 32768, 32768, 64982, 32768, 32768, 32768, 38229, 32768, 32768, 32768, 64864, 24576, 32768, 32768, 40049, 58982, 32768, 32768, 65144, 32768, 32768, 32768, 63424, 65122, 32768, 32768, 62156, 1820, 32768, 32768, 60854, 10922, 32768, 32768, 58088, 32768, 49152, 32768, 58709, 32768, 32768, 32768, 58412, 10922, 32768, 32768, 53833, 32768, 32768, 32768, 36864, 32768, 32768, 32768, 55366, 10922, 32768, 32768, 51882, 32768, 32768, 32768, 62586, 60074, 32768, 32768, 32768, 49152, 32768, 32768, 64499, 63351, 32768, 32768, 65322, 32768, 32768, 32768, 64485, 32768, 32768, 32768, 59205, 32768, 32768, 32768, 10922, 41197, 57344, 35449, 49152, 34588, 32768, 32768, 32768, 18432, 32768, 32768, 32768, 48168, 32768, 32768, 8192, 21923, 32768, 32768, 24576, 13884, 32768, 32768, 57734, 8146, 32768, 32768, 10922, 40049, 32768, 32768, 10922, 4191, 32768, 32768, 6301, 22461, 32768, 32768, 10922, 4201, 32768, 32768, 21504, 48469, 15855, 32768, 10922, 34133, 32768, 32768, 10922, 11389, 32768, 32768, 24576, 5222, 32768, 32768, 10922, 11016, 32768, 32768, 32768, 1966, 10922, 30533, 52, 58982, 32768, 32768, 618, 45531, 32768, 32768, 13462, 20568, 17164, 45875, 10922, 19017, 32768, 32768, 10922, 18118, 32768, 32768, 10922, 25169, 32768, 32768, 10922, 44367, 32768, 32768, 963, 2748, 32768, 32768, 10922, 32768, 32768, 32768, 10922, 65044, 32768, 8192, 65218, 10922, 32768, 32768, 2656, 29491, 32768, 32768, 10922, 32768, 32768, 32768, 61107, 32768, 32768, 16384, 58088, 7021, 32768, 32768, 6553, 54373, 14745, 18970, 62568, 39645, 32768, 32768, 49152, 64143, 36864, 14745, 62323, 65514, 32768, 32768, 45056, 65356, 36864, 23665, 49152, 65352, 32768, 32768, 10922, 65430, 32768, 8936, 10922, 64560, 32768, 32768, 54613, 65093, 36864, 30720, 62122, 65520, 32768, 32768, 49152, 64023, 42130, 35498, 10922, 64736, 32768, 32768, 62050, 65364, 24576, 21065, 10922, 64424, 32768, 32768, 63090, 65357, 49152, 27306, 10922, 65483, 32768, 32768, 62805, 45298, 36864, 24576, 10922, 58982, 32768, 32768, 32768, 65348, 36864, 19660, 63585, 64552, 32768, 32768, 58136, 64740, 32768, 32768, 32768, 64908, 32768, 32768, 143, 56734, 32768, 32768, 10922, 65172, 32768, 32768, 38229, 63608, 32768, 32768, 10922, 58982, 32768, 32768, 10922, 57974, 32768, 32768, 2818, 32768, 32768, 32768, 60620, 65384, 32768, 32768, 2768, 32768, 32768, 32768, 38229, 45875, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 39130, 64625, 36864, 23405, 25404, 5362, 32768, 45875, 55399, 16384, 32768, 32768, 32768, 32768, 32768, 56599, 43115, 61895, 26810, 6553, 16896, 520, 32768, 49152, 19660, 4681, 32768, 32768, 32768, 32768, 61895, 56599, 21504, 5461, 2685, 52130, 50641, 5461, 6553, 21299, 34133, 32768, 32768, 32768, 32768, 32768, 32768, 53248, 6553, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 53833, 32768, 27, 32768, 32768, 32768, 32768, 32768, 26, 36864, 32768, 61799, 16384, 32768, 10922, 49152, 51492, 26425, 39789, 32768, 53248, 57344, 10922, 16384, 63049, 29306, 1031, 26954, 55578, 48533, 65306, 229, 22937, 1638, 7645, 32768, 23405, 32768, 9717, 655, 45875, 32768, 18204, 32768, 32768, 32768, 19660, 32768, 29491, 32768, 33938, 60074, 655, 60854, 1170, 32768, 32768, 32768, 46421, 32768, 32768, 32768, 32768, 32768, 57344, 32768, 12558, 16384, 55844, 8192, 26175, 4998, 9790, 32768, 30427, 65365, 6036, 32768, 57040, 32768, 24660, 32768, 32964, 65159, 32768, 32768, 59753, 49152, 52625, 53248, 52720, 61691, 57440, 45056, 54613, 2730, 51609, 3640, 62025, 32768, 60854, 32768, 38229, 481, 63245, 16384, 64443, 32768, 61440, 32768, 32768, 32768, 38804, 32768, 55898, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 65267, 32768, 60854, 32768, 381, 32768, 49152, 32768, 54613, 32768, 61895, 3276, 60074, 32768, 49152, 32768, 32768, 32768, 49152, 32768, 60854, 60854, 49152, 32768, 32768, 10922, 64225, 32768, 32768, 14043, 40960, 32768, 32768, 32768, 63015, 32768, 16384, 58982, 63195, 32768, 58982, 2978, 32768, 1503, 63715, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 31905, 17920, 32768, 32768, 32768, 32768, 49152, 32768, 63195, 16384, 3640, 58982, 1560, 16384, 32768, 60620, 32768, 53817, 32768, 32768, 32768, 32768, 32768, 63488, 53248, 14529, 3640, 29491, 992, 5461, 32768, 58514, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 63015, 32768, 10142, 4096, 58982, 1310, 5461, 32768, 12934, 63897, 6670, 32768, 32768, 32768, 32768, 32768, 60362, 60074, 12499, 3640, 58982, 655, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 9691, 3640, 58982, 862, 4681, 32768, 32768, 32768, 29354, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 13890, 2978, 58982, 1129, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 54613, 16309, 2978, 58982, 780, 4681, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 57344, 7110, 3640, 58982, 1129, 8192, 32768, 8192, 32768, 50992, 32768, 32768, 32768, 32768, 32768, 8192, 32768, 7457, 4096, 58982, 1057, 4681, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 14894, 54613, 2316, 3640, 58982, 799, 10922, 32768, 8192, 32768, 2520, 32768, 32768, 32768, 32768, 64736, 2841, 10053, 22355, 32768, 32768, 32768, 32768, 32768, 448, 32768, 58034, 32768, 32768, 32768, 32768, 65211, 32768, 4096, 47891, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 8192, 32768, 32768, 32768, 32768, 16384, 65494, 287, 75, 32768, 32768, 32768, 32768, 16384, 2457, 45251, 41506, 32768, 32768, 32768, 32768, 32768, 5461, 61895, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 61440, 32768, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32146, 32738, 318, 62862, 47855, 56618, 35203, 63488, 22001, 42390, 34389, 48459, 32768, 32768, 38229, 11702, 61511, 15055, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 49152, 14336, 8192, 54613, 10922, 32768, 40960, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 12603, 9830, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 45056, 5461, 32768, 13492, 5084, 42340, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 4681, 17644, 29449, 4551, 32768, 32768, 1927, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 22685, 32768, 27726, 12603, 2316, 32768, 22685, 32768, 25486, 32768, 22685, 32768, 22685, 32768, 25486, 32768, 27726, 32768, 18204, 32768, 24576, 16384, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 64478, 63569, 46565, 32768, 63806, 32768, 43008, 32768, 49864, 32768, 55422, 32768, 58982, 32768, 49152, 32768, 342, 10922, 64225, 885, 22625, 6464, 58982, 65403, 63529, 32768, 32768, 32768, 55705, 8192, 64406, 60074, 32768, 55109, 61895, 32768, 52662, 32768, 38229, 10922, 16384, 63608, 65306, 16384, 32768, 49152, 8192, 54613, 59467, 33020, 49737, 19504, 61603, 27306, 35918, 26731, 2808, 40584, 32768, 38666, 32768, 61725, 48128, 32768, 64512, 63897, 44333, 32768, 59886, 56360, 32768, 32768, 63351, 64478, 32768, 32768, 63811, 63975, 32768, 32768, 63715, 61895, 32768, 32768, 56360, 59392, 32768, 32768, 63975, 62259, 32768, 32768, 63608, 62805, 60074, 32768, 63811, 52932, 32768, 32768, 30468, 31531, 4096, 3640, 32768, 32768, 64543, 32768, 4096, 32768, 1092, 32768, 32768, 32768, 61895, 32768, 65441, 3640, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 1820, 32768, 32768, 65027, 28, 8936, 32768, 63195, 22528, 8822, 60854, 5383, 39547, 26093, 32768, 11, 65470, 32768, 32768, 32768, 6553, 32768, 64111, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 68, 49152, 32768, 1290, 18857, 7447, 187, 54613, 62259, 3640, 27306, 27306, 39139, 12822, 32768, 49152, 54613, 49152, 32768, 62259, 14894, 49152, 8192, 32768, 64599, 28672, 14043, 32768, 64794, 65413, 32768, 49152, 32768, 54613, 49152, 57344, 16384, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 57344, 8192, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 56599, 2137, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 56599, 32768, 32768, 32768, 54613, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 43600, 32768, 32768, 49152, 414, 32768, 32768, 3948, 64275, 32768, 2978, 62697, 61497, 32768, 32768, 63897, 65417, 32768, 32768, 64785, 54071, 32768, 32768, 63715, 55563, 32768, 32768, 63715, 64853, 32768, 32768, 64322, 65379, 32768, 32768, 32768, 57344, 32768, 32768, 32768, 65376, 16384, 65414, 40960, 58982, 32768, 32768, 63608, 65015, 32768, 32768, 60876, 58664, 32768, 1638, 64577, 65381, 62805, 32768, 63755, 64583, 32768, 32768, 32768, 58982, 32768, 32768, 63715, 26237, 32768, 32768, 390, 62805, 32768, 54613, 62713, 46180, 32768, 58982, 57845, 61913, 24311, 32768, 61278, 64356, 4537, 58982, 64971, 63073, 32768, 32768, 32768, 65367, 32768, 32768, 63715, 51118, 32768, 32768, 62557, 44187, 32768, 32768, 61603, 58088, 32768, 32768, 32768, 58982, 32768, 54613, 63015, 53248, 19660, 32768, 32768, 32768, 64823, 16384, 52552, 15521, 36109, 229, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 59467, 40960, 31857, 2184, 36864, 32768, 32768, 61440, 38912, 32768, 54613, 32768, 32768, 32768, 51492, 10510, 6553, 32768, 57258, 41, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 24576, 9452, 23405, 40960, 11943, 73, 28672, 32768, 32768, 60854, 38229, 32768, 63015, 32768, 32768, 32768, 45702, 7220, 32768, 32768, 50464, 214, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 40960, 12822, 4681, 12603, 15695, 1724, 40049, 32768, 32768, 60854, 32768, 32768, 61895, 32768, 61440, 32768, 444, 16652, 32768, 64572, 35880, 3365, 1927, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 18204, 32768, 6553, 5564, 40049, 54613, 26615, 1489, 25746, 32768, 32768, 60854, 25320, 32768, 49152, 32768, 32768, 32768, 25486, 32768, 32768, 63975, 32768, 1365, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54886, 32768, 22937, 49152, 28672, 2978, 16384, 32768, 50517, 60854, 33938, 32768, 60854, 32768, 62122, 32768, 26942, 57344, 32768, 49152, 47219, 202, 60074, 32768, 64111, 32768, 32768, 32768, 65067, 32768, 63015, 32768, 8192, 32768, 62259, 54613, 42697, 2520, 45641, 32768, 61895, 60854, 27069, 32768, 61440, 32768, 32768, 32768, 32768, 32768, 32768, 60074, 4681, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 61440, 32768, 32768, 32768, 37059, 60074, 10922, 57344, 45436, 2520, 36044, 32768, 32768, 60854, 37236, 32768, 63195, 32768, 64838, 32768, 49152, 32768, 32768, 32768, 10685, 50641, 62259, 32768, 49152, 32768, 32768, 32768, 64599, 32768, 32768, 32768, 26624, 32768, 57344, 40960, 29257, 2520, 23405, 32768, 54613, 60854, 30427, 32768, 60074, 32768, 32768, 32768, 5461, 32768, 32768, 32768, 47331, 201, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32137, 32768, 3640, 24365, 10332, 655, 24576, 32768, 32768, 60854, 34406, 32768, 63015, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 44002, 57344, 32768, 54613, 16552, 3640, 32768, 32768, 32768, 60854, 30720, 32768, 61440, 32768, 32768, 32768, 51492, 16384, 32768, 62259, 42537, 448, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 728, 24483, 64940, 9102, 57974, 28279, 12014, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 65099, 32768, 32768, 32768, 55653, 2048, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 64, 32768, 32768, 537, 32768, 51794, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 57090, 448, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 53248, 32768, 9102, 32768, 47891, 44683, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 1927, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 40960, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 1789, 50838, 33383, 12540, 6159, 10922, 40711, 5443, 39594, 54560, 14443, 40274, 54314, 24268, 57344, 57040, 29905, 26767, 4096, 33753, 54374, 16842, 45056, 4428, 32768, 32768, 32768, 32768, 16384, 54613, 42130, 1092, 34274, 50445, 53833, 63351, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 30197, 32768, 57344, 32768, 32768, 54613, 32768, 10922, 35027, 60074, 49152, 32768, 32768, 32768, 24576, 32768, 9830, 2730, 3091, 32768, 32768, 32768, 32768, 32768, 799, 32768, 32768, 32768, 32768, 32768, 54613, 32768, 17644, 16384, 25486, 32768, 32768, 54613, 32768, 32768, 28912, 38725, 29491, 32768, 27726, 40960, 25486, 32768, 10922, 32768, 27726, 32768, 1638, 32768, 1260, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 65194, 63395, 46749, 32768, 37683, 60074, 29318, 16384, 26473, 12743, 44011, 14619, 8192, 32768, 63015, 32768, 32768, 32768, 65110, 32768, 60074, 64443, 54613, 32768, 63715, 32768, 60854, 32768, 55705, 32768, 62958, 16384, 58982, 26021, 32768, 32768, 57057, 14894, 44470, 6553, 59426, 50889, 19192, 39069, 63608, 32768, 53248, 16384, 53903, 8192, 32768, 32768, 60854, 49152, 32768, 32768, 20730, 60074, 32768, 32768, 61440, 32768, 65015, 32768, 63811, 62557, 60854, 32768, 63811, 62805, 38725, 16384, 8242, 60620, 62661, 61895, 63897, 53248, 16384, 32768, 61895, 63488, 63488, 32768, 63975, 63811, 32768, 32768, 63351, 5033, 122, 32768, 63195, 63811, 30508, 32768, 63608, 43253, 32768, 32768, 58982, 58982, 32768, 32768, 62259, 61812, 32768, 57344, 11210, 32768, 8192, 32768, 49152, 32768, 32768, 32768, 49152, 58982, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 28584, 45875, 36864, 24576, 44333, 32768, 10922, 45618, 63975, 10922, 32768, 6144, 43978, 32768, 32768, 32768, 39789, 32768, 32768, 64512, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 8192, 32768, 32768, 32768, 54613, 32768, 32768, 36715, 65150, 29733, 54613, 60074, 61895, 32768, 32768, 32768, 60854, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 12288, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 63015, 32768, 16384, 32768, 32768, 32768, 32768, 992, 32085, 32768, 32768, 57344, 58982, 32768, 32768, 32768, 54613, 32768, 32768, 32768, 57344, 32768, 32768, 32768, 8192, 32768, 8192, 63608, 49152, 10922, 32768, 4681, 2234, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 60074, 58982, 9637, 32768, 32768, 45875, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 65158, 32768, 32768, 49152, 43985, 48188, 32768, 12521, 33147, 32768, 240, 5787, 60515, 46421, 55014, 61603, 64917, 32768, 32768, 62805, 61705, 42598, 17644, 65205, 63380, 32768, 32768, 63015, 48783, 47331, 9830, 54613, 57344, 32768, 32768, 57344, 54394, 53248, 24029, 49152, 65039, 32768, 32768, 35498, 59971, 28398, 34816, 56433, 54613, 32768, 32768, 61261, 63239, 41870, 20852, 32768, 62805, 32768, 32768, 58982, 64068, 49152, 20852, 32768, 65246, 32768, 32768, 64791, 64225, 59753, 24576, 16384, 6553, 32768, 32768, 4096, 53382, 23405, 24576, 37137, 61755, 62259, 49152, 57344, 19773, 32768, 32768, 64023, 65523, 32768, 32768, 376, 36548, 32768, 49152, 54613, 14359, 32768, 32768, 60854, 4681, 32768, 32768, 58861, 49152, 32768, 16384, 6036, 63715, 53328, 60074, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 63897, 32768, 16384, 16384, 32768, 32768, 44002, 63864, 6963, 32768, 26810, 42130, 16384, 32768, 38229, 57974, 2978, 61895, 11513, 40049, 32768, 63488, 63543, 28160, 5782, 16035, 43557, 28001, 4681, 32768, 32768, 49152, 4096, 32768, 32768, 32768, 32768, 32768, 32768, 45875, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 40960, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 47689, 6553, 62680, 32768, 8192, 6553, 16384, 32768, 16875, 61895, 38104, 9485, 58982, 32768, 65426, 32768, 63195, 32768, 2091, 57344, 32768, 32768, 32768, 56599, 10060, 61440, 24576, 20852, 19456, 14043, 32768, 32768, 32768, 8192, 19660, 32768, 10922, 16384, 4096, 32768, 63403, 32768, 20852, 63351, 26810, 32768, 19660, 32768, 12072, 32768, 4915, 32768, 1365, 32768, 177, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 65066, 32768, 20852, 3276, 56713, 4681, 19869, 1638, 61787, 64406, 52912, 32768, 19660, 32768, 14646, 32768, 63897, 32768, 32768, 32768, 54613, 32768, 41571, 62259, 44021, 4681, 39816, 32768, 63015, 32768, 60074, 32768, 58982, 32768, 55514, 32768, 45452, 32768, 45483, 44236, 885, 32768, 65205, 32768, 32768, 32768, 64322, 32768, 60854, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 65121, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 63975, 63351, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 32768, 54613, 32768, 62805, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 49152, 32768, 30427, 12795, 32768, 32768, 57344, 32768, 32768, 32768, 58982, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 63715, 9557, 32768, 32768, 32768, 32768, 32768, 32768, 53322, 32768, 32768, 49152, 32768, 32768, 51, 52792, 54613, 10922, 32768, 32768, 32768, 32768, 32768, 63608, 16384, 28912, 32768, 32768, 32768, 32768, 32768, 59753, 32768, 27306, 32768, 32768, 32768, 32768, 32768, 58982, 32768, 34588, 6553, 18432, 32768, 16384, 32768, 61440, 8192, 25746, 32768, 32768, 32768, 32768, 32768, 63715, 49152, 14745, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 21065, 6553, 32768, 32768, 65489, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 61895, 49152, 16384, 8192, 60074, 16384, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 4818, 6553, 32768, 32768, 2286, 58982, 32768, 18204, 819, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 6553, 64512, 32768, 49152, 24576, 32768, 32768, 6418, 32768, 12288, 64512, 32768, 49152, 49152, 19660, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 64838, 32768, 4681, 1489, 61895, 30037, 32768, 32768, 32768, 32768, 32768, 32768, 504, 59392, 32768, 4096, 32768, 474, 32768, 799, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 65495, 32768, 32768, 32768, 32768, 32768, 55705, 32768, 65366, 64572, 32768, 32768, 49152, 32768, 54613, 32768, 6553, 10922, 54613, 32768, 32768, 32768, 57344, 32768, 2520, 54613, 38229, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 43731, 42835, 41396, 25486, 25029, 50418, 27214, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 3276, 22937, 31987, 7123, 32768, 56599, 18204, 32768, 32768, 2048, 32768, 32768, 2520, 39547, 43194, 32768, 32768, 32768, 1489, 32768, 32768, 32768, 32768, 32768, 32768, 2184, 28398, 34133, 2978, 49152, 32768, 32768, 52001, 21540, 39982, 45471, 1560, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 55705, 32768, 32768, 32768, 32768, 49152, 35027, 5461, 32768, 32768, 3276, 5461, 21572, 41752, 46133, 2978, 63488, 6553, 9830, 32768, 32768, 10922, 32768, 2978, 26396, 25869, 32768, 32768, 16384, 2520, 32768, 32768, 22685, 32768, 16384, 32768, 3640, 22685, 29225, 6553, 40049, 32768, 19660, 60074, 35195, 5535, 43115, 32768, 19660, 32768, 18204, 32768, 1057, 32768, 1489, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 65208, 61845, 64431, 32768, 9557, 34028, 36864, 3640, 28968, 16384, 62336, 60779, 40671, 28262, 7021, 32768, 49152, 32768, 65183, 16384, 32768, 58982, 32768, 2730, 56236, 26466, 51492, 20852, 64695, 1927, 58206, 32768, 58982, 43369, 32768, 32768, 7755, 37768, 47566, 819, 52130, 14894, 45875, 61720, 50665, 64619, 20442, 728, 50790, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 53248, 49152, 4096, 32768, 54613, 49152, 65365, 32768, 63608, 62557, 54613, 32768, 53106, 25559, 29918, 4096, 63811, 63811, 32768, 48188, 50507, 38466, 7344, 3640, 59753, 53833, 64716, 32768, 63608, 62805, 32768, 8192, 54613, 43417, 32768, 32768, 63975, 31675, 64443, 32768, 63351, 62557, 32768, 32768, 64543, 63811, 32768, 32768, 61440, 32768, 58982, 32768, 5285, 57344, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 5461, 32768, 32768, 258, 28820, 32768, 2730, 6553, 32768, 3640, 42962, 59865, 23078, 9242, 32768, 49152, 40960, 32768, 32768, 32768, 32768, 49152, 2340, 48188, 24029, 32768, 32768, 32768, 1724, 32768, 32768, 32768, 16384, 32768, 32768, 10922, 50641, 32768, 16384, 32768, 32768, 32768, 60074, 39876, 63629, 12660, 2520, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 6553, 25395, 31576, 25869, 32768, 45056, 32768, 32768, 32768, 32768, 32768, 32768, 2978, 55898, 34133, 32768, 32768, 32768, 1424, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 16384, 6553, 32768, 32768, 10922, 32768, 54613, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 65061, 32768, 32768, 49152, 8192, 32768, 32768, 5529, 63603, 32768, 6553, 64406, 61895, 32768, 52713, 42284, 56228, 1489, 1170, 58709, 54272, 32768, 32768, 63219, 62735, 32768, 2978, 48332, 39867, 32768, 32768, 32768, 1560, 32768, 32768, 64807, 51176, 32768, 32768, 32768, 65433, 32768, 32768, 32768, 32768, 32768, 32768, 63582, 35810, 1310, 32768, 32768, 65152, 32768, 32768, 49152, 65211, 32768, 32768, 32768, 63715, 32768, 32768, 60854, 65319, 32768, 32768, 60074, 64443, 32768, 32768, 36864, 6553, 32768, 32768, 32768, 65269, 16384, 16384, 38892, 35918, 52900, 32768, 62398, 53870, 32768, 32768, 65080, 65493, 32768, 2978, 52043, 6144, 32768, 32768, 60074, 3780, 32768, 32768, 54613, 2048, 32768, 32768, 89, 45056, 32768, 32768, 60854, 16384, 32768, 59722, 12899, 64118, 35850, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 910, 18568, 32768, 1927, 10922, 32768, 32768, 38725, 26065, 33374, 24576, 32768, 32768, 4096, 32768, 32768, 1489, 32768, 32768, 2978, 45056, 27913, 32768, 32768, 32768, 1260, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 63195, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 57344, 32768, 32768, 32768, 2006, 30294, 3276, 3276, 32768, 32768, 32768, 39514, 48128, 13963, 42173, 885, 61107, 5461, 3640, 32768, 32768, 32768, 32768, 2978, 47014, 30427, 32768, 32768, 32768, 1820, 32768, 32768, 32768, 6553, 32768, 32768, 235, 22566, 32768, 32768, 32768, 32768, 32768, 63053, 63638, 47747, 60362, 16384, 32768, 32768, 32768, 32768, 5461, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 61440, 32768, 14043, 36623, 61440, 8192, 5742, 32768, 62805, 45511, 59467, 2782, 12822, 10922, 58088, 32768, 63015, 54613, 32768, 32768, 32768, 32768, 60362, 6553, 7021, 49152, 54022, 4096, 60854, 32768, 54613, 32768, 32768, 32768, 50641, 65271, 32768, 32768, 52932, 32768, 64695, 32768, 44127, 61261, 188, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 64478, 32768, 32768, 32768, 62083, 32768, 32768, 51200, 32768, 6553, 3640, 32768, 63488, 62805, 5734, 1560, 32768, 32768, 32768, 32768, 54613, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 14043, 32768, 32768, 32768, 32768, 32768, 32768, 6553, 32768, 8192, 58982, 32768, 32768, 32768, 7123, 15360, 5461, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 1489, 32768, 32768, 5461, 32768, 16384, 32768, 57344, 42130, 32768, 63715, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 16384, 32768, 32768, 32768, 32768, 32768, 4096, 32768, 32768, 774, 24879, 32768, 19660, 32768, 32768, 32768, 64572, 16384, 38229, 289, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 520, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 4681, 32768, 32768, 138, 32768, 32768, 32768, 1638, 54613, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 57344, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 4851, 1222, 60757, 49412, 1463, 12142, 64159, 57344, 26733, 19504, 39110, 22420, 29318, 4880, 61417, 26388, 59684, 28356, 20889, 4603, 52043, 37622, 58841, 5565, 31278, 61929, 5354, 31948, 25486, 32768, 6301, 23552, 65276, 34549, 32320, 8539, 56919, 26731, 30155, 29307, 2048, 50327, 8108, 50948, 20852, 62237, 1674, 4681, 42130, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 6553, 16384, 16384, 4681, 28672, 36864, 61208, 32768, 31373, 1384, 1342, 1606, 57344, 2184, 10922, 64989, 2978, 32768, 32768, 10922, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 315, 32768, 489, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 65426, 63934, 65013, 32768, 32768, 10922, 32768, 32768, 62259, 32768, 56533, 6553, 29491, 36044, 12288, 32768, 64710, 19114, 23574, 51882, 22420, 9216, 32458, 23018, 9830, 32768, 60074, 54613, 64275, 16384, 63488, 32768, 65153, 29866, 1638, 32768, 37053, 53703, 32768, 64383, 10922, 32768, 49152, 32768, 60074, 32768, 32768, 32768, 54900, 32768, 32768, 49152, 63811, 49152, 32768, 54613, 25721, 55705, 32768, 32768, 32768, 61895, 64893, 32768, 63975, 63195, 64225, 32768, 62557, 63488, 32768, 32768, 64225, 63195, 54613, 5461, 57344, 54613, 8192, 32768, 36548, 38229, 18204, 35840, 40632, 63715, 32768, 57344, 23552, 63975, 16384, 57344, 63015, 61440, 49152, 32768, 63015, 63015, 32768, 32768, 64170, 63195, 32768, 32768, 40960, 32768, 32768, 32768, 461, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 57344, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 18147, 29075, 25307, 32768, 8192, 32768, 32768, 1260, 19660, 1927, 2978, 35498, 30037, 36044, 32768, 3205, 5734, 9830, 49152, 64940, 32768, 436, 27949, 32768, 32768, 4681, 32768, 32768, 59753, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 57344, 32768, 32768, 32768, 19660, 32768, 54613, 40960, 49152, 49152, 16384, 4681, 20852, 10922, 16384, 32768, 32768, 32768, 32768, 3640, 11098, 40413, 17373, 32768, 32768, 32768, 32768, 504, 26362, 1638, 14043, 38725, 26810, 34916, 32768, 1158, 15639, 728, 30427, 63841, 45056, 32768, 58982, 32768, 4096, 32768, 32768, 32768, 57344, 16384, 32768, 2048, 219, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 59684, 32768, 10922, 49152, 51492, 32768, 32768, 630, 4537, 32768, 4880, 54613, 32768, 32768, 32768, 32768, 32768, 10922, 14894, 32768, 65445, 32768, 32768, 32768, 58191, 51118, 6826, 64170, 65217, 32768, 32768, 61603, 63435, 50641, 4681, 47331, 57344, 16384, 32768, 52762, 53295, 22341, 21270, 64950, 65173, 32768, 54613, 63897, 64242, 47331, 32768, 49152, 32768, 32768, 32768, 32768, 52830, 55705, 28398, 56599, 65014, 32768, 32768, 32768, 63529, 60854, 17164, 54613, 6553, 32768, 32768, 49152, 64543, 47331, 7561, 32768, 62805, 32768, 32768, 60074, 62050, 60854, 25746, 53007, 59073, 32768, 32768, 32768, 55978, 57344, 40478, 32768, 2340, 32768, 32768, 25486, 52064, 38725, 19114, 64265, 46565, 32768, 32768, 42598, 40960, 16384, 25486, 64980, 60854, 32768, 61895, 315, 46327, 32768, 32768, 32768, 6553, 32768, 32768, 64225, 10922, 32768, 32768, 62364, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 7880, 63696, 23552, 58412, 27909, 37787, 32768, 59392, 12014, 32768, 32768, 32768, 32768, 32768, 8192, 42598, 44165, 61440, 2340, 32768, 54613, 32768, 32768, 32768, 20083, 32768, 32768, 32768, 32768, 32768, 54613, 29918, 45056, 58982, 32768, 57344, 30037, 8192, 32768, 4096, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 40960, 16384, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 1820, 58982, 32768, 32768, 32768, 32768, 54613, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 34816, 16384, 32768, 32768, 49152, 32768, 49152, 44782, 12288, 24496, 64512, 1560, 4201, 49152, 10922, 13653, 57344, 60854, 62259, 32768, 32768, 32768, 16384, 8192, 512, 32768, 54613, 32768, 36044, 8192, 8192, 32768, 1424, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 26916, 10922, 32768, 32768, 32768, 16384, 32768, 9830, 54501, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 43844, 16384, 55296, 36864, 32768, 910, 35556, 32768, 63195, 32768, 64406, 32768, 49473, 32768, 65396, 10922, 24170, 65291, 32768, 32768, 45875, 32768, 25453, 2978, 44145, 32768, 49973, 32768, 61086, 32768, 63715, 4096, 58343, 32768, 31675, 32768, 27788, 762, 42684, 32768, 162, 32768, 32768, 32768, 32768, 32768, 2656, 49152, 45452, 32768, 59164, 32768, 16384, 32768, 32768, 64998, 3640, 32768, 32768, 32768, 63811, 32768, 64512, 54613, 324, 32768, 32768, 32768, 32768, 32768, 8936, 10922, 18970, 16384, 489, 32768, 58982, 32768, 32768, 32768, 62557, 29257, 57344, 32768, 16384, 10922, 32768, 53833, 25486, 10922, 57526, 32768, 32768, 32768, 64625, 32768, 2808, 54613, 32768, 32768, 59517, 16384, 19114, 3469, 54613, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 65446, 32768, 54613, 32768, 49152, 16384, 32768, 32768, 38513, 41351, 32768, 32768, 32768, 32768, 32768, 32768, 60362, 19660, 8192, 58982, 2978, 8192, 8192, 53463, 5461, 25544, 32768, 32768, 60074, 32768, 1724, 23893, 22937, 55995, 16384, 29491, 2730, 50846, 32768, 46369, 60854, 7253, 32768, 32768, 32768, 32768, 16384, 25007, 54613, 29918, 16384, 42130, 12603, 6553, 4096, 5147, 53463, 30219, 32768, 32768, 32768, 32768, 32768, 52224, 58982, 7927, 32768, 60074, 2978, 4096, 32768, 12970, 64225, 45428, 32768, 32768, 32768, 32768, 32768, 32768, 60074, 15055, 32768, 58982, 3276, 10922, 32768, 4681, 32768, 26080, 32768, 32768, 32768, 32768, 6553, 32768, 9102, 31129, 6553, 29491, 2730, 16384, 8192, 2184, 27306, 51492, 32768, 16384, 32768, 32768, 32768, 10922, 54613, 14283, 10922, 58982, 2730, 8192, 32768, 2340, 57974, 14619, 32768, 32768, 32768, 32768, 16384, 4378, 60074, 29907, 10922, 58982, 5461, 6553, 32768, 2048, 60854, 45029, 32768, 32768, 32768, 32768, 32768, 8192, 49152, 23405, 16384, 42130, 5461, 5461, 16384, 32768, 64917, 16384, 32768, 32768, 32768, 32768, 4096, 2978, 60571, 8957, 63138, 61895, 70, 1424, 6553, 1780, 61440, 31065, 32768, 49152, 32768, 32768, 10922, 5510, 60662, 3437, 32768, 32768, 49152, 4681, 32768, 481, 32768, 9741, 32768, 32768, 32768, 32768, 65509, 32768, 1927, 992, 32768, 32768, 32768, 32768, 32768, 51492, 32768, 776, 32768, 32768, 32768, 32768, 32768, 16384, 57344, 32768, 32768, 32768, 32768, 32768, 8192, 1462, 57450, 59886, 54613, 32768, 60854, 32768, 40049, 62805, 8192, 44373, 64608, 28398, 32768, 60854, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 4681, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 963, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 59753, 489, 49152, 14043, 46724, 1024, 49152, 32768, 30427, 32768, 16384, 16384, 16384, 32768, 32768, 32768, 32768, 32768, 41224, 22937, 32768, 45875, 10922, 2730, 26241, 63195, 16384, 8192, 5461, 32768, 32768, 64478, 63351, 32558, 48655, 9830, 52130, 14894, 19504, 18022, 606, 57974, 24903, 32768, 5461, 32768, 32768, 32768, 60854, 32768, 44333, 19660, 2978, 63811, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 40960, 56512, 5461, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 36491, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 2730, 49152, 55393, 54613, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 65478, 62677, 32768, 32768, 62557, 55, 32768, 32768, 57929, 32768, 37622, 8192, 32768, 32768, 54613, 32768, 114, 1638, 45056, 64980, 58097, 32768, 7447, 18811, 32768, 6553, 32768, 32768, 64599, 65254, 61107, 16384, 52512, 64493, 32768, 32768, 49730, 16384, 49152, 32768, 32768, 32768, 49152, 32768, 62805, 61895, 32768, 32768, 56014, 54613, 10922, 6553, 65283, 56599, 16384, 54613, 37398, 63015, 32768, 51492, 32768, 60854, 32768, 32768, 63195, 64111, 42358, 64625, 25486, 63897, 49152, 32768, 49152, 63715, 2978, 32768, 64170, 63195, 49152, 32768, 63015, 40049, 6301, 49152, 29979, 49971, 32768, 53106, 63488, 64275, 16384, 54613, 63975, 55296, 54613, 32768, 64046, 60074, 37683, 48318, 18248, 25634, 16384, 49152, 42130, 32768, 32768, 32768, 2897, 32768, 32768, 32768, 57344, 32768, 60074, 32768, 60074, 19456, 3276, 16384, 54613, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 32768, 8822, 721, 32768, 32768, 2520, 53463, 2520, 40960, 63811, 58982, 60854, 32768, 708, 34882, 2048, 45056, 62805, 32768, 10922, 65258, 32768, 63015, 32768, 54613, 32768, 32768, 32768, 32768, 49152, 49152, 25746, 49152, 32768, 25941, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 58982, 15745, 32768, 23058, 44960, 728, 18204, 20024, 936, 61038, 3780, 61440, 16384, 54613, 32768, 32768, 58982, 32768, 39666, 58982, 20549, 30720, 32768, 32768, 32768, 54613, 10922, 32768, 32768, 32768, 32768, 32768, 49152, 25553, 32768, 365, 64111, 2048, 32768, 32768, 49152, 32768, 32768, 58982, 49152, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 57344, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 64275, 27726, 32768, 32768, 32768, 32768, 32768, 32768, 58982, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 61440, 62099, 32768, 32768, 64322, 32768, 54613, 49152, 62259, 64897, 32768, 16384, 60362, 64673, 32768, 8192, 64838, 65429, 32768, 32768, 59148, 33078, 10922, 54613, 65355, 52959, 32768, 61440, 65268, 54547, 16384, 32768, 49152, 64818, 32768, 32768, 32768, 58982, 57344, 32768, 1129, 65067, 32768, 32768, 32768, 16384, 32768, 32768, 60074, 32768, 62259, 32768, 65447, 50408, 38229, 32768, 63652, 50273, 32768, 54613, 63491, 63012, 8192, 55705, 32768, 58709, 32768, 32768, 63715, 60283, 32768, 32768, 49152, 51882, 49152, 32768, 63500, 58818, 32768, 32768, 62673, 61763, 32768, 32768, 61440, 60340, 11811, 62557, 65110, 60854, 32768, 32768, 63652, 52313, 16384, 49152, 64961, 40543, 32768, 32768, 63811, 64375, 32768, 32768, 62146, 44782, 32768, 32768, 62259, 61895, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 62805, 16384, 31087, 25122, 25027, 409, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 63351, 81, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 15, 32768, 57344, 12072, 2730, 32768, 46107, 3389, 8192, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 19660, 32768, 32768, 27627, 3417, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 1704, 10922, 32768, 54613, 23540, 221, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 61925, 32768, 32768, 49152, 32768, 64275, 15403, 22851, 4681, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 60074, 32768, 728, 5782, 5461, 1560, 46640, 2048, 8192, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 65424, 32768, 3388, 25320, 32768, 58982, 17806, 12288, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 13492, 32768, 32768, 63488, 58931, 1092, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 63715, 32768, 32768, 10922, 17164, 32768, 32768, 32768, 63488, 32768, 62805, 32768, 32768, 32768, 35027, 6553, 45056, 63351, 57344, 32768, 30193, 1424, 62805, 40960, 10922, 3640, 22937, 63015, 10922, 102, 32768, 6553, 32768, 32768, 49152, 32768, 64322, 16384, 32768, 10922, 49152, 57344, 32768, 32768, 57344, 32768, 60854, 17644, 58982, 32768, 49152, 16384, 7835, 32768, 10922, 45875, 20852, 57344, 32768, 32768, 64365, 32768, 54613, 32768, 26731, 49152, 32768, 64512, 14581, 14336, 32768, 16384, 42130, 16384, 18022, 32768, 32768, 32768, 54613, 58982, 20083, 47331, 24576, 65317, 15758, 963, 60854, 32768, 10922, 36864, 57344, 32768, 32768, 32768, 63608, 32768, 28770, 56912, 49152, 64929, 7359, 35, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 49152, 32768, 63715, 64751, 528, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 31519, 61895, 10922, 5079, 5643, 481, 49152, 32768, 16384, 32768, 32768, 32768, 49152, 32768, 210, 1560, 49152, 63351, 49152, 16384, 16384, 2730, 16384, 32768, 32768, 60074, 32768, 16384, 4681, 16384, 49152, 32768, 51808, 54613, 32768, 58982, 6717, 270, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 64443, 58136, 1804, 35108, 13653, 65104, 34386, 453, 6553, 59164, 23405, 14043, 32768, 32768, 32768, 32768, 62557, 32768, 17285, 16384, 16384, 63897, 23624, 13528, 4752, 32768, 4681, 54613, 32768, 32768, 64322, 32768, 32768, 32768, 65046, 32768, 32768, 57344, 63975, 2730, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 30755, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 50540, 1560, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 36864, 49152, 32768, 1480, 32768, 32768, 49152, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 95, 16384, 60074, 61895, 32768, 108, 32768, 64023, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 16384, 32768, 32768, 49152, 32768, 32768, 61895, 120, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 65355, 32768, 49152, 8192, 24576, 16384, 32768, 40960, 32768, 60074, 27306, 60074, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 64365, 16384, 32768, 6553, 32768, 5461, 32768, 32768, 32768, 51973, 27826, 7239, 18204, 55033, 6339, 35108, 60074, 58751, 48856, 12822, 25057, 31326, 14152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 4096, 32768, 8192, 58982, 5356, 32768, 4274, 32768, 18539, 23728, 34640, 22140, 41624, 45875, 32768, 32768, 58982, 20852, 26810, 8192, 32768, 32768, 32768, 32768, 26940, 63195, 32768, 32768, 32768, 32768, 63608, 32768, 63488, 27069, 32768, 2730, 32768, 32768, 32768, 32768, 32768, 32768, 64599, 32768, 6553, 32768, 32768, 32768, 30128, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 19660, 32768, 32768, 10922, 35816, 35617, 1820, 32768, 4468, 780, 108, 45875, 32768, 32768, 32768, 57344, 36798, 10142, 6553, 2229, 58073, 29766, 2048, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 1310, 32768, 161, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 65513, 40527, 65054, 32768, 60854, 6553, 16384, 32768, 63053, 32768, 56408, 16384, 33731, 26425, 2520, 32768, 1560, 10922, 65099, 54613, 59886, 32768, 1638, 65475, 27271, 30856, 34837, 25721, 48199, 4210, 64406, 32768, 57690, 62032, 14043, 10922, 41100, 32768, 65331, 32768, 39161, 32768, 62259, 32768, 54613, 32768, 65024, 32768, 56282, 39547, 28216, 1724, 65469, 58982, 32768, 32768, 16384, 64275, 64625, 32768, 32768, 32768, 65305, 32768, 64322, 63488, 54613, 32768, 63488, 60854, 32768, 32768, 61067, 64111, 31402, 32768, 51492, 46327, 29696, 32768, 63811, 60074, 62557, 32768, 63715, 63015, 32768, 62557, 27052, 16503, 75, 50041, 40366, 13516, 58982, 32768, 63897, 63715, 32768, 32768, 62557, 63195, 32768, 32768, 32768, 32768, 32768, 32768, 6164, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 57344, 32768, 32768, 32768, 54613, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 29668, 29949, 20591, 32768, 1820, 32768, 32768, 1858, 27306, 3880, 19114, 40413, 37236, 43300, 32768, 1890, 8192, 32768, 54613, 36310, 32768, 12603, 64046, 33406, 8192, 6735, 51767, 53014, 12983, 32768, 32768, 32768, 22937, 16384, 16384, 32768, 63897, 32768, 32768, 32768, 54613, 32768, 61440, 32768, 58982, 63078, 64625, 63351, 31507, 30895, 1927, 60854, 32768, 60074, 32768, 16384, 4998, 64512, 32768, 16384, 32768, 32768, 32768, 5461, 6371, 38229, 19869, 32768, 32768, 32768, 32768, 381, 33659, 239, 27472, 35225, 31507, 45219, 16384, 58982, 57344, 16384, 32768, 32768, 32768, 32768, 65144, 14092, 20795, 1638, 18887, 63181, 15796, 163, 32768, 2520, 2226, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 61603, 57344, 10922, 60854, 32768, 32768, 32768, 618, 3996, 32768, 8519, 49152, 32768, 32768, 32768, 32768, 14043, 32768, 32768, 32768, 31500, 32768, 32768, 32768, 59753, 30427, 8192, 64111, 64151, 32768, 32768, 44530, 54067, 12109, 8192, 46694, 57432, 16384, 32768, 56686, 51457, 61812, 29318, 58585, 64772, 17644, 62805, 52306, 36002, 11682, 49251, 56342, 8822, 32768, 32768, 49152, 55794, 39789, 30427, 32768, 65495, 32768, 32768, 32768, 55296, 47331, 14894, 32768, 49152, 64755, 32768, 63015, 58705, 37340, 1560, 49152, 64650, 32768, 32768, 32768, 64488, 59499, 32768, 64950, 62266, 32768, 32768, 64322, 59152, 41350, 15291, 32768, 32768, 32768, 32768, 3007, 65303, 4391, 30214, 65126, 64980, 63015, 32768, 46565, 47166, 32768, 32768, 65031, 65104, 32768, 65220, 399, 1878, 8192, 29491, 63924, 33665, 32768, 32768, 32768, 32768, 32768, 32768, 57344, 16384, 32768, 32768, 61895, 62557, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 56599, 40960, 5461, 16384, 32768, 32768, 32768, 61440, 2520, 54613, 6553, 40960, 20480, 32768, 21065, 57344, 30294, 21162, 15578, 20134, 22140, 8192, 32768, 32768, 58982, 52932, 18432, 16384, 32768, 32768, 32768, 32768, 8192, 29277, 26559, 32768, 32768, 32768, 64543, 32768, 62259, 41590, 32768, 2730, 32768, 32768, 32768, 32768, 32768, 9242, 56744, 32768, 32768, 32768, 32768, 32768, 35108, 14417, 6199, 32768, 8192, 32768, 32768, 32768, 14043, 32768, 27104, 32768, 32768, 32768, 62259, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 41208, 35159, 32768, 34151, 61356, 135, 15185, 32768, 32768, 32768, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 6553, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 1129, 32768, 1724, 32768, 32768, 4681, 2586, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 55863, 32768, 63488, 32768, 32768, 32768, 63015, 32768, 40960, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 62146, 40960, 57344, 32768, 3276, 32768, 32203, 27306, 34462, 54205, 31311, 32768, 64650, 32768, 46484, 14745, 31252, 16384, 32768, 32768, 60948, 32768, 5461, 32768, 48371, 32768, 32768, 32768, 64443, 32768, 61895, 32768, 29876, 2340, 65358, 32768, 32768, 32768, 32768, 32768, 33480, 32768, 32768, 32768, 65136, 32768, 32768, 32768, 64111, 32768, 32768, 32768, 32768, 32768, 2730, 32768, 10922, 63195, 32768, 32768, 54613, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 49152, 49152, 40257, 32768, 40960, 64275, 32768, 62557, 32768, 60074, 16384, 32768, 8192, 32768, 32768, 32768, 32768, 32768, 1445, 58982, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 19587, 13531, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 7021, 63975, 1820, 27852, 60854, 32768, 32768, 32768, 3640, 57344, 49152, 50876, 60074, 32768, 3640, 64572, 7232, 14803, 5995, 56129, 45166, 4201, 642, 32768, 60074, 23790, 42130, 9175, 32768, 32768, 32768, 32768, 190, 2585, 64046, 39263, 32768, 49152, 64673, 57344, 63488, 49533, 36864, 2163, 32768, 32768, 32768, 32768, 16384, 10552, 65115, 3640, 32768, 32768, 32768, 32768, 4681, 5300, 64170, 11549, 32768, 32768, 32768, 32768, 2520, 49152, 1310, 24565, 32768, 32768, 49152, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 65046, 13222, 712, 936, 5120, 35888, 1129, 47331, 32768, 32768, 32768, 32768, 4096, 32768, 32768, 32768, 32768, 32768, 2730, 32768, 57344, 32768, 32768, 32768, 32768, 32768, 1724, 32768, 64443, 32768, 32768, 32768, 32768, 32768, 799, 62805, 31996, 32768, 32768, 32768, 32768, 32768, 6553, 49152, 2417, 32768, 32768, 32768, 32768, 153, 32768, 8192, 24576, 32768, 32768, 64893, 32768, 32768, 10922, 32768, 20480, 32768, 32768, 22685, 58982, 6795, 2425, 19114, 32906, 58020, 3150, 32768, 32768, 10922, 3678, 64105, 28021, 32768, 32768, 32768, 32768, 32768, 585, 32768, 10521, 32768, 32768, 64406, 32768, 62259, 32768, 31507, 2978, 32768, 32768, 32768, 32768, 32768, 60074, 64673, 448, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 270, 10922, 780, 30037, 32768, 32768, 62259, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 65251, 62477, 20567, 4359, 12873, 59923, 8847, 1724, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 606, 32768, 36548, 1424, 32768, 32768, 63897, 32768, 18204, 1927, 16384, 54613, 32768, 32768, 2520, 62259, 9456, 32023, 39489, 40960, 47540, 3880, 32768, 32768, 32768, 23405, 27306, 16384, 16384, 63015, 32768, 32768, 32768, 60854, 32768, 32768, 32768, 32768, 60571, 32768, 63015, 40632, 34133, 4681, 32768, 32768, 32768, 32768, 32768, 32768, 64365, 32768, 32768, 32768, 32768, 32768, 47747, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 56320, 32768, 1260, 32768, 32768, 32768, 32768, 64989, 14043, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 1820, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 595, 32768, 819, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 65327, 65284, 64823, 32768, 61895, 32768, 57974, 32768, 41637, 32768, 33020, 8192, 64880, 32768, 43083, 32768, 62259, 16384, 64905, 54613, 63715, 64823, 28987, 65277, 25228, 2569, 22755, 56981, 29332, 16384, 54949, 32768, 64853, 51137, 42130, 32768, 37754, 64322, 46211, 32768, 42094, 32768, 65484, 32768, 52713, 32768, 64478, 32768, 64684, 25600, 34539, 2048, 62557, 49152, 32768, 32768, 45251, 54613, 48817, 32768, 62259, 60074, 58211, 32768, 58982, 32768, 64406, 32768, 54613, 32768, 32768, 32768, 1664, 32768, 15055, 18521, 57344, 32768, 63195, 32768, 54613, 57344, 32768, 49152, 57344, 32768, 60074, 46421, 27306, 17959, 1321, 62929, 27726, 903, 28539, 32768, 54613, 32768, 32768, 32768, 54613, 32768, 32768, 32768, 53248, 54613, 49152, 32768, 2340, 32768, 32768, 32768, 60854, 32768, 32768, 32768, 58982, 32768, 32768, 32768, 60074, 32768, 32768, 32768, 57344, 32768, 32768, 32768, 32768, 32768, 18708, 32768, 63195, 489, 32768, 32768, 1798, 54613, 5635, 9540, 59684, 54613, 59081, 32768, 1280, 16384, 49152, 63195, 32768, 32768, 65163, 48074, 9405, 15764, 264, 48883, 51427, 56599, 618, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 60854, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 54613, 32768, 32768, 32768, 32768, 32768, 25057, 32768, 6553, 875, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 58315, 64414, 3276, 11388, 35177, 780, 32768, 32768, 54613, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 64365, 47104, 32768, 32768, 32768, 32768, 32768, 32768, 61440, 32768, 32768, 32768, 65449, 63804, 32768, 32768, 32768, 32768, 32768, 32768, 65131, 665, 32768, 32768, 49152, 64673, 16384, 49152, 62557, 61440, 32768, 32768, 6922, 61895, 32768, 32768, 63558, 55651, 32768, 62557, 13863, 29435, 1724, 64625, 60074, 60416, 32768, 32768, 63608, 64929, 32768, 32768, 60854, 64980, 32768, 32768, 58982, 32768, 32768, 32768, 58982, 32768, 32768, 32768, 58982, 63811, 32768, 32768, 60074, 63897, 32768, 32768, 63590, 53636, 32768, 32768, 61261, 64716, 32768, 32768, 62259, 63015, 32768, 32768, 60074, 32768, 32768, 32768, 60074, 65360, 10922, 32768, 65323, 57344, 32768, 32768, 63408, 64111, 32768, 32768, 62259, 64940, 32768, 65365, 21370, 54613, 93, 49152, 27096, 32768, 32768, 32768, 60854, 32768, 32768, 32768, 60854, 32768, 32768, 32768, 58982, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 57344, 32768, 32768, 32768, 54613, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 58982, 32768, 10922, 10922, 32768, 32768, 32768, 32768, 8192, 32768, 10922, 60854, 4681, 32768, 63195, 57344, 32768, 32768, 32768, 16384, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 42850, 32768, 60074, 32768, 16384, 32768, 32768, 32768, 1373, 32768, 16384, 39594, 32768, 32768, 40960, 32768, 19660, 32768, 1024, 32768, 32768, 32768, 32768, 65121, 6553, 32768, 4096, 49152, 3640, 3678, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 5461, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 64111, 32768, 65007, 32768, 61713, 32768, 51672, 32768, 3640, 32768, 38466, 32768, 41870, 32768, 93, 32768, 60854, 58982, 32768, 32768, 1560, 32768, 42130, 61440, 27525, 16384, 39269, 32768, 64170, 32768, 52662, 32768, 32768, 32768, 35976, 32768, 62644, 32768, 58735, 32768, 65131, 32768, 64543, 32768, 24932, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 65015, 32768, 32768, 32768, 65390, 32768, 62557, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 29491, 32768, 32768, 32768, 61440, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 60074, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 4681, 40960, 32768, 58982, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 63608, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 64838, 18423, 546, 56433, 45875, 489, 43326, 10532, 1560, 26276, 12660, 64853, 32768, 2184, 32768, 32768, 32768, 32768, 65415, 32768, 32768, 32768, 32768, 32768, 5461, 32768, 32768, 32768, 32768, 32768, 60854, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 4096, 32768, 32768, 54613, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 32768, 2978, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 55093, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 171, 199, 32768, 21978, 32768, 32768, 32768, 32768, 15564, 585, 2184, 6826, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 65316, 60555, 65293, 32768, 63015, 59599, 49152, 32768, 44110, 10472, 34448, 32768, 57344, 32768, 32768, 32768, 65452, 32768, 6382, 45875, 20402, 16384, 21161, 32768, 54613, 64000, 57344, 8192, 53739, 4681, 62805, 32768, 65013, 53373, 10215, 13926, 60643, 63488, 11949, 537, 25383, 43357, 4166, 55366, 16384, 32768, 32768, 63715, 63488, 16384, 24029, 32768, 63015, 57344, 8192, 32768, 22937, 46421, 32768, 32768, 32768, 49152, 64406, 32768, 58514, 32768, 58982, 32768, 63195, 5461, 32768, 32768, 60074, 32768, 49152, 32768, 60854, 32768, 32768, 32768, 49152, 32768, 49152, 32768, 49152, 32768, 32768, 32768, 54613, 32768, 32768, 32768, 54613, 32768, 58982, 32768, 58982, 32768, 32768, 32768, 61440, 32768, 32768, 32768, 32768, 32768, 57344, 32768, 23405, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 20852, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 26704, 22197, 22303, 57344, 7021, 32768, 32768, 32768, 27306, 32768, 32768, 32768, 32768, 32768, 32768, 3640, 595, 32768, 32768, 60854, 1365, 3640, 32768, 25486, 6221, 32768, 16384, 25486, 19660, 32768, 32768, 58982, 12908, 60854, 8192, 52662, 1057, 1724, 64365, 16384, 60074, 65262, 10922, 54613, 32768, 49152, 64170, 32768, 6553, 32768, 32768, 32768, 6553, 32768, 57344, 10922, 12660, 63488, 64406, 32768, 16384, 32768, 32768, 3276, 646, 10922, 18040, 88, 38725, 32768, 32768, 315, 27983, 39666, 15798, 32768, 10426, 35498, 64650, 32768, 4681, 32768, 32768, 32768, 5461, 32768, 32768, 32768, 936, 32768, 32768, 32768, 16384, 32768, 32768, 1170, 5135, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 64159, 32768, 16384, 60074, 40960, 32768, 32768, 1057, 862, 32768, 35195, 60854, 3640, 32768, 32768, 32768, 10922, 32768, 10240, 64823, 63413, 32768, 32768, 32768, 50322, 40960, 32768, 62557, 65513, 32768, 32768, 57344, 64952, 38725, 37137, 64695, 65469, 32768, 32768, 38229, 59068, 47331, 24029, 63294, 61447, 3640, 32768, 6553, 64394, 40960, 17644, 49152, 41545, 32768, 32768, 64275, 58088, 58982, 18970, 45778, 65322, 32768, 64755, 57344, 49152, 25278, 27726, 32768, 35498, 32768, 57344, 64625, 63879, 38725, 24029, 1213, 65208, 49152, 49152, 63488, 64337, 42598, 24576, 60074, 65376, 32768, 32768, 64853, 46093, 47331, 18022, 32768, 32768, 32768, 32768, 64170, 64259, 53248, 16384, 64625, 62963, 32768, 32768, 45778, 57189, 49152, 32768, 32768, 65115, 32768, 32768, 197, 48887, 32768, 32768, 32768, 65293, 32768, 32768, 60854, 62557, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 8713, 14659, 24941, 1909, 20770, 413, 32768, 59753, 27229, 54613, 32768, 32768, 32768, 32768, 1170, 51492, 2340, 54613, 59801, 32768, 1310, 54613, 32768, 40478, 18970, 12603, 54613, 33587, 32768, 32768, 64650, 37137, 37410, 2520, 64867, 54613, 28398, 58982, 1927, 28672, 33041, 9637, 32768, 32768, 32768, 64695, 32768, 32768, 3891, 16384, 57344, 32768, 31132, 32768, 3640, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 9637, 2374, 2184, 32768, 32768, 32768, 32768, 32768, 32768, 7736, 2520, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 6553, 16384, 57344, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 57344, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 38725, 10922, 32768, 32768, 32768, 32768, 54613, 32768, 48496, 45875, 32768, 32768, 32768, 32768, 8192, 1170, 47104, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 61261, 8192, 49152, 2340, 2730, 2184, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 1445, 10922, 41731, 24576, 64004, 62259, 8346, 963, 27306, 7561, 47104, 5461, 38229, 64186, 32768, 32768, 63715, 32768, 52082, 6553, 6746, 54613, 56433, 5324, 36864, 5018, 29491, 5782, 22420, 32768, 32768, 64736, 32768, 32768, 58982, 32768, 32768, 32768, 32768, 4096, 32768, 32768, 2520, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 6553, 32768, 32768, 32768, 32768, 32768, 32768, 5173, 57344, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 61895, 64791, 58677, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 49152, 32768, 32768, 3380, 61440, 32768, 32768, 32768, 32768, 32768, 65495, 32768, 65390, 49152, 32768, 16384, 49152, 8192, 32768, 32768, 25681, 15387, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 26046, 64823, 40579, 32768, 32768, 32768, 32768, 3640, 62805, 32768, 41242, 25057, 32768, 3276, 16384, 19660, 31311, 40049, 3343, 32768, 25559, 32768, 32768, 64170, 32768, 23405, 2104, 63975, 32768, 11264, 46903, 10922, 6697, 49818, 28257, 32768, 32768, 32768, 65308, 32768, 16384, 60074, 38593, 58982, 32768, 32768, 60074, 32768, 3276, 49152, 32768, 32768, 32768, 32768, 32768, 5461, 3425, 64572, 1316, 32768, 32768, 32768, 32768, 32768, 8192, 32768, 6925, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 58982, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 8192, 62259, 9175, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 51794, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 1489, 32768, 32768, 32768, 32768, 3276, 98, 64572, 30017, 32768, 32768, 32768, 32768, 10922, 20316, 58982, 21504, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 2340, 10635, 63015, 16478, 12603, 32768, 32768, 32768, 10922, 8192, 64365, 12014, 32768, 20480, 32768, 32768, 32768, 32768, 52043, 11272, 20083, 32768, 32768, 11513, 32768, 2073, 56293, 63346, 49152, 32768, 32768, 63897, 49152, 14745, 62557, 936, 32768, 32768, 32768, 32768, 32768, 17644, 32768, 7067, 32768, 32768, 32768, 32768, 32768, 25486, 49152, 63715, 32768, 32768, 32768, 32768, 8192, 6858, 61895, 64673, 32768, 32768, 32768, 32768, 32768, 32768, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 55748, 10646, 4205, 64266, 50953, 61002, 36364, 36864, 16094, 39760, 33716, 31987, 6553, 32768, 24576, 64673, 49152, 64905, 16384, 10922, 32768, 32768, 32768, 32768, 32768, 25941, 32768, 32768, 65321, 16384, 62610, 32768, 36623, 32768, 15671, 60074, 20219, 64720, 24576, 32768, 32768, 32768, 32768, 64893, 49152, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 45428, 16384, 32768, 32768, 799, 37211, 32768, 4096, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 60620, 32768, 12511, 32768, 5782, 32768, 32768, 49152, 1927, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 6553, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 963, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 65448, 59272, 45555, 32768, 63488, 2730, 60074, 32768, 47480, 51200, 62015, 32768, 32768, 32768, 63715, 32768, 5461, 32768, 59753, 32768, 62805, 32768, 16384, 16384, 56022, 62557, 56713, 32768, 63975, 32768, 59717, 32768, 63015, 59536, 9102, 46421, 36303, 57344, 11943, 6396, 53729, 63715, 58174, 32768, 58982, 2808, 50641, 63488, 47981, 32768, 30037, 32768, 63608, 57344, 32768, 2730, 29023, 63608, 1365, 32768, 49152, 24576, 65007, 32768, 63351, 32768, 32768, 32768, 60074, 32768, 32768, 32768, 32768, 54613, 65287, 32768, 57344, 32768, 32768, 32768, 49152, 32768, 54613, 32768, 54613, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 1092, 34448, 32768, 5461, 60854, 61440, 49152, 32768, 886, 32768, 14043, 32768, 32768, 32768, 32768, 10922, 5461, 64443, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 2048, 32768, 32768, 62557, 595, 16384, 32768, 54613, 45875, 32768, 49152, 11251, 47727, 18866, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 260, 63488, 32768, 436, 12994, 32768, 1296, 32768, 49152, 49152, 16384, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 5461, 32768, 32768, 32768, 4096, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 3640, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 1638, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 58982, 32768, 4096, 32768, 49152, 32768, 32768, 64543, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 62259, 40557, 32768, 32768, 32768, 97, 32768, 32768, 249, 62135, 32768, 32768, 54613, 64880, 32768, 32768, 65345, 64673, 32768, 32768, 46959, 56251, 32768, 32768, 55523, 65031, 10922, 16384, 52831, 64683, 32768, 32768, 63608, 63824, 32768, 32768, 63715, 24576, 63195, 2730, 6553, 64534, 54613, 62285, 6553, 59753, 24576, 49152, 12743, 62050, 52043, 64111, 59886, 62031, 49152, 32768, 64406, 26029, 32768, 32768, 63573, 61411, 32768, 32768, 63351, 62843, 32768, 32768, 65198, 33268, 32768, 32768, 595, 49152, 54613, 32768, 64225, 63780, 32768, 32768, 50946, 57429, 31129, 32768, 62436, 63386, 32768, 57344, 32768, 32768, 32768, 32768, 32768, 64838, 32768, 32768, 32768, 61895, 32768, 32768, 64225, 4096, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 63755, 32768, 32768, 24576, 58982, 32768, 49152, 32768, 32768, 32768, 32768, 20812, 2656, 25258, 360, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 25486, 3091, 24824, 3276, 45056, 32768, 32768, 61440, 30146, 32768, 63015, 32768, 862, 32768, 54613, 32768, 51645, 32768, 32768, 2520, 32768, 32768, 32768, 32768, 32768, 47080, 32768, 32768, 64838, 32768, 58315, 32768, 55407, 15777, 2271, 12189, 26810, 65331, 7021, 63351, 39547, 6553, 61895, 64406, 32768, 32768, 57344, 8192, 49152, 32768, 55121, 14894, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 52713, 32768, 27525, 49152, 10922, 32768, 34734, 2048, 16384, 32768, 32768, 60854, 41316, 32768, 53248, 16384, 57344, 32768, 44165, 63351, 32768, 65243, 47809, 9102, 4681, 32768, 60074, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 57344, 31373, 885, 16384, 32768, 32768, 61440, 36217, 32768, 58982, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 14043, 2184, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 64322, 32768, 2978, 54613, 29743, 3640, 57974, 32768, 23637, 60854, 23405, 32768, 18811, 32768, 32325, 8192, 65099, 32768, 54613, 32768, 43467, 10922, 57344, 32768, 16384, 32768, 32768, 25796, 55854, 32768, 64749, 2184, 56010, 32768, 62805, 54613, 36086, 45056, 51124, 64773, 63715, 60854, 42697, 390, 64322, 65110, 32768, 32768, 63715, 32768, 32768, 32768, 10922, 49152, 5461, 32768, 32768, 32768, 32768, 32768, 65115, 32768, 32768, 32768, 60074, 32768, 5461, 53248, 25240, 3640, 23405, 32768, 64673, 63195, 30508, 32768, 62557, 32768, 58982, 32768, 58982, 32768, 32768, 49152, 12429, 50641, 32768, 32768, 32768, 32768, 32768, 32768, 59753, 32768, 58982, 32768, 3276, 57344, 32768, 54613, 27229, 2184, 64640, 32768, 49152, 58982, 23665, 32768, 61440, 32768, 32768, 32768, 32768, 32768, 32768, 65067, 5461, 2184, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 37287, 63351, 4274, 35389, 21325, 642, 24576, 32768, 32768, 60074, 25320, 32768, 61440, 32768, 1024, 32768, 32768, 32768, 29318, 57344, 5461, 16384, 32768, 63715, 32768, 32768, 32768, 27539, 32768, 32768, 64599, 35108, 35628, 33966, 62444, 63195, 17612, 41472, 5461, 53683, 11141, 14043, 41807, 32768, 63811, 64971, 54613, 32768, 29887, 58982, 32768, 54613, 27661, 2577, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 1213, 28539, 57344, 799, 32768, 19894, 29318, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 12743, 32768, 32768, 49152, 63195, 2048, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 66, 32768, 32768, 1724, 54613, 61440, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 63897, 1310, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 8192, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 49152, 32768, 32768, 32768, 32768, 49152, 57344, 32768, 47331, 16384, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 64512, 1310, 2730, 257, 63488, 29918, 3313, 2730, 37340, 60143, 14043, 32768, 32768, 32768, 63488, 65390, 2978, 32768, 32768, 32768, 32768, 32768, 16384, 16384, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 4681, 32768, 32768, 32768, 1927, 32768, 32768, 32768, 5877, 38756, 45377, 1927, 65415, 32768, 5461, 60074, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 3640, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16459, 32768, 12429, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 65141, 16384, 57344, 32768, 24576, 32768, 1213, 47331, 58924, 51445, 49530, 15380, 63351, 54613, 32768, 64406, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 16384, 32768, 17973, 32768, 32768, 32768, 8192, 32768, 20480, 16384, 32768, 1198, 8192, 10426, 32768, 54613, 63195, 32768, 40413, 3640, 8673, 49152, 32768, 32768, 32768, 32768, 1724, 32768, 32768, 32768, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 54613, 13863, 16384, 24576, 43115, 57344, 32768, 32768, 19660, 32768, 32768, 32768, 32768, 32768, 32768, 2520, 32768, 2048, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 65163, 29428, 55166, 32768, 30146, 23282, 56912, 2978, 54613, 26810, 49613, 62557, 63811, 32768, 2978, 32768, 52200, 32768, 65080, 32768, 32768, 32768, 25486, 32768, 65054, 32768, 62557, 32768, 62805, 32768, 22082, 32768, 63811, 7561, 32768, 32768, 55227, 39748, 32768, 337, 64655, 63960, 49152, 63608, 58982, 61440, 63015, 32768, 49152, 32768, 10426, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 3932, 32768, 121, 32768, 65460, 32768, 32768, 32768, 61895, 32768, 16384, 11468, 16384, 1489, 42910, 57344, 51672, 65303, 32768, 51492, 4681, 32768, 65024, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 45875, 32768, 32768, 32768, 32768, 32768, 56912, 16384, 32768, 16384, 32768, 10922, 32768, 16384, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 57344, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 4318, 24576, 2520, 32768, 3640, 32768, 318, 32768, 54613, 32768, 64365, 16384, 32768, 32768, 32768, 862, 6553, 32768, 54613, 32768, 32768, 2340, 32768, 32768, 58982, 32768, 32768, 32768, 64512, 32768, 32768, 64443, 15915, 51018, 63715, 41506, 45251, 46967, 60074, 10240, 28110, 4386, 61603, 61895, 62259, 16384, 64853, 32768, 32768, 61895, 32768, 32768, 16384, 32768, 32768, 32768, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 5461, 42598, 32768, 40960, 32768, 32768, 32768, 32768, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 125, 41, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 54613, 32768, 32768, 32768, 32768, 32768, 19660, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 39789, 44683, 28398, 7447, 16384, 32768, 1424, 51200, 65135, 43300, 25869, 57344, 64090, 32768, 32768, 25988, 59654, 60854, 16384, 32768, 55898, 28672, 32768, 32768, 64736, 53248, 9830, 32768, 59392, 32768, 32768, 64225, 63138, 61004, 53671, 30519, 56912, 40049, 30546, 12288, 62350, 8725, 32055, 63715, 49152, 32768, 64365, 32768, 61713, 53248, 16384, 16384, 62146, 32768, 32768, 58514, 63924, 51492, 24576, 32768, 30499, 32768, 32768, 64773, 46060, 58982, 22685, 4681, 5120, 32768, 992, 31948, 36454, 61701, 32768, 65187, 63652, 32768, 32768, 62727, 54272, 32768, 32768, 32768, 64880, 32768, 32768, 4681, 24576, 32768, 32768, 32768, 64695, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 16384, 32768, 64365, 49152, 35888, 32768, 16384, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 65384, 1820, 32768, 32768, 38229, 60362, 42325, 54613, 32768, 32768, 32768, 49152, 130, 45875, 14043, 32768, 48509, 32768, 2184, 16384, 32768, 53248, 10922, 32768, 32768, 45875, 32768, 32768, 65093, 28299, 58929, 2520, 21492, 61895, 3230, 61539, 8192, 24908, 30996, 60854, 61440, 32768, 64170, 65421, 32768, 8192, 46687, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 14043, 8192, 32768, 32768, 4096, 26624, 6553, 10922, 8426, 43938, 9848, 58982, 58982, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 10922, 18139, 1084, 32768, 14043, 60854, 32768, 16384, 65145, 7021, 12288, 63195, 60854, 32768, 32768, 32768, 32768, 16384, 27525, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 49152, 14894, 10922, 49152, 4681, 31430, 32768, 2603, 62050, 56576, 32768, 54613, 32768, 5461, 32768, 37501, 32768, 32768, 32768, 32768, 32768, 59658, 16384, 25974, 32768, 64242, 49152, 32768, 32768, 51492, 12873, 47536, 54613, 65080, 49152, 50641, 963, 44929, 25988, 489, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 21504, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 62259, 32768, 32768, 32768, 58982, 32768, 32768, 16384, 8192, 16384, 63715, 32768, 57344, 5908, 54613, 32768, 32768, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 27726, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 16384, 39594, 39666, 8842, 32768, 32768, 32768, 32768, 16384, 59753, 32768, 35792, 32768, 32768, 32768, 32768, 32768, 46173, 54613, 39576, 32768, 32768, 32768, 32768, 65074, 63015, 65126, 8693, 61603, 9830, 32768, 16384, 32768, 47923, 58982, 45875, 32768, 32768, 32768, 32768, 10922, 4774, 60554, 10823, 49152, 32768, 32768, 32768, 32768, 3276, 32768, 1820, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 399, 2730, 61603, 40646, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 8936, 61440, 20800, 32768, 3276, 1310, 32768, 10922, 10753, 28398, 16135, 34292, 52272, 32768, 6553, 32768, 16384, 49152, 27770, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 32768, 32768, 32768, 32768, 2978, 3840, 64478, 23223, 32768, 8192, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 54613, 32768, 32768, 5461, 6553, 64170, 18162, 54613, 32768, 16384, 32768, 6553, 12226, 58982, 9199, 32768, 24824, 32768, 32768, 57565, 5028, 37714, 5782, 29023, 64443, 32768, 34816, 32768, 6642, 10922, 32768, 32768, 32768, 32768, 63811, 32768, 32768, 32768, 32768, 57344, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 24576, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 4681, 32768, 37156, 35177, 47700, 25057, 22214, 48817, 31422, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 1213, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 3640, 32768, 32768, 54613, 47891, 32768, 5461, 32768, 60074, 32768, 32768, 32768, 32768, 19660, 32768, 32768, 32768, 40960, 49152, 32768, 29318, 36864, 26021, 4681, 22282, 32768, 2978, 61895, 59760, 45511, 25328, 4726, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 54613, 32768, 32768, 32768, 4681, 28672, 31507, 4681, 32768, 32768, 32768, 61895, 56862, 47981, 32239, 3276, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 13405, 35108, 35389, 3276, 32768, 32768, 32768, 32768, 24775, 31137, 60736, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 65325, 48699, 65187, 32768, 1185, 24234, 28299, 885, 61895, 32768, 39874, 62015, 51386, 19192, 13312, 32768, 16384, 32768, 64917, 32768, 62557, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 60854, 49152, 49152, 32768, 52130, 46421, 64478, 32768, 4537, 24104, 38385, 1761, 1927, 54613, 32768, 54193, 59637, 62001, 13948, 12603, 45875, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 10922, 63195, 32768, 32768, 32768, 32768, 64046, 32768, 32768, 8192, 49152, 32768, 1661, 44683, 28987, 327, 58982, 1560, 58982, 61603, 62570, 31580, 10012, 32768, 32768, 32768, 52662, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 40960, 32768, 32768, 32768, 32768, 2978, 32768, 32768, 32768, 32768, 32768, 49152, 3340, 19773, 3276, 10922, 32768, 32768, 32768, 32768, 65093, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 19660, 10922, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 65235, 32768, 64512, 32768, 5461, 63195, 8192, 10922, 32768, 49152, 32768, 64170, 45875, 65332, 41966, 64004, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 49152, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 62259, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 57690, 32768, 32768, 32768, 32768, 32768, 32768, 1057, 55214, 32768, 1560, 32768, 61440, 32768, 63389, 59968, 49285, 8089, 936, 32768, 54613, 32768, 32768, 49737, 62805, 49152, 32768, 28248, 40049, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 3276, 32768, 16384, 6514, 44140, 32768, 1694, 6144, 54613, 32768, 20959, 11904, 61895, 2121, 5461, 49152, 64406, 32768, 64111, 64225, 40049, 1129, 3276, 4681, 58982, 32768, 32768, 6553, 60854, 32768, 32768, 57344, 32768, 32768, 32768, 2544, 17854, 16384, 655, 32768, 49152, 49152, 64599, 50429, 59670, 44843, 32768, 54613, 49152, 32768, 32768, 32768, 54613, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 61895, 32768, 32768, 32768, 32768, 32768, 32768, 57344, 32768, 32768, 32768, 32768, 61440, 32768, 32768, 64862, 57344, 23869, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 2978, 32768, 32768, 7399, 33784, 32768, 4274, 32768, 32768, 32768, 60362, 50374, 45056, 53605, 2340, 32768, 16384, 32768, 49152, 16384, 32768, 32768, 49152, 1310, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 32768, 32768, 38912, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 2184, 32768, 16384, 10922, 32768, 10922, 32768, 32768, 32768, 45875, 1170, 32768, 32768, 66, 41887, 6553, 3640, 49152, 54613, 32768, 53148, 24168, 60971, 25730, 5461, 49152, 32768, 4096, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 1820, 16384, 32768, 12228, 42791, 32768, 2286, 32768, 32768, 32768, 31278, 61460, 17829, 37608, 4681, 32768, 32768, 32768, 32768, 1560, 32768, 2520, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 2340, 64880, 32768, 2091, 30782, 10922, 992, 24576, 4681, 53248, 63624, 56585, 48354, 62564, 6553, 526, 2340, 65080, 32768, 63195, 32768, 4096, 712, 32768, 32768, 32768, 32768, 8192, 64543, 63488, 32768, 32768, 32768, 32768, 32768, 36044, 65295, 39666, 32768, 54613, 32768, 32768, 32768, 16384, 63897, 1057, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 63811, 32768, 32768, 16384, 60854, 32768, 2340, 48496, 32768, 1638, 32768, 32768, 3276, 64599, 21578, 1927, 16384, 32768, 64650, 32768, 64046, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 58982, 32768, 32768, 32768, 32768, 32768, 10510, 8192, 32768, 32768, 32768, 32768, 32768, 64111, 2048, 20852, 5461, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 2730, 12288, 32768, 8192, 32768, 32768, 32768, 60854, 10270, 655, 55181, 32768, 32768, 32768, 32768, 61440, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 2340, 32768, 32768, 8192, 32768, 32768, 32768, 36044, 32768, 63195, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 3276, 32768, 32768, 32768, 32768, 32768, 65260, 61895, 32768, 60620, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 8192, 32768, 32768, 65449, 17347, 16384, 32768, 32768, 32768, 28672, 32768, 32768, 32768, 32768, 32768, 32768, 65295, 20001, 41615, 18659, 34205, 45428, 38466, 23086, 42325, 47536, 626, 51079, 53521, 1365, 32768, 60854, 65280, 41720, 27703, 520, 58762, 18022, 42976, 35809, 3584, 57227, 5388, 38936, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 3389, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 58982, 32768, 32768, 48235, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 18204, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 10922, 4681, 3276, 32768, 32768, 32768, 32768, 32768, 5461, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 4096, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 8192, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 65520, 51687, 32768, 32768, 49152, 16384, 54613, 32768, 62805, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 48842, 10922, 53804, 61895, 41870, 49152, 10922, 4681, 30895, 28456, 48496, 38010, 35195, 61440, 32768, 32768, 65436, 59392, 17, 32768, 36602, 32768, 24576, 60029, 14894, 32768, 32768, 32768, 63608, 32768, 16384, 62805, 56351, 36944, 2105, 39052, 65382, 65334, 21790, 126, 4720, 47476, 17761, 270, 35521, 16384, 54613, 32768, 60854, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 60854, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 63488, 32768, 32768, 32768, 5679, 32768, 32768, 32768, 60074, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 57700, 32768, 16384, 32768, 5461, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 442, 2730, 32768, 58982, 32768, 54613, 13863, 6553, 23210, 36548, 44904, 29257, 35659, 63715, 32768, 32768, 32768, 16384, 32768, 32768, 49152, 32768, 32768, 32768, 6553, 32768, 32768, 32768, 32768, 49152, 16384, 64893, 64543, 30653, 56937, 3072, 56842, 32768, 237, 57090, 4395, 20206, 63232, 32768, 46495, 32768, 32768, 32768, 32768, 8192, 32768, 49152, 32768, 32768, 32768, 32768, 5461, 32768, 32768, 32768, 32768, 54613, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 8192, 1424, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 63195, 32768, 32768, 62805, 32768, 32768, 32768, 32768, 32768, 32768, 62259, 64170, 32768, 32768, 32768, 32768, 16384, 6553, 6553, 32768, 55678, 32768, 32768, 32768, 62025, 32768, 27069, 32768, 65458, 32768, 32768, 32768, 64522, 36864, 23665, 32768, 64046, 32768, 32768, 12680, 25336, 39789, 41984, 60844, 60580, 2730, 6553, 42130, 43520, 39547, 31987, 39594, 63897, 32768, 32768, 32768, 42697, 42598, 24029, 49152, 65493, 32768, 32768, 32768, 60620, 32768, 30037, 32768, 49152, 32768, 64929, 65236, 60170, 58358, 10389, 8805, 65415, 29435, 62621, 1489, 55214, 33329, 20852, 10922, 64541, 32768, 32768, 64512, 58585, 36864, 29491, 32768, 32768, 32768, 32768, 32768, 63529, 42130, 22528, 64111, 58193, 32768, 32768, 61224, 39699, 32768, 32768, 49152, 64073, 32768, 32768, 1365, 45056, 32768, 32768, 49152, 61440, 32768, 32768, 32768, 32768, 32768, 32768, 63558, 11627, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 48307, 23058, 55705, 6692, 44236, 496, 32768, 55705, 5742, 32768, 32768, 32768, 32768, 32768, 258, 12379, 36044, 63608, 22399, 49152, 13028, 2226, 25988, 32768, 30340, 31129, 37622, 56403, 49152, 8192, 32768, 54613, 30037, 24576, 32768, 32768, 49152, 16384, 16384, 52932, 33398, 32768, 32768, 60854, 27306, 65372, 64625, 34753, 49692, 1489, 65056, 27726, 20239, 53908, 63195, 38165, 26136, 1560, 35067, 32768, 32768, 32768, 62805, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 12660, 62259, 32768, 32768, 32768, 32768, 49152, 32768, 2340, 32768, 32768, 32768, 32768, 16384, 5461, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 45056, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 58982, 32768, 45511, 32768, 57344, 174, 4818, 26810, 32768, 32768, 64478, 32768, 32768, 32768, 32768, 32768, 3401, 1489, 22282, 64322, 27578, 32768, 1902, 1170, 32768, 36548, 46080, 32768, 43417, 64365, 49152, 10922, 61895, 1927, 32768, 4681, 32768, 32768, 32768, 32768, 64225, 32768, 32768, 32768, 32768, 64225, 54613, 65394, 64736, 49396, 14831, 48231, 64443, 59392, 35936, 2761, 1905, 33734, 6186, 37809, 36368, 2978, 40960, 32768, 58982, 32768, 2340, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 5461, 32768, 54613, 16384, 32768, 32768, 54613, 32768, 49152, 32768, 32768, 49152, 32768, 57344, 32768, 32768, 32768, 32768, 32768, 16384, 2520, 32768, 2642, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 30653, 30801, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10342, 32768, 58982, 32768, 64111, 62557, 9063, 32768, 32768, 32768, 32768, 52, 22016, 32768, 20510, 40659, 64443, 47666, 1260, 27306, 43467, 47014, 18139, 31597, 65194, 32768, 32768, 32768, 63015, 32768, 1890, 60854, 63015, 32768, 32768, 5461, 12994, 64046, 38516, 32768, 63897, 16384, 65462, 64225, 39032, 7780, 777, 63963, 63351, 2615, 25216, 1057, 4049, 33661, 10922, 58982, 32768, 32768, 32768, 32768, 32768, 32768, 14043, 32768, 60854, 32768, 32768, 32768, 41506, 32768, 11739, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 14043, 32768, 57344, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 13405, 32768, 57344, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 14043, 32768, 57344, 32768, 32768, 32768, 32768, 32768, 143, 32768, 32768, 32768, 32768, 49152, 32768, 16384, 16384, 32768, 45875, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 512, 8192, 32768, 22282, 19073, 60854, 19660, 27306, 32768, 32768, 32768, 46421, 32768, 62557, 32768, 32768, 32768, 32768, 32768, 61440, 32768, 32768, 32768, 32768, 16384, 468, 32768, 32768, 32768, 32768, 32768, 65265, 65399, 17644, 62520, 38466, 26282, 32768, 54613, 2770, 3276, 36889, 64543, 32768, 54613, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 442, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 4096, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 260, 10922, 32768, 61895, 19534, 32768, 22341, 7561, 32768, 10922, 32768, 32768, 32768, 62557, 49152, 10922, 32768, 32768, 32768, 32768, 16384, 10922, 32768, 32768, 40960, 32768, 32768, 32768, 32768, 32768, 49152, 65445, 65508, 4681, 64653, 63975, 65260, 60074, 9637, 61140, 32768, 4274, 528, 16384, 54613, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 16384, 38725, 32768, 32768, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 63715, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 65369, 55440, 41185, 32768, 2048, 32768, 16384, 32768, 63715, 32768, 15360, 32768, 32768, 32768, 32768, 32768, 2520, 32768, 32768, 60854, 55296, 58982, 27306, 14894, 57344, 10922, 32768, 32768, 63975, 60854, 32768, 32768, 57344, 58088, 32768, 32768, 40007, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 62259, 32768, 64572, 65253, 51882, 43395, 1163, 26154, 65080, 55629, 3763, 2081, 1592, 63254, 130, 1170, 32768, 1381, 65235, 32768, 32768, 32768, 32768, 32768, 64961, 20852, 49152, 32768, 58982, 32768, 32768, 32768, 54613, 16384, 32768, 32768, 54613, 32768, 32768, 32768, 16384, 32768, 49152, 32768, 61895, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 60854, 32768, 16384, 32768, 57344, 32768, 45875, 32768, 57344, 32768, 32768, 32768, 5006, 32768, 32768, 32768, 32768, 54613, 32768, 32768, 64225, 32768, 32768, 32768, 32768, 64809, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 546, 32768, 32768, 10922, 60074, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 24576, 32768, 32768, 58982, 49152, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 54613, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 49152, 32768, 32768, 62557, 2184, 32768, 64046, 32768, 58982, 63608, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 32768, 32768, 32768, 32768, 54613, 32768, 32768, 49152, 60854, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 57344, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 63435, 32768, 32768, 32768, 32768, 32768, 32768, 61067, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49518, 32768, 32768, 32768, 32768, 32768, 32768, 60854, 65331, 32768, 32768, 62805, 60280, 32768, 32768, 32768, 64961, 32768, 32768, 11355, 44950, 32768, 58982, 60456, 52231, 6553, 10922, 32768, 64275, 32768, 32768, 8192, 65262, 32768, 32768, 32768, 49152, 32768, 32768, 58982, 65217, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 65015, 64998, 16568, 65317, 3640, 64773, 65267, 36864, 58982, 58982, 63715, 54613, 32768, 57344, 65430, 32768, 32768, 65205, 59021, 49152, 32768, 32768, 49152, 32768, 32768, 32768, 57344, 32768, 32768, 63811, 65277, 32768, 32768, 64365, 42130, 18970, 32768, 32768, 64650, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 60854, 32768, 32768, 32768, 32768, 32768, 32768, 60074, 54613, 32768, 32768, 32768, 1365, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 1724, 26065, 1638, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 60074, 2184, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 146, 1092, 32768, 61440, 39809, 54613, 36251, 399, 32768, 16384, 32768, 32768, 32768, 62893, 5461, 16384, 32768, 32768, 32768, 16384, 49152, 32768, 14043, 4681, 32768, 54613, 32768, 32768, 32768, 62805, 64170, 65434, 65253, 4096, 56662, 10426, 65410, 32768, 987, 48729, 862, 59909, 30427, 39789, 64716, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 63488, 32768, 2286, 32768, 32768, 60854, 25383, 38936, 32768, 32768, 14043, 32768, 32768, 32768, 32768, 32768, 64961, 32768, 7552, 32768, 5389, 32768, 33548, 16384, 15777, 32768, 9557, 32768, 9175, 32768, 9557, 32768, 9557, 32768, 15777, 32768, 32768, 32768, 32768, 1424, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 57344, 2730, 32768, 32768, 32768, 32768, 32768, 32768, 60854, 32768, 32768, 32768, 416, 3276, 46565, 62259, 52186, 64755, 44276, 6007, 49152, 32768, 54613, 32768, 49152, 61836, 32768, 10922, 65007, 32768, 32768, 32768, 57344, 49152, 57344, 16384, 54613, 60854, 32768, 32768, 49152, 65121, 63811, 65398, 65395, 17316, 58908, 1365, 64673, 32768, 43623, 61526, 425, 64443, 37137, 32768, 60074, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 60854, 64111, 39470, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 64111, 32768, 32768, 32768, 57153, 32768, 32768, 32768, 16384, 32768, 64695, 32768, 32768, 32768, 62259, 32768, 58982, 32768, 64736, 32768, 32768, 32768, 49152, 62259, 62805, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 58982, 32768, 32768, 32768, 32768, 32768, 6553, 4681, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 862, 682, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 104, 2730, 32768, 65154, 39106, 57344, 40697, 13653, 32768, 55705, 32768, 32768, 32768, 57600, 32768, 57344, 32768, 32768, 57344, 32768, 32768, 32768, 24576, 32768, 32768, 49152, 32768, 49152, 32768, 32768, 64275, 65403, 65358, 62344, 26637, 55039, 64256, 64111, 5727, 11612, 1143, 50193, 4524, 45547, 64880, 32768, 32768, 32768, 32768, 32768, 24576, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 38229, 6553, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 54613, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 474, 10922, 10922, 60854, 19114, 32768, 3276, 32768, 32768, 32768, 32768, 32768, 32768, 57344, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 4096, 32768, 32768, 32768, 32768, 32768, 32768, 61895, 32768, 64170, 32768, 65007, 1270, 1068, 40960, 61895, 36718, 876, 148, 1463, 56846, 537, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 2730, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 181, 2978, 32768, 63715, 31719, 54613, 48119, 7021, 32768, 32768, 32768, 32768, 32768, 64823, 49152, 32768, 32768, 40960, 6553, 32768, 32768, 32768, 32768, 32768, 56855, 64736, 32768, 32768, 32768, 62259, 32768, 65418, 65425, 24576, 58872, 2730, 61812, 32768, 352, 40403, 474, 9717, 1603, 28672, 64207, 2340, 32768, 32768, 32768, 32768, 32768, 32768, 6553, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 5461, 32768, 27306, 2520, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 32768, 1310, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 65490, 50393, 32768, 32768, 32768, 32768, 32768, 32768, 63569, 49152, 32768, 32768, 49152, 32768, 32768, 32768, 16384, 32768, 32768, 60074, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 63249, 65074, 32768, 32768, 60386, 63195, 32768, 32768, 43633, 32768, 32768, 32768, 49152, 49152, 32768, 32768, 60074, 32768, 32768, 63608, 53493, 32768, 49152, 8192, 65351, 54613, 32768, 32768, 49583, 53248, 64406, 32768, 49152, 36864, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 61440, 16384, 32768, 32768, 54613, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 7447, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 46173, 32768, 32768, 32768, 6967, 32768, 32768, 32768, 25057, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 32768, 32768, 32768, 32768, 57344, 32768, 32768, 32768, 24576, 32768, 21370, 58982, 682, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 264, 1927, 32768, 58982, 21693, 57344, 17424, 4905, 32768, 42130, 32768, 32768, 32768, 54850, 32768, 49152, 16384, 32768, 32768, 36864, 32768, 32768, 49152, 10922, 32768, 32768, 32768, 32768, 10922, 63195, 32768, 65452, 65087, 21217, 62283, 57088, 61722, 64773, 60329, 15561, 3276, 32343, 1820, 56734, 65346, 32768, 32768, 32768, 10922, 6553, 8192, 6553, 32768, 32768, 32768, 32768, 4096, 24576, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 16384, 885, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 58982, 32768, 32768, 32768, 2978, 2048, 32768, 19660, 64322, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 56155, 32768, 32768, 16384, 60362, 49152, 25746, 32768, 62278, 32768, 32768, 32768, 52713, 49152, 25869, 61440, 64346, 32768, 32768, 19107, 60364, 62805, 54287, 53532, 62703, 28520, 7536, 58982, 62575, 49152, 24576, 60994, 47197, 32768, 16384, 63715, 60655, 42130, 22528, 32768, 65323, 32768, 32768, 32768, 62146, 49152, 8936, 56599, 64443, 16384, 65384, 65255, 64978, 64755, 44427, 37162, 64032, 45251, 45188, 461, 65147, 3742, 50758, 65238, 62172, 32768, 32768, 60074, 63945, 58982, 22937, 32768, 49152, 32768, 32768, 65131, 29518, 42130, 22341, 65078, 62626, 32768, 32768, 42575, 57537, 32768, 32768, 32768, 65454, 32768, 32768, 5851, 51057, 32768, 32768, 49152, 65110, 32768, 32768, 32768, 32768, 32768, 32768, 60416, 43115, 32768, 32768, 32768, 60074, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 63015, 537, 32768, 32768, 32768, 53248, 62323, 57344, 32768, 32768, 32768, 32768, 28, 7645, 44470, 64716, 30904, 57344, 10041, 4870, 32768, 16384, 5461, 32768, 32768, 55159, 32768, 32768, 32768, 53248, 27306, 16384, 18022, 32768, 32768, 16384, 32768, 32768, 4096, 32768, 32768, 63015, 60074, 65460, 65489, 50105, 62037, 1820, 41694, 58982, 3880, 61051, 642, 12343, 57423, 29683, 56512, 32768, 32768, 32768, 975, 32768, 10922, 32768, 1092, 32768, 32768, 32768, 32768, 32768, 25031, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 862, 32768, 32768, 32768, 32768, 32768, 1560, 32768, 32768, 32768, 65310, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 10922, 32768, 32768, 32768, 32768, 455, 32768, 32768, 32768, 63488, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 65167, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 268, 10922, 5461, 62259, 60074, 8192, 64, 32768, 32768, 38229, 35498, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 62557, 64275, 19875, 63715, 54613, 64501, 32768, 18144, 151, 509, 7777, 100, 32768, 10922, 32768, 54613, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 1820, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 1724, 10691, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 63195, 32768, 40561, 32768, 32768, 32768, 32768, 799, 63811, 61440, 49680, 54613, 32768, 38912, 58982, 32768, 63015, 32768, 24576, 32768, 63897, 32768, 32768, 32768, 63715, 32768, 19114, 32768, 32768, 32768, 32768, 16384, 12119, 32768, 26810, 32768, 54613, 32768, 64599, 65377, 40760, 65435, 5881, 65205, 32768, 32768, 63351, 32768, 61895, 5461, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 655, 32768, 32768, 32768, 32768, 32768, 32768, 64838, 15565, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 4681, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 6553, 49152, 61539, 32768, 32768, 32768, 32768, 32768, 4327, 32768, 1820, 32768, 4681, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 211, 8192, 32768, 4318, 28299, 32768, 9557, 1129, 16384, 6553, 32768, 1927, 32768, 53833, 60074, 32768, 57344, 32768, 32768, 8192, 32768, 32768, 32768, 32768, 32768, 468, 32768, 49152, 32768, 32768, 49152, 64736, 64736, 1424, 61895, 1560, 58946, 32768, 8192, 37683, 1820, 41086, 8192, 62259, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 963, 5461, 32768, 60854, 37236, 54613, 12288, 32768, 32768, 32768, 32768, 32768, 32768, 45056, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 43661, 64625, 32768, 32768, 32768, 62557, 60074, 63897, 61440, 64880, 63015, 32768, 63645, 32768, 2340, 32768, 819, 5461, 155, 64599, 32768, 32768, 32768, 32768, 54613, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 4096, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 2184, 32768, 32768, 32768, 32768, 32768, 65343, 56818, 32768, 32768, 32768, 5461, 32768, 32768, 61895, 60074, 32768, 32768, 32768, 16384, 32768, 32768, 481, 16384, 32768, 58982, 38010, 60074, 4096, 4681, 32768, 32768, 32768, 32768, 63351, 45875, 32768, 32768, 39789, 64046, 32768, 32768, 35888, 32768, 32768, 32768, 47776, 16384, 32768, 32768, 32768, 58982, 32768, 61440, 43008, 32768, 60074, 32768, 57344, 32768, 39789, 10922, 30720, 64275, 32768, 54613, 33747, 63015, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 58982, 2048, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 58982, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 65283, 54613, 57344, 62189, 32768, 54613, 32768, 32768, 32768, 32768, 24576, 57734, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 25746, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 61651, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 21723, 32768, 32768, 64170, 37179, 32768, 32768, 64543, 60891, 32768, 32768, 63715, 63915, 32768, 49152, 32768, 64599, 32768, 32768, 63831, 64406, 32768, 32768, 64773, 9728, 32768, 32768, 49152, 57344, 32768, 32768, 54613, 65407, 32768, 32768, 32768, 49152, 32768, 32768, 60854, 63608, 32768, 32768, 63811, 64309, 32768, 32768, 64131, 62421, 32768, 32768, 64181, 63284, 32768, 32768, 62557, 64853, 32768, 32768, 63975, 63578, 32768, 32768, 32768, 49152, 32768, 32768, 63990, 62642, 32768, 32768, 64998, 63659, 32768, 32768, 62997, 58748, 32768, 32768, 16384, 65485, 32768, 32768, 32768, 65240, 32768, 32768, 63030, 56524, 32768, 32768, 63608, 54613, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 1170, 32768, 45875, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 86, 32768, 18204, 32768, 6553, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 27306, 32768, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 65384, 32768, 65298, 183, 65131, 32768, 64666, 32768, 65343, 32768, 65318, 32768, 65007, 32768, 64006, 32768, 65251, 57344, 64111, 32768, 59941, 32768, 65145, 32768, 65311, 32768, 65067, 32768, 65093, 32768, 64512, 32768, 64443, 32768, 64867, 32768, 65362, 32768, 13560, 32768, 64365, 32768, 64512, 32768, 65093, 32768, 4096, 32768, 64478, 32768, 64572, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 43300, 32768, 32768, 32768, 61255, 32768, 65470, 32768, 58942, 32768, 65334, 32768, 65287, 32768, 64877, 32768, 65046, 32768, 65145, 32768, 65073, 32768, 64443, 32768, 64572, 32768, 64062, 32768, 65440, 32768, 64980, 32768, 65398, 32768, 65458, 32768, 62805, 32768, 62357, 32768, 63955, 32768, 44464, 32768, 23875, 32768, 65267, 32768, 65265, 32768, 60854, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 45641, 58982, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 2184, 1560, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 65417, 63506, 32768, 32768, 32768, 32768, 32768, 32768, 63351, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 64736, 32768, 40478, 32768, 32768, 32768, 16384, 8192, 32768, 32768, 32768, 32768, 64823, 32768, 32768, 32768, 65397, 61107, 63, 32768, 31462, 32768, 32768, 57344, 32768, 32768, 32768, 32768, 63608, 32768, 32768, 32768, 54193, 32768, 32768, 32768, 65372, 49152, 32768, 32768, 28912, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 63715, 31905, 49152, 32768, 64478, 47331, 32768, 32768, 64365, 45875, 32768, 32768, 63608, 36217, 32768, 32768, 63811, 44165, 32768, 32768, 64275, 41870, 32768, 32768, 64443, 35389, 32768, 32768, 64170, 32768, 32768, 32768, 64170, 39666, 32768, 32768, 64322, 43194, 32768, 32768, 63488, 32768, 32768, 32768, 10186, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 37683, 32768, 28987, 58982, 16384, 32768, 32768, 62557, 37137, 32768, 32768, 60074, 42598, 32768, 32768, 62557, 45056, 32768, 32768, 60074, 8192, 32768, 32768, 61440, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 60074, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 396, 10922, 20480, 64, 51492, 32768, 32768, 2520, 26396, 32768, 32768, 32768, 65349, 8192, 53833, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 5461, 1092, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 16384, 60854, 47331, 32768, 32768, 32768, 58982, 32768, 57344, 65235, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 63643, 32768, 32768, 32768, 64151, 22685, 4468, 63897, 65482, 32768, 32768, 63488, 64552, 22685, 9485, 63195, 63351, 32768, 32768, 63015, 64761, 24576, 12014, 65248, 61247, 32768, 32768, 63811, 64512, 22685, 3150, 32768, 32768, 32768, 32768, 32768, 64170, 22685, 9681, 32768, 64838, 32768, 32768, 32768, 64478, 19660, 7168, 32768, 32768, 32768, 32768, 54613, 65087, 19660, 8874, 54613, 32768, 32768, 32768, 32768, 64617, 22685, 7168, 57344, 65347, 32768, 32768, 57344, 63529, 24576, 11513, 32768, 32768, 32768, 32768, 57344, 65275, 22685, 3810, 62805, 63015, 32768, 32768, 64232, 61416, 32768, 32768, 65087, 65126, 32768, 32768, 2520, 36864, 32768, 32768, 32768, 57344, 32768, 32768, 65412, 51962, 32768, 32768, 63138, 27150, 32768, 32768, 60074, 3640, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 44223, 9444, 34393, 6692, 24632, 4302, 32768, 58982, 4681, 32768, 32768, 32768, 32768, 32768, 32768, 59753, 9830, 32768, 7561, 32768, 32768, 32768, 32768, 58514, 3276, 32768, 32768, 32768, 32768, 32768, 32768, 63608, 26356, 32768, 32768, 32768, 32768, 32768, 32768, 58514, 2520, 32768, 32768, 32768, 32768, 32768, 32768, 48188, 1489, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 60258, 32768, 780, 32768, 3640, 32768, 32768, 32768, 1927, 32768, 61895, 64980, 32768, 32768, 3640, 32768, 53248, 32768, 1365, 32768, 32768, 32768, 32768, 10922, 5782, 16384, 32768, 51492, 53248, 49152, 32768, 32768, 34539, 32768, 29855, 32768, 44418, 32768, 34448, 32768, 21425, 32768, 20083, 32768, 27069, 32768, 26916, 32768, 23728, 32768, 26065, 58982, 32768, 32768, 4096, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 57344, 32768, 14865, 32768, 19660, 54613, 6553, 2978, 8511, 32768, 32768, 60854, 32768, 32768, 32768, 32768, 65422, 32768, 24743, 64998, 32768, 32768, 32768, 32768, 40960, 16384, 16384, 16384, 64322, 23405, 64170, 141, 16384, 4096, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 59753, 32768, 32768, 32768, 62557, 32768, 54613, 32768, 32768, 32768, 32768, 32768, 65482, 32768, 61755, 32768, 5009, 32768, 42697, 32768, 60871, 32768, 47938, 32768, 34539, 32768, 46421, 32768, 57851, 32768, 54613, 32768, 65031, 64838, 8192, 32768, 21782, 16384, 50008, 63351, 51685, 3276, 60835, 32768, 32768, 32768, 49624, 32768, 31278, 54613, 52028, 32768, 58936, 5461, 55508, 4681, 48008, 32768, 65365, 32768, 32768, 32768, 56481, 32768, 13595, 32768, 54613, 54613, 32768, 32768, 32768, 49152, 10922, 4096, 16384, 32768, 32768, 32768, 32768, 32768, 13741, 32768, 32768, 32768, 32768, 32768, 32768, 64867, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 64905, 49152, 3996, 32768, 32768, 32768, 32768, 32768, 63841, 32768, 5120, 32768, 32768, 32768, 32768, 32768, 64131, 60854, 5213, 32768, 32768, 16384, 32768, 32768, 64998, 32768, 6214, 32768, 32768, 32768, 32768, 32768, 64917, 32768, 4681, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 62323, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 15291, 32768, 2048, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 6553, 49152, 23911, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 15291, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 63488, 17535, 40960, 42598, 32768, 32768, 32768, 32768, 32768, 436, 32768, 32768, 32768, 32768, 32768, 32768, 65403, 32768, 1092, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 936, 32768, 32768, 32768, 32768, 32768, 16384, 1820, 37809, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 655, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 13738, 2460, 5831, 62493, 54315, 45276, 53849, 55705, 19132, 36739, 44286, 52792, 32768, 32768, 32768, 32768, 41208, 3276, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 4096, 32768, 32768, 32768, 34588, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 28512, 8192, 32768, 32768, 12226, 50641, 32768, 6553, 32768, 32768, 32768, 32768, 32768, 32768, 6553, 49152, 60854, 32768, 19051, 32768, 21781, 21299, 10922, 32768, 1424, 32768, 16384, 32768, 38229, 32768, 32768, 32768, 25486, 32768, 22235, 32768, 25122, 49152, 31905, 16384, 42325, 32768, 31087, 32768, 41170, 32768, 37888, 32768, 32768, 32768, 32768, 32768, 45875, 57344, 1820, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 64823, 40960, 32768, 32768, 49152, 32768, 32768, 32768, 62805, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 58982, 32768, 23405, 1213, 32768, 32768, 60854, 32768, 32768, 32768, 61440, 32768, 32768, 32768, 63015, 24576, 32768, 32768, 38010, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 56275, 32768, 32768, 32768, 32768, 32768, 54613, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 65482, 32768, 64658, 25486, 51005, 65295, 11326, 52313, 38725, 32768, 56669, 37236, 45236, 32768, 60800, 34588, 49152, 32768, 60655, 43194, 64950, 32768, 61288, 42325, 6144, 32768, 58802, 24576, 32768, 32768, 61440, 34406, 65229, 32768, 46273, 28987, 49152, 32768, 53071, 46327, 18970, 6553, 60948, 32768, 63895, 32768, 7690, 32768, 64189, 32768, 49152, 32768, 41815, 32768, 4998, 1170, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 2730, 32768, 32768, 55318, 780, 6553, 32768, 45875, 8192, 54613, 60074, 17901, 46937, 26451, 10922, 60074, 4096, 32768, 32768, 58982, 32768, 32768, 32768, 57344, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 172, 32768, 32768, 1536, 8290, 32768, 167, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 204, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 62259, 60854, 63351, 57344, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 46421, 5461, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 4096, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 64572, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 52649, 32768, 32768, 32768, 564, 32768, 32768, 3327, 63195, 32768, 32768, 63608, 63608, 32768, 32768, 63608, 63715, 32768, 32768, 63351, 63715, 10922, 32768, 64170, 63195, 32768, 32768, 63715, 60854, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 62557, 6553, 65487, 32768, 16384, 32768, 32768, 19660, 32768, 19660, 16384, 32768, 32768, 32768, 2730, 32768, 54613, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 58982, 2730, 25486, 32768, 1057, 50846, 32768, 54613, 32768, 32768, 32768, 49152, 1424, 8192, 47104, 32768, 32768, 32768, 58412, 49152, 65061, 64572, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 8192, 32768, 32768, 32768, 10922, 6553, 16384, 32768, 8192, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 29081, 833, 36364, 474, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 57344, 23235, 5461, 22937, 32768, 32768, 60074, 25941, 32768, 63351, 32768, 32768, 32768, 32768, 32768, 8192, 32768, 4888, 3625, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 13653, 15034, 1213, 32768, 32768, 32768, 58982, 30720, 32768, 61895, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 64046, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 45901, 32768, 14777, 32768, 2340, 51032, 36128, 1489, 42130, 32768, 58982, 58982, 39547, 40960, 25941, 32768, 44960, 32768, 16802, 60074, 54613, 65015, 39918, 149, 1638, 32768, 32768, 32768, 10922, 32768, 24576, 32768, 25486, 16384, 25796, 32768, 32768, 56599, 20772, 2978, 30146, 32768, 26916, 60074, 38345, 32768, 34366, 32768, 27525, 32768, 40413, 32768, 4096, 32768, 6746, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 8192, 38725, 42780, 3276, 18204, 32768, 32768, 51492, 37809, 32768, 61440, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 49186, 2600, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 36996, 4096, 5461, 32768, 32768, 58982, 41506, 32768, 62259, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 65061, 32768, 45875, 32768, 54624, 58982, 31576, 62805, 37053, 13575, 25278, 32768, 39817, 58982, 41075, 32768, 63015, 32768, 60314, 32768, 64940, 32768, 32768, 32768, 30847, 32768, 65408, 32768, 64572, 32768, 63715, 32768, 64978, 32768, 55237, 32768, 28796, 32768, 65269, 57344, 17052, 153, 47899, 32768, 60016, 58982, 30427, 32768, 45511, 32768, 10922, 32768, 49152, 32768, 26810, 32768, 15588, 190, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 15855, 49152, 32768, 58982, 38864, 3640, 45875, 32768, 32768, 58982, 47104, 32768, 62805, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 54613, 14124, 5461, 32768, 32768, 32768, 58982, 18022, 32768, 62259, 32768, 32768, 32768, 39009, 54613, 32768, 64572, 5811, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 885, 29225, 57344, 474, 63715, 22838, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 10922, 32768, 17164, 682, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 99, 32768, 32768, 1057, 32768, 27306, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 2978, 32768, 32768, 4681, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 57344, 32768, 22908, 32768, 32768, 64275, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 546, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 60854, 32768, 138, 32768, 7447, 54613, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 26255, 56653, 52809, 34905, 6441, 31278, 47331, 6031, 40049, 43978, 36996, 39404, 45260, 17694, 29491, 32768, 35821, 31248, 2760, 37880, 53457, 23377, 37137, 3900, 32768, 32768, 32768, 32768, 32768, 58982, 32768, 16384, 45534, 51808, 39009, 61895, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 46289, 32768, 24576, 32768, 682, 54613, 38725, 8192, 26810, 27306, 23405, 44683, 32768, 32768, 1724, 32768, 47651, 1489, 14450, 32768, 32768, 32768, 5461, 32768, 287, 49152, 4915, 32768, 15846, 32768, 61895, 32768, 26021, 16384, 39069, 32768, 23911, 54613, 32768, 10922, 27913, 22282, 34753, 57344, 41984, 32768, 25869, 32768, 32768, 32768, 23911, 32768, 2730, 32768, 461, 32768, 32768, 32768, 16384, 32768, 8192, 32768, 32768, 32768, 65477, 61071, 32768, 32768, 11342, 20024, 32768, 4096, 32768, 50876, 1927, 21669, 60854, 32768, 60854, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 39789, 49152, 32768, 32768, 57462, 55910, 32768, 32768, 49263, 26466, 42130, 936, 1927, 45762, 32768, 62805, 61440, 32768, 57344, 32768, 58672, 32768, 32768, 32768, 64365, 61895, 53248, 32768, 36440, 64838, 10922, 32768, 32768, 52932, 65445, 32768, 64971, 32085, 53313, 32768, 50287, 41807, 27306, 6553, 51190, 48088, 48761, 61440, 51492, 36623, 32768, 32768, 64867, 39594, 64554, 32768, 64867, 49758, 42130, 32768, 64552, 39009, 62805, 32768, 58604, 44236, 58717, 32768, 64170, 30037, 63195, 32768, 59851, 34257, 8247, 32768, 62704, 32768, 24311, 61895, 16218, 32768, 32768, 32768, 6068, 32768, 1057, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 15391, 8192, 20258, 57344, 16384, 32768, 32768, 62259, 32768, 32768, 32768, 54613, 8192, 32768, 32768, 62805, 10922, 32768, 32768, 49152, 8192, 32768, 32768, 57344, 45875, 32768, 32768, 32768, 58982, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 59467, 64379, 14659, 2457, 32768, 32768, 1129, 32768, 32768, 16384, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 2808, 4681, 20369, 32768, 32768, 32768, 32768, 2520, 46484, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 58982, 32768, 32768, 32768, 64980, 32768, 32768, 32768, 14894, 840, 32768, 32768, 32768, 4681, 32768, 32768, 32768, 62805, 32768, 32768, 63195, 39789, 32768, 32768, 1927, 7801, 32768, 16384, 65007, 10922, 32768, 32768, 49152, 32768, 32768, 16384, 32768, 54956, 32768, 32768, 32768, 59234, 36864, 16384, 55109, 63618, 32768, 5461, 34539, 65226, 56599, 46694, 64838, 62426, 32768, 32768, 63015, 63228, 49152, 19660, 63701, 65006, 32768, 32768, 64365, 63975, 58982, 16384, 64807, 41923, 32768, 32768, 32768, 62949, 58982, 13653, 60854, 65461, 32768, 32768, 32768, 59753, 44470, 7561, 52792, 51672, 32768, 32768, 54613, 61539, 42130, 15291, 64755, 54897, 32768, 32768, 65391, 62784, 42130, 29491, 63488, 64629, 32768, 32768, 57344, 61067, 51492, 32768, 32768, 618, 32768, 32768, 35016, 58752, 20631, 3005, 63793, 63470, 60854, 32768, 64797, 28472, 32768, 32768, 65054, 65238, 32768, 32768, 2048, 64543, 32768, 32768, 32768, 65379, 32768, 32768, 49152, 8192, 32768, 32768, 61405, 18492, 32768, 5461, 8192, 60438, 14612, 57344, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 63715, 32768, 32768, 32768, 32768, 32768, 64090, 62364, 7645, 32768, 6553, 32768, 32768, 32768, 32768, 13653, 4096, 51492, 1998, 45875, 32768, 64443, 63909, 30181, 2048, 19660, 40960, 44782, 6553, 32768, 32768, 49152, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 45875, 936, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 52586, 32768, 61255, 32768, 618, 38229, 32768, 32768, 7204, 42130, 496, 45511, 32768, 32768, 59234, 32768, 51427, 32768, 385, 32768, 32768, 32768, 2730, 32768, 3193, 10922, 5173, 40960, 7388, 60074, 60854, 32768, 42130, 5461, 32768, 32768, 29876, 8192, 22755, 16384, 41984, 5461, 19114, 64170, 40760, 49152, 26021, 32768, 31857, 32768, 37754, 32768, 4681, 32768, 222, 32768, 32768, 32768, 10922, 32768, 10922, 32768, 32768, 32768, 32768, 10922, 64538, 32768, 43300, 19114, 12822, 4681, 3208, 27306, 38010, 59234, 63015, 32768, 32768, 32768, 49152, 32768, 56599, 16384, 32768, 32768, 32768, 32768, 32768, 16384, 49152, 32768, 32768, 32768, 54613, 32768, 32768, 32768, 1310, 32768, 54613, 10922, 32768, 32768, 32768, 65483, 1424, 32768, 32768, 54613, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 21557, 32768, 32768, 32768, 6553, 32768, 32768, 32768, 64796, 32768, 32768, 32768, 63195, 32768, 44683, 57344, 57908, 32768, 13151, 32768, 37548, 49152, 31031, 32768, 64823, 32768, 58982, 32768, 65039, 32768, 49152, 32768, 5461, 3276, 42688, 5461, 55018, 14894, 41649, 47891, 65031, 32768, 57786, 32768, 57974, 32768, 28064, 32768, 36320, 32768, 53983, 4756, 2940, 32768, 43648, 32768, 33337, 32768, 62712, 32768, 33332, 32768, 8936, 32768, 32768, 32768, 32768, 49152, 24576, 22762, 32768, 32768, 32768, 32768, 32768, 32768, 52601, 32768, 32768, 32768, 32768, 32768, 44, 63715, 32768, 30947, 8192, 32768, 32768, 32768, 32768, 64225, 32768, 23405, 32768, 32768, 32768, 32768, 32768, 63897, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 56599, 32768, 13653, 6553, 49152, 32768, 32768, 32768, 63608, 32768, 29257, 32768, 32768, 32768, 32768, 32768, 64046, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 62557, 32768, 2340, 28672, 32768, 4681, 65087, 32768, 32768, 32768, 32768, 32768, 57344, 32768, 10922, 57344, 16384, 32768, 16384, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 4681, 32768, 32768, 2520, 32768, 16384, 32768, 6553, 2730, 10922, 60074, 16384, 32768, 32768, 16384, 54613, 27726, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 19660, 32768, 32768, 32768, 32768, 32768, 32768, 65179, 13341, 32768, 32768, 32768, 32768, 7074, 59392, 16384, 49152, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 3640, 32768, 32768, 32768, 32768, 43300, 22420, 16384, 31675, 61440, 2520, 32768, 32768, 32768, 32768, 32768, 344, 461, 53463, 32768, 1638, 32768, 489, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 20480, 32768, 32768, 32768, 32768, 32768, 32768, 65435, 32768, 32768, 32768, 32768, 32768, 284, 39789, 32768, 54613, 32768, 49152, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 28672, 24576, 24576, 45875, 40049, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 6553, 5461, 32768, 33002, 36138, 55741, 16384, 31727, 34676, 35522, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 58982, 32768, 8192, 23665, 42130, 1927, 32768, 45056, 8192, 32768, 32768, 2910, 32768, 32768, 489, 20852, 23665, 32768, 32768, 32768, 4096, 6553, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 4096, 43938, 57344, 32768, 62805, 29354, 60257, 34681, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 21641, 32768, 16384, 32768, 712, 32768, 31087, 4681, 6553, 54613, 8192, 64880, 28524, 34648, 35542, 32768, 46702, 16384, 112, 32768, 32768, 32768, 10922, 819, 3489, 32768, 596, 32768, 53908, 2520, 32768, 32768, 24185, 16384, 19362, 32768, 37809, 7021, 30093, 2184, 15018, 32768, 27306, 58982, 38369, 18271, 29967, 32768, 30996, 32768, 36864, 32768, 32768, 32768, 324, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 65446, 60080, 63488, 32768, 942, 31628, 26425, 1489, 21703, 54613, 1057, 62401, 49115, 26636, 8561, 32768, 60074, 24576, 63897, 32768, 32768, 61440, 58982, 39432, 39666, 17347, 32768, 32768, 64950, 2184, 32768, 32768, 56293, 41825, 32768, 32768, 21193, 27392, 20480, 3780, 45875, 16384, 58982, 65258, 54613, 65254, 12376, 176, 58621, 32768, 32768, 32768, 65099, 32768, 45251, 32768, 28539, 64880, 16384, 32768, 60854, 61895, 65472, 32768, 63608, 30146, 48188, 32768, 44153, 26503, 37969, 2340, 48496, 19555, 62838, 47014, 60489, 54025, 17944, 32768, 64512, 38466, 65494, 32768, 63488, 36217, 32768, 1310, 64166, 29876, 62805, 32768, 65438, 28867, 58173, 32768, 47171, 16969, 32768, 32768, 37311, 24977, 12332, 4681, 51307, 32768, 35596, 65126, 41257, 51492, 25486, 32768, 32768, 32768, 19660, 32768, 36217, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 17644, 32768, 32768, 61440, 61895, 28672, 32768, 28672, 30996, 36352, 6144, 32768, 57974, 19660, 32768, 32768, 58982, 32768, 32768, 1927, 44683, 25869, 32768, 32768, 32768, 2048, 32768, 32768, 32768, 32768, 32768, 32768, 5461, 32768, 32768, 3276, 32768, 32768, 32768, 32768, 53531, 65498, 16315, 799, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 57344, 32768, 6553, 28796, 58292, 13492, 32768, 57344, 32768, 32768, 32768, 32768, 32768, 32768, 2340, 57344, 25746, 32768, 32768, 32768, 4096, 32768, 32768, 32768, 16384, 32768, 32768, 8192, 4681, 32768, 32768, 32768, 32768, 32768, 32768, 64443, 53833, 3276, 32768, 49152, 57344, 32768, 32768, 65054, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 43509, 32768, 32768, 32768, 32768, 32768, 32768, 58412, 63897, 4681, 32768, 60854, 63015, 32768, 58368, 20675, 35320, 44740, 728, 64023, 54193, 32768, 32768, 52587, 58297, 32768, 2340, 53908, 60127, 32768, 32768, 63897, 8192, 32768, 32768, 59779, 54613, 32768, 32768, 32768, 65410, 32768, 32768, 32768, 32768, 32768, 64940, 45702, 56485, 56599, 32768, 32768, 64170, 32768, 32768, 62805, 57344, 32768, 32768, 63811, 64443, 32768, 32768, 64716, 62533, 32768, 32768, 63351, 65258, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 61440, 32768, 4096, 44719, 54921, 48094, 32768, 62482, 54055, 32768, 32768, 64950, 65232, 32768, 2340, 32768, 14745, 32768, 32768, 60074, 52212, 32768, 32768, 32768, 32768, 32768, 32768, 1424, 29491, 32768, 3276, 32768, 32768, 32768, 64716, 58572, 17052, 23498, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 1638, 37809, 32768, 32768, 40960, 54613, 6553, 5461, 25258, 49429, 27033, 32768, 49152, 8192, 58514, 32768, 18521, 32768, 32768, 2184, 44470, 13653, 32768, 32768, 32768, 3276, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 50142, 32768, 16384, 32768, 762, 8192, 8192, 3276, 32768, 54613, 32768, 62211, 61903, 57582, 442, 32768, 44043, 6553, 26313, 32768, 32768, 32768, 32768, 1927, 17014, 20284, 49152, 32768, 5285, 1927, 51492, 32768, 32768, 16384, 32768, 32768, 646, 43128, 16384, 4096, 57344, 32768, 16384, 61440, 47236, 7141, 63777, 16384, 32768, 32768, 32768, 32768, 27306, 32768, 1820, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 114, 54193, 32768, 269, 12855, 5461, 728, 12983, 58982, 32768, 64365, 54160, 29302, 21718, 744, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 63811, 49152, 32768, 32768, 32768, 32768, 32768, 48817, 65455, 6746, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 65402, 32768, 32768, 32768, 63897, 32768, 56599, 32768, 57344, 32768, 10426, 32768, 44962, 61895, 22235, 55898, 63811, 32768, 55159, 32768, 64950, 32768, 32768, 32768, 32768, 32768, 63351, 32768, 63811, 32768, 30796, 32768, 45415, 32768, 53833, 32768, 32768, 32768, 65358, 10922, 869, 32768, 63975, 32768, 64940, 65365, 53248, 762, 3276, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 60854, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 1129, 49152, 32768, 32768, 32768, 32768, 32768, 61440, 32768, 54613, 62557, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 3640, 32768, 32768, 431, 58982, 32768, 32768, 32768, 2978, 5461, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 54613, 58982, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 54613, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 6553, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 3584, 64365, 32768, 32768, 45056, 56115, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 30444, 32768, 32768, 32768, 2730, 32768, 32768, 32768, 2048, 27306, 32768, 19660, 32768, 38229, 3276, 32768, 15291, 14927, 1365, 1442, 44470, 36181, 6553, 32768, 2006, 32768, 10922, 32768, 37683, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 1424, 32768, 32768, 32768, 16384, 32768, 3276, 32768, 32768, 32768, 65472, 64664, 32768, 32768, 32768, 32768, 32768, 32768, 60655, 32768, 32768, 8192, 58982, 60854, 5461, 32768, 61440, 4915, 7021, 18204, 32768, 1376, 6553, 63488, 32768, 32768, 32768, 49152, 56912, 60250, 32768, 32768, 64623, 63291, 2150, 32768, 42461, 52106, 32768, 58163, 32768, 32768, 32768, 32768, 63811, 32768, 32768, 32768, 52575, 32768, 32768, 32768, 65260, 60074, 25486, 32768, 35792, 64322, 37137, 32768, 32768, 63488, 65450, 32768, 64365, 38619, 65278, 32768, 64322, 38010, 49152, 32768, 62025, 41316, 27278, 8192, 61812, 30720, 55978, 32768, 38864, 42477, 57706, 41912, 64322, 31507, 60074, 49152, 47208, 38010, 8495, 49152, 64572, 35888, 62784, 32768, 64170, 45641, 32768, 32768, 35556, 36623, 49152, 32768, 35470, 16384, 57344, 32768, 14138, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10369, 15347, 54332, 58982, 23405, 32768, 32768, 60854, 32768, 5461, 8192, 55898, 54613, 5461, 32768, 13263, 7801, 3640, 63351, 57344, 10922, 32768, 57344, 54613, 24576, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 63351, 32768, 32768, 32768, 63015, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 54613, 32768, 32768, 10922, 12743, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 28672, 57344, 35389, 32768, 32768, 32768, 32768, 2184, 54613, 655, 963, 32768, 40960, 63408, 32768, 5461, 1787, 16384, 44530, 62103, 37163, 1724, 64225, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 64322, 32386, 32768, 32768, 32768, 16384, 32768, 16384, 65217, 8192, 32768, 32768, 32768, 3276, 49152, 45875, 32768, 57783, 32768, 32768, 32768, 32768, 49152, 32768, 64695, 62048, 32768, 32768, 39666, 64971, 32768, 19660, 61974, 62733, 10922, 32768, 44683, 42056, 585, 44297, 65014, 57645, 32768, 49152, 64755, 58327, 8192, 32768, 57344, 16384, 32768, 32768, 63934, 63424, 32768, 32768, 57344, 65501, 32768, 32768, 32768, 32768, 32768, 32768, 58982, 32768, 32768, 32768, 57344, 58124, 32768, 32768, 32768, 64478, 32768, 32768, 32768, 64046, 32768, 32768, 63704, 58314, 32768, 32768, 62385, 57344, 32768, 32768, 32768, 32768, 32768, 32768, 65248, 63945, 862, 32768, 64147, 33917, 54613, 32768, 32768, 64245, 1927, 62805, 65110, 62605, 32768, 61440, 63897, 51386, 32768, 32768, 63015, 64893, 32768, 32768, 61895, 60362, 32768, 32768, 60549, 60969, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 17094, 42673, 50658, 2715, 25650, 4457, 6553, 59941, 31996, 40960, 32768, 32768, 60074, 32768, 218, 585, 4681, 13863, 23405, 8192, 32768, 64170, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 44418, 60854, 32768, 32768, 32768, 32768, 32768, 1310, 53248, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 5223, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 4681, 32768, 56433, 54105, 1310, 64450, 29696, 1820, 48106, 10922, 4681, 8192, 25486, 54613, 63488, 32768, 54613, 32768, 32768, 32768, 8192, 32768, 54613, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 36548, 54613, 49152, 32768, 1724, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 24576, 32768, 10922, 32768, 13492, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 64695, 2048, 35816, 64880, 49152, 16384, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 50641, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 6746, 32768, 32768, 32768, 65267, 32768, 64275, 32768, 33508, 32768, 60250, 32768, 32671, 32768, 19457, 32768, 41795, 24576, 11804, 32768, 63499, 32768, 8192, 34257, 56307, 65281, 28672, 24576, 48605, 44782, 62458, 16384, 58669, 32768, 53896, 32768, 63305, 32768, 28747, 32768, 19660, 16384, 45276, 32768, 39922, 618, 48275, 54613, 32768, 32768, 64791, 32768, 32768, 32768, 15360, 32768, 32768, 32768, 65181, 32768, 24576, 10922, 32768, 32768, 21344, 42978, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 10922, 11702, 32768, 32768, 49152, 32768, 744, 1024, 30720, 57734, 32768, 40960, 36864, 60854, 32768, 8192, 32768, 19660, 32768, 32768, 32768, 32768, 32768, 2184, 49152, 27306, 32768, 32768, 32768, 32768, 16384, 7899, 65238, 14745, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 49152, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 2978, 2184, 32768, 32768, 32768, 32768, 4681, 32768, 32768, 19660, 32768, 32768, 32768, 32768, 9722, 819, 5461, 61755, 9102, 32768, 49152, 54613, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 25486, 60854, 32768, 32768, 32768, 32768, 2730, 32768, 1638, 32768, 54613, 32768, 63811, 32768, 38229, 16865, 10922, 58604, 64170, 3276, 16384, 63897, 16384, 16384, 32768, 17644, 32768, 32768, 32768, 32768, 62557, 32768, 1489, 2730, 32768, 32768, 32768, 32768, 32768, 1820, 49152, 32768, 32768, 32768, 32768, 32768, 65334, 32768, 2978, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 16384, 32768, 49152, 32768, 12288, 32768, 32768, 32768, 32768, 64406, 61895, 1473, 46996, 38466, 2214, 32768, 60854, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 49152, 32768, 6553, 32768, 1927, 32768, 12276, 2550, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 58982, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 399, 2978, 32768, 25057, 22365, 23405, 2184, 60854, 32768, 32768, 32768, 32768, 54613, 32768, 32768, 32768, 32768, 32768, 27306, 32768, 62805, 63975, 32768, 32768, 60854, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 3276, 32768, 16384, 32768, 58982, 54613, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 6553, 32768, 26466, 32768, 46173, 49152, 29257, 27033, 16384, 32768, 16384, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 65271, 50244, 58982, 32768, 32768, 32768, 32768, 32768, 12288, 54613, 3276, 4096, 32768, 32768, 64365, 32768, 25486, 528, 42850, 49152, 59234, 30427, 3640, 63015, 32768, 8192, 32768, 32768, 62805, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 47891, 57344, 32768, 32768, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49291, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 58982, 32768, 16384, 32768, 32768, 49152, 32768, 32768, 64512, 38010, 60854, 32768, 64322, 40413, 49152, 32768, 50641, 43115, 13653, 16384, 64599, 36623, 32768, 32768, 34053, 12994, 489, 44904, 42130, 21743, 1820, 58982, 64406, 28539, 16384, 32768, 64478, 41870, 65253, 32768, 64111, 48188, 57344, 49152, 64170, 45251, 60854, 32768, 51492, 32768, 64791, 32768, 20480, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 1310, 2520, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 32768, 3863, 32768, 63715, 1724, 32768, 32768, 1233, 6553, 606, 8936, 61440, 16384, 57344, 32768, 8037, 468, 8314, 24660, 65163, 10922, 16384, 63015, 54613, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 45875, 32768, 712, 16384, 4681, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 60074, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 54613, 2457, 53547, 55705, 520, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 64950, 32768, 57344, 32768, 32768, 32768, 32768, 32768, 32768, 63015, 32768, 32768, 32768, 32768, 32768, 32768, 63488, 64000, 32768, 32768, 63608, 65031, 32768, 32768, 64046, 63462, 32768, 32768, 43115, 35316, 23945, 49152, 65093, 57974, 32768, 32768, 65414, 49068, 32768, 32768, 62259, 63715, 32768, 32768, 32768, 49152, 32768, 32768, 8103, 57779, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 62557, 61507, 58982, 6553, 63688, 61557, 30279, 58982, 49152, 65318, 32768, 32768, 32768, 54613, 32768, 32768, 60549, 50041, 57344, 32768, 32768, 49152, 49152, 32768, 42130, 64561, 6553, 32768, 61382, 64565, 63975, 32768, 55485, 50957, 23156, 61895, 65093, 32768, 32768, 60854, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 57344, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 18764, 13835, 15179, 963, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 32768, 32768, 5461, 32768, 54613, 32768, 32768, 32768, 18204, 32768, 4096, 32768, 49225, 22997, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 35498, 32768, 32768, 61895, 9637, 30427, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 64853, 3276, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 52224, 32768, 34406, 32768, 6553, 63975, 63488, 840, 32768, 32768, 16384, 32768, 32768, 32768, 6553, 32768, 40816, 1057, 35351, 63681, 6553, 65099, 59637, 330, 2340, 32768, 49152, 32768, 55296, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 47331, 1638, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 8192, 32768, 32768, 32768, 32768, 32768, 268, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 1170, 8192, 45056, 27306, 32768, 32768, 56669, 7447, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 65074, 32768, 32768, 32768, 60701, 32768, 32768, 65046, 55563, 16384, 32768, 32768, 50551, 16384, 42598, 32768, 16384, 32768, 32768, 32768, 62259, 32768, 3640, 32768, 5932, 40049, 57344, 32768, 29491, 6553, 26810, 32768, 58982, 32768, 16384, 32768, 37809, 49152, 32768, 32768, 26374, 8192, 32768, 32768, 54613, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 8192, 32768, 32768, 32768, 5608, 154, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 44860, 63488, 32768, 63608, 51651, 337, 49152, 49152, 32768, 49152, 1310, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 5461, 32768, 32768, 32768, 62805, 49152, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 38229, 49152, 32768, 32768, 1342, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 40632, 57344, 32768, 54613, 19660, 32768, 3840, 32768, 6553, 45056, 32768, 32768, 54613, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 59392, 1170, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 60854, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 61440, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 40960, 54613, 32768, 32768, 49152, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 65258, 16384, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 10922, 65449, 14043, 32768, 32768, 32768, 32768, 32768, 26119, 26321, 6068, 36668, 47747, 14269, 40960, 32768, 50771, 36128, 8440, 33492, 51985, 24576, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 1560, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32170, 32768, 32768, 32768, 910, 32768, 32768, 32768, 819, 6877, 6553, 54613, 44600, 32768, 6553, 32768, 1329, 18, 348, 64607, 32768, 32768, 2184, 58982, 17993, 19347, 484, 22154, 61347, 23799, 1424, 32768, 32768, 32768, 32768, 32768, 12288, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 436, 32768, 5461, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 64823, 61440, 32768, 32768, 32768, 32768, 32768, 32768, 4915, 58982, 4096, 16384, 25869, 29647, 13492, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 62464, 20631, 15639, 4964, 22341, 40960, 76, 574, 32768, 54613, 49152, 32768, 32768, 44333, 32768, 54613, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 56713, 32768, 32768, 32768, 62557, 32768, 2730, 32768, 32768, 62259, 1365, 32768, 49152, 32768, 65447, 32768, 64365, 44683, 65458, 32768, 65198, 45875, 64046, 32768, 36983, 49572, 43042, 6553, 42496, 35354, 39069, 32768, 64543, 39594, 65408, 32768, 63897, 37683, 32768, 64893, 35863, 29193, 36935, 37793, 62759, 2273, 65488, 32768, 33280, 36623, 32768, 32768, 64867, 46173, 60942, 32768, 37922, 32768, 64666, 32768, 15855, 32768, 54613, 32768, 32768, 32768, 13690, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 3276, 28299, 12691, 62259, 8192, 32768, 32768, 29647, 44470, 2520, 19660, 41807, 22282, 7561, 32768, 61895, 6553, 32768, 49152, 61440, 16384, 32768, 49152, 20753, 401, 2883, 61895, 54613, 4096, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 64268, 30427, 32768, 32768, 32768, 32768, 279, 62259, 409, 30427, 32768, 49152, 35389, 49152, 32768, 60854, 16384, 32768, 32768, 32768, 54613, 65271, 44505, 4096, 6068, 49836, 51273, 256, 364, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 60074, 49152, 32768, 54613, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 65007, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54983, 32768, 32768, 32768, 32768, 64998, 58982, 64111, 63500, 32768, 32768, 9393, 65408, 26125, 32768, 48008, 52830, 4096, 32768, 63015, 65325, 63015, 32768, 63522, 47598, 32768, 64828, 54365, 42707, 5054, 46385, 62763, 1966, 32768, 32768, 32768, 63975, 60854, 32768, 62259, 65394, 32768, 32768, 32768, 63975, 57344, 32768, 32768, 32768, 32768, 32768, 32768, 64046, 57344, 32768, 32768, 32768, 32768, 32768, 32768, 63975, 57344, 32768, 32768, 65392, 32768, 32768, 32768, 63975, 58982, 32768, 32768, 32768, 32768, 32768, 6553, 64225, 7099, 19660, 54613, 62805, 61895, 32768, 32768, 61440, 32768, 32768, 64151, 32768, 32768, 65223, 45875, 9604, 32768, 19660, 63748, 2048, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 61440, 32768, 32768, 32768, 32768, 32768, 1280, 61895, 936, 24094, 54613, 32768, 62557, 40960, 32768, 32768, 40960, 32768, 2048, 32768, 32768, 65265, 356, 4903, 2954, 54494, 64111, 1560, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 4681, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 27196, 32768, 32768, 16384, 3276, 32768, 32768, 32768, 5461, 60854, 2340, 54613, 54613, 32768, 2978, 32768, 56360, 32768, 394, 32768, 32768, 32768, 3640, 48111, 14866, 42650, 4456, 62426, 31087, 10240, 65409, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 16384, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 6553, 8192, 32768, 546, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 546, 54613, 16384, 32768, 32768, 32768, 10922, 58982, 16384, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 16384, 32768, 32768, 32768, 16384, 32768, 32768, 54613, 59392, 58982, 2340, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 60854, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 64291, 32768, 32768, 32768, 1724, 32768, 32768, 32768, 65431, 32768, 32768, 32768, 64644, 32768, 58218, 32768, 64853, 32768, 29358, 58982, 27322, 9637, 64170, 32768, 44683, 32768, 32768, 32768, 63372, 32768, 32768, 32768, 32768, 65015, 38356, 7234, 50299, 26810, 37287, 10922, 64798, 32768, 40897, 16384, 49152, 32768, 49152, 32768, 56621, 32768, 5649, 4681, 64572, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 20480, 32768, 65260, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 32768, 32768, 32768, 32768, 32768, 2397, 58982, 1489, 9102, 49152, 32768, 63897, 49152, 32768, 32768, 16384, 27306, 32768, 32768, 32768, 8495, 352, 104, 348, 58293, 32768, 7372, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 64111, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 1512, 32768, 52272, 30037, 32768, 32768, 32768, 49152, 32768, 10922, 49152, 49152, 60854, 32768, 58982, 65074, 7001, 6661, 16384, 15955, 16500, 10922, 32768, 32768, 32768, 32768, 64111, 1927, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 62259, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 6553, 32768, 32768, 32768, 32768, 32768, 32768, 63351, 799, 32768, 32768, 32768, 32768, 1013, 65015, 344, 6826, 49152, 32768, 64443, 57344, 32768, 8192, 32768, 16384, 32768, 32768, 32768, 55653, 4580, 23197, 16384, 30849, 57954, 12705, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 2409, 60074, 4096, 27306, 32768, 32768, 54613, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 63351, 64980, 41181, 50641, 31822, 27672, 885, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 8519, 61440, 9637, 1849, 32768, 32768, 63351, 32768, 49152, 10922, 49152, 32768, 5594, 32768, 32768, 65342, 370, 2538, 6553, 35667, 65121, 369, 442, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 57344, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 48339, 32768, 16384, 32768, 4681, 32768, 16384, 32768, 32768, 60074, 32768, 32768, 32768, 32768, 46669, 32768, 24502, 32768, 179, 32768, 32768, 32768, 5461, 63351, 282, 45875, 2994, 32768, 14199, 3640, 53248, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 1820, 32768, 188, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 57344, 32768, 64893, 65243, 63015, 32768, 32768, 32768, 32768, 32768, 1807, 58982, 4986, 54116, 32768, 32768, 60854, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 63975, 59276, 967, 6398, 54740, 62259, 5509, 203, 32768, 42130, 32768, 32768, 32768, 47513, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 62879, 32768, 32768, 32768, 49152, 54613, 6553, 32768, 39069, 58982, 1260, 32768, 32768, 32768, 65145, 32768, 60620, 46565, 65483, 32768, 64650, 50517, 57032, 32768, 38061, 52186, 51539, 40785, 63681, 44333, 24608, 32768, 64275, 46173, 65313, 32768, 63975, 43008, 39069, 65229, 49350, 9606, 4942, 52736, 62264, 5934, 50155, 32768, 62070, 44470, 49152, 32768, 37018, 50322, 31662, 32768, 18792, 32768, 65451, 32768, 43453, 32768, 64207, 32768, 32768, 32768, 24248, 32768, 60074, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 51252, 32768, 61440, 45875, 32768, 32768, 1113, 40960, 1117, 36722, 57344, 5461, 64046, 32768, 60074, 6553, 32768, 49152, 57344, 16384, 60854, 64976, 3307, 169, 973, 58322, 61772, 35926, 762, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 1092, 32768, 32768, 32768, 32768, 32768, 273, 62259, 25486, 176, 62557, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 46462, 52932, 461, 44942, 54004, 164, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 64929, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 65397, 32768, 32768, 32768, 32768, 32768, 32768, 63195, 65352, 32768, 32768, 63811, 52251, 10922, 16384, 63015, 62805, 32768, 32768, 63715, 62805, 32768, 32768, 64023, 64543, 54613, 32768, 7110, 15935, 1260, 32768, 61440, 5461, 32768, 32768, 32768, 65382, 32768, 32768, 32768, 62381, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 57344, 32768, 32768, 32768, 32768, 32768, 32768, 53248, 49152, 32768, 32768, 58982, 62949, 32768, 32768, 65329, 63715, 60854, 32768, 32768, 16384, 32768, 32768, 2226, 65262, 2730, 36780, 64046, 63608, 62557, 5461, 8192, 57344, 32768, 32768, 65067, 49152, 32768, 63351, 13284, 46631, 270, 63488, 64046, 62259, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 60854, 6553, 10922, 32768, 32768, 57344, 32768, 32768, 32768, 16384, 32768, 1820, 32768, 32768, 32768, 32768, 10922, 32768, 5461, 60074, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54906, 32768, 32768, 32768, 5461, 32768, 32768, 32768, 8192, 58982, 8192, 32768, 32768, 32768, 12288, 32768, 40257, 32768, 1560, 32768, 32768, 32768, 32768, 32768, 6144, 32768, 10922, 54613, 34257, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 2520, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 58982, 4681, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 58982, 32768, 4096, 16384, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 63195, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 65367, 32768, 32768, 32768, 65167, 32768, 44723, 32768, 60403, 32768, 59624, 49152, 64111, 32768, 21202, 32768, 39259, 32768, 32768, 32768, 64861, 32768, 32768, 32768, 47014, 32768, 43338, 32768, 50747, 32768, 42084, 32768, 52302, 32768, 62671, 32768, 32768, 32768, 31280, 32768, 51324, 32768, 32058, 32768, 65383, 32768, 65240, 32768, 26422, 32768, 8623, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 57344, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 18432, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 61440, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 18305, 32768, 32768, 32768, 2340, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 1820, 32768, 37969, 1310, 330, 54613, 32768, 32768, 1927, 32768, 306, 32768, 165, 32768, 2520, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 3276, 32768, 376, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 64929, 59234, 49152, 32768, 61895, 32768, 60854, 32768, 64880, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 54613, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 54613, 32768, 32768, 32768, 65024, 49152, 946, 32768, 51252, 32768, 65349, 40960, 32768, 32768, 32768, 32768, 54613, 32768, 32768, 32768, 53521, 32768, 32768, 32768, 32768, 49152, 37137, 32768, 32768, 57344, 16384, 32768, 32768, 32768, 65436, 32768, 65074, 41441, 65481, 32768, 65104, 49152, 51492, 32768, 65251, 47153, 49323, 32768, 64275, 52736, 32768, 32768, 65080, 50907, 64838, 32768, 65183, 44877, 32768, 32768, 64794, 50209, 10922, 32768, 65229, 46917, 64240, 32768, 64006, 49834, 32768, 32768, 63593, 50641, 37236, 32768, 43541, 32768, 65121, 32768, 25869, 32768, 57344, 32768, 16384, 32768, 30146, 32768, 39789, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 22685, 37179, 11815, 63351, 4681, 32768, 32768, 63608, 3640, 32768, 32768, 63195, 4096, 32768, 32768, 60074, 2730, 32768, 32768, 63195, 2730, 32768, 32768, 63608, 1489, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 16384, 60854, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 21065, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 80, 54613, 32768, 41, 60854, 32768, 32768, 32768, 10922, 32768, 32768, 16384, 49152, 13653, 14689, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 63351, 62259, 32768, 32768, 32768, 54613, 32768, 32768, 65015, 32768, 32768, 32768, 32768, 32768, 54613, 32768, 32768, 61603, 32768, 32768, 32768, 1310, 32768, 32768, 64867, 64807, 32768, 32768, 64905, 63195, 32768, 32768, 64971, 65194, 32768, 32768, 65067, 64791, 32768, 32768, 64998, 64971, 32768, 32768, 64917, 64867, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 64893, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 63351, 63488, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 49152, 32768, 32768, 58982, 62879, 32768, 32768, 32768, 32768, 32768, 32768, 63351, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 65358, 13835, 32768, 32768, 65099, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 64599, 32768, 32768, 49152, 19660, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 655, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 46181, 45110, 39119, 2903, 16861, 2355, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 16384, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 55078, 58982, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 57344, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 5461, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 28356, 57344, 32768, 32768, 32768, 461, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 60074, 32768, 10426, 6553, 10922, 60074, 8382, 4468, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 65093, 32768, 30687, 65126, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 60074, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 65167, 32768, 64046, 32768, 324, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 58982, 32768, 32768, 32768, 32768, 32768, 60854, 65345, 49152, 32768, 16384, 32768, 32768, 32768, 54613, 32768, 32768, 32768, 32768, 32768, 62805, 3640, 32768, 54613, 32768, 49152, 45875, 10922, 32768, 32768, 64572, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 10922, 16384, 19660, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 49152, 1310, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 1638, 49152, 24576, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 58982, 32768, 32768, 32768, 32768, 64170, 6553, 668, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 65367, 32768, 1638, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 62557, 32768, 4681, 32768, 32768, 54613, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 574, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 4681, 138, 7447, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 35397, 10217, 19051, 55312, 35108, 48787, 35659, 40215, 21730, 37677, 39273, 46694, 32768, 32768, 32768, 32768, 31061, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 42130, 57344, 32768, 32768, 47786, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 64225, 57344, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 36972, 32768, 22528, 57344, 33236, 51057, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 2978, 32768, 46250, 32768, 6753, 61440, 39666, 9681, 4096, 8192, 258, 32768, 15915, 32768, 19534, 32768, 63015, 32768, 32768, 32768, 32768, 32768, 64980, 10922, 6553, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 62805, 32768, 20480, 32768, 8192, 42850, 504, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 65039, 63056, 32768, 32768, 50641, 32768, 32768, 32768, 61440, 32768, 32768, 32768, 57344, 32768, 58982, 32768, 32768, 32768, 32768, 32768, 45875, 36181, 32768, 32768, 32768, 32768, 49152, 32768, 62259, 32768, 32768, 32768, 64478, 57890, 32768, 32768, 52272, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 642, 32768, 51386, 32768, 60854, 32768, 62805, 32768, 35617, 32768, 35659, 49152, 32768, 32768, 32768, 49152, 65475, 32768, 64275, 42130, 63087, 60074, 65215, 49864, 50526, 32768, 44683, 47513, 59026, 32768, 64917, 49152, 39497, 32768, 64673, 47104, 65461, 32768, 63608, 39009, 38864, 32768, 61224, 45251, 45166, 32768, 10328, 38912, 63441, 32768, 56360, 43008, 64917, 32768, 57366, 63032, 47453, 5461, 39094, 32768, 64650, 32768, 46302, 32768, 65379, 32768, 49152, 32768, 29383, 60074, 59164, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 4096, 32768, 32768, 10502, 682, 32768, 32768, 63488, 38229, 54613, 64406, 19513, 38725, 18204, 32768, 60074, 8192, 32768, 32768, 58982, 6553, 32768, 32768, 49152, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 344, 40049, 32768, 2137, 11702, 32768, 728, 32768, 32768, 32768, 32768, 9102, 57344, 51492, 32768, 60074, 32768, 38229, 49152, 6553, 64170, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 148, 35888, 17039, 1794, 45166, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 65483, 1927, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 45875, 32768, 8623, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 45875, 32768, 32768, 32768, 32768, 32768, 32768, 64950, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 64791, 32768, 32768, 32768, 2184, 32768, 32768, 1846, 63715, 32768, 32768, 64225, 63975, 32768, 32768, 63897, 63195, 32768, 32768, 62557, 62805, 16384, 32768, 63608, 64365, 32768, 32768, 64046, 62259, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 62557, 62259, 32768, 22937, 32768, 32768, 32768, 32768, 49152, 49152, 16384, 32768, 32768, 60854, 32768, 6553, 32768, 62805, 32768, 32768, 49152, 54613, 32768, 32768, 32768, 57344, 32768, 32768, 32768, 52241, 32768, 32768, 15837, 60074, 32768, 49152, 32768, 61895, 32768, 32768, 51200, 59392, 16384, 32768, 32768, 65191, 30508, 62557, 65046, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 61440, 32768, 32768, 32768, 100, 32768, 32768, 1578, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 60074, 32768, 54613, 32768, 32768, 32768, 49152, 5461, 33717, 6702, 13653, 292, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 58982, 49152, 41506, 8192, 49152, 32768, 32768, 58982, 40049, 32768, 60074, 32768, 32768, 32768, 32768, 32768, 5213, 32768, 62949, 1489, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 65473, 22755, 910, 16384, 32768, 32768, 58982, 27726, 32768, 61440, 32768, 49152, 32768, 55296, 61440, 32768, 58982, 53415, 537, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 46386, 32768, 12118, 62557, 5851, 60280, 57828, 512, 32768, 32768, 61440, 62259, 46421, 32768, 4024, 32768, 49473, 32768, 13562, 24576, 6553, 64893, 41361, 30611, 368, 32768, 448, 32768, 23171, 32768, 37137, 32768, 32768, 32768, 6301, 32768, 8623, 47331, 62302, 3276, 49152, 32768, 32768, 58982, 45056, 32768, 58982, 32768, 64543, 32768, 18170, 60854, 2048, 64322, 1645, 537, 32768, 32768, 2978, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 8936, 61440, 57344, 60074, 49152, 4096, 32768, 32768, 32768, 58982, 49152, 32768, 60074, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 56971, 11490, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 57344, 49152, 57626, 4096, 49152, 32768, 32768, 58982, 49152, 32768, 49152, 32768, 49152, 32768, 42598, 32768, 32768, 32768, 21065, 3276, 45875, 32768, 6553, 32768, 32768, 32768, 65427, 32768, 32768, 32768, 64752, 4681, 57040, 49152, 59412, 60757, 19773, 32768, 26651, 58982, 61849, 32768, 33833, 32768, 43027, 32768, 65494, 32768, 32768, 64940, 49273, 8192, 64170, 32768, 15291, 32768, 40277, 32768, 56609, 32768, 58336, 32768, 32768, 32768, 54613, 49152, 15720, 5461, 51310, 32768, 65232, 58982, 30037, 32768, 61244, 32768, 32768, 32768, 20631, 57344, 32768, 63715, 11823, 133, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 54613, 54613, 21504, 364, 32768, 32768, 32768, 58982, 23405, 32768, 57344, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 41316, 47891, 54613, 65046, 11280, 564, 54613, 32768, 32768, 58982, 32768, 32768, 61440, 32768, 49152, 32768, 22420, 60074, 8192, 54613, 36623, 571, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 65421, 1560, 16826, 39410, 18824, 64111, 24365, 25746, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 57215, 3389, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 297, 54613, 32768, 4681, 61895, 32768, 5461, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 65365, 64709, 6553, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 60854, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 32768, 7399, 32768, 32768, 60854, 54613, 2978, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 42130, 32768, 18022, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 40960, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 8229, 32768, 34967, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 17164, 54613, 38229, 16384, 12758, 58942, 30868, 16384, 32768, 32768, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 47051, 32768, 32768, 32768, 712, 49152, 32768, 16384, 61713, 25320, 65255, 50014, 32768, 32768, 42528, 32768, 6369, 134, 13827, 64716, 32768, 32768, 1724, 32768, 297, 32768, 1880, 32768, 19084, 32768, 63488, 32768, 32768, 32768, 10922, 32768, 4681, 19660, 1260, 10922, 19456, 26664, 27726, 49152, 10922, 24576, 32768, 32768, 4681, 32768, 32768, 32768, 6553, 32768, 186, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 65121, 50837, 54613, 32768, 54613, 14043, 42130, 16384, 40960, 17597, 63195, 32768, 49152, 8192, 32768, 32768, 63351, 32768, 63015, 32768, 49152, 32768, 32768, 32768, 49152, 32768, 54613, 32768, 56912, 32768, 32768, 32768, 61440, 64225, 32768, 32768, 54613, 49152, 16384, 10922, 43008, 64478, 25389, 14336, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49890, 32768, 49152, 49152, 697, 32768, 62259, 49152, 65481, 32768, 32768, 16384, 63692, 32768, 56262, 54613, 55849, 32768, 60074, 38229, 49799, 49152, 35617, 32768, 19660, 32768, 53896, 32768, 65295, 32768, 32768, 32768, 6553, 32768, 62868, 32768, 64478, 32768, 64046, 32768, 30933, 32768, 26741, 32768, 32768, 32768, 53691, 6553, 21909, 10922, 65277, 18521, 64894, 57344, 45251, 32768, 52532, 32768, 44904, 32768, 47680, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 33366, 12732, 22475, 10922, 32768, 32768, 32768, 13948, 56912, 57344, 32768, 32768, 32768, 32768, 32768, 32768, 7399, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 40632, 65283, 22528, 27306, 32768, 32768, 6553, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 4096, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 53463, 35225, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 4681, 1129, 32768, 32768, 2520, 10426, 32768, 1170, 17749, 2048, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 49152, 32768, 22824, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 65298, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 55296, 32768, 16384, 24840, 42598, 54613, 38725, 57344, 57344, 32768, 32768, 63351, 54613, 32768, 32768, 64666, 23073, 32768, 32768, 32768, 61895, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 35617, 32768, 32768, 10922, 58982, 32768, 32768, 15671, 53908, 3640, 40960, 32768, 49152, 32768, 32768, 32768, 54613, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 54613, 32768, 32768, 32768, 3640, 32768, 32768, 2978, 7447, 10922, 1724, 60598, 62323, 18866, 60854, 32768, 62259, 32768, 32768, 32768, 62805, 32768, 32768, 63715, 16384, 32768, 32768, 414, 5461, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 49152, 32768, 32768, 54613, 2586, 48742, 32768, 32768, 49152, 32768, 32768, 32768, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 8192, 32768, 32768, 32768, 10922, 32768, 32768, 25057, 60854, 48587, 5461, 32768, 32768, 32768, 32768, 32768, 32768, 4786, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 2048, 32768, 63351, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 6602, 6553, 32768, 32768, 6301, 28912, 32768, 1170, 59990, 36278, 52932, 61334, 32768, 32768, 3276, 32768, 32768, 32768, 22937, 32768, 8192, 32768, 32768, 32768, 31, 32768, 32768, 32768, 8192, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 10922, 3640, 2978, 32768, 40112, 14968, 52170, 13405, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 151, 32768, 32768, 142, 4411, 32768, 16384, 40867, 25122, 16384, 55705, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 31439, 53997, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 63015, 32768, 32768, 32768, 63715, 32768, 63645, 32768, 59619, 32768, 60582, 2184, 19114, 32768, 30393, 32768, 42477, 32768, 49152, 32768, 58982, 32768, 32768, 32768, 32768, 32768, 60322, 28672, 22360, 36864, 65318, 32768, 54613, 32768, 31659, 8192, 49152, 16384, 65267, 6553, 53182, 1560, 33771, 7606, 2520, 60854, 32768, 32768, 32768, 32768, 8192, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 32768, 5461, 10922, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 16384, 32768, 32768, 64478, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 7399, 57344, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 3640, 32768, 32768, 27306, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 1310, 54613, 32768, 32768, 32768, 58982, 32768, 61895, 40960, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 606, 49152, 32768, 16384, 32768, 32768, 32768, 54613, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 61440, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 65105, 4681, 32768, 32768, 25618, 27989, 46669, 10922, 13662, 49563, 28648, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 43963, 23405, 9175, 16384, 29090, 65403, 32768, 58982, 52055, 36166, 21674, 1489, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 780, 32768, 32768, 32768, 14043, 42130, 30427, 4681, 32768, 32768, 32768, 64443, 38666, 42877, 63766, 885, 24576, 32768, 3276, 32768, 32768, 32768, 32768, 32768, 3276, 32768, 3276, 32768, 62259, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 20239, 3584, 21065, 2978, 32768, 32768, 32768, 64853, 5828, 38250, 59392, 2978, 32768, 32768, 32768, 32768, 32768, 32768, 1365, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 65067, 56891, 32768, 32768, 39789, 63015, 37809, 5461, 32768, 49152, 32768, 58982, 60441, 4720, 38229, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 6553, 32768, 32768, 4007, 39110, 35498, 5461, 60854, 32768, 32768, 61224, 54412, 57790, 37293, 819, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 64950, 32768, 32768, 32768, 65434, 32768, 9016, 728, 49152, 8192, 32768, 32768, 37740, 65300, 64145, 31857, 15108, 32768, 32768, 32768, 62952, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 65392, 32768, 32768, 32768, 32768, 32768, 18432, 3072, 57974, 32768, 61440, 32768, 32768, 64940, 58880, 58982, 21162, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 28912, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 53605, 19894, 63249, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 60854, 10922, 10922, 32768, 32768, 32768, 32768, 65183, 63195, 65194, 24764, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 58982, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 63351, 48188, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 42130, 6553, 32768, 32768, 32768, 32768, 32768, 32768, 64543, 36864, 14894, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 6702, 29407, 16384, 4681, 32768, 32768, 32768, 57344, 47180, 40067, 55109, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 5545, 54613, 32768, 49152, 32768, 32768, 4681, 61603, 30310, 65021, 1231, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 2184, 32768, 32768, 8705, 36596, 16384, 6950, 57344, 32768, 32768, 64929, 53878, 65072, 23906, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 9011, 49152, 32768, 32768, 32768, 32768, 32768, 49152, 64543, 55416, 22949, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 9830, 58569, 32768, 2520, 54613, 32768, 32768, 65342, 23545, 59753, 50940, 630, 32768, 32768, 32768, 32768, 3640, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 60074, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 58982, 32768, 61895, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 45386, 2520, 32768, 32768, 702, 40117, 32768, 4681, 32768, 49152, 32768, 63975, 55610, 39760, 52570, 240, 32768, 32768, 2048, 32768, 32768, 32768, 32768, 32768, 1560, 32768, 40960, 32768, 10169, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 2745, 28131, 32768, 2978, 32768, 32768, 32768, 65220, 52405, 15306, 58930, 3276, 32768, 32768, 32768, 32768, 10922, 32768, 2184, 32768, 32768, 32768, 5461, 32768, 32768, 32768, 32768, 32768, 32768, 1724, 57344, 32768, 1694, 7399, 32768, 10922, 32768, 32768, 32768, 63351, 21770, 22685, 38345, 992, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 364, 32768, 32768, 4826, 58394, 32768, 32768, 32768, 32768, 32768, 49152, 31278, 51187, 25653, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 65397, 32768, 32768, 32768, 65343, 32768, 64365, 32768, 32768, 32768, 32768, 32768, 20534, 10922, 38955, 1310, 27726, 32768, 65382, 32768, 65502, 32768, 32768, 32768, 32768, 32768, 57344, 32768, 32768, 32768, 10922, 32768, 58514, 32768, 6516, 4681, 49152, 32768, 35760, 52762, 13187, 3276, 32768, 32768, 32768, 63195, 49680, 4004, 5461, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 30427, 23405, 32768, 8192, 32768, 32768, 32768, 32768, 54613, 57344, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 58982, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 58982, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 57344, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 42850, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 14628, 32768, 32768, 32768, 2730, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 4681, 32768, 44470, 2520, 1560, 32768, 32768, 32768, 10922, 32768, 3640, 32768, 49152, 32768, 57344, 32768, 32768, 32768, 19757, 32768, 25661, 32768, 20631, 32768, 32768, 32768, 29257, 32768, 18118, 32768, 22176, 32768, 25031, 32768, 22554, 32768, 27443, 32768, 10922, 32768, 2978, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 65306, 52504, 25057, 32768, 25057, 32768, 25057, 32768, 25057, 32768, 25057, 32768, 39514, 32768, 32768, 32768, 49152, 32768, 10922, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 61895, 32768, 32768, 32768, 65450, 32768, 389, 32768, 32768, 32768, 32768, 47224, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 25941, 32768, 32768, 32768, 4681, 32768, 32768, 32768, 64225, 32768, 32768, 32768, 29272, 32768, 30553, 32768, 41350, 32768, 23015, 32768, 32768, 32768, 26119, 32768, 32768, 32768, 54613, 32768, 64893, 32768, 32768, 32768, 32768, 32768, 33860, 32768, 32768, 32768, 49152, 32768, 49152, 32768, 58343, 32768, 32768, 32768, 2184, 32768, 32768, 32768, 12503, 32768, 32768, 32768, 32768, 32768, 64599, 32768, 61440, 32768, 32768, 32768, 64880, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 60464, 36864, 31482, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 11702, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 16384, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 16384, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 32768, 32768, 32768, 54613, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 32768, 32768, 32768, 54613, 32768, 32768, 32768, 54613, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 58982, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 574, 32768, 32768, 32768, 32768, 32768, 32768, 63782, 1638, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 19069, 34588, 35565, 26093, 21164, 4867, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 1489, 32768, 32768, 32768, 32768, 32768, 1927, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 25486, 49152, 32768, 32768, 32768, 5461, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54196, 32768, 16384, 32768, 4681, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 5461, 32768, 32221, 32768, 1424, 32768, 32768, 32768, 32768, 5461, 1310, 32768, 32768, 32768, 2808, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 64452, 57344, 8192, 32768, 4096, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 60074, 32768, 2340, 32768, 32768, 32768, 11430, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 64572, 32768, 34406, 62259, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 65387, 32768, 276, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 58982, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 65287, 32768, 60854, 32768, 7021, 32768, 49152, 32768, 54613, 32768, 32768, 32768, 62259, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 62259, 61895, 32768, 32768, 32768, 32768, 60854, 32768, 62805, 32768, 59392, 32768, 57344, 32768, 65311, 32768, 32768, 49152, 61895, 32768, 36548, 32768, 65191, 32768, 32768, 32768, 32768, 32768, 61440, 32768, 65435, 32768, 94, 32768, 32768, 32768, 23405, 4681, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 48106, 32768, 32768, 32768, 32768, 32768, 32768, 65472, 47104, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 5173, 32768, 32768, 32768, 32768, 32768, 32768, 63715, 16384, 32768, 58982, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 63488, 32768, 32768, 32768, 32768, 32768, 32768, 57344, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 2978, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 2445, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 1057, 32768, 32768, 32768, 32768, 32768, 32768, 64917, 25486, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 1310, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 58982, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 42130, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 50688, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 37340, 32768, 32768, 32768, 32768, 49152, 32768, 16384, 30037, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 61895, 32768, 32768, 32768, 32768, 63488, 32768, 8192, 54613, 32768, 32768, 32768, 32768, 32768, 32768, 65365, 697, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 2184, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 48628, 1489, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 18299, 5020, 32768, 10922, 18853, 64716, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 57344, 32768, 51724, 7021, 57344, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 60074, 32768, 27351, 2730, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 6553, 32768, 55366, 32768, 32768, 32768, 64046, 5497, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 49152, 32768, 10922, 32768, 39095, 6144, 32768, 6553, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 58982, 54613, 61440, 4587, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 65510, 35643, 32768, 32768, 7801, 16384, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 51856, 17164, 32768, 6553, 32768, 32768, 32768, 32768, 61440, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 17164, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 45875, 32768, 41441, 64365, 26046, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 65298, 32768, 32768, 32768, 58514, 49152, 22658, 52932, 8192, 32768, 2184, 32768, 39110, 32768, 61440, 32768, 32768, 32768, 62557, 32768, 42130, 32768, 13785, 19114, 32768, 32768, 54613, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 61440, 32768, 42325, 57734, 26590, 23945, 49152, 32768, 58982, 32768, 5173, 32768, 2520, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 65283, 555, 49152, 32768, 57344, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 57344, 32768, 54613, 32768, 14043, 10601, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 2048, 2184, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 58982, 32768, 31804, 64365, 19494, 49473, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 39666, 14359, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 65384, 32768, 12011, 49152, 31386, 56599, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 61224, 461, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 15326, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 49152, 49152, 63975, 42643, 22420, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 20480, 54613, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 32768, 32768, 32768, 1057, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 6746, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 3640, 60074, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 54613, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 47331, 32768, 30037, 7123, 27747, 468, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 2520, 37, 32768, 17917, 344, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 18521, 49152, 32768, 64111, 45924, 5891, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 47833, 46421, 32768, 64853, 47275, 3261, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 48188, 32768, 41870, 32768, 49152, 58982, 20905, 24576, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 61440, 43144, 23265, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 61895, 32768, 16857, 10922, 32768, 65298, 43868, 204, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 48008, 32768, 32768, 64940, 2340, 936, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 22744, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 10922, 32768, 64838, 32904, 409, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 63351, 1927, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 42130, 32768, 32768, 32768, 12288, 2978, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 32768, 32347, 61067, 32768, 57344, 27257, 1489, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 8192, 49152, 32768, 60276, 33474, 246, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 61440, 32768, 23619, 57974, 8192, 63897, 14984, 98, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 2978, 32768, 32768, 32768, 43570, 167, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 12072, 54613, 10922, 65342, 6020, 8858, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 6553, 3640, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 63015, 32768, 13474, 60854, 49152, 63975, 19641, 33509, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 53739, 54613, 32768, 65217, 21391, 1621, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 63608, 32768, 8125, 54613, 32768, 63351, 35813, 26466, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 65171, 32768, 4352, 32768, 32768, 49152, 61738, 70, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 7000, 2520, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 60854, 32768, 23466, 62259, 8192, 63195, 48878, 312, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 30427, 57344, 32768, 32768, 38229, 8192, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 2978, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 43651, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 4681, 5461, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 2048, 32768, 32768, 32768, 32768, 32768, 65131, 56744, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 57344, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 32768, 60854, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 64773, 32768, 32768, 32768, 4877, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 25007, 25600, 20480, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 1927, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 430, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 555, 32768, 1424, 32768, 32768, 32768, 32768, 10922, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 64838, 32768, 32768, 32768, 1916, 32768, 16384, 32768, 65379, 32768, 32768, 32768, 9882, 54613, 32768, 32768, 32768, 32768, 32768, 32768, 27306, 32768, 32768, 32768, 63488, 32768, 32768, 32768, 19660, 32768, 32768, 32768, 62557, 32768, 32768, 32768, 65046, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 64478, 32768, 32768, 32768, 9132, 32768, 32768, 32768, 64170, 32768, 32768, 32768, 58982, 32768, 32768, 32768, 63975, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 65024, 32768, 32768, 32768, 64773, 32768, 32768, 32768, 64625, 32768, 32768, 32768, 61895, 32768, 32768, 32768, 54613, 32768, 32768, 32768, 12804, 32768, 32768, 49152, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 63351, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 5613, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 29939, 32768, 2985, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 6729, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 57247, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 3789, 58982, 32768, 32768, 32768, 32768, 32768, 32768, 40695, 32768, 32768, 32768, 32768, 32768, 50641, 32768, 668, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 8833, 32768, 32768, 32768, 8192, 32768, 32768, 32768, 7123, 32768, 32768, 32768, 32768, 32768, 2340, 32768, 862, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 4291, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 2019, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 2340, 32768, 32768, 32768, 2520, 32768, 32768, 32768, 48266, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 33792, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 31675, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 2006, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 28953, 32768, 32768, 32768, 32768, 32768, 151, 354, 1270, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 24576, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 5120, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 4870, 32768, 32768, 32768, 32768, 32768, 32768, 61440, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 1057, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 963, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 3640, 3640, 44683, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 32768, 29459, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 50467, 32768, 32768, 32768, 32768, 32768, 11419, 63975, 22404, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 1005, 32768, 32768, 32768, 32768, 32768, 32768, 61440, 35389, 32768, 32768, 32768, 32768, 32768, 23405, 65296, 16805, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 30811, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 390, 32768, 32768, 32768, 32768, 32768, 54613, 64838, 16812, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 33860, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 23405, 32768, 347, 32768, 32768, 32768, 32768, 32768, 32768, 65067, 8522, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 11742, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49768, 32768, 32768, 32768, 32768, 32768, 32768, 64499, 18040, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 40960, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 7253, 32768, 32768, 32768, 32768, 32768, 1927, 65198, 37408, 32768, 32768, 32768, 32768, 2730, 292, 32768, 18345, 32768, 32768, 32768, 32768, 368, 256, 49152, 14652, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 6714, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 18144, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 18204, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 10922, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 16384, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 64650, 25836, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 54613, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 57344, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 49152, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 57344, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768}
 
 #endif // TEXT2_H_
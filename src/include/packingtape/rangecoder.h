@@ -0,0 +1,153 @@
+#ifndef RANGECODER_H_   /* Include guard */
+#define RANGECODER_H_
+
+#include <stdint.h>
+
+#include "bytebuffer.h"
+
+// A range coder with a 64 bit low and a 32 bit range, for FRAME_RANGED frames. Unlike encodeRaw it never loses
+// precision to a range that straddles a byte boundary: a carry out of low ripples into the words already held back,
+// and the range is kept at 16 bits or more, so it renormalizes a whole 16 bit word at a time, at most once a bit.
+// Words go out big endian
+#define RC_TOP (1u << 16)
+
+// Predictions are the probability of a 1 in 1 << PREDICTION_BITS, for this coder and encodeRaw alike. A 16 bit range
+// still has room for the smallest of them
+#define PREDICTION_BITS 16
+#define EVEN_PREDICTION (1 << (PREDICTION_BITS - 1))
+
+typedef struct RangeEncoder {
+  uint64_t low; // Bit 32 is the carry
+  uint32_t range;
+  uint32_t cache; // The last word shifted out of low, held back in case a carry reaches it
+  uint64_t pending; // The cache and the 0xffff words after it, none before the first word
+} RangeEncoder;
+
+typedef struct RangeDecoder {
+  uint32_t code; // The archive's value less low, which the decoder does not need to keep
+  uint32_t range;
+} RangeDecoder;
+
+static inline void RC_NewEncoder (RangeEncoder * rc) {
+  *rc = (RangeEncoder) {
+    .range = 0xffffffff,
+  };
+}
+
+static inline void RC_PutWord (ByteBuffer * archive, uint32_t word) {
+  BB_PutByte(archive, word >> 8);
+  BB_PutByte(archive, word);
+}
+
+// Moves the top word of low out. It stays pending for as long as a carry could still change it. The first word never
+// takes a carry, the coded value always stays below 1
+static inline void RC_ShiftLow (RangeEncoder * rc, ByteBuffer * archive) {
+  if ((uint32_t)rc->low < 0xffff0000u || (rc->low >> 32) != 0 || rc->pending == 0) {
+    uint32_t carry = rc->low >> 32;
+    if (rc->pending > 0) {
+      RC_PutWord(archive, rc->cache + carry);
+      for (; rc->pending > 1; rc->pending--) {
+        RC_PutWord(archive, 0xffff + carry);
+      }
+      rc->pending = 0;
+    }
+    rc->cache = (rc->low >> 16) & 0xffff;
+  }
+  rc->pending++;
+  rc->low = (rc->low & 0xffff) << 16;
+}
+
+// Models may predict 0, which would leave a 1 no range at all
+static inline uint32_t RC_Bound (uint32_t range, int prediction) {
+  return ((uint64_t)range * (prediction > 0 ? prediction : 1)) >> PREDICTION_BITS;
+}
+
+static inline void RC_Encode (RangeEncoder * rc, int y, int prediction, ByteBuffer * archive) {
+  uint32_t bound = RC_Bound(rc->range, prediction);
+  if (y) {
+    rc->range = bound;
+  } else {
+    rc->low += bound;
+    rc->range -= bound;
+  }
+  if (rc->range < RC_TOP) {
+    RC_ShiftLow(rc, archive);
+    rc->range <<= 16;
+  }
+}
+
+// Where the slots of a symbol start in the range, of the 1 << PREDICTION_BITS there are
+static inline uint32_t RC_SymbolBound (uint32_t range, uint32_t start) {
+  return ((uint64_t)range * start) >> PREDICTION_BITS;
+}
+
+// Codes one of 256 symbols in a single step. starts has where the slots of each start, every symbol has one at least
+// and the last runs up to the end. A slot is worth 1 at the smallest range, so every symbol keeps some of it
+static inline void RC_EncodeSymbol (RangeEncoder * rc, const uint16_t * starts, int symbol, ByteBuffer * archive) {
+  uint32_t low = RC_SymbolBound(rc->range, starts[symbol]);
+  uint32_t high = symbol < 255 ? RC_SymbolBound(rc->range, starts[symbol + 1]) : rc->range;
+  rc->low += low;
+  rc->range = high - low;
+  if (rc->range < RC_TOP) {
+    RC_ShiftLow(rc, archive);
+    rc->range <<= 16;
+  }
+}
+
+// Writes out all 32 bits of low and starts the coder over. The decoder reads exactly up to the end of them
+static inline void RC_Flush (RangeEncoder * rc, ByteBuffer * archive) {
+  for (int i = 0; i < 3; i++) {
+    RC_ShiftLow(rc, archive);
+  }
+  RC_NewEncoder(rc);
+}
+
+// Reads as 0 past the end of the archive
+static inline uint32_t RC_GetWord (ByteBuffer * archive) {
+  int high = BB_GetByte(archive);
+  int low = BB_GetByte(archive);
+  return (high == EOF ? 0 : high << 8) | (low == EOF ? 0 : low);
+}
+
+static inline void RC_StartDecoder (RangeDecoder * rc, ByteBuffer * archive) {
+  rc->range = 0xffffffff;
+  rc->code = RC_GetWord(archive) << 16;
+  rc->code |= RC_GetWord(archive);
+}
+
+static inline int RC_Decode (RangeDecoder * rc, int prediction, ByteBuffer * archive) {
+  uint32_t bound = RC_Bound(rc->range, prediction);
+  int y = rc->code < bound;
+  if (y) {
+    rc->range = bound;
+  } else {
+    rc->code -= bound;
+    rc->range -= bound;
+  }
+  if (rc->range < RC_TOP) {
+    rc->code = (rc->code << 16) | RC_GetWord(archive);
+    rc->range <<= 16;
+  }
+  return y;
+}
+
+// Mirrors RC_EncodeSymbol. Finds the last symbol that starts at or below code in 8 halving steps
+static inline int RC_DecodeSymbol (RangeDecoder * rc, const uint16_t * starts, ByteBuffer * archive) {
+  int symbol = 0;
+  for (int step = 128; step > 0; step >>= 1) {
+    if (RC_SymbolBound(rc->range, starts[symbol + step]) <= rc->code) {
+      symbol += step;
+    }
+  }
+  uint32_t low = RC_SymbolBound(rc->range, starts[symbol]);
+  uint32_t high = symbol < 255 ? RC_SymbolBound(rc->range, starts[symbol + 1]) : rc->range;
+  rc->code -= low;
+  rc->range = high - low;
+  if (rc->range < RC_TOP) {
+    rc->code = (rc->code << 16) | RC_GetWord(archive);
+    rc->range <<= 16;
+  }
+  return symbol;
+}
+
+#endif // RANGECODER_H_
@@ -0,0 +1,92 @@
+#ifndef RANS_H_   /* Include guard */
+#define RANS_H_
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "bytebuffer.h"
+#include "rangecoder.h"
+
+// Binary rANS for FRAME_RANS frames. The state is kept in [RANS_LOW, RANS_LOW << 16) and moves 16 bit words in and
+// out, at most one a bit. A 1 takes the first prediction of the 1 << PREDICTION_BITS slots, a 0 the rest. rANS codes
+// last in, first out, so the encoder collects the bits of a whole run with their predictions and codes them backwards
+// at the end. The decoder then reads the words in the order it needs them: the final state, big endian, and the words
+// the encoder shifted out, last first
+#define RANS_LOW (1u << 16)
+
+typedef struct RansEncoder {
+  uint32_t* bits; // Prediction << 1 | bit, in the order the decoder decodes them
+  size_t count;
+  size_t capacity;
+  uint16_t* words; // Shifted out, first to last
+  size_t wordCapacity;
+  size_t wordCount; // Of the run RANS_CodeRun coded
+  uint32_t state;
+} RansEncoder;
+
+static inline void RANS_Record (RansEncoder * rans, int y, int prediction) {
+  if (rans->count == rans->capacity) {
+    rans->capacity = rans->capacity * 2 + 1024;
+    rans->bits = realloc(rans->bits, rans->capacity * sizeof(uint32_t));
+  }
+  rans->bits[rans->count++] = (uint32_t)prediction << 1 | y;
+}
+
+// Codes the recorded bits. Returns the length of the run, which is the state and the words
+static inline size_t RANS_CodeRun (RansEncoder * rans) {
+  // Every bit shifts out at most one word
+  if (rans->wordCapacity < rans->count) {
+    rans->wordCapacity = rans->count;
+    rans->words = realloc(rans->words, rans->wordCapacity * sizeof(uint16_t));
+  }
+  uint32_t state = RANS_LOW;
+  size_t words = 0;
+  for (size_t i = rans->count; i-- > 0; ) {
+    uint32_t prediction = rans->bits[i] >> 1;
+    prediction = prediction > 0 ? prediction : 1;
+    uint32_t frequency = rans->bits[i] & 1 ? prediction : (1u << PREDICTION_BITS) - prediction;
+    uint32_t start = rans->bits[i] & 1 ? 0 : prediction;
+    if (state >= frequency << 16) {
+      rans->words[words++] = state;
+      state >>= 16;
+    }
+    state = ((state / frequency) << PREDICTION_BITS) + state % frequency + start;
+  }
+  rans->state = state;
+  rans->wordCount = words;
+  return 4 + 2 * words;
+}
+
+// Writes the run RANS_CodeRun coded: its 32 bit length, the state and the words. Then starts over
+static inline void RANS_WriteRun (RansEncoder * rans, ByteBuffer * archive) {
+  BB_PutUint32(archive, 4 + 2 * rans->wordCount);
+  RC_PutWord(archive, rans->state >> 16);
+  RC_PutWord(archive, rans->state);
+  for (size_t words = rans->wordCount; words-- > 0; ) {
+    RC_PutWord(archive, rans->words[words]);
+  }
+  rans->count = 0;
+}
+
+static inline void RANS_FreeEncoder (RansEncoder * rans) {
+  free(rans->bits);
+  free(rans->words);
+}
+
+// Decodes a bit and takes the next word from *next if the state needs it. There is no branch on the state: a word is
+// always read and only kept when it is needed, so there have to be 2 readable bytes after the last one
+static inline int RANS_Decode (uint32_t * state, const uint8_t ** next, int prediction) {
+  uint32_t p = prediction > 0 ? prediction : 1;
+  uint32_t slot = *state & ((1u << PREDICTION_BITS) - 1);
+  int y = slot < p;
+  uint32_t frequency = y ? p : (1u << PREDICTION_BITS) - p;
+  uint32_t start = y ? 0 : p;
+  uint32_t x = frequency * (*state >> PREDICTION_BITS) + slot - start;
+  uint32_t refill = x < RANS_LOW;
+  uint32_t word = (uint32_t)(*next)[0] << 8 | (*next)[1];
+  *state = x << (refill << 4) | (word & -refill);
+  *next += refill << 1;
+  return y;
+}
+
+#endif // RANS_H_
@@ -0,0 +1,61 @@
+#ifndef SEGMENTINDEX_H_   /* Include guard */
+#define SEGMENTINDEX_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "bytebuffer.h"
+#include "util.h"
+
+// An index frame lists points where decoding can start without decoding what comes before them, as offsets in the
+// archive and in the data it decodes to. Frames start at such points, so they can be decoded apart, and every
+// RESTART_INTERVAL bytes into a frame there is one more that carries the coder and predictor state.
+// The frame is "PKTI" and its 64 bit length, the point count, the points and one closing point for where the index
+// itself starts, then the length and "PKTI" again so it can be found from the end. Decoders that read front to back
+// skip it
+#define INDEX_MAGIC "PKTI"
+#define INDEX_FOOTER_LENGTH 12
+#define INDEX_POINT_LENGTH 30
+#define RESTART_INTERVAL (1 << 16)
+
+typedef struct RestartPoint {
+  uint64_t compressedOffset; // Of the frame header, or of the 4 coder bytes the decoder reads first
+  uint64_t offset;
+  int frameStart; // Starts a frame, the rest is only set for points inside frames
+
+  uint32_t x1;
+  uint32_t x2;
+  context ctx;
+  int switchPrediction;
+  int modelCode;
+} RestartPoint;
+
+typedef struct SegmentIndex {
+  uint64_t count;
+  uint64_t capacity;
+  RestartPoint * points; // count + 1, the last one is the start of the index frame and the size of all the data
+} SegmentIndex;
+
+void SI_New (SegmentIndex * index);
+
+void SI_AddFrame (SegmentIndex * index, uint64_t compressedOffset, uint64_t offset);
+
+// A point between two blocks of a frame, where compressedOffset is how much the coder has written
+void SI_AddRestart (SegmentIndex * index, uint64_t compressedOffset, uint64_t offset, Coder * coder, context ctx, int modelCode);
+
+// Appends the points of src, moved by the offsets of where its data ended up
+void SI_Merge (SegmentIndex * index, SegmentIndex * src, uint64_t compressedShift, uint64_t shift);
+
+// Closes the index at the end of the last frame and writes the index frame
+void SI_Write (SegmentIndex * index, ByteBuffer * archive, uint64_t compressedOffset, uint64_t offset);
+
+// Reads the index frame at the end of a len byte archive. Returns 0 if there is none, or it does not cover the whole
+// archive
+int SI_Read (SegmentIndex * index, const uint8_t * archive, size_t len);
+
+// The last point at or before offset
+uint64_t SI_Find (SegmentIndex * index, uint64_t offset);
+
+void SI_Free (SegmentIndex * index);
+
+#endif // SEGMENTINDEX_H_
@@ -0,0 +1,37 @@
+#ifndef SPSCRING_H_   /* Include guard */
+#define SPSCRING_H_
+
+#include <stddef.h>
+#include <stdatomic.h>
+
+// A ring of fixed size slots handed from exactly one producer thread to exactly one consumer thread without locks.
+// The producer fills the slot it claimed and publishes it, the consumer reads the slot it peeked at and releases it.
+// Either side yields its core while the ring is full or empty
+typedef struct SpscRing {
+  unsigned char * slots;
+  size_t slotSize;
+  size_t capacity;
+
+  // Kept on cache lines of their own, each is written by one side only
+  _Alignas(64) atomic_size_t head; // Next slot to consume
+  _Alignas(64) atomic_size_t tail; // Next slot to produce
+} SpscRing;
+
+// Returns 0 if the slots could not be allocated
+int SR_New (SpscRing * ring, size_t slotSize, size_t capacity);
+
+// The next slot to fill, waits for the consumer while the ring is full
+void * SR_Claim (SpscRing * ring);
+
+// Hands the claimed slot over to the consumer
+void SR_Publish (SpscRing * ring);
+
+// The next slot to read, waits for the producer while the ring is empty
+void * SR_Peek (SpscRing * ring);
+
+// Hands the slot from SR_Peek back to the producer
+void SR_Release (SpscRing * ring);
+
+void SR_Free (SpscRing * ring);
+
+#endif // SPSCRING_H_
@@ -0,0 +1,62 @@
+#ifndef THREADPOOL_H_   /* Include guard */
+#define THREADPOOL_H_
+
+#include <stddef.h>
+#include <pthread.h>
+
+typedef void (*TP_Job_t) (void * arg);
+
+typedef struct TP_Task {
+  TP_Job_t job;
+  void * arg;
+} TP_Task;
+
+// The jobs of one thread. It takes the newest from the back, other threads steal the oldest from the front
+typedef struct TP_Deque {
+  pthread_mutex_t lock;
+  TP_Task * tasks;
+  size_t head;
+  size_t count;
+  size_t capacity;
+} TP_Deque;
+
+typedef struct ThreadPool ThreadPool;
+
+typedef struct TP_Worker {
+  ThreadPool * pool;
+  int index;
+} TP_Worker;
+
+// A fixed set of threads, each with a deque of jobs. Jobs submitted by a job go to the deque of the thread running
+// it, others are dealt out in turn, and a thread that runs out of jobs steals from the others
+struct ThreadPool {
+  pthread_t * threads;
+  TP_Worker * workers;
+  TP_Deque * deques;
+  int threadCount;
+
+  pthread_mutex_t lock;
+  pthread_cond_t ready; // A job was queued or the pool is stopping
+  pthread_cond_t idle; // The last pending job finished
+  size_t queued; // Jobs in all the deques
+  size_t pending; // Queued and running jobs
+  int nextDeque; // Gets the next job from outside the pool
+  int stopping;
+};
+
+// Threads for a thread count of 0, one per online core
+int TP_DefaultThreads (void);
+
+// Returns 0 if not even one thread could be started
+int TP_New (ThreadPool * pool, int threadCount);
+
+// Can be called from a job, to split its work up
+void TP_Submit (ThreadPool * pool, TP_Job_t job, void * arg);
+
+// Blocks until every submitted job has finished. Not for jobs, which would wait on themselves
+void TP_Wait (ThreadPool * pool);
+
+// Finishes the queued jobs and stops the threads
+void TP_Free (ThreadPool * pool);
+
+#endif // THREADPOOL_H_
@@ -4,9 +4,131 @@
 #include <stdio.h>
 #include <stdint.h>
 
+#include "bytebuffer.h"
+#include "rangecoder.h"
+
 // 32 Bit Context
 typedef uint16_t context;
 
-void flush (uint32_t* x1, uint32_t* x2, FILE* archive);
+// Bytes coded between model switches. Compressor and decompressor have to agree on it
+#define CHANGE_INTERVAL 128
+
+// An archive is one or more frames and decodes to the concatenation of their data. A frame starts with FRAME_MAGIC,
+// a version, flags and the starting model code, followed by the 64 bit content size if FRAME_SIZED is set. After
+// the coded data comes FRAME_END_MAGIC and the 64 bit size of the data once more
+#define FRAME_MAGIC "PKTP"
+#define FRAME_END_MAGIC "PKTE"
+#define FRAME_VERSION 3 // Since blocks can be stored
+#define FRAME_SIZED 0x01
+#define FRAME_INTERLEAVED 0x02
+#define FRAME_RANGED 0x04
+#define FRAME_RANS 0x08
+#define FRAME_BYTES 0x10
+#define FRAME_LAYOUTS (FRAME_INTERLEAVED | FRAME_RANGED | FRAME_RANS | FRAME_BYTES)
+#define FRAME_KNOWN_FLAGS (FRAME_SIZED | FRAME_LAYOUTS)
+#define HEADER_LENGTH 15 // With the content size
+#define FRAME_END_LENGTH 12
+
+// Content size of frames written from pipes and streams. Their short blocks code their own length instead
+#define UNKNOWN_SIZE UINT64_MAX
+#define SHORT_PREDICTION 256
+#define BLOCK_LENGTH_BITS 7
+
+// How a block ends. Sync and last blocks are short and end the coder's interval, after a sync block the coder starts
+// over while the predictor carries on
+#define BLOCK_MORE 0
+#define BLOCK_LAST 1
+#define BLOCK_SYNC 2
+
+// Blocks that the models would code in more bits than storing them takes, as already compressed data does, are stored
+// instead. After its length every block codes whether it is stored, at STORED_PREDICTION. A stored block then flushes
+// the coder and has its bytes as they are, and the coder starts over after it. In a ranged or byte frame the flush cuts
+// the run short, and the run after the stored block goes on up to where that one would have ended. Interleaved and
+// rANS frames read a whole run before they decode it, so there the coders go on and the stored blocks of a run follow
+// it instead, in order
+#define STORED_PREDICTION 1024
+
+// In plain, ranged and byte frames a stored block also codes whether more stored blocks follow it before the flush,
+// and if so how many in STORED_RUN_BITS bits, and how the last of them ends if the blocks code their length. Those have
+// nothing coded of their own: their bytes come right after the first one's, they keep its model and all but the last
+// are whole. Such a run never crosses a multiple of CODER_RUN bytes of data, so restart points never fall inside one
+#define STORED_RUN_BITS 9
+
+// An interleaved frame spreads the bits of every byte over INTERLEAVE_WAYS coders, bit i of a byte going to coder
+// i % INTERLEAVE_WAYS, so the CPU can work on one coder while the next bit is predicted for another. Model switches
+// and block lengths go to the first coder. Every CODER_RUN bytes of data, and at the end of the frame, the
+// coders are flushed and written out as a run: the 32 bit length of each coder's bytes, then the bytes of each in
+// turn. Runs start on restart points with fresh coders
+#define INTERLEAVE_WAYS 4
+#define CODER_RUN (1 << 16)
+
+// A ranged frame codes everything with the coder of rangecoder.h instead, in the order a plain frame does. It is
+// flushed every CODER_RUN bytes of data and at the end of the frame, so restart points find it fresh. A rANS frame
+// codes the same way with rans.h, each run written out as its 32 bit length and the run itself. A byte frame is a
+// ranged frame that codes whole bytes with the byte model, a step each, and has no model switches. A frame has one
+// layout at most
+
+// A stored block takes at most this many bytes on top of its data: what its model code, length, stored bit and the bit
+// that says no run follows shift out of the coder, under 32 bits even at the least likely predictions, and the 4 bytes
+// of a flush. A run of stored blocks takes less than its blocks would on their own
+#define STORED_OVERHEAD 8
+
+// The most the coded bytes of a run of an interleaved or rANS frame take, flushes and final state included. A run that
+// would come out larger is coded again with every block stored, and then the blocks only take a few bytes of it each.
+// The runlimit test builds the library with a lower one, so runs of text take that path too
+#ifndef MAX_RUN
+#define MAX_RUN (CODER_RUN + CODER_RUN / CHANGE_INTERVAL * STORED_OVERHEAD + 4 * INTERLEAVE_WAYS)
+#endif
+
+// Model switches are rare, their prediction starts low and adapts as the blocks go by
+#define SWITCH_PREDICTION 8192
+#define SWITCH_RATE 4
+
+typedef struct FrameHeader {
+  int version;
+  int flags;
+  int startingCode;
+  uint64_t contentSize; // UNKNOWN_SIZE without FRAME_SIZED
+} FrameHeader;
+
+// Range coder state carried from one block to the next, so coding can stop and pick up again between blocks
+typedef struct Coder {
+  uint32_t x1;
+  uint32_t x2;
+  uint32_t x; // Decoder only, the 4 archive bytes it looks ahead
+  int restart; // Decoder only, x has to be read before the next block
+  int storedLeft; // Decoder only, stored blocks of the run still to come, with how the last one ends
+  int storedLength;
+  int storedEnd;
+  int switchPrediction;
+  uint64_t blockCount;
+} Coder;
+
+// Coder state of a frame. An interleaved frame has a coder per lane, each on its part of the run, which is read whole,
+// as a rANS frame's run is. coder then only keeps the switch prediction and the block count, as it does for a ranged
+// frame
+typedef struct FrameDecoder {
+  Coder coder;
+  int layout; // One of FRAME_LAYOUTS, or 0 for a plain frame
+  RangeDecoder range;
+  uint32_t ransState;
+  size_t ransNext; // Of the next word in run
+  size_t ransEnd;
+  uint32_t x1[INTERLEAVE_WAYS];
+  uint32_t x2[INTERLEAVE_WAYS];
+  uint32_t x[INTERLEAVE_WAYS];
+  ByteBuffer lanes[INTERLEAVE_WAYS];
+  uint8_t* run;
+  size_t runCapacity;
+  uint64_t runLeft; // Bytes of data before the next run, or before a ranged frame's coder starts over
+} FrameDecoder;
+
+void initCoder (Coder* coder);
+
+void flush (uint32_t* x1, uint32_t* x2, ByteBuffer* archive);
+
+int updateSwitchPrediction (int prediction, int switched);
+
+int modelCodeBits (int modelCount);
 
 #endif // UTIL_H_
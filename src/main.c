@@ -1,49 +1,212 @@
 #include <stdlib.h>
+#include <string.h>
 #include <time.h>
+#include <unistd.h>
+#include <sys/stat.h>
 
+#include "packingtape/batch.h"
 #include "packingtape/compressor.h"
 #include "packingtape/compressorpredictor.h"
 #include "packingtape/decompressor.h"
 #include "packingtape/decompressorpredictor.h"
 #include "packingtape/modelenum.h"
+#include "packingtape/threadpool.h"
 
 int main (int argc, char ** argv) {
-  clock_t start, end;
-  double cpu_time_used;
+  // Wall clock time, CPU time adds up over the threads
+  struct timespec start, end;
+  double time_used;
 
-  start = clock();
+  clock_gettime(CLOCK_MONOTONIC, &start);
 
-  // Chech arguments: packingtape c/d input output
-  if (argc!=4 || (argv[1][0]!='c' && argv[1][0]!='d')) {
-    printf("To compress:   packingtape c input output\n"
-        "To decompress: packingtape d input output\n");
+  // Chech arguments: packingtape [-T threads | -P | -M | -I | -R | -A | -B] c/d input output, packingtape [-T threads] c/d -r dir,
+  // packingtape x archive offset length, packingtape s input offset length shard, or packingtape merge output shard...
+  int threads = 0;
+  int pipelined = 0;
+  int trial = 0;
+  int interleaved = 0;
+  int ranged = 0;
+  int rans = 0;
+  int bytes = 0;
+  int recursive = 0;
+  int opt;
+  while ((opt = getopt(argc, argv, "T:PMIRABr")) != -1) {
+    char *end;
+    if (opt == 'P') {
+      pipelined = 1;
+    } else if (opt == 'M') {
+      trial = 1;
+    } else if (opt == 'I') {
+      interleaved = 1;
+    } else if (opt == 'R') {
+      ranged = 1;
+    } else if (opt == 'A') {
+      rans = 1;
+    } else if (opt == 'B') {
+      bytes = 1;
+    } else if (opt == 'r') {
+      recursive = 1;
+    } else if (opt == 'T' && (threads = strtol(optarg, &end, 10)) >= 0 && *end == '\0') {
+      if (threads == 0) threads = TP_DefaultThreads();
+    } else {
+      threads = -1;
+    }
+  }
+  // One file takes one thread unless told otherwise, a tree of them a thread per core
+  if (threads == 0) threads = recursive ? TP_DefaultThreads() : 1;
+  argc -= optind - 1;
+  argv += optind - 1;
+  int range = argc == 5 && strcmp(argv[1], "x") == 0;
+  int shard = argc == 6 && strcmp(argv[1], "s") == 0;
+  int merge = argc >= 4 && strcmp(argv[1], "merge") == 0;
+  uint64_t offset = 0, length = 0;
+  if (range || shard) {
+    char *offsetEnd, *lengthEnd;
+    offset = strtoull(argv[3], &offsetEnd, 10);
+    length = strtoull(argv[4], &lengthEnd, 10);
+    int numbers = *argv[3] != '\0' && *offsetEnd == '\0' && *argv[4] != '\0' && *lengthEnd == '\0';
+    range = range && numbers;
+    shard = shard && numbers;
+  }
+  // The ways to compress go one at a time, on a single file, and only -M spreads over threads
+  int modes = pipelined + trial + interleaved + ranged + rans + bytes;
+  int conflicting = modes > 1 || (modes > 0 && (recursive || range || shard || merge || argc < 2 || argv[1][0] != 'c' ||
+      (!trial && threads > 1)));
+  if ((!range && !shard && !merge && (argc!=(recursive ? 3 : 4) || (argv[1][0]!='c' && argv[1][0]!='d'))) ||
+      threads < 1 || conflicting) {
+    printf("To compress:   packingtape [-T threads] [-P | -M | -I | -R | -A | -B] c input output\n"
+        "To decompress: packingtape [-T threads] d input output\n"
+        "To decompress length bytes from offset on: packingtape x archive offset length\n"
+        "To compress or decompress every file in a tree: packingtape [-T threads] c/d -r dir\n"
+        "To compress length bytes from offset on as a shard: packingtape s input offset length shard\n"
+        "To join shards into one archive: packingtape merge output shard...\n"
+        "Use - as input or output for stdin or stdout, and -T 0 for a thread per core\n"
+        "-P predicts and codes on two threads, the archive stays the same\n"
+        "-M codes every block with each model on the -T threads and keeps the smallest\n"
+        "-I interleaves the bits over several coders, for faster decoding by this version or later\n"
+        "-R codes with a wider range coder, for smaller archives this version or later decodes\n"
+        "-A codes with rANS, for archives this version or later decodes faster still\n"
+        "-B codes a byte at a time with a simpler model, several times faster both ways\n"
+        "Only one of -P, -M, -I, -R, -A and -B at a time, and of them only -M with more than one thread\n"
+        "-r writes file" ARCHIVE_SUFFIX " next to every file, or file next to every file" ARCHIVE_SUFFIX "\n");
     exit(1);
   }
 
+  if (range) {
+    FILE *input=fopen(argv[2], "rb");
+    if (!input) perror(argv[2]), exit(1);
+    DecompressorPredictor* p = malloc(sizeof(*p));
+    *p = (DecompressorPredictor) {};
+    ModelArray_t mos = malloc(sizeof(*mos));
+    S_MO_EnumerateAllModels(mos);
+    DP_New(p, mos, NUM_MODELS, 0);
+    return !decompressRange(input, stdout, offset, length, p);
+  }
+
+  if (shard) {
+    FILE *input=fopen(argv[2], "rb");
+    if (!input) perror(argv[2]), exit(1);
+    FILE *output=strcmp(argv[5], "-") == 0 ? stdout : fopen(argv[5], "wb");
+    if (!output) perror(argv[5]), exit(1);
+    CompressorPredictor* p = malloc(sizeof(*p));
+    *p = (CompressorPredictor) {};
+    ModelArray_t mos = malloc(sizeof(*mos));
+    S_MO_EnumerateAllModels(mos);
+    CP_New(p, mos, NUM_MODELS, 0);
+    CP_SelectModel(p, TEXT1);
+    return !compressShard(input, output, offset, length, p);
+  }
+
+  if (merge) {
+    FILE *output=strcmp(argv[2], "-") == 0 ? stdout : fopen(argv[2], "wb");
+    if (!output) perror(argv[2]), exit(1);
+    int ok = mergeShards((const char**)argv + 3, argc - 3, output);
+    return fclose(output) != 0 || !ok;
+  }
+
+  if (recursive) {
+    int failures;
+    ModelArray_t mos = malloc(sizeof(*mos));
+    S_MO_EnumerateAllModels(mos);
+    if (argv[1][0] == 'c') {
+      CompressorPredictor* p = malloc(sizeof(*p));
+      *p = (CompressorPredictor) {};
+      CP_New(p, mos, NUM_MODELS, 0);
+      CP_SelectModel(p, TEXT1);
+      failures = compressTree(argv[2], p, threads);
+    } else {
+      DecompressorPredictor* p = malloc(sizeof(*p));
+      *p = (DecompressorPredictor) {};
+      DP_New(p, mos, NUM_MODELS, 0);
+      failures = decompressTree(argv[2], p, threads);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    time_used = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+    fprintf(stderr, "Time %f seconds\n", time_used);
+    return failures > 0;
+  }
+
   // Open files
-  FILE *input=fopen(argv[2], "rb");
+  FILE *input=strcmp(argv[2], "-") == 0 ? stdin : fopen(argv[2], "rb");
   if (!input) perror(argv[2]), exit(1);
-  FILE *output=fopen(argv[3], "w+b");
+  FILE *output=strcmp(argv[3], "-") == 0 ? stdout : fopen(argv[3], "w+b");
   if (!output) perror(argv[3]), exit(1);
 
+  // Regular files go through memory maps, anything else is streamed in one pass
+  struct stat inputStat, outputStat;
+  int mapped = fstat(fileno(input), &inputStat) == 0 && S_ISREG(inputStat.st_mode) &&
+    fstat(fileno(output), &outputStat) == 0 && S_ISREG(outputStat.st_mode);
+
+  int ok = 1;
   if (argv[1][0] == 'c') {
     CompressorPredictor* p = malloc(sizeof(*p));
     *p = (CompressorPredictor) {};
-    ModelArray_t mos = malloc(sizeof(mos));
+    ModelArray_t mos = malloc(sizeof(*mos));
     S_MO_EnumerateAllModels(mos);
     CP_New(p, mos, NUM_MODELS, 0);
     CP_SelectModel(p, TEXT1); // Can pick intelligently
-    compress(input, output, p);
+    if (interleaved) {
+      ok = compressInterleaved(input, output, p);
+    } else if (ranged) {
+      ok = compressRanged(input, output, p);
+    } else if (rans) {
+      ok = compressRans(input, output, p);
+    } else if (bytes) {
+      ok = compressBytes(input, output, p);
+    } else if (trial) {
+      ok = compressTrial(input, output, p, threads);
+    } else if (pipelined) {
+      ok = compressPipelined(input, output, p);
+    } else if (threads > 1) {
+      ok = compressParallel(input, output, p, threads);
+    } else if (mapped) {
+      ok = compressMapped(input, output, p);
+    } else {
+      ok = compress(input, output, p);
+    }
   } else if (argv[1][0] == 'd') {
     DecompressorPredictor* p = malloc(sizeof(*p));
     *p = (DecompressorPredictor) {};
-    ModelArray_t mos = malloc(sizeof(mos));
+    ModelArray_t mos = malloc(sizeof(*mos));
     S_MO_EnumerateAllModels(mos);
     DP_New(p, mos, NUM_MODELS, 0);
-    decompress(input, output, p);
+    if (mapped && threads > 1) {
+      ok = decompressParallel(input, output, p, threads);
+    } else if (mapped) {
+      ok = decompressMapped(input, output, p);
+    } else {
+      ok = decompress(input, output, p);
+    }
   }
 
-  end = clock();
-  cpu_time_used = ((double) (end - start)) / CLOCKS_PER_SEC;
-  printf("Time %f seconds\n", cpu_time_used);
+  // Both files are closed by now, their sizes are read back from the paths
+  if (ok && argv[1][0] == 'c' && mapped && stat(argv[2], &inputStat) == 0 && stat(argv[3], &outputStat) == 0 &&
+      inputStat.st_size > 0) {
+    fprintf(stderr, "Compression level: %f%%\n",
+        ((float)inputStat.st_size - (float)outputStat.st_size) / inputStat.st_size * 100);
+  }
+  clock_gettime(CLOCK_MONOTONIC, &end);
+  time_used = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+  fprintf(stderr, "Time %f seconds\n", time_used);
+  return !ok;
 }
@@ -1,6 +1,12 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <stdatomic.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 #include "util.h"
 #include "model.h"
@@ -16,45 +22,199 @@
   (byte & 0x02 ? '1' : '0'), \
   (byte & 0x01 ? '1' : '0')
 
-int main (int argc, char ** argv) {
-  ModelData_t contextCount = {0};
-  ModelData_t oneCount = {0};
-  ModelData_t predictions = {0};
+// Bytes of input one thread counts at a time
+#define CHUNK_SIZE (1 << 24)
 
-  context context = 0;
+// Gigabytes of training data overflow an int, so the counts are 64 bit. A byte model counts every byte after the byte
+// before it, in byteCount[before << 8 | byte]
+typedef struct Counts {
+  uint64_t contextCount[NUM_CONTEXTS];
+  uint64_t oneCount[NUM_CONTEXTS];
+  uint64_t byteCount[NUM_CONTEXTS];
+} Counts;
 
-  if (argc != 3) {
-    printf("Usage: {NAME} {INPUT_FILE}\n");
-    exit(1);
-  }
+typedef struct Chunk {
+  const uint8_t * data; // Of the whole file
+  size_t start;
+  size_t end;
+} Chunk;
 
-  // Open files
-  FILE *input = fopen(argv[2], "rb");
-  if (!input) perror(argv[2]), exit(1);
+typedef struct Trainer {
+  Chunk * chunks;
+  size_t chunkCount;
+  atomic_size_t next;
+  int bytes; // Train a byte model rather than a bit model
+} Trainer;
 
-  int c;
+typedef struct Worker {
+  pthread_t thread;
+  Trainer * trainer;
+  Counts counts;
+} Worker;
 
-  for (int i=0; i<sizeof(context); ++i) {
-    int c=getc(input);
-    if (c==EOF) c=0;
-    context=(context<<8)+(c&0xff);
+// The context is the last 16 bits, so a chunk starts from the two bytes before it. The first two bytes of a file
+// only make up its first context
+static void countChunk (Counts * counts, const Chunk * chunk) {
+  context context = 0;
+  for (size_t i = chunk->start - sizeof(context); i < chunk->start; i++) {
+    context = (context << 8) + chunk->data[i];
   }
-  while ((c=getc(input))!=EOF) {
+  for (size_t j = chunk->start; j < chunk->end; j++) {
+    int c = chunk->data[j];
     for (int i = 7; i >= 0; i--) {
       int nextBit = (c >> i) & 1;
-      contextCount[context] = contextCount[context] + 1;
-      if (nextBit == 1) {
-        oneCount[context] = oneCount[context] + 1;
-      }
+      counts->contextCount[context]++;
+      counts->oneCount[context] += nextBit;
 
       context = (context << 1) | nextBit;
     }
   }
-  for (int i = 0; i < NUM_CONTEXTS; i++) {
-    if (contextCount[i] != 0) {
-      predictions[i] = (MODEL_LIMIT * oneCount[i]) / contextCount[i];
+}
+
+static void countChunkBytes (Counts * counts, const Chunk * chunk) {
+  int before = chunk->data[chunk->start - 1];
+  for (size_t j = chunk->start; j < chunk->end; j++) {
+    counts->byteCount[before << 8 | chunk->data[j]]++;
+    before = chunk->data[j];
+  }
+}
+
+static void * work (void * arg) {
+  Worker * worker = arg;
+  Trainer * trainer = worker->trainer;
+  size_t i;
+  while ((i = atomic_fetch_add(&trainer->next, 1)) < trainer->chunkCount) {
+    if (trainer->bytes) {
+      countChunkBytes(&worker->counts, &trainer->chunks[i]);
+    } else {
+      countChunk(&worker->counts, &trainer->chunks[i]);
+    }
+  }
+  return NULL;
+}
+
+// Every byte gets a slot, and the rest of the 1 << PREDICTION_BITS go by the counts. What rounding leaves over goes
+// to the most common byte. Writes where each byte's slots start, the way RC_EncodeSymbol takes them
+static void byteStarts (const uint64_t * counts, uint16_t * starts) {
+  const uint64_t spare = (1 << PREDICTION_BITS) - 256;
+  uint64_t total = 0;
+  int common = 0;
+  for (int c = 0; c < 256; c++) {
+    total += counts[c];
+    if (counts[c] > counts[common]) common = c;
+  }
+  uint64_t slots[256];
+  uint64_t used = 0;
+  for (int c = 0; c < 256; c++) {
+    slots[c] = 1 + (total > 0 ? spare * counts[c] / total : spare / 256);
+    used += slots[c];
+  }
+  slots[common] += (1 << PREDICTION_BITS) - used;
+  uint64_t start = 0;
+  for (int c = 0; c < 256; c++) {
+    starts[c] = start;
+    start += slots[c];
+  }
+}
+
+// Maps the file and cuts it into chunks. Files of no more than the first context have nothing to count
+static void addFile (Trainer * trainer, const char * path) {
+  int fd = open(path, O_RDONLY);
+  struct stat st;
+  if (fd < 0 || fstat(fd, &st) != 0) perror(path), exit(1);
+  size_t size = st.st_size;
+  if (size <= sizeof(context)) {
+    close(fd);
+    return;
+  }
+  const uint8_t * data = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  if (data == MAP_FAILED) perror(path), exit(1);
+  madvise((void *)data, size, MADV_SEQUENTIAL);
+  close(fd);
+
+  for (size_t start = sizeof(context); start < size; start += CHUNK_SIZE) {
+    trainer->chunks = realloc(trainer->chunks, (trainer->chunkCount + 1) * sizeof(Chunk));
+    trainer->chunks[trainer->chunkCount++] = (Chunk) {
+      .data = data,
+      .start = start,
+      .end = size - start < CHUNK_SIZE ? size : start + CHUNK_SIZE,
+    };
+  }
+}
+
+int main (int argc, char ** argv) {
+  long threads = sysconf(_SC_NPROCESSORS_ONLN);
+  int opt;
+  int bytes = 0;
+  while ((opt = getopt(argc, argv, "T:B")) != -1) {
+    char * end;
+    if (opt == 'B') {
+      bytes = 1;
+    } else if (opt != 'T' || (threads = strtol(optarg, &end, 10)) < 1 || *end != '\0') {
+      threads = 0;
+    }
+  }
+  argc -= optind - 1;
+  argv += optind - 1;
+
+  if (argc < 3 || threads < 1) {
+    printf("Usage: {NAME} [-T threads] [-B] {INPUT_FILE}...\n"
+        "-B trains a byte model, for byte frames\n");
+    exit(1);
+  }
+
+  Trainer trainer = {
+    .bytes = bytes,
+  };
+  for (int i = 2; i < argc; i++) {
+    addFile(&trainer, argv[i]);
+  }
+  atomic_init(&trainer.next, 0);
+
+  // Every thread counts into a table of its own, they are added up at the end
+  if (threads > trainer.chunkCount) threads = trainer.chunkCount > 0 ? trainer.chunkCount : 1;
+  Worker * workers = calloc(threads, sizeof(Worker));
+  for (int i = 0; i < threads; i++) {
+    workers[i].trainer = &trainer;
+  }
+  // The threads that did start take the chunks the others would have, and without any this one counts them all
+  int started = 0;
+  while (started < threads && pthread_create(&workers[started].thread, NULL, work, &workers[started]) == 0) {
+    started++;
+  }
+  if (started == 0) {
+    work(&workers[0]);
+  }
+  for (int i = 0; i < started; i++) {
+    pthread_join(workers[i].thread, NULL);
+  }
+
+  ModelData_t predictions = {0};
+  if (bytes) {
+    uint64_t * counts = calloc(NUM_CONTEXTS, sizeof(uint64_t));
+    for (int i = 0; i < NUM_CONTEXTS; i++) {
+      for (int t = 0; t < threads; t++) {
+        counts[i] += workers[t].counts.byteCount[i];
+      }
+    }
+    for (int before = 0; before < 256; before++) {
+      byteStarts(counts + (before << 8), predictions + (before << 8));
+    }
+    free(counts);
+  } else {
+    for (int i = 0; i < NUM_CONTEXTS; i++) {
+      uint64_t contextCount = 0;
+      uint64_t oneCount = 0;
+      for (int t = 0; t < threads; t++) {
+        contextCount += workers[t].counts.contextCount[i];
+        oneCount += workers[t].counts.oneCount[i];
+      }
+      // Half a one and half a zero more than were counted keep a bit the training data never had codable, and a
+      // context it never saw predicts an even bit
+      uint64_t prediction = ((2 * oneCount + 1) << (PREDICTION_BITS - 1)) / (contextCount + 1);
+      predictions[i] = prediction > 0 ? prediction : 1;
+      /*printf("%d %lu %lu %d\n", i, oneCount, contextCount, predictions[i]);*/
     }
-    /*printf("%d %d %d %d\n", i, oneCount[i], contextCount[i], predictions[i]);*/
   }
   for (int i = 0; i < NUM_CONTEXTS; i++) {
     printf("%d, ", predictions[i]);
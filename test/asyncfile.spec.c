@@ -0,0 +1,122 @@
+#include <stdio.h>
+#include <signal.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "acutest.h"
+#include "asyncfile.h"
+
+#define BLOCK 4096
+#define SIZE (BLOCK * 10 + 123)
+
+static uint8_t data[SIZE];
+
+// Writes data to a fresh file and reads it back through the ring or the thread
+static void roundTrip (int useUring) {
+  for (size_t i = 0; i < SIZE; i++) {
+    data[i] = i * 7 + i / 300;
+  }
+  char path[] = "/tmp/packingtape-test-XXXXXX";
+  int fd = mkstemp(path);
+
+  // Blocks of every size up to full ones
+  AsyncFile af;
+  TEST_CHECK(AF_Open(&af, fd, 0, 1, BLOCK, useUring));
+  TEST_CHECK(useUring || af.ring < 0);
+  uint8_t * block = af.blocks[af.current];
+  for (size_t written = 0, len = 1; written < SIZE; written += len, len = len * 3 % BLOCK + 1) {
+    len = len < SIZE - written ? len : SIZE - written;
+    memcpy(block, data + written, len);
+    block = AF_Write(&af, len);
+  }
+  TEST_CHECK(AF_Flush(&af));
+  AF_Close(&af);
+  TEST_CHECK(lseek(fd, 0, SEEK_END) == SIZE);
+
+  TEST_CHECK(AF_Open(&af, fd, 0, 0, BLOCK, useUring));
+  size_t read = 0;
+  size_t len;
+  int same = 1;
+  while ((block = AF_Read(&af, &len)), len > 0) {
+    same = same && read + len <= SIZE && memcmp(block, data + read, len) == 0;
+    read += len;
+  }
+  TEST_CHECK(same && read == SIZE);
+  AF_Read(&af, &len);
+  TEST_CHECK(len == 0);
+  TEST_CHECK_(af.idle >= 0, "Idle time %f", af.idle);
+  AF_Close(&af);
+
+  // A pipe has no offsets and always goes through the thread
+  char command[64];
+  snprintf(command, sizeof(command), "cat %s", path);
+  FILE * pipe = popen(command, "r");
+  TEST_CHECK(AF_Open(&af, fileno(pipe), -1, 0, BLOCK, useUring));
+  TEST_CHECK(af.ring < 0);
+  read = 0;
+  same = 1;
+  while ((block = AF_Read(&af, &len)), len > 0) {
+    same = same && read + len <= SIZE && memcmp(block, data + read, len) == 0;
+    read += len;
+  }
+  TEST_CHECK(same && read == SIZE);
+  AF_Close(&af);
+  pclose(pipe);
+
+  close(fd);
+  remove(path);
+}
+
+void test_ring (void) {
+  roundTrip(1);
+}
+
+void test_thread (void) {
+  roundTrip(0);
+}
+
+void test_write_fails (void) {
+  AsyncFile af;
+  int fds[2];
+  TEST_CHECK(pipe(fds) == 0);
+  close(fds[0]);
+  signal(SIGPIPE, SIG_IGN);
+  TEST_CHECK(AF_Open(&af, fds[1], -1, 1, BLOCK, 1));
+  AF_Write(&af, BLOCK);
+  TEST_CHECK(!AF_Flush(&af));
+  AF_Close(&af);
+  close(fds[1]);
+}
+
+// A directory cannot be read, which must not pass for the end of the file
+static void readFails (int useUring) {
+  int fd = open("/tmp", O_RDONLY | O_DIRECTORY);
+  AsyncFile af;
+  TEST_CHECK(AF_Open(&af, fd, 0, 0, BLOCK, useUring));
+  size_t len;
+  AF_Read(&af, &len);
+  TEST_CHECK(len == 0);
+  TEST_CHECK(af.failed);
+  TEST_CHECK_(af.error == EISDIR, "Error %d", af.error);
+  AF_Close(&af);
+  close(fd);
+}
+
+void test_ring_read_fails (void) {
+  readFails(1);
+}
+
+void test_thread_read_fails (void) {
+  readFails(0);
+}
+
+TEST_LIST = {
+    { "ring", test_ring },
+    { "thread", test_thread },
+    { "write_fails", test_write_fails },
+    { "ring_read_fails", test_ring_read_fails },
+    { "thread_read_fails", test_thread_read_fails },
+    { NULL, NULL }
+};
@@ -0,0 +1,130 @@
+#include <string.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#include "acutest.h"
+#include "batch.h"
+#include "compressor.h"
+#include "modelenum.h"
+
+static const char sample[] = "static int count (const char * s) {\n  int n = 0;\n  while (*s++) n++;\n  return n;\n}\n";
+
+static CompressorPredictor * newCompressorPredictor (void) {
+  CompressorPredictor * p = malloc(sizeof(*p));
+  *p = (CompressorPredictor) {0};
+  ModelArray_t mos = malloc(sizeof(*mos));
+  S_MO_EnumerateAllModels(mos);
+  CP_New(p, mos, NUM_MODELS, 0);
+  CP_SelectModel(p, TEXT1);
+  return p;
+}
+
+static DecompressorPredictor * newDecompressorPredictor (void) {
+  DecompressorPredictor * p = malloc(sizeof(*p));
+  *p = (DecompressorPredictor) {0};
+  ModelArray_t mos = malloc(sizeof(*mos));
+  S_MO_EnumerateAllModels(mos);
+  DP_New(p, mos, NUM_MODELS, 0);
+  return p;
+}
+
+static char * join (const char * dir, const char * name) {
+  char * path = malloc(strlen(dir) + strlen(name) + 2);
+  sprintf(path, "%s/%s", dir, name);
+  return path;
+}
+
+// Writes size bytes of the sample over and over to dir/name
+static void writeSample (const char * dir, const char * name, size_t size) {
+  char * path = join(dir, name);
+  FILE * f = fopen(path, "wb");
+  for (size_t i = 0; i < size; i++) {
+    putc(sample[i % (sizeof(sample) - 1)], f);
+  }
+  fclose(f);
+  free(path);
+}
+
+static int isSample (const char * dir, const char * name, size_t size) {
+  char * path = join(dir, name);
+  FILE * f = fopen(path, "rb");
+  free(path);
+  if (f == NULL) {
+    return 0;
+  }
+  size_t i = 0;
+  int c;
+  int same = 1;
+  while (same && (c = getc(f)) != EOF) {
+    same = c == sample[i++ % (sizeof(sample) - 1)];
+  }
+  fclose(f);
+  return same && i == size;
+}
+
+static int exists (const char * dir, const char * name) {
+  char * path = join(dir, name);
+  int found = access(path, F_OK) == 0;
+  free(path);
+  return found;
+}
+
+static void removeFile (const char * dir, const char * name) {
+  char * path = join(dir, name);
+  remove(path);
+  free(path);
+}
+
+void test_tree (void) {
+  char dir[] = "/tmp/packingtape-test-XXXXXX";
+  TEST_CHECK(mkdtemp(dir) != NULL);
+  char * sub = join(dir, "sub");
+  mkdir(sub, 0777);
+  const size_t large = 2 * SEGMENT_SIZE + 1000;
+  writeSample(dir, "small", 5000);
+  writeSample(dir, "empty", 0);
+  writeSample(sub, "large", large);
+
+  TEST_CHECK(compressTree(dir, newCompressorPredictor(), 3) == 0);
+  TEST_CHECK(exists(dir, "small" ARCHIVE_SUFFIX));
+  TEST_CHECK(exists(dir, "empty" ARCHIVE_SUFFIX));
+  TEST_CHECK(exists(sub, "large" ARCHIVE_SUFFIX));
+
+  // Archives are left alone the second time round
+  TEST_CHECK(compressTree(dir, newCompressorPredictor(), 2) == 0);
+  TEST_CHECK(!exists(dir, "small" ARCHIVE_SUFFIX ARCHIVE_SUFFIX));
+
+  removeFile(dir, "small");
+  removeFile(dir, "empty");
+  removeFile(sub, "large");
+  TEST_CHECK(decompressTree(dir, newDecompressorPredictor(), 3) == 0);
+  TEST_CHECK(isSample(dir, "small", 5000));
+  TEST_CHECK(isSample(dir, "empty", 0));
+  TEST_CHECK(isSample(sub, "large", large));
+
+  removeFile(dir, "small");
+  removeFile(dir, "empty");
+  removeFile(sub, "large");
+  removeFile(dir, "small" ARCHIVE_SUFFIX);
+  removeFile(dir, "empty" ARCHIVE_SUFFIX);
+  removeFile(sub, "large" ARCHIVE_SUFFIX);
+  rmdir(sub);
+  rmdir(dir);
+  free(sub);
+}
+
+void test_not_archive (void) {
+  char dir[] = "/tmp/packingtape-test-XXXXXX";
+  TEST_CHECK(mkdtemp(dir) != NULL);
+  writeSample(dir, "bogus" ARCHIVE_SUFFIX, 300);
+  TEST_CHECK(decompressTree(dir, newDecompressorPredictor(), 2) == 1);
+  removeFile(dir, "bogus" ARCHIVE_SUFFIX);
+  removeFile(dir, "bogus");
+  rmdir(dir);
+}
+
+TEST_LIST = {
+    { "tree", test_tree },
+    { "not_archive", test_not_archive },
+    { NULL, NULL }
+};
@@ -0,0 +1,103 @@
+#include <unistd.h>
+#include <signal.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
+
+#include "acutest.h"
+#include "bytebuffer.h"
+
+void test_write_read (void) {
+  FILE * f = tmpfile();
+  ByteBuffer w;
+  BB_NewWriter(&w, f);
+  // Spans several blocks so the buffer has to drain more than once
+  for (int i = 0; i < BB_BLOCK_SIZE * 3 + 7; i++) {
+    BB_PutByte(&w, i * 31);
+  }
+  TEST_CHECK(BB_Flush(&w));
+  BB_Free(&w);
+  TEST_CHECK(ftell(f) == BB_BLOCK_SIZE * 3 + 7);
+
+  rewind(f);
+  ByteBuffer r;
+  BB_NewReader(&r, f);
+  int ok = 1;
+  for (int i = 0; i < BB_BLOCK_SIZE * 3 + 7; i++) {
+    ok &= BB_GetByte(&r) == ((i * 31) & 0xff);
+  }
+  TEST_CHECK(ok);
+  TEST_CHECK(BB_GetByte(&r) == EOF);
+  BB_Free(&r);
+  fclose(f);
+}
+
+void test_empty (void) {
+  FILE * f = tmpfile();
+  ByteBuffer r;
+  BB_NewReader(&r, f);
+  TEST_CHECK(BB_GetByte(&r) == EOF);
+  BB_Free(&r);
+  fclose(f);
+}
+
+// A pipe has no size, it must not pass for an empty file
+void test_map_pipe (void) {
+  int fds[2];
+  TEST_CHECK(pipe(fds) == 0);
+  ByteBuffer r;
+  TEST_CHECK(!BB_NewMappedReader(&r, fds[0]));
+  close(fds[0]);
+  close(fds[1]);
+}
+
+static off_t fileSize (FILE * f) {
+  struct stat st;
+  return fstat(fileno(f), &st) == 0 ? st.st_size : -1;
+}
+
+// A small output only grows the file by what it was expected to take, not by a whole window
+void test_map_small (void) {
+  FILE * f = tmpfile();
+  ByteBuffer w;
+  TEST_CHECK(BB_NewMappedWriter(&w, fileno(f), 0, 100));
+  for (const char * c = "packingtape"; *c; c++) {
+    BB_PutByte(&w, *c);
+  }
+  TEST_CHECK(fileSize(f) < BB_MAP_WINDOW);
+  TEST_CHECK(BB_Flush(&w));
+  BB_Free(&w);
+  TEST_CHECK(fileSize(f) == 11);
+  fclose(f);
+}
+
+// When the file cannot grow for the next window, the writer has to fail instead of writing over the last one
+void test_map_full (void) {
+  struct rlimit limit;
+  TEST_CHECK(getrlimit(RLIMIT_FSIZE, &limit) == 0);
+  struct rlimit small = { .rlim_cur = 1 << 20, .rlim_max = limit.rlim_max };
+  signal(SIGXFSZ, SIG_IGN);
+  TEST_CHECK(setrlimit(RLIMIT_FSIZE, &small) == 0);
+
+  FILE * f = tmpfile();
+  ByteBuffer w;
+  TEST_CHECK(BB_NewMappedWriter(&w, fileno(f), 0, 4096));
+  for (int i = 0; i < 32 * BB_BLOCK_SIZE; i++) {
+    BB_PutByte(&w, 0);
+  }
+  TEST_CHECK(BB_Tell(&w) == 32 * BB_BLOCK_SIZE);
+  TEST_CHECK(!BB_Flush(&w));
+  BB_Free(&w);
+  fclose(f);
+
+  TEST_CHECK(setrlimit(RLIMIT_FSIZE, &limit) == 0);
+  signal(SIGXFSZ, SIG_DFL);
+}
+
+TEST_LIST = {
+    { "write_read", test_write_read },
+    { "empty", test_empty },
+    { "map_pipe", test_map_pipe },
+    { "map_small", test_map_small },
+    { "map_full", test_map_full },
+    { NULL, NULL }
+};
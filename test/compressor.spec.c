@@ -1,10 +1,779 @@
+#include <string.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+
 #include "acutest.h"
 #include "compressor.h"
+#include "decompressor.h"
+#include "decompressorstream.h"
+#include "modelenum.h"
+#include "segmentindex.h"
+
+static const char sample[] = "static int count (const char * s) {\n  int n = 0;\n  while (*s++) n++;\n  return n;\n}\n";
+
+// Writes the sample repeat times to a fresh temporary file and returns its path
+static char * samplePath (int repeat) {
+  char * path = strdup("/tmp/packingtape-test-XXXXXX");
+  FILE * f = fdopen(mkstemp(path), "wb");
+  for (int i = 0; i < repeat; i++) {
+    fputs(sample, f);
+  }
+  fclose(f);
+  return path;
+}
+
+static char * emptyPath (void) {
+  char * path = strdup("/tmp/packingtape-test-XXXXXX");
+  close(mkstemp(path));
+  return path;
+}
+
+static CompressorPredictor * newCompressorPredictor (void) {
+  CompressorPredictor * p = malloc(sizeof(*p));
+  *p = (CompressorPredictor) {0};
+  ModelArray_t mos = malloc(sizeof(*mos));
+  S_MO_EnumerateAllModels(mos);
+  CP_New(p, mos, NUM_MODELS, 0);
+  CP_SelectModel(p, TEXT1);
+  return p;
+}
+
+static DecompressorPredictor * newDecompressorPredictor (void) {
+  DecompressorPredictor * p = malloc(sizeof(*p));
+  *p = (DecompressorPredictor) {0};
+  ModelArray_t mos = malloc(sizeof(*mos));
+  S_MO_EnumerateAllModels(mos);
+  DP_New(p, mos, NUM_MODELS, 0);
+  return p;
+}
+
+static uint8_t * readAll (const char * path, size_t * len) {
+  FILE * f = fopen(path, "rb");
+  fseek(f, 0, SEEK_END);
+  *len = ftell(f);
+  rewind(f);
+  uint8_t * data = malloc(*len);
+  TEST_CHECK(fread(data, 1, *len, f) == *len);
+  fclose(f);
+  return data;
+}
+
+static int sameContents (const char * a, const char * b) {
+  FILE * fa = fopen(a, "rb");
+  FILE * fb = fopen(b, "rb");
+  int c;
+  int same = 0;
+  while ((c = getc(fa)) == getc(fb)) {
+    if (c == EOF) {
+      same = 1;
+      break;
+    }
+  }
+  fclose(fa);
+  fclose(fb);
+  return same;
+}
 
 void test_arguments (void) {
 }
 
+void test_mapped (void) {
+  char * input = samplePath(400);
+  char * archive = emptyPath();
+  char * mappedArchive = emptyPath();
+  char * restored = emptyPath();
+
+  TEST_CHECK(compress(fopen(input, "rb"), fopen(archive, "w+b"), newCompressorPredictor()));
+  TEST_CHECK(compressMapped(fopen(input, "rb"), fopen(mappedArchive, "w+b"), newCompressorPredictor()));
+  TEST_CHECK_(sameContents(archive, mappedArchive), "Mapped and streamed archives differ");
+
+  TEST_CHECK(decompressMapped(fopen(mappedArchive, "rb"), fopen(restored, "w+b"), newDecompressorPredictor()));
+  TEST_CHECK_(sameContents(input, restored), "Mapped round trip lost data");
+
+  remove(input);
+  remove(archive);
+  remove(mappedArchive);
+  remove(restored);
+}
+
+void test_stream (void) {
+  char * input = samplePath(2000);
+  char * archive = emptyPath();
+  char * restored = emptyPath();
+
+  // Pipes cannot seek, so this only works if both sides move strictly forward
+  char command[64];
+  snprintf(command, sizeof(command), "cat %s", input);
+  compress(popen(command, "r"), fopen(archive, "w+b"), newCompressorPredictor());
+  snprintf(command, sizeof(command), "cat %s", archive);
+  decompress(popen(command, "r"), fopen(restored, "w+b"), newDecompressorPredictor());
+  TEST_CHECK_(sameContents(input, restored), "Streamed round trip lost data");
+
+  remove(input);
+  remove(archive);
+  remove(restored);
+}
+
+// Every byte value, with a length that does not fill its last block
+void test_binary (void) {
+  char * input = emptyPath();
+  char * archive = emptyPath();
+  char * restored = emptyPath();
+  FILE * f = fopen(input, "wb");
+  for (int i = 0; i < 1000; i++) {
+    putc((i * 167) & 0xff, f);
+  }
+  fclose(f);
+
+  compressMapped(fopen(input, "rb"), fopen(archive, "w+b"), newCompressorPredictor());
+  decompress(fopen(archive, "rb"), fopen(restored, "w+b"), newDecompressorPredictor());
+  TEST_CHECK_(sameContents(input, restored), "Binary round trip lost data");
+
+  remove(input);
+  remove(archive);
+  remove(restored);
+}
+
+void test_buffer (void) {
+  size_t inputSize = 300 * (sizeof(sample) - 1);
+  uint8_t * input = malloc(inputSize);
+  for (size_t i = 0; i < inputSize; i++) {
+    input[i] = sample[i % (sizeof(sample) - 1)];
+  }
+  size_t capacity = compressBound(inputSize);
+  uint8_t * archive = malloc(capacity);
+  size_t archiveSize;
+  TEST_CHECK(compressBuffer(input, inputSize, archive, capacity, &archiveSize, newCompressorPredictor()));
+  TEST_CHECK(archiveSize < inputSize);
+  TEST_CHECK(decompressedSize(archive, archiveSize) == inputSize);
+
+  uint8_t * restored = malloc(inputSize);
+  size_t restoredSize;
+  TEST_CHECK(decompressBuffer(archive, archiveSize, restored, inputSize, &restoredSize, newDecompressorPredictor()));
+  TEST_CHECK(restoredSize == inputSize && memcmp(input, restored, inputSize) == 0);
+
+  // Too small on either side fails without writing past the end
+  size_t tooSmallSize;
+  TEST_CHECK(!compressBuffer(input, inputSize, archive, archiveSize - 1, &tooSmallSize, newCompressorPredictor()));
+  TEST_CHECK(tooSmallSize == archiveSize);
+  TEST_CHECK(!decompressBuffer(archive, archiveSize, restored, inputSize - 1, &tooSmallSize, newDecompressorPredictor()));
+
+  free(input);
+  free(archive);
+  free(restored);
+}
+
+// A sized frame from a file and an unsized one from a pipe, joined with cat
+void test_concatenated (void) {
+  char * first = samplePath(30);
+  char * second = samplePath(70);
+  char * firstArchive = emptyPath();
+  char * secondArchive = emptyPath();
+  char * joinedArchive = emptyPath();
+  char * joined = emptyPath();
+  char * restored = emptyPath();
+
+  compress(fopen(first, "rb"), fopen(firstArchive, "w+b"), newCompressorPredictor());
+  char command[256];
+  snprintf(command, sizeof(command), "cat %s", second);
+  compress(popen(command, "r"), fopen(secondArchive, "w+b"), newCompressorPredictor());
+  snprintf(command, sizeof(command), "cat %s %s > %s", firstArchive, secondArchive, joinedArchive);
+  TEST_CHECK(system(command) == 0);
+  snprintf(command, sizeof(command), "cat %s %s > %s", first, second, joined);
+  TEST_CHECK(system(command) == 0);
+
+  decompressMapped(fopen(joinedArchive, "rb"), fopen(restored, "w+b"), newDecompressorPredictor());
+  TEST_CHECK_(sameContents(joined, restored), "Concatenated frames lost data");
+
+  remove(first);
+  remove(second);
+  remove(firstArchive);
+  remove(secondArchive);
+  remove(joinedArchive);
+  remove(joined);
+  remove(restored);
+}
+
+// Noise the models cannot code in fewer bits than it has, between stretches of text, sized and from a pipe
+void test_stored (void) {
+  size_t inputSize = 32 * 4096;
+  uint8_t * input = malloc(inputSize);
+  uint32_t noise = 1;
+  for (size_t i = 0; i < inputSize; i++) {
+    noise = noise * 1664525 + 1013904223;
+    input[i] = (i / 4096) % 2 ? noise >> 24 : sample[i % (sizeof(sample) - 1)];
+  }
+  char * path = emptyPath();
+  FILE * f = fopen(path, "wb");
+  fwrite(input, 1, inputSize, f);
+  fclose(f);
+
+  size_t capacity = compressBound(inputSize);
+  uint8_t * archive = malloc(capacity);
+  size_t archiveSize;
+  TEST_CHECK(compressBuffer(input, inputSize, archive, capacity, &archiveSize, newCompressorPredictor()));
+  // Coded, the noise alone would come to several times its size
+  TEST_CHECK_(archiveSize < inputSize, "Archive of %zu bytes", archiveSize);
+  uint8_t * restored = malloc(inputSize);
+  size_t restoredSize;
+  TEST_CHECK(decompressBuffer(archive, archiveSize, restored, inputSize, &restoredSize, newDecompressorPredictor()));
+  TEST_CHECK(restoredSize == inputSize && memcmp(input, restored, inputSize) == 0);
+
+  // A stored block that is not all pushed yet is rolled back
+  DecompressorStream ds;
+  DS_New(&ds, newDecompressorPredictor());
+  restoredSize = 0;
+  for (size_t i = 0; i < archiveSize; i += 100) {
+    DS_Push(&ds, archive + i, archiveSize - i < 100 ? archiveSize - i : 100);
+    restoredSize += DS_Pull(&ds, restored + restoredSize, inputSize - restoredSize);
+  }
+  TEST_CHECK(DS_Finished(&ds));
+  TEST_CHECK(restoredSize == inputSize && memcmp(input, restored, inputSize) == 0);
+  DS_Free(&ds);
+
+  char * piped = emptyPath();
+  char * pipeRestored = emptyPath();
+  char command[64];
+  snprintf(command, sizeof(command), "cat %s", path);
+  compress(popen(command, "r"), fopen(piped, "w+b"), newCompressorPredictor());
+  decompress(fopen(piped, "rb"), fopen(pipeRestored, "w+b"), newDecompressorPredictor());
+  TEST_CHECK_(sameContents(path, pipeRestored), "Stored round trip from a pipe lost data");
+
+  free(input);
+  free(archive);
+  free(restored);
+  remove(path);
+  remove(piped);
+  remove(pipeRestored);
+}
+
+void test_not_archive (void) {
+  uint8_t input[1000];
+  for (size_t i = 0; i < sizeof(input); i++) {
+    input[i] = sample[i % (sizeof(sample) - 1)];
+  }
+  uint8_t archive[2000];
+  uint8_t restored[1000];
+  size_t size;
+  TEST_CHECK(!decompressBuffer(input, sizeof(input), restored, sizeof(restored), &size, newDecompressorPredictor()));
+  TEST_CHECK(!decompressBuffer(input, 0, restored, sizeof(restored), &size, newDecompressorPredictor()));
+
+  size_t archiveSize;
+  TEST_CHECK(compressBuffer(input, sizeof(input), archive, sizeof(archive), &archiveSize, newCompressorPredictor()));
+  TEST_CHECK(!decompressBuffer(archive, archiveSize - 1, restored, sizeof(restored), &size, newDecompressorPredictor()));
+  archive[5] |= FRAME_RANGED | FRAME_RANS;
+  TEST_CHECK(!decompressBuffer(archive, archiveSize, restored, sizeof(restored), &size, newDecompressorPredictor()));
+  archive[4] = FRAME_VERSION + 1;
+  TEST_CHECK(!decompressBuffer(archive, archiveSize, restored, sizeof(restored), &size, newDecompressorPredictor()));
+}
+
+// The entry points that take files report what goes wrong with them, as the ones on buffers do
+void test_file_errors (void) {
+  char * input = samplePath(40);
+  char * restored = emptyPath();
+
+  TEST_CHECK(!compress(fopen(input, "rb"), fopen("/dev/full", "wb"), newCompressorPredictor()));
+  TEST_CHECK(!compressParallel(fopen(input, "rb"), fopen("/dev/full", "wb"), newCompressorPredictor(), 2));
+  TEST_CHECK(!decompress(fopen(input, "rb"), fopen(restored, "w+b"), newDecompressorPredictor()));
+  TEST_CHECK(!decompressMapped(fopen(input, "rb"), fopen(restored, "w+b"), newDecompressorPredictor()));
+  TEST_CHECK(!decompressParallel(fopen(input, "rb"), fopen(restored, "w+b"), newDecompressorPredictor(), 2));
+  TEST_CHECK(!decompressRange(fopen(input, "rb"), fopen(restored, "w+b"), 0, 10, newDecompressorPredictor()));
+  // Reading a directory fails rather than ending
+  TEST_CHECK(!compress(fopen("/tmp", "rb"), fopen(restored, "w+b"), newCompressorPredictor()));
+  TEST_CHECK(!decompress(fopen("/tmp", "rb"), fopen(restored, "w+b"), newDecompressorPredictor()));
+
+  remove(input);
+  remove(restored);
+}
+
+// Segments are coded apart, so the archive is the same whatever the thread count
+void test_parallel (void) {
+  size_t segmentRepeat = SEGMENT_SIZE / (sizeof(sample) - 1);
+  char * input = samplePath(segmentRepeat * 5 / 2);
+  char * archive = emptyPath();
+  char * threadedArchive = emptyPath();
+  char * restored = emptyPath();
+
+  compressParallel(fopen(input, "rb"), fopen(archive, "w+b"), newCompressorPredictor(), 2);
+  compressParallel(fopen(input, "rb"), fopen(threadedArchive, "w+b"), newCompressorPredictor(), 5);
+  TEST_CHECK_(sameContents(archive, threadedArchive), "Archive depends on the thread count");
+
+  decompress(fopen(archive, "rb"), fopen(restored, "w+b"), newDecompressorPredictor());
+  TEST_CHECK_(sameContents(input, restored), "Parallel round trip lost data");
+  decompressParallel(fopen(archive, "rb"), fopen(restored, "w+b"), newDecompressorPredictor(), 3);
+  TEST_CHECK_(sameContents(input, restored), "Parallel decompression lost data");
+
+  // The index of the second archive does not cover the first, so the joined archive decodes front to back
+  char command[256];
+  char * joined = emptyPath();
+  char * joinedArchive = emptyPath();
+  snprintf(command, sizeof(command), "cat %s %s > %s; cat %s %s > %s", input, input, joined, archive, archive, joinedArchive);
+  TEST_CHECK(system(command) == 0);
+  decompressParallel(fopen(joinedArchive, "rb"), fopen(restored, "w+b"), newDecompressorPredictor(), 3);
+  TEST_CHECK_(sameContents(joined, restored), "Joined parallel archives lost data");
+  remove(joined);
+  remove(joinedArchive);
+
+  char * empty = emptyPath();
+  compressParallel(fopen(empty, "rb"), fopen(archive, "w+b"), newCompressorPredictor(), 3);
+  decompress(fopen(archive, "rb"), fopen(restored, "w+b"), newDecompressorPredictor());
+  TEST_CHECK_(sameContents(empty, restored), "Empty parallel round trip");
+
+  remove(input);
+  remove(archive);
+  remove(threadedArchive);
+  remove(restored);
+  remove(empty);
+}
+
+void test_pipelined (void) {
+  char * input = samplePath(PIPELINE_BLOCKS * CHANGE_INTERVAL / (sizeof(sample) - 1) * 3);
+  char * archive = emptyPath();
+  char * pipelinedArchive = emptyPath();
+  char * restored = emptyPath();
+
+  compress(fopen(input, "rb"), fopen(archive, "w+b"), newCompressorPredictor());
+  compressPipelined(fopen(input, "rb"), fopen(pipelinedArchive, "w+b"), newCompressorPredictor());
+  TEST_CHECK_(sameContents(archive, pipelinedArchive), "Pipelining changed the archive");
+  decompress(fopen(pipelinedArchive, "rb"), fopen(restored, "w+b"), newDecompressorPredictor());
+  TEST_CHECK_(sameContents(input, restored), "Pipelined round trip lost data");
+
+  // From a pipe the blocks say how they end
+  char command[256];
+  snprintf(command, sizeof(command), "cat %s", input);
+  compressPipelined(popen(command, "r"), fopen(pipelinedArchive, "w+b"), newCompressorPredictor());
+  decompress(fopen(pipelinedArchive, "rb"), fopen(restored, "w+b"), newDecompressorPredictor());
+  TEST_CHECK_(sameContents(input, restored), "Pipelined round trip from a pipe lost data");
+
+  char * empty = emptyPath();
+  compressPipelined(fopen(empty, "rb"), fopen(pipelinedArchive, "w+b"), newCompressorPredictor());
+  decompress(fopen(pipelinedArchive, "rb"), fopen(restored, "w+b"), newDecompressorPredictor());
+  TEST_CHECK_(sameContents(empty, restored), "Empty pipelined round trip");
+
+  remove(input);
+  remove(archive);
+  remove(pipelinedArchive);
+  remove(restored);
+  remove(empty);
+}
+
+static long fileSize (const char * path) {
+  struct stat st;
+  return stat(path, &st) == 0 ? st.st_size : -1;
+}
+
+void test_trial (void) {
+  // A few rounds of trials, the last one short
+  char * input = samplePath(2500);
+  char * archive = emptyPath();
+  char * trialArchive = emptyPath();
+  char * threadedArchive = emptyPath();
+  char * restored = emptyPath();
+
+  compress(fopen(input, "rb"), fopen(archive, "w+b"), newCompressorPredictor());
+  compressTrial(fopen(input, "rb"), fopen(trialArchive, "w+b"), newCompressorPredictor(), 1);
+  compressTrial(fopen(input, "rb"), fopen(threadedArchive, "w+b"), newCompressorPredictor(), 3);
+  TEST_CHECK_(sameContents(trialArchive, threadedArchive), "Threads changed the trial archive");
+  TEST_CHECK_(fileSize(trialArchive) <= fileSize(archive), "Trials coded worse than scores, %ld > %ld",
+      fileSize(trialArchive), fileSize(archive));
+  decompress(fopen(trialArchive, "rb"), fopen(restored, "w+b"), newDecompressorPredictor());
+  TEST_CHECK_(sameContents(input, restored), "Trial round trip lost data");
+
+  char command[256];
+  snprintf(command, sizeof(command), "cat %s", input);
+  compressTrial(popen(command, "r"), fopen(trialArchive, "w+b"), newCompressorPredictor(), 2);
+  decompress(fopen(trialArchive, "rb"), fopen(restored, "w+b"), newDecompressorPredictor());
+  TEST_CHECK_(sameContents(input, restored), "Trial round trip from a pipe lost data");
+
+  remove(input);
+  remove(archive);
+  remove(trialArchive);
+  remove(threadedArchive);
+  remove(restored);
+}
+
+// Whether the range of archive decodes to the same bytes as that range of input
+static int sameRange (const uint8_t * archive, size_t archiveSize, const uint8_t * input, size_t inputSize,
+    uint64_t offset, uint64_t length) {
+  uint8_t * range = malloc(length);
+  size_t rangeSize;
+  int ok = decompressRangeBuffer(archive, archiveSize, offset, length, range, &rangeSize, newDecompressorPredictor());
+  size_t expected = offset > inputSize ? 0 : (inputSize - offset < length ? inputSize - offset : length);
+  ok = ok && rangeSize == expected && memcmp(range, input + offset, rangeSize) == 0;
+  free(range);
+  return ok;
+}
+
+// Writes stretches of noise the models cannot code in fewer bits than it has, between stretches of text, to a fresh
+// temporary file and returns its path. Both stretches are stretch bytes long, and with a stretch of 0 it is all noise
+static char * noisePath (size_t size, size_t stretch) {
+  char * path = emptyPath();
+  FILE * f = fopen(path, "wb");
+  uint32_t noise = 1;
+  for (size_t i = 0; i < size; i++) {
+    noise = noise * 1664525 + 1013904223;
+    putc(stretch == 0 || (i / stretch) % 2 ? noise >> 24 : sample[i % (sizeof(sample) - 1)], f);
+  }
+  fclose(f);
+  return path;
+}
+
+// Round trips input through a compressor that writes frames of another layout, by every way there is to decode them
+static void checkLayoutInput (int (*compressLayout) (FILE*, FILE*, CompressorPredictor*), const char * name,
+    const char * input) {
+  char * archive = emptyPath();
+  char * restored = emptyPath();
+
+  compressLayout(fopen(input, "rb"), fopen(archive, "w+b"), newCompressorPredictor());
+  decompress(fopen(archive, "rb"), fopen(restored, "w+b"), newDecompressorPredictor());
+  TEST_CHECK_(sameContents(input, restored), "%s round trip lost data", name);
+  decompressMapped(fopen(archive, "rb"), fopen(restored, "w+b"), newDecompressorPredictor());
+  TEST_CHECK_(sameContents(input, restored), "Mapped %s round trip lost data", name);
+
+  // Restart points are the starts of runs
+  size_t inputSize, archiveSize;
+  uint8_t * inputData = readAll(input, &inputSize);
+  uint8_t * archiveData = readAll(archive, &archiveSize);
+  TEST_CHECK(sameRange(archiveData, archiveSize, inputData, inputSize, CODER_RUN - 100, 300));
+  TEST_CHECK(sameRange(archiveData, archiveSize, inputData, inputSize, 2 * CODER_RUN + 5, 1000));
+
+  // A block that is not all pushed yet is rolled back
+  DecompressorStream ds;
+  DS_New(&ds, newDecompressorPredictor());
+  uint8_t * streamed = malloc(inputSize);
+  size_t streamedSize = 0;
+  for (size_t i = 0; i < archiveSize; i += 1000) {
+    DS_Push(&ds, archiveData + i, archiveSize - i < 1000 ? archiveSize - i : 1000);
+    streamedSize += DS_Pull(&ds, streamed + streamedSize, inputSize - streamedSize);
+  }
+  TEST_CHECK(!DS_Failed(&ds));
+  TEST_CHECK(streamedSize == inputSize && memcmp(streamed, inputData, inputSize) == 0);
+  DS_Free(&ds);
+
+  // From a pipe the blocks say how they end
+  char command[256];
+  snprintf(command, sizeof(command), "cat %s", input);
+  compressLayout(popen(command, "r"), fopen(archive, "w+b"), newCompressorPredictor());
+  decompress(fopen(archive, "rb"), fopen(restored, "w+b"), newDecompressorPredictor());
+  TEST_CHECK_(sameContents(input, restored), "%s round trip from a pipe lost data", name);
+
+  free(streamed);
+  free(inputData);
+  free(archiveData);
+  remove(archive);
+  remove(restored);
+}
+
+static void checkLayout (int (*compressLayout) (FILE*, FILE*, CompressorPredictor*), const char * name) {
+  // Three runs, the last one short
+  char * input = samplePath(2000);
+  checkLayoutInput(compressLayout, name, input);
+  remove(input);
+
+  // The noise is stored, some of it in the middle of runs and some at their ends. Coded, the noise alone would come
+  // to several times its size
+  char * noisy = noisePath(3 * CODER_RUN + 1000, 4096);
+  checkLayoutInput(compressLayout, name, noisy);
+  char * archive = emptyPath();
+  compressLayout(fopen(noisy, "rb"), fopen(archive, "w+b"), newCompressorPredictor());
+  TEST_CHECK_(fileSize(archive) < fileSize(noisy), "%s archive of %ld bytes", name, fileSize(archive));
+  remove(noisy);
+
+  char * empty = emptyPath();
+  char * restored = emptyPath();
+  compressLayout(fopen(empty, "rb"), fopen(archive, "w+b"), newCompressorPredictor());
+  decompress(fopen(archive, "rb"), fopen(restored, "w+b"), newDecompressorPredictor());
+  TEST_CHECK_(sameContents(empty, restored), "Empty %s round trip", name);
+
+  remove(archive);
+  remove(restored);
+  remove(empty);
+}
+
+void test_interleaved (void) {
+  checkLayout(compressInterleaved, "interleaved");
+}
+
+void test_ranged (void) {
+  checkLayout(compressRanged, "ranged");
+}
+
+void test_rans (void) {
+  checkLayout(compressRans, "rANS");
+}
+
+void test_bytes (void) {
+  checkLayout(compressBytes, "byte");
+}
+
+void test_shards (void) {
+  char * input = samplePath(3000);
+  const uint64_t shardSize = 100000;
+  const char * shards[4];
+  for (int i = 0; i < 4; i++) {
+    shards[i] = emptyPath();
+  }
+
+  // A process per shard, the last one past the end of the input
+  pid_t children[4];
+  for (int i = 0; i < 4; i++) {
+    children[i] = fork();
+    if (children[i] == 0) {
+      _exit(!compressShard(fopen(input, "rb"), fopen(shards[i], "wb"), i * shardSize, shardSize, newCompressorPredictor()));
+    }
+  }
+  for (int i = 0; i < 4; i++) {
+    int status;
+    TEST_CHECK(waitpid(children[i], &status, 0) == children[i] && WIFEXITED(status) && WEXITSTATUS(status) == 0);
+  }
+
+  char * archive = emptyPath();
+  char * restored = emptyPath();
+  FILE * output = fopen(archive, "wb");
+  TEST_CHECK(mergeShards(shards, 4, output));
+  fclose(output);
+  decompress(fopen(archive, "rb"), fopen(restored, "w+b"), newDecompressorPredictor());
+  TEST_CHECK_(sameContents(input, restored), "Merged shards lost data");
+  decompressParallel(fopen(archive, "rb"), fopen(restored, "w+b"), newDecompressorPredictor(), 3);
+  TEST_CHECK_(sameContents(input, restored), "Merged shards lost data in parallel");
+
+  // Across the seam between two shards
+  size_t inputSize, archiveSize;
+  uint8_t * inputData = readAll(input, &inputSize);
+  uint8_t * archiveData = readAll(archive, &archiveSize);
+  TEST_CHECK(sameRange(archiveData, archiveSize, inputData, inputSize, shardSize - 1000, 5000));
+
+  // Anything without an index is turned down
+  output = fopen(restored, "wb");
+  const char * notShards[] = { shards[0], input };
+  TEST_CHECK(!mergeShards(notShards, 2, output));
+  fclose(output);
+
+  free(inputData);
+  free(archiveData);
+  for (int i = 0; i < 4; i++) {
+    remove(shards[i]);
+  }
+  remove(input);
+  remove(archive);
+  remove(restored);
+}
+
+void test_range (void) {
+  // Numbered lines, so a range decoded from the wrong place cannot pass for the right one
+  char * input = emptyPath();
+  FILE * f = fopen(input, "wb");
+  for (int i = 0; ftell(f) < SEGMENT_SIZE * 3 / 2; i++) {
+    fprintf(f, "%d %s", i, sample);
+  }
+  fclose(f);
+  char * archive = emptyPath();
+  char * parallelArchive = emptyPath();
+  compressMapped(fopen(input, "rb"), fopen(archive, "w+b"), newCompressorPredictor());
+  compressParallel(fopen(input, "rb"), fopen(parallelArchive, "w+b"), newCompressorPredictor(), 2);
+
+  size_t inputSize, archiveSize, parallelSize;
+  uint8_t * data = readAll(input, &inputSize);
+  uint8_t * archiveData = readAll(archive, &archiveSize);
+  uint8_t * parallelData = readAll(parallelArchive, &parallelSize);
+  SegmentIndex index;
+  TEST_CHECK_(SI_Read(&index, archiveData, archiveSize), "No index for more than a restart interval");
+  SI_Free(&index);
+  uint64_t ranges[][2] = {
+    {0, 100},
+    {RESTART_INTERVAL, 1},
+    {RESTART_INTERVAL - 10, 300},
+    {5 * RESTART_INTERVAL + 7, 3 * RESTART_INTERVAL},
+    {SEGMENT_SIZE - 50, 100}, // Across two frames of the parallel archive
+    {inputSize - 20, 100},
+    {inputSize + 5, 10},
+  };
+  for (size_t i = 0; i < sizeof(ranges) / sizeof(ranges[0]); i++) {
+    TEST_CHECK_(sameRange(archiveData, archiveSize, data, inputSize, ranges[i][0], ranges[i][1]),
+        "Range %zu of one frame", i);
+    TEST_CHECK_(sameRange(parallelData, parallelSize, data, inputSize, ranges[i][0], ranges[i][1]),
+        "Range %zu of segments", i);
+  }
+
+  // Archives without an index are decoded from the start
+  size_t capacity = compressBound(inputSize);
+  uint8_t * plain = malloc(capacity);
+  size_t plainSize;
+  TEST_CHECK(compressBuffer(data, inputSize, plain, capacity, &plainSize, newCompressorPredictor()));
+  TEST_CHECK(sameRange(plain, plainSize, data, inputSize, 3 * RESTART_INTERVAL + 1, 1000));
+
+  char * restored = emptyPath();
+  decompressRange(fopen(archive, "rb"), fopen(restored, "w+b"), 2 * RESTART_INTERVAL, RESTART_INTERVAL,
+      newDecompressorPredictor());
+  size_t restoredSize;
+  uint8_t * restoredData = readAll(restored, &restoredSize);
+  TEST_CHECK(restoredSize == RESTART_INTERVAL && memcmp(restoredData, data + 2 * RESTART_INTERVAL, restoredSize) == 0);
+
+  free(data);
+  free(archiveData);
+  free(parallelData);
+  free(plain);
+  free(restoredData);
+  remove(input);
+  remove(archive);
+  remove(parallelArchive);
+  remove(restored);
+}
+
+// Noise in frames that flush for stored blocks, stored a run at a time
+void test_stored_runs (void) {
+  int (*compressors[]) (FILE*, FILE*, CompressorPredictor*) = { compress, compressRanged, compressBytes };
+  const char * names[] = { "plain", "ranged", "byte" };
+  char * input = noisePath(16 * CODER_RUN, 0);
+  char * archive = emptyPath();
+  char * restored = emptyPath();
+  for (int i = 0; i < 3; i++) {
+    TEST_CHECK(compressors[i](fopen(input, "rb"), fopen(archive, "w+b"), newCompressorPredictor()));
+    TEST_CHECK_(fileSize(archive) < fileSize(input) + fileSize(input) / 1000, "%s archive of %ld bytes", names[i],
+        fileSize(archive));
+    TEST_CHECK(decompress(fopen(archive, "rb"), fopen(restored, "w+b"), newDecompressorPredictor()));
+    TEST_CHECK_(sameContents(input, restored), "%s round trip lost data", names[i]);
+  }
+  TEST_CHECK(compressTrial(fopen(input, "rb"), fopen(archive, "w+b"), newCompressorPredictor(), 2));
+  TEST_CHECK_(fileSize(archive) < fileSize(input) + fileSize(input) / 1000, "Trial archive of %ld bytes",
+      fileSize(archive));
+  TEST_CHECK(decompress(fopen(archive, "rb"), fopen(restored, "w+b"), newDecompressorPredictor()));
+  TEST_CHECK_(sameContents(input, restored), "Trial round trip lost data");
+
+  // Restart points in the middle of the noise, and in the text after it
+  size_t stretch = 2 * RESTART_INTERVAL + 100;
+  char * mixed = noisePath(4 * stretch, stretch);
+  TEST_CHECK(compress(fopen(mixed, "rb"), fopen(archive, "w+b"), newCompressorPredictor()));
+  size_t inputSize, archiveSize;
+  uint8_t * inputData = readAll(mixed, &inputSize);
+  uint8_t * archiveData = readAll(archive, &archiveSize);
+  SegmentIndex index;
+  TEST_CHECK(SI_Read(&index, archiveData, archiveSize));
+  SI_Free(&index);
+  uint64_t ranges[][2] = {
+    {stretch + 10, 500},
+    {2 * RESTART_INTERVAL, 1},
+    {3 * RESTART_INTERVAL + 5, 300},
+    {2 * stretch - 500, 1000}, // From the noise into the text
+    {2 * stretch + 7, RESTART_INTERVAL},
+    {3 * stretch - 100, 2 * RESTART_INTERVAL},
+  };
+  for (size_t i = 0; i < sizeof(ranges) / sizeof(ranges[0]); i++) {
+    TEST_CHECK_(sameRange(archiveData, archiveSize, inputData, inputSize, ranges[i][0], ranges[i][1]), "Range %zu", i);
+  }
+
+  free(inputData);
+  free(archiveData);
+  remove(input);
+  remove(mixed);
+  remove(archive);
+  remove(restored);
+}
+
+// Models that predict 0 for every bit, which no table should. The coders price a 1 at 16 bits but take 32 for it, so
+// blocks with a few of them are coded, and come out about twice the size they would take stored
+static ModelArray_t zeroModels (void) {
+  static ModelData_t zeros;
+  ModelArray_t mos = malloc(sizeof(*mos));
+  S_MO_EnumerateAllModels(mos);
+  for (int i = 0; i < NUM_MODELS; i++) {
+    MO_SetData((*mos)[i], &zeros);
+  }
+  return mos;
+}
+
+// 15 bytes of every 32 have a 1, a little less than half of them, so the blocks are coded even without a flush to save
+static uint8_t * sparseOnes (size_t size) {
+  uint8_t * data = malloc(size);
+  for (size_t i = 0; i < size; i++) {
+    data[i] = i % 32 < 15;
+  }
+  return data;
+}
+
+// Archives that come out larger than their blocks would stored are written stored after all
+void test_stored_fallback (void) {
+  size_t inputSize = 3 * CODER_RUN + 1000;
+  uint8_t * input = sparseOnes(inputSize);
+  CompressorPredictor * cp = malloc(sizeof(*cp));
+  *cp = (CompressorPredictor) {0};
+  CP_New(cp, zeroModels(), NUM_MODELS, 0);
+  CP_SelectModel(cp, TEXT1);
+  DecompressorPredictor * dp = malloc(sizeof(*dp));
+  *dp = (DecompressorPredictor) {0};
+  DP_New(dp, zeroModels(), NUM_MODELS, 0);
+
+  size_t capacity = compressBound(inputSize);
+  uint8_t * archive = malloc(capacity);
+  size_t archiveSize;
+  TEST_CHECK(compressBuffer(input, inputSize, archive, capacity, &archiveSize, cp));
+  TEST_CHECK_(archiveSize >= inputSize && archiveSize <= capacity, "Archive of %zu bytes", archiveSize);
+  uint8_t * restored = malloc(inputSize);
+  size_t restoredSize;
+  TEST_CHECK(decompressBuffer(archive, archiveSize, restored, inputSize, &restoredSize, dp));
+  TEST_CHECK(restoredSize == inputSize && memcmp(input, restored, inputSize) == 0);
+
+  // An interleaved run that comes out larger than MAX_RUN is coded again with every block stored
+  char * path = emptyPath();
+  FILE * f = fopen(path, "wb");
+  fwrite(input, 1, inputSize, f);
+  fclose(f);
+  char * interleaved = emptyPath();
+  char * interleavedRestored = emptyPath();
+  CP_SelectModel(cp, TEXT1);
+  CP_Reset(cp);
+  TEST_CHECK(compressInterleaved(fopen(path, "rb"), fopen(interleaved, "w+b"), cp));
+  TEST_CHECK_(fileSize(interleaved) <= (long)capacity, "Interleaved archive of %ld bytes", fileSize(interleaved));
+  TEST_CHECK(decompress(fopen(interleaved, "rb"), fopen(interleavedRestored, "w+b"), dp));
+  TEST_CHECK_(sameContents(path, interleavedRestored), "Interleaved round trip lost data");
+
+  free(input);
+  free(archive);
+  free(restored);
+  remove(path);
+  remove(interleaved);
+  remove(interleavedRestored);
+}
+
+// An index that only points at the start of the one frame is left out, it would be most of a small archive
+void test_small_index (void) {
+  char * inputs[] = { emptyPath(), samplePath(1), samplePath(RESTART_INTERVAL / (sizeof(sample) - 1)) };
+  char * archive = emptyPath();
+  for (size_t i = 0; i < sizeof(inputs) / sizeof(inputs[0]); i++) {
+    TEST_CHECK(compress(fopen(inputs[i], "rb"), fopen(archive, "w+b"), newCompressorPredictor()));
+    size_t size;
+    uint8_t * data = readAll(archive, &size);
+    SegmentIndex index;
+    TEST_CHECK_(!SI_Read(&index, data, size), "Index in archive %zu", i);
+    SI_Free(&index);
+    free(data);
+    remove(inputs[i]);
+  }
+  remove(archive);
+}
+
 TEST_LIST = {
     { "arguments_c", test_arguments },
+    { "mapped", test_mapped },
+    { "stream", test_stream },
+    { "binary", test_binary },
+    { "buffer", test_buffer },
+    { "concatenated", test_concatenated },
+    { "stored", test_stored },
+    { "not_archive", test_not_archive },
+    { "file_errors", test_file_errors },
+    { "parallel", test_parallel },
+    { "range", test_range },
+    { "stored_runs", test_stored_runs },
+    { "stored_fallback", test_stored_fallback },
+    { "small_index", test_small_index },
+    { "pipelined", test_pipelined },
+    { "trial", test_trial },
+    { "interleaved", test_interleaved },
+    { "ranged", test_ranged },
+    { "rans", test_rans },
+    { "bytes", test_bytes },
+    { "shards", test_shards },
     { NULL, NULL }
 };
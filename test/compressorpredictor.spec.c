@@ -80,10 +80,22 @@ void test_best_model (void) {
   ModelArray_t mos = malloc(sizeof(mos));
   S_MO_EnumerateAllModels(mos);
   CP_New(cp, mos, NUM_MODELS, 0);
-  (*cp->models)[0]->score = .8;
+  cp->scores[0] = .8;
 
   TEST_CHECK(CP_GetBestModel(cp) != NULL);
-  TEST_CHECK((CP_GetBestModel(cp)->score - 0.8) <= 0.1);
+  TEST_CHECK((cp->scores[CP_GetBestModel(cp)->code] - 0.8) <= 0.1);
+}
+
+void test_reset (void) {
+  CompressorPredictor * cp = malloc(sizeof(CompressorPredictor));
+  ModelArray_t mos = malloc(sizeof(*mos));
+  S_MO_EnumerateAllModels(mos);
+  CP_New(cp, mos, NUM_MODELS, 0x6267);
+  cp->scores[1] = .8;
+
+  CP_Reset(cp);
+  TEST_CHECK(cp->ctx == 0);
+  TEST_CHECK(cp->scores[0] == 0 && cp->scores[1] == 0);
 }
 
 void test_integrate (void) {
@@ -97,23 +109,23 @@ void test_integrate (void) {
   TEST_CHECK(cp->currentModel == (*cp->models)[0]);
 
   int prediction = CP_Predict(cp);
-  TEST_CHECK(prediction >= 0 && prediction <= 4095);
-  TEST_CHECK(cp->currentModel->lastPrediction == prediction);
+  TEST_CHECK(prediction >= 0 && prediction <= MODEL_LIMIT);
+  TEST_CHECK(cp->lastPredictions[cp->currentModel->code] == prediction);
   CP_Update(cp, 1);
 
   prediction = CP_Predict(cp);
-  TEST_CHECK(prediction >= 0 && prediction <= 4095);
-  TEST_CHECK(cp->currentModel->lastPrediction == prediction);
+  TEST_CHECK(prediction >= 0 && prediction <= MODEL_LIMIT);
+  TEST_CHECK(cp->lastPredictions[cp->currentModel->code] == prediction);
   CP_Update(cp, 1);
 
   prediction = CP_Predict(cp);
-  TEST_CHECK(prediction >= 0 && prediction <= 4095);
-  TEST_CHECK(cp->currentModel->lastPrediction == prediction);
+  TEST_CHECK(prediction >= 0 && prediction <= MODEL_LIMIT);
+  TEST_CHECK(cp->lastPredictions[cp->currentModel->code] == prediction);
   CP_Update(cp, 1);
 
   prediction = CP_Predict(cp);
-  TEST_CHECK(prediction >= 0 && prediction <= 4095);
-  TEST_CHECK(cp->currentModel->lastPrediction == prediction);
+  TEST_CHECK(prediction >= 0 && prediction <= MODEL_LIMIT);
+  TEST_CHECK(cp->lastPredictions[cp->currentModel->code] == prediction);
   CP_Update(cp, 0);
 }
 
@@ -123,6 +135,7 @@ TEST_LIST = {
     { "prediction", test_predict },
     { "select_model", test_select_model },
     { "best_model", test_best_model },
+    { "reset", test_reset },
     { "integrate", test_integrate },
     { NULL, NULL }
 };
@@ -0,0 +1,84 @@
+#include <string.h>
+#include <unistd.h>
+
+#include "acutest.h"
+#include "compressor.h"
+#include "decompressor.h"
+#include "modelenum.h"
+
+// Past every 32 bit size and offset
+#define LARGE_SIZE ((off_t)1 << 32) + ((off_t)1 << 20)
+
+static const char marker[] = "packingtape";
+
+static char * emptyPath (void) {
+  char * path = strdup("/tmp/packingtape-test-XXXXXX");
+  close(mkstemp(path));
+  return path;
+}
+
+// A hole with a few markers, one of them straddling the 4 GiB boundary
+static char * largePath (void) {
+  char * path = emptyPath();
+  FILE * f = fopen(path, "r+b");
+  ftruncate(fileno(f), LARGE_SIZE);
+  off_t offsets[] = { 0, ((off_t)1 << 32) - 5, LARGE_SIZE - (off_t)sizeof(marker) };
+  for (int i = 0; i < 3; i++) {
+    fseeko(f, offsets[i], SEEK_SET);
+    fwrite(marker, 1, sizeof(marker) - 1, f);
+  }
+  fclose(f);
+  return path;
+}
+
+static int sameContents (const char * a, const char * b) {
+  FILE * fa = fopen(a, "rb");
+  FILE * fb = fopen(b, "rb");
+  static char bufa[1 << 16], bufb[1 << 16];
+  int same = 1;
+  size_t na;
+  do {
+    na = fread(bufa, 1, sizeof(bufa), fa);
+    size_t nb = fread(bufb, 1, sizeof(bufb), fb);
+    same = na == nb && memcmp(bufa, bufb, na) == 0;
+  } while (same && na > 0);
+  fclose(fa);
+  fclose(fb);
+  return same;
+}
+
+void test_large_round_trip (void) {
+  char * input = largePath();
+  char * archive = emptyPath();
+  char * restored = emptyPath();
+
+  CompressorPredictor * cp = malloc(sizeof(*cp));
+  *cp = (CompressorPredictor) {0};
+  ModelArray_t cmos = malloc(sizeof(*cmos));
+  S_MO_EnumerateAllModels(cmos);
+  CP_New(cp, cmos, NUM_MODELS, 0);
+  CP_SelectModel(cp, TEXT1);
+  compressMapped(fopen(input, "rb"), fopen(archive, "w+b"), cp);
+
+  DecompressorPredictor * dp = malloc(sizeof(*dp));
+  *dp = (DecompressorPredictor) {0};
+  ModelArray_t dmos = malloc(sizeof(*dmos));
+  S_MO_EnumerateAllModels(dmos);
+  DP_New(dp, dmos, NUM_MODELS, 0);
+  decompressMapped(fopen(archive, "rb"), fopen(restored, "w+b"), dp);
+
+  FILE * f = fopen(restored, "rb");
+  fseeko(f, 0, SEEK_END);
+  TEST_CHECK_(ftello(f) == LARGE_SIZE, "Restored %lld bytes", (long long)ftello(f));
+  fclose(f);
+  TEST_CHECK_(sameContents(input, restored), "Large round trip lost data");
+
+  remove(input);
+  remove(archive);
+  remove(restored);
+}
+
+TEST_LIST = {
+    { "large_round_trip", test_large_round_trip },
+    { NULL, NULL }
+};
@@ -0,0 +1,102 @@
+#include <string.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#include "acutest.h"
+#include "compressor.h"
+#include "decompressor.h"
+#include "modelenum.h"
+
+// Built with MAX_RUN at 4 KiB, so a run of text codes to more than it allows and is coded again with every block
+// stored
+
+static const char sample[] = "static int count (const char * s) {\n  int n = 0;\n  while (*s++) n++;\n  return n;\n}\n";
+
+static char * emptyPath (void) {
+  char * path = strdup("/tmp/packingtape-test-XXXXXX");
+  close(mkstemp(path));
+  return path;
+}
+
+static CompressorPredictor * newCompressorPredictor (void) {
+  CompressorPredictor * p = malloc(sizeof(*p));
+  *p = (CompressorPredictor) {0};
+  ModelArray_t mos = malloc(sizeof(*mos));
+  S_MO_EnumerateAllModels(mos);
+  CP_New(p, mos, NUM_MODELS, 0);
+  CP_SelectModel(p, TEXT1);
+  return p;
+}
+
+static DecompressorPredictor * newDecompressorPredictor (void) {
+  DecompressorPredictor * p = malloc(sizeof(*p));
+  *p = (DecompressorPredictor) {0};
+  ModelArray_t mos = malloc(sizeof(*mos));
+  S_MO_EnumerateAllModels(mos);
+  DP_New(p, mos, NUM_MODELS, 0);
+  return p;
+}
+
+static int sameContents (const char * a, const char * b) {
+  FILE * fa = fopen(a, "rb");
+  FILE * fb = fopen(b, "rb");
+  int c;
+  int same = 0;
+  while ((c = getc(fa)) == getc(fb)) {
+    if (c == EOF) {
+      same = 1;
+      break;
+    }
+  }
+  fclose(fa);
+  fclose(fb);
+  return same;
+}
+
+static long fileSize (const char * path) {
+  struct stat st;
+  return stat(path, &st) == 0 ? st.st_size : -1;
+}
+
+static void checkRecoded (int (*compressLayout) (FILE*, FILE*, CompressorPredictor*), const char * name) {
+  // Numbered lines, three runs and a short one
+  char * input = emptyPath();
+  FILE * f = fopen(input, "wb");
+  for (int i = 0; ftell(f) < 3 * CODER_RUN + 1000; i++) {
+    fprintf(f, "%d %s", i, sample);
+  }
+  fclose(f);
+  char * archive = emptyPath();
+  char * restored = emptyPath();
+
+  TEST_CHECK(compressLayout(fopen(input, "rb"), fopen(archive, "w+b"), newCompressorPredictor()));
+  // Every block is stored
+  TEST_CHECK_(fileSize(archive) > fileSize(input), "%s archive of %ld bytes", name, fileSize(archive));
+  TEST_CHECK(decompress(fopen(archive, "rb"), fopen(restored, "w+b"), newDecompressorPredictor()));
+  TEST_CHECK_(sameContents(input, restored), "%s round trip lost data", name);
+
+  // From a pipe the blocks say how they end
+  char command[256];
+  snprintf(command, sizeof(command), "cat %s", input);
+  TEST_CHECK(compressLayout(popen(command, "r"), fopen(archive, "w+b"), newCompressorPredictor()));
+  TEST_CHECK(decompress(fopen(archive, "rb"), fopen(restored, "w+b"), newDecompressorPredictor()));
+  TEST_CHECK_(sameContents(input, restored), "%s round trip from a pipe lost data", name);
+
+  remove(input);
+  remove(archive);
+  remove(restored);
+}
+
+void test_interleaved (void) {
+  checkRecoded(compressInterleaved, "Interleaved");
+}
+
+void test_rans (void) {
+  checkRecoded(compressRans, "rANS");
+}
+
+TEST_LIST = {
+    { "interleaved", test_interleaved },
+    { "rans", test_rans },
+    { NULL, NULL }
+};
@@ -0,0 +1,77 @@
+#include <string.h>
+
+#include "acutest.h"
+#include "segmentindex.h"
+
+// An archive of three made up frames followed by their index
+static size_t writeArchive (ByteBuffer * archive) {
+  BB_NewGrowingWriter(archive, 16);
+  SegmentIndex index;
+  SI_New(&index);
+  uint8_t frame[100] = {0};
+  Coder coder;
+  initCoder(&coder);
+  coder.x1 = 0x01020304;
+  for (int i = 0; i < 3; i++) {
+    SI_AddFrame(&index, BB_Tell(archive), i * 1000);
+    BB_Write(archive, frame, sizeof(frame));
+    if (i == 1) {
+      SI_AddRestart(&index, BB_Tell(archive), i * 1000 + 500, &coder, 0xbeef, 2);
+    }
+  }
+  SI_Write(&index, archive, BB_Tell(archive), 2500);
+  SI_Free(&index);
+  return BB_Tell(archive);
+}
+
+void test_write_read (void) {
+  ByteBuffer archive;
+  size_t len = writeArchive(&archive);
+
+  SegmentIndex index;
+  TEST_CHECK(SI_Read(&index, archive.data, len));
+  TEST_CHECK(index.count == 4);
+  TEST_CHECK(index.points[1].compressedOffset == 100 && index.points[4].compressedOffset == 300);
+  TEST_CHECK(index.points[3].offset == 2000 && index.points[4].offset == 2500);
+  RestartPoint * restart = &index.points[2];
+  TEST_CHECK(!restart->frameStart && restart->offset == 1500 && restart->compressedOffset == 200);
+  TEST_CHECK(restart->x1 == 0x01020304 && restart->x2 == 0xffffffff && restart->ctx == 0xbeef);
+  TEST_CHECK(restart->switchPrediction == SWITCH_PREDICTION && restart->modelCode == 2);
+  TEST_CHECK(index.points[3].frameStart);
+
+  TEST_CHECK(SI_Find(&index, 0) == 0);
+  TEST_CHECK(SI_Find(&index, 1499) == 1);
+  TEST_CHECK(SI_Find(&index, 1500) == 2);
+  TEST_CHECK(SI_Find(&index, 9999) == 3);
+  SI_Free(&index);
+  BB_Free(&archive);
+}
+
+void test_not_covering (void) {
+  ByteBuffer archive;
+  size_t len = writeArchive(&archive);
+  SegmentIndex index;
+
+  // Something in front of the archive, like another archive joined with cat
+  uint8_t * joined = malloc(len + 7);
+  memset(joined, 0, 7);
+  memcpy(joined + 7, archive.data, len);
+  TEST_CHECK(!SI_Read(&index, joined, len + 7));
+  SI_Free(&index);
+
+  TEST_CHECK(!SI_Read(&index, archive.data, len - 1));
+  SI_Free(&index);
+  // Where the index says it starts
+  archive.data[len - 12 - INDEX_POINT_LENGTH] ^= 1;
+  TEST_CHECK(!SI_Read(&index, archive.data, len));
+  SI_Free(&index);
+
+  free(joined);
+  BB_Free(&archive);
+}
+
+TEST_LIST = {
+    { "write_read", test_write_read },
+    { "not_covering", test_not_covering },
+    { NULL, NULL }
+};
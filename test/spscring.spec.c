@@ -0,0 +1,41 @@
+#include <pthread.h>
+
+#include "acutest.h"
+#include "spscring.h"
+
+#define COUNT 100000
+
+static void * produce (void * arg) {
+  SpscRing * ring = arg;
+  for (int i = 0; i < COUNT; i++) {
+    int * slot = SR_Claim(ring);
+    slot[0] = i;
+    slot[1] = -i;
+    SR_Publish(ring);
+  }
+  return NULL;
+}
+
+void test_order (void) {
+  // A ring much smaller than what goes through it, so both sides have to wait on each other
+  SpscRing ring;
+  TEST_CHECK(SR_New(&ring, 2 * sizeof(int), 8));
+  pthread_t producer;
+  TEST_CHECK(pthread_create(&producer, NULL, produce, &ring) == 0);
+
+  int inOrder = 1;
+  for (int i = 0; i < COUNT; i++) {
+    int * slot = SR_Peek(&ring);
+    inOrder = inOrder && slot[0] == i && slot[1] == -i;
+    SR_Release(&ring);
+  }
+  TEST_CHECK(inOrder);
+
+  pthread_join(producer, NULL);
+  SR_Free(&ring);
+}
+
+TEST_LIST = {
+    { "order", test_order },
+    { NULL, NULL }
+};
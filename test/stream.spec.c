@@ -0,0 +1,166 @@
+#include <string.h>
+
+#include "acutest.h"
+#include "compressor.h"
+#include "compressorstream.h"
+#include "decompressor.h"
+#include "decompressorstream.h"
+#include "modelenum.h"
+
+static const char sample[] = "static int count (const char * s) {\n  int n = 0;\n  while (*s++) n++;\n  return n;\n}\n";
+
+static uint8_t input[1 << 16];
+static uint8_t archive[1 << 17];
+static uint8_t restored[1 << 16];
+
+static CompressorPredictor * newCompressorPredictor (void) {
+  CompressorPredictor * p = malloc(sizeof(*p));
+  *p = (CompressorPredictor) {0};
+  ModelArray_t mos = malloc(sizeof(*mos));
+  S_MO_EnumerateAllModels(mos);
+  CP_New(p, mos, NUM_MODELS, 0);
+  CP_SelectModel(p, TEXT1);
+  return p;
+}
+
+static DecompressorPredictor * newDecompressorPredictor (void) {
+  DecompressorPredictor * p = malloc(sizeof(*p));
+  *p = (DecompressorPredictor) {0};
+  ModelArray_t mos = malloc(sizeof(*mos));
+  S_MO_EnumerateAllModels(mos);
+  DP_New(p, mos, NUM_MODELS, 0);
+  return p;
+}
+
+static size_t sampleInput (int repeat) {
+  size_t len = 0;
+  for (int i = 0; i < repeat; i++) {
+    memcpy(input + len, sample, sizeof(sample) - 1);
+    len += sizeof(sample) - 1;
+  }
+  return len;
+}
+
+// Pushes inputSize bytes through the compressor chunk bytes at a time and pulls into archive after every push
+static size_t compressChunks (size_t inputSize, size_t chunk) {
+  size_t archiveSize = 0;
+  CompressorStream cs;
+  CS_New(&cs, newCompressorPredictor());
+  for (size_t i = 0; i < inputSize; i += chunk) {
+    CS_Push(&cs, input + i, inputSize - i < chunk ? inputSize - i : chunk);
+    archiveSize += CS_Pull(&cs, archive + archiveSize, chunk);
+  }
+  CS_Finish(&cs);
+  size_t n;
+  while ((n = CS_Pull(&cs, archive + archiveSize, chunk)) > 0) {
+    archiveSize += n;
+  }
+  CS_Free(&cs);
+  return archiveSize;
+}
+
+// Same for the decompressor. Returns SIZE_MAX if the archive did not decode to the end
+static size_t decompressChunks (size_t archiveSize, size_t chunk) {
+  size_t restoredSize = 0;
+  DecompressorStream ds;
+  DS_New(&ds, newDecompressorPredictor());
+  for (size_t i = 0; i < archiveSize; i += chunk) {
+    DS_Push(&ds, archive + i, archiveSize - i < chunk ? archiveSize - i : chunk);
+    restoredSize += DS_Pull(&ds, restored + restoredSize, sizeof(restored) - restoredSize);
+  }
+  int finished = DS_Finished(&ds);
+  DS_Free(&ds);
+  return finished ? restoredSize : SIZE_MAX;
+}
+
+void test_chunks (void) {
+  size_t inputSize = sampleInput(500);
+  size_t chunks[] = { 1, 7, 128, 4096, sizeof(input) };
+  for (int i = 0; i < 5; i++) {
+    size_t archiveSize = compressChunks(inputSize, chunks[i]);
+    TEST_CHECK_(archiveSize > 0 && archiveSize < inputSize, "Chunks of %zu: archive of %zu bytes", chunks[i], archiveSize);
+    size_t restoredSize = decompressChunks(archiveSize, chunks[i]);
+    TEST_CHECK_(restoredSize == inputSize && memcmp(input, restored, inputSize) == 0, "Chunks of %zu: lost data", chunks[i]);
+  }
+}
+
+// Exact multiples of the block length end in an empty last block
+void test_block_multiple (void) {
+  size_t inputSize = 4 * CHANGE_INTERVAL;
+  sampleInput(100);
+  size_t archiveSize = compressChunks(inputSize, 5);
+  TEST_CHECK(decompressChunks(archiveSize, 3) == inputSize && memcmp(input, restored, inputSize) == 0);
+  TEST_CHECK(decompressChunks(compressChunks(0, 1), 1) == 0);
+}
+
+// The stream writes the archive compress writes for a pipe, so either side can read the other's
+void test_same_as_buffer (void) {
+  size_t inputSize = sampleInput(50);
+  size_t archiveSize = compressChunks(inputSize, 100);
+  TEST_CHECK(decompressedSize(archive, archiveSize) == UNKNOWN_SIZE);
+  size_t restoredSize;
+  TEST_CHECK(decompressBuffer(archive, archiveSize, restored, sizeof(restored), &restoredSize, newDecompressorPredictor()));
+  TEST_CHECK(restoredSize == inputSize && memcmp(input, restored, inputSize) == 0);
+}
+
+// Every message decodes as soon as the compressor has been flushed after it, without any bytes of the next one
+void test_flush (void) {
+  size_t inputSize = sampleInput(20);
+  size_t messages[] = { 1, 90, 128, 300, 0, 500 };
+  CompressorStream cs;
+  CS_New(&cs, newCompressorPredictor());
+  DecompressorStream ds;
+  DS_New(&ds, newDecompressorPredictor());
+
+  size_t sent = 0;
+  for (int i = 0; i < 6; i++) {
+    CS_Push(&cs, input + sent, messages[i]);
+    CS_Flush(&cs);
+    size_t archiveSize = CS_Pull(&cs, archive, sizeof(archive));
+    DS_Push(&ds, archive, archiveSize);
+    size_t restoredSize = DS_Pull(&ds, restored, sizeof(restored));
+    TEST_CHECK_(restoredSize == messages[i] && memcmp(input + sent, restored, messages[i]) == 0,
+        "Message %d: %zu of %zu bytes", i, restoredSize, messages[i]);
+    sent += messages[i];
+  }
+  TEST_CHECK(sent < inputSize);
+
+  CS_Finish(&cs);
+  size_t archiveSize = CS_Pull(&cs, archive, sizeof(archive));
+  DS_Push(&ds, archive, archiveSize);
+  TEST_CHECK(DS_Pull(&ds, restored, sizeof(restored)) == 0);
+  TEST_CHECK(DS_Finished(&ds));
+  CS_Free(&cs);
+  DS_Free(&ds);
+}
+
+// Two frames pushed back to back, split at odd places, decode as one stream
+void test_frames (void) {
+  size_t inputSize = sampleInput(40);
+  static uint8_t joined[sizeof(archive)];
+  size_t firstSize = compressChunks(1000, 64);
+  memcpy(joined, archive, firstSize);
+  size_t secondSize = compressChunks(inputSize, 64);
+  memcpy(joined + firstSize, archive, secondSize);
+  memcpy(archive, joined, firstSize + secondSize);
+
+  size_t restoredSize = decompressChunks(firstSize + secondSize, 11);
+  TEST_CHECK(restoredSize == 1000 + inputSize);
+  TEST_CHECK(memcmp(input, restored, 1000) == 0 && memcmp(input, restored + 1000, inputSize) == 0);
+
+  DecompressorStream ds;
+  DS_New(&ds, newDecompressorPredictor());
+  DS_Push(&ds, (const uint8_t *)"not an archive", 14);
+  TEST_CHECK(DS_Pull(&ds, restored, sizeof(restored)) == 0);
+  TEST_CHECK(DS_Failed(&ds) && !DS_Finished(&ds));
+  DS_Free(&ds);
+}
+
+TEST_LIST = {
+    { "chunks", test_chunks },
+    { "block_multiple", test_block_multiple },
+    { "same_as_buffer", test_same_as_buffer },
+    { "flush", test_flush },
+    { "frames", test_frames },
+    { NULL, NULL }
+};
@@ -0,0 +1,81 @@
+#include <stdatomic.h>
+
+#include "acutest.h"
+#include "threadpool.h"
+
+static atomic_int total;
+
+static void add (void * arg) {
+  atomic_fetch_add(&total, *(int *)arg);
+}
+
+void test_wait (void) {
+  ThreadPool pool;
+  TEST_CHECK(TP_New(&pool, 4));
+  TEST_CHECK(pool.threadCount == 4);
+
+  // More jobs than the queue starts out with
+  static int values[1000];
+  atomic_store(&total, 0);
+  for (int i = 0; i < 1000; i++) {
+    values[i] = i;
+    TP_Submit(&pool, add, &values[i]);
+  }
+  TP_Wait(&pool);
+  TEST_CHECK(atomic_load(&total) == 999 * 1000 / 2);
+
+  // The pool can be reused after a wait
+  TP_Submit(&pool, add, &values[5]);
+  TP_Wait(&pool);
+  TEST_CHECK(atomic_load(&total) == 999 * 1000 / 2 + 5);
+  TP_Free(&pool);
+}
+
+void test_free_finishes (void) {
+  ThreadPool pool;
+  TEST_CHECK(TP_New(&pool, 2));
+  static int one = 1;
+  atomic_store(&total, 0);
+  for (int i = 0; i < 100; i++) {
+    TP_Submit(&pool, add, &one);
+  }
+  TP_Free(&pool);
+  TEST_CHECK(atomic_load(&total) == 100);
+}
+
+static ThreadPool * nestedPool;
+
+// Splits itself into jobs the other threads have to steal from this thread's deque
+static void split (void * arg) {
+  static int one = 1;
+  for (int i = 0; i < 100; i++) {
+    TP_Submit(nestedPool, add, &one);
+  }
+  atomic_fetch_add(&total, *(int *)arg);
+}
+
+void test_nested (void) {
+  ThreadPool pool;
+  TEST_CHECK(TP_New(&pool, 3));
+  nestedPool = &pool;
+  static int thousand = 1000;
+  atomic_store(&total, 0);
+  for (int i = 0; i < 10; i++) {
+    TP_Submit(&pool, split, &thousand);
+  }
+  TP_Wait(&pool);
+  TEST_CHECK(atomic_load(&total) == 10 * (1000 + 100));
+  TP_Free(&pool);
+}
+
+void test_default_threads (void) {
+  TEST_CHECK(TP_DefaultThreads() >= 1);
+}
+
+TEST_LIST = {
+    { "wait", test_wait },
+    { "free_finishes", test_free_finishes },
+    { "nested", test_nested },
+    { "default_threads", test_default_threads },
+    { NULL, NULL }
+};